@@ -251,6 +251,7 @@ namespace AZ
     friend class AZ::HasComponentDependentServices<_ComponentClass>;                                                                    \
     friend class AZ::HasComponentRequiredServices<_ComponentClass>;                                                                     \
     friend class AZ::HasComponentIncompatibleServices<_ComponentClass>;                                                                 \
+    friend class AZ::HasComponentActivationThreadSafe<_ComponentClass>;                                                                 \
     static AZ::ComponentDescriptor* CreateDescriptor()                                                                                  \
     {                                                                                                                                   \
             AZ::ComponentDescriptor* descriptor = nullptr;                                                                              \
@@ -402,6 +403,22 @@ namespace AZ
          */
         virtual void GetWarnings([[maybe_unused]] StringWarningArray& warnings, [[maybe_unused]] const Component* instance) const { }
 
+        /**
+         * Specifies whether the provided, dependent, required and incompatible services are the same for every instance
+         * of the component. The entity uses this to cache the activation order of components by their types instead of
+         * sorting the components of every entity.
+         * @return Returns true if the services don't depend on the instance.
+         */
+        virtual bool HasInstanceIndependentServices() const { return false; }
+
+        /**
+         * Specifies whether instances of the component can be activated on a worker thread while other entities are
+         * activated in parallel. See Entity::ActivateEntities. Components that return true must not touch shared state
+         * in Activate other than thread safe buses, and should only rely on the services they require or depend on.
+         * @return Returns true if the component can be activated on any thread.
+         */
+        virtual bool IsActivationThreadSafe() const { return false; }
+
         /**
          * Gets the current descriptor.
          * @param instance The current descriptor.
@@ -495,6 +512,7 @@ namespace AZ
     AZ_HAS_STATIC_MEMBER(ComponentDependentServices, GetDependentServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentRequiredServices, GetRequiredServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentIncompatibleServices, GetIncompatibleServices, void, (ComponentDescriptor::DependencyArrayType &));
+    AZ_HAS_STATIC_MEMBER(ComponentActivationThreadSafe, IsActivationThreadSafe, bool, ());
     /// @endcond
 
     /**
@@ -567,6 +585,23 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * The services of the default descriptor come from static functions, so they're the same for every instance.
+         */
+        bool HasInstanceIndependentServices() const override
+        {
+            return true;
+        }
+
+        /**
+         * Calls the static function IsActivationThreadSafe, if the user provided it.
+         * @return Returns false if the component doesn't provide the function.
+         */
+        bool IsActivationThreadSafe() const override
+        {
+            return CallIsActivationThreadSafe(typename HasComponentActivationThreadSafe<ComponentClass>::type());
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
@@ -613,5 +648,15 @@ namespace AZ
         void CallIncompatibleServices(ComponentDescriptor::DependencyArrayType&, const AZStd::false_type&) const
         {
         }
+
+        bool CallIsActivationThreadSafe(const AZStd::true_type&) const
+        {
+            return ComponentClass::IsActivationThreadSafe();
+        }
+
+        bool CallIsActivationThreadSafe(const AZStd::false_type&) const
+        {
+            return false;
+        }
     };
 }
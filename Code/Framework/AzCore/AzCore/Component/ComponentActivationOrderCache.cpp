@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentActivationOrderCache.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    size_t ComponentActivationOrderCache::SignatureHasher::operator()(const Signature& signature) const
+    {
+        size_t hash = 0;
+        for (const Uuid& typeId : signature)
+        {
+            AZStd::hash_combine(hash, typeId.GetHash());
+        }
+        return hash;
+    }
+
+    bool ComponentActivationOrderCache::SortComponents(AZStd::vector<Component*>& components)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        AZStd::vector<Component*> signatureOrder;
+        Signature signature;
+        if (!GetSignature(components, signatureOrder, signature))
+        {
+            return false;
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            auto it = m_activationOrders.find(signature);
+            if (it != m_activationOrders.end())
+            {
+                const AZStd::vector<u32>& order = it->second.m_order;
+                for (size_t i = 0; i < order.size(); ++i)
+                {
+                    components[i] = signatureOrder[order[i]];
+                }
+                return true;
+            }
+        }
+
+        // Failures aren't cached so the next activation reports the reason through Entity::DependencySort.
+        ActivationOrder activationOrder;
+        if (!CalculateActivationOrder(signatureOrder, activationOrder))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < activationOrder.m_order.size(); ++i)
+        {
+            components[i] = signatureOrder[activationOrder.m_order[i]];
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_activationOrders.emplace(AZStd::move(signature), AZStd::move(activationOrder));
+        return true;
+    }
+
+    bool ComponentActivationOrderCache::GetActivationWaves(const AZStd::vector<Component*>& components, AZStd::vector<u32>& waves) const
+    {
+        AZStd::vector<Component*> signatureOrder;
+        Signature signature;
+        if (!GetSignature(components, signatureOrder, signature))
+        {
+            return false;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        auto it = m_activationOrders.find(signature);
+        if (it == m_activationOrders.end())
+        {
+            return false;
+        }
+
+        // The components may have been sorted before the order was cached or reordered since, so only use the waves
+        // if they were calculated for this exact order.
+        const AZStd::vector<u32>& order = it->second.m_order;
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            if (components[i] != signatureOrder[order[i]])
+            {
+                return false;
+            }
+        }
+
+        waves = it->second.m_waves;
+        return true;
+    }
+
+    void ComponentActivationOrderCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_activationOrders = {};
+    }
+
+    size_t ComponentActivationOrderCache::GetCachedOrderCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_activationOrders.size();
+    }
+
+    bool ComponentActivationOrderCache::GetSignature(
+        const AZStd::vector<Component*>& components, AZStd::vector<Component*>& signatureOrder, Signature& signature)
+    {
+        if (AZStd::find(components.begin(), components.end(), nullptr) != components.end())
+        {
+            return false;
+        }
+
+        // Entity::DependencySort breaks ties by underlying type and then by component id, so sorting the components
+        // the same way makes the activation order of components with matching types identical for every entity.
+        signatureOrder = components;
+        AZStd::sort(signatureOrder.begin(), signatureOrder.end(),
+            [](const Component* lhs, const Component* rhs)
+            {
+                const Uuid lhsType = lhs->GetUnderlyingComponentType();
+                const Uuid rhsType = rhs->GetUnderlyingComponentType();
+                return lhsType != rhsType ? lhsType < rhsType : lhs->GetId() < rhs->GetId();
+            });
+
+        signature.reserve(signatureOrder.size() * 2);
+        for (const Component* component : signatureOrder)
+        {
+            signature.push_back(azrtti_typeid(component));
+            signature.push_back(component->GetUnderlyingComponentType());
+        }
+        return true;
+    }
+
+    bool ComponentActivationOrderCache::CalculateActivationOrder(const AZStd::vector<Component*>& signatureOrder, ActivationOrder& result)
+    {
+        const size_t componentCount = signatureOrder.size();
+
+        AZStd::vector<const ComponentDescriptor*> descriptors;
+        descriptors.reserve(componentCount);
+        for (const Component* component : signatureOrder)
+        {
+            ComponentDescriptor* descriptor = nullptr;
+            ComponentDescriptorBus::EventResult(descriptor, azrtti_typeid(component), &ComponentDescriptorBus::Events::GetDescriptor);
+            if (!descriptor || !descriptor->HasInstanceIndependentServices())
+            {
+                return false;
+            }
+            descriptors.push_back(descriptor);
+        }
+
+        AZStd::vector<Component*> sortedComponents = signatureOrder;
+        if (!Entity::DependencySort(sortedComponents).IsSuccess())
+        {
+            return false;
+        }
+
+        result.m_order.resize(componentCount);
+        for (size_t i = 0; i < componentCount; ++i)
+        {
+            auto it = AZStd::find(signatureOrder.begin(), signatureOrder.end(), sortedComponents[i]);
+            result.m_order[i] = static_cast<u32>(AZStd::distance(signatureOrder.begin(), it));
+        }
+
+        // A component can be activated one wave after the last of the components providing the services it requires or
+        // depends on. Providers always come earlier in the activation order, so a single pass is enough.
+        AZStd::vector<ComponentDescriptor::DependencyArrayType> providedServices(componentCount);
+        ComponentDescriptor::DependencyArrayType neededServices;
+        result.m_waves.resize(componentCount);
+        for (size_t i = 0; i < componentCount; ++i)
+        {
+            const Component* component = sortedComponents[i];
+            const ComponentDescriptor* descriptor = descriptors[result.m_order[i]];
+            descriptor->GetProvidedServices(providedServices[i], component);
+
+            if (!descriptor->IsActivationThreadSafe())
+            {
+                result.m_waves[i] = MainThreadWave;
+                continue;
+            }
+
+            neededServices.clear();
+            descriptor->GetRequiredServices(neededServices, component);
+            descriptor->GetDependentServices(neededServices, component);
+
+            u32 wave = 0;
+            for (size_t provider = 0; provider < i && wave != MainThreadWave; ++provider)
+            {
+                const ComponentDescriptor::DependencyArrayType& provided = providedServices[provider];
+                const bool isProvider = AZStd::any_of(neededServices.begin(), neededServices.end(),
+                    [&provided](ComponentServiceType service)
+                    {
+                        return AZStd::find(provided.begin(), provided.end(), service) != provided.end();
+                    });
+                if (isProvider)
+                {
+                    const u32 providerWave = result.m_waves[provider];
+                    wave = providerWave == MainThreadWave ? MainThreadWave : AZStd::max(wave, providerWave + 1);
+                }
+            }
+            result.m_waves[i] = wave;
+        }
+        return true;
+    }
+} // namespace AZ
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    //! Caches the order in which the components of an entity are activated, keyed by the types of those components.
+    //! Sorting components by their services is one of the more expensive steps of activating an entity and most entities
+    //! share their component layout with many others, for instance the entities spawned from the same prefab.
+    //! Only entities whose components all report instance independent services through their descriptor are cached.
+    //! Next to the order the cache stores the wave in which each component can be activated by Entity::ActivateEntities.
+    //! The cache is owned by the ComponentApplication and is cleared whenever a component descriptor is (un)registered.
+    class ComponentActivationOrderCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ComponentActivationOrderCache, SystemAllocator, 0);
+        AZ_TYPE_INFO(ComponentActivationOrderCache, "{6F0C4D0B-9A6B-4C5E-8F0E-3D3E4B7A51C2}");
+
+        //! The wave of components that need to be activated on the thread that activates the entity, after all other waves.
+        static constexpr u32 MainThreadWave = AZStd::numeric_limits<u32>::max();
+
+        ComponentActivationOrderCache() = default;
+        AZ_DISABLE_COPY_MOVE(ComponentActivationOrderCache);
+
+        //! Sorts the components in activation order using the cached order for their types, sorting and caching the
+        //! order on a miss. The result is identical to Entity::DependencySort.
+        //! @return True if the components were sorted. False if they can't be cached or can't be sorted, in which case
+        //!         the components are left untouched.
+        bool SortComponents(AZStd::vector<Component*>& components);
+
+        //! Gets the activation wave of each of the components, which need to be in activation order.
+        //! Components in wave N only depend on components in waves before N, so all the components in a wave can be
+        //! activated in parallel. Components that aren't thread safe, or that depend on a component that isn't, are in
+        //! the MainThreadWave.
+        //! @return True if the order of the components is cached and matches, otherwise false.
+        bool GetActivationWaves(const AZStd::vector<Component*>& components, AZStd::vector<u32>& waves) const;
+
+        //! Removes all cached orders.
+        void Clear();
+
+        //! Returns the number of component layouts with a cached order.
+        size_t GetCachedOrderCount() const;
+
+    private:
+        //! The type and underlying type of each component, sorted by underlying type and component id.
+        using Signature = AZStd::vector<Uuid>;
+
+        struct SignatureHasher
+        {
+            size_t operator()(const Signature& signature) const;
+        };
+
+        struct ActivationOrder
+        {
+            //! For each position in the activation order the index of the component in the signature.
+            AZStd::vector<u32> m_order;
+            //! The activation wave of the component at each position in the activation order.
+            AZStd::vector<u32> m_waves;
+        };
+
+        //! Gets the signature of the components and the components in signature order. Returns false if a component is missing.
+        static bool GetSignature(const AZStd::vector<Component*>& components, AZStd::vector<Component*>& signatureOrder, Signature& signature);
+        //! Sorts the components, which are in signature order, and calculates their activation waves.
+        //! Returns false if the components can't be cached or sorted.
+        static bool CalculateActivationOrder(const AZStd::vector<Component*>& signatureOrder, ActivationOrder& result);
+
+        AZStd::unordered_map<Signature, ActivationOrder, SignatureHasher> m_activationOrders;
+        mutable AZStd::shared_mutex m_mutex;
+    };
+} // namespace AZ
@@ -628,6 +628,12 @@ namespace AZ
 
         Sfmt::Create();
 
+        m_componentActivationOrderCache = AZStd::make_unique<ComponentActivationOrderCache>();
+        if (Interface<ComponentActivationOrderCache>::Get() == nullptr)
+        {
+            Interface<ComponentActivationOrderCache>::Register(m_componentActivationOrderCache.get());
+        }
+
         CreateReflectionManager();
 
         if (m_startupParameters.m_createEditContext)
@@ -735,6 +741,12 @@ namespace AZ
 
         m_systemEntity.reset();
 
+        if (Interface<ComponentActivationOrderCache>::Get() == m_componentActivationOrderCache.get())
+        {
+            Interface<ComponentActivationOrderCache>::Unregister(m_componentActivationOrderCache.get());
+        }
+        m_componentActivationOrderCache.reset();
+
         Sfmt::Destroy();
 
         // delete all descriptors left for application clean up
@@ -994,6 +1006,12 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::RegisterComponentDescriptor(const ComponentDescriptor* descriptor)
     {
+        // Cached activation orders may depend on the services of a descriptor that was replaced.
+        if (m_componentActivationOrderCache)
+        {
+            m_componentActivationOrderCache->Clear();
+        }
+
         if (ReflectionEnvironment::GetReflectionManager())
         {
             ReflectionEnvironment::GetReflectionManager()->Reflect(descriptor->GetUuid(), AZStd::bind(&ComponentDescriptor::Reflect, descriptor, AZStd::placeholders::_1));
@@ -1005,6 +1023,11 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::UnregisterComponentDescriptor(const ComponentDescriptor* descriptor)
     {
+        if (m_componentActivationOrderCache)
+        {
+            m_componentActivationOrderCache->Clear();
+        }
+
         if (ReflectionEnvironment::GetReflectionManager())
         {
             ReflectionEnvironment::GetReflectionManager()->Unreflect(descriptor->GetUuid());
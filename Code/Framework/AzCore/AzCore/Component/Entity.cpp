@@ -6,6 +6,7 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/ComponentActivationOrderCache.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/EntityIdSerializer.h>
 #include <AzCore/Component/EntitySerializer.h>
@@ -14,6 +15,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/NamedEntityId.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Casting/lossy_cast.h>
 
@@ -190,22 +192,111 @@ namespace AZ
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+        if (!BeginActivate())
+        {
+            return;
+        }
+
+        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
+        {
+            ActivateComponent(**it);
+        }
+
+        EndActivate();
+    }
+
+    void Entity::ActivateEntities(const AZStd::vector<Entity*>& entities, JobContext* jobContext)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        constexpr u32 MainThreadWave = ComponentActivationOrderCache::MainThreadWave;
+
+        const ComponentActivationOrderCache* activationOrderCache = jobContext ? AZ::Interface<ComponentActivationOrderCache>::Get() : nullptr;
+
+        AZStd::vector<Entity*> activatingEntities;
+        activatingEntities.reserve(entities.size());
+        // The activation wave of every component of the activating entities, stored back to back.
+        AZStd::vector<u32> componentWaves;
+        // The components that can be activated on the jobs, per wave.
+        AZStd::vector<AZStd::vector<Component*>> waves;
+        AZStd::vector<u32> entityWaves;
+        for (Entity* entity : entities)
+        {
+            // Entity types that override Activate() are activated as usual.
+            if (azrtti_typeid(entity) != azrtti_typeid<Entity>())
+            {
+                entity->Activate();
+                continue;
+            }
+
+            if (!entity->BeginActivate())
+            {
+                continue;
+            }
+            activatingEntities.push_back(entity);
+
+            if (activationOrderCache && activationOrderCache->GetActivationWaves(entity->m_components, entityWaves))
+            {
+                for (size_t i = 0; i < entityWaves.size(); ++i)
+                {
+                    const u32 wave = entityWaves[i];
+                    if (wave != MainThreadWave)
+                    {
+                        if (wave >= waves.size())
+                        {
+                            waves.resize(wave + 1);
+                        }
+                        waves[wave].push_back(entity->m_components[i]);
+                    }
+                }
+                componentWaves.insert(componentWaves.end(), entityWaves.begin(), entityWaves.end());
+            }
+            else
+            {
+                componentWaves.insert(componentWaves.end(), entity->m_components.size(), MainThreadWave);
+            }
+        }
+
+        for (const AZStd::vector<Component*>& wave : waves)
+        {
+            AZ::parallel_for(size_t(0), wave.size(),
+                [&wave](size_t index)
+                {
+                    ActivateComponent(*wave[index]);
+                }, jobContext);
+        }
+
+        size_t componentIndex = 0;
+        for (Entity* entity : activatingEntities)
+        {
+            for (Component* component : entity->m_components)
+            {
+                if (componentWaves[componentIndex++] == MainThreadWave)
+                {
+                    ActivateComponent(*component);
+                }
+            }
+            entity->EndActivate();
+        }
+    }
+
+    bool Entity::BeginActivate()
+    {
         AZ_Assert(m_state == State::Init, "Entity should be in Init state to be Activated!");
 
         const DependencySortOutcome sortOutcome = EvaluateDependenciesGetDetails();
         if (!sortOutcome.IsSuccess())
         {
             AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", m_name.c_str(), m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
-            return;
+            return false;
         }
 
         SetState(State::Activating);
+        return true;
+    }
 
-        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
-        {
-            ActivateComponent(**it);
-        }
-
+    void Entity::EndActivate()
+    {
         // Cache the transform interface to the transform interface
         // Generally this pattern is not recommended unless for component event buses
         // As we have a guarantee (by design) that components can't change during active state)
@@ -259,8 +350,17 @@ namespace AZ
 
         if (!m_isDependencyReady)
         {
-            outcome = DependencySort(m_components);
-            m_isDependencyReady = outcome.IsSuccess();
+            // Most entities share their component layout with other entities, so try the cached order for their types first.
+            ComponentActivationOrderCache* activationOrderCache = AZ::Interface<ComponentActivationOrderCache>::Get();
+            if (activationOrderCache && activationOrderCache->SortComponents(m_components))
+            {
+                m_isDependencyReady = true;
+            }
+            else
+            {
+                outcome = DependencySort(m_components);
+                m_isDependencyReady = outcome.IsSuccess();
+            }
         }
 
         return outcome;
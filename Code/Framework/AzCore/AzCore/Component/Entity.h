@@ -21,6 +21,7 @@
 
 namespace AZ
 {
+    class JobContext;
     class Transform;
     class TransformInterface;
 
@@ -158,6 +159,16 @@ namespace AZ
         //! of each component.
         virtual void Activate();
 
+        //! Activates a batch of entities, such as the entities of a level or spawnable.
+        //! Components whose descriptor reports that their activation is thread safe are activated on the jobs of
+        //! the job context, in waves that respect the order of the component dependencies. All other components are
+        //! activated afterwards on the calling thread, in the same order Activate() would use. The activation events
+        //! of an entity are signaled on the calling thread once all of its components are active.
+        //! Components are activated serially if no job context is provided or their activation order isn't cached.
+        //! @param entities The entities to activate. They need to be in the State::Init state.
+        //! @param jobContext The job context to activate components with. Can be null.
+        static void ActivateEntities(const AZStd::vector<Entity*>& entities, JobContext* jobContext = nullptr);
+
         //! Deactivates the entity and its components.
         //! This function can be called multiple times throughout the lifetime of an
         //! entity. This function calls the Deactivate function of each component.
@@ -378,6 +389,13 @@ namespace AZ
         //! @param state the new state for the entity.
         void SetState(State state);
 
+        //! Evaluates the dependencies of the components and sets the state to State::Activating.
+        //! @return False if the components can't be sorted, in which case the entity can't be activated.
+        bool BeginActivate();
+
+        //! Sets the state to State::Active and signals that the entity was activated.
+        void EndActivate();
+
         //! Signals to listeners that the entity's name has changed.
         void OnNameChanged() const;
 
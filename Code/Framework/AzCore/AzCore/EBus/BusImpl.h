@@ -81,6 +81,147 @@ namespace AZ
             bool try_lock() { return true; }
             void unlock() {}
         };
+
+        // Mutex of the context of a bus which supports SharedDispatch. Dispatches lock it shared, connecting and disconnecting
+        // handlers lock it exclusively.
+        // Shared locks are counted per thread slot instead of in a single counter, so dispatches on different threads don't
+        // contend on the same cache line. Locking exclusively has to check all slots, which is fine as it's rare.
+        // Unlike AZStd::shared_mutex it prefers writers: while a thread waits for the exclusive lock, dispatches that start wait
+        // for it, so connecting and disconnecting isn't starved by a continuous stream of overlapping dispatches. Nested dispatches
+        // on a thread that already holds the lock shared don't wait, since the writer waits for that thread to finish.
+        // Tag makes the per thread lock count unique to a bus.
+        template <class Tag>
+        class SharedDispatchMutex
+        {
+        public:
+            SharedDispatchMutex() = default;
+            SharedDispatchMutex(const SharedDispatchMutex&) = delete;
+            SharedDispatchMutex& operator=(const SharedDispatchMutex&) = delete;
+
+            void lock_shared()
+            {
+                if (s_sharedLockCount++ > 0)
+                {
+                    // No writer can hold the lock while this thread holds it shared, so there's nothing to count.
+                    return;
+                }
+
+                AZStd::exponential_backoff backoff;
+                while (!TryLockSharedSlot())
+                {
+                    backoff.wait();
+                }
+            }
+
+            bool try_lock_shared()
+            {
+                if (s_sharedLockCount > 0 || TryLockSharedSlot())
+                {
+                    ++s_sharedLockCount;
+                    return true;
+                }
+                return false;
+            }
+
+            void unlock_shared()
+            {
+                if (--s_sharedLockCount == 0)
+                {
+                    m_readerSlots[GetThreadSlot()].m_count.fetch_sub(1, AZStd::memory_order_release);
+                }
+            }
+
+            void lock()
+            {
+                AZStd::exponential_backoff backoff;
+                bool expected = false;
+                while (!m_writer.compare_exchange_weak(expected, true, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    expected = false;
+                    backoff.wait();
+                }
+                // Dispatches that start from now on see the writer and wait, so only the ones in flight need to finish.
+                while (HasReaders())
+                {
+                    backoff.wait();
+                }
+            }
+
+            bool try_lock()
+            {
+                bool expected = false;
+                if (!m_writer.compare_exchange_strong(expected, true, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    return false;
+                }
+                if (HasReaders())
+                {
+                    m_writer.store(false, AZStd::memory_order_release);
+                    return false;
+                }
+                return true;
+            }
+
+            void unlock()
+            {
+                m_writer.store(false, AZStd::memory_order_release);
+            }
+
+        private:
+            static constexpr size_t ThreadSlotCount = 16;
+
+            struct ReaderSlot
+            {
+                AZ_ALIGN(AZStd::atomic<AZ::u32> m_count, 64); //alignment to avoid cache line sharing
+            };
+
+            // Threads are assigned a slot the first time they dispatch on the bus. Threads only share a slot when there are more
+            // threads than slots.
+            static size_t GetThreadSlot()
+            {
+                static AZStd::atomic<size_t> s_nextThreadSlot{ 0 };
+                thread_local static const size_t s_threadSlot = s_nextThreadSlot.fetch_add(1, AZStd::memory_order_relaxed) % ThreadSlotCount;
+                return s_threadSlot;
+            }
+
+            bool TryLockSharedSlot()
+            {
+                if (m_writer.load(AZStd::memory_order_seq_cst))
+                {
+                    return false;
+                }
+                // Count the reader before checking for a writer again. The writer sets its flag before checking the counts, so
+                // either the reader sees the writer or the writer sees the reader.
+                AZStd::atomic<AZ::u32>& count = m_readerSlots[GetThreadSlot()].m_count;
+                count.fetch_add(1, AZStd::memory_order_seq_cst);
+                if (m_writer.load(AZStd::memory_order_seq_cst))
+                {
+                    count.fetch_sub(1, AZStd::memory_order_release);
+                    return false;
+                }
+                return true;
+            }
+
+            bool HasReaders() const
+            {
+                for (const ReaderSlot& slot : m_readerSlots)
+                {
+                    if (slot.m_count.load(AZStd::memory_order_seq_cst) != 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            AZ_THREAD_LOCAL static AZ::u32 s_sharedLockCount;
+
+            ReaderSlot m_readerSlots[ThreadSlotCount] = {};
+            AZ_ALIGN(AZStd::atomic_bool m_writer, 64); // Set while a thread waits for or holds the lock exclusively.
+        };
+
+        template <class Tag>
+        AZ_THREAD_LOCAL AZ::u32 SharedDispatchMutex<Tag>::s_sharedLockCount = 0;
     }
 
     namespace BusInternal
@@ -606,6 +747,7 @@ namespace AZ
         inline void EBusEventer<Bus, Traits>::Bind(BusPtr& ptr, const BusIdType& id)
         {
             auto& context = Bus::GetOrCreateContext();
+            Bus::AssertNotInSharedDispatch(context);
             AZStd::scoped_lock<decltype(context.m_contextMutex)> lock(context.m_contextMutex);
             context.m_buses.Bind(ptr, id);
         }
@@ -829,8 +971,7 @@ namespace AZ
             auto& context = Bus::GetOrCreateContext(false);
             if (context.m_queue.IsActive())
             {
-                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
-                context.m_queue.m_messages.push(typename Bus::QueuePolicy::BusMessageCall(
+                context.m_queue.Push(typename Bus::QueuePolicy::BusMessageCall(
                     [func = AZStd::forward<Function>(func), args...]() mutable
                 {
                     AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
@@ -28,6 +28,7 @@
 // End backwards compat
 
 #include <AzCore/std/utils.h>
+#include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
@@ -178,6 +179,17 @@ namespace AZ
          */
         using EventQueueMutexType = NullMutex;
 
+        /**
+         * Specifies whether queued events are stored in lock-free per thread lists instead of a queue that is
+         * guarded by the #EventQueueMutexType.
+         * Queueing an event then never waits on other threads queueing events or on the thread executing them,
+         * and `<BusName>::ExecuteQueuedEvents()` takes all events queued so far in one go, executing them in
+         * the order they were queued. Use this on buses that many threads queue events on and that are
+         * drained by a single thread, such as the main thread.
+         * Used only when #EnableEventQueue is true.
+         */
+        static const bool EnableLockFreeEventQueue = false;
+
         /**
          * Enables custom logic to run when a handler connects or
          * disconnects from the EBus.
@@ -198,6 +210,20 @@ namespace AZ
         */
         static const bool LocklessDispatch = false;
 
+        /**
+        * Determines whether dispatches only take a shared lock on the bus.
+        * Any number of threads can then dispatch events at the same time without waiting on each other or contending on a
+        * shared counter, while connecting and disconnecting handlers waits for the dispatches in progress to finish. This suits
+        * read-mostly buses, where handlers are rarely connected or disconnected but events are sent from many threads.
+        * Connecting and disconnecting is preferred over dispatches that start while it waits, so it isn't starved by a steady
+        * stream of dispatches.
+        * Handlers can send events on the bus they're handling, but must not connect or disconnect handlers on it,
+        * because that waits for the dispatch the handler is part of to finish. This is asserted.
+        * The bus is always protected by a shared mutex, regardless of the #MutexType.
+        * Can't be combined with #LocklessDispatch.
+        */
+        static const bool SharedDispatch = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -440,7 +466,8 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = AZStd::conditional_t<Traits::EnableEventQueue && Traits::EnableLockFreeEventQueue,
+            EBusLockFreeQueuePolicy<ThisType>, EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>>;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -613,20 +640,25 @@ namespace AZ
             friend ThisType;
             friend Router;
         public:
+            static_assert(!(BusTraits::LocklessDispatch && BusTraits::SharedDispatch), "LocklessDispatch and SharedDispatch can't both be set on an EBus");
+
             /**
              * The mutex type to use during broadcast/event dispatch.
              * When LocklessDispatch is set on the EBus and a NullMutex is supplied a shared_mutex is used to protect the context otherwise the supplied MutexType is used
              * The reason why a recursive_mutex is used in this situation, is that specifying LocklessDispatch is implies that the EBus will be used across multiple threads
-             * @see EBusTraits::LocklessDispatch
+             * When SharedDispatch is set on the EBus a SharedDispatchMutex is always used, as dispatches lock it shared.
+             * @see EBusTraits::LocklessDispatch, EBusTraits::SharedDispatch
              */
-            using ContextMutexType = AZStd::conditional_t<BusTraits::LocklessDispatch && AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::shared_mutex, MutexType>;
+            using ContextMutexType = AZStd::conditional_t<BusTraits::SharedDispatch, AZ::Internal::SharedDispatchMutex<Context>,
+                AZStd::conditional_t<BusTraits::LocklessDispatch && AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::shared_mutex, MutexType>>;
 
             /**
-             * The scoped lock guard to use (either AZStd::scoped_lock<MutexType> or NullLockGuard<MutexType>
+             * The scoped lock guard to use (either AZStd::scoped_lock<MutexType>, AZStd::shared_lock<MutexType> or NullLockGuard<MutexType>
              * during broadcast/event dispatch.
-             * @see EBusTraits::LocklessDispatch
+             * @see EBusTraits::LocklessDispatch, EBusTraits::SharedDispatch
              */
-            using DispatchLockGuard = AZStd::conditional_t<BusTraits::LocklessDispatch, AZ::Internal::NullLockGuard<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>;
+            using DispatchLockGuard = AZStd::conditional_t<BusTraits::LocklessDispatch, AZ::Internal::NullLockGuard<ContextMutexType>,
+                AZStd::conditional_t<BusTraits::SharedDispatch, AZStd::shared_lock<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>>;
 
             /**
             * The scoped lock guard to use during connection.  Some specialized policies execute handler methods which
@@ -706,6 +738,21 @@ namespace AZ
         static Context& GetOrCreateContext(bool trackCallstack=true);
 
         static bool IsInDispatch(Context* context = GetContext(false));
+
+        /**
+         * Returns whether the calling thread is dispatching an event on the bus, for example when called from a handler.
+         * @param context The bus context.
+         * @return True if a dispatch on the calling thread is in progress, otherwise false.
+         */
+        static bool IsInDispatchThisThread(Context* context = GetContext(false));
+
+        /**
+         * Asserts when a handler is connected or disconnected from a dispatch on a bus with EBusTraits::SharedDispatch set.
+         * The dispatch holds the context mutex shared, so connecting or disconnecting, which locks it exclusively, would deadlock.
+         * Call this before locking the context mutex.
+         * @param context The bus context.
+         */
+        static void AssertNotInSharedDispatch(Context& context);
         /// @cond EXCLUDE_DOCS
         struct RouterCallstackEntry
             : public CallstackEntry
@@ -977,6 +1024,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
         Context& context = GetOrCreateContext();
         // scoped lock guard in case of exception / other odd situation
         // Context mutex is separate from the Dispatch lock guard and therefore this is safe to lock this mutex while in the middle of a dispatch
+        AssertNotInSharedDispatch(context);
         ConnectLockGuard lock(context.m_contextMutex);
         ConnectInternal(context, handler, lock, id);
     }
@@ -1012,6 +1060,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
         if (Context* context = GetContext())
         {
             // scoped lock guard in case of exception / other odd situation
+            AssertNotInSharedDispatch(*context);
             AZStd::scoped_lock<decltype(context->m_contextMutex)> lock(context->m_contextMutex);
             DisconnectInternal(*context, handler);
         }
@@ -1210,6 +1259,29 @@ AZ_POP_DISABLE_WARNING
         return context != nullptr && context->m_dispatches > 0;
     }
 
+    //=========================================================================
+    // IsInDispatchThisThread
+    //=========================================================================
+    template<class Interface, class Traits>
+    bool EBus<Interface, Traits>::IsInDispatchThisThread(Context* context)
+    {
+        return context != nullptr && context->s_callstack != nullptr && context->s_callstack->m_prev != nullptr;
+    }
+
+    //=========================================================================
+    // AssertNotInSharedDispatch
+    //=========================================================================
+    template<class Interface, class Traits>
+    void EBus<Interface, Traits>::AssertNotInSharedDispatch([[maybe_unused]] Context& context)
+    {
+        if constexpr (Traits::SharedDispatch)
+        {
+            AZ_Assert(!IsInDispatchThisThread(&context),
+                "Handlers can't be connected or disconnected during a dispatch on a SharedDispatch EBus, because this deadlocks "
+                "on the shared lock held by the dispatch. Queue the connect or disconnect instead.");
+        }
+    }
+
     //=========================================================================
     template<class Interface, class Traits>
     EBus<Interface, Traits>::RouterCallstackEntry::RouterCallstackEntry(Iterator it, const BusIdType* busId, bool isQueued, bool isReverse)
@@ -1250,6 +1322,7 @@ AZ_POP_DISABLE_WARNING
         void NonIdHandler<Interface, Traits, ContainerType>::BusConnect()
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
+            BusType::AssertNotInSharedDispatch(context);
             typename BusType::Context::ConnectLockGuard contextLock(context.m_contextMutex);
             if (!BusIsConnected())
             {
@@ -1263,6 +1336,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                BusType::AssertNotInSharedDispatch(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnected())
                 {
@@ -1277,6 +1351,7 @@ AZ_POP_DISABLE_WARNING
         void IdHandler<Interface, Traits, ContainerType>::BusConnect(const IdType& id)
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
+            BusType::AssertNotInSharedDispatch(context);
             typename BusType::Context::ConnectLockGuard contextLock(context.m_contextMutex);
             if (BusIsConnected())
             {
@@ -1297,6 +1372,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                BusType::AssertNotInSharedDispatch(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnectedId(id))
                 {
@@ -1309,6 +1385,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                BusType::AssertNotInSharedDispatch(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnected())
                 {
@@ -1323,6 +1400,7 @@ AZ_POP_DISABLE_WARNING
         void MultiHandler<Interface, Traits, ContainerType>::BusConnect(const IdType& id)
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
+            BusType::AssertNotInSharedDispatch(context);
             typename BusType::Context::ConnectLockGuard contextLock(context.m_contextMutex);
             if (m_handlerNodes.find(id) == m_handlerNodes.end())
             {
@@ -1337,6 +1415,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                BusType::AssertNotInSharedDispatch(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 auto nodeIt = m_handlerNodes.find(id);
                 if (nodeIt != m_handlerNodes.end())
@@ -1355,6 +1434,7 @@ AZ_POP_DISABLE_WARNING
             decltype(m_handlerNodes) handlerNodesToDisconnect;
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                BusType::AssertNotInSharedDispatch(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 handlerNodesToDisconnect = AZStd::move(m_handlerNodes);
 
@@ -1777,13 +1857,14 @@ AZ_POP_DISABLE_WARNING
             {
                 auto* context = EBus::GetContext();
                 EBUS_ASSERT(context, "Internal error: context deleted while router attached.");
+                // We could support connection/disconnection while routing a message, but it would require a call to a fix
+                // function because there is already a stack entry. This is typically not a good pattern because routers are
+                // executed often. If time is not important to you, you can always queue the connect/disconnect functions
+                // on the TickBus or another safe bus.
+                // This is checked before locking, since locking would already deadlock on a SharedDispatch bus.
+                AZ_Assert(context->s_callstack->m_prev == nullptr, "Current we don't allow router disconnect while in a message on the bus!");
                 {
                     AZStd::scoped_lock<decltype(context->m_contextMutex)> lock(context->m_contextMutex);
-                    // We could support connection/disconnection while routing a message, but it would require a call to a fix
-                    // function because there is already a stack entry. This is typically not a good pattern because routers are
-                    // executed often. If time is not important to you, you can always queue the connect/disconnect functions
-                    // on the TickBus or another safe bus.
-                    AZ_Assert(context->s_callstack->m_prev == nullptr, "Current we don't allow router disconnect while in a message on the bus!");
                     context->m_routing.m_routers.erase(&m_routerNode);
                 }
                 m_isConnected = false;
@@ -17,6 +17,8 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
@@ -226,6 +228,7 @@ namespace AZ
     struct EBusQueuePolicy
     {
         typedef AZ::Internal::NullBusMessageCall BusMessageCall;
+        void Push(BusMessageCall&&) {};
         void Execute() {};
         void Clear() {};
         void SetActive(bool /*isActive*/) {};
@@ -247,6 +250,12 @@ namespace AZ
         MessageQueueType            m_messages;
         MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
 
+        void Push(BusMessageCall&& message)
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_messages.push(AZStd::move(message));
+        }
+
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
@@ -304,6 +313,245 @@ namespace AZ
         }
     };
 
+    /**
+     * Function queue that is used when AZ::EBusTraits::EnableLockFreeEventQueue is set.
+     * Every thread pushes queued functions onto an intrusive list of its own, so threads that queue functions don't
+     * contend on a shared list or wait on the thread executing them. Each function gets a number from a shared sequence
+     * when it's queued, which Execute uses to merge the lists so the functions run in the order they were queued.
+     * Functions that come after one that's still being pushed by another thread wait for it, so a function never runs
+     * before one that was queued earlier.
+     */
+    template <class Bus>
+    struct EBusLockFreeQueuePolicy
+    {
+        typedef AZStd::function<void()> BusMessageCall;
+
+        EBusLockFreeQueuePolicy() = default;
+        EBusLockFreeQueuePolicy(const EBusLockFreeQueuePolicy&) = delete;
+        EBusLockFreeQueuePolicy& operator=(const EBusLockFreeQueuePolicy&) = delete;
+
+        ~EBusLockFreeQueuePolicy()
+        {
+            MessageNode* messages = m_pendingMessages;
+            TakeThreadMessages(messages);
+            DestroyMessages(messages);
+        }
+
+        void Push(BusMessageCall&& message)
+        {
+            typename Bus::AllocatorType allocator;
+            MessageNode* node = new (allocator.allocate(sizeof(MessageNode), alignof(MessageNode))) MessageNode{ AZStd::move(message), nullptr, 0 };
+
+            // A queue that happens after another one on a different thread always gets a higher sequence number.
+            node->m_sequence = m_pushSequence.fetch_add(1, AZStd::memory_order_relaxed);
+
+            // Only threads that share a slot contend on its list, which doesn't happen until there are more threads than slots.
+            AZStd::atomic<MessageNode*>& threadMessages = m_threadMessages[GetThreadSlot()].m_head;
+            MessageNode* head = threadMessages.load(AZStd::memory_order_relaxed);
+            do
+            {
+                node->m_next = head;
+            } while (!threadMessages.compare_exchange_weak(head, node, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+        }
+
+        void Execute()
+        {
+            AZ_Warning("System", IsActive(), "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+            while (MessageNode* message = TakeReadyMessages())
+            {
+                // A message can clear the queue, in which case the messages left in this batch are dropped as well.
+                const AZ::u32 clearCount = m_clearCount.load(AZStd::memory_order_relaxed);
+                while (message && clearCount == m_clearCount.load(AZStd::memory_order_relaxed))
+                {
+                    MessageNode* next = message->m_next;
+                    m_retiredCount.fetch_add(1, AZStd::memory_order_relaxed);
+                    message->m_call();
+                    DestroyMessage(message);
+                    message = next;
+                }
+                DestroyMessages(message);
+            }
+        }
+
+        void Clear()
+        {
+            MessageNode* messages = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_executeMutex);
+                m_clearCount.fetch_add(1, AZStd::memory_order_relaxed);
+                messages = m_pendingMessages;
+                m_pendingMessages = nullptr;
+                TakeThreadMessages(messages);
+                // Messages that were still being pushed aren't cleared. They run as soon as they arrive instead of holding up
+                // the messages that are queued after the clear.
+                m_nextSequence = m_pushSequence.load(AZStd::memory_order_relaxed);
+            }
+            DestroyMessages(messages);
+        }
+
+        void SetActive(bool isActive)
+        {
+            m_isActive.store(isActive, AZStd::memory_order_relaxed);
+            if (!isActive)
+            {
+                Clear();
+            }
+        }
+
+        bool IsActive()
+        {
+            return m_isActive.load(AZStd::memory_order_relaxed);
+        }
+
+        size_t Count()
+        {
+            const AZ::u64 retiredCount = m_retiredCount.load(AZStd::memory_order_relaxed);
+            const AZ::u64 pushedCount = m_pushSequence.load(AZStd::memory_order_relaxed);
+            return pushedCount > retiredCount ? static_cast<size_t>(pushedCount - retiredCount) : 0;
+        }
+
+    private:
+        struct MessageNode
+        {
+            BusMessageCall m_call;
+            MessageNode* m_next;
+            AZ::u64 m_sequence;
+        };
+
+        struct ThreadMessages
+        {
+            AZ_ALIGN(AZStd::atomic<MessageNode*> m_head, 64); //alignment to avoid cache line sharing
+        };
+
+        static constexpr size_t ThreadSlotCount = 16;
+
+        //! Threads are assigned a slot the first time they queue a message on a bus of this type.
+        static size_t GetThreadSlot()
+        {
+            static AZStd::atomic<size_t> s_nextThreadSlot{ 0 };
+            thread_local static const size_t s_threadSlot = s_nextThreadSlot.fetch_add(1, AZStd::memory_order_relaxed) % ThreadSlotCount;
+            return s_threadSlot;
+        }
+
+        //! Adds the messages of all threads to the front of the list. Returns true if any messages were added.
+        bool TakeThreadMessages(MessageNode*& messages)
+        {
+            bool hasTakenMessages = false;
+            for (ThreadMessages& threadMessages : m_threadMessages)
+            {
+                if (!threadMessages.m_head.load(AZStd::memory_order_relaxed))
+                {
+                    continue;
+                }
+                MessageNode* message = threadMessages.m_head.exchange(nullptr, AZStd::memory_order_acquire);
+                while (message)
+                {
+                    MessageNode* next = message->m_next;
+                    message->m_next = messages;
+                    messages = message;
+                    message = next;
+                    hasTakenMessages = true;
+                }
+            }
+            return hasTakenMessages;
+        }
+
+        //! Returns the messages that can run, in the order they were queued. Messages that follow one that's still being pushed
+        //! are kept for later.
+        MessageNode* TakeReadyMessages()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_executeMutex);
+            MessageNode* readyMessages = nullptr;
+            MessageNode** readyTail = &readyMessages;
+            MessageNode* messages = m_pendingMessages;
+            bool hasNewMessages = true;
+            while (hasNewMessages)
+            {
+                hasNewMessages = TakeThreadMessages(messages);
+                messages = SortBySequence(messages);
+                while (messages && messages->m_sequence <= m_nextSequence)
+                {
+                    if (messages->m_sequence == m_nextSequence)
+                    {
+                        ++m_nextSequence;
+                    }
+                    *readyTail = messages;
+                    readyTail = &messages->m_next;
+                    messages = messages->m_next;
+                }
+                if (!messages)
+                {
+                    break;
+                }
+                // A message is missing from the sequence because it's still being pushed, so check if it has arrived by now.
+            }
+            *readyTail = nullptr;
+            m_pendingMessages = messages;
+            return readyMessages;
+        }
+
+        static MessageNode* SortBySequence(MessageNode* messages)
+        {
+            if (!messages || !messages->m_next)
+            {
+                return messages;
+            }
+
+            MessageNode* middle = messages;
+            for (MessageNode* end = messages->m_next; end && end->m_next; end = end->m_next->m_next)
+            {
+                middle = middle->m_next;
+            }
+            MessageNode* second = SortBySequence(middle->m_next);
+            middle->m_next = nullptr;
+            MessageNode* first = SortBySequence(messages);
+
+            MessageNode* sorted = nullptr;
+            MessageNode** sortedTail = &sorted;
+            while (first && second)
+            {
+                MessageNode*& earliest = first->m_sequence < second->m_sequence ? first : second;
+                *sortedTail = earliest;
+                sortedTail = &earliest->m_next;
+                earliest = earliest->m_next;
+            }
+            *sortedTail = first ? first : second;
+            return sorted;
+        }
+
+        void DestroyMessage(MessageNode* message)
+        {
+            message->~MessageNode();
+            typename Bus::AllocatorType allocator;
+            allocator.deallocate(message, sizeof(MessageNode), alignof(MessageNode));
+        }
+
+        void DestroyMessages(MessageNode* message)
+        {
+            while (message)
+            {
+                MessageNode* next = message->m_next;
+                m_retiredCount.fetch_add(1, AZStd::memory_order_relaxed);
+                DestroyMessage(message);
+                message = next;
+            }
+        }
+
+        ThreadMessages m_threadMessages[ThreadSlotCount] = {};
+        AZStd::atomic<AZ::u64> m_pushSequence{ 0 };
+        AZStd::atomic<AZ::u64> m_retiredCount{ 0 };
+        AZStd::atomic<AZ::u32> m_clearCount{ 0 };
+        AZStd::atomic_bool m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+
+        //! Guards the messages that are taken from the threads, so only one thread at a time merges them. Never held while a
+        //! message runs.
+        AZStd::mutex m_executeMutex;
+        //! Messages that follow one that's still being pushed, sorted by sequence.
+        MessageNode* m_pendingMessages = nullptr;
+        //! The sequence number of the next message to run.
+        AZ::u64 m_nextSequence = 0;
+    };
+
     /// @endcond
 
     ////////////////////////////////////////////////////////////
@@ -11,6 +11,8 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -1448,29 +1450,214 @@ using namespace AZ;
         _varName = "?";                                                       \
         }
 
+namespace AZ
+{
+    namespace Internal
+    {
+        //=========================================================================
+        // LuaBlockPool
+        // Lua allocates every table, closure, string and userdata through the memory hook. Most of those are small and
+        // short lived, like the userdata of the math values scripts create every tick, so freed small blocks are kept in
+        // free lists per size and recycled without going through the allocator. A Lua state is only used by one thread at
+        // a time, so the pool doesn't lock. Pages come from the allocator of the script context, so its stats include
+        // them, and are aligned to their size, so a block finds its page from its address. The pages that have no live
+        // blocks left are returned to the allocator by Trim, once a garbage collection cycle finishes, and the rest when
+        // the pool is destroyed, which has to be after the Lua state is closed.
+        //=========================================================================
+        class LuaBlockPool
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(LuaBlockPool, AZ::SystemAllocator, 0);
+
+            static constexpr size_t BlockAlignment = LUA_DEFAULT_ALIGNMENT;
+            static constexpr size_t MaxBlockSize = 256;
+            static constexpr size_t PageSize = 64 * 1024;
+
+            explicit LuaBlockPool(IAllocatorAllocate* allocator)
+                : m_allocator(allocator)
+            {
+            }
+
+            ~LuaBlockPool()
+            {
+                while (m_pages)
+                {
+                    Page* page = m_pages;
+                    m_pages = page->m_next;
+                    m_allocator->DeAllocate(page, PageSize, PageSize);
+                }
+            }
+
+            AZ_DISABLE_COPY_MOVE(LuaBlockPool);
+
+            void* Allocate(size_t size)
+            {
+                if (size > MaxBlockSize)
+                {
+                    return m_allocator->Allocate(size, BlockAlignment, 0, "Script", __FILE__, __LINE__, 1);
+                }
+
+                const size_t sizeClass = GetSizeClass(size);
+                if (FreeBlock* block = m_freeLists[sizeClass])
+                {
+                    m_freeLists[sizeClass] = block->m_next;
+                    ++GetPage(block)->m_liveBlocks;
+                    return block;
+                }
+
+                const size_t blockSize = (sizeClass + 1) * BlockAlignment;
+                if (m_pageCursor + blockSize > m_pageEnd)
+                {
+                    // the remainder of the current page is smaller than MaxBlockSize, and is left unused
+                    Page* page = reinterpret_cast<Page*>(m_allocator->Allocate(PageSize, PageSize, 0, "Script LuaBlockPool", __FILE__, __LINE__, 1));
+                    if (!page)
+                    {
+                        return nullptr;
+                    }
+                    page->m_next = m_pages;
+                    page->m_liveBlocks = 0;
+                    m_pages = page;
+                    m_pageCursor = reinterpret_cast<char*>(page) + PageHeaderSize;
+                    m_pageEnd = reinterpret_cast<char*>(page) + PageSize;
+                }
+
+                void* block = m_pageCursor;
+                m_pageCursor += blockSize;
+                ++GetPage(block)->m_liveBlocks;
+                return block;
+            }
+
+            void DeAllocate(void* ptr, size_t size)
+            {
+                if (size > MaxBlockSize)
+                {
+                    m_allocator->DeAllocate(ptr);
+                    return;
+                }
+
+                const size_t sizeClass = GetSizeClass(size);
+                FreeBlock* block = reinterpret_cast<FreeBlock*>(ptr);
+                block->m_next = m_freeLists[sizeClass];
+                m_freeLists[sizeClass] = block;
+                --GetPage(block)->m_liveBlocks;
+            }
+
+            void* ReAllocate(void* ptr, size_t oldSize, size_t newSize)
+            {
+                if (oldSize > MaxBlockSize && newSize > MaxBlockSize)
+                {
+                    return m_allocator->ReAllocate(ptr, newSize, BlockAlignment);
+                }
+                else if (oldSize <= MaxBlockSize && newSize <= MaxBlockSize && GetSizeClass(oldSize) == GetSizeClass(newSize))
+                {
+                    return ptr;
+                }
+
+                void* newPtr = Allocate(newSize);
+                if (newPtr)
+                {
+                    memcpy(newPtr, ptr, AZStd::GetMin(oldSize, newSize));
+                    DeAllocate(ptr, oldSize);
+                }
+                return newPtr;
+            }
+
+            //! Returns the pages that have no live blocks to the allocator, after removing their blocks from the free lists.
+            void Trim()
+            {
+                for (FreeBlock*& freeList : m_freeLists)
+                {
+                    FreeBlock** link = &freeList;
+                    while (*link)
+                    {
+                        if (GetPage(*link)->m_liveBlocks == 0)
+                        {
+                            *link = (*link)->m_next;
+                        }
+                        else
+                        {
+                            link = &(*link)->m_next;
+                        }
+                    }
+                }
+
+                Page** link = &m_pages;
+                while (*link)
+                {
+                    Page* page = *link;
+                    if (page->m_liveBlocks == 0)
+                    {
+                        if (m_pageCursor && GetPage(m_pageCursor - 1) == page)
+                        {
+                            m_pageCursor = nullptr;
+                            m_pageEnd = nullptr;
+                        }
+                        *link = page->m_next;
+                        m_allocator->DeAllocate(page, PageSize, PageSize);
+                    }
+                    else
+                    {
+                        link = &page->m_next;
+                    }
+                }
+            }
+
+        private:
+            struct FreeBlock
+            {
+                FreeBlock* m_next;
+            };
+
+            struct Page
+            {
+                Page* m_next;
+                size_t m_liveBlocks;
+            };
+
+            static constexpr size_t PageHeaderSize = AZ_SIZE_ALIGN_UP(sizeof(Page), BlockAlignment);
+
+            static size_t GetSizeClass(size_t size)
+            {
+                return size == 0 ? 0 : (size - 1) / BlockAlignment;
+            }
+
+            static Page* GetPage(void* block)
+            {
+                return reinterpret_cast<Page*>(reinterpret_cast<uintptr_t>(block) & ~static_cast<uintptr_t>(PageSize - 1));
+            }
+
+            IAllocatorAllocate* m_allocator;
+            FreeBlock* m_freeLists[MaxBlockSize / BlockAlignment] = {};
+            Page* m_pages = nullptr;
+            char* m_pageCursor = nullptr;
+            char* m_pageEnd = nullptr;
+        };
+    } // namespace Internal
+} // namespace AZ
+
 //=========================================================================
 // Lua Memory manager hook
 // [3/19/2012]
 //=========================================================================
 static void* LuaMemoryHook(void* userData, void* ptr, size_t osize, size_t nsize)
 {
-    (void)osize;
-    IAllocatorAllocate* allocator = reinterpret_cast<IAllocatorAllocate*>(userData);
+    // Lua passes the size of the block in osize whenever ptr is set, which the pool uses to find the block's size class
+    AZ::Internal::LuaBlockPool* pool = reinterpret_cast<AZ::Internal::LuaBlockPool*>(userData);
     if (nsize == 0)
     {
         if (ptr)
         {
-            allocator->DeAllocate(ptr);
+            pool->DeAllocate(ptr, osize);
         }
         return NULL;
     }
     else if (ptr == NULL)
     {
-        return allocator->Allocate(nsize, LUA_DEFAULT_ALIGNMENT, 0, "Script", __FILE__, __LINE__, 1);
+        return pool->Allocate(nsize);
     }
     else
     {
-        return allocator->ReAllocate(ptr, nsize, LUA_DEFAULT_ALIGNMENT);
+        return pool->ReAllocate(ptr, osize, nsize);
     }
 }
 
@@ -3409,8 +3596,12 @@ LUA_API const Node* lua_getDummyNode()
                     AZ_Assert(fromStack, "Argument %s for Method %s doesn't have support to be converted to Lua!", arg->m_name, method->m_name.c_str());
 
                     m_fromLua.push_back(AZStd::make_pair(fromStack, argClass));
+                    m_arguments.push_back(arg);
                 }
 
+                m_minNumArguments = static_cast<int>(m_method->GetMinNumberOfArguments());
+                m_isMember = m_method->IsMember();
+
                 if (method->HasResult())
                 {
                     m_resultToLua = ToLuaStack(context, method->GetResult(), &m_prepareResult, m_resultClass);
@@ -3442,28 +3633,28 @@ LUA_API const Node* lua_getDummyNode()
 
                 // check number of arguments
                 int numElementsOnStack = lua_gettop(lua);
-                if (numElementsOnStack < static_cast<int>(thisPtr->m_method->GetMinNumberOfArguments()))
+                if (numElementsOnStack < thisPtr->m_minNumArguments)
                 {
                     // we can here load default parameters 
-                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_method->GetMinNumberOfArguments(), numElementsOnStack);
+                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_minNumArguments, numElementsOnStack);
                     return 0;
                 }
 
                 // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
-                // this limit of 40 is however implicit, for now.
-                BehaviorValueParameter arguments[40];
+                // this limit of 40 is however implicit, for now. Only the parameters of the arguments that are passed are constructed.
+                int numArguments = GetMin(static_cast<int>(thisPtr->m_arguments.size()), numElementsOnStack);
+                AZ_Assert(numArguments <= MaxNumArguments, "Increase the argument array size!");
+
+                AZStd::fixed_vector<BehaviorValueParameter, MaxNumArguments> arguments(numArguments);
                 BehaviorValueParameter result;
                 ScriptContext::StackVariableAllocator tempData;
                 AZStd::allocator backupAllocator;
                 bool usedBackupAlloc  = false;
 
-                int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
-                AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
-
                 // for each argument read a variable from the stack to a BehaviorValueParameter
                 for (int i = 0; i < numArguments; ++i)
                 {
-                    const AZ::BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
+                    const AZ::BehaviorParameter* parameter = thisPtr->m_arguments[i];
                     arguments[i].Set(*parameter); // store the type of result we expect (pointer, const, etc.)
                     if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
                     {
@@ -3474,13 +3665,25 @@ LUA_API const Node* lua_getDummyNode()
                 }
 
                 // If this pointer passed, ensure it isn't nil
-                if (thisPtr->m_method->IsMember() &&
+                if (thisPtr->m_isMember &&
                     *arguments[0].GetAsUnsafe<void*>() == nullptr)
                 {
                     ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Cannot pass nil as 'this' ptr to member function %s.", thisPtr->m_method->m_name.c_str());
                     return 0;
                 }
-                int numResults = 0;
+
+                // The result is pushed as soon as it is assigned, as it may reference a temporary of the call.
+                // The callback only captures a pointer to this state, so it fits in the function's small buffer and
+                // doesn't allocate on every call.
+                struct ResultToLua
+                {
+                    LuaScriptCaller* m_caller;
+                    lua_State* m_lua;
+                    BehaviorValueParameter* m_result;
+                    int m_numResults;
+                };
+                ResultToLua resultToLua{ thisPtr, lua, &result, 0 };
+                int& numResults = resultToLua.m_numResults;
 
                 if (thisPtr->m_resultToLua)
                 {
@@ -3491,18 +3694,18 @@ LUA_API const Node* lua_getDummyNode()
                         usedBackupAlloc  = thisPtr->m_prepareResult(result, thisPtr->m_resultClass, tempData, &backupAllocator); // pass temp memory and class info
                     }
 
-                    // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    // TODO: Make it optional for EBuses only.
+                    result.m_onAssignedResult = AZStd::function<void()>([state = &resultToLua]()
                     {
-                        if (result.m_value)
+                        if (state->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            state->m_caller->m_resultToLua(state->m_lua, *state->m_result);
+                            ++state->m_numResults;
                         }
                     });
                 }
 
-                bool isCalled = thisPtr->m_method->Call(arguments, numArguments, thisPtr->m_resultToLua ? &result : nullptr);
+                bool isCalled = thisPtr->m_method->Call(arguments.data(), numArguments, thisPtr->m_resultToLua ? &result : nullptr);
 
                 if (!isCalled)
                 {
@@ -3558,7 +3761,13 @@ LUA_API const Node* lua_getDummyNode()
                 return numResults;
             }
 
+            static constexpr int MaxNumArguments = 40;
+
             AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
+            // the method's argument parameters, cached so a call doesn't need to look them up
+            AZStd::vector<const BehaviorParameter*> m_arguments;
+            int m_minNumArguments = 0;
+            bool m_isMember = false;
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
@@ -4308,7 +4517,8 @@ LUA_API const Node* lua_getDummyNode()
                         m_luaAllocator.Create(desc);
                         allocator = m_luaAllocator.Get();
                     }
-                    m_lua = lua_newstate(&LuaMemoryHook, allocator);
+                    m_luaBlockPool.reset(aznew Internal::LuaBlockPool(allocator));
+                    m_lua = lua_newstate(&LuaMemoryHook, m_luaBlockPool.get());
                     AZ_Assert(m_lua, "Failed to create new LUA state!");
                 }
 
@@ -5652,6 +5862,26 @@ LUA_API const Node* lua_getDummyNode()
             void GarbageCollect()
             {
                 lua_gc(m_lua, LUA_GCCOLLECT, 0);
+                TrimBlockPool();
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            void GarbageCollectStep(int numberOfSteps)
+            {
+                // trimming walks the free lists, so it's only done once the steps finish a collection cycle
+                if (lua_gc(m_lua, LUA_GCSTEP, numberOfSteps))
+                {
+                    TrimBlockPool();
+                }
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            void TrimBlockPool()
+            {
+                if (m_luaBlockPool)
+                {
+                    m_luaBlockPool->Trim();
+                }
             }
 
             //////////////////////////////////////////////////////////////////////////
@@ -5801,6 +6031,7 @@ LUA_API const Node* lua_getDummyNode()
             AZStd::vector< ScriptTypeFactory >  m_scriptPropertyArrayFactories;
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             AllocatorWrapper<Internal::LuaSystemAllocator> m_luaAllocator;
+            AZStd::unique_ptr<Internal::LuaBlockPool> m_luaBlockPool; ///< Declared after m_luaAllocator, as its pages are returned to it.
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
         };
     } // namespace AZ
@@ -5839,13 +6070,13 @@ LUA_API const Node* lua_getDummyNode()
     //////////////////////////////////////////////////////////////////////////
     void ScriptContext::GarbageCollect()
     {
-        lua_gc(m_impl->m_lua, LUA_GCCOLLECT, 0);
+        m_impl->GarbageCollect();
     }
 
     //////////////////////////////////////////////////////////////////////////
     void ScriptContext::GarbageCollectStep(int numberOfSteps)
     {
-        lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
+        m_impl->GarbageCollectStep(numberOfSteps);
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -142,18 +142,42 @@ namespace AZ
     {
         namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
 
+        ElementLoadState state;
+        if (!BeginLoadingElements(state, outputValue, outputValueTypeId, context))
+        {
+            return *state.m_finalResult;
+        }
+
+        rapidjson::SizeType arraySize = inputValue.Size();
+        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        {
+            if (!LoadElement(state, outputValue, inputValue[i], context))
+            {
+                return *state.m_finalResult;
+            }
+        }
+        return EndLoadingElements(state, outputValue, context);
+    }
+
+    bool JsonBasicContainerSerializer::BeginLoadingElements(ElementLoadState& state, void* outputValue,
+        const Uuid& outputValueTypeId, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
         const SerializeContext::ClassData* containerClass = context.GetSerializeContext()->FindClassData(outputValueTypeId);
         if (!containerClass)
         {
-            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
+            state.m_finalResult = context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
                 "Unable to retrieve information for definition of the basic container.");
+            return false;
         }
 
         SerializeContext::IDataContainer* container = containerClass->m_container;
         if (!container)
         {
-            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
+            state.m_finalResult = context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
                 "Unable to retrieve container meta information for the basic container.");
+            return false;
         }
 
         const SerializeContext::ClassElement* classElement = nullptr;
@@ -166,14 +190,16 @@ namespace AZ
         container->EnumTypes(typeEnumCallback);
         AZ_Assert(classElement, "No class element found for the type in the basic container.");
 
-        ContinuationFlags flags = classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER
+        state.m_container = container;
+        state.m_classElement = classElement;
+        state.m_flags = classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER
             ? ContinuationFlags::ResolvePointer
             : ContinuationFlags::None;
-        flags |= ContinuationFlags::LoadAsNewInstance;
+        state.m_flags |= ContinuationFlags::LoadAsNewInstance;
 
-        const size_t capacity = container->IsFixedCapacity() ? container->Capacity(outputValue) : std::numeric_limits<size_t>::max();
+        state.m_capacity = container->IsFixedCapacity() ? container->Capacity(outputValue) : std::numeric_limits<size_t>::max();
 
-        JSR::ResultCode retVal(JSR::Tasks::ReadField);
+        state.m_result = JSR::ResultCode(JSR::Tasks::ReadField);
         size_t containerSize = container->Size(outputValue);
         if (containerSize > 0 && context.ShouldClearContainers())
         {
@@ -187,76 +213,102 @@ namespace AZ
             }
             if (result.GetResultCode().GetProcessing() != JSR::Processing::Completed)
             {
-                return result;
+                state.m_finalResult = result;
+                return false;
             }
-            retVal.Combine(result);
+            state.m_result.Combine(result);
         }
-        rapidjson::SizeType arraySize = inputValue.Size();
-        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        state.m_initialSize = containerSize;
+        return true;
+    }
+
+    bool JsonBasicContainerSerializer::LoadElement(ElementLoadState& state, void* outputValue,
+        const rapidjson::Value& element, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        AZ_Assert(!state.m_finalResult, "Loading of the basic container has already finished.");
+        SerializeContext::IDataContainer* container = state.m_container;
+        const SerializeContext::ClassElement* classElement = state.m_classElement;
+
+        ScopedContextPath subPath(context, state.m_elementCount);
+        state.m_elementCount++;
+        if (state.m_isFull)
         {
-            ScopedContextPath subPath(context, i);
+            return true;
+        }
 
-            size_t expectedSize = container->Size(outputValue) + 1;
+        size_t expectedSize = container->Size(outputValue) + 1;
+        if (expectedSize > state.m_capacity)
+        {
+            state.m_isFull = true;
+            state.m_result.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
+                "Unable to load more entries in basic container because it's full."));
+            return true;
+        }
 
-            if (expectedSize > capacity)
-            {
-                retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
-                    "Unable to load more entries in basic container because it's full."));
-                break;
-            }
+        void* elementAddress = container->ReserveElement(outputValue, classElement);
+        if (!elementAddress)
+        {
+            state.m_finalResult = context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                "Failed to allocate an item in the basic container.");
+            return false;
+        }
+        if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+        {
+            *reinterpret_cast<void**>(elementAddress) = nullptr;
+        }
 
-            void* elementAddress = container->ReserveElement(outputValue, classElement);
-            if (!elementAddress)
-            {
-                return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
-                    "Failed to allocate an item in the basic container.");
-            }
-            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
-            {
-                *reinterpret_cast<void**>(elementAddress) = nullptr;
-            }
-            
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
-            if (result.GetProcessing() == JSR::Processing::Halted)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                return context.Report(retVal, "Failed to read element for basic container.");
-            }
-            else if (result.GetProcessing() == JSR::Processing::Altered)
+        JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, element, context, state.m_flags);
+        if (result.GetProcessing() == JSR::Processing::Halted)
+        {
+            container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+            state.m_finalResult = context.Report(state.m_result, "Failed to read element for basic container.");
+            return false;
+        }
+        else if (result.GetProcessing() == JSR::Processing::Altered)
+        {
+            container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+            state.m_result.Combine(result);
+        }
+        else
+        {
+            container->StoreElement(outputValue, elementAddress);
+            if (container->Size(outputValue) != expectedSize)
             {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                retVal.Combine(result);
+                state.m_result.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                    "Unable to store element to basic container."));
             }
             else
             {
-                container->StoreElement(outputValue, elementAddress);
-                if (container->Size(outputValue) != expectedSize)
-                {
-                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
-                        "Unable to store element to basic container."));
-                }
-                else
-                {
-                    retVal.Combine(result);
-                }
-            } 
+                state.m_result.Combine(result);
+            }
         }
+        return true;
+    }
+
+    JsonSerializationResult::Result JsonBasicContainerSerializer::EndLoadingElements(ElementLoadState& state, void* outputValue,
+        JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        AZ_Assert(!state.m_finalResult, "Loading of the basic container has already finished.");
 
-        if (!retVal.HasDoneWork() && inputValue.Empty())
+        if (!state.m_result.HasDoneWork() && state.m_elementCount == 0)
         {
             return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Success, "No values provided for basic container.");
         }
 
-        size_t addedCount = container->Size(outputValue) - containerSize;
+        size_t addedCount = state.m_container->Size(outputValue) - state.m_initialSize;
         if (addedCount > 0)
         {
             // Values were added which means the container is no longer in its default state of being empty.
-            retVal.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
+            state.m_result.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
         }
         AZStd::string_view message =
-            addedCount >= arraySize ? "Successfully read basic container.":
+            addedCount >= state.m_elementCount ? "Successfully read basic container.":
             addedCount == 0 ? "Unable to read data for basic container." :
             "Partially read data for basic container.";
-        return context.Report(retVal, message);
+        return context.Report(state.m_result, message);
     }
 } // namespace AZ
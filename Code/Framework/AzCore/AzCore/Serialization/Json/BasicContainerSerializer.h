@@ -9,6 +9,8 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/optional.h>
 
 namespace AZ
 {
@@ -23,6 +25,31 @@ namespace AZ
         JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context) override;
 
+        //! State for loading the elements of a container one at a time, for instance while its json array is still being parsed.
+        struct ElementLoadState
+        {
+            SerializeContext::IDataContainer* m_container{ nullptr };
+            const SerializeContext::ClassElement* m_classElement{ nullptr };
+            ContinuationFlags m_flags{ ContinuationFlags::None };
+            size_t m_capacity{ 0 };
+            size_t m_initialSize{ 0 };
+            size_t m_elementCount{ 0 };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            //! Set when the container can't take any more elements. The remaining elements are ignored.
+            bool m_isFull{ false };
+            //! Set if loading stopped early, to the result for the whole container.
+            AZStd::optional<JsonSerializationResult::Result> m_finalResult;
+        };
+
+        //! Prepares the container for loading its elements, which includes clearing it if requested.
+        //! Returns false if the container can't be loaded, in which case the final result in the state is set.
+        bool BeginLoadingElements(ElementLoadState& state, void* outputValue, const Uuid& outputValueTypeId, JsonDeserializerContext& context);
+        //! Loads the next element of the array into the container.
+        //! Returns false if loading has to stop, in which case the final result in the state is set.
+        bool LoadElement(ElementLoadState& state, void* outputValue, const rapidjson::Value& element, JsonDeserializerContext& context);
+        //! Returns the result for the whole container after the last element has been loaded.
+        JsonSerializationResult::Result EndLoadingElements(ElementLoadState& state, void* outputValue, JsonDeserializerContext& context);
+
     private:
         JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
             JsonDeserializerContext& context);
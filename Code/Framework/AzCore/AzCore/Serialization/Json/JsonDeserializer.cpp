@@ -6,11 +6,17 @@
  */
 
 #include "AzCore/RTTI/TypeInfo.h"
+#include <AzCore/JSON/encodedstream.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/memorystream.h>
+#include <AzCore/JSON/reader.h>
 #include <AzCore/Math/UuidSerializer.h>
 #include <AzCore/RTTI/AttributeReader.h>
+#include <AzCore/Serialization/Json/BasicContainerSerializer.h>
 #include <AzCore/Serialization/Json/CastingHelpers.h>
 #include <AzCore/Serialization/Json/JsonDeserializer.h>
 #include <AzCore/Serialization/Json/JsonStringConversionUtils.h>
+#include <AzCore/Serialization/Json/MapSerializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/string/conversions.h>
@@ -229,6 +235,599 @@ namespace AZ
         return retVal;
     }
 
+    //! Loads an object directly from the events of the json reader. Reflected classes are loaded member by member while they're
+    //! being parsed, following the same rules as LoadClass. Arrays loaded by the basic container serializer and objects loaded by
+    //! the map serializer are passed to their serializer one element at a time. Any other value, including the elements of those
+    //! containers, is collected into a json value first and then loaded through Load, as the json serializers need random access
+    //! to the value they're loading.
+    class JsonDeserializer::StreamHandler final
+        : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, JsonDeserializer::StreamHandler>
+    {
+    public:
+        StreamHandler(void* object, const Uuid& typeId, JsonDeserializerContext& context)
+            : m_context(context)
+        {
+            m_target.m_object = object;
+            m_target.m_typeId = typeId;
+        }
+
+        ~StreamHandler()
+        {
+            // Remove the paths that are still open if parsing stopped because of a syntax error.
+            for (; m_pathDepth > 0; --m_pathDepth)
+            {
+                m_context.PopPath();
+            }
+        }
+
+        bool Null() { return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value()); }
+        bool Bool(bool value) { return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value(value)); }
+        bool Int(int value) { return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value(value)); }
+        bool Uint(unsigned value) { return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value(value)); }
+        bool Int64(int64_t value) { return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value(value)); }
+        bool Uint64(uint64_t value) { return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value(value)); }
+        bool Double(double value) { return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value(value)); }
+        bool String(const char* value, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+        {
+            return m_state == State::Skip ? SkipScalar() : AddScalar(rapidjson::Value(value, length, m_allocator));
+        }
+
+        bool StartObject()
+        {
+            switch (m_state)
+            {
+            case State::ReadValue:
+                if (m_containerKind == ContainerKind::None)
+                {
+                    if (const SerializeContext::ClassData* classData = FindStreamableClass(); classData)
+                    {
+                        m_classes.push_back(ClassFrame{ m_target.m_object, classData });
+                        m_state = State::ReadKey;
+                        return true;
+                    }
+                    if (JsonMapSerializer* mapSerializer = azrtti_cast<JsonMapSerializer*>(FindContainerSerializer()); mapSerializer)
+                    {
+                        // Loading starts with the first member, so an empty object is still loaded as an explicit default.
+                        m_containerKind = ContainerKind::Map;
+                        m_mapSerializer = mapSerializer;
+                        m_mapState = {};
+                        m_state = State::ReadMember;
+                        return true;
+                    }
+                }
+                m_state = State::Capture;
+                return StartCapturedContainer(rapidjson::kObjectType);
+            case State::ReadElement:
+                m_state = m_containerStopped ? State::Skip : State::ReadValue;
+                return StartObject();
+            case State::Capture:
+                return StartCapturedContainer(rapidjson::kObjectType);
+            case State::Skip:
+                ++m_skipDepth;
+                return true;
+            default:
+                AZ_Assert(false, "Unexpected start of a json object while streaming.");
+                return false;
+            }
+        }
+
+        bool Key(const char* name, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+        {
+            switch (m_state)
+            {
+            case State::ReadKey:
+                return StartMember(AZStd::string_view(name, length));
+            case State::ReadMember:
+                return StartMapMember(name, length);
+            case State::Capture:
+                m_captureKey.SetString(name, length, m_allocator);
+                return true;
+            case State::Skip:
+                return true;
+            default:
+                AZ_Assert(false, "Unexpected json object member while streaming.");
+                return false;
+            }
+        }
+
+        bool EndObject([[maybe_unused]] rapidjson::SizeType memberCount)
+        {
+            switch (m_state)
+            {
+            case State::ReadKey:
+                return EndClass();
+            case State::ReadMember:
+                return EndContainer();
+            case State::Capture:
+                return EndCapturedContainer();
+            case State::Skip:
+                return EndSkippedContainer();
+            default:
+                AZ_Assert(false, "Unexpected end of a json object while streaming.");
+                return false;
+            }
+        }
+
+        bool StartArray()
+        {
+            switch (m_state)
+            {
+            case State::ReadValue:
+                if (m_containerKind == ContainerKind::None)
+                {
+                    BaseJsonSerializer* serializer = FindContainerSerializer();
+                    // Only the basic container serializer itself, as serializers derived from it may load differently.
+                    if (serializer && serializer->RTTI_GetType() == azrtti_typeid<JsonBasicContainerSerializer>())
+                    {
+                        m_containerKind = ContainerKind::Array;
+                        m_arraySerializer = static_cast<JsonBasicContainerSerializer*>(serializer);
+                        m_arrayState = {};
+                        m_containerStopped = !m_arraySerializer->BeginLoadingElements(m_arrayState, m_target.m_object, m_target.m_typeId, m_context);
+                        m_state = State::ReadElement;
+                        return true;
+                    }
+                }
+                m_state = State::Capture;
+                return StartCapturedContainer(rapidjson::kArrayType);
+            case State::ReadElement:
+                m_state = m_containerStopped ? State::Skip : State::ReadValue;
+                return StartArray();
+            case State::Capture:
+                return StartCapturedContainer(rapidjson::kArrayType);
+            case State::Skip:
+                ++m_skipDepth;
+                return true;
+            default:
+                AZ_Assert(false, "Unexpected start of a json array while streaming.");
+                return false;
+            }
+        }
+
+        bool EndArray([[maybe_unused]] rapidjson::SizeType elementCount)
+        {
+            switch (m_state)
+            {
+            case State::ReadElement:
+                return EndContainer();
+            case State::Capture:
+                return EndCapturedContainer();
+            case State::Skip:
+                return EndSkippedContainer();
+            default:
+                AZ_Assert(false, "Unexpected end of a json array while streaming.");
+                return false;
+            }
+        }
+
+        JsonSerializationResult::ResultCode GetResult() const
+        {
+            return m_result;
+        }
+
+    private:
+        enum class State
+        {
+            ReadValue,  //!< The next value will be loaded into the target.
+            ReadKey,    //!< Expecting the next member, or the end, of the class at the top of the stack.
+            ReadElement,//!< Expecting the next element, or the end, of the array of the container that's being loaded.
+            ReadMember, //!< Expecting the next member, or the end, of the object of the map that's being loaded.
+            Capture,    //!< Collecting the value for the target.
+            Skip,       //!< Skipping the value of a member that has no matching variable.
+            Done        //!< The root value has been loaded.
+        };
+
+        enum class ContainerKind
+        {
+            None,   //!< No container is being loaded, values are loaded into the target.
+            Array,  //!< The target is a container loaded from an array by the basic container serializer.
+            Map     //!< The target is a map loaded from an object by the map serializer.
+        };
+
+        struct Target
+        {
+            void* m_object{ nullptr };
+            Uuid m_typeId;
+            //! The class element the target belongs to or null for the root object.
+            const SerializeContext::ClassElement* m_classElement{ nullptr };
+        };
+
+        struct ClassFrame
+        {
+            void* m_object{ nullptr };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            size_t m_loadCount{ 0 };
+            size_t m_memberCount{ 0 };
+        };
+
+        //! Returns the class data of the target if it's a class that LoadClass would load, otherwise null.
+        const SerializeContext::ClassData* FindStreamableClass()
+        {
+            if (!m_target.m_object ||
+                (m_target.m_classElement && (m_target.m_classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)))
+            {
+                return nullptr;
+            }
+            if (m_context.GetRegistrationContext()->GetSerializerForType(m_target.m_typeId))
+            {
+                return nullptr;
+            }
+            const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(m_target.m_typeId);
+            if (!classData || classData->m_container)
+            {
+                return nullptr;
+            }
+            // Leave types that may be handled by the serializer of their generic type or as an enum to Load.
+            if (classData->m_azRtti &&
+                (classData->m_azRtti->GetGenericTypeId() != m_target.m_typeId ||
+                 (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum))
+            {
+                return nullptr;
+            }
+            return classData;
+        }
+
+        //! Returns the json serializer that Load would use for the target if the target is a container, otherwise null.
+        BaseJsonSerializer* FindContainerSerializer()
+        {
+            if (!m_target.m_object ||
+                (m_target.m_classElement && (m_target.m_classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)))
+            {
+                return nullptr;
+            }
+            if (BaseJsonSerializer* serializer = m_context.GetRegistrationContext()->GetSerializerForType(m_target.m_typeId); serializer)
+            {
+                return serializer;
+            }
+            const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(m_target.m_typeId);
+            if (!classData || !classData->m_container || !classData->m_azRtti ||
+                classData->m_azRtti->GetGenericTypeId() == m_target.m_typeId)
+            {
+                return nullptr;
+            }
+            return m_context.GetRegistrationContext()->GetSerializerForType(classData->m_azRtti->GetGenericTypeId());
+        }
+
+        bool StartMapMember(const char* name, rapidjson::SizeType length)
+        {
+            if (m_mapState.m_container == nullptr && !m_containerStopped)
+            {
+                m_containerStopped = !m_mapSerializer->BeginLoadingElements(m_mapState, m_target.m_object, m_target.m_typeId, m_context);
+            }
+            if (m_containerStopped)
+            {
+                m_state = State::Skip;
+                return true;
+            }
+            m_containerKey.SetString(name, length, m_allocator);
+            m_state = State::ReadValue;
+            return true;
+        }
+
+        //! Returns the result for the container that was set when its serializer stopped loading it.
+        JsonSerializationResult::ResultCode GetStoppedContainerResult() const
+        {
+            return m_containerKind == ContainerKind::Array ? m_arrayState.m_finalResult->GetResultCode()
+                                                           : m_mapState.m_finalResult->GetResultCode();
+        }
+
+        bool EndContainer()
+        {
+            using namespace JsonSerializationResult;
+
+            if (m_containerKind == ContainerKind::Map && m_mapState.m_container == nullptr && !m_containerStopped)
+            {
+                // An empty object is an explicit default, which Load handles the same as for any other value.
+                ResetContainer();
+                m_capturedValue.SetObject();
+                return LoadCapturedValue();
+            }
+
+            ResultCode result = m_containerStopped ? GetStoppedContainerResult()
+                : m_containerKind == ContainerKind::Array ? m_arraySerializer->EndLoadingElements(m_arrayState, m_target.m_object, m_context)
+                : m_mapSerializer->EndLoadingElements(m_mapState, m_target.m_object, m_context);
+            ResetContainer();
+            return CompleteTarget(result);
+        }
+
+        void ResetContainer()
+        {
+            m_containerKind = ContainerKind::None;
+            m_arraySerializer = nullptr;
+            m_mapSerializer = nullptr;
+            m_arrayState = {};
+            m_mapState = {};
+            m_containerStopped = false;
+        }
+
+        bool LoadCapturedElement()
+        {
+            using namespace JsonSerializationResult;
+
+            bool keepLoading = m_containerKind == ContainerKind::Array
+                ? m_arraySerializer->LoadElement(m_arrayState, m_target.m_object, m_capturedValue, m_context)
+                : m_mapSerializer->LoadMember(m_mapState, m_target.m_object, m_containerKey, m_capturedValue, m_context);
+
+            // The memory for the collected value is reused for the next one.
+            m_capturedValue.SetNull();
+            m_containerKey.SetNull();
+            m_allocator.Clear();
+
+            if (!keepLoading)
+            {
+                // The rest of the elements are skipped, unless loading has halted in which case parsing stops as well.
+                m_containerStopped = true;
+                ResultCode result = GetStoppedContainerResult();
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    ResetContainer();
+                    return CompleteTarget(result);
+                }
+            }
+            m_state = m_containerKind == ContainerKind::Array ? State::ReadElement : State::ReadMember;
+            return true;
+        }
+
+        bool StartMember(AZStd::string_view name)
+        {
+            using namespace JsonSerializationResult;
+
+            ClassFrame& frame = m_classes.back();
+            ++frame.m_memberCount;
+            PushPath(name);
+
+            if (name == JsonSerialization::TypeIdFieldIdentifier)
+            {
+                m_state = State::Skip;
+                return true;
+            }
+
+            ElementDataResult foundElementData =
+                FindElementByNameCrc(*m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, Crc32(name));
+            if (foundElementData.m_found)
+            {
+                m_target.m_object = foundElementData.m_data;
+                m_target.m_typeId = foundElementData.m_info->m_typeId;
+                m_target.m_classElement = foundElementData.m_info;
+                m_state = State::ReadValue;
+            }
+            else
+            {
+                frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                    "Skipping field as there's no matching variable in the target."));
+                m_state = State::Skip;
+            }
+            return true;
+        }
+
+        bool EndClass()
+        {
+            using namespace JsonSerializationResult;
+
+            ClassFrame& frame = m_classes.back();
+            ResultCode result = frame.m_result;
+            if (frame.m_memberCount == 0)
+            {
+                result = m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
+            }
+            else
+            {
+                size_t elementCount = CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+                if (elementCount > frame.m_loadCount)
+                {
+                    result.Combine(ResultCode(Tasks::ReadField, frame.m_loadCount == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+                }
+            }
+            m_classes.pop_back();
+            return CompleteTarget(result);
+        }
+
+        //! Adds the result of loading the target to the class it's a member of. If loading has halted this is reported for
+        //! every class up to the root, the same as LoadClass does.
+        bool CompleteTarget(JsonSerializationResult::ResultCode result)
+        {
+            using namespace JsonSerializationResult;
+
+            while (!m_classes.empty())
+            {
+                ClassFrame& frame = m_classes.back();
+                frame.m_result.Combine(result);
+                if (result.GetProcessing() != Processing::Halted)
+                {
+                    if (result.GetProcessing() != Processing::Altered)
+                    {
+                        frame.m_loadCount++;
+                    }
+                    PopPath();
+                    m_state = State::ReadKey;
+                    return true;
+                }
+
+                result = m_context.Report(result, "Loading of element has failed.");
+                PopPath();
+                m_classes.pop_back();
+            }
+
+            m_result = result;
+            m_state = State::Done;
+            return result.GetProcessing() != Processing::Halted;
+        }
+
+        bool AddScalar(rapidjson::Value&& value)
+        {
+            switch (m_state)
+            {
+            case State::ReadElement:
+                if (m_containerStopped)
+                {
+                    return true;
+                }
+                [[fallthrough]];
+            case State::ReadValue:
+                AddCapturedValue(value);
+                return LoadCapturedValue();
+            case State::Capture:
+                AddCapturedValue(value);
+                return true;
+            default:
+                AZ_Assert(false, "Unexpected json value while streaming.");
+                return false;
+            }
+        }
+
+        bool SkipScalar()
+        {
+            if (m_skipDepth == 0)
+            {
+                switch (m_containerKind)
+                {
+                case ContainerKind::Array:
+                    m_state = State::ReadElement;
+                    break;
+                case ContainerKind::Map:
+                    m_state = State::ReadMember;
+                    break;
+                default:
+                    PopPath();
+                    m_state = State::ReadKey;
+                    break;
+                }
+            }
+            return true;
+        }
+
+        bool EndSkippedContainer()
+        {
+            --m_skipDepth;
+            return SkipScalar();
+        }
+
+        //! Moves the value into the container that's being collected, or makes it the collected value if there's no container.
+        rapidjson::Value* AddCapturedValue(rapidjson::Value& value)
+        {
+            if (m_captureStack.empty())
+            {
+                m_capturedValue = value;
+                return &m_capturedValue;
+            }
+
+            rapidjson::Value& container = *m_captureStack.back();
+            if (container.IsArray())
+            {
+                container.PushBack(value, m_allocator);
+                return &container[container.Size() - 1];
+            }
+            container.AddMember(m_captureKey, value, m_allocator);
+            return &(container.MemberEnd() - 1)->value;
+        }
+
+        bool StartCapturedContainer(rapidjson::Type type)
+        {
+            rapidjson::Value container(type);
+            m_captureStack.push_back(AddCapturedValue(container));
+            return true;
+        }
+
+        bool EndCapturedContainer()
+        {
+            m_captureStack.pop_back();
+            return m_captureStack.empty() ? LoadCapturedValue() : true;
+        }
+
+        bool LoadCapturedValue()
+        {
+            if (m_containerKind != ContainerKind::None)
+            {
+                return LoadCapturedElement();
+            }
+
+            JsonSerializationResult::ResultCode result = m_target.m_classElement
+                ? LoadWithClassElement(m_target.m_object, m_capturedValue, *m_target.m_classElement, m_context)
+                : Load(m_target.m_object, m_target.m_typeId, m_capturedValue, false, m_context);
+
+            // The memory for the collected value is reused for the next one.
+            m_capturedValue.SetNull();
+            m_allocator.Clear();
+
+            return CompleteTarget(result);
+        }
+
+        void PushPath(AZStd::string_view name)
+        {
+            m_context.PushPath(name);
+            ++m_pathDepth;
+        }
+
+        void PopPath()
+        {
+            m_context.PopPath();
+            --m_pathDepth;
+        }
+
+        JsonDeserializerContext& m_context;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField,
+            JsonSerializationResult::Outcomes::Catastrophic };
+        AZStd::vector<ClassFrame> m_classes;
+        Target m_target;
+        State m_state{ State::ReadValue };
+        size_t m_skipDepth{ 0 };
+        size_t m_pathDepth{ 0 };
+
+        //! The container the target points to while its elements are loaded by its serializer.
+        ContainerKind m_containerKind{ ContainerKind::None };
+        JsonBasicContainerSerializer* m_arraySerializer{ nullptr };
+        JsonBasicContainerSerializer::ElementLoadState m_arrayState;
+        JsonMapSerializer* m_mapSerializer{ nullptr };
+        JsonMapSerializer::ElementLoadState m_mapState;
+        //! Set when the serializer stopped loading the container early, the remaining elements are skipped.
+        bool m_containerStopped{ false };
+
+        rapidjson::Document::AllocatorType m_allocator;
+        rapidjson::Value m_capturedValue;
+        rapidjson::Value m_captureKey;
+        //! The name of the map member whose value is being collected.
+        rapidjson::Value m_containerKey;
+        //! The containers in the collected value that are still being filled in.
+        AZStd::vector<rapidjson::Value*> m_captureStack;
+    };
+
+    JsonSerializationResult::ResultCode JsonDeserializer::LoadFromString(
+        void* object, const Uuid& typeId, AZStd::string_view jsonText, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
+
+        rapidjson::ParseResult parseResult;
+        ResultCode result(Tasks::ReadField);
+        {
+            // The handler is scoped so any path it didn't close because of a syntax error is removed before reporting.
+            StreamHandler handler(object, typeId, context);
+            rapidjson::MemoryStream memoryStream(jsonText.data(), jsonText.size());
+            rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> inputStream(memoryStream);
+            rapidjson::Reader reader;
+            parseResult = reader.Parse<rapidjson::kParseCommentsFlag>(inputStream, handler);
+            result = handler.GetResult();
+        }
+
+        // A termination means the handler stopped parsing because loading halted, which has already been reported.
+        if (parseResult.IsError() && parseResult.Code() != rapidjson::kParseErrorTermination)
+        {
+            // Report the line rather than the offset, the same as JsonSerializationUtils does for documents, so the error can be found.
+            size_t lineNumber = 1;
+            const size_t errorOffset = parseResult.Offset();
+            for (size_t searchOffset = jsonText.find('\n');
+                searchOffset < errorOffset && searchOffset != AZStd::string_view::npos;
+                searchOffset = jsonText.find('\n', searchOffset + 1))
+            {
+                lineNumber++;
+            }
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("JSON parse error at line %zu: %s", lineNumber, rapidjson::GetParseError_En(parseResult.Code())));
+        }
+        return result;
+    }
+
     JsonSerializationResult::ResultCode JsonDeserializer::LoadEnum(void* object, const SerializeContext::ClassData& classData,
         const rapidjson::Value& value, JsonDeserializerContext& context)
     {
@@ -46,6 +46,8 @@ namespace AZ
             bool m_found{ false };
         };
 
+        class StreamHandler;
+
         JsonDeserializer() = delete;
         ~JsonDeserializer() = delete;
         JsonDeserializer& operator=(const JsonDeserializer& rhs) = delete;
@@ -56,6 +58,10 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& typeId, const rapidjson::Value& value, bool isNewInstance, JsonDeserializerContext& context);
 
+        //! Loads directly from the events of the json parser instead of a json value. See JsonSerialization::LoadFromString.
+        static JsonSerializationResult::ResultCode LoadFromString(
+            void* object, const Uuid& typeId, AZStd::string_view jsonText, JsonDeserializerContext& context);
+
         static JsonSerializationResult::ResultCode LoadToPointer(void* object, const Uuid& typeId, const rapidjson::Value& value,
             JsonDeserializerContext& context);
 
@@ -152,6 +152,47 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from the provided json text into the supplied object. The object is expected to be created before calling load.
+        //! Unlike Load the text isn't parsed into a json document first. Reflected classes are filled in member by member while the
+        //! text is parsed. Arrays of basic containers and objects of maps are passed to their serializer one element at a time, so
+        //! only the element that's being loaded and values handled by other json serializers are temporarily stored as a json value.
+        //! This reduces the peak memory and time needed to load large files.
+        //! Note: if the text contains a syntax error the object may have been partially loaded.
+        //! @param object Object where the data will be loaded into.
+        //! @param jsonText The json text the deserializer will read from.
+        //! @param settings Optional additional settings to control the way the text is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromString(
+            T& object, AZStd::string_view jsonText, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object. The object is expected to be created before calling load.
+        //! Unlike Load the text isn't parsed into a json document first. Reflected classes are filled in member by member while the
+        //! text is parsed. Arrays of basic containers and objects of maps are passed to their serializer one element at a time, so
+        //! only the element that's being loaded and values handled by other json serializers are temporarily stored as a json value.
+        //! This reduces the peak memory and time needed to load large files.
+        //! Note: if the text contains a syntax error the object may have been partially loaded.
+        //! @param object Object where the data will be loaded into.
+        //! @param jsonText The json text the deserializer will read from.
+        //! @param settings Additional settings to control the way the text is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromString(T& object, AZStd::string_view jsonText, JsonDeserializerSettings& settings);
+        //! Loads the data from the provided json text into the supplied object. The object is expected to be created before calling load.
+        //! See the templated version of LoadFromString for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param jsonText The json text the deserializer will read from.
+        //! @param settings Optional additional settings to control the way the text is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromString(
+            void* object, const Uuid& objectType, AZStd::string_view jsonText,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object. The object is expected to be created before calling load.
+        //! See the templated version of LoadFromString for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param jsonText The json text the deserializer will read from.
+        //! @param settings Additional settings to control the way the text is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromString(
+            void* object, const Uuid& objectType, AZStd::string_view jsonText, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -311,6 +352,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        T& object, AZStd::string_view jsonText, const JsonDeserializerSettings& settings)
+    {
+        return LoadFromString(&object, azrtti_typeid(object), jsonText, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        T& object, AZStd::string_view jsonText, JsonDeserializerSettings& settings)
+    {
+        return LoadFromString(&object, azrtti_typeid(object), jsonText, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
@@ -60,11 +60,78 @@ namespace AZ
     {
         namespace JSR = JsonSerializationResult;
 
+        ElementLoadState state;
+        if (!BeginLoadingElements(state, outputValue, outputValueTypeId, context))
+        {
+            return *state.m_finalResult;
+        }
+
+        if (inputValue.IsObject())
+        {
+            // Don't early out here because an empty object is also considered a default object.
+            for (auto& entry : inputValue.GetObject())
+            {
+                if (!LoadMember(state, outputValue, entry.name, entry.value, context))
+                {
+                    return *state.m_finalResult;
+                }
+            }
+        }
+        else
+        {
+            AZ_Assert(inputValue.IsArray(), "Maps can only be loaded from an object or an array.");
+            rapidjson::SizeType maximumSize = inputValue.Size();
+            if (maximumSize == 0)
+            {
+                return context.Report(state.m_result.HasDoneWork() ? state.m_result : JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success),
+                    "No values provided for map.");
+            }
+            const rapidjson::Value defaultValue(rapidjson::kObjectType);
+            for (rapidjson::SizeType i = 0; i < maximumSize; ++i)
+            {
+                ScopedContextPath subPath(context, i);
+                state.m_elementCount++;
+
+                if (!inputValue[i].IsObject())
+                {
+                    state.m_result.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unsupported, AZStd::string::format(
+                            R"(Unsupported type for elements in an associative container. If the array for is used, an object with "%s" and "%s" is expected)",
+                            JsonSerialization::KeyFieldIdentifier, JsonSerialization::ValueFieldIdentifier)));
+                    continue;
+                }
+
+                const rapidjson::Value::ConstMemberIterator keyMember = inputValue[i].FindMember(JsonSerialization::KeyFieldIdentifier);
+                const rapidjson::Value::ConstMemberIterator valueMember = inputValue[i].FindMember(JsonSerialization::ValueFieldIdentifier);
+                const rapidjson::Value& key = (keyMember != inputValue[i].MemberEnd()) ? keyMember->value : defaultValue;
+                const rapidjson::Value& value = (valueMember != inputValue[i].MemberEnd()) ? valueMember->value : defaultValue;
+
+                JSR::Result elementResult = LoadElement(outputValue, state.m_container, state.m_pairElement, state.m_pairContainer,
+                    state.m_keyElement, state.m_valueElement, key, value, context);
+                if (elementResult.GetResultCode().GetProcessing() != JSR::Processing::Halted)
+                {
+                    state.m_result.Combine(elementResult.GetResultCode());
+                }
+                else
+                {
+                    return elementResult;
+                }
+            }
+        }
+
+        return EndLoadingElements(state, outputValue, context);
+    }
+
+    bool JsonMapSerializer::BeginLoadingElements(ElementLoadState& state, void* outputValue, const Uuid& outputValueTypeId,
+        JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult;
+
         const SerializeContext::ClassData* containerClass = context.GetSerializeContext()->FindClassData(outputValueTypeId);
         if (!containerClass)
         {
-            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
+            state.m_finalResult = context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
                 "Unable to retrieve information for definition of the associative container instance.");
+            return false;
         }
 
         SerializeContext::IDataContainer* container = containerClass->m_container;
@@ -102,10 +169,14 @@ namespace AZ
         pairContainer->EnumTypes(keyValueTypeEnumCallback);
         AZ_Assert(keyElement && valueElement, "Expected the pair element in a container to have exactly 2 elements.");
 
+        state.m_container = container;
+        state.m_pairElement = pairElement;
+        state.m_pairContainer = pairContainer;
+        state.m_keyElement = keyElement;
+        state.m_valueElement = valueElement;
+
         size_t containerSize = container->Size(outputValue);
-        rapidjson::SizeType maximumSize = 0;
-        const rapidjson::Value defaultValue(rapidjson::kObjectType);
-        JSR::ResultCode retVal(JSR::Tasks::ReadField);
+        state.m_result = JSR::ResultCode(JSR::Tasks::ReadField);
         if (containerSize > 0 && context.ShouldClearContainers())
         {
             JSR::Result result = context.Report(JSR::Tasks::Clear, JSR::Outcomes::Success, "Clearing associative container.");
@@ -118,84 +189,59 @@ namespace AZ
             }
             if (result.GetResultCode().GetProcessing() != JSR::Processing::Completed)
             {
-                return result;
+                state.m_finalResult = result;
+                return false;
             }
-            retVal.Combine(result);
+            state.m_result.Combine(result);
         }
-        if (inputValue.IsObject())
-        {
-            maximumSize = inputValue.MemberCount();
-            // Don't early out here because an empty object is also considered a default object.
-            for (auto& entry : inputValue.GetObject())
-            {
-                AZStd::string_view keyName(entry.name.GetString(), entry.name.GetStringLength());
-                ScopedContextPath subPath(context, keyName);
+        state.m_initialSize = containerSize;
+        return true;
+    }
 
-                const rapidjson::Value& key = (keyName == JsonSerialization::DefaultStringIdentifier) ? defaultValue : entry.name;
+    bool JsonMapSerializer::LoadMember(ElementLoadState& state, void* outputValue, const rapidjson::Value& name,
+        const rapidjson::Value& value, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult;
 
-                JSR::Result elementResult = LoadElement(outputValue, container, pairElement, pairContainer, 
-                    keyElement, valueElement, key, entry.value, context);
-                if (elementResult.GetResultCode().GetProcessing() != JSR::Processing::Halted)
-                {
-                    retVal.Combine(elementResult.GetResultCode());
-                }
-                else
-                {
-                    return elementResult;
-                }
-            }
-        }
-        else
-        {
-            AZ_Assert(inputValue.IsArray(), "Maps can only be loaded from an object or an array.");
-            maximumSize = inputValue.Size();
-            if (maximumSize == 0)
-            {
-                return context.Report(retVal.HasDoneWork() ? retVal : JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success),
-                    "No values provided for map.");
-            }
-            for (rapidjson::SizeType i = 0; i < maximumSize; ++i)
-            {
-                ScopedContextPath subPath(context, i);
+        AZ_Assert(!state.m_finalResult, "Loading of the associative container has already finished.");
 
-                if (!inputValue[i].IsObject())
-                {
-                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unsupported, AZStd::string::format(
-                            R"(Unsupported type for elements in an associative container. If the array for is used, an object with "%s" and "%s" is expected)",
-                            JsonSerialization::KeyFieldIdentifier, JsonSerialization::ValueFieldIdentifier)));
-                    continue;
-                }
+        AZStd::string_view keyName(name.GetString(), name.GetStringLength());
+        ScopedContextPath subPath(context, keyName);
+        state.m_elementCount++;
 
-                const rapidjson::Value::ConstMemberIterator keyMember = inputValue[i].FindMember(JsonSerialization::KeyFieldIdentifier);
-                const rapidjson::Value::ConstMemberIterator valueMember = inputValue[i].FindMember(JsonSerialization::ValueFieldIdentifier);
-                const rapidjson::Value& key = (keyMember != inputValue[i].MemberEnd()) ? keyMember->value : defaultValue;
-                const rapidjson::Value& value = (valueMember != inputValue[i].MemberEnd()) ? valueMember->value : defaultValue;
+        const rapidjson::Value defaultValue(rapidjson::kObjectType);
+        const rapidjson::Value& key = (keyName == JsonSerialization::DefaultStringIdentifier) ? defaultValue : name;
 
-                JSR::Result elementResult = LoadElement(outputValue, container, pairElement, pairContainer,
-                    keyElement, valueElement, key, value, context);
-                if (elementResult.GetResultCode().GetProcessing() != JSR::Processing::Halted)
-                {
-                    retVal.Combine(elementResult.GetResultCode());
-                }
-                else
-                {
-                    return elementResult;
-                }
-            }
+        JSR::Result elementResult = LoadElement(outputValue, state.m_container, state.m_pairElement, state.m_pairContainer,
+            state.m_keyElement, state.m_valueElement, key, value, context);
+        if (elementResult.GetResultCode().GetProcessing() == JSR::Processing::Halted)
+        {
+            state.m_finalResult = elementResult;
+            return false;
         }
+        state.m_result.Combine(elementResult.GetResultCode());
+        return true;
+    }
+
+    JsonSerializationResult::Result JsonMapSerializer::EndLoadingElements(ElementLoadState& state, void* outputValue,
+        JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult;
+
+        AZ_Assert(!state.m_finalResult, "Loading of the associative container has already finished.");
 
-        size_t addedCount = container->Size(outputValue) - containerSize;
+        size_t addedCount = state.m_container->Size(outputValue) - state.m_initialSize;
         if (addedCount > 0)
         {
             // If at least one entry was added then the map is no longer in it's default state so
             // mark is with success so the result can at best be partial defaults.
-            retVal.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
+            state.m_result.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
         }
         AZStd::string_view message =
-            addedCount >= maximumSize ? "Successfully read associative container." :
+            addedCount >= state.m_elementCount ? "Successfully read associative container." :
             addedCount == 0 ? "Unable to read data for the associative container." : 
             "Partially read data for the associative container.";
-        return context.Report(retVal, message);
+        return context.Report(state.m_result, message);
     }
 
     JsonSerializationResult::Result JsonMapSerializer::LoadElement(void* outputValue, SerializeContext::IDataContainer* container,
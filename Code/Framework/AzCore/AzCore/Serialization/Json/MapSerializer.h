@@ -10,6 +10,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/optional.h>
 
 namespace AZ
 {
@@ -25,6 +26,32 @@ namespace AZ
         JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context) override;
 
+        //! State for loading the entries of a map one at a time from the members of a json object, for instance while the object is
+        //! still being parsed.
+        struct ElementLoadState
+        {
+            SerializeContext::IDataContainer* m_container{ nullptr };
+            const SerializeContext::ClassElement* m_pairElement{ nullptr };
+            SerializeContext::IDataContainer* m_pairContainer{ nullptr };
+            const SerializeContext::ClassElement* m_keyElement{ nullptr };
+            const SerializeContext::ClassElement* m_valueElement{ nullptr };
+            size_t m_initialSize{ 0 };
+            size_t m_elementCount{ 0 };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            //! Set if loading stopped early, to the result for the whole map.
+            AZStd::optional<JsonSerializationResult::Result> m_finalResult;
+        };
+
+        //! Prepares the map for loading its entries, which includes clearing it if requested.
+        //! Returns false if the map can't be loaded, in which case the final result in the state is set.
+        bool BeginLoadingElements(ElementLoadState& state, void* outputValue, const Uuid& outputValueTypeId, JsonDeserializerContext& context);
+        //! Loads a member of the json object as an entry of the map, with the name of the member as the key.
+        //! Returns false if loading has to stop, in which case the final result in the state is set.
+        bool LoadMember(ElementLoadState& state, void* outputValue, const rapidjson::Value& name, const rapidjson::Value& value,
+            JsonDeserializerContext& context);
+        //! Returns the result for the whole map after the last entry has been loaded.
+        JsonSerializationResult::Result EndLoadingElements(ElementLoadState& state, void* outputValue, JsonDeserializerContext& context);
+
     protected:
         virtual JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId,
             const rapidjson::Value& inputValue, JsonDeserializerContext& context);
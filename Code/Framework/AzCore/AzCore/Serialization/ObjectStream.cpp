@@ -17,6 +17,7 @@
 #include <AzCore/std/functional.h>
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/XML/rapidxml.h>
 #include <AzCore/XML/rapidxml_print.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -54,7 +55,16 @@ namespace AZ
 {
     namespace ObjectStreamInternal
     {
+        // Version of the XML and JSON streams.
         static const u32 s_objectStreamVersion = 3;
+        // First version of the binary format that writes the type id and name crc of an element only the first time they're
+        // used. Later elements refer to them by their index in the type and name tables of the stream.
+        static const u32 s_binaryTablesVersion = 4;
+        // First version of the binary format that writes containers of plain data elements, like AZStd::vector<float>, as a single
+        // value that holds all elements back to back instead of writing an element header for every element.
+        static const u32 s_binaryPackedContainerVersion = 5;
+        // Version of the binary streams, which is versioned separately since the text formats didn't change with the tables.
+        static const u32 s_binaryObjectStreamVersion = s_binaryPackedContainerVersion;
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
@@ -121,6 +131,38 @@ namespace AZ
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
 
+            /// Entry of the type table of a binary stream that's being loaded.
+            struct BinaryTypeEntry
+            {
+                Uuid m_id;
+                /// Class data and specialized type id looked up without a parent class, resolved the first time an element of the type is read.
+                const SerializeContext::ClassData* m_classData = nullptr;
+                Uuid m_specializedId;
+                bool m_isResolved = false;
+            };
+
+            /// Reads and writes the variable length indices of the binary type and name tables.
+            u32 ReadBinaryIndex();
+            void WriteBinaryIndex(u32 index);
+            /// Reads the name crc of an element, adding it to the name table if it's stored in full.
+            u32 ReadBinaryNameCrc();
+            /// Reads the type of an element, adding it to the type table if it's stored in full.
+            BinaryTypeEntry& ReadBinaryTypeEntry();
+            /// Writes the index of the name crc or type id, followed by the value itself if it's not in the table yet.
+            void WriteBinaryNameCrc(u32 nameCrc);
+            void WriteBinaryTypeId(const Uuid& typeId);
+
+            /// Returns true if the value of the binary element is a packed container, see s_binaryPackedContainerVersion.
+            bool IsPackedContainer(const SerializeContext::ClassData* classData, const SerializeContext::DataElement& element) const;
+            /// Saves all elements of a container to m_inStream as a single value if they're plain data of the same size.
+            /// Returns false, without writing anything, if the container has to be written element by element.
+            bool SavePackedContainer(const void* containerPtr, const SerializeContext::ClassData* classData, size_t& dataSize);
+            /// Loads the elements of a packed container value through the container interface.
+            bool LoadPackedContainer(IO::GenericStream& valueStream, const SerializeContext::ClassData* classData, void* containerPtr);
+            /// Adds the elements of a packed container value as sub elements of the node, so version converters see the container
+            /// the same way as one that was written element by element.
+            void UnpackContainerNode(SerializeContext::DataElementNode& containerNode);
+
             bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override;
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
             bool CloseElement();
@@ -214,6 +256,12 @@ namespace AZ
             AZStd::list<rapidjson::Value>       m_jsonWriteValues;
 
 
+            // used for binary streams with type and name tables
+            AZStd::vector<BinaryTypeEntry>      m_binaryTypeTable;
+            AZStd::vector<u32>                  m_binaryNameTable;
+            AZStd::unordered_map<Uuid, u32>     m_binaryTypeIndices;
+            AZStd::unordered_map<u32, u32>      m_binaryNameIndices;
+
             AZStd::vector<char> m_buffer1;
             AZStd::vector<char> m_buffer2;
             IO::ByteContainerStream<AZStd::vector<char> > m_inStream;
@@ -293,6 +341,11 @@ namespace AZ
                     //AZ_Warning("Serializer",false,"Element '%s' with class ID '%s' found while converting '%s' is not registered with the serializer! You will have to parse this data yourself!",childElement.m_name,childElement.m_id.ToString<AZStd::string>().c_str(), parent->m_name);
                 }
 
+                if (IsPackedContainer(childClass, childNode.m_element))
+                {
+                    UnpackContainerNode(childNode);
+                }
+
                 if (childNode.m_element.m_dataSize > 0) // if we have values to convert
                 {
                     // Now preparse this element's children
@@ -818,6 +871,18 @@ namespace AZ
                 if (classData->m_container && dataAddress)
                 {
                     classData->m_container->ClearElements(dataAddress, m_sc);
+
+                    if (IsPackedContainer(classData, element))
+                    {
+                        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ObjectStreamImpl::LoadClass LoadPackedContainer");
+
+                        IO::MemoryStream memStream(m_inStream.GetData()->data(), element.m_dataSize);
+                        IO::GenericStream* currentStream = element.m_byteStream.GetLength() > 0 ? static_cast<IO::GenericStream*>(&element.m_byteStream) : &memStream;
+                        if (!LoadPackedContainer(*currentStream, classData, dataAddress))
+                        {
+                            result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                        }
+                    }
                 }
 
                 // Read child nodes
@@ -1292,11 +1357,18 @@ namespace AZ
                 // Read name
                 if (flagsSize & ST_BINARYFLAG_HAS_NAME)
                 {
-                    u32 nameCrc;
-                    nBytesRead = m_stream->Read(sizeof(nameCrc), &nameCrc);
-                    AZ_Assert(nBytesRead == sizeof(nameCrc), "Failed trying to read binary element nameCrc!");
-                    AZStd::endian_swap(nameCrc);
-                    element.m_nameCrc = nameCrc;
+                    if (m_version >= s_binaryTablesVersion)
+                    {
+                        element.m_nameCrc = ReadBinaryNameCrc();
+                    }
+                    else
+                    {
+                        u32 nameCrc;
+                        nBytesRead = m_stream->Read(sizeof(nameCrc), &nameCrc);
+                        AZ_Assert(nBytesRead == sizeof(nameCrc), "Failed trying to read binary element nameCrc!");
+                        AZStd::endian_swap(nameCrc);
+                        element.m_nameCrc = nameCrc;
+                    }
                 }
 
                 // Read version
@@ -1309,8 +1381,17 @@ namespace AZ
                 }
 
                 // Read uuid
-                nBytesRead = m_stream->Read(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
-                AZ_Assert(nBytesRead == static_cast<IO::SizeType>(element.m_id.end() - element.m_id.begin()), "Failed trying to read binary element uuid!");
+                BinaryTypeEntry* typeEntry = nullptr;
+                if (m_version >= s_binaryTablesVersion)
+                {
+                    typeEntry = &ReadBinaryTypeEntry();
+                    element.m_id = typeEntry->m_id;
+                }
+                else
+                {
+                    nBytesRead = m_stream->Read(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
+                    AZ_Assert(nBytesRead == static_cast<IO::SizeType>(element.m_id.end() - element.m_id.begin()), "Failed trying to read binary element uuid!");
+                }
 
                 // Version 3 of the ObjectStream serializes the specialized type id directly in the data element id field. The data element old id field value is no longer needed
                 if (m_version == 2)
@@ -1339,15 +1420,37 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
+                // The class data of types that are registered directly only has to be looked up once per stream.
+                if (typeEntry && !typeEntry->m_isResolved)
+                {
+                    typeEntry->m_classData = sc.FindClassData(typeEntry->m_id);
+                    typeEntry->m_specializedId = typeEntry->m_id;
+                    if (typeEntry->m_classData)
+                    {
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(typeEntry->m_classData->m_typeId))
+                        {
+                            typeEntry->m_specializedId = genericClassInfo->GetSpecializedTypeId();
+                        }
+                    }
+                    typeEntry->m_isResolved = true;
+                }
 
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
+                if (typeEntry && typeEntry->m_classData)
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    cd = typeEntry->m_classData;
+                    element.m_id = typeEntry->m_specializedId;
+                }
+                else
+                {
+                    // find the registered class data
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd)
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
                     }
                 }
 
@@ -1436,22 +1539,40 @@ namespace AZ
                     else
                     {
                         ++endTagsNeeded;
-                        size_t bytesToSkip = sizeof(Uuid);  // this field is guaranteed to be there
-                        if (flagsSize & ST_BINARYFLAG_HAS_NAME)
+                        if (m_version >= s_binaryTablesVersion)
                         {
-                            bytesToSkip += sizeof(u32);
+                            // Names and types that are stored in full still need to be added to the tables for the elements that follow.
+                            if (flagsSize & ST_BINARYFLAG_HAS_NAME)
+                            {
+                                ReadBinaryNameCrc();
+                            }
+                            if (flagsSize & ST_BINARYFLAG_HAS_VERSION)
+                            {
+                                m_stream->Seek(sizeof(u8), IO::GenericStream::ST_SEEK_CUR);
+                            }
+                            ReadBinaryTypeEntry();
                         }
-                        if (flagsSize & ST_BINARYFLAG_HAS_VERSION)
+                        else
                         {
-                            bytesToSkip += sizeof(u8);
-                        }
+                            size_t bytesToSkip = sizeof(Uuid);  // this field is guaranteed to be there
+                            if (flagsSize & ST_BINARYFLAG_HAS_NAME)
+                            {
+                                bytesToSkip += sizeof(u32);
+                            }
+                            if (flagsSize & ST_BINARYFLAG_HAS_VERSION)
+                            {
+                                bytesToSkip += sizeof(u8);
+                            }
 
-                        if (m_version == 2) // need to account for the specialized uuid
-                        {
-                            bytesToSkip += sizeof(Uuid);
+                            if (m_version == 2) // need to account for the specialized uuid
+                            {
+                                bytesToSkip += sizeof(Uuid);
+                            }
+
+                            m_stream->Seek(bytesToSkip, IO::GenericStream::ST_SEEK_CUR);
                         }
 
-                        m_stream->Seek(bytesToSkip, IO::GenericStream::ST_SEEK_CUR);
+                        size_t bytesToSkip = 0;
 
                         if (flagsSize & ST_BINARYFLAG_HAS_VALUE)
                         {
@@ -1497,6 +1618,308 @@ namespace AZ
             }
         }
 
+        //=========================================================================
+        // ReadBinaryIndex
+        //=========================================================================
+        u32 ObjectStreamImpl::ReadBinaryIndex()
+        {
+            // Indices are stored 7 bits at a time, lowest bits first, with the high bit set on all but the last byte.
+            u32 index = 0;
+            for (u32 shift = 0; shift < 32; shift += 7)
+            {
+                u8 byte = 0;
+                [[maybe_unused]] IO::SizeType nBytesRead = m_stream->Read(sizeof(byte), &byte);
+                AZ_Assert(nBytesRead == sizeof(byte), "Failed trying to read binary table index!");
+                index |= static_cast<u32>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    break;
+                }
+            }
+            return index;
+        }
+
+        //=========================================================================
+        // WriteBinaryIndex
+        //=========================================================================
+        void ObjectStreamImpl::WriteBinaryIndex(u32 index)
+        {
+            u8 bytes[5];
+            size_t numBytes = 0;
+            do
+            {
+                u8 byte = static_cast<u8>(index & 0x7f);
+                index >>= 7;
+                if (index != 0)
+                {
+                    byte |= 0x80;
+                }
+                bytes[numBytes++] = byte;
+            } while (index != 0);
+            m_stream->Write(numBytes, bytes);
+        }
+
+        //=========================================================================
+        // ReadBinaryNameCrc
+        //=========================================================================
+        u32 ObjectStreamImpl::ReadBinaryNameCrc()
+        {
+            const u32 index = ReadBinaryIndex();
+            if (index < m_binaryNameTable.size())
+            {
+                return m_binaryNameTable[index];
+            }
+
+            AZ_Assert(index == m_binaryNameTable.size(), "Invalid binary name table index %u, the table has %zu entries!", index, m_binaryNameTable.size());
+            u32 nameCrc = 0;
+            [[maybe_unused]] IO::SizeType nBytesRead = m_stream->Read(sizeof(nameCrc), &nameCrc);
+            AZ_Assert(nBytesRead == sizeof(nameCrc), "Failed trying to read binary element nameCrc!");
+            AZStd::endian_swap(nameCrc);
+            m_binaryNameTable.push_back(nameCrc);
+            return nameCrc;
+        }
+
+        //=========================================================================
+        // ReadBinaryTypeEntry
+        //=========================================================================
+        ObjectStreamImpl::BinaryTypeEntry& ObjectStreamImpl::ReadBinaryTypeEntry()
+        {
+            const u32 index = ReadBinaryIndex();
+            if (index < m_binaryTypeTable.size())
+            {
+                return m_binaryTypeTable[index];
+            }
+
+            AZ_Assert(index == m_binaryTypeTable.size(), "Invalid binary type table index %u, the table has %zu entries!", index, m_binaryTypeTable.size());
+            BinaryTypeEntry& entry = m_binaryTypeTable.emplace_back();
+            [[maybe_unused]] IO::SizeType nBytesRead = m_stream->Read(entry.m_id.end() - entry.m_id.begin(), entry.m_id.begin());
+            AZ_Assert(nBytesRead == static_cast<IO::SizeType>(entry.m_id.end() - entry.m_id.begin()), "Failed trying to read binary element uuid!");
+            return entry;
+        }
+
+        //=========================================================================
+        // WriteBinaryNameCrc
+        //=========================================================================
+        void ObjectStreamImpl::WriteBinaryNameCrc(u32 nameCrc)
+        {
+            auto insertResult = m_binaryNameIndices.emplace(nameCrc, static_cast<u32>(m_binaryNameIndices.size()));
+            WriteBinaryIndex(insertResult.first->second);
+            if (insertResult.second)
+            {
+                AZStd::endian_swap(nameCrc);
+                m_stream->Write(sizeof(nameCrc), &nameCrc);
+            }
+        }
+
+        //=========================================================================
+        // WriteBinaryTypeId
+        //=========================================================================
+        void ObjectStreamImpl::WriteBinaryTypeId(const Uuid& typeId)
+        {
+            auto insertResult = m_binaryTypeIndices.emplace(typeId, static_cast<u32>(m_binaryTypeIndices.size()));
+            WriteBinaryIndex(insertResult.first->second);
+            if (insertResult.second)
+            {
+                m_stream->Write(typeId.end() - typeId.begin(), typeId.begin());
+            }
+        }
+
+        //=========================================================================
+        // IsPackedContainer
+        //=========================================================================
+        bool ObjectStreamImpl::IsPackedContainer(const SerializeContext::ClassData* classData, const SerializeContext::DataElement& element) const
+        {
+            // Containers don't have a serializer, so a binary container element that has a value holds its elements packed.
+            return GetType() == ST_BINARY && m_version >= s_binaryPackedContainerVersion && classData && classData->m_container
+                && !classData->m_serializer && element.m_dataSize > 0;
+        }
+
+        //=========================================================================
+        // SavePackedContainer
+        //=========================================================================
+        bool ObjectStreamImpl::SavePackedContainer(const void* containerPtr, const SerializeContext::ClassData* classData, size_t& dataSize)
+        {
+            // The value of a packed container is the type id, name crc and version of its elements, followed by the number of elements,
+            // the size of a single element value and the values of all elements as written by the element serializer.
+            const SerializeContext::ClassData* elementClassData = nullptr;
+            const SerializeContext::ClassElement* elementClassElement = nullptr;
+            size_t elementValueSize = 0;
+            u32 numElements = 0;
+            bool canPack = true;
+
+            m_outStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            auto saveElementCB = [&](void* elementPtr, const Uuid& elementClassId, const SerializeContext::ClassData* elementGenericClassData,
+                const SerializeContext::ClassElement* classElement)
+            {
+                const SerializeContext::ClassData* elementData = elementGenericClassData ? elementGenericClassData : m_sc->FindClassData(elementClassId);
+                if (numElements == 0)
+                {
+                    // Only plain data elements that are stored by value and don't need any of the per element callbacks can be packed.
+                    canPack = elementData && elementData->m_serializer && !elementData->m_container && !elementData->m_eventHandler
+                        && !elementData->m_doSave && elementData->m_typeId != GetAssetClassId()
+                        && !elementData->FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride)
+                        && classElement && (classElement->m_flags & SerializeContext::ClassElement::FLG_POINTER) == 0;
+                    elementClassData = elementData;
+                    elementClassElement = classElement;
+                }
+                else if (elementData != elementClassData || classElement != elementClassElement)
+                {
+                    canPack = false;
+                }
+
+                if (canPack)
+                {
+                    const size_t valueSize = elementClassData->m_serializer->Save(elementPtr, m_outStream, true);
+                    if (numElements == 0)
+                    {
+                        elementValueSize = valueSize;
+                    }
+                    canPack = valueSize == elementValueSize;
+                    ++numElements;
+                }
+                return canPack;
+            };
+            classData->m_container->EnumElements(const_cast<void*>(containerPtr), saveElementCB);
+
+            if (!canPack || numElements == 0 || elementValueSize == 0)
+            {
+                return false;
+            }
+
+            Uuid elementTypeId = elementClassData->m_typeId;
+            u32 elementNameCrc = elementClassElement->m_nameCrc;
+            AZ_Assert(elementClassData->m_version < 0x100, "element.version is too high for the current binary format!");
+            u8 elementVersion = static_cast<u8>(elementClassData->m_version);
+            u32 packedNumElements = numElements;
+            u32 packedValueSize = static_cast<u32>(elementValueSize);
+            AZStd::endian_swap(elementNameCrc);
+            AZStd::endian_swap(packedNumElements);
+            AZStd::endian_swap(packedValueSize);
+
+            m_inStream.Write(elementTypeId.end() - elementTypeId.begin(), elementTypeId.begin());
+            m_inStream.Write(sizeof(elementNameCrc), &elementNameCrc);
+            m_inStream.Write(sizeof(elementVersion), &elementVersion);
+            m_inStream.Write(sizeof(packedNumElements), &packedNumElements);
+            m_inStream.Write(sizeof(packedValueSize), &packedValueSize);
+            m_inStream.Write(elementValueSize * numElements, m_outStream.GetData()->data());
+
+            dataSize = static_cast<size_t>(m_inStream.GetCurPos());
+            return true;
+        }
+
+        //=========================================================================
+        // LoadPackedContainer
+        //=========================================================================
+        bool ObjectStreamImpl::LoadPackedContainer(IO::GenericStream& valueStream, const SerializeContext::ClassData* classData, void* containerPtr)
+        {
+            Uuid elementTypeId;
+            u32 elementNameCrc = 0;
+            u8 elementVersion = 0;
+            u32 numElements = 0;
+            u32 elementValueSize = 0;
+            valueStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            valueStream.Read(elementTypeId.end() - elementTypeId.begin(), elementTypeId.begin());
+            valueStream.Read(sizeof(elementNameCrc), &elementNameCrc);
+            valueStream.Read(sizeof(elementVersion), &elementVersion);
+            valueStream.Read(sizeof(numElements), &numElements);
+            valueStream.Read(sizeof(elementValueSize), &elementValueSize);
+            AZStd::endian_swap(elementNameCrc);
+            AZStd::endian_swap(numElements);
+            AZStd::endian_swap(elementValueSize);
+
+            SerializeContext::IDataContainer* container = classData->m_container;
+            const SerializeContext::ClassElement* classElement = container->GetElement(elementNameCrc);
+            const SerializeContext::ClassData* elementClassData = classElement && classElement->m_genericClassInfo
+                ? classElement->m_genericClassInfo->GetClassData() : m_sc->FindClassData(elementTypeId);
+            if (!classElement || classElement->m_typeId != elementTypeId || !elementClassData || !elementClassData->m_serializer
+                || valueStream.GetLength() - valueStream.GetCurPos() != static_cast<IO::SizeType>(numElements) * elementValueSize)
+            {
+                AZStd::string error = AZStd::string::format("Packed elements of type %s can't be stored in container %s.  File %s",
+                    elementTypeId.ToString<AZStd::string>().c_str(), classData->m_name, GetStreamFilename());
+                m_errorLogger.ReportError(error.c_str());
+                return false;
+            }
+
+            AZStd::vector<char> values;
+            values.resize_no_construct(static_cast<size_t>(numElements) * elementValueSize);
+            valueStream.Read(values.size(), values.data());
+
+            bool result = true;
+            for (u32 elementIndex = 0; elementIndex < numElements; ++elementIndex)
+            {
+                void* elementPtr = container->CanAccessElementsByIndex() && container->Size(containerPtr) > elementIndex
+                    ? container->GetElementByIndex(containerPtr, classElement, elementIndex)
+                    : container->ReserveElement(containerPtr, classElement);
+                if (!elementPtr)
+                {
+                    AZStd::string error = AZStd::string::format("Failed to reserve element in container. The container may be full. Element %u will not be added to container.", elementIndex);
+                    m_errorLogger.ReportError(error.c_str());
+                    return false;
+                }
+
+                IO::MemoryStream elementStream(values.data() + static_cast<size_t>(elementIndex) * elementValueSize, elementValueSize);
+                if (!elementClassData->m_serializer->Load(elementPtr, elementStream, elementVersion, true))
+                {
+                    AZStd::string error = AZStd::string::format("Serializer failed for %s element %u of container %s.  File %s",
+                        elementClassData->m_name, elementIndex, classData->m_name, GetStreamFilename());
+                    m_errorLogger.ReportError(error.c_str());
+                    result = false;
+                }
+                container->StoreElement(containerPtr, elementPtr);
+            }
+            return result;
+        }
+
+        //=========================================================================
+        // UnpackContainerNode
+        //=========================================================================
+        void ObjectStreamImpl::UnpackContainerNode(SerializeContext::DataElementNode& containerNode)
+        {
+            IO::GenericStream& valueStream = containerNode.m_element.m_byteStream;
+            Uuid elementTypeId;
+            u32 elementNameCrc = 0;
+            u8 elementVersion = 0;
+            u32 numElements = 0;
+            u32 elementValueSize = 0;
+            valueStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            valueStream.Read(elementTypeId.end() - elementTypeId.begin(), elementTypeId.begin());
+            valueStream.Read(sizeof(elementNameCrc), &elementNameCrc);
+            valueStream.Read(sizeof(elementVersion), &elementVersion);
+            valueStream.Read(sizeof(numElements), &numElements);
+            valueStream.Read(sizeof(elementValueSize), &elementValueSize);
+            AZStd::endian_swap(elementNameCrc);
+            AZStd::endian_swap(numElements);
+            AZStd::endian_swap(elementValueSize);
+
+            const SerializeContext::ClassElement* classElement = containerNode.m_classData->m_container->GetElement(elementNameCrc);
+            const SerializeContext::ClassData* elementClassData = classElement && classElement->m_genericClassInfo
+                ? classElement->m_genericClassInfo->GetClassData() : m_sc->FindClassData(elementTypeId);
+            AZStd::vector<char> value;
+            value.resize_no_construct(elementValueSize);
+            for (u32 elementIndex = 0; elementIndex < numElements; ++elementIndex)
+            {
+                valueStream.Read(value.size(), value.data());
+
+                containerNode.m_subElements.push_back();
+                SerializeContext::DataElementNode& elementNode = containerNode.m_subElements.back();
+                elementNode.m_classData = elementClassData;
+                elementNode.m_element.m_name = classElement ? classElement->m_name : nullptr;
+                elementNode.m_element.m_nameCrc = elementNameCrc;
+                elementNode.m_element.m_id = elementTypeId;
+                elementNode.m_element.m_version = elementVersion;
+                elementNode.m_element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
+                elementNode.m_element.m_stream = &elementNode.m_element.m_byteStream;
+                elementNode.m_element.m_byteStream.Write(value.size(), value.data());
+                elementNode.m_element.m_byteStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                elementNode.m_element.m_dataSize = value.size();
+            }
+
+            // The container itself doesn't have a value once its elements are unpacked.
+            containerNode.m_element.m_byteStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            containerNode.m_element.m_byteStream.Truncate();
+            containerNode.m_element.m_dataSize = 0;
+        }
+
         //=========================================================================
         // WriteClass
         // [6/22/2012]
@@ -1687,10 +2110,15 @@ namespace AZ
 
             m_inStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
 
+            bool isPackedContainer = false;
             if (classData->m_serializer)
             {
                 element.m_dataSize = classData->m_serializer->Save(objectPtr, m_inStream, GetType() == ST_BINARY);
             }
+            else if (classData->m_container && GetType() == ST_BINARY)
+            {
+                isPackedContainer = SavePackedContainer(objectPtr, classData, element.m_dataSize);
+            }
 
             if (GetType() == ST_XML)
             {
@@ -1789,7 +2217,7 @@ namespace AZ
                 {
                     flagsSize |= ST_BINARYFLAG_HAS_NAME;
                 }
-                if (classData->m_serializer)
+                if (classData->m_serializer || isPackedContainer)
                 {
                     flagsSize |= ST_BINARYFLAG_HAS_VALUE;
                     if (element.m_dataSize < 8)
@@ -1826,9 +2254,7 @@ namespace AZ
                 // Write name
                 if (element.m_nameCrc)
                 {
-                    u32 nameCrc = element.m_nameCrc;
-                    AZStd::endian_swap(nameCrc);
-                    m_stream->Write(sizeof(nameCrc), &nameCrc);
+                    WriteBinaryNameCrc(element.m_nameCrc);
                 }
 
                 // Write version
@@ -1840,10 +2266,10 @@ namespace AZ
                 }
 
                 // Write Uuid
-                m_stream->Write(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
+                WriteBinaryTypeId(element.m_id);
 
                 // Write value
-                if (classData->m_serializer)
+                if (classData->m_serializer || isPackedContainer)
                 {
                     // Write extra size field if necessary
                     if (flagsSize & ST_BINARYFLAG_EXTRA_SIZE_FIELD)
@@ -1883,6 +2309,13 @@ namespace AZ
 
                     element.m_stream = nullptr;
                 }
+
+                if (isPackedContainer)
+                {
+                    // The elements are part of the value, so the enumeration of the container is skipped and the element is closed here.
+                    CloseElement();
+                    return false;
+                }
             }
 
             return true;
@@ -1957,7 +2390,7 @@ namespace AZ
                 else
                 {
                     u8 binaryTag = s_binaryStreamTag;
-                    u32 version = static_cast<u32>(m_version);
+                    u32 version = s_binaryObjectStreamVersion;
                     AZStd::endian_swap(binaryTag);
                     AZStd::endian_swap(version);
                     m_stream->Write(sizeof(binaryTag), &binaryTag);
@@ -1984,14 +2417,14 @@ namespace AZ
                         AZStd::endian_swap(version);
                         m_version = version;
 
-                        if (m_version <= s_objectStreamVersion)
+                        if (m_version <= s_binaryObjectStreamVersion)
                         {
                             result = LoadClass(m_inStream, convertedClassElement, nullptr, nullptr, m_flags) && result;
                         }
                         else
                         {
                             AZStd::string newVersionError = AZStd::string::format("ObjectStream binary load error: Stream is a newer version than object stream supports. ObjectStream version: %u, load stream version: %u",
-                                s_objectStreamVersion, m_version);
+                                s_binaryObjectStreamVersion, m_version);
                             m_errorLogger.ReportError(newVersionError.c_str());
 
                             // this is considered a "fatal" error since the entire stream is unreadable.
@@ -35,6 +35,8 @@ set(FILES
     Casting/numeric_cast.h
     Component/Component.cpp
     Component/Component.h
+    Component/ComponentActivationOrderCache.cpp
+    Component/ComponentActivationOrderCache.h
     Component/ComponentApplication.cpp
     Component/ComponentApplication.h
     Component/ComponentApplicationBus.h
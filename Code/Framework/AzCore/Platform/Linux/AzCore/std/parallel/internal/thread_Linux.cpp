@@ -52,7 +52,11 @@ namespace AZStd
 
         void PostCreateThread(pthread_t tId, const char* name, int)
         {
-            pthread_setname_np(tId, name);
+            // Linux rejects names of more than 15 characters instead of truncating them
+            constexpr size_t MaxThreadNameLength = 16;
+            char threadName[MaxThreadNameLength] = {};
+            azstrncpy(threadName, MaxThreadNameLength, name, MaxThreadNameLength - 1);
+            pthread_setname_np(tId, threadName);
         }
     }
 }
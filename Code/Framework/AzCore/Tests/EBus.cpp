@@ -44,7 +44,8 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false,
+        bool sharedDispatch = false, bool lockFreeEventQueue = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -52,9 +53,11 @@ namespace BusImplementation
         static const AZ::EBusAddressPolicy AddressPolicy = addressPolicy;
         static const AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
         static const bool LocklessDispatch = locklessDispatch;
+        static const bool SharedDispatch = sharedDispatch;
 
         // Allow queuing
         static const bool EnableEventQueue = true;
+        static const bool EnableLockFreeEventQueue = lockFreeEventQueue;
 
         // Force locking
         using MutexType = AZStd::recursive_mutex;
@@ -192,8 +195,10 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false,
+    bool sharedDispatch = false, bool lockFreeEventQueue = false>
+using TestBus = AZ::EBus<BusImplementation::Interface,
+    BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, sharedDispatch, lockFreeEventQueue>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
@@ -3022,6 +3027,338 @@ namespace UnitTest
         ThrashLocklessDispatchNullMutex();
     }
 
+    struct SharedDispatchEvents
+        : public AZ::EBusTraits
+    {
+        static const bool SharedDispatch = true;
+
+        virtual ~SharedDispatchEvents() = default;
+        virtual void AtomicIncrement() = 0;
+        virtual void NestedIncrement() = 0;
+    };
+
+    using SharedDispatchBus = AZ::EBus<SharedDispatchEvents>;
+
+    struct SharedDispatchImpl
+        : public SharedDispatchBus::Handler
+    {
+        AZStd::atomic<uint64_t> m_val{};
+        bool m_isForwarding;
+        SharedDispatchImpl(bool isForwarding = true)
+            : m_isForwarding(isForwarding)
+        {
+            BusConnect();
+        }
+
+        ~SharedDispatchImpl() override
+        {
+            BusDisconnect();
+        }
+
+        void AtomicIncrement() override
+        {
+            ++m_val;
+        }
+
+        void NestedIncrement() override
+        {
+            if (m_isForwarding)
+            {
+                SharedDispatchBus::Broadcast(&SharedDispatchBus::Events::AtomicIncrement);
+            }
+        }
+    };
+
+    TEST_F(EBus, SharedDispatch_Multithread_ConnectWhileDispatching)
+    {
+        constexpr size_t threadCount = 8;
+        constexpr uint64_t cycleCount = 1000;
+        AZStd::thread threads[threadCount];
+        AZStd::atomic_bool isDispatching{ true };
+
+        SharedDispatchImpl handler;
+
+        auto work = []()
+        {
+            for (uint64_t i = 0; i < cycleCount; ++i)
+            {
+                SharedDispatchBus::Broadcast(&SharedDispatchBus::Events::NestedIncrement);
+            }
+        };
+
+        // Keep connecting and disconnecting another handler while the events are dispatched.
+        AZStd::thread connectThread([&isDispatching]()
+            {
+                while (isDispatching)
+                {
+                    SharedDispatchImpl temporaryHandler(false);
+                }
+            });
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread(work);
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        isDispatching = false;
+        connectThread.join();
+
+        EXPECT_EQ(threadCount * cycleCount, static_cast<uint64_t>(handler.m_val));
+    }
+
+    // Handler which keeps its dispatches in progress for a while, so dispatches from multiple threads overlap.
+    struct SlowSharedDispatchImpl
+        : public SharedDispatchBus::Handler
+    {
+        AZStd::atomic<uint64_t> m_val{};
+
+        void AtomicIncrement() override
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::microseconds(50));
+            ++m_val;
+        }
+
+        void NestedIncrement() override
+        {
+            SharedDispatchBus::Broadcast(&SharedDispatchBus::Events::AtomicIncrement);
+        }
+    };
+
+    TEST_F(EBus, SharedDispatch_Multithread_ConnectIsNotStarvedByOverlappingNestedDispatches)
+    {
+        constexpr size_t threadCount = 4;
+        constexpr size_t connectCount = 100;
+        AZStd::thread threads[threadCount];
+        AZStd::atomic_bool isConnecting{ true };
+
+        SlowSharedDispatchImpl handler;
+        handler.BusConnect();
+
+        // There's always a dispatch in progress, and every dispatch sends a nested event while a connect may be waiting.
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread([&isConnecting]()
+                {
+                    while (isConnecting)
+                    {
+                        SharedDispatchBus::Broadcast(&SharedDispatchBus::Events::NestedIncrement);
+                    }
+                });
+        }
+
+        for (size_t i = 0; i < connectCount; ++i)
+        {
+            SharedDispatchImpl temporaryHandler(false);
+        }
+        isConnecting = false;
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        handler.BusDisconnect();
+
+        EXPECT_GT(static_cast<uint64_t>(handler.m_val), 0u);
+    }
+
+    TEST_F(EBus, SharedDispatch_ConnectFromHandler_Asserts)
+    {
+        struct ConnectingHandler
+            : public SharedDispatchBus::Handler
+        {
+            bool m_wasInDispatch = false;
+
+            void AtomicIncrement() override
+            {
+                m_wasInDispatch = SharedDispatchBus::IsInDispatchThisThread();
+                // Connecting here would deadlock, so only check that it's detected.
+                AZ_TEST_START_TRACE_SUPPRESSION;
+                SharedDispatchBus::AssertNotInSharedDispatch(*SharedDispatchBus::GetContext());
+                AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+            }
+
+            void NestedIncrement() override {}
+        };
+
+        ConnectingHandler handler;
+        handler.BusConnect();
+        EXPECT_FALSE(SharedDispatchBus::IsInDispatchThisThread());
+
+        SharedDispatchBus::Broadcast(&SharedDispatchBus::Events::AtomicIncrement);
+        EXPECT_TRUE(handler.m_wasInDispatch);
+
+        // Outside of a dispatch connecting and disconnecting doesn't assert.
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        SharedDispatchBus::AssertNotInSharedDispatch(*SharedDispatchBus::GetContext());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(0);
+        handler.BusDisconnect();
+    }
+
+    struct LockFreeQueueEvents
+        : public AZ::EBusTraits
+    {
+        static const bool EnableEventQueue = true;
+        static const bool EnableLockFreeEventQueue = true;
+
+        virtual ~LockFreeQueueEvents() = default;
+        virtual void Record(int value) = 0;
+    };
+
+    using LockFreeQueueBus = AZ::EBus<LockFreeQueueEvents>;
+
+    struct LockFreeQueueImpl
+        : public LockFreeQueueBus::Handler
+    {
+        AZStd::vector<int> m_values;
+        LockFreeQueueImpl()
+        {
+            BusConnect();
+        }
+
+        ~LockFreeQueueImpl() override
+        {
+            BusDisconnect();
+        }
+
+        void Record(int value) override
+        {
+            m_values.push_back(value);
+        }
+    };
+
+    TEST_F(EBus, LockFreeEventQueue_ExecuteQueuedEvents_EventsExecutedInQueuedOrder)
+    {
+        LockFreeQueueImpl handler;
+
+        for (int value = 0; value < 10; ++value)
+        {
+            LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::Record, value);
+        }
+        // Events queued while executing are executed in the same call.
+        LockFreeQueueBus::QueueFunction([]()
+            {
+                LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::Record, 10);
+            });
+        EXPECT_EQ(11u, LockFreeQueueBus::QueuedEventCount());
+
+        LockFreeQueueBus::ExecuteQueuedEvents();
+
+        ASSERT_EQ(11u, handler.m_values.size());
+        for (int value = 0; value < 11; ++value)
+        {
+            EXPECT_EQ(value, handler.m_values[value]);
+        }
+        EXPECT_EQ(0u, LockFreeQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(EBus, LockFreeEventQueue_ClearWhileExecuting_RemainingEventsDropped)
+    {
+        LockFreeQueueImpl handler;
+
+        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::Record, 0);
+        LockFreeQueueBus::QueueFunction(&LockFreeQueueBus::ClearQueuedEvents);
+        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::Record, 1);
+
+        LockFreeQueueBus::ExecuteQueuedEvents();
+
+        ASSERT_EQ(1u, handler.m_values.size());
+        EXPECT_EQ(0, handler.m_values[0]);
+        EXPECT_EQ(0u, LockFreeQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(EBus, LockFreeEventQueue_Multithread_AllEventsExecutedInPerThreadOrder)
+    {
+        constexpr int threadCount = 8;
+        constexpr int cycleCount = 1000;
+        constexpr size_t eventCount = threadCount * cycleCount;
+        AZStd::thread threads[threadCount];
+
+        LockFreeQueueImpl handler;
+
+        for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([threadIndex]()
+                {
+                    for (int i = 0; i < cycleCount; ++i)
+                    {
+                        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::Record, threadIndex * cycleCount + i);
+                    }
+                });
+        }
+
+        // Drain the queue while the other threads are still queueing events.
+        while (handler.m_values.size() < eventCount)
+        {
+            LockFreeQueueBus::ExecuteQueuedEvents();
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(eventCount, handler.m_values.size());
+        int lastValues[threadCount];
+        AZStd::fill(AZStd::begin(lastValues), AZStd::end(lastValues), -1);
+        for (int value : handler.m_values)
+        {
+            const int threadIndex = value / cycleCount;
+            EXPECT_LT(lastValues[threadIndex], value);
+            lastValues[threadIndex] = value;
+        }
+    }
+
+    TEST_F(EBus, LockFreeEventQueue_MultithreadHandOff_EventsExecutedInQueuedOrder)
+    {
+        constexpr int threadCount = 4;
+        constexpr int roundCount = 500;
+        constexpr size_t eventCount = threadCount * roundCount;
+        AZStd::thread threads[threadCount];
+        AZStd::atomic_int turn{ 0 };
+
+        LockFreeQueueImpl handler;
+
+        // The threads take turns queueing an event, so every event is queued after the previous one even though they're all
+        // queued from different threads than the one before.
+        for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([threadIndex, &turn]()
+                {
+                    for (int round = 0; round < roundCount; ++round)
+                    {
+                        const int value = round * threadCount + threadIndex;
+                        while (turn.load(AZStd::memory_order_acquire) != value)
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::Record, value);
+                        turn.store(value + 1, AZStd::memory_order_release);
+                    }
+                });
+        }
+
+        while (handler.m_values.size() < eventCount)
+        {
+            LockFreeQueueBus::ExecuteQueuedEvents();
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(eventCount, handler.m_values.size());
+        for (int value = 0; value < static_cast<int>(eventCount); ++value)
+        {
+            EXPECT_EQ(value, handler.m_values[value]);
+        }
+        EXPECT_EQ(0u, LockFreeQueueBus::QueuedEventCount());
+    }
+
     namespace EBusResultsTest
     {
         class ResultClass
@@ -4500,6 +4837,69 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_Multithreaded_SharedDispatch(::benchmark::State& state)
+    {
+        using Bus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, true>;
+
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnWait);
+        };
+
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_EBus_Multithreaded_SharedDispatch)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    //////////////////////////////////////////////////////////////////////////
+    // Multithreaded Queueing
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Bus>
+    static void BM_EBus_Multithreaded_QueueBroadcast(::benchmark::State& state)
+    {
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        // Every thread queues events while the first thread also drains the queue, like the main thread would.
+        size_t queuedEvents = 0;
+        while (state.KeepRunning())
+        {
+            Bus::QueueBroadcast(&Bus::Events::OnEvent);
+            if (state.thread_index == 0 && (++queuedEvents % 64) == 0)
+            {
+                Bus::ExecuteQueuedEvents();
+            }
+        };
+
+        if (state.thread_index == 0)
+        {
+            Bus::ClearQueuedEvents();
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_QueueBroadcast, TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple>)
+        ->Apply(&BenchmarkSettings::OneToOne)->Apply(&BenchmarkSettings::Multithreaded);
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_QueueBroadcast, TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, false, true>)
+        ->Apply(&BenchmarkSettings::OneToOne)->Apply(&BenchmarkSettings::Multithreaded);
 }
 
 #endif // HAVE_BENCHMARK
@@ -8,8 +8,14 @@
 
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/ComponentActivationOrderCache.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -697,4 +703,435 @@ namespace UnitTest
             EXPECT_EQ(entity2.GetComponents().size(), 1);
         } // there will be a crash here if they go out of scope if they weren't properly moved.
     }
+
+    // Used to verify that components that declare their activation thread safe are activated after their dependencies.
+    class ThreadSafeActivationProviderComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ThreadSafeActivationProviderComponent, "{3C5D2C4B-7E0A-4F0B-9D0E-7F3B1F1E6A01}");
+
+        ///////////////////////////////////////
+        // Component overrides
+        void Activate() override { m_isActive = true; }
+        void Deactivate() override { m_isActive = false; }
+        ///////////////////////////////////////
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection);
+            if (serializeContext)
+            {
+                serializeContext->Class<ThreadSafeActivationProviderComponent, AZ::Component>();
+            }
+        }
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+        {
+            services.push_back(AZ_CRC("ThreadSafeActivationProviderService"));
+        }
+
+        static bool IsActivationThreadSafe() { return true; }
+
+        AZStd::atomic_bool m_isActive{ false };
+    };
+
+    class ThreadSafeActivationDependentComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ThreadSafeActivationDependentComponent, "{3C5D2C4B-7E0A-4F0B-9D0E-7F3B1F1E6A02}");
+
+        ///////////////////////////////////////
+        // Component overrides
+        void Activate() override
+        {
+            m_activatedAfterProvider = GetEntity()->FindComponent<ThreadSafeActivationProviderComponent>()->m_isActive.load();
+            m_isActive = true;
+        }
+        void Deactivate() override { m_isActive = false; }
+        ///////////////////////////////////////
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection);
+            if (serializeContext)
+            {
+                serializeContext->Class<ThreadSafeActivationDependentComponent, AZ::Component>();
+            }
+        }
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+        {
+            services.push_back(AZ_CRC("ThreadSafeActivationDependentService"));
+        }
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+        {
+            services.push_back(AZ_CRC("ThreadSafeActivationProviderService"));
+        }
+
+        static bool IsActivationThreadSafe() { return true; }
+
+        AZStd::atomic_bool m_isActive{ false };
+        bool m_activatedAfterProvider = false;
+    };
+
+    // Doesn't declare its activation thread safe, so it's always activated on the thread that activates the entity.
+    class MainThreadActivationComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MainThreadActivationComponent, "{3C5D2C4B-7E0A-4F0B-9D0E-7F3B1F1E6A03}");
+
+        ///////////////////////////////////////
+        // Component overrides
+        void Activate() override
+        {
+            m_activatedAfterDependencies = GetEntity()->FindComponent<ThreadSafeActivationDependentComponent>()->m_isActive.load();
+            m_activationThreadId = AZStd::this_thread::get_id();
+        }
+        void Deactivate() override { }
+        ///////////////////////////////////////
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection);
+            if (serializeContext)
+            {
+                serializeContext->Class<MainThreadActivationComponent, AZ::Component>();
+            }
+        }
+
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+        {
+            services.push_back(AZ_CRC("ThreadSafeActivationDependentService"));
+        }
+
+        bool m_activatedAfterDependencies = false;
+        AZStd::thread::id m_activationThreadId;
+    };
+
+    class EntityActivationTests : public UnitTest::SerializeContextFixture
+    {
+        void SetUp() override
+        {
+            SerializeContextFixture::SetUp();
+
+            m_providerDescriptor = ThreadSafeActivationProviderComponent::CreateDescriptor();
+            m_providerDescriptor->Reflect(m_serializeContext);
+            m_dependentDescriptor = ThreadSafeActivationDependentComponent::CreateDescriptor();
+            m_dependentDescriptor->Reflect(m_serializeContext);
+            m_mainThreadDescriptor = MainThreadActivationComponent::CreateDescriptor();
+            m_mainThreadDescriptor->Reflect(m_serializeContext);
+            m_wrapperDescriptor = SortOrderTestComponentWrapper::CreateDescriptor();
+            m_wrapperDescriptor->Reflect(m_serializeContext);
+            AZ::Entity::Reflect(m_serializeContext);
+
+            m_activationOrderCache = aznew AZ::ComponentActivationOrderCache();
+            AZ::Interface<AZ::ComponentActivationOrderCache>::Register(m_activationOrderCache);
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (int threadCount = 0; threadCount < 4; ++threadCount)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+        }
+
+        void TearDown() override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::Interface<AZ::ComponentActivationOrderCache>::Unregister(m_activationOrderCache);
+            delete m_activationOrderCache;
+
+            m_wrapperDescriptor->ReleaseDescriptor();
+            m_mainThreadDescriptor->ReleaseDescriptor();
+            m_dependentDescriptor->ReleaseDescriptor();
+            m_providerDescriptor->ReleaseDescriptor();
+
+            UnitTest::SerializeContextFixture::TearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::Entity> CreateEntity()
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>();
+            // Add the components in reverse dependency order so they always need to be sorted.
+            entity->CreateComponent<MainThreadActivationComponent>();
+            entity->CreateComponent<ThreadSafeActivationDependentComponent>();
+            entity->CreateComponent<ThreadSafeActivationProviderComponent>();
+            return entity;
+        }
+
+        void ValidateActivation(const AZ::Entity& entity, AZStd::thread::id activatingThreadId)
+        {
+            EXPECT_EQ(AZ::Entity::State::Active, entity.GetState());
+            EXPECT_TRUE(entity.FindComponent<ThreadSafeActivationProviderComponent>()->m_isActive);
+            EXPECT_TRUE(entity.FindComponent<ThreadSafeActivationDependentComponent>()->m_activatedAfterProvider);
+            const MainThreadActivationComponent* mainThreadComponent = entity.FindComponent<MainThreadActivationComponent>();
+            EXPECT_TRUE(mainThreadComponent->m_activatedAfterDependencies);
+            EXPECT_EQ(activatingThreadId, mainThreadComponent->m_activationThreadId);
+        }
+
+        AZ::ComponentDescriptor* m_providerDescriptor = nullptr;
+        AZ::ComponentDescriptor* m_dependentDescriptor = nullptr;
+        AZ::ComponentDescriptor* m_mainThreadDescriptor = nullptr;
+        AZ::ComponentDescriptor* m_wrapperDescriptor = nullptr;
+        AZ::ComponentActivationOrderCache* m_activationOrderCache = nullptr;
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    TEST_F(EntityActivationTests, ActivationOrderCache_EntitiesWithSameComponentTypes_ShareCachedOrder)
+    {
+        AZStd::unique_ptr<AZ::Entity> entity1 = CreateEntity();
+        AZ::Entity entity2;
+        entity2.CreateComponent<ThreadSafeActivationDependentComponent>();
+        entity2.CreateComponent<ThreadSafeActivationProviderComponent>();
+        entity2.CreateComponent<MainThreadActivationComponent>();
+
+        AZ::Entity::ComponentArrayType expectedOrder = entity1->GetComponents();
+        ASSERT_TRUE(AZ::Entity::DependencySort(expectedOrder).IsSuccess());
+
+        EXPECT_EQ(AZ::Entity::DependencySortResult::Success, entity1->EvaluateDependencies());
+        EXPECT_EQ(AZ::Entity::DependencySortResult::Success, entity2.EvaluateDependencies());
+        EXPECT_EQ(1, m_activationOrderCache->GetCachedOrderCount());
+
+        EXPECT_EQ(expectedOrder, entity1->GetComponents());
+        ASSERT_EQ(entity1->GetComponents().size(), entity2.GetComponents().size());
+        for (size_t i = 0; i < entity1->GetComponents().size(); ++i)
+        {
+            EXPECT_EQ(entity1->GetComponents()[i]->RTTI_GetType(), entity2.GetComponents()[i]->RTTI_GetType());
+        }
+    }
+
+    TEST_F(EntityActivationTests, ActivationOrderCache_ComponentWithInstanceDependentServices_IsNotCached)
+    {
+        AZ::Entity entity;
+        entity.CreateComponent<ThreadSafeActivationProviderComponent>();
+        entity.CreateComponent<SortOrderTestComponentWrapper>(aznew ThreadSafeActivationDependentComponent());
+
+        EXPECT_EQ(AZ::Entity::DependencySortResult::Success, entity.EvaluateDependencies());
+        EXPECT_EQ(0, m_activationOrderCache->GetCachedOrderCount());
+    }
+
+    TEST_F(EntityActivationTests, ActivationOrderCache_ThreadSafeComponents_AreActivatedInWavesAfterTheirDependencies)
+    {
+        AZStd::unique_ptr<AZ::Entity> entity = CreateEntity();
+        ASSERT_EQ(AZ::Entity::DependencySortResult::Success, entity->EvaluateDependencies());
+
+        AZStd::vector<AZ::u32> waves;
+        ASSERT_TRUE(m_activationOrderCache->GetActivationWaves(entity->GetComponents(), waves));
+        ASSERT_EQ(3, waves.size());
+        EXPECT_EQ(0, waves[0]);
+        EXPECT_EQ(1, waves[1]);
+        EXPECT_EQ(AZ::ComponentActivationOrderCache::MainThreadWave, waves[2]);
+    }
+
+    TEST_F(EntityActivationTests, ActivateEntities_WithJobContext_ActivatesAllEntitiesInDependencyOrder)
+    {
+        constexpr size_t EntityCount = 64;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        AZStd::vector<AZ::Entity*> entitiesToActivate;
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            entities.push_back(CreateEntity());
+            entities.back()->Init();
+            entitiesToActivate.push_back(entities.back().get());
+        }
+
+        AZ::Entity::ActivateEntities(entitiesToActivate, m_jobContext);
+
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            ValidateActivation(*entity, AZStd::this_thread::get_id());
+            entity->Deactivate();
+        }
+    }
+
+    TEST_F(EntityActivationTests, ActivateEntities_WithoutJobContext_ActivatesAllEntitiesOnCallingThread)
+    {
+        constexpr size_t EntityCount = 4;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        AZStd::vector<AZ::Entity*> entitiesToActivate;
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            entities.push_back(CreateEntity());
+            entities.back()->Init();
+            entitiesToActivate.push_back(entities.back().get());
+        }
+
+        AZ::Entity::ActivateEntities(entitiesToActivate);
+
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            ValidateActivation(*entity, AZStd::this_thread::get_id());
+            entity->Deactivate();
+        }
+    }
 } // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares activating entities one at a time, with and without the activation order cache, against activating them as a batch.
+    class BM_EntityActivation
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_descriptors.push_back(UnitTest::ThreadSafeActivationProviderComponent::CreateDescriptor());
+            m_descriptors.push_back(UnitTest::ThreadSafeActivationDependentComponent::CreateDescriptor());
+            m_descriptors.push_back(UnitTest::MainThreadActivationComponent::CreateDescriptor());
+            m_descriptors.push_back(UnitTest::SortOrderTestFirstComponent::CreateDescriptor());
+            m_descriptors.push_back(UnitTest::SortOrderTestSecondComponent::CreateDescriptor());
+            m_descriptors.push_back(UnitTest::SortOrderTestThirdComponent::CreateDescriptor());
+            m_descriptors.push_back(UnitTest::SortOrderTestRequiresSecondAndThirdComponent::CreateDescriptor());
+
+            m_activationOrderCache = aznew AZ::ComponentActivationOrderCache();
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (unsigned int threadCount = 0; threadCount < AZStd::max(2u, AZStd::thread::hardware_concurrency()); ++threadCount)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+            delete m_activationOrderCache;
+
+            for (AZ::ComponentDescriptor* descriptor : m_descriptors)
+            {
+                descriptor->ReleaseDescriptor();
+            }
+            m_descriptors = {};
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void CreateEntities(size_t entityCount)
+        {
+            m_entities.reserve(entityCount);
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                AZ::Entity* entity = aznew AZ::Entity();
+                entity->CreateComponent<UnitTest::SortOrderTestRequiresSecondAndThirdComponent>();
+                entity->CreateComponent<UnitTest::MainThreadActivationComponent>();
+                entity->CreateComponent<UnitTest::ThreadSafeActivationDependentComponent>();
+                entity->CreateComponent<UnitTest::ThreadSafeActivationProviderComponent>();
+                entity->CreateComponent<UnitTest::SortOrderTestThirdComponent>();
+                entity->CreateComponent<UnitTest::SortOrderTestSecondComponent>();
+                entity->CreateComponent<UnitTest::SortOrderTestFirstComponent>();
+                entity->Init();
+                m_entities.push_back(entity);
+            }
+        }
+
+        void DestroyEntities()
+        {
+            for (AZ::Entity* entity : m_entities)
+            {
+                entity->Deactivate();
+                delete entity;
+            }
+            m_entities.clear();
+        }
+
+        void RunBenchmark(::benchmark::State& state, bool useCache, bool activateAsBatch)
+        {
+            if (useCache)
+            {
+                AZ::Interface<AZ::ComponentActivationOrderCache>::Register(m_activationOrderCache);
+            }
+
+            const size_t entityCount = aznumeric_cast<size_t>(state.range(0));
+            for (auto _ : state)
+            {
+                state.PauseTiming();
+                CreateEntities(entityCount);
+                state.ResumeTiming();
+
+                if (activateAsBatch)
+                {
+                    AZ::Entity::ActivateEntities(m_entities, m_jobContext);
+                }
+                else
+                {
+                    for (AZ::Entity* entity : m_entities)
+                    {
+                        entity->Activate();
+                    }
+                }
+
+                state.PauseTiming();
+                DestroyEntities();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * entityCount);
+
+            if (useCache)
+            {
+                AZ::Interface<AZ::ComponentActivationOrderCache>::Unregister(m_activationOrderCache);
+            }
+        }
+
+    protected:
+        AZStd::vector<AZ::ComponentDescriptor*> m_descriptors;
+        AZStd::vector<AZ::Entity*> m_entities;
+        AZ::ComponentActivationOrderCache* m_activationOrderCache = nullptr;
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(BM_EntityActivation, Activate_Uncached)(::benchmark::State& state)
+    {
+        RunBenchmark(state, false, false);
+    }
+    BENCHMARK_REGISTER_F(BM_EntityActivation, Activate_Uncached)
+        ->RangeMultiplier(10)
+        ->Range(10, 10000)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_EntityActivation, Activate_Cached)(::benchmark::State& state)
+    {
+        RunBenchmark(state, true, false);
+    }
+    BENCHMARK_REGISTER_F(BM_EntityActivation, Activate_Cached)
+        ->RangeMultiplier(10)
+        ->Range(10, 10000)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_EntityActivation, ActivateEntities)(::benchmark::State& state)
+    {
+        RunBenchmark(state, true, true);
+    }
+    BENCHMARK_REGISTER_F(BM_EntityActivation, ActivateEntities)
+        ->RangeMultiplier(10)
+        ->Range(10, 10000)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
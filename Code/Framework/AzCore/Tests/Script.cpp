@@ -3115,6 +3115,23 @@ namespace UnitTest
         run();
     }
 
+    TEST_F(ScriptContextTest, GarbageCollect_SmallObjectGarbage_ReturnsBlockPoolPagesToAllocator)
+    {
+        IAllocatorAllocate& allocator = AllocatorInstance<SystemAllocator>::Get();
+        ScriptContext script(ScriptContextIds::DefaultScriptContextId, &allocator);
+        script.GarbageCollect();
+        const size_t bytesBefore = allocator.NumAllocatedBytes();
+
+        // small tables are allocated from the pages of the block pool, not the allocator
+        EXPECT_TRUE(script.Execute("Garbage = {} for i = 1, 100000 do Garbage[i] = { i } end"));
+        const size_t bytesWithGarbage = allocator.NumAllocatedBytes();
+        EXPECT_GT(bytesWithGarbage, bytesBefore);
+
+        EXPECT_TRUE(script.Execute("Garbage = nil"));
+        script.GarbageCollect();
+        EXPECT_LT(allocator.NumAllocatedBytes(), bytesBefore + (bytesWithGarbage - bytesBefore) / 4);
+    }
+
     class ScriptDebugTest
         : public AllocatorsFixture
     {
@@ -1854,3 +1854,209 @@ namespace UnitTest
 )LUA");
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Forwards to the system allocator, counting the allocations and the bytes held, so the benchmark sees the
+    //! memory of the script context the way the allocator does, including the pages of the Lua block pool.
+    class CountingScriptAllocator
+        : public AZ::IAllocatorAllocate
+    {
+    public:
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord) override
+        {
+            pointer_type ptr = GetAllocator().Allocate(byteSize, alignment, flags, name, fileName, lineNum, suppressStackRecord + 1);
+            if (ptr)
+            {
+                ++m_allocations;
+                m_allocatedBytes += GetAllocator().AllocationSize(ptr);
+            }
+            return ptr;
+        }
+
+        void DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment) override
+        {
+            if (ptr)
+            {
+                m_allocatedBytes -= GetAllocator().AllocationSize(ptr);
+                GetAllocator().DeAllocate(ptr, byteSize, alignment);
+            }
+        }
+
+        size_type Resize(pointer_type ptr, size_type newSize) override
+        {
+            const size_type oldSize = GetAllocator().AllocationSize(ptr);
+            const size_type newAllocationSize = GetAllocator().Resize(ptr, newSize);
+            m_allocatedBytes = m_allocatedBytes - oldSize + newAllocationSize;
+            return newAllocationSize;
+        }
+
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override
+        {
+            const size_type oldSize = ptr ? GetAllocator().AllocationSize(ptr) : 0;
+            pointer_type newPtr = GetAllocator().ReAllocate(ptr, newSize, newAlignment);
+            if (newPtr)
+            {
+                ++m_allocations;
+                m_allocatedBytes = m_allocatedBytes - oldSize + GetAllocator().AllocationSize(newPtr);
+            }
+            return newPtr;
+        }
+
+        size_type AllocationSize(pointer_type ptr) override
+        {
+            return GetAllocator().AllocationSize(ptr);
+        }
+
+        size_type NumAllocatedBytes() const override
+        {
+            return m_allocatedBytes;
+        }
+
+        size_type Capacity() const override
+        {
+            return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Capacity();
+        }
+
+        IAllocatorAllocate* GetSubAllocator() override
+        {
+            return &GetAllocator();
+        }
+
+        size_t GetAllocationCount() const
+        {
+            return m_allocations;
+        }
+
+    private:
+        static AZ::IAllocatorAllocate& GetAllocator()
+        {
+            return AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        }
+
+        size_t m_allocations = 0;
+        size_t m_allocatedBytes = 0;
+    };
+
+    //! Measures calls from Lua to reflected math methods, reporting the calls per second, the allocations each call makes
+    //! from the allocator of the script context, and the bytes the context still holds after a full garbage collection.
+    class BM_ScriptMathCalls
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        static constexpr int CallsPerIteration = 1000;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_behavior = aznew AZ::BehaviorContext();
+            AZ::MathReflect(m_behavior);
+
+            m_script = aznew AZ::ScriptContext(AZ::ScriptContextIds::DefaultScriptContextId, &m_allocator);
+            m_script->BindTo(m_behavior);
+            m_script->Execute(R"LUA(
+                function Vector3GetLength(count)
+                    local v = Vector3(1, 2, 3)
+                    local length = 0
+                    for i = 1, count do
+                        length = v:GetLength()
+                    end
+                    return length
+                end
+
+                function Vector3GetNormalized(count)
+                    local v = Vector3(1, 2, 3)
+                    local normalized = v
+                    for i = 1, count do
+                        normalized = v:GetNormalized()
+                    end
+                    return normalized
+                end
+
+                function TransformGetTranslation(count)
+                    local t = Transform.CreateIdentity()
+                    local translation = nil
+                    for i = 1, count do
+                        translation = t:GetTranslation()
+                    end
+                    return translation
+                end
+)LUA");
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_script;
+            delete m_behavior;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunBenchmark(::benchmark::State& state, const char* functionName)
+        {
+            lua_State* lua = m_script->NativeContext();
+            size_t allocations = 0;
+
+            for (auto _ : state)
+            {
+                // the collector is stopped while calling, so the allocations are everything the calls needed, not what
+                // the collector freed and the block pool recycled along the way
+                state.PauseTiming();
+                m_script->GarbageCollect();
+                lua_gc(lua, LUA_GCSTOP, 0);
+                const size_t allocationsBefore = m_allocator.GetAllocationCount();
+                state.ResumeTiming();
+
+                lua_getglobal(lua, functionName);
+                lua_pushinteger(lua, CallsPerIteration);
+                lua_pcall(lua, 1, 0, 0);
+
+                state.PauseTiming();
+                allocations += m_allocator.GetAllocationCount() - allocationsBefore;
+                lua_gc(lua, LUA_GCRESTART, 0);
+                state.ResumeTiming();
+            }
+
+            // a full collection trims the pages of the block pool that have no live blocks, what's left is the steady state
+            m_script->GarbageCollect();
+
+            const int64_t calls = state.iterations() * CallsPerIteration;
+            state.SetItemsProcessed(calls);
+            state.counters["Calls"] = ::benchmark::Counter(static_cast<double>(calls), ::benchmark::Counter::kIsRate);
+            state.counters["AllocationsPerCall"] = calls > 0 ? static_cast<double>(allocations) / calls : 0.0;
+            state.counters["BytesHeldAfterCollect"] = static_cast<double>(m_allocator.NumAllocatedBytes());
+        }
+
+    protected:
+        CountingScriptAllocator m_allocator;
+        AZ::BehaviorContext* m_behavior = nullptr;
+        AZ::ScriptContext* m_script = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(BM_ScriptMathCalls, Vector3GetLength)(::benchmark::State& state)
+    {
+        RunBenchmark(state, "Vector3GetLength");
+    }
+    BENCHMARK_REGISTER_F(BM_ScriptMathCalls, Vector3GetLength);
+
+    BENCHMARK_DEFINE_F(BM_ScriptMathCalls, Vector3GetNormalized)(::benchmark::State& state)
+    {
+        RunBenchmark(state, "Vector3GetNormalized");
+    }
+    BENCHMARK_REGISTER_F(BM_ScriptMathCalls, Vector3GetNormalized);
+
+    BENCHMARK_DEFINE_F(BM_ScriptMathCalls, TransformGetTranslation)(::benchmark::State& state)
+    {
+        RunBenchmark(state, "TransformGetTranslation");
+    }
+    BENCHMARK_REGISTER_F(BM_ScriptMathCalls, TransformGetTranslation);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
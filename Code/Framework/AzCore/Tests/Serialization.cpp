@@ -6050,6 +6050,169 @@ namespace UnitTest
         EXPECT_EQ("Test", loadBinaryString);
     }
 
+    TEST_F(ObjectStreamSerialization, V3ToCurrentVersionTest)
+    {
+        // Version 3 binary streams store the full name crc and type id of every element
+        TemplateInstantiationReflectedWrapper loadBinaryWrapper;
+        AZStd::string_view version3StringBinary = "0000000003085A2F60AAF63E4106BD5E0F77E01DDBAC5CC08C4427EF8FF807DDEE4EB0B6784CA3A2C490A454657374000000";
+        AZStd::vector<AZ::u8> byteArray;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> binaryStream(&byteArray);
+        AZStd::unique_ptr<AZ::SerializeContext::IDataSerializer> binarySerializer = AZStd::make_unique<AZ::Internal::AZByteStream<AZStd::allocator>>();
+        binarySerializer->TextToData(version3StringBinary.data(), 0, binaryStream);
+        binarySerializer.reset();
+
+        binaryStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(binaryStream, loadBinaryWrapper, m_serializeContext.get()));
+        EXPECT_EQ("Test", loadBinaryWrapper.m_name);
+    }
+
+    TEST_F(ObjectStreamSerialization, V4BinaryTypeAndNameTablesTest)
+    {
+        // Version 4 binary streams refer to name crcs and type ids through an index, followed by the value the first time it's used
+        TemplateInstantiationReflectedWrapper loadBinaryWrapper;
+        AZStd::string_view version4StringBinary = "000000000408005A2F60AAF63E4106BD5E0F77E01DDBAC5C00C08C442701EF8FF807DDEE4EB0B6784CA3A2C490A454657374000000";
+        AZStd::vector<AZ::u8> byteArray;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> binaryStream(&byteArray);
+        AZStd::unique_ptr<AZ::SerializeContext::IDataSerializer> binarySerializer = AZStd::make_unique<AZ::Internal::AZByteStream<AZStd::allocator>>();
+        binarySerializer->TextToData(version4StringBinary.data(), 0, binaryStream);
+        binarySerializer.reset();
+
+        binaryStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(binaryStream, loadBinaryWrapper, m_serializeContext.get()));
+        EXPECT_EQ("Test", loadBinaryWrapper.m_name);
+    }
+
+    TEST_F(ObjectStreamSerialization, BinaryRepeatedTypes_StoredOnce_RoundTrips)
+    {
+        m_serializeContext->RegisterGenericType<AZStd::vector<AZStd::string>>();
+
+        AZStd::vector<AZStd::string> strings;
+        for (int i = 0; i < 200; ++i)
+        {
+            strings.push_back(AZStd::string::format("String%d", i));
+        }
+
+        AZStd::vector<AZ::u8> byteArray;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> byteStream(&byteArray);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY, &strings, m_serializeContext.get()));
+
+        // Every element used to store its 16 byte type id and 4 byte name crc, now they only take an index byte each.
+        EXPECT_LT(byteArray.size(), strings.size() * (sizeof(AZ::Uuid) + sizeof(AZ::u32)));
+
+        AZStd::vector<AZStd::string> loadedStrings;
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadedStrings, m_serializeContext.get()));
+        EXPECT_EQ(strings, loadedStrings);
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->RegisterGenericType<AZStd::vector<AZStd::string>>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(ObjectStreamSerialization, BinaryPlainDataContainers_Packed_RoundTrip)
+    {
+        m_serializeContext->RegisterGenericType<AZStd::vector<float>>();
+        m_serializeContext->RegisterGenericType<AZStd::array<AZ::u32, 64>>();
+
+        AZStd::vector<float> floats;
+        AZStd::array<AZ::u32, 64> integers;
+        for (AZ::u32 i = 0; i < 64; ++i)
+        {
+            floats.push_back(static_cast<float>(i) * 0.5f);
+            integers[i] = i * 3;
+        }
+
+        // The elements are written back to back in the value of the container, without an element header each.
+        AZStd::vector<AZ::u8> floatBytes;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> floatStream(&floatBytes);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(floatStream, AZ::DataStream::ST_BINARY, &floats, m_serializeContext.get()));
+        EXPECT_LT(floatBytes.size(), floats.size() * (sizeof(float) + 2));
+
+        AZStd::vector<float> loadedFloats;
+        floatStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(floatStream, loadedFloats, m_serializeContext.get()));
+        EXPECT_EQ(floats, loadedFloats);
+
+        AZStd::vector<AZ::u8> integerBytes;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> integerStream(&integerBytes);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(integerStream, AZ::DataStream::ST_BINARY, &integers, m_serializeContext.get()));
+        EXPECT_LT(integerBytes.size(), integers.size() * (sizeof(AZ::u32) + 2));
+
+        AZStd::array<AZ::u32, 64> loadedIntegers{};
+        integerStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(integerStream, loadedIntegers, m_serializeContext.get()));
+        EXPECT_EQ(integers, loadedIntegers);
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->RegisterGenericType<AZStd::vector<float>>();
+        m_serializeContext->RegisterGenericType<AZStd::array<AZ::u32, 64>>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    struct PackedContainerWrapper
+    {
+        AZ_TYPE_INFO(PackedContainerWrapper, "{6B0F3C41-2D5E-4A8B-9C77-1E4F0A2B5D93}");
+        AZ_CLASS_ALLOCATOR(PackedContainerWrapper, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext* serializeContext, unsigned int version, AZ::SerializeContext::VersionConverter converter = nullptr)
+        {
+            serializeContext->Class<PackedContainerWrapper>()
+                ->Version(version, converter)
+                ->Field("Values", &PackedContainerWrapper::m_values);
+        }
+
+        AZStd::vector<int> m_values;
+    };
+
+    TEST_F(ObjectStreamSerialization, BinaryPackedContainer_VersionConverter_SeesContainerElements)
+    {
+        PackedContainerWrapper::Reflect(m_serializeContext.get(), 1);
+
+        PackedContainerWrapper wrapper;
+        wrapper.m_values = { 4, 8, 15, 16, 23, 42 };
+        AZStd::vector<AZ::u8> byteArray;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> byteStream(&byteArray);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY, &wrapper, m_serializeContext.get()));
+
+        m_serializeContext->EnableRemoveReflection();
+        PackedContainerWrapper::Reflect(m_serializeContext.get(), 1);
+        m_serializeContext->DisableRemoveReflection();
+
+        // Converters of older versions see the packed elements as sub elements of the container, like they were before.
+        static int s_convertedElementCount = 0;
+        s_convertedElementCount = 0;
+        auto converter = [](AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
+        {
+            AZ::SerializeContext::DataElementNode* valuesNode = classElement.FindSubElement(AZ_CRC_CE("Values"));
+            if (!valuesNode)
+            {
+                return false;
+            }
+            s_convertedElementCount = valuesNode->GetNumSubElements();
+            for (int i = 0; i < valuesNode->GetNumSubElements(); ++i)
+            {
+                int value = 0;
+                if (!valuesNode->GetSubElement(i).GetData(value) || !valuesNode->GetSubElement(i).SetData(context, value * 2))
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+        PackedContainerWrapper::Reflect(m_serializeContext.get(), 2, converter);
+
+        PackedContainerWrapper loadedWrapper;
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadedWrapper, m_serializeContext.get()));
+        EXPECT_EQ(s_convertedElementCount, 6);
+        const AZStd::vector<int> expectedValues = { 8, 16, 30, 32, 46, 84 };
+        EXPECT_EQ(expectedValues, loadedWrapper.m_values);
+
+        m_serializeContext->EnableRemoveReflection();
+        PackedContainerWrapper::Reflect(m_serializeContext.get(), 2, converter);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
     TEST_F(ObjectStreamSerialization, UnreflectedChildElementAndDeprecatedClass_XmlTest)
     {
         // Reflect the Deprecated class and the wrapper class 
@@ -8,6 +8,10 @@
 #include <AzCore/PlatformDef.h>
 
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -18,6 +22,200 @@
     
 namespace JsonSerializationTests
 {
+    namespace LoadPerformance
+    {
+        //! Forwards to the allocation source of an allocator while keeping track of the peak number of bytes allocated through it.
+        class PeakMemoryTracker
+            : public AZ::IAllocatorAllocate
+        {
+        public:
+            explicit PeakMemoryTracker(AZ::IAllocator& allocator)
+                : m_allocator(allocator)
+                , m_source(*allocator.GetAllocationSource())
+            {
+                m_allocator.SetAllocationSource(this);
+            }
+
+            ~PeakMemoryTracker() override
+            {
+                m_allocator.SetAllocationSource(&m_source);
+            }
+
+            pointer_type Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName,
+                int lineNum, unsigned int suppressStackRecord) override
+            {
+                pointer_type result = m_source.Allocate(byteSize, alignment, flags, name, fileName, lineNum, suppressStackRecord);
+                if (result)
+                {
+                    Track(m_source.AllocationSize(result));
+                }
+                return result;
+            }
+
+            void DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment) override
+            {
+                if (ptr)
+                {
+                    // Memory that was allocated before tracking started is subtracted as well, so only the peak relative to the start
+                    // of tracking is meaningful.
+                    m_currentBytes -= static_cast<ptrdiff_t>(m_source.AllocationSize(ptr));
+                }
+                m_source.DeAllocate(ptr, byteSize, alignment);
+            }
+
+            size_type Resize(pointer_type ptr, size_type newSize) override
+            {
+                const size_type oldSize = m_source.AllocationSize(ptr);
+                const size_type result = m_source.Resize(ptr, newSize);
+                if (result)
+                {
+                    m_currentBytes -= static_cast<ptrdiff_t>(oldSize);
+                    Track(m_source.AllocationSize(ptr));
+                }
+                return result;
+            }
+
+            pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override
+            {
+                const size_type oldSize = ptr ? m_source.AllocationSize(ptr) : 0;
+                pointer_type result = m_source.ReAllocate(ptr, newSize, newAlignment);
+                if (result)
+                {
+                    m_currentBytes -= static_cast<ptrdiff_t>(oldSize);
+                    Track(m_source.AllocationSize(result));
+                }
+                return result;
+            }
+
+            size_type AllocationSize(pointer_type ptr) override { return m_source.AllocationSize(ptr); }
+            void GarbageCollect() override { m_source.GarbageCollect(); }
+            size_type NumAllocatedBytes() const override { return m_source.NumAllocatedBytes(); }
+            size_type Capacity() const override { return m_source.Capacity(); }
+            size_type GetMaxAllocationSize() const override { return m_source.GetMaxAllocationSize(); }
+            size_type GetUnAllocatedMemory(bool isPrint) const override { return m_source.GetUnAllocatedMemory(isPrint); }
+            IAllocatorAllocate* GetSubAllocator() override { return m_source.GetSubAllocator(); }
+
+            size_t GetPeakBytes() const { return static_cast<size_t>(m_peakBytes); }
+
+        private:
+            void Track(size_type allocatedBytes)
+            {
+                m_currentBytes += static_cast<ptrdiff_t>(allocatedBytes);
+                m_peakBytes = AZStd::max(m_peakBytes, m_currentBytes);
+            }
+
+            AZ::IAllocator& m_allocator;
+            AZ::IAllocatorAllocate& m_source;
+            ptrdiff_t m_currentBytes = 0;
+            ptrdiff_t m_peakBytes = 0;
+        };
+
+        struct Leaf
+        {
+            AZ_TYPE_INFO(Leaf, "{8C0D8F55-5D3C-4C55-9F36-7D3F0E4B6A11}");
+            AZ_CLASS_ALLOCATOR(Leaf, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<Leaf>()
+                    ->Field("Name", &Leaf::m_name)
+                    ->Field("Description", &Leaf::m_description)
+                    ->Field("Id", &Leaf::m_id)
+                    ->Field("X", &Leaf::m_x)
+                    ->Field("Y", &Leaf::m_y)
+                    ->Field("Z", &Leaf::m_z)
+                    ->Field("Enabled", &Leaf::m_enabled);
+            }
+
+            AZStd::string m_name;
+            AZStd::string m_description;
+            int m_id = 0;
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+            float m_z = 0.0f;
+            bool m_enabled = false;
+        };
+
+        struct Branch
+        {
+            AZ_TYPE_INFO(Branch, "{8C0D8F55-5D3C-4C55-9F36-7D3F0E4B6A12}");
+            AZ_CLASS_ALLOCATOR(Branch, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<Branch>()
+                    ->Field("Leaf0", &Branch::m_leaf0)
+                    ->Field("Leaf1", &Branch::m_leaf1)
+                    ->Field("Leaf2", &Branch::m_leaf2)
+                    ->Field("Leaf3", &Branch::m_leaf3);
+            }
+
+            Leaf m_leaf0;
+            Leaf m_leaf1;
+            Leaf m_leaf2;
+            Leaf m_leaf3;
+        };
+
+        //! Nested reflected classes, which are loaded member by member, followed by a container, which is loaded element by element.
+        struct Document
+        {
+            AZ_TYPE_INFO(Document, "{8C0D8F55-5D3C-4C55-9F36-7D3F0E4B6A13}");
+            AZ_CLASS_ALLOCATOR(Document, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                Leaf::Reflect(context);
+                Branch::Reflect(context);
+                context.Class<Document>()
+                    ->Field("Branch0", &Document::m_branch0)
+                    ->Field("Branch1", &Document::m_branch1)
+                    ->Field("Branch2", &Document::m_branch2)
+                    ->Field("Branch3", &Document::m_branch3)
+                    ->Field("Leaves", &Document::m_leaves);
+            }
+
+            Branch m_branch0;
+            Branch m_branch1;
+            Branch m_branch2;
+            Branch m_branch3;
+            AZStd::vector<Leaf> m_leaves;
+        };
+
+        void FillLeaf(Leaf& leaf, int id, size_t descriptionLength)
+        {
+            leaf.m_name = AZStd::string::format("Leaf_%i", id);
+            leaf.m_description.resize(descriptionLength, static_cast<char>('a' + id % 26));
+            leaf.m_id = id;
+            leaf.m_x = static_cast<float>(id);
+            leaf.m_y = static_cast<float>(id) * 2.0f;
+            leaf.m_z = static_cast<float>(id) * 3.0f;
+            leaf.m_enabled = true;
+        }
+
+        void FillBranch(Branch& branch, int firstId, size_t descriptionLength)
+        {
+            FillLeaf(branch.m_leaf0, firstId, descriptionLength);
+            FillLeaf(branch.m_leaf1, firstId + 1, descriptionLength);
+            FillLeaf(branch.m_leaf2, firstId + 2, descriptionLength);
+            FillLeaf(branch.m_leaf3, firstId + 3, descriptionLength);
+        }
+
+        //! Creates a document where the reflected classes hold classBytes worth of descriptions and the container has containerSize leaves.
+        void FillDocument(Document& document, size_t classBytes, size_t containerSize)
+        {
+            const size_t descriptionLength = classBytes / 16;
+            FillBranch(document.m_branch0, 0, descriptionLength);
+            FillBranch(document.m_branch1, 4, descriptionLength);
+            FillBranch(document.m_branch2, 8, descriptionLength);
+            FillBranch(document.m_branch3, 12, descriptionLength);
+            document.m_leaves.resize(containerSize);
+            for (size_t i = 0; i < containerSize; ++i)
+            {
+                FillLeaf(document.m_leaves[i], aznumeric_cast<int>(16 + i), 16);
+            }
+        }
+    } // namespace LoadPerformance
+
     template<typename T>
     class TypedJsonSerializationTests 
         : public JsonSerializationTests
@@ -204,6 +402,72 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_EmptyJson_SucceedsAndObjectMatchesDefaults)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadInstance, "{}", *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::DefaultsUsed, loadResult.GetOutcome());
+
+        TypeParam expectedInstance;
+        EXPECT_TRUE(loadInstance.Equals(expectedInstance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_JsonWithoutDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadInstance, description.m_json, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_JsonWithSomeDefaults_MatchesResultOfLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam streamedInstance;
+        ResultCode streamedResult = AZ::JsonSerialization::LoadFromString(
+            streamedInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        EXPECT_EQ(loadResult.GetOutcome(), streamedResult.GetOutcome());
+        EXPECT_EQ(loadResult.GetProcessing(), streamedResult.GetProcessing());
+        EXPECT_TRUE(streamedInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_JsonAdditionalFields_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_json);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kStringType, this->m_jsonDocument->GetAllocator());
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<decltype(buffer)> writer(buffer);
+        this->m_jsonDocument->Accept(writer);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(
+            loadInstance, AZStd::string_view(buffer.GetString(), buffer.GetSize()), *this->m_deserializationSettings);
+        ASSERT_NE(Processing::Halted, loadResult.GetProcessing());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -237,6 +501,97 @@ namespace JsonSerializationTests
         EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
     }
 
+    TEST_F(JsonSerializationTests, LoadFromString_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        bool loadValue = false;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadValue, "true", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadValue);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadValues, "[13,42,88]", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_NestedArraysAtTheRoot_MatchesResultOfLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<AZStd::vector<int>>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        constexpr const char* json = "[[13,42],{},[88]]";
+        m_jsonDocument->Parse(json);
+
+        AZStd::vector<AZStd::vector<int>> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadValues, *m_jsonDocument, *m_deserializationSettings);
+
+        AZStd::vector<AZStd::vector<int>> streamedValues;
+        ResultCode streamedResult = AZ::JsonSerialization::LoadFromString(streamedValues, json, *m_deserializationSettings);
+        EXPECT_EQ(loadResult.GetOutcome(), streamedResult.GetOutcome());
+        EXPECT_EQ(loadResult.GetProcessing(), streamedResult.GetProcessing());
+        EXPECT_EQ(loadValues, streamedValues);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_MapAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        using Map = AZStd::unordered_map<AZStd::string, AZStd::vector<int>>;
+        auto genericInfo = AZ::SerializeGenericTypeInfo<Map>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        Map loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(
+            loadValues, R"({ "first": [13, 42], "second": [88] })", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        ASSERT_EQ(2, loadValues.size());
+        EXPECT_EQ(loadValues["first"], AZStd::vector<int>({ 13, 42 }));
+        EXPECT_EQ(loadValues["second"], AZStd::vector<int>({ 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_EmptyMapAtTheRoot_MatchesResultOfLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        using Map = AZStd::unordered_map<AZStd::string, int>;
+        auto genericInfo = AZ::SerializeGenericTypeInfo<Map>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        m_jsonDocument->Parse("{}");
+        Map loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadValues, *m_jsonDocument, *m_deserializationSettings);
+
+        Map streamedValues;
+        ResultCode streamedResult = AZ::JsonSerialization::LoadFromString(streamedValues, "{}", *m_deserializationSettings);
+        EXPECT_EQ(loadResult.GetOutcome(), streamedResult.GetOutcome());
+        EXPECT_TRUE(streamedValues.empty());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_InvalidJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadValues, "[13,42", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+    }
+
     TEST_F(JsonSerializationTests, Load_PointerToUnregisteredClass_ReturnsUnknown)
     {
         using namespace AZ::JsonSerializationResult;
@@ -565,4 +920,80 @@ namespace JsonSerializationTests
 
         EXPECT_EQ(Outcomes::Catastrophic, result.GetOutcome());
     }
+
+    // Compares the time and peak memory needed to load a large file by parsing it into a document first against loading it straight
+    // from the text. Disabled by default since it's a performance measurement.
+    TEST_F(JsonSerializationTests, DISABLED_LoadFromString_LargeFile_Performance)
+    {
+        using namespace LoadPerformance;
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr size_t FileBytes = 16 * 1024 * 1024;
+        constexpr int Repeats = 5;
+
+        Document::Reflect(*m_serializeContext);
+
+        struct Shape
+        {
+            const char* m_name;
+            size_t m_classBytes;
+            size_t m_containerSize;
+        };
+        const Shape shapes[] = {
+            { "reflected classes", FileBytes, 0 },
+            { "container", 0, FileBytes / 128 },
+            { "mixed", FileBytes / 2, FileBytes / 256 } };
+
+        for (const Shape& shape : shapes)
+        {
+            AZStd::string jsonText;
+            {
+                Document source;
+                FillDocument(source, shape.m_classBytes, shape.m_containerSize);
+                rapidjson::Document sourceDocument;
+                ResultCode storeResult =
+                    AZ::JsonSerialization::Store(sourceDocument, sourceDocument.GetAllocator(), source, *m_serializationSettings);
+                ASSERT_NE(Processing::Halted, storeResult.GetProcessing());
+
+                rapidjson::StringBuffer buffer;
+                rapidjson::Writer<decltype(buffer)> writer(buffer);
+                sourceDocument.Accept(writer);
+                jsonText.assign(buffer.GetString(), buffer.GetSize());
+            }
+
+            double loadTime = 0.0;
+            double loadFromStringTime = 0.0;
+            size_t loadPeakBytes = 0;
+            size_t loadFromStringPeakBytes = 0;
+            for (int repeat = 0; repeat < Repeats; ++repeat)
+            {
+                {
+                    PeakMemoryTracker tracker(AZ::AllocatorInstance<AZ::SystemAllocator>::GetAllocator());
+                    const auto start = AZStd::chrono::high_resolution_clock::now();
+                    Document loaded;
+                    rapidjson::Document document;
+                    document.Parse(jsonText.data(), jsonText.size());
+                    ResultCode result = AZ::JsonSerialization::Load(loaded, document, *m_deserializationSettings);
+                    const auto end = AZStd::chrono::high_resolution_clock::now();
+                    EXPECT_NE(Processing::Halted, result.GetProcessing());
+                    loadTime += AZStd::chrono::duration<double, AZStd::milli>(end - start).count();
+                    loadPeakBytes = AZStd::max(loadPeakBytes, tracker.GetPeakBytes());
+                }
+                {
+                    PeakMemoryTracker tracker(AZ::AllocatorInstance<AZ::SystemAllocator>::GetAllocator());
+                    const auto start = AZStd::chrono::high_resolution_clock::now();
+                    Document loaded;
+                    ResultCode result = AZ::JsonSerialization::LoadFromString(loaded, jsonText, *m_deserializationSettings);
+                    const auto end = AZStd::chrono::high_resolution_clock::now();
+                    EXPECT_NE(Processing::Halted, result.GetProcessing());
+                    loadFromStringTime += AZStd::chrono::duration<double, AZStd::milli>(end - start).count();
+                    loadFromStringPeakBytes = AZStd::max(loadFromStringPeakBytes, tracker.GetPeakBytes());
+                }
+            }
+
+            printf("%s, %zu bytes of json:\n", shape.m_name, jsonText.size());
+            printf("    Load:           %.2f ms, peak %zu bytes\n", loadTime / Repeats, loadPeakBytes);
+            printf("    LoadFromString: %.2f ms, peak %zu bytes\n", loadFromStringTime / Repeats, loadFromStringPeakBytes);
+        }
+    }
 } // namespace JsonSerializationTests
@@ -824,29 +824,16 @@ namespace UnitTest
 #ifdef HAVE_BENCHMARK
 namespace Benchmark
 {
-    static void BM_Slice_GenerateNewIdsAndFixRefs(benchmark::State& state)
+    //! Fills the container with entities that each have a few components to bulk up the data and one that references another entity.
+    static void CreateBenchmarkEntities(AZ::SliceComponent::InstantiatedContainer& container, int64_t entityCount)
     {
-        AZ::ComponentApplication componentApp;
-
-        AZ::ComponentApplication::Descriptor desc;
-        desc.m_useExistingAllocator = true;
-
-        AZ::ComponentApplication::StartupParameters startupParams;
-        startupParams.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
-
-        componentApp.Create(desc, startupParams);
-
-        UnitTest::MyTestComponent1::Reflect(componentApp.GetSerializeContext());
-        UnitTest::MyTestComponent2::Reflect(componentApp.GetSerializeContext());
-
         // we use some randomness to set up this scenario,
         // seed the generator so we get the same results each time.
         AZ::u32 randSeed[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
         AZ::Sfmt::GetInstance().Seed(randSeed, AZ_ARRAY_SIZE(randSeed));
 
         // setup a container with N entities
-        AZ::SliceComponent::InstantiatedContainer container;
-        for (int64_t entityI = 0; entityI < state.range(0); ++entityI)
+        for (int64_t entityI = 0; entityI < entityCount; ++entityI)
         {
             auto entity = aznew AZ::Entity();
 
@@ -870,6 +857,25 @@ namespace Benchmark
         {
             AZStd::swap(container.m_entities[i], container.m_entities[AZ::Sfmt::GetInstance().Rand64() % (i+1)]);
         }
+    }
+
+    static void BM_Slice_GenerateNewIdsAndFixRefs(benchmark::State& state)
+    {
+        AZ::ComponentApplication componentApp;
+
+        AZ::ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+
+        AZ::ComponentApplication::StartupParameters startupParams;
+        startupParams.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+
+        componentApp.Create(desc, startupParams);
+
+        UnitTest::MyTestComponent1::Reflect(componentApp.GetSerializeContext());
+        UnitTest::MyTestComponent2::Reflect(componentApp.GetSerializeContext());
+
+        AZ::SliceComponent::InstantiatedContainer container;
+        CreateBenchmarkEntities(container, state.range(0));
 
         AZStd::unordered_map<AZ::EntityId, AZ::EntityId> remappedIds;
         while (state.KeepRunning())
@@ -891,5 +897,45 @@ namespace Benchmark
 
     BENCHMARK(BM_Slice_GenerateNewIdsAndFixRefs)->Arg(10)->Arg(1000);
 
+    //! Measures loading the entities of a slice from an ObjectStream, with the size of the stream as the bytes processed.
+    static void BM_Slice_LoadFromObjectStream(benchmark::State& state, AZ::DataStream::StreamType streamType)
+    {
+        AZ::ComponentApplication componentApp;
+
+        AZ::ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+
+        AZ::ComponentApplication::StartupParameters startupParams;
+        startupParams.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+
+        componentApp.Create(desc, startupParams);
+        AZ::SerializeContext* serializeContext = componentApp.GetSerializeContext();
+
+        UnitTest::MyTestComponent1::Reflect(serializeContext);
+        UnitTest::MyTestComponent2::Reflect(serializeContext);
+
+        AZStd::vector<char> buffer;
+        {
+            AZ::SliceComponent::InstantiatedContainer container;
+            CreateBenchmarkEntities(container, state.range(0));
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+            AZ::Utils::SaveObjectToStream(saveStream, streamType, &container, serializeContext);
+        }
+
+        for (auto _ : state)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> loadStream(&buffer);
+            AZ::SliceComponent::InstantiatedContainer* loadedContainer =
+                AZ::Utils::LoadObjectFromStream<AZ::SliceComponent::InstantiatedContainer>(loadStream, serializeContext);
+
+            state.PauseTiming();
+            delete loadedContainer;
+            state.ResumeTiming();
+        }
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+    }
+    BENCHMARK_CAPTURE(BM_Slice_LoadFromObjectStream, Binary, AZ::DataStream::ST_BINARY)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_CAPTURE(BM_Slice_LoadFromObjectStream, Xml, AZ::DataStream::ST_XML)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
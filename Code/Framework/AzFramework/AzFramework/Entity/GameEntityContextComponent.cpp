@@ -7,6 +7,8 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -18,6 +20,11 @@
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, sys_batchEntityActivation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Activates the entities added to the game entity context as a batch, activating thread safe components on the global job context.");
+    AZ_CVAR(AZ::u32, sys_batchEntityActivationSize, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of entities activated per batch when sys_batchEntityActivation is set. 0 activates all entities as one batch.");
+
     //=========================================================================
     // Reflect
     //=========================================================================
@@ -225,6 +232,37 @@ namespace AzFramework
             }
         }
 
+        if (sys_batchEntityActivation)
+        {
+            AZStd::vector<AZ::Entity*> entitiesToActivate;
+            entitiesToActivate.reserve(entities.size());
+            for (AZ::Entity* entity : entities)
+            {
+                if (entity->GetState() == AZ::Entity::State::Init && entity->IsRuntimeActiveByDefault())
+                {
+                    entitiesToActivate.push_back(entity);
+                }
+            }
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+
+            // Activate in batches so the system events can still be pumped while a large level is loading.
+            const size_t batchSize = sys_batchEntityActivationSize > 0 ? static_cast<size_t>(sys_batchEntityActivationSize) : entitiesToActivate.size();
+            AZStd::vector<AZ::Entity*> batch;
+            batch.reserve(AZStd::min(batchSize, entitiesToActivate.size()));
+            for (size_t batchStart = 0; batchStart < entitiesToActivate.size(); batchStart += batchSize)
+            {
+                const size_t batchEnd = AZStd::min(batchStart + batchSize, entitiesToActivate.size());
+                batch.assign(entitiesToActivate.begin() + batchStart, entitiesToActivate.begin() + batchEnd);
+                AZ::Entity::ActivateEntities(batch, jobContext);
+            #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+                PumpSystemEventsIfNeeded();
+            #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+            }
+            return;
+        }
+
         for (AZ::Entity* entity : entities)
         {
             if (entity->GetState() == AZ::Entity::State::Init)
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
@@ -19,6 +20,9 @@
 
 namespace AzFramework
 {
+    AZ_CVAR_EXTERNED(bool, sys_batchEntityActivation);
+    AZ_CVAR_EXTERNED(AZ::u32, sys_batchEntityActivationSize);
+
     /**
      * System component responsible for owning the game entity context.
      *
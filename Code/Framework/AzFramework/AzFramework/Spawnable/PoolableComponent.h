@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+
+namespace AzFramework
+{
+    //! Optional interface for components that can be reused in place when a parked entity of a pooled spawnable is spawned again.
+    //! Components that only consist of plain data can be spawned by copying a byte image of the reflected data. When such a
+    //! component also implements this interface, the reflected data of a recycled component is restored from the image in place
+    //! instead of replacing the component with a new instance. Init isn't called again, so the component is responsible for
+    //! clearing any state that isn't part of its reflected data in ResetForReuse.
+    //! Add this interface as a base class to the AZ_COMPONENT/AZ_RTTI declaration of the component so it can be found.
+    class PoolableComponent
+    {
+    public:
+        AZ_RTTI(PoolableComponent, "{E0F0228D-F6C5-4909-811A-740DEA0D0BEC}");
+
+        virtual ~PoolableComponent() = default;
+
+        //! Called on a deactivated component after its reflected data has been restored to the values of the spawnable and
+        //!     before its entity is activated again.
+        virtual void ResetForReuse() = 0;
+    };
+} // namespace AzFramework
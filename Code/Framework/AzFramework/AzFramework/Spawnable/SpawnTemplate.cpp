@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Spawnable/PoolableComponent.h>
+#include <AzFramework/Spawnable/SpawnTemplate.h>
+
+namespace AzFramework
+{
+    SpawnTemplate::SpawnTemplate(const Spawnable::EntityList& entities, AZ::SerializeContext& serializeContext)
+        : m_serializeContext(&serializeContext)
+    {
+        m_entities.reserve(entities.size());
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            EntityTemplate& entityTemplate = m_entities.emplace_back();
+            entityTemplate.m_source = entity.get();
+            entityTemplate.m_firstComponent = aznumeric_caster(m_components.size());
+
+            const AZ::Entity::ComponentArrayType& components = entity->GetComponents();
+            entityTemplate.m_componentCount = aznumeric_caster(components.size());
+            for (const AZ::Component* component : components)
+            {
+                AddComponent(*component);
+            }
+        }
+    }
+
+    AZ::Entity* SpawnTemplate::SpawnEntity(size_t entityIndex, EntityIdMap& templateToCloneMap) const
+    {
+        AZ_Assert(entityIndex < m_entities.size(), "Entity index %zu is out of range for spawn template with %zu entities.",
+            entityIndex, m_entities.size());
+
+        const EntityTemplate& entityTemplate = m_entities[entityIndex];
+        const AZ::Entity& source = *entityTemplate.m_source;
+
+        // Matches the behavior of the id generation in AZ::IdUtils::Remapper when duplicate ids are not allowed.
+        const AZ::EntityId entityId = templateToCloneMap.emplace(source.GetId(), AZ::Entity::MakeId()).first->second;
+        AZ::Entity* entity = aznew AZ::Entity(entityId, source.GetName());
+        entity->SetRuntimeActiveByDefault(source.IsRuntimeActiveByDefault());
+
+        for (AZ::u32 i = 0; i < entityTemplate.m_componentCount; ++i)
+        {
+            const ComponentTemplate& componentTemplate = m_components[entityTemplate.m_firstComponent + i];
+            AZ::Component* component = componentTemplate.m_isFastCopy
+                ? CopyComponent(componentTemplate, templateToCloneMap)
+                : CloneComponent(componentTemplate, templateToCloneMap);
+            if (component)
+            {
+                entity->AddComponent(component);
+            }
+        }
+        return entity;
+    }
+
+    void SpawnTemplate::ResetEntity(size_t entityIndex, AZ::Entity& entity, EntityIdMap& templateToCloneMap) const
+    {
+        AZ_Assert(entityIndex < m_entities.size(), "Entity index %zu is out of range for spawn template with %zu entities.",
+            entityIndex, m_entities.size());
+        AZ_Assert(entity.GetState() == AZ::Entity::State::Init, "Entity '%s' needs to be deactivated before it can be reset.",
+            entity.GetName().c_str());
+
+        const EntityTemplate& entityTemplate = m_entities[entityIndex];
+        entity.SetRuntimeActiveByDefault(entityTemplate.m_source->IsRuntimeActiveByDefault());
+
+        // The components were initialized when the entity was first added to the game world and may have changed state that
+        // isn't part of their serialized data since. Only components that can clear that state themselves are reset in place.
+        // Init can't be called a second time, so all other template components are replaced by a fresh instance instead. Adding
+        // the new instance to the initialized entity initializes it.
+        for (AZ::u32 i = 0; i < entityTemplate.m_componentCount; ++i)
+        {
+            const ComponentTemplate& componentTemplate = m_components[entityTemplate.m_firstComponent + i];
+            if (AZ::Component* component = entity.FindComponent(componentTemplate.m_source->GetId()))
+            {
+                if (ResetComponent(componentTemplate, *component, templateToCloneMap))
+                {
+                    continue;
+                }
+                entity.RemoveComponent(component);
+                delete component;
+            }
+
+            AZ::Component* component = componentTemplate.m_isFastCopy
+                ? CopyComponent(componentTemplate, templateToCloneMap)
+                : CloneComponent(componentTemplate, templateToCloneMap);
+            if (component)
+            {
+                entity.AddComponent(component);
+            }
+        }
+    }
+
+    size_t SpawnTemplate::GetEntityCount() const
+    {
+        return m_entities.size();
+    }
+
+    size_t SpawnTemplate::GetComponentCount() const
+    {
+        return m_components.size();
+    }
+
+    size_t SpawnTemplate::GetFastCopyComponentCount() const
+    {
+        return m_fastCopyComponentCount;
+    }
+
+    size_t SpawnTemplate::GetImageSize() const
+    {
+        return m_image.size();
+    }
+
+    const AZ::SerializeContext& SpawnTemplate::GetSerializeContext() const
+    {
+        return *m_serializeContext;
+    }
+
+    void SpawnTemplate::AddComponent(const AZ::Component& component)
+    {
+        ComponentTemplate& componentTemplate = m_components.emplace_back();
+        componentTemplate.m_source = &component;
+
+        const AZ::TypeId& typeId = component.RTTI_GetType();
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(typeId);
+        if (!classData || !classData->m_factory || !classData->m_azRtti)
+        {
+            return;
+        }
+
+        const void* componentAddress = component.RTTI_AddressOf(typeId);
+        AZStd::vector<CopyRange> copyRanges;
+        AZStd::vector<AZ::u32> entityIdFixups;
+        if (!CompileComponent(componentAddress, *classData, copyRanges, entityIdFixups))
+        {
+            return;
+        }
+
+        // Merge ranges of members that directly follow each other. Gaps are left alone as they can hold members that
+        // aren't reflected and need to keep the value they got from the constructor.
+        AZStd::sort(copyRanges.begin(), copyRanges.end(),
+            [](const CopyRange& lhs, const CopyRange& rhs) { return lhs.m_offset < rhs.m_offset; });
+
+        componentTemplate.m_classData = classData;
+        componentTemplate.m_imageOffset = m_image.size();
+        componentTemplate.m_firstCopyRange = aznumeric_caster(m_copyRanges.size());
+        for (const CopyRange& range : copyRanges)
+        {
+            if (componentTemplate.m_copyRangeCount > 0)
+            {
+                CopyRange& last = m_copyRanges.back();
+                if (range.m_offset <= last.m_offset + last.m_size)
+                {
+                    last.m_size = AZStd::max(last.m_size, range.m_offset + range.m_size - last.m_offset);
+                    continue;
+                }
+            }
+            m_copyRanges.push_back(range);
+            componentTemplate.m_copyRangeCount++;
+        }
+
+        const AZ::u8* componentBytes = reinterpret_cast<const AZ::u8*>(componentAddress);
+        for (AZ::u32 i = 0; i < componentTemplate.m_copyRangeCount; ++i)
+        {
+            const CopyRange& range = m_copyRanges[componentTemplate.m_firstCopyRange + i];
+            m_image.insert(m_image.end(), componentBytes + range.m_offset, componentBytes + range.m_offset + range.m_size);
+        }
+
+        componentTemplate.m_firstEntityIdFixup = aznumeric_caster(m_entityIdFixups.size());
+        componentTemplate.m_entityIdFixupCount = aznumeric_caster(entityIdFixups.size());
+        m_entityIdFixups.insert(m_entityIdFixups.end(), entityIdFixups.begin(), entityIdFixups.end());
+
+        componentTemplate.m_isFastCopy = true;
+        m_fastCopyComponentCount++;
+    }
+
+    bool SpawnTemplate::CompileComponent(
+        const void* component, const AZ::SerializeContext::ClassData& classData,
+        AZStd::vector<CopyRange>& copyRanges, AZStd::vector<AZ::u32>& entityIdFixups) const
+    {
+        const uintptr_t componentStart = reinterpret_cast<uintptr_t>(component);
+        bool isFastCopy = true;
+
+        auto beginElementCallback = [&](void* instance, const AZ::SerializeContext::ClassData* elementClassData,
+            const AZ::SerializeContext::ClassElement* classElement) -> bool
+        {
+            if (!isFastCopy)
+            {
+                return false;
+            }
+
+            // Anything that isn't stored by value inside the component or that needs to run code to be cloned
+            // can't be represented as a byte image.
+            if (elementClassData->m_container || elementClassData->m_eventHandler || elementClassData->IsDeprecated() ||
+                elementClassData->m_typeId == azrtti_typeid<AZ::DynamicSerializableField>() ||
+                (classElement && (classElement->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER)))
+            {
+                isFastCopy = false;
+                return false;
+            }
+
+            if (!classElement)
+            {
+                // The component itself. Components with a custom serializer are always cloned.
+                isFastCopy = !elementClassData->m_serializer;
+                return isFastCopy;
+            }
+
+            const uintptr_t offset = reinterpret_cast<uintptr_t>(instance) - componentStart;
+            if (elementClassData->m_typeId == azrtti_typeid<AZ::EntityId>())
+            {
+                // Ids that are generated instead of remapped are rare in components, leave those to the regular clone.
+                if (AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, classElement->m_attributes))
+                {
+                    isFastCopy = false;
+                    return false;
+                }
+                entityIdFixups.push_back(aznumeric_caster(offset));
+            }
+
+            if (elementClassData->m_serializer)
+            {
+                if (!IsPlainDataType(*elementClassData))
+                {
+                    isFastCopy = false;
+                    return false;
+                }
+                copyRanges.push_back({ aznumeric_caster(offset), aznumeric_caster(classElement->m_dataSize) });
+                return false;
+            }
+            return true;
+        };
+
+        m_serializeContext->EnumerateInstanceConst(
+            component, classData.m_typeId, beginElementCallback, nullptr, AZ::SerializeContext::ENUM_ACCESS_FOR_READ, &classData,
+            nullptr);
+        return isFastCopy;
+    }
+
+    bool SpawnTemplate::IsPlainDataType(const AZ::SerializeContext::ClassData& classData) const
+    {
+        if (classData.m_azRtti)
+        {
+            // Integral, floating point and enum types.
+            const AZ::TypeTraits traits = classData.m_azRtti->GetTypeTraits();
+            if ((traits & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned | AZ::TypeTraits::is_enum)) != AZ::TypeTraits{ 0 })
+            {
+                return true;
+            }
+        }
+
+        static const AZ::TypeId plainDataTypes[] =
+        {
+            azrtti_typeid<AZ::Uuid>(),
+            azrtti_typeid<AZ::Vector2>(),
+            azrtti_typeid<AZ::Vector3>(),
+            azrtti_typeid<AZ::Vector4>(),
+            azrtti_typeid<AZ::Quaternion>(),
+            azrtti_typeid<AZ::Color>(),
+            azrtti_typeid<AZ::Transform>(),
+            azrtti_typeid<AZ::Matrix3x3>(),
+            azrtti_typeid<AZ::Matrix3x4>(),
+            azrtti_typeid<AZ::Matrix4x4>()
+        };
+        return AZStd::find(AZStd::begin(plainDataTypes), AZStd::end(plainDataTypes), classData.m_typeId) != AZStd::end(plainDataTypes);
+    }
+
+    AZ::Component* SpawnTemplate::CopyComponent(const ComponentTemplate& componentTemplate, const EntityIdMap& templateToCloneMap) const
+    {
+        const AZ::SerializeContext::ClassData* classData = componentTemplate.m_classData;
+        void* instance = classData->m_factory->Create(classData->m_name);
+        if (!instance)
+        {
+            return nullptr;
+        }
+
+        ApplyImage(componentTemplate, instance, templateToCloneMap);
+        return reinterpret_cast<AZ::Component*>(classData->m_azRtti->Cast(instance, azrtti_typeid<AZ::Component>()));
+    }
+
+    void SpawnTemplate::ApplyImage(const ComponentTemplate& componentTemplate, void* instance, const EntityIdMap& templateToCloneMap) const
+    {
+        AZ::u8* componentBytes = reinterpret_cast<AZ::u8*>(instance);
+        const AZ::u8* image = m_image.data() + componentTemplate.m_imageOffset;
+        for (AZ::u32 i = 0; i < componentTemplate.m_copyRangeCount; ++i)
+        {
+            const CopyRange& range = m_copyRanges[componentTemplate.m_firstCopyRange + i];
+            memcpy(componentBytes + range.m_offset, image, range.m_size);
+            image += range.m_size;
+        }
+
+        for (AZ::u32 i = 0; i < componentTemplate.m_entityIdFixupCount; ++i)
+        {
+            AZ::EntityId& entityId =
+                *reinterpret_cast<AZ::EntityId*>(componentBytes + m_entityIdFixups[componentTemplate.m_firstEntityIdFixup + i]);
+            if (auto it = templateToCloneMap.find(entityId); it != templateToCloneMap.end())
+            {
+                entityId = it->second;
+            }
+        }
+    }
+
+    bool SpawnTemplate::ResetComponent(
+        const ComponentTemplate& componentTemplate, AZ::Component& component, const EntityIdMap& templateToCloneMap) const
+    {
+        if (!componentTemplate.m_isFastCopy || component.RTTI_GetType() != componentTemplate.m_classData->m_typeId)
+        {
+            return false;
+        }
+
+        PoolableComponent* poolableComponent = azrtti_cast<PoolableComponent*>(&component);
+        if (!poolableComponent)
+        {
+            return false;
+        }
+
+        ApplyImage(componentTemplate, component.RTTI_AddressOf(componentTemplate.m_classData->m_typeId), templateToCloneMap);
+        poolableComponent->ResetForReuse();
+        return true;
+    }
+
+    AZ::Component* SpawnTemplate::CloneComponent(const ComponentTemplate& componentTemplate, EntityIdMap& templateToCloneMap) const
+    {
+        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
+        constexpr bool allowDuplicateIds = false;
+
+        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
+            componentTemplate.m_source, templateToCloneMap, m_serializeContext);
+    }
+} // namespace AzFramework
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+
+namespace AZ
+{
+    class Component;
+    class Entity;
+}
+
+namespace AzFramework
+{
+    //! Precompiled representation of the entities in a spawnable that's used to quickly create new instances of them.
+    //! The template is built once by walking the reflected data of every component. Components that only consist of plain
+    //! data, such as numbers, enums, math types and entity ids stored by value, are stored as a flat byte image together
+    //! with the offsets of the entity ids that need to be remapped. Spawning these components costs a default construction,
+    //! a few memory copies and the entity id fixups instead of a full reflection based clone.
+    //! Components that hold containers, pointers, strings, assets or that need serialization events fall back to being cloned
+    //! through the Serialize Context.
+    //! The template refers to the entities in the spawnable it was built from so it needs to be rebuilt if those change.
+    class SpawnTemplate final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnTemplate, AZ::SystemAllocator, 0);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        SpawnTemplate(const Spawnable::EntityList& entities, AZ::SerializeContext& serializeContext);
+        SpawnTemplate(const SpawnTemplate& rhs) = delete;
+        SpawnTemplate& operator=(const SpawnTemplate& rhs) = delete;
+
+        //! Creates a new instance of the template entity at the given index.
+        //! Entity ids found in templateToCloneMap are replaced with the mapped ids. If the id of the template entity isn't
+        //! in the map yet, a new id is generated and added to the map.
+        AZ::Entity* SpawnEntity(size_t entityIndex, EntityIdMap& templateToCloneMap) const;
+        //! Resets a previously spawned instance of the template entity at the given index back to the state of the template so
+        //! it can be reused. The entity needs to be deactivated. Fast copy components implementing PoolableComponent get their
+        //! reflected data restored in place. All other components of the template are replaced by new instances, which are
+        //! initialized as they're added to the entity. Components that were added to the entity after it was spawned are left
+        //! untouched.
+        void ResetEntity(size_t entityIndex, AZ::Entity& entity, EntityIdMap& templateToCloneMap) const;
+
+        size_t GetEntityCount() const;
+        //! Returns the total number of components in the template.
+        size_t GetComponentCount() const;
+        //! Returns the number of components that can be spawned by copying their byte image.
+        size_t GetFastCopyComponentCount() const;
+        //! Returns the size in bytes of the byte image of all fast copy components.
+        size_t GetImageSize() const;
+        const AZ::SerializeContext& GetSerializeContext() const;
+
+    private:
+        struct CopyRange
+        {
+            AZ::u32 m_offset; //!< Offset from the start of the component.
+            AZ::u32 m_size;
+        };
+
+        struct ComponentTemplate
+        {
+            const AZ::Component* m_source{ nullptr };
+            const AZ::SerializeContext::ClassData* m_classData{ nullptr };
+            size_t m_imageOffset{ 0 };
+            AZ::u32 m_firstCopyRange{ 0 };
+            AZ::u32 m_copyRangeCount{ 0 };
+            AZ::u32 m_firstEntityIdFixup{ 0 };
+            AZ::u32 m_entityIdFixupCount{ 0 };
+            bool m_isFastCopy{ false };
+        };
+
+        struct EntityTemplate
+        {
+            const AZ::Entity* m_source{ nullptr };
+            AZ::u32 m_firstComponent{ 0 };
+            AZ::u32 m_componentCount{ 0 };
+        };
+
+        void AddComponent(const AZ::Component& component);
+        bool CompileComponent(
+            const void* component, const AZ::SerializeContext::ClassData& classData,
+            AZStd::vector<CopyRange>& copyRanges, AZStd::vector<AZ::u32>& entityIdFixups) const;
+        bool IsPlainDataType(const AZ::SerializeContext::ClassData& classData) const;
+
+        AZ::Component* CopyComponent(const ComponentTemplate& componentTemplate, const EntityIdMap& templateToCloneMap) const;
+        //! Writes the byte image of the component template to the instance and remaps the entity ids in it.
+        void ApplyImage(const ComponentTemplate& componentTemplate, void* instance, const EntityIdMap& templateToCloneMap) const;
+        //! Restores the reflected data of a component in place if it's a fast copy component implementing PoolableComponent.
+        bool ResetComponent(const ComponentTemplate& componentTemplate, AZ::Component& component, const EntityIdMap& templateToCloneMap) const;
+        AZ::Component* CloneComponent(const ComponentTemplate& componentTemplate, EntityIdMap& templateToCloneMap) const;
+
+        AZStd::vector<EntityTemplate> m_entities;
+        AZStd::vector<ComponentTemplate> m_components;
+        AZStd::vector<CopyRange> m_copyRanges;
+        //! Offsets of the entity ids from the start of their fast copy component.
+        AZStd::vector<AZ::u32> m_entityIdFixups;
+        //! The reflected data of all fast copy components, stored back to back in the order of m_copyRanges.
+        AZStd::vector<AZ::u8> m_image;
+        AZ::SerializeContext* m_serializeContext;
+        size_t m_fastCopyComponentCount{ 0 };
+    };
+} // namespace AzFramework
@@ -7,7 +7,9 @@
 
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnTemplate.h>
 
 namespace AzFramework
 {
@@ -16,6 +18,8 @@ namespace AzFramework
     {
     }
 
+    Spawnable::~Spawnable() = default;
+
     const Spawnable::EntityList& Spawnable::GetEntities() const
     {
         return m_entities;
@@ -23,6 +27,7 @@ namespace AzFramework
 
     Spawnable::EntityList& Spawnable::GetEntities()
     {
+        InvalidateSpawnTemplate();
         return m_entities;
     }
 
@@ -31,6 +36,22 @@ namespace AzFramework
         return m_entities.empty();
     }
 
+    const SpawnTemplate& Spawnable::GetSpawnTemplate(AZ::SerializeContext& serializeContext) const
+    {
+        AZStd::scoped_lock lock(m_spawnTemplateMutex);
+        if (!m_spawnTemplate || &m_spawnTemplate->GetSerializeContext() != &serializeContext)
+        {
+            m_spawnTemplate = AZStd::make_unique<SpawnTemplate>(m_entities, serializeContext);
+        }
+        return *m_spawnTemplate;
+    }
+
+    void Spawnable::InvalidateSpawnTemplate()
+    {
+        AZStd::scoped_lock lock(m_spawnTemplateMutex);
+        m_spawnTemplate.reset();
+    }
+
     SpawnableMetaData& Spawnable::GetMetaData()
     {
         return m_metaData;
@@ -11,16 +11,20 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
 {
+    class SpawnTemplate;
+
     class Spawnable final
         : public AZ::Data::AssetData
     {
@@ -37,15 +41,23 @@ namespace AzFramework
         explicit Spawnable(const AZ::Data::AssetId& id, AssetStatus status = AssetStatus::NotLoaded);
         Spawnable(const Spawnable& rhs) = delete;
         Spawnable(Spawnable&& other) = delete;
-        ~Spawnable() override = default;
+        ~Spawnable() override;
 
         Spawnable& operator=(const Spawnable& rhs) = delete;
         Spawnable& operator=(Spawnable&& other) = delete;
 
         const EntityList& GetEntities() const;
+        //! Returns the entities for modification. This discards the spawn template, so entities shouldn't be modified through
+        //! a previously retrieved list after new instances have been spawned.
         EntityList& GetEntities();
         bool IsEmpty() const;
 
+        //! Returns the precompiled template used to spawn instances of the entities, building it on first use or when the
+        //! Serialize Context differs from the one the template was built with.
+        const SpawnTemplate& GetSpawnTemplate(AZ::SerializeContext& serializeContext) const;
+        //! Discards the spawn template so it will be rebuilt the next time it's requested.
+        void InvalidateSpawnTemplate();
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -57,6 +69,10 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+
+        // Template built from m_entities on demand to speed up spawning.
+        mutable AZStd::unique_ptr<SpawnTemplate> m_spawnTemplate;
+        mutable AZStd::mutex m_spawnTemplateMutex;
     };
 
     using SpawnableList = AZStd::vector<Spawnable>;
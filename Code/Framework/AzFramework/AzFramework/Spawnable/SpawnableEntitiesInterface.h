@@ -240,6 +240,24 @@ namespace AzFramework
         SpawnablePriority m_priority{ SpawnablePriority_Default };
     };
 
+    struct EntityPoolSettings final
+    {
+        //! The number of instances of every entity in the spawnable that are created up front, the first time the spawnable is
+        //!     spawned after pooling has been enabled. Warmed up instances are added to the game world deactivated.
+        AZ::u32 m_warmUpCount{ 0 };
+        //! The maximum number of deactivated instances that are kept for every entity in the spawnable. Entities that are despawned
+        //!     while the pool is full are destroyed.
+        AZ::u32 m_capacity{ 16 };
+    };
+
+    struct EntityPoolStatistics final
+    {
+        AZ::u64 m_hits{ 0 }; //!< The number of spawned entities that reused a parked entity.
+        AZ::u64 m_misses{ 0 }; //!< The number of spawned entities that had to be created because no parked entity was available.
+        AZ::u64 m_discarded{ 0 }; //!< The number of despawned entities that were destroyed because the pool was full.
+        AZ::u64 m_parked{ 0 }; //!< The number of entities that are currently parked in the pool.
+    };
+
     //! Interface definition to (de)spawn entities from a spawnable into the game world.
     //! 
     //! While the callbacks of the individual calls are being processed they will block processing any other request. Callbacks can be
@@ -319,6 +337,24 @@ namespace AzFramework
         //! @param optionalArgs Optional additional arguments, see BarrierOptionalArgs.
         virtual void Barrier(EntitySpawnTicket& ticket, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs = {}) = 0;
 
+        //! Enables recycling of the entities spawned from the spawnable with the provided asset id. Instead of being destroyed,
+        //!     despawned entities are deactivated and parked with their components intact. The next time the same template entity is
+        //!     spawned, the components of a parked entity are reset to the template and the entity is activated again. Components
+        //!     implementing PoolableComponent are reset in place, all others are replaced by new instances from the template.
+        //!     Parked entities keep their entity id and stay in the game world while deactivated, but listeners of the game entity
+        //!     context are notified as if they were destroyed when they're parked and created when they're recycled. Entities that
+        //!     are recycled have already been initialized when they're passed to the pre-insertion callback.
+        //!     Calling this function for a spawnable that's already pooled updates the settings of the pool.
+        //! @param spawnableId The asset id of the spawnable to enable pooling for.
+        //! @param settings The warm-up and capacity of the pool, see EntityPoolSettings.
+        virtual void EnableEntityPooling(const AZ::Data::AssetId& spawnableId, EntityPoolSettings settings = {}) = 0;
+        //! Disables recycling of the entities spawned from the spawnable with the provided asset id. Parked entities are destroyed.
+        //! @param spawnableId The asset id of the spawnable to disable pooling for.
+        virtual void DisableEntityPooling(const AZ::Data::AssetId& spawnableId) = 0;
+        //! Returns the usage statistics of the pool of the spawnable with the provided asset id. If the spawnable isn't pooled, all
+        //!     values will be zero.
+        virtual EntityPoolStatistics GetEntityPoolStatistics(const AZ::Data::AssetId& spawnableId) const = 0;
+
     protected:
         [[nodiscard]] virtual AZStd::pair<EntitySpawnTicket::Id, void*> CreateTicket(AZ::Data::Asset<Spawnable>&& spawnable) = 0;
         virtual void DestroyTicket(void* ticket) = 0;
@@ -16,6 +16,7 @@
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+#include <AzFramework/Spawnable/SpawnTemplate.h>
 
 namespace AzFramework
 {
@@ -42,6 +43,8 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            settingsRegistry->Get(m_useSpawnTemplates, "/O3DE/AzFramework/Spawnables/UseSpawnTemplates");
         }
     }
 
@@ -145,8 +148,56 @@ namespace AzFramework
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
+    void SpawnableEntitiesManager::EnableEntityPooling(const AZ::Data::AssetId& spawnableId, EntityPoolSettings settings)
+    {
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        EntityPool& pool = m_entityPools[spawnableId];
+        pool.m_settings = settings;
+
+        // If the capacity was lowered, discard the parked entities that no longer fit.
+        for (AZStd::vector<AZ::EntityId>& parkedEntities : pool.m_parkedEntities)
+        {
+            while (parkedEntities.size() > settings.m_capacity)
+            {
+                m_discardedEntities.push_back(parkedEntities.back());
+                parkedEntities.pop_back();
+                pool.m_statistics.m_discarded++;
+            }
+        }
+    }
+
+    void SpawnableEntitiesManager::DisableEntityPooling(const AZ::Data::AssetId& spawnableId)
+    {
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        if (auto it = m_entityPools.find(spawnableId); it != m_entityPools.end())
+        {
+            for (const AZStd::vector<AZ::EntityId>& parkedEntities : it->second.m_parkedEntities)
+            {
+                m_discardedEntities.insert(m_discardedEntities.end(), parkedEntities.begin(), parkedEntities.end());
+            }
+            m_entityPools.erase(it);
+        }
+    }
+
+    EntityPoolStatistics SpawnableEntitiesManager::GetEntityPoolStatistics(const AZ::Data::AssetId& spawnableId) const
+    {
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        if (auto it = m_entityPools.find(spawnableId); it != m_entityPools.end())
+        {
+            EntityPoolStatistics statistics = it->second.m_statistics;
+            for (const AZStd::vector<AZ::EntityId>& parkedEntities : it->second.m_parkedEntities)
+            {
+                statistics.m_parked += parkedEntities.size();
+            }
+            return statistics;
+        }
+        return {};
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(CommandQueuePriority priority) -> CommandQueueStatus
     {
+        DestroyDiscardedEntities();
+
         CommandQueueStatus result = CommandQueueStatus::NoCommandsLeft;
         if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
         {
@@ -252,36 +303,344 @@ namespace AzFramework
                 &entityTemplate, templateToCloneMap, &serializeContext);
     }
 
+    AZ::Entity* SpawnableEntitiesManager::CreateSingleEntity(
+        const Spawnable::EntityList& entities, const SpawnTemplate* spawnTemplate, size_t entityIndex,
+        EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        return spawnTemplate
+            ? spawnTemplate->SpawnEntity(entityIndex, templateToCloneMap)
+            : CloneSingleEntity(*entities[entityIndex], templateToCloneMap, serializeContext);
+    }
+
+    AZ::Entity* SpawnableEntitiesManager::SpawnSingleEntity(
+        Ticket& ticket, const Spawnable& spawnable, const SpawnTemplate* spawnTemplate, size_t entityIndex,
+        EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        const Spawnable::EntityList& entities = spawnable.GetEntities();
+        if (!ticket.m_reservedEntities.empty())
+        {
+            auto idIt = templateToCloneMap.find(entities[entityIndex]->GetId());
+            if (idIt != templateToCloneMap.end())
+            {
+                if (auto reservedIt = ticket.m_reservedEntities.find(idIt->second); reservedIt != ticket.m_reservedEntities.end())
+                {
+                    ticket.m_reservedEntities.erase(reservedIt);
+
+                    AZ::Entity* entity = nullptr;
+                    AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationBus::Events::FindEntity, idIt->second);
+                    if (entity && entity->GetState() == AZ::Entity::State::Active)
+                    {
+                        // Something activated the entity while it was parked.
+                        GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DeactivateGameEntity, entity->GetId());
+                    }
+                    if (entity && entity->GetState() == AZ::Entity::State::Init)
+                    {
+                        spawnable.GetSpawnTemplate(serializeContext).ResetEntity(entityIndex, *entity, templateToCloneMap);
+                        return entity;
+                    }
+                    // The parked entity has been destroyed in the meantime, so its id is free to be used by a new entity.
+                }
+            }
+        }
+        return CreateSingleEntity(entities, spawnTemplate, entityIndex, templateToCloneMap, serializeContext);
+    }
+
+    const SpawnTemplate* SpawnableEntitiesManager::GetSpawnTemplate(
+        const Spawnable& spawnable, AZ::SerializeContext& serializeContext) const
+    {
+        return m_useSpawnTemplates ? &spawnable.GetSpawnTemplate(serializeContext) : nullptr;
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
-        const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
+        Ticket& ticket, const Spawnable::EntityList& entities, const AZStd::vector<size_t>* entityIndicesToSpawn)
     {
+        EntityIdMap& idMap = ticket.m_entityIdReferenceMap;
+        AZStd::unordered_set<AZ::EntityId>& previouslySpawned = ticket.m_previouslySpawned;
+
         // Make sure we don't have any previous data lingering around.
+        ReleaseReservedEntities(ticket);
         idMap.clear();
         previouslySpawned.clear();
 
         idMap.reserve(entities.size());
         previouslySpawned.reserve(entities.size());
 
-        for (auto& entity : entities)
+        // Parked entities of a pooled spawnable are only reserved for the entities that are about to be spawned. The other
+        // entities get a new id, which is only used to fix up references to them.
+        AZStd::vector<bool> isSpawned(entities.size(), entityIndicesToSpawn == nullptr);
+        if (entityIndicesToSpawn)
         {
-            idMap.emplace(entity->GetId(), AZ::Entity::MakeId());
+            for (size_t index : *entityIndicesToSpawn)
+            {
+                if (index < entities.size())
+                {
+                    isSpawned[index] = true;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            idMap.emplace(entities[i]->GetId(), isSpawned[i] ? GenerateEntityId(ticket, i) : AZ::Entity::MakeId());
         }
     }
 
-    void SpawnableEntitiesManager::RefreshEntityIdMapping(
-        const AZ::EntityId& entityId, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
+    void SpawnableEntitiesManager::RefreshEntityIdMapping(Ticket& ticket, const AZ::EntityId& entityId, size_t entityIndex)
     {
-        if (previouslySpawned.contains(entityId))
+        if (ticket.m_previouslySpawned.contains(entityId))
         {
             // This entity has already been spawned at least once before, so we need to generate a new id for it and
             // preserve the new id to fix up any future entity references to this entity.
-            idMap[entityId] = AZ::Entity::MakeId();
+            ticket.m_entityIdReferenceMap[entityId] = GenerateEntityId(ticket, entityIndex);
         }
         else
         {
             // This entity hasn't been spawned yet, so use the first id we've already generated for this entity and mark
             // it as spawned so we know not to reuse this id next time.
-            previouslySpawned.emplace(entityId);
+            ticket.m_previouslySpawned.emplace(entityId);
+        }
+    }
+
+    AZ::EntityId SpawnableEntitiesManager::GenerateEntityId(Ticket& ticket, size_t entityIndex)
+    {
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        if (auto it = m_entityPools.find(ticket.m_spawnable.GetId()); it != m_entityPools.end())
+        {
+            AZStd::vector<AZStd::vector<AZ::EntityId>>& parkedEntities = it->second.m_parkedEntities;
+            if (entityIndex < parkedEntities.size() && !parkedEntities[entityIndex].empty())
+            {
+                const AZ::EntityId entityId = parkedEntities[entityIndex].back();
+                parkedEntities[entityIndex].pop_back();
+                ticket.m_reservedEntities.emplace(entityId, entityIndex);
+                return entityId;
+            }
+        }
+        return AZ::Entity::MakeId();
+    }
+
+    void SpawnableEntitiesManager::ReleaseReservedEntities(Ticket& ticket)
+    {
+        if (ticket.m_reservedEntities.empty())
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        auto poolIt = m_entityPools.find(ticket.m_spawnable.GetId());
+        for (const auto& [entityId, entityIndex] : ticket.m_reservedEntities)
+        {
+            if (poolIt != m_entityPools.end() && entityIndex < poolIt->second.m_parkedEntities.size())
+            {
+                poolIt->second.m_parkedEntities[entityIndex].push_back(entityId);
+            }
+            else
+            {
+                m_discardedEntities.push_back(entityId);
+            }
+        }
+        ticket.m_reservedEntities.clear();
+    }
+
+    void SpawnableEntitiesManager::InsertSpawnedEntities(Ticket& ticket, size_t firstEntityIndex)
+    {
+        AZ::u64 recycledCount = 0;
+        for (auto it = ticket.m_spawnedEntities.begin() + firstEntityIndex; it != ticket.m_spawnedEntities.end(); ++it)
+        {
+            AZ::Entity* entity = *it;
+            if (entity->GetState() == AZ::Entity::State::Constructed)
+            {
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, entity);
+            }
+            else
+            {
+                // Entities recycled from a pool are still part of the game context and only need to be activated again. Listeners
+                // of the game context were told the entity was destroyed when it got parked, so announce it again.
+                recycledCount++;
+                EntityContextEventBus::Event(
+                    GetGameEntityContextId(), &EntityContextEventBus::Events::OnEntityContextCreateEntity, *entity);
+                if (entity->IsRuntimeActiveByDefault())
+                {
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::ActivateGameEntity, entity->GetId());
+                }
+            }
+        }
+
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        if (auto it = m_entityPools.find(ticket.m_spawnable.GetId()); it != m_entityPools.end())
+        {
+            const AZ::u64 spawnedCount = ticket.m_spawnedEntities.size() - firstEntityIndex;
+            it->second.m_statistics.m_hits += recycledCount;
+            it->second.m_statistics.m_misses += spawnedCount - recycledCount;
+        }
+    }
+
+    void SpawnableEntitiesManager::DespawnTicketEntities(Ticket& ticket)
+    {
+        AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
+        AZStd::vector<AZ::Entity*> parkedEntities;
+        {
+            AZStd::scoped_lock lock(m_entityPoolsMutex);
+            if (auto poolIt = m_entityPools.find(ticket.m_spawnable.GetId()); poolIt != m_entityPools.end())
+            {
+                EntityPool& pool = poolIt->second;
+                parkedEntities.reserve(spawnedEntities.size());
+                for (size_t i = 0; i < spawnedEntities.size(); ++i)
+                {
+                    AZ::Entity* entity = spawnedEntities[i];
+                    // Only entities that made it into the game context can be parked.
+                    if (entity == nullptr || entity->GetState() == AZ::Entity::State::Constructed ||
+                        i >= ticket.m_spawnedEntityIndices.size())
+                    {
+                        continue;
+                    }
+
+                    const size_t entityIndex = ticket.m_spawnedEntityIndices[i];
+                    if (entityIndex >= pool.m_parkedEntities.size())
+                    {
+                        pool.m_parkedEntities.resize(entityIndex + 1);
+                    }
+                    AZStd::vector<AZ::EntityId>& parkedEntityIds = pool.m_parkedEntities[entityIndex];
+                    if (parkedEntityIds.size() < pool.m_settings.m_capacity)
+                    {
+                        parkedEntityIds.push_back(entity->GetId());
+                        parkedEntities.push_back(entity);
+                        spawnedEntities[i] = nullptr;
+                    }
+                    else
+                    {
+                        pool.m_statistics.m_discarded++;
+                    }
+                }
+            }
+        }
+
+        // Parked entities stay in the game context while deactivated, but to its listeners they're destroyed like any other
+        // despawned entity.
+        const EntityContextId gameEntityContextId = parkedEntities.empty() ? EntityContextId::CreateNull() : GetGameEntityContextId();
+        for (AZ::Entity* entity : parkedEntities)
+        {
+            if (entity->GetState() == AZ::Entity::State::Active)
+            {
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DeactivateGameEntity, entity->GetId());
+            }
+            EntityContextEventBus::Event(
+                gameEntityContextId, &EntityContextEventBus::Events::OnEntityContextDestroyEntity, entity->GetId());
+        }
+
+        for (AZ::Entity* entity : spawnedEntities)
+        {
+            if (entity != nullptr)
+            {
+                GameEntityContextRequestBus::Broadcast(
+                    &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
+            }
+        }
+
+        spawnedEntities.clear();
+        ticket.m_spawnedEntityIndices.clear();
+    }
+
+    EntityContextId SpawnableEntitiesManager::GetGameEntityContextId()
+    {
+        EntityContextId contextId = EntityContextId::CreateNull();
+        GameEntityContextRequestBus::BroadcastResult(contextId, &GameEntityContextRequestBus::Events::GetGameEntityContextId);
+        return contextId;
+    }
+
+    void SpawnableEntitiesManager::WarmUpEntityPool(
+        const AZ::Data::AssetId& spawnableId, const Spawnable& spawnable, const SpawnTemplate* spawnTemplate,
+        AZ::SerializeContext& serializeContext)
+    {
+        AZ::u32 warmUpCount = 0;
+        {
+            AZStd::scoped_lock lock(m_entityPoolsMutex);
+            auto it = m_entityPools.find(spawnableId);
+            if (it == m_entityPools.end() || it->second.m_isWarmedUp)
+            {
+                return;
+            }
+            it->second.m_isWarmedUp = true;
+            warmUpCount = AZStd::min(it->second.m_settings.m_warmUpCount, it->second.m_settings.m_capacity);
+        }
+
+        const Spawnable::EntityList& entities = spawnable.GetEntities();
+        if (warmUpCount == 0 || entities.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::EntityId> warmedUpEntities;
+        warmedUpEntities.reserve(warmUpCount * entities.size());
+        EntityIdMap idMap;
+        for (AZ::u32 instance = 0; instance < warmUpCount; ++instance)
+        {
+            // Entity references are fixed up again when the entities are reused, so every set of instances can use its own ids.
+            idMap.clear();
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                AZ::Entity* entity = CreateSingleEntity(entities, spawnTemplate, i, idMap, serializeContext);
+                AZ_Assert(entity != nullptr, "Failed to clone spawnable entity.");
+
+                // Only initialize the entity when adding it to the game context. It will be activated when it's reused.
+                entity->SetRuntimeActiveByDefault(false);
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, entity);
+                warmedUpEntities.push_back(entity->GetId());
+            }
+        }
+
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        auto it = m_entityPools.find(spawnableId);
+        if (it == m_entityPools.end())
+        {
+            // Pooling was disabled while warming up.
+            m_discardedEntities.insert(m_discardedEntities.end(), warmedUpEntities.begin(), warmedUpEntities.end());
+            return;
+        }
+
+        EntityPool& pool = it->second;
+        if (pool.m_parkedEntities.size() < entities.size())
+        {
+            pool.m_parkedEntities.resize(entities.size());
+        }
+        for (size_t i = 0; i < warmedUpEntities.size(); ++i)
+        {
+            AZStd::vector<AZ::EntityId>& parkedEntityIds = pool.m_parkedEntities[i % entities.size()];
+            if (parkedEntityIds.size() < pool.m_settings.m_capacity)
+            {
+                parkedEntityIds.push_back(warmedUpEntities[i]);
+            }
+            else
+            {
+                m_discardedEntities.push_back(warmedUpEntities[i]);
+            }
+        }
+    }
+
+    void SpawnableEntitiesManager::FlushEntityPool(const AZ::Data::AssetId& spawnableId)
+    {
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        if (auto it = m_entityPools.find(spawnableId); it != m_entityPools.end())
+        {
+            for (AZStd::vector<AZ::EntityId>& parkedEntities : it->second.m_parkedEntities)
+            {
+                m_discardedEntities.insert(m_discardedEntities.end(), parkedEntities.begin(), parkedEntities.end());
+                parkedEntities.clear();
+            }
+            it->second.m_isWarmedUp = false;
+        }
+    }
+
+    void SpawnableEntitiesManager::DestroyDiscardedEntities()
+    {
+        AZStd::vector<AZ::EntityId> discardedEntities;
+        {
+            AZStd::scoped_lock lock(m_entityPoolsMutex);
+            discardedEntities.swap(m_discardedEntities);
+        }
+
+        for (const AZ::EntityId& entityId : discardedEntities)
+        {
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, entityId);
         }
     }
 
@@ -298,7 +657,9 @@ namespace AzFramework
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
             // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *ticket.m_spawnable;
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
+            const SpawnTemplate* spawnTemplate = GetSpawnTemplate(spawnable, *request.m_serializeContext);
             size_t entitiesToSpawnSize = entitiesToSpawn.size();
 
             // Reserve buffers
@@ -311,14 +672,16 @@ namespace AzFramework
             // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
             // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
             // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-            InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+            WarmUpEntityPool(ticket.m_spawnable.GetId(), spawnable, spawnTemplate, *request.m_serializeContext);
+            InitializeEntityIdMappings(ticket, entitiesToSpawn);
 
             for (size_t i = 0; i < entitiesToSpawnSize; ++i)
             {
                 // If this entity has previously been spawned, give it a new id in the reference map
-                RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                RefreshEntityIdMapping(ticket, entitiesToSpawn[i].get()->GetId(), i);
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                AZ::Entity* clone = SpawnSingleEntity(
+                    ticket, spawnable, spawnTemplate, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                 AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                 spawnedEntities.emplace_back(clone);
@@ -336,10 +699,7 @@ namespace AzFramework
             }
 
             // Add to the game context, now the entities are active
-            for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
-            {
-                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
-            }
+            InsertSpawnedEntities(ticket, spawnedEntitiesInitialCount);
 
             // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
             if (request.m_completionCallback)
@@ -372,9 +732,12 @@ namespace AzFramework
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
             // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *ticket.m_spawnable;
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
+            const SpawnTemplate* spawnTemplate = GetSpawnTemplate(spawnable, *request.m_serializeContext);
             size_t entitiesToSpawnSize = request.m_entityIndices.size();
 
+            WarmUpEntityPool(ticket.m_spawnable.GetId(), spawnable, spawnTemplate, *request.m_serializeContext);
             if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
             {
                 // This map keeps track of ids from template (spawnable) to clone (instance) allowing patch ups of fields referring
@@ -385,7 +748,7 @@ namespace AzFramework
                 // that reference fixups work even when the entity being referenced is spawned in a different SpawnEntities
                 // (or SpawnAllEntities) call.
                 // However, the caller can also choose to reset the map by passing in "m_referencePreviouslySpawnedEntities = false".
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                InitializeEntityIdMappings(ticket, entitiesToSpawn, &request.m_entityIndices);
             }
 
             spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
@@ -396,11 +759,10 @@ namespace AzFramework
                 if (index < entitiesToSpawn.size())
                 {
                     // If this entity has previously been spawned, give it a new id in the reference map
-                    RefreshEntityIdMapping(
-                        entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    RefreshEntityIdMapping(ticket, entitiesToSpawn[index].get()->GetId(), index);
 
-                    AZ::Entity* clone =
-                        CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = SpawnSingleEntity(
+                        ticket, spawnable, spawnTemplate, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     spawnedEntities.push_back(clone);
@@ -417,10 +779,7 @@ namespace AzFramework
             }
 
             // Add to the game context, now the entities are active
-            for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
-            {
-                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
-            }
+            InsertSpawnedEntities(ticket, spawnedEntitiesInitialCount);
 
             if (request.m_completionCallback)
             {
@@ -442,17 +801,9 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (request.m_requestId == ticket.m_currentRequestId)
         {
-            for (AZ::Entity* entity : ticket.m_spawnedEntities)
-            {
-                if (entity != nullptr)
-                {
-                    GameEntityContextRequestBus::Broadcast(
-                        &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
-                }
-            }
-
-            ticket.m_spawnedEntities.clear();
-            ticket.m_spawnedEntityIndices.clear();
+            DespawnTicketEntities(ticket);
+            // Parked entities reserved for entities that weren't spawned go back to the pool, so other tickets can use them.
+            ReleaseReservedEntities(ticket);
 
             if (request.m_completionCallback)
             {
@@ -476,6 +827,10 @@ namespace AzFramework
             "This will likely result in unexpected entities being created.");
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
+            // Parked entities were created from the previous version of the spawnable, so they can't be recycled anymore.
+            ReleaseReservedEntities(ticket);
+            FlushEntityPool(ticket.m_spawnable.GetId());
+
             // Delete the original entities.
             for (AZ::Entity* entity : ticket.m_spawnedEntities)
             {
@@ -488,13 +843,15 @@ namespace AzFramework
 
             // Rebuild the list of entities.
             ticket.m_spawnedEntities.clear();
-            const Spawnable::EntityList& entities = request.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *request.m_spawnable;
+            const Spawnable::EntityList& entities = spawnable.GetEntities();
+            const SpawnTemplate* spawnTemplate = GetSpawnTemplate(spawnable, *request.m_serializeContext);
 
             // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
             // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
             // This map is intentionally cleared out and regenerated here to ensure that we're starting fresh with mappings that
             // match the new set of template entities getting spawned.
-            InitializeEntityIdMappings(entities, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+            InitializeEntityIdMappings(ticket, entities, ticket.m_loadAll ? nullptr : &ticket.m_spawnedEntityIndices);
 
             if (ticket.m_loadAll)
             {
@@ -506,9 +863,10 @@ namespace AzFramework
                 for (size_t i = 0; i < entitiesToSpawnSize; ++i)
                 {
                     // If this entity has previously been spawned, give it a new id in the reference map
-                    RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    RefreshEntityIdMapping(ticket, entities[i].get()->GetId(), i);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = SpawnSingleEntity(
+                        ticket, spawnable, spawnTemplate, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -527,9 +885,10 @@ namespace AzFramework
                     if (index < entitiesSize)
                     {
                         // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                        RefreshEntityIdMapping(ticket, entities[index].get()->GetId(), index);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = SpawnSingleEntity(
+                            ticket, spawnable, spawnTemplate, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
@@ -631,14 +990,8 @@ namespace AzFramework
     {
         if (request.m_requestId == request.m_ticket->m_currentRequestId)
         {
-            for (AZ::Entity* entity : request.m_ticket->m_spawnedEntities)
-            {
-                if (entity != nullptr)
-                {
-                    GameEntityContextRequestBus::Broadcast(
-                        &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
-                }
-            }
+            DespawnTicketEntities(*request.m_ticket);
+            ReleaseReservedEntities(*request.m_ticket);
             delete request.m_ticket;
 
             return true;
@@ -11,9 +11,11 @@
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Entity/EntityContextBus.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace AZ
@@ -24,6 +26,8 @@ namespace AZ
 
 namespace AzFramework
 {
+    class SpawnTemplate;
+
     class SpawnableEntitiesManager
         : public SpawnableEntitiesInterface::Registrar
     {
@@ -68,6 +72,10 @@ namespace AzFramework
 
         void Barrier(EntitySpawnTicket& spawnInfo, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs = {}) override;
 
+        void EnableEntityPooling(const AZ::Data::AssetId& spawnableId, EntityPoolSettings settings = {}) override;
+        void DisableEntityPooling(const AZ::Data::AssetId& spawnableId) override;
+        EntityPoolStatistics GetEntityPoolStatistics(const AZ::Data::AssetId& spawnableId) const override;
+
         //
         // The following function is thread safe but intended to be run from the main thread.
         //
@@ -95,6 +103,9 @@ namespace AzFramework
             //! For this to work, we also need to keep track of whether or not each entity has been spawned at least once, so we know
             //! whether or not to replace the id in the map when spawning a new instance of that entity.
             AZStd::unordered_set<AZ::EntityId> m_previouslySpawned;
+            //! Parked entities from the pool of the spawnable whose ids have been handed out in m_entityIdReferenceMap, mapped to the
+            //! index of their template entity. These are reused instead of creating a new entity when their id gets spawned.
+            AZStd::unordered_map<AZ::EntityId, size_t> m_reservedEntities;
 
             AZStd::vector<AZ::Entity*> m_spawnedEntities;
             AZStd::vector<size_t> m_spawnedEntityIndices;
@@ -174,6 +185,15 @@ namespace AzFramework
             uint32_t m_requestId;
         };
 
+        struct EntityPool
+        {
+            EntityPoolSettings m_settings;
+            EntityPoolStatistics m_statistics;
+            //! Ids of the deactivated entities that are available for reuse, per index of their template entity in the spawnable.
+            AZStd::vector<AZStd::vector<AZ::EntityId>> m_parkedEntities;
+            bool m_isWarmedUp{ false };
+        };
+
         using Requests = AZStd::variant<
             SpawnAllEntitiesCommand, SpawnEntitiesCommand, DespawnAllEntitiesCommand, ReloadSpawnableCommand, ListEntitiesCommand,
             ListIndicesEntitiesCommand, ClaimEntitiesCommand, BarrierCommand, DestroyTicketCommand>;
@@ -194,6 +214,18 @@ namespace AzFramework
 
         AZ::Entity* CloneSingleEntity(
             const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Creates an instance of the entity at the given index in the spawnable. Uses the spawn template if provided and
+        //! otherwise clones the entity through the Serialize Context.
+        AZ::Entity* CreateSingleEntity(
+            const Spawnable::EntityList& entities, const SpawnTemplate* spawnTemplate, size_t entityIndex,
+            EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Returns an instance of the entity at the given index in the spawnable. If a parked entity was reserved for the id the
+        //! entity is mapped to, that entity is reset and returned, otherwise a new entity is created.
+        AZ::Entity* SpawnSingleEntity(
+            Ticket& ticket, const Spawnable& spawnable, const SpawnTemplate* spawnTemplate, size_t entityIndex,
+            EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Returns the spawn template for the spawnable or null if spawn templates are disabled.
+        const SpawnTemplate* GetSpawnTemplate(const Spawnable& spawnable, AZ::SerializeContext& serializeContext) const;
         
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
@@ -209,10 +241,30 @@ namespace AzFramework
         //! Since Entity references get fixed up on an entity-by-entity basis while spawning, it's important to have the complete
         //! set of new IDs available right at the start.  This way, entities that refer to other entities that haven't spawned yet
         //! will still get their references remapped correctly.
+        //! Only the entities at entityIndicesToSpawn can reuse a parked entity of a pooled spawnable. Passing null means all
+        //! entities are about to be spawned.
         void InitializeEntityIdMappings(
-            const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned);
-        void RefreshEntityIdMapping(
-            const AZ::EntityId& entityId, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned);
+            Ticket& ticket, const Spawnable::EntityList& entities, const AZStd::vector<size_t>* entityIndicesToSpawn = nullptr);
+        void RefreshEntityIdMapping(Ticket& ticket, const AZ::EntityId& entityId, size_t entityIndex);
+
+        //! Returns the id for a new instance of the template entity at the given index. If the spawnable is pooled and has a parked
+        //! instance of the entity, that instance is reserved for the ticket and its id is returned.
+        AZ::EntityId GenerateEntityId(Ticket& ticket, size_t entityIndex);
+        //! Returns the reserved entities of the ticket that haven't been spawned to the pool they came from.
+        void ReleaseReservedEntities(Ticket& ticket);
+        //! Adds newly created entities to the game context and activates the entities that were recycled.
+        void InsertSpawnedEntities(Ticket& ticket, size_t firstEntityIndex);
+        //! Removes all spawned entities of the ticket from the game world. Entities are parked if the spawnable is pooled.
+        void DespawnTicketEntities(Ticket& ticket);
+        //! Returns the id of the game entity context, used to notify its listeners about parked and recycled entities.
+        static EntityContextId GetGameEntityContextId();
+        //! Creates the warm-up instances for the pool of the spawnable the first time it's spawned.
+        void WarmUpEntityPool(
+            const AZ::Data::AssetId& spawnableId, const Spawnable& spawnable, const SpawnTemplate* spawnTemplate,
+            AZ::SerializeContext& serializeContext);
+        //! Destroys all parked entities of the pool of the spawnable, for instance because the spawnable has changed.
+        void FlushEntityPool(const AZ::Data::AssetId& spawnableId);
+        void DestroyDiscardedEntities();
 
         Queue m_highPriorityQueue;
         Queue m_regularPriorityQueue;
@@ -223,6 +275,15 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! If true, entities are spawned from the precompiled spawn template of a spawnable instead of being cloned through the
+        //! Serialize Context. This can be configured through the Settings Registry under the key
+        //! "/O3DE/AzFramework/Spawnables/UseSpawnTemplates".
+        bool m_useSpawnTemplates { true };
+
+        AZStd::unordered_map<AZ::Data::AssetId, EntityPool> m_entityPools;
+        //! Parked entities that are no longer needed by their pool and will be destroyed during the next call to ProcessQueue.
+        AZStd::vector<AZ::EntityId> m_discardedEntities;
+        mutable AZStd::mutex m_entityPoolsMutex;
     };
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AzFramework::SpawnableEntitiesManager::CommandQueuePriority);
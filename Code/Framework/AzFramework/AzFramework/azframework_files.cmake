@@ -281,6 +281,7 @@ set(FILES
     Render/Intersector.cpp
     Render/Intersector.h
     Render/IntersectorInterface.h
+    Spawnable/PoolableComponent.h
     Spawnable/RootSpawnableInterface.h
     Spawnable/Spawnable.cpp
     Spawnable/Spawnable.h
@@ -298,6 +299,8 @@ set(FILES
     Spawnable/SpawnableMonitor.cpp
     Spawnable/SpawnableSystemComponent.h
     Spawnable/SpawnableSystemComponent.cpp
+    Spawnable/SpawnTemplate.h
+    Spawnable/SpawnTemplate.cpp
     Terrain/TerrainDataRequestBus.h
     Terrain/TerrainDataRequestBus.cpp
     Thermal/ThermalInfo.h
@@ -158,44 +158,59 @@ namespace AzToolsFramework
 
         bool Link::UpdateTarget()
         {
-            PrefabDomValue& linkedInstanceDom = GetLinkedInstanceDom();
-            PrefabDom& targetTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_targetTemplateId);
-            PrefabDom& sourceTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_sourceTemplateId);
+            PrefabDom patchedSourceTemplateDom;
+            const bool isPatched = GetPatchedSourceTemplateDom(patchedSourceTemplateDom);
+            UpdateLinkedInstanceDom(patchedSourceTemplateDom);
+            return isPatched;
+        }
 
-            // Copy the source template dom so that the actual template DOM does not change and only the linked instance DOM does.
-            PrefabDom sourceTemplateDomCopy;
-            sourceTemplateDomCopy.CopyFrom(sourceTemplatePrefabDom, sourceTemplatePrefabDom.GetAllocator());
+        bool Link::GetPatchedSourceTemplateDom(PrefabDom& patchedSourceTemplateDom) const
+        {
+            const PrefabDom& sourceTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_sourceTemplateId);
 
-            PrefabDomValueReference patchesReference = PrefabDomUtils::FindPrefabDomValue(m_linkDom, PrefabDomUtils::PatchesName);
+            PrefabDomValueConstReference patchesReference = PrefabDomUtils::FindPrefabDomValue(m_linkDom, PrefabDomUtils::PatchesName);
             if (!patchesReference.has_value())
             {
-                if (AZ::JsonSerialization::Compare(linkedInstanceDom, sourceTemplateDomCopy) != AZ::JsonSerializerCompareResult::Equal)
-                {
-                    linkedInstanceDom.CopyFrom(sourceTemplateDomCopy, targetTemplatePrefabDom.GetAllocator());
-                }
+                patchedSourceTemplateDom.CopyFrom(sourceTemplatePrefabDom, patchedSourceTemplateDom.GetAllocator());
+                return true;
             }
-            else
+
+            // Patch a copy of the source template dom so that the actual template DOM does not change.
+            AZ::JsonSerializationResult::ResultCode applyPatchResult = AZ::JsonSerialization::ApplyPatch(
+                patchedSourceTemplateDom,
+                patchedSourceTemplateDom.GetAllocator(),
+                sourceTemplatePrefabDom,
+                patchesReference->get(),
+                AZ::JsonMergeApproach::JsonPatch);
+            if (applyPatchResult.GetProcessing() != AZ::JsonSerializationResult::Processing::Completed)
             {
-                AZ::JsonSerializationResult::ResultCode applyPatchResult = AZ::JsonSerialization::ApplyPatch(
-                    sourceTemplateDomCopy,
-                    targetTemplatePrefabDom.GetAllocator(),
-                    patchesReference->get(),
-                    AZ::JsonMergeApproach::JsonPatch);
-                linkedInstanceDom.CopyFrom(sourceTemplateDomCopy, targetTemplatePrefabDom.GetAllocator());
-                if (applyPatchResult.GetProcessing() != AZ::JsonSerializationResult::Processing::Completed)
-                {
-                    AZ_Error(
-                        "Prefab", false,
-                        "Link::UpdateTarget - ApplyPatches failed for Prefab DOM from source Template '%u' and target Template '%u'.",
-                        m_sourceTemplateId, m_targetTemplateId);
-                    return false;
-                }
+                AZ_Error(
+                    "Prefab", false,
+                    "Link::UpdateTarget - ApplyPatches failed for Prefab DOM from source Template '%u' and target Template '%u'.",
+                    m_sourceTemplateId, m_targetTemplateId);
+                return false;
             }
+            return true;
+        }
+
+        bool Link::UpdateLinkedInstanceDom(const PrefabDomValue& patchedSourceTemplateDom)
+        {
+            PrefabDomValue& linkedInstanceDom = GetLinkedInstanceDom();
+            PrefabDom& targetTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_targetTemplateId);
+
+            // The LinkId isn't part of the source template so leave it alone, which keeps it in place when nothing else changed.
+            bool isUpdated = PrefabDomUtils::UpdatePrefabDomValue(
+                linkedInstanceDom, patchedSourceTemplateDom, targetTemplatePrefabDom.GetAllocator(), PrefabDomUtils::LinkIdName);
 
             // This is a guardrail to ensure the linked instance dom always has the LinkId value
             // in case the template copy or the patch application removed it.
-            AddLinkIdToInstanceDom(linkedInstanceDom, targetTemplatePrefabDom.GetAllocator());
-            return true;
+            PrefabDomValueReference linkIdReference = PrefabDomUtils::FindPrefabDomValue(linkedInstanceDom, PrefabDomUtils::LinkIdName);
+            if (!linkIdReference.has_value() || !linkIdReference->get().IsUint64() || linkIdReference->get().GetUint64() != m_id)
+            {
+                AddLinkIdToInstanceDom(linkedInstanceDom, targetTemplatePrefabDom.GetAllocator());
+                isUpdated = true;
+            }
+            return isUpdated;
         }
 
         PrefabDomValue& Link::GetLinkedInstanceDom()
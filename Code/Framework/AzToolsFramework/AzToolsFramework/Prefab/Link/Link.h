@@ -60,6 +60,24 @@ namespace AzToolsFramework
 
             bool UpdateTarget();
 
+            /**
+             * Applies the patches of the link to a copy of the source template DOM, resulting in the DOM the linked instance
+             * should have.
+             * 
+             * @param patchedSourceTemplateDom The DOM that receives the patched copy of the source template DOM.
+             * @return False if the patches couldn't be fully applied, otherwise true.
+             */
+            bool GetPatchedSourceTemplateDom(PrefabDom& patchedSourceTemplateDom) const;
+
+            /**
+             * Updates the DOM of the linked instance in the target template to match the given patched source template DOM.
+             * Only the parts of the linked instance DOM that differ are written.
+             * 
+             * @param patchedSourceTemplateDom The patched source template DOM as produced by GetPatchedSourceTemplateDom.
+             * @return True if the linked instance DOM was changed, otherwise false.
+             */
+            bool UpdateLinkedInstanceDom(const PrefabDomValue& patchedSourceTemplateDom);
+
             /**
              * Get the DOM of the instance that the link points to.
              * 
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/hash.h>
+#include <AzToolsFramework/Prefab/Link/PatchedTemplateDomCache.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        namespace Internal
+        {
+            size_t HashPrefabDomValue(const PrefabDomValue& value)
+            {
+                size_t hash = static_cast<size_t>(value.GetType());
+                switch (value.GetType())
+                {
+                case rapidjson::kObjectType:
+                {
+                    // Objects compare equal regardless of the order of their members, so the member hashes are combined in a way
+                    // that doesn't depend on the order either.
+                    size_t membersHash = 0;
+                    for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member)
+                    {
+                        size_t memberHash = AZStd::hash<AZStd::string_view>{}(
+                            AZStd::string_view(member->name.GetString(), member->name.GetStringLength()));
+                        AZStd::hash_combine(memberHash, HashPrefabDomValue(member->value));
+                        membersHash += memberHash;
+                    }
+                    AZStd::hash_combine(hash, membersHash);
+                    break;
+                }
+                case rapidjson::kArrayType:
+                    for (const PrefabDomValue& element : value.GetArray())
+                    {
+                        AZStd::hash_combine(hash, HashPrefabDomValue(element));
+                    }
+                    break;
+                case rapidjson::kStringType:
+                    AZStd::hash_combine(hash, AZStd::string_view(value.GetString(), value.GetStringLength()));
+                    break;
+                case rapidjson::kNumberType:
+                    // Integers and doubles with the same value compare equal.
+                    AZStd::hash_combine(hash, value.GetDouble());
+                    break;
+                default:
+                    break;
+                }
+                return hash;
+            }
+        } // namespace Internal
+
+        size_t PatchedTemplateDomCache::HashPatches(const PrefabDomValue* patches)
+        {
+            return patches ? Internal::HashPrefabDomValue(*patches) : 0;
+        }
+
+        void PatchedTemplateDomCache::AddExpectedLink(TemplateId sourceTemplateId, const PrefabDomValue* patches)
+        {
+            const size_t patchesHash = HashPatches(patches);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            Entries& entries = m_entries[sourceTemplateId];
+            auto entry = FindEntry(entries, patchesHash, patches);
+            if (entry == entries.end())
+            {
+                entry = entries.emplace(patchesHash, Entry{ patches, nullptr, 0 });
+            }
+            entry->second.m_remainingLinks++;
+        }
+
+        AZStd::shared_ptr<const PrefabDom> PatchedTemplateDomCache::Find(TemplateId sourceTemplateId, const PrefabDomValue* patches)
+        {
+            const size_t patchesHash = HashPatches(patches);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto entriesIterator = m_entries.find(sourceTemplateId);
+            if (entriesIterator == m_entries.end())
+            {
+                return nullptr;
+            }
+
+            Entries& entries = entriesIterator->second;
+            auto entry = FindEntry(entries, patchesHash, patches);
+            if (entry == entries.end() || !entry->second.m_patchedDom)
+            {
+                return nullptr;
+            }
+
+            AZStd::shared_ptr<const PrefabDom> patchedDom = entry->second.m_patchedDom;
+            ReleaseEntry(entries, entry);
+            return patchedDom;
+        }
+
+        void PatchedTemplateDomCache::Add(
+            TemplateId sourceTemplateId, const PrefabDomValue* patches, AZStd::shared_ptr<const PrefabDom> patchedDom)
+        {
+            const size_t patchesHash = HashPatches(patches);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto entriesIterator = m_entries.find(sourceTemplateId);
+            if (entriesIterator == m_entries.end())
+            {
+                return;
+            }
+
+            Entries& entries = entriesIterator->second;
+            auto entry = FindEntry(entries, patchesHash, patches);
+            if (entry != entries.end())
+            {
+                entry->second.m_patchedDom = AZStd::move(patchedDom);
+                ReleaseEntry(entries, entry);
+            }
+        }
+
+        void PatchedTemplateDomCache::Invalidate(TemplateId sourceTemplateId)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto entriesIterator = m_entries.find(sourceTemplateId);
+            if (entriesIterator != m_entries.end())
+            {
+                // Keep the expected links so the patched DOMs of the updated template can still be shared by the remaining links.
+                for (auto& entry : entriesIterator->second)
+                {
+                    entry.second.m_patchedDom.reset();
+                }
+            }
+        }
+
+        void PatchedTemplateDomCache::Clear()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_entries.clear();
+        }
+
+        PatchedTemplateDomCache::Entries::iterator PatchedTemplateDomCache::FindEntry(
+            Entries& entries, size_t patchesHash, const PrefabDomValue* patches)
+        {
+            // Patches with the same hash are almost always equal, so this is usually a single comparison.
+            auto range = entries.equal_range(patchesHash);
+            for (auto entry = range.first; entry != range.second; ++entry)
+            {
+                const PrefabDomValue* entryPatches = entry->second.m_patches;
+                if (entryPatches == patches || (entryPatches && patches && *entryPatches == *patches))
+                {
+                    return entry;
+                }
+            }
+            return entries.end();
+        }
+
+        void PatchedTemplateDomCache::ReleaseEntry(Entries& entries, Entries::iterator entry)
+        {
+            if (entry->second.m_remainingLinks <= 1)
+            {
+                entries.erase(entry);
+            }
+            else
+            {
+                entry->second.m_remainingLinks--;
+            }
+        }
+    } // namespace Prefab
+} // namespace AzToolsFramework
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
+#include <AzToolsFramework/Prefab/PrefabIdTypes.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        /**
+         * Patched source template DOMs that are shared between links with the same source template and the same patches
+         * while propagating template changes, such as the links of the many instances of a prefab without overrides.
+         * Only patches that more than one link expects to use are cached, and a patched DOM is released as soon as the last of
+         * those links has used it, so links with unique patches never keep a copy of their source template alive.
+         */
+        class PatchedTemplateDomCache
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PatchedTemplateDomCache, AZ::SystemAllocator, 0);
+
+            /**
+             * Registers a link that will be updated, so its patched DOM can be cached if other links use the same patches.
+             * The patches need to outlive the cache.
+             *
+             * @param sourceTemplateId The id of the template the patches are applied to.
+             * @param patches The patches of the link or nullptr if the link has none.
+             */
+            void AddExpectedLink(TemplateId sourceTemplateId, const PrefabDomValue* patches);
+
+            /**
+             * Finds the patched DOM of the given source template and patches. This counts as a use by one of the expected links.
+             *
+             * @param sourceTemplateId The id of the template the patches are applied to.
+             * @param patches The patches of the link or nullptr if the link has none.
+             * @return The patched DOM or nullptr if it's not cached.
+             */
+            AZStd::shared_ptr<const PrefabDom> Find(TemplateId sourceTemplateId, const PrefabDomValue* patches);
+
+            /**
+             * Adds the patched DOM of the given source template and patches after it was created for one of the expected links.
+             * The DOM is only kept if other expected links still need it.
+             */
+            void Add(TemplateId sourceTemplateId, const PrefabDomValue* patches, AZStd::shared_ptr<const PrefabDom> patchedDom);
+
+            /**
+             * Removes all patched DOMs of the given source template, which needs to be called when the template changes.
+             */
+            void Invalidate(TemplateId sourceTemplateId);
+
+            /**
+             * Removes all expected links and patched DOMs.
+             */
+            void Clear();
+
+            /**
+             * Calculates a hash of the patches that's the same for patches that compare equal.
+             */
+            static size_t HashPatches(const PrefabDomValue* patches);
+
+        private:
+            struct Entry
+            {
+                //! The patches of the first link that registered, used to tell apart different patches with the same hash.
+                const PrefabDomValue* m_patches = nullptr;
+                AZStd::shared_ptr<const PrefabDom> m_patchedDom;
+                //! The number of expected links that haven't used the patched DOM yet.
+                size_t m_remainingLinks = 0;
+            };
+
+            using Entries = AZStd::unordered_multimap<size_t, Entry>;
+
+            static Entries::iterator FindEntry(Entries& entries, size_t patchesHash, const PrefabDomValue* patches);
+            //! Counts a use of the entry and removes it once no expected links are left.
+            static void ReleaseEntry(Entries& entries, Entries::iterator entry);
+
+            AZStd::unordered_map<TemplateId, Entries> m_entries;
+            AZStd::mutex m_mutex;
+        };
+    } // namespace Prefab
+} // namespace AzToolsFramework
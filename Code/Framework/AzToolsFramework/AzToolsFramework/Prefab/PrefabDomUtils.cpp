@@ -231,6 +231,116 @@ namespace AzToolsFramework
                 return findInstancesResult->get();
             }
 
+            namespace Internal
+            {
+                bool IsIgnoredMember(const PrefabDomValue::ConstMemberIterator& member, const char* ignoredMemberName)
+                {
+                    return ignoredMemberName && member->name == ignoredMemberName;
+                }
+
+                bool HasSameMembers(const PrefabDomValue& target, const PrefabDomValue& source, const char* ignoredMemberName)
+                {
+                    auto targetMember = target.MemberBegin();
+                    for (auto sourceMember = source.MemberBegin(); sourceMember != source.MemberEnd(); ++sourceMember)
+                    {
+                        if (IsIgnoredMember(sourceMember, ignoredMemberName))
+                        {
+                            continue;
+                        }
+                        while (targetMember != target.MemberEnd() && IsIgnoredMember(targetMember, ignoredMemberName))
+                        {
+                            ++targetMember;
+                        }
+                        if (targetMember == target.MemberEnd() || targetMember->name != sourceMember->name)
+                        {
+                            return false;
+                        }
+                        ++targetMember;
+                    }
+                    while (targetMember != target.MemberEnd() && IsIgnoredMember(targetMember, ignoredMemberName))
+                    {
+                        ++targetMember;
+                    }
+                    return targetMember == target.MemberEnd();
+                }
+            } // namespace Internal
+
+            bool UpdatePrefabDomValue(
+                PrefabDomValue& target, const PrefabDomValue& source, PrefabDom::AllocatorType& allocator, const char* ignoredMemberName)
+            {
+                if (target.IsObject() && source.IsObject())
+                {
+                    if (Internal::HasSameMembers(target, source, ignoredMemberName))
+                    {
+                        bool isUpdated = false;
+                        auto targetMember = target.MemberBegin();
+                        for (auto sourceMember = source.MemberBegin(); sourceMember != source.MemberEnd(); ++sourceMember)
+                        {
+                            if (Internal::IsIgnoredMember(sourceMember, ignoredMemberName))
+                            {
+                                continue;
+                            }
+                            while (Internal::IsIgnoredMember(targetMember, ignoredMemberName))
+                            {
+                                ++targetMember;
+                            }
+                            isUpdated = UpdatePrefabDomValue(targetMember->value, sourceMember->value, allocator) || isUpdated;
+                            ++targetMember;
+                        }
+                        return isUpdated;
+                    }
+
+                    // The layout of the object changed so replace it as a whole, but hold on to the ignored member.
+                    PrefabDomValue ignoredMemberValue;
+                    bool hasIgnoredMember = false;
+                    if (ignoredMemberName)
+                    {
+                        auto ignoredMember = target.FindMember(ignoredMemberName);
+                        if (ignoredMember != target.MemberEnd())
+                        {
+                            ignoredMemberValue = AZStd::move(ignoredMember->value);
+                            hasIgnoredMember = true;
+                        }
+                    }
+
+                    target.CopyFrom(source, allocator);
+                    if (hasIgnoredMember)
+                    {
+                        target.RemoveMember(ignoredMemberName);
+                        target.AddMember(PrefabDomValue(ignoredMemberName, allocator), AZStd::move(ignoredMemberValue), allocator);
+                    }
+                    return true;
+                }
+
+                if (target.IsArray() && source.IsArray())
+                {
+                    bool isUpdated = false;
+                    const rapidjson::SizeType sharedSize = AZStd::min(target.Size(), source.Size());
+                    for (rapidjson::SizeType index = 0; index < sharedSize; ++index)
+                    {
+                        isUpdated = UpdatePrefabDomValue(target[index], source[index], allocator) || isUpdated;
+                    }
+                    while (target.Size() > source.Size())
+                    {
+                        target.PopBack();
+                        isUpdated = true;
+                    }
+                    for (rapidjson::SizeType index = target.Size(); index < source.Size(); ++index)
+                    {
+                        target.PushBack(PrefabDomValue(source[index], allocator), allocator);
+                        isUpdated = true;
+                    }
+                    return isUpdated;
+                }
+
+                if (target != source)
+                {
+                    target.CopyFrom(source, allocator);
+                    return true;
+                }
+                return false;
+            }
+
             void PrintPrefabDomValue(
                 [[maybe_unused]] const AZStd::string_view printMessage,
                 [[maybe_unused]] const PrefabDomValue& prefabDomValue)
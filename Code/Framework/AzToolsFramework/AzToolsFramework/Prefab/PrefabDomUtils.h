@@ -110,6 +110,21 @@ namespace AzToolsFramework
              */
             PrefabDomValueConstReference GetInstancesValue(const PrefabDomValue& prefabDom);
 
+            /**
+             * Updates the target DOM value so it's equal to the source DOM value by only writing the parts that differ.
+             * Objects with the same members in the same order and arrays are updated recursively, so unchanged subtrees
+             * keep their memory and no time is spent copying them. Anything else is copied over when it differs.
+             * @param target The DOM value to update.
+             * @param source The DOM value to make the target equal to.
+             * @param allocator The allocator of the DOM that owns the target.
+             * @param ignoredMemberName Optional name of a member of the top level object of the target that is kept as is,
+             *                          regardless of whether the source contains it.
+             * @return True if the target was changed, otherwise false.
+             */
+            bool UpdatePrefabDomValue(
+                PrefabDomValue& target, const PrefabDomValue& source, PrefabDom::AllocatorType& allocator,
+                const char* ignoredMemberName = nullptr);
+
             /**
              * Prints the contents of the given prefab DOM value to the debug output console in a readable format.
              * @param printMessage The message that will be printed before printing the PrefabDomValue
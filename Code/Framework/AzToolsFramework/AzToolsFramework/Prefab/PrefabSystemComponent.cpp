@@ -8,7 +8,10 @@
 #include <AzToolsFramework/Prefab/PrefabSystemComponent.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityIdMapper.h>
@@ -23,6 +26,10 @@ namespace AzToolsFramework
 {
     namespace Prefab
     {
+        AZ_CVAR(
+            bool, ed_parallelPrefabPropagation, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Update the linked instances of independent prefab templates in parallel while propagating template changes.");
+
         void PrefabSystemComponent::Init()
         {
         }
@@ -174,6 +181,11 @@ namespace AzToolsFramework
 
         void PrefabSystemComponent::UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue)
         {
+            // The patched source template DOMs are only shared between the links of a batch, because the links and templates
+            // can freely change in between propagations.
+            PatchedTemplateDomCache patchedTemplateDomCache;
+            AZStd::vector<AZ::u8> updatedLinkedInstances;
+
             while (!linkIdsQueue.empty())
             {
                 // Fetch the list of linkIds at the head of the queue.
@@ -181,12 +193,37 @@ namespace AzToolsFramework
                 TargetTemplateIdToLinkIdMap targetTemplateIdToLinkIdMap;
                 BucketLinkIdsByTargetTemplateId(LinkIdsToUpdate, targetTemplateIdToLinkIdMap);
 
+                for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
+                {
+                    Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
+                    PrefabDomValueReference patchesReference = linkToUpdate.GetLinkPatches();
+                    patchedTemplateDomCache.AddExpectedLink(
+                        linkToUpdate.GetSourceTemplateId(), patchesReference.has_value() ? &patchesReference->get() : nullptr);
+                }
+
+                const bool isParallelUpdate = CanUpdateLinkedInstancesInParallel(LinkIdsToUpdate, targetTemplateIdToLinkIdMap);
+                if (isParallelUpdate)
+                {
+                    UpdateLinkedInstancesInParallel(
+                        LinkIdsToUpdate, targetTemplateIdToLinkIdMap, patchedTemplateDomCache, updatedLinkedInstances);
+                }
+
                 // Update all the linked instances corresponding to the LinkIds before fetching the next set of linkIds.
                 // This will ensure that templates are updated with changes in the same order they are received.
-                for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
+                for (size_t linkIndex = 0; linkIndex < LinkIdsToUpdate.size(); ++linkIndex)
                 {
-                    UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue);
+                    const LinkId linkIdToUpdate = LinkIdsToUpdate[linkIndex];
+                    Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
+                    const bool isLinkedInstanceUpdated = isParallelUpdate ?
+                        updatedLinkedInstances[linkIndex] != 0 : UpdateLinkedInstance(linkToUpdate, patchedTemplateDomCache);
+                    if (isLinkedInstanceUpdated)
+                    {
+                        // Patched DOMs of the target template are out of date now that one of its instances changed.
+                        patchedTemplateDomCache.Invalidate(linkToUpdate.GetTargetTemplateId());
+                    }
+                    OnLinkedInstanceUpdated(linkIdToUpdate, isLinkedInstanceUpdated, targetTemplateIdToLinkIdMap, linkIdsQueue);
                 }
+                patchedTemplateDomCache.Clear();
                 linkIdsQueue.pop();
             }
         }
@@ -210,21 +247,95 @@ namespace AzToolsFramework
             }
         }
 
-        void PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate,
+        bool PrefabSystemComponent::CanUpdateLinkedInstancesInParallel(const LinkIds& linkIdsToUpdate,
+            const TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap) const
+        {
+            if (!ed_parallelPrefabPropagation || targetTemplateIdToLinkIdMap.size() < 2 || !AZ::JobContext::GetGlobalContext())
+            {
+                return false;
+            }
+
+            for (const LinkId& linkIdToUpdate : linkIdsToUpdate)
+            {
+                auto linkIterator = m_linkIdMap.find(linkIdToUpdate);
+                if (linkIterator == m_linkIdMap.end() ||
+                    targetTemplateIdToLinkIdMap.find(linkIterator->second.GetSourceTemplateId()) != targetTemplateIdToLinkIdMap.end())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void PrefabSystemComponent::UpdateLinkedInstancesInParallel(const LinkIds& linkIdsToUpdate,
+            const TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, PatchedTemplateDomCache& patchedTemplateDomCache,
+            AZStd::vector<AZ::u8>& updatedLinkedInstances)
+        {
+            // Group the links by target template while keeping track of their position in linkIdsToUpdate, so the results can
+            // be processed in the original order afterwards.
+            AZStd::unordered_map<TemplateId, size_t> targetTemplateIdToBucket;
+            AZStd::vector<AZStd::vector<size_t>> buckets;
+            targetTemplateIdToBucket.reserve(targetTemplateIdToLinkIdMap.size());
+            buckets.reserve(targetTemplateIdToLinkIdMap.size());
+            for (size_t linkIndex = 0; linkIndex < linkIdsToUpdate.size(); ++linkIndex)
+            {
+                const TemplateId targetTemplateId = m_linkIdMap.find(linkIdsToUpdate[linkIndex])->second.GetTargetTemplateId();
+                auto bucketIterator = targetTemplateIdToBucket.find(targetTemplateId);
+                if (bucketIterator == targetTemplateIdToBucket.end())
+                {
+                    bucketIterator = targetTemplateIdToBucket.emplace(targetTemplateId, buckets.size()).first;
+                    buckets.emplace_back();
+                }
+                buckets[bucketIterator->second].push_back(linkIndex);
+            }
+
+            updatedLinkedInstances.clear();
+            updatedLinkedInstances.resize(linkIdsToUpdate.size(), 0);
+
+            // Every job only writes to the DOM of its own target template with that template's allocator and only reads from
+            // source templates, none of which are a target in this batch.
+            AZ::parallel_for(size_t(0), buckets.size(),
+                [this, &buckets, &linkIdsToUpdate, &patchedTemplateDomCache, &updatedLinkedInstances](size_t bucketIndex)
+                {
+                    for (size_t linkIndex : buckets[bucketIndex])
+                    {
+                        Link& linkToUpdate = m_linkIdMap.find(linkIdsToUpdate[linkIndex])->second;
+                        updatedLinkedInstances[linkIndex] = UpdateLinkedInstance(linkToUpdate, patchedTemplateDomCache) ? 1 : 0;
+                    }
+                });
+        }
+
+        bool PrefabSystemComponent::UpdateLinkedInstance(Link& linkToUpdate, PatchedTemplateDomCache& patchedTemplateDomCache)
+        {
+            const TemplateId sourceTemplateId = linkToUpdate.GetSourceTemplateId();
+            PrefabDomValueReference patchesReference = linkToUpdate.GetLinkPatches();
+            const PrefabDomValue* patches = patchesReference.has_value() ? &patchesReference->get() : nullptr;
+
+            // The whole source template is patched and then compared against the linked instance, which only writes the subtrees
+            // that differ. Patching only the subtree of the source template that changed would need the propagation to know which
+            // parts of a template changed, which it doesn't track.
+            AZStd::shared_ptr<const PrefabDom> patchedSourceTemplateDom = patchedTemplateDomCache.Find(sourceTemplateId, patches);
+            if (!patchedSourceTemplateDom)
+            {
+                auto newPatchedSourceTemplateDom = AZStd::make_shared<PrefabDom>();
+                // Failed patches aren't shared so every link using them reports the failure.
+                if (linkToUpdate.GetPatchedSourceTemplateDom(*newPatchedSourceTemplateDom))
+                {
+                    patchedTemplateDomCache.Add(sourceTemplateId, patches, newPatchedSourceTemplateDom);
+                }
+                patchedSourceTemplateDom = AZStd::move(newPatchedSourceTemplateDom);
+            }
+
+            return linkToUpdate.UpdateLinkedInstanceDom(*patchedSourceTemplateDom);
+        }
+
+        void PrefabSystemComponent::OnLinkedInstanceUpdated(const LinkId linkIdToUpdate, bool isLinkedInstanceUpdated,
             TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue)
         {
-            Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
-            TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
-            PrefabDomValue& linkdedInstanceDom = linkToUpdate.GetLinkedInstanceDom();
-            PrefabDomValue linkDomBeforeUpdate;
-            linkDomBeforeUpdate.CopyFrom(linkdedInstanceDom, m_templateIdMap[targetTemplateId].GetPrefabDom().GetAllocator());
-            linkToUpdate.UpdateTarget();
-
-            // If any of the templates links are already updated, we don't need to check whether the linkedInstance DOM differs
-            // in content because the template is already marked to be sent for change propagation.
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (isTemplateUpdated ||
-                AZ::JsonSerialization::Compare(linkDomBeforeUpdate, linkdedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
+            TemplateId targetTemplateId = m_linkIdMap[linkIdToUpdate].GetTargetTemplateId();
+
+            // If any of the templates links are already updated, the template is already marked to be sent for change propagation.
+            if (isLinkedInstanceUpdated)
             {
                 targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
             }
@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
@@ -20,6 +21,7 @@
 #include <AzToolsFramework/Prefab/Instance/InstanceToTemplatePropagator.h>
 #include <AzToolsFramework/Prefab/Instance/TemplateInstanceMapper.h>
 #include <AzToolsFramework/Prefab/Link/Link.h>
+#include <AzToolsFramework/Prefab/Link/PatchedTemplateDomCache.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 #include <AzToolsFramework/Prefab/PrefabLoader.h>
 #include <AzToolsFramework/Prefab/PrefabPublicHandler.h>
@@ -42,6 +44,8 @@ namespace AzToolsFramework
         using LinkIds = AZStd::vector<LinkId>;
         using LinkIdSet = AZStd::unordered_set<LinkId>;
 
+        AZ_CVAR_EXTERNED(bool, ed_parallelPrefabPropagation);
+
         /**
         * The prefab system component provides a central point for owning manipulating prefabs.
         */
@@ -225,6 +229,7 @@ namespace AzToolsFramework
             /**
              * Updates all the linked Instances corresponding to the linkIds in the provided queue.
              * Queue gets populated with more linkId lists as linked instances are updated. Updating stops when the queue is empty.
+             * When it's safe to do so, the linked instances of different target templates are updated in parallel.
              * 
              * @param linkIdsQueue A queue of vector of link-Ids to update.
              */
@@ -241,16 +246,50 @@ namespace AzToolsFramework
                 TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap);
 
             /**
-             * Updates a single linked instance corresponding to the given link Id and adds more linkIds to the 
+             * Checks whether the linked instances of the given links can be updated in parallel. This is the case when there's
+             * more than one target template and none of the target templates is also the source template of one of the links,
+             * so every target template DOM is only written by a single job and none of them is read by another.
+             * 
+             * @param linkIdsToUpdate The list of link ids to update.
+             * @param targetTemplateIdToLinkIdMap The link ids to update bucketed by their target template id.
+             * @return True if the linked instances can be updated in parallel, otherwise false.
+             */
+            bool CanUpdateLinkedInstancesInParallel(const LinkIds& linkIdsToUpdate,
+                const TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap) const;
+
+            /**
+             * Updates the linked instances of the given links, updating the instances of every target template in a separate job.
+             * 
+             * @param linkIdsToUpdate The list of link ids to update.
+             * @param targetTemplateIdToLinkIdMap The link ids to update bucketed by their target template id.
+             * @param patchedTemplateDomCache The patched source template DOMs shared by the links.
+             * @param[out] updatedLinkedInstances For each link, in the same order as linkIdsToUpdate, whether its linked instance DOM changed.
+             */
+            void UpdateLinkedInstancesInParallel(const LinkIds& linkIdsToUpdate,
+                const TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, PatchedTemplateDomCache& patchedTemplateDomCache,
+                AZStd::vector<AZ::u8>& updatedLinkedInstances);
+
+            /**
+             * Updates the DOM of a single linked instance, only writing the parts that changed.
+             * 
+             * @param linkToUpdate The link of the linked instance to update.
+             * @param patchedTemplateDomCache The patched source template DOMs shared by the links.
+             * @return True if the linked instance DOM changed, otherwise false.
+             */
+            bool UpdateLinkedInstance(Link& linkToUpdate, PatchedTemplateDomCache& patchedTemplateDomCache);
+
+            /**
+             * Records that the linked instance corresponding to the given link Id was updated and adds more linkIds to the
              * template change propagation queue(linkIdsQueue) when necessary.
              * 
-             * @param linkIdToUpdate The id of the linked instance to update
+             * @param linkIdToUpdate The id of the linked instance that was updated.
+             * @param isLinkedInstanceUpdated Whether the DOM of the linked instance changed.
              * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
              *                                    whether any of the instances of the target template were updated.
              * @param linkIdsQueue A queue of vector of link-Ids to update.
              */
-            void UpdateLinkedInstance(const LinkId linkIdToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
-                AZStd::queue<LinkIds>& linkIdsQueue);
+            void OnLinkedInstanceUpdated(const LinkId linkIdToUpdate, bool isLinkedInstanceUpdated,
+                TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue);
 
             /**
              * If all linked instances of a target template are updated and if the content of any of the linked instances changed,
@@ -8,6 +8,10 @@
 
 #include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
 
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzToolsFramework/Prefab/Spawnable/SpawnableUtils.h>
+
 namespace Benchmark
 {
     using BM_PrefabLoad = BM_Prefab;
@@ -47,6 +51,46 @@ namespace Benchmark
         ->Range(100, 1000)
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_PrefabLoad, LoadSpawnable_FromBinaryObjectStream)(::benchmark::State& state)
+    {
+        const unsigned int numEntities = state.range();
+
+        AZStd::vector<AZ::Entity*> entities;
+        CreateEntities(numEntities, entities);
+        AZStd::unique_ptr<Instance> instance(m_prefabSystemComponent->CreatePrefab(entities, {}, m_pathString));
+
+        // Spawnables are the prefab products that are loaded at runtime, through the same ObjectStream path as the asset handler.
+        AZStd::vector<char> buffer;
+        {
+            AzFramework::Spawnable spawnable;
+            AzToolsFramework::Prefab::SpawnableUtils::CreateSpawnable(spawnable, m_prefabSystemComponent->FindTemplateDom(instance->GetTemplateId()));
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+            AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, &spawnable);
+        }
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            AZStd::unique_ptr<AzFramework::Spawnable> spawnable = AZStd::make_unique<AzFramework::Spawnable>();
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> loadStream(&buffer);
+            state.ResumeTiming();
+
+            AZ::Utils::LoadObjectFromStreamInPlace(loadStream, *spawnable);
+
+            state.PauseTiming();
+            spawnable.reset();
+            state.ResumeTiming();
+        }
+
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+        state.SetComplexityN(numEntities);
+    }
+    BENCHMARK_REGISTER_F(BM_PrefabLoad, LoadSpawnable_FromBinaryObjectStream)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
 }
 
 #endif
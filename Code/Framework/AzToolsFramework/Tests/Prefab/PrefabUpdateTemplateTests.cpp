@@ -6,7 +6,11 @@
  */
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
+#include <AzToolsFramework/Prefab/Link/PatchedTemplateDomCache.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
 #include <Prefab/PrefabTestComponent.h>
 #include <Prefab/PrefabTestDomUtils.h>
@@ -415,4 +419,254 @@ namespace UnitTest
         // Validate that the axles under the car have the same DOM as the axle template.
         PrefabTestDomUtils::ValidatePrefabDomInstances(axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
     }
+
+    TEST_F(PrefabUpdateTemplateTest, UpdatePrefabDomValue_ChangedValue_OnlyChangedValueWrittenAndIgnoredMemberKept)
+    {
+        PrefabDom target;
+        target.Parse(R"({ "Entities": { "Entity1": { "Name": "Wheel", "Components": [ 1, 2, 3 ] } }, "LinkId": 7 })");
+        PrefabDom source;
+        source.Parse(R"({ "Entities": { "Entity1": { "Name": "Axle", "Components": [ 1, 2 ] } } })");
+        ASSERT_FALSE(target.HasParseError());
+        ASSERT_FALSE(source.HasParseError());
+
+        const PrefabDomValue* entitiesBeforeUpdate = &target["Entities"];
+        EXPECT_TRUE(PrefabDomUtils::UpdatePrefabDomValue(target, source, target.GetAllocator(), PrefabDomUtils::LinkIdName));
+
+        // The unchanged parts of the DOM are updated in place and the ignored member is kept.
+        EXPECT_EQ(entitiesBeforeUpdate, &target["Entities"]);
+        EXPECT_EQ(target["Entities"], source["Entities"]);
+        ASSERT_TRUE(target.HasMember(PrefabDomUtils::LinkIdName));
+        EXPECT_EQ(target[PrefabDomUtils::LinkIdName].GetUint64(), 7u);
+
+        EXPECT_FALSE(PrefabDomUtils::UpdatePrefabDomValue(target, source, target.GetAllocator(), PrefabDomUtils::LinkIdName));
+    }
+
+    TEST_F(PrefabUpdateTemplateTest, UpdatePrefabDomValue_ChangedMembers_ObjectReplacedAndIgnoredMemberKept)
+    {
+        PrefabDom target;
+        target.Parse(R"({ "LinkId": 7, "Entities": { "Entity1": {} } })");
+        PrefabDom source;
+        source.Parse(R"({ "Entities": { "Entity2": {} }, "Instances": {} })");
+        ASSERT_FALSE(target.HasParseError());
+        ASSERT_FALSE(source.HasParseError());
+
+        EXPECT_TRUE(PrefabDomUtils::UpdatePrefabDomValue(target, source, target.GetAllocator(), PrefabDomUtils::LinkIdName));
+
+        EXPECT_EQ(target["Entities"], source["Entities"]);
+        EXPECT_EQ(target["Instances"], source["Instances"]);
+        ASSERT_TRUE(target.HasMember(PrefabDomUtils::LinkIdName));
+        EXPECT_EQ(target[PrefabDomUtils::LinkIdName].GetUint64(), 7u);
+        EXPECT_EQ(target.MemberCount(), 3u);
+    }
+
+    TEST_F(PrefabUpdateTemplateTest, UpdatePrefabTemplate_ParallelPropagation_TemplatesMatchSerialPropagation)
+    {
+        // The linked instances are only updated in parallel when there's a global job context.
+        AZStd::unique_ptr<AZ::JobManager> jobManager;
+        AZStd::unique_ptr<AZ::JobContext> jobContext;
+        if (!AZ::JobContext::GetGlobalContext())
+        {
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            jobContext = AZStd::make_unique<AZ::JobContext>(*jobManager);
+            AZ::JobContext::SetGlobalContext(jobContext.get());
+        }
+        const bool parallelPrefabPropagation = ed_parallelPrefabPropagation;
+
+        // Create a single entity wheel instance and create a template out of it.
+        AZ::Entity* wheelEntity = CreateEntity("WheelEntity1");
+        AZStd::unique_ptr<Instance> wheelIsolatedInstance = m_prefabSystemComponent->CreatePrefab({ wheelEntity }, {}, WheelPrefabMockFilePath);
+        const TemplateId wheelTemplateId = wheelIsolatedInstance->GetTemplateId();
+        PrefabDom& wheelTemplateDom = m_prefabSystemComponent->FindTemplateDom(wheelTemplateId);
+
+        // Create an axle with 2 wheel instances.
+        AZStd::unique_ptr<Instance> wheel1UnderAxle = m_prefabSystemComponent->InstantiatePrefab(wheelTemplateId);
+        AZStd::unique_ptr<Instance> wheel2UnderAxle = m_prefabSystemComponent->InstantiatePrefab(wheelTemplateId);
+        AZStd::unique_ptr<Instance> axleInstance = m_prefabSystemComponent->CreatePrefab({},
+            MakeInstanceList( AZStd::move(wheel1UnderAxle), AZStd::move(wheel2UnderAxle) ), AxlePrefabMockFilePath);
+        const TemplateId axleTemplateId = axleInstance->GetTemplateId();
+        PrefabDom& axleTemplateDom = m_prefabSystemComponent->FindTemplateDom(axleTemplateId);
+
+        // Create a car with 2 axle instances and 1 wheel instance, so a wheel change is propagated to the axle and car templates
+        // in the same step.
+        AZStd::unique_ptr<Instance> axle1UnderCar = m_prefabSystemComponent->InstantiatePrefab(axleTemplateId);
+        AZStd::unique_ptr<Instance> axle2UnderCar = m_prefabSystemComponent->InstantiatePrefab(axleTemplateId);
+        AZStd::unique_ptr<Instance> spareWheelUnderCar = m_prefabSystemComponent->InstantiatePrefab(wheelTemplateId);
+        AZStd::unique_ptr<Instance> carInstance = m_prefabSystemComponent->CreatePrefab({},
+            MakeInstanceList( AZStd::move(axle1UnderCar), AZStd::move(axle2UnderCar), AZStd::move(spareWheelUnderCar) ), CarPrefabMockFilePath);
+        const TemplateId carTemplateId = carInstance->GetTemplateId();
+        const AZStd::vector<InstanceAlias> axleInstanceAliasesUnderCar = carInstance->GetNestedInstanceAliases(axleTemplateId);
+        const AZStd::vector<InstanceAlias> wheelInstanceAliasesUnderCar = carInstance->GetNestedInstanceAliases(wheelTemplateId);
+        PrefabDom& carTemplateDom = m_prefabSystemComponent->FindTemplateDom(carTemplateId);
+
+        PrefabDom originalWheelTemplateDom;
+        originalWheelTemplateDom.CopyFrom(wheelTemplateDom, originalWheelTemplateDom.GetAllocator());
+        PrefabDom originalCarTemplateDom;
+        originalCarTemplateDom.CopyFrom(carTemplateDom, originalCarTemplateDom.GetAllocator());
+
+        // Add another entity to a wheel instance to get the updated wheel template.
+        wheelIsolatedInstance->AddEntity(*CreateEntity("WheelEntity2"));
+        PrefabDom updatedWheelInstance;
+        ASSERT_TRUE(PrefabDomUtils::StoreInstanceInPrefabDom(*wheelIsolatedInstance, updatedWheelInstance));
+
+        // Propagate the change one link at a time.
+        ed_parallelPrefabPropagation = false;
+        m_prefabSystemComponent->UpdatePrefabTemplate(wheelTemplateId, updatedWheelInstance);
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        PrefabDom serialAxleTemplateDom;
+        serialAxleTemplateDom.CopyFrom(axleTemplateDom, serialAxleTemplateDom.GetAllocator());
+        PrefabDom serialCarTemplateDom;
+        serialCarTemplateDom.CopyFrom(carTemplateDom, serialCarTemplateDom.GetAllocator());
+
+        // Revert the change so the same change can be propagated again.
+        m_prefabSystemComponent->UpdatePrefabTemplate(wheelTemplateId, originalWheelTemplateDom);
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        PrefabTestDomUtils::ComparePrefabDoms(carTemplateDom, originalCarTemplateDom);
+
+        // Propagate the change with the axle and car templates updated in parallel.
+        ed_parallelPrefabPropagation = true;
+        m_prefabSystemComponent->UpdatePrefabTemplate(wheelTemplateId, updatedWheelInstance);
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+        PrefabTestDomUtils::ComparePrefabDoms(axleTemplateDom, serialAxleTemplateDom);
+        PrefabTestDomUtils::ComparePrefabDoms(carTemplateDom, serialCarTemplateDom);
+        PrefabTestDomUtils::ValidatePrefabDomInstances(axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
+        PrefabTestDomUtils::ValidatePrefabDomInstances(wheelInstanceAliasesUnderCar, carTemplateDom, wheelTemplateDom);
+
+        ed_parallelPrefabPropagation = parallelPrefabPropagation;
+        if (jobContext)
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+        }
+    }
+
+    TEST_F(PrefabUpdateTemplateTest, UpdatePrefabTemplate_TemplateChangedAfterItWasPropagated_DependentTemplatesGetLatestChange)
+    {
+        // Create a single entity wheel instance and create a template out of it.
+        AZ::Entity* wheelEntity = CreateEntity("WheelEntity1");
+        AZStd::unique_ptr<Instance> wheelIsolatedInstance = m_prefabSystemComponent->CreatePrefab({ wheelEntity }, {}, WheelPrefabMockFilePath);
+        const TemplateId wheelTemplateId = wheelIsolatedInstance->GetTemplateId();
+        PrefabDom& wheelTemplateDom = m_prefabSystemComponent->FindTemplateDom(wheelTemplateId);
+
+        // Create a hub with 1 wheel instance.
+        AZStd::unique_ptr<Instance> wheelUnderHub = m_prefabSystemComponent->InstantiatePrefab(wheelTemplateId);
+        AZStd::unique_ptr<Instance> hubInstance = m_prefabSystemComponent->CreatePrefab({},
+            MakeInstanceList( AZStd::move(wheelUnderHub) ), NestedPrefabMockFilePath);
+        const TemplateId hubTemplateId = hubInstance->GetTemplateId();
+        PrefabDom& hubTemplateDom = m_prefabSystemComponent->FindTemplateDom(hubTemplateId);
+
+        // Create an axle with 1 wheel instance and 1 hub instance, so the axle template is changed once through its wheel and
+        // once more through its hub while a wheel change is propagated.
+        AZStd::unique_ptr<Instance> wheelUnderAxle = m_prefabSystemComponent->InstantiatePrefab(wheelTemplateId);
+        AZStd::unique_ptr<Instance> hubUnderAxle = m_prefabSystemComponent->InstantiatePrefab(hubTemplateId);
+        AZStd::unique_ptr<Instance> axleInstance = m_prefabSystemComponent->CreatePrefab({},
+            MakeInstanceList( AZStd::move(wheelUnderAxle), AZStd::move(hubUnderAxle) ), AxlePrefabMockFilePath);
+        const TemplateId axleTemplateId = axleInstance->GetTemplateId();
+        const AZStd::vector<InstanceAlias> wheelInstanceAliasesUnderAxle = axleInstance->GetNestedInstanceAliases(wheelTemplateId);
+        const AZStd::vector<InstanceAlias> hubInstanceAliasesUnderAxle = axleInstance->GetNestedInstanceAliases(hubTemplateId);
+        PrefabDom& axleTemplateDom = m_prefabSystemComponent->FindTemplateDom(axleTemplateId);
+
+        // Create a car with 2 axle instances, which share the patched axle template while the change is propagated.
+        AZStd::unique_ptr<Instance> axle1UnderCar = m_prefabSystemComponent->InstantiatePrefab(axleTemplateId);
+        AZStd::unique_ptr<Instance> axle2UnderCar = m_prefabSystemComponent->InstantiatePrefab(axleTemplateId);
+        AZStd::unique_ptr<Instance> carInstance = m_prefabSystemComponent->CreatePrefab({},
+            MakeInstanceList( AZStd::move(axle1UnderCar), AZStd::move(axle2UnderCar) ), CarPrefabMockFilePath);
+        const TemplateId carTemplateId = carInstance->GetTemplateId();
+        const AZStd::vector<InstanceAlias> axleInstanceAliasesUnderCar = carInstance->GetNestedInstanceAliases(axleTemplateId);
+        PrefabDom& carTemplateDom = m_prefabSystemComponent->FindTemplateDom(carTemplateId);
+
+        // Add another entity to a wheel instance and use it to update the wheel template.
+        wheelIsolatedInstance->AddEntity(*CreateEntity("WheelEntity2"));
+        PrefabDom updatedWheelInstance;
+        ASSERT_TRUE(PrefabDomUtils::StoreInstanceInPrefabDom(*wheelIsolatedInstance, updatedWheelInstance));
+        m_prefabSystemComponent->UpdatePrefabTemplate(wheelTemplateId, updatedWheelInstance);
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+        PrefabTestDomUtils::ValidatePrefabDomInstances(wheelInstanceAliasesUnderAxle, axleTemplateDom, wheelTemplateDom);
+        PrefabTestDomUtils::ValidatePrefabDomInstances(hubInstanceAliasesUnderAxle, axleTemplateDom, hubTemplateDom);
+
+        // Validate that the axles under the car have the final axle template, including the change that came through the hub.
+        PrefabTestDomUtils::ValidatePrefabDomInstances(axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
+    }
+
+    TEST_F(PrefabUpdateTemplateTest, PatchedTemplateDomCache_TemplateInvalidated_OnlyPatchedDomsOfThatTemplateDropped)
+    {
+        constexpr TemplateId wheelTemplateId = 1;
+        constexpr TemplateId axleTemplateId = 2;
+
+        PrefabDom wheelPatches;
+        wheelPatches.Parse(R"([ { "op": "replace", "path": "/Entities/Entity1/Name", "value": "Spare" } ])");
+        PrefabDom equalWheelPatches;
+        equalWheelPatches.Parse(R"([ { "value": "Spare", "path": "/Entities/Entity1/Name", "op": "replace" } ])");
+        ASSERT_FALSE(wheelPatches.HasParseError());
+        ASSERT_FALSE(equalWheelPatches.HasParseError());
+        EXPECT_EQ(PatchedTemplateDomCache::HashPatches(&wheelPatches), PatchedTemplateDomCache::HashPatches(&equalWheelPatches));
+
+        auto patchedWheelDom = AZStd::make_shared<PrefabDom>();
+        patchedWheelDom->Parse(R"({ "Entities": { "Entity1": { "Name": "Spare" } } })");
+        auto axleDom = AZStd::make_shared<PrefabDom>();
+        axleDom->Parse(R"({ "Instances": {} })");
+
+        // Four wheels share their patches, two axles have no patches.
+        PatchedTemplateDomCache cache;
+        cache.AddExpectedLink(wheelTemplateId, &wheelPatches);
+        cache.AddExpectedLink(wheelTemplateId, &equalWheelPatches);
+        cache.AddExpectedLink(wheelTemplateId, &equalWheelPatches);
+        cache.AddExpectedLink(wheelTemplateId, &equalWheelPatches);
+        cache.AddExpectedLink(axleTemplateId, nullptr);
+        cache.AddExpectedLink(axleTemplateId, nullptr);
+
+        EXPECT_FALSE(cache.Find(wheelTemplateId, &wheelPatches));
+        cache.Add(wheelTemplateId, &wheelPatches, patchedWheelDom);
+        EXPECT_FALSE(cache.Find(axleTemplateId, nullptr));
+        cache.Add(axleTemplateId, nullptr, axleDom);
+
+        // Links with equal patches share the patched DOM, links with other patches don't.
+        EXPECT_EQ(cache.Find(wheelTemplateId, &equalWheelPatches), patchedWheelDom);
+        EXPECT_FALSE(cache.Find(wheelTemplateId, nullptr));
+
+        // After the wheel template is edited, its patched DOMs are out of date but the remaining wheels can share the new one.
+        cache.Invalidate(wheelTemplateId);
+        EXPECT_FALSE(cache.Find(wheelTemplateId, &equalWheelPatches));
+        auto updatedPatchedWheelDom = AZStd::make_shared<PrefabDom>();
+        updatedPatchedWheelDom->Parse(R"({ "Entities": { "Entity1": { "Name": "Spare" }, "Entity2": {} } })");
+        cache.Add(wheelTemplateId, &equalWheelPatches, updatedPatchedWheelDom);
+        EXPECT_EQ(cache.Find(wheelTemplateId, &equalWheelPatches), updatedPatchedWheelDom);
+
+        // The last axle and the last wheel have used their patched DOMs, so the cache doesn't hold on to them anymore.
+        EXPECT_EQ(cache.Find(axleTemplateId, nullptr), axleDom);
+        EXPECT_FALSE(cache.Find(axleTemplateId, nullptr));
+        EXPECT_FALSE(cache.Find(wheelTemplateId, &wheelPatches));
+        EXPECT_EQ(axleDom.use_count(), 1);
+        EXPECT_EQ(updatedPatchedWheelDom.use_count(), 1);
+    }
+
+    TEST_F(PrefabUpdateTemplateTest, PatchedTemplateDomCache_UniquePatches_PatchedDomNotKept)
+    {
+        constexpr TemplateId wheelTemplateId = 1;
+
+        PrefabDom wheelPatches;
+        wheelPatches.Parse(R"([ { "op": "replace", "path": "/Entities/Entity1/Name", "value": "Spare" } ])");
+        PrefabDom otherWheelPatches;
+        otherWheelPatches.Parse(R"([ { "op": "replace", "path": "/Entities/Entity1/Name", "value": "Front" } ])");
+        ASSERT_FALSE(wheelPatches.HasParseError());
+        ASSERT_FALSE(otherWheelPatches.HasParseError());
+
+        PatchedTemplateDomCache cache;
+        cache.AddExpectedLink(wheelTemplateId, &wheelPatches);
+        cache.AddExpectedLink(wheelTemplateId, &otherWheelPatches);
+
+        auto patchedWheelDom = AZStd::make_shared<PrefabDom>();
+        patchedWheelDom->Parse(R"({ "Entities": { "Entity1": { "Name": "Spare" } } })");
+        cache.Add(wheelTemplateId, &wheelPatches, patchedWheelDom);
+        EXPECT_EQ(patchedWheelDom.use_count(), 1);
+        EXPECT_FALSE(cache.Find(wheelTemplateId, &wheelPatches));
+
+        // Links that weren't expected aren't cached either.
+        cache.Add(wheelTemplateId + 1, nullptr, patchedWheelDom);
+        EXPECT_EQ(patchedWheelDom.use_count(), 1);
+    }
 }
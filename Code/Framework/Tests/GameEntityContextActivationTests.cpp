@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "FrameworkApplicationFixture.h"
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/Components/NonUniformScaleComponent.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Entity/GameEntityContextComponent.h>
+
+namespace UnitTest
+{
+    // Stands in for a component that does some work while activating and declares its activation thread safe.
+    class LevelLoadThreadSafeComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(LevelLoadThreadSafeComponent, "{0B7B0C0E-3F7A-4D43-9C68-3B2B2E86F1A1}");
+
+        static void Reflect(AZ::ReflectContext*) {}
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("LevelLoadThreadSafeService"));
+        }
+
+        static bool IsActivationThreadSafe() { return true; }
+
+        void Activate() override
+        {
+            // Build some state like a component that caches its configuration on activation would.
+            AZ::u32 value = static_cast<AZ::u32>(GetEntityId());
+            for (AZ::u32 i = 0; i < s_workPerActivation; ++i)
+            {
+                value = value * 1664525u + 1013904223u;
+            }
+            m_state = value;
+            m_isActive = true;
+        }
+
+        void Deactivate() override
+        {
+            m_isActive = false;
+        }
+
+        static AZ::u32 s_workPerActivation;
+        AZ::u32 m_state = 0;
+        AZStd::atomic_bool m_isActive{ false };
+    };
+
+    AZ::u32 LevelLoadThreadSafeComponent::s_workPerActivation = 0;
+
+    // Isn't thread safe and depends on the thread safe component, so it's activated on the loading thread once that one is active.
+    class LevelLoadMainThreadComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(LevelLoadMainThreadComponent, "{0B7B0C0E-3F7A-4D43-9C68-3B2B2E86F1A2}");
+
+        static void Reflect(AZ::ReflectContext*) {}
+
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+        {
+            dependent.push_back(AZ_CRC_CE("LevelLoadThreadSafeService"));
+        }
+
+        void Activate() override
+        {
+            m_activatedAfterThreadSafeComponent = GetEntity()->FindComponent<LevelLoadThreadSafeComponent>()->m_isActive.load();
+            m_activationThreadId = AZStd::this_thread::get_id();
+        }
+
+        void Deactivate() override {}
+
+        bool m_activatedAfterThreadSafeComponent = false;
+        AZStd::thread_id m_activationThreadId;
+    };
+
+    class GameEntityContextActivationTest
+        : public FrameworkApplicationFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            FrameworkApplicationFixture::SetUp();
+            m_application->RegisterComponentDescriptor(LevelLoadThreadSafeComponent::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(LevelLoadMainThreadComponent::CreateDescriptor());
+
+            AZ::Entity* systemEntity = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(systemEntity, &AZ::ComponentApplicationRequests::FindEntity, AZ::SystemEntityId);
+            ASSERT_NE(nullptr, systemEntity);
+            m_gameEntityContext = systemEntity->FindComponent<AzFramework::GameEntityContextComponent>();
+            ASSERT_NE(nullptr, m_gameEntityContext);
+
+            m_batchEntityActivation = AzFramework::sys_batchEntityActivation;
+            m_batchEntityActivationSize = AzFramework::sys_batchEntityActivationSize;
+        }
+
+        void TearDown() override
+        {
+            DestroyEntities();
+            AzFramework::sys_batchEntityActivation = m_batchEntityActivation;
+            AzFramework::sys_batchEntityActivationSize = m_batchEntityActivationSize;
+            LevelLoadThreadSafeComponent::s_workPerActivation = 0;
+            FrameworkApplicationFixture::TearDown();
+        }
+
+        // Creates entities like the ones in a level, with the components in an order that always needs sorting.
+        void CreateEntities(size_t entityCount)
+        {
+            m_entities.reserve(entityCount);
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                AZ::Entity* entity = aznew AZ::Entity();
+                entity->CreateComponent<LevelLoadMainThreadComponent>();
+                entity->CreateComponent<AzFramework::NonUniformScaleComponent>();
+                entity->CreateComponent<LevelLoadThreadSafeComponent>();
+                entity->CreateComponent<AzFramework::TransformComponent>();
+                m_entities.push_back(entity);
+            }
+        }
+
+        void DestroyEntities()
+        {
+            for (AZ::Entity* entity : m_entities)
+            {
+                if (entity->GetState() == AZ::Entity::State::Active)
+                {
+                    entity->Deactivate();
+                }
+                delete entity;
+            }
+            m_entities.clear();
+        }
+
+        double LoadLevel(size_t entityCount)
+        {
+            CreateEntities(entityCount);
+            const auto start = AZStd::chrono::high_resolution_clock::now();
+            m_gameEntityContext->OnContextEntitiesAdded(m_entities);
+            const auto end = AZStd::chrono::high_resolution_clock::now();
+            DestroyEntities();
+            return AZStd::chrono::duration<double, AZStd::milli>(end - start).count();
+        }
+
+        AzFramework::GameEntityContextComponent* m_gameEntityContext = nullptr;
+        AzFramework::EntityList m_entities;
+        bool m_batchEntityActivation = false;
+        AZ::u32 m_batchEntityActivationSize = 0;
+    };
+
+    TEST_F(GameEntityContextActivationTest, BatchActivation_AllEntitiesAreActivatedAfterTheirDependencies)
+    {
+        AzFramework::sys_batchEntityActivation = true;
+        // Use a batch size that doesn't divide the entity count so the last batch is partial.
+        AzFramework::sys_batchEntityActivationSize = 16;
+
+        CreateEntities(100);
+        m_gameEntityContext->OnContextEntitiesAdded(m_entities);
+
+        const AZStd::thread_id loadingThreadId = AZStd::this_thread::get_id();
+        for (const AZ::Entity* entity : m_entities)
+        {
+            EXPECT_EQ(AZ::Entity::State::Active, entity->GetState());
+            EXPECT_TRUE(entity->FindComponent<LevelLoadThreadSafeComponent>()->m_isActive);
+            const LevelLoadMainThreadComponent* mainThreadComponent = entity->FindComponent<LevelLoadMainThreadComponent>();
+            EXPECT_TRUE(mainThreadComponent->m_activatedAfterThreadSafeComponent);
+            EXPECT_EQ(loadingThreadId, mainThreadComponent->m_activationThreadId);
+        }
+    }
+
+    // Compares the time it takes to activate the entities of a level one by one against activating them in batches.
+    // Disabled by default since it's a performance measurement.
+    TEST_F(GameEntityContextActivationTest, DISABLED_LevelLoad_BatchedVersusSerialActivation_Performance)
+    {
+        constexpr size_t LevelEntityCount = 20000;
+        constexpr int Repeats = 5;
+        LevelLoadThreadSafeComponent::s_workPerActivation = 2000;
+
+        const AZ::u32 batchSizes[] = { 0, 64, 256, 1024 };
+
+        AzFramework::sys_batchEntityActivation = false;
+        double serialTime = 0.0;
+        for (int repeat = 0; repeat < Repeats; ++repeat)
+        {
+            serialTime += LoadLevel(LevelEntityCount);
+        }
+        printf("Serial activation of %zu entities: %.2f ms\n", LevelEntityCount, serialTime / Repeats);
+
+        AzFramework::sys_batchEntityActivation = true;
+        for (AZ::u32 batchSize : batchSizes)
+        {
+            AzFramework::sys_batchEntityActivationSize = batchSize;
+            double batchedTime = 0.0;
+            for (int repeat = 0; repeat < Repeats; ++repeat)
+            {
+                batchedTime += LoadLevel(LevelEntityCount);
+            }
+            printf("Batched activation of %zu entities, batch size %u: %.2f ms (%.2fx)\n",
+                LevelEntityCount, batchSize, batchedTime / Repeats, serialTime / batchedTime);
+        }
+    }
+} // namespace UnitTest
@@ -56,6 +56,10 @@ namespace AzFramework
 
         MOCK_METHOD3(Barrier, void(EntitySpawnTicket& ticket, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs));
 
+        MOCK_METHOD2(EnableEntityPooling, void(const AZ::Data::AssetId& spawnableId, EntityPoolSettings settings));
+        MOCK_METHOD1(DisableEntityPooling, void(const AZ::Data::AssetId& spawnableId));
+        MOCK_CONST_METHOD1(GetEntityPoolStatistics, EntityPoolStatistics(const AZ::Data::AssetId& spawnableId));
+
         MOCK_METHOD1(CreateTicket, AZStd::pair<EntitySpawnTicket::Id, void*>(AZ::Data::Asset<Spawnable>&& spawnable));
         MOCK_METHOD1(DestroyTicket, void(void* ticket));
 
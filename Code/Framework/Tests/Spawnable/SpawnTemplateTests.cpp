@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnTemplate.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    // Test component that only holds plain data, so it can be spawned by copying its byte image.
+    class SpawnTemplatePlainDataComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(SpawnTemplatePlainDataComponent, "{1E0B8E60-5E4B-4C36-9E35-7B6F2B7A86A4}");
+
+        enum class Mode : AZ::u8
+        {
+            First,
+            Second
+        };
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<SpawnTemplatePlainDataComponent, AZ::Component>()
+                    ->Field("Count", &SpawnTemplatePlainDataComponent::m_count)
+                    ->Field("Scale", &SpawnTemplatePlainDataComponent::m_scale)
+                    ->Field("Mode", &SpawnTemplatePlainDataComponent::m_mode)
+                    ->Field("Offset", &SpawnTemplatePlainDataComponent::m_offset)
+                    ->Field("EntityReference", &SpawnTemplatePlainDataComponent::m_entityReference)
+                    ;
+            }
+        }
+
+        AZ::s32 m_count = 0;
+        float m_scale = 1.0f;
+        Mode m_mode = Mode::First;
+        AZ::Vector3 m_offset = AZ::Vector3::CreateZero();
+        AZ::EntityId m_entityReference;
+        // Not reflected, so this should keep the value from the constructor.
+        AZ::u32 m_runtimeValue = 42;
+    };
+
+    // Test component that holds data that can't be copied as bytes, so it has to be cloned through the Serialize Context.
+    class SpawnTemplateComplexDataComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(SpawnTemplateComplexDataComponent, "{4A1B7B8D-1E55-4F3B-8F0E-2B8C8E0C5D11}");
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<SpawnTemplateComplexDataComponent, AZ::Component>()
+                    ->Field("Label", &SpawnTemplateComplexDataComponent::m_label)
+                    ->Field("EntityReferences", &SpawnTemplateComplexDataComponent::m_entityReferences)
+                    ;
+            }
+        }
+
+        AZStd::string m_label;
+        AZStd::vector<AZ::EntityId> m_entityReferences;
+    };
+
+    class SpawnTemplateTest : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_application = new AzFramework::Application();
+            AZ::ComponentApplication::Descriptor descriptor;
+            m_application->Start(descriptor);
+            m_application->RegisterComponentDescriptor(SpawnTemplatePlainDataComponent::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(SpawnTemplateComplexDataComponent::CreateDescriptor());
+
+            // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
+            // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
+            // in the unit tests.
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            m_serializeContext = m_application->GetSerializeContext();
+            m_spawnable = aznew AzFramework::Spawnable();
+        }
+
+        void TearDown() override
+        {
+            delete m_spawnable;
+            m_spawnable = nullptr;
+
+            delete m_application;
+            m_application = nullptr;
+
+            AllocatorsFixture::TearDown();
+        }
+
+        // Creates two entities that reference each other through a plain data and a complex data component.
+        void FillSpawnable()
+        {
+            AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+            entities.push_back(AZStd::make_unique<AZ::Entity>("First"));
+            entities.push_back(AZStd::make_unique<AZ::Entity>("Second"));
+
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                const AZ::EntityId otherId = entities[(i + 1) % entities.size()]->GetId();
+
+                auto plainData = entities[i]->CreateComponent<SpawnTemplatePlainDataComponent>();
+                plainData->m_count = aznumeric_cast<AZ::s32>(i) + 7;
+                plainData->m_scale = 3.5f;
+                plainData->m_mode = SpawnTemplatePlainDataComponent::Mode::Second;
+                plainData->m_offset = AZ::Vector3(1.0f, 2.0f, 3.0f);
+                plainData->m_entityReference = otherId;
+                plainData->m_runtimeValue = 0;
+
+                auto complexData = entities[i]->CreateComponent<SpawnTemplateComplexDataComponent>();
+                complexData->m_label = "Label";
+                complexData->m_entityReferences = { otherId, entities[i]->GetId() };
+            }
+        }
+
+        AzFramework::SpawnTemplate::EntityIdMap CreateIdMap() const
+        {
+            AzFramework::SpawnTemplate::EntityIdMap idMap;
+            for (const AZStd::unique_ptr<AZ::Entity>& entity : m_spawnable->GetEntities())
+            {
+                idMap.emplace(entity->GetId(), AZ::Entity::MakeId());
+            }
+            return idMap;
+        }
+
+    protected:
+        AzFramework::Application* m_application{ nullptr };
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        AzFramework::Spawnable* m_spawnable{ nullptr };
+    };
+
+    TEST_F(SpawnTemplateTest, Construct_PlainAndComplexComponents_OnlyPlainDataComponentsAreFastCopy)
+    {
+        FillSpawnable();
+
+        AzFramework::SpawnTemplate spawnTemplate(m_spawnable->GetEntities(), *m_serializeContext);
+
+        EXPECT_EQ(2u, spawnTemplate.GetEntityCount());
+        EXPECT_EQ(4u, spawnTemplate.GetComponentCount());
+        EXPECT_EQ(2u, spawnTemplate.GetFastCopyComponentCount());
+        EXPECT_GT(spawnTemplate.GetImageSize(), 0u);
+    }
+
+    TEST_F(SpawnTemplateTest, SpawnEntity_PlainDataComponent_ReflectedDataIsCopiedAndReferencesAreRemapped)
+    {
+        FillSpawnable();
+        AzFramework::SpawnTemplate spawnTemplate(m_spawnable->GetEntities(), *m_serializeContext);
+        AzFramework::SpawnTemplate::EntityIdMap idMap = CreateIdMap();
+        const AZ::Entity& source = *m_spawnable->GetEntities()[0];
+
+        AZStd::unique_ptr<AZ::Entity> entity(spawnTemplate.SpawnEntity(0, idMap));
+        ASSERT_NE(nullptr, entity);
+        EXPECT_EQ(idMap[source.GetId()], entity->GetId());
+        EXPECT_EQ(source.GetName(), entity->GetName());
+
+        auto plainData = entity->FindComponent<SpawnTemplatePlainDataComponent>();
+        ASSERT_NE(nullptr, plainData);
+        EXPECT_EQ(entity.get(), plainData->GetEntity());
+        EXPECT_EQ(source.FindComponent<SpawnTemplatePlainDataComponent>()->GetId(), plainData->GetId());
+        EXPECT_EQ(7, plainData->m_count);
+        EXPECT_FLOAT_EQ(3.5f, plainData->m_scale);
+        EXPECT_EQ(SpawnTemplatePlainDataComponent::Mode::Second, plainData->m_mode);
+        EXPECT_EQ(AZ::Vector3(1.0f, 2.0f, 3.0f), plainData->m_offset);
+        EXPECT_EQ(idMap[m_spawnable->GetEntities()[1]->GetId()], plainData->m_entityReference);
+        EXPECT_EQ(42u, plainData->m_runtimeValue);
+    }
+
+    TEST_F(SpawnTemplateTest, SpawnEntity_ComplexDataComponent_IsClonedAndReferencesAreRemapped)
+    {
+        FillSpawnable();
+        AzFramework::SpawnTemplate spawnTemplate(m_spawnable->GetEntities(), *m_serializeContext);
+        AzFramework::SpawnTemplate::EntityIdMap idMap = CreateIdMap();
+
+        AZStd::unique_ptr<AZ::Entity> entity(spawnTemplate.SpawnEntity(1, idMap));
+        ASSERT_NE(nullptr, entity);
+
+        auto complexData = entity->FindComponent<SpawnTemplateComplexDataComponent>();
+        ASSERT_NE(nullptr, complexData);
+        EXPECT_STREQ("Label", complexData->m_label.c_str());
+        ASSERT_EQ(2u, complexData->m_entityReferences.size());
+        EXPECT_EQ(idMap[m_spawnable->GetEntities()[0]->GetId()], complexData->m_entityReferences[0]);
+        EXPECT_EQ(entity->GetId(), complexData->m_entityReferences[1]);
+    }
+
+    TEST_F(SpawnTemplateTest, SpawnEntity_ComparedToReflectionClone_ProducesSameData)
+    {
+        FillSpawnable();
+        AzFramework::SpawnTemplate spawnTemplate(m_spawnable->GetEntities(), *m_serializeContext);
+        AzFramework::SpawnTemplate::EntityIdMap idMap = CreateIdMap();
+        const AZ::Entity& source = *m_spawnable->GetEntities()[0];
+
+        AZStd::unique_ptr<AZ::Entity> spawned(spawnTemplate.SpawnEntity(0, idMap));
+        AZStd::unique_ptr<AZ::Entity> cloned(
+            AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(&source, idMap, m_serializeContext));
+        ASSERT_NE(nullptr, spawned);
+        ASSERT_NE(nullptr, cloned);
+
+        EXPECT_EQ(cloned->GetId(), spawned->GetId());
+        ASSERT_EQ(cloned->GetComponents().size(), spawned->GetComponents().size());
+
+        auto spawnedPlainData = spawned->FindComponent<SpawnTemplatePlainDataComponent>();
+        auto clonedPlainData = cloned->FindComponent<SpawnTemplatePlainDataComponent>();
+        ASSERT_NE(nullptr, spawnedPlainData);
+        ASSERT_NE(nullptr, clonedPlainData);
+        EXPECT_EQ(clonedPlainData->m_count, spawnedPlainData->m_count);
+        EXPECT_EQ(clonedPlainData->m_offset, spawnedPlainData->m_offset);
+        EXPECT_EQ(clonedPlainData->m_entityReference, spawnedPlainData->m_entityReference);
+        EXPECT_EQ(clonedPlainData->m_runtimeValue, spawnedPlainData->m_runtimeValue);
+    }
+
+    TEST_F(SpawnTemplateTest, SpawnEntity_EntityIdNotInMap_NewIdIsGeneratedAndAddedToMap)
+    {
+        FillSpawnable();
+        AzFramework::SpawnTemplate spawnTemplate(m_spawnable->GetEntities(), *m_serializeContext);
+        AzFramework::SpawnTemplate::EntityIdMap idMap;
+        const AZ::EntityId sourceId = m_spawnable->GetEntities()[0]->GetId();
+
+        AZStd::unique_ptr<AZ::Entity> entity(spawnTemplate.SpawnEntity(0, idMap));
+        ASSERT_NE(nullptr, entity);
+        EXPECT_NE(sourceId, entity->GetId());
+        ASSERT_EQ(1u, idMap.count(sourceId));
+        EXPECT_EQ(idMap[sourceId], entity->GetId());
+    }
+
+    TEST_F(SpawnTemplateTest, GetSpawnTemplate_EntitiesModified_TemplateIsRebuilt)
+    {
+        FillSpawnable();
+        const AzFramework::Spawnable& constSpawnable = *m_spawnable;
+        EXPECT_EQ(2u, constSpawnable.GetSpawnTemplate(*m_serializeContext).GetEntityCount());
+
+        m_spawnable->GetEntities().push_back(AZStd::make_unique<AZ::Entity>("Third"));
+        EXPECT_EQ(3u, constSpawnable.GetSpawnTemplate(*m_serializeContext).GetEntityCount());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares spawning entities from a spawn template against cloning them through the Serialize Context, which is what
+    //! the SpawnableEntitiesManager did before spawn templates were introduced.
+    class BM_SpawnTemplate
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_application = new AzFramework::Application();
+            AZ::ComponentApplication::Descriptor descriptor;
+            m_application->Start(descriptor);
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+            m_serializeContext = m_application->GetSerializeContext();
+
+            // Build a hierarchy where every entity has a transform that refers to the previous entity as its parent.
+            m_spawnable = aznew AzFramework::Spawnable();
+            AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+            const size_t entityCount = aznumeric_cast<size_t>(state.range(0));
+            entities.reserve(entityCount);
+            AZ::EntityId parentId;
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                AZ::Entity* entity = entities.emplace_back(AZStd::make_unique<AZ::Entity>()).get();
+                auto transform = entity->CreateComponent<AzFramework::TransformComponent>();
+                transform->SetParent(parentId);
+                transform->SetLocalTM(AZ::Transform::CreateTranslation(AZ::Vector3(aznumeric_cast<float>(i), 0.0f, 0.0f)));
+                parentId = entity->GetId();
+            }
+
+            m_idMap.reserve(entityCount);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_idMap = {};
+
+            delete m_spawnable;
+            m_spawnable = nullptr;
+
+            delete m_application;
+            m_application = nullptr;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void ResetIdMap()
+        {
+            m_idMap.clear();
+            const AzFramework::Spawnable& spawnable = *m_spawnable;
+            for (const AZStd::unique_ptr<AZ::Entity>& entity : spawnable.GetEntities())
+            {
+                m_idMap.emplace(entity->GetId(), AZ::Entity::MakeId());
+            }
+        }
+
+    protected:
+        AzFramework::Application* m_application{ nullptr };
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        AzFramework::Spawnable* m_spawnable{ nullptr };
+        AzFramework::SpawnTemplate::EntityIdMap m_idMap;
+    };
+
+    BENCHMARK_DEFINE_F(BM_SpawnTemplate, SpawnEntities_SerializeContextClone)(::benchmark::State& state)
+    {
+        const AzFramework::Spawnable& spawnable = *m_spawnable;
+        const AzFramework::Spawnable::EntityList& entities = spawnable.GetEntities();
+        AZStd::vector<AZ::Entity*> spawnedEntities;
+        spawnedEntities.reserve(entities.size());
+
+        for (auto _ : state)
+        {
+            ResetIdMap();
+            for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+            {
+                spawnedEntities.push_back(AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                    entity.get(), m_idMap, m_serializeContext));
+            }
+
+            state.PauseTiming();
+            for (AZ::Entity* entity : spawnedEntities)
+            {
+                delete entity;
+            }
+            spawnedEntities.clear();
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * entities.size());
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnTemplate, SpawnEntities_SerializeContextClone)
+        ->RangeMultiplier(10)
+        ->Range(10, 1000)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_SpawnTemplate, SpawnEntities_SpawnTemplate)(::benchmark::State& state)
+    {
+        const AzFramework::Spawnable& spawnable = *m_spawnable;
+        const AzFramework::SpawnTemplate& spawnTemplate = spawnable.GetSpawnTemplate(*m_serializeContext);
+        const size_t entityCount = spawnTemplate.GetEntityCount();
+        AZStd::vector<AZ::Entity*> spawnedEntities;
+        spawnedEntities.reserve(entityCount);
+
+        for (auto _ : state)
+        {
+            ResetIdMap();
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                spawnedEntities.push_back(spawnTemplate.SpawnEntity(i, m_idMap));
+            }
+
+            state.PauseTiming();
+            for (AZ::Entity* entity : spawnedEntities)
+            {
+                delete entity;
+            }
+            spawnedEntities.clear();
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * entityCount);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnTemplate, SpawnEntities_SpawnTemplate)
+        ->RangeMultiplier(10)
+        ->Range(10, 1000)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif
@@ -8,6 +8,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Application/Application.h>
+#include <AzFramework/Entity/GameEntityContextBus.h>
+#include <AzFramework/Spawnable/PoolableComponent.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -54,6 +56,115 @@ namespace UnitTest
         AZ::EntityId m_entityReference;
     };
 
+    // Test component with state that isn't serialized, for use in validating that recycled entities get fresh components.
+    class ComponentWithRuntimeState : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithRuntimeState, "{6A3C2E4B-5D0F-4E8A-9B71-2F4C8D6E1A35}");
+
+        void Init() override
+        {
+            m_initCount++;
+        }
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithRuntimeState, AZ::Component>()
+                    ->Field("Value", &ComponentWithRuntimeState::m_value)
+                    ;
+            }
+        }
+
+        AZ::u32 m_value{ 0 };
+        AZ::u32 m_runtimeValue{ 0 };
+        AZ::u32 m_initCount{ 0 };
+    };
+
+    // Test component that only holds plain data and clears its runtime state itself, so recycled entities can reset it in place.
+    class PoolableComponentWithRuntimeState
+        : public AZ::Component
+        , public AzFramework::PoolableComponent
+    {
+    public:
+        AZ_COMPONENT(PoolableComponentWithRuntimeState, "{3B9E6D1F-7C42-4A85-B0E3-91D5F2A6C874}", AzFramework::PoolableComponent);
+
+        void Init() override
+        {
+            m_initCount++;
+        }
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        void ResetForReuse() override
+        {
+            m_runtimeValue = 0;
+            m_resetCount++;
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<PoolableComponentWithRuntimeState, AZ::Component>()
+                    ->Field("Value", &PoolableComponentWithRuntimeState::m_value)
+                    ;
+            }
+        }
+
+        AZ::u32 m_value{ 0 };
+        AZ::u32 m_runtimeValue{ 0 };
+        AZ::u32 m_initCount{ 0 };
+        AZ::u32 m_resetCount{ 0 };
+    };
+
+    // Counts the entities the game entity context reports as created and destroyed.
+    class GameEntityContextEventCounter
+        : public AzFramework::EntityContextEventBus::Handler
+    {
+    public:
+        GameEntityContextEventCounter()
+        {
+            AzFramework::EntityContextId contextId = AzFramework::EntityContextId::CreateNull();
+            AzFramework::GameEntityContextRequestBus::BroadcastResult(
+                contextId, &AzFramework::GameEntityContextRequestBus::Events::GetGameEntityContextId);
+            AzFramework::EntityContextEventBus::Handler::BusConnect(contextId);
+        }
+
+        ~GameEntityContextEventCounter()
+        {
+            AzFramework::EntityContextEventBus::Handler::BusDisconnect();
+        }
+
+        void OnEntityContextCreateEntity(AZ::Entity&) override
+        {
+            m_created++;
+        }
+
+        void OnEntityContextDestroyEntity(const AZ::EntityId&) override
+        {
+            m_destroyed++;
+        }
+
+        size_t m_created{ 0 };
+        size_t m_destroyed{ 0 };
+    };
+
     class SpawnableEntitiesManagerTest : public AllocatorsFixture
     {
     public:
@@ -65,6 +176,8 @@ namespace UnitTest
             AZ::ComponentApplication::Descriptor descriptor;
             m_application->Start(descriptor);
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithRuntimeState::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(PoolableComponentWithRuntimeState::CreateDescriptor());
 
             // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
             // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
@@ -873,6 +986,285 @@ namespace UnitTest
     }
 
 
+    //
+    // Entity pooling
+    //
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_SpawnAfterDespawn_EntitiesAreReused)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId());
+
+        AZStd::vector<AZ::EntityId> firstIds;
+        AZStd::vector<AZ::EntityId> secondIds;
+        bool allActive = true;
+        auto collectIds = [&allActive](AZStd::vector<AZ::EntityId>& ids)
+        {
+            return [&ids, &allActive](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                for (const AZ::Entity* entity : entities)
+                {
+                    ids.push_back(entity->GetId());
+                    allActive = allActive && entity->GetState() == AZ::Entity::State::Active;
+                }
+            };
+        };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs firstArgs;
+        firstArgs.m_completionCallback = collectIds(firstIds);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(firstArgs));
+        m_manager->DespawnAllEntities(*m_ticket);
+        AzFramework::SpawnAllEntitiesOptionalArgs secondArgs;
+        secondArgs.m_completionCallback = collectIds(secondIds);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(secondArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        ASSERT_EQ(NumEntities, firstIds.size());
+        ASSERT_EQ(NumEntities, secondIds.size());
+        for (const AZ::EntityId& id : secondIds)
+        {
+            EXPECT_NE(firstIds.end(), AZStd::find(firstIds.begin(), firstIds.end(), id));
+        }
+        EXPECT_TRUE(allActive);
+
+        AzFramework::EntityPoolStatistics statistics = m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId());
+        EXPECT_EQ(NumEntities, statistics.m_misses);
+        EXPECT_EQ(NumEntities, statistics.m_hits);
+        EXPECT_EQ(0u, statistics.m_parked);
+        EXPECT_EQ(0u, statistics.m_discarded);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_WarmUp_FirstSpawnIsServedFromPool)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::EntityPoolSettings settings;
+        settings.m_warmUpCount = 2;
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId(), settings);
+
+        m_manager->SpawnAllEntities(*m_ticket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        AzFramework::EntityPoolStatistics statistics = m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId());
+        EXPECT_EQ(NumEntities, statistics.m_hits);
+        EXPECT_EQ(0u, statistics.m_misses);
+        EXPECT_EQ(NumEntities, statistics.m_parked);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_DespawnWithFullPool_ExtraEntitiesAreDiscarded)
+    {
+        FillSpawnable(1);
+        AzFramework::EntityPoolSettings settings;
+        settings.m_capacity = 1;
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId(), settings);
+
+        m_manager->SpawnEntities(*m_ticket, { 0, 0, 0 });
+        m_manager->DespawnAllEntities(*m_ticket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        AzFramework::EntityPoolStatistics statistics = m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId());
+        EXPECT_EQ(1u, statistics.m_parked);
+        EXPECT_EQ(2u, statistics.m_discarded);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_ReusedEntitiesReferenceOtherEntities_EntityIdsAreMappedCorrectly)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId());
+
+        auto callback = [this](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+        };
+
+        m_manager->SpawnAllEntities(*m_ticket);
+        m_manager->DespawnAllEntities(*m_ticket);
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        EXPECT_EQ(NumEntities, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_hits);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_SpawnSubset_OnlySpawnedEntitiesTakeParkedEntities)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId());
+
+        m_manager->SpawnAllEntities(*m_ticket);
+        m_manager->DespawnAllEntities(*m_ticket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        EXPECT_EQ(NumEntities, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_parked);
+
+        m_manager->SpawnEntities(*m_ticket, { 1 });
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        // Only the spawned entity is taken from the pool, the parked entities of the other template entities stay available.
+        AzFramework::EntityPoolStatistics statistics = m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId());
+        EXPECT_EQ(1u, statistics.m_hits);
+        EXPECT_EQ(NumEntities - 1, statistics.m_parked);
+
+        AzFramework::EntitySpawnTicket otherTicket(*m_spawnableAsset);
+        m_manager->SpawnAllEntities(otherTicket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        statistics = m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId());
+        EXPECT_EQ(NumEntities, statistics.m_hits);
+        EXPECT_EQ(0u, statistics.m_parked);
+
+        m_manager->DespawnAllEntities(*m_ticket);
+        m_manager->DespawnAllEntities(otherTicket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        EXPECT_EQ(NumEntities + 1, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_parked);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_ReusedEntity_ComponentsAreReplacedWithInitializedInstances)
+    {
+        static constexpr AZ::u32 TemplateValue = 7;
+        FillSpawnable(1);
+        m_spawnable->GetEntities()[0]->CreateComponent<ComponentWithRuntimeState>()->m_value = TemplateValue;
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId());
+
+        AZ::EntityId firstId;
+        auto modifyState = [&firstId](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(1u, entities.size());
+            firstId = (*entities.begin())->GetId();
+            auto component = (*entities.begin())->FindComponent<ComponentWithRuntimeState>();
+            ASSERT_NE(nullptr, component);
+            component->m_value = 42;
+            component->m_runtimeValue = 13;
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs firstArgs;
+        firstArgs.m_completionCallback = AZStd::move(modifyState);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(firstArgs));
+        m_manager->DespawnAllEntities(*m_ticket);
+
+        bool validated = false;
+        auto validateState = [&firstId, &validated](
+            AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(1u, entities.size());
+            EXPECT_EQ(firstId, (*entities.begin())->GetId());
+            auto component = (*entities.begin())->FindComponent<ComponentWithRuntimeState>();
+            ASSERT_NE(nullptr, component);
+            EXPECT_EQ(TemplateValue, component->m_value);
+            EXPECT_EQ(0u, component->m_runtimeValue);
+            EXPECT_EQ(1u, component->m_initCount);
+            validated = true;
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs secondArgs;
+        secondArgs.m_completionCallback = AZStd::move(validateState);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(secondArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        EXPECT_TRUE(validated);
+        EXPECT_EQ(1u, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_hits);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_ReusedEntity_PoolableComponentsAreResetInPlace)
+    {
+        static constexpr AZ::u32 TemplateValue = 7;
+        FillSpawnable(1);
+        m_spawnable->GetEntities()[0]->CreateComponent<PoolableComponentWithRuntimeState>()->m_value = TemplateValue;
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId());
+
+        const PoolableComponentWithRuntimeState* firstComponent = nullptr;
+        auto modifyState = [&firstComponent](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(1u, entities.size());
+            auto component = (*entities.begin())->FindComponent<PoolableComponentWithRuntimeState>();
+            ASSERT_NE(nullptr, component);
+            component->m_value = 42;
+            component->m_runtimeValue = 13;
+            firstComponent = component;
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs firstArgs;
+        firstArgs.m_completionCallback = AZStd::move(modifyState);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(firstArgs));
+        m_manager->DespawnAllEntities(*m_ticket);
+
+        bool validated = false;
+        auto validateState = [&firstComponent, &validated](
+            AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(1u, entities.size());
+            auto component = (*entities.begin())->FindComponent<PoolableComponentWithRuntimeState>();
+            EXPECT_EQ(firstComponent, component);
+            ASSERT_NE(nullptr, component);
+            EXPECT_EQ(TemplateValue, component->m_value);
+            EXPECT_EQ(0u, component->m_runtimeValue);
+            EXPECT_EQ(1u, component->m_initCount);
+            EXPECT_EQ(1u, component->m_resetCount);
+            validated = true;
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs secondArgs;
+        secondArgs.m_completionCallback = AZStd::move(validateState);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(secondArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        EXPECT_TRUE(validated);
+        EXPECT_EQ(1u, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_hits);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_ParkAndRecycle_GameEntityContextIsNotified)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId());
+
+        GameEntityContextEventCounter counter;
+        m_manager->SpawnAllEntities(*m_ticket);
+        m_manager->DespawnAllEntities(*m_ticket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        EXPECT_EQ(NumEntities, counter.m_created);
+        EXPECT_EQ(NumEntities, counter.m_destroyed);
+        EXPECT_EQ(NumEntities, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_parked);
+
+        m_manager->SpawnAllEntities(*m_ticket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        EXPECT_EQ(NumEntities * 2, counter.m_created);
+        EXPECT_EQ(NumEntities, counter.m_destroyed);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, EntityPooling_Disable_ParkedEntitiesAreDestroyed)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->EnableEntityPooling(m_spawnableAsset->GetId());
+
+        AZStd::vector<AZ::EntityId> spawnedIds;
+        auto callback = [&spawnedIds](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                spawnedIds.push_back(entity->GetId());
+            }
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->DespawnAllEntities(*m_ticket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        EXPECT_EQ(NumEntities, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_parked);
+
+        m_manager->DisableEntityPooling(m_spawnableAsset->GetId());
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        for (const AZ::EntityId& id : spawnedIds)
+        {
+            AZ::Entity* entity = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationBus::Events::FindEntity, id);
+            EXPECT_EQ(nullptr, entity);
+        }
+        EXPECT_EQ(0u, m_manager->GetEntityPoolStatistics(m_spawnableAsset->GetId()).m_parked);
+    }
+
+
     //
     // Misc. - Priority tests
     //
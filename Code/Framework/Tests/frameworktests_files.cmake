@@ -8,6 +8,7 @@
 set(FILES
     ../AzCore/Tests/Main.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
+    Spawnable/SpawnTemplateTests.cpp
     ArchiveCompressionTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
@@ -23,6 +24,7 @@ set(FILES
     FileIO.cpp
     FileTagTests.cpp
     FrameworkApplicationFixture.h
+    GameEntityContextActivationTests.cpp
     GenAppDescriptors.cpp
     GenericComponentWrapperTest.cpp
     InstanceDataHierarchy.cpp
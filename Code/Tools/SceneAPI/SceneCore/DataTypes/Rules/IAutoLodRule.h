@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/IRule.h>
+
+namespace AZ
+{
+    namespace SceneAPI
+    {
+        namespace DataTypes
+        {
+            //! Requests that levels of detail are generated by simplifying the base mesh
+            //! when no levels of detail have been authored for a mesh group.
+            class IAutoLodRule
+                : public IRule
+            {
+            public:
+                AZ_RTTI(IAutoLodRule, "{5A0C92E4-4C78-4E1D-A67C-5B2D3A39B3F1}", IRule);
+
+                virtual ~IAutoLodRule() override = default;
+
+                //! Number of levels of detail to generate in addition to the base mesh.
+                virtual size_t GetLodCount() const = 0;
+                //! Fraction of the base mesh triangles to keep for the given generated lod (0 is the first generated lod).
+                virtual float GetTriangleRatio(size_t lodIndex) const = 0;
+                //! Largest on-screen error in pixels, at 1080p, that's allowed before switching to a more detailed lod.
+                virtual float GetPixelErrorThreshold() const = 0;
+                //! Keep vertices that are split for uv seams, hard edges or other attribute discontinuities in place.
+                virtual bool PreserveSeams() const = 0;
+                //! Keep vertices on open borders, including the boundaries between material sections, in place.
+                virtual bool LockBorders() const = 0;
+            };
+        }  // DataTypes
+    }  // SceneAPI
+}  // AZ
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <SceneAPI/SceneCore/Utilities/MeshSimplifier.h>
+
+namespace AZ
+{
+    namespace SceneAPI
+    {
+        namespace Utilities
+        {
+            class MeshSimplifierTest
+                : public UnitTest::AllocatorsTestFixture
+            {
+            protected:
+                // Builds a flat grid in the XY plane with (cellCount + 1)^2 vertices and 2 * cellCount^2 triangles.
+                void BuildGrid(AZ::u32 cellCount)
+                {
+                    const AZ::u32 rowSize = cellCount + 1;
+                    for (AZ::u32 y = 0; y < rowSize; ++y)
+                    {
+                        for (AZ::u32 x = 0; x < rowSize; ++x)
+                        {
+                            m_positions.push_back(aznumeric_cast<float>(x));
+                            m_positions.push_back(aznumeric_cast<float>(y));
+                            m_positions.push_back(0.0f);
+                        }
+                    }
+                    for (AZ::u32 y = 0; y < cellCount; ++y)
+                    {
+                        for (AZ::u32 x = 0; x < cellCount; ++x)
+                        {
+                            const AZ::u32 i0 = y * rowSize + x;
+                            const AZ::u32 i1 = i0 + 1;
+                            const AZ::u32 i2 = i0 + rowSize;
+                            const AZ::u32 i3 = i2 + 1;
+                            m_indices.insert(m_indices.end(), { i0, i1, i3, i0, i3, i2 });
+                        }
+                    }
+                }
+
+                size_t GetVertexCount() const
+                {
+                    return m_positions.size() / 3;
+                }
+
+                AZStd::vector<float> m_positions;
+                AZStd::vector<AZ::u32> m_indices;
+            };
+
+            TEST_F(MeshSimplifierTest, Simplify_RatioOfOne_ReturnsInputIndices)
+            {
+                BuildGrid(4);
+                MeshSimplifier::Settings settings;
+                settings.m_targetTriangleRatio = 1.0f;
+                MeshSimplifier::Result result = MeshSimplifier::Simplify(m_positions.data(), GetVertexCount(), m_indices.data(), m_indices.size(), settings);
+                EXPECT_EQ(m_indices, result.m_indices);
+                EXPECT_FLOAT_EQ(0.0f, result.m_error);
+            }
+
+            TEST_F(MeshSimplifierTest, Simplify_FlatGridWithFreeBorders_ReachesTargetWithoutError)
+            {
+                BuildGrid(8);
+                MeshSimplifier::Settings settings;
+                settings.m_targetTriangleRatio = 0.25f;
+                settings.m_lockBorders = false;
+                MeshSimplifier::Result result = MeshSimplifier::Simplify(m_positions.data(), GetVertexCount(), m_indices.data(), m_indices.size(), settings);
+
+                EXPECT_EQ(0, result.m_indices.size() % 3);
+                EXPECT_LE(result.m_indices.size(), m_indices.size() / 4);
+                EXPECT_GT(result.m_indices.size(), 0);
+                EXPECT_NEAR(0.0f, result.m_error, 0.001f);
+            }
+
+            TEST_F(MeshSimplifierTest, Simplify_LockedBorders_KeepsEveryBorderVertex)
+            {
+                const AZ::u32 cellCount = 8;
+                BuildGrid(cellCount);
+                MeshSimplifier::Settings settings;
+                settings.m_targetTriangleRatio = 0.1f;
+                MeshSimplifier::Result result = MeshSimplifier::Simplify(m_positions.data(), GetVertexCount(), m_indices.data(), m_indices.size(), settings);
+
+                EXPECT_LT(result.m_indices.size(), m_indices.size());
+                for (AZ::u32 i = 0; i < GetVertexCount(); ++i)
+                {
+                    const AZ::u32 x = i % (cellCount + 1);
+                    const AZ::u32 y = i / (cellCount + 1);
+                    if (x == 0 || y == 0 || x == cellCount || y == cellCount)
+                    {
+                        EXPECT_NE(result.m_indices.end(), AZStd::find(result.m_indices.begin(), result.m_indices.end(), i));
+                    }
+                }
+            }
+
+            TEST_F(MeshSimplifierTest, Simplify_SeamVertices_AreNeverRemoved)
+            {
+                const AZ::u32 cellCount = 8;
+                BuildGrid(cellCount);
+
+                // Split the middle column of vertices into two copies, as an uv seam would, and point the right half at the copies.
+                const AZ::u32 seamColumn = cellCount / 2;
+                const AZ::u32 originalVertexCount = aznumeric_cast<AZ::u32>(GetVertexCount());
+                AZStd::vector<AZ::u32> seamCopies(originalVertexCount, 0);
+                for (AZ::u32 y = 0; y <= cellCount; ++y)
+                {
+                    const AZ::u32 vertex = y * (cellCount + 1) + seamColumn;
+                    seamCopies[vertex] = aznumeric_cast<AZ::u32>(GetVertexCount());
+                    m_positions.insert(m_positions.end(), { m_positions[vertex * 3], m_positions[vertex * 3 + 1], m_positions[vertex * 3 + 2] });
+                }
+                for (size_t i = 0; i < m_indices.size(); i += 3)
+                {
+                    bool rightHalf = false;
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        rightHalf |= (m_indices[i + corner] % (cellCount + 1)) > seamColumn;
+                    }
+                    for (size_t corner = 0; rightHalf && corner < 3; ++corner)
+                    {
+                        if (m_indices[i + corner] % (cellCount + 1) == seamColumn)
+                        {
+                            m_indices[i + corner] = seamCopies[m_indices[i + corner]];
+                        }
+                    }
+                }
+
+                MeshSimplifier::Settings settings;
+                settings.m_targetTriangleRatio = 0.1f;
+                MeshSimplifier::Result result = MeshSimplifier::Simplify(m_positions.data(), GetVertexCount(), m_indices.data(), m_indices.size(), settings);
+
+                EXPECT_LT(result.m_indices.size(), m_indices.size());
+                for (AZ::u32 i = originalVertexCount; i < GetVertexCount(); ++i)
+                {
+                    EXPECT_NE(result.m_indices.end(), AZStd::find(result.m_indices.begin(), result.m_indices.end(), i));
+                }
+            }
+
+            TEST_F(MeshSimplifierTest, Simplify_MaxError_StopsBeforeBendingTheSurface)
+            {
+                // Two quads folded at a right angle. Any collapse across the fold introduces error.
+                m_positions = {
+                    0.0f, 0.0f, 0.0f,  1.0f, 0.0f, 0.0f,  2.0f, 0.0f, 0.0f,
+                    0.0f, 1.0f, 0.0f,  1.0f, 1.0f, 0.0f,  1.0f, 1.0f, 1.0f,
+                };
+                m_indices = { 0, 1, 4, 0, 4, 3, 1, 2, 5, 1, 5, 4 };
+
+                MeshSimplifier::Settings settings;
+                settings.m_targetTriangleRatio = 0.25f;
+                settings.m_lockBorders = false;
+                settings.m_maxError = 0.001f;
+                MeshSimplifier::Result result = MeshSimplifier::Simplify(m_positions.data(), GetVertexCount(), m_indices.data(), m_indices.size(), settings);
+                EXPECT_LE(result.m_error, 0.001f);
+            }
+
+            TEST_F(MeshSimplifierTest, CompactVertices_UnreferencedVertices_AreRemoved)
+            {
+                AZStd::vector<AZ::u32> indices = { 5, 2, 7, 7, 2, 9 };
+                AZStd::vector<AZ::u32> newToOld = MeshSimplifier::CompactVertices(indices, 10);
+
+                const AZStd::vector<AZ::u32> expectedIndices = { 0, 1, 2, 2, 1, 3 };
+                const AZStd::vector<AZ::u32> expectedNewToOld = { 5, 2, 7, 9 };
+                EXPECT_EQ(expectedIndices, indices);
+                EXPECT_EQ(expectedNewToOld, newToOld);
+            }
+        } // Utilities
+    } // SceneAPI
+} // AZ
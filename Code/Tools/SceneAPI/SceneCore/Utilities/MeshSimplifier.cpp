@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <SceneAPI/SceneCore/Utilities/MeshSimplifier.h>
+
+namespace AZ::SceneAPI::Utilities
+{
+    namespace
+    {
+        constexpr AZ::u32 InvalidIndex = AZStd::numeric_limits<AZ::u32>::max();
+        constexpr size_t MaxPasses = 64;
+        // Border planes are weighted heavier than face planes so open borders only move when there's no alternative.
+        constexpr double BorderPlaneWeight = 10.0;
+
+        struct Vec3d
+        {
+            double x;
+            double y;
+            double z;
+        };
+
+        Vec3d LoadPosition(const float* positions, AZ::u32 index)
+        {
+            const float* p = positions + index * 3;
+            return Vec3d{ p[0], p[1], p[2] };
+        }
+
+        Vec3d Sub(const Vec3d& a, const Vec3d& b)
+        {
+            return Vec3d{ a.x - b.x, a.y - b.y, a.z - b.z };
+        }
+
+        Vec3d Cross(const Vec3d& a, const Vec3d& b)
+        {
+            return Vec3d{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+        }
+
+        double Dot(const Vec3d& a, const Vec3d& b)
+        {
+            return a.x * b.x + a.y * b.y + a.z * b.z;
+        }
+
+        // Symmetric 4x4 matrix representing the sum of squared distances to a set of planes.
+        struct Quadric
+        {
+            double m_a2 = 0.0, m_ab = 0.0, m_ac = 0.0, m_ad = 0.0;
+            double m_b2 = 0.0, m_bc = 0.0, m_bd = 0.0;
+            double m_c2 = 0.0, m_cd = 0.0;
+            double m_d2 = 0.0;
+
+            static Quadric CreateFromPlane(const Vec3d& normal, double d, double weight)
+            {
+                Quadric q;
+                q.m_a2 = weight * normal.x * normal.x;
+                q.m_ab = weight * normal.x * normal.y;
+                q.m_ac = weight * normal.x * normal.z;
+                q.m_ad = weight * normal.x * d;
+                q.m_b2 = weight * normal.y * normal.y;
+                q.m_bc = weight * normal.y * normal.z;
+                q.m_bd = weight * normal.y * d;
+                q.m_c2 = weight * normal.z * normal.z;
+                q.m_cd = weight * normal.z * d;
+                q.m_d2 = weight * d * d;
+                return q;
+            }
+
+            void Add(const Quadric& rhs)
+            {
+                m_a2 += rhs.m_a2; m_ab += rhs.m_ab; m_ac += rhs.m_ac; m_ad += rhs.m_ad;
+                m_b2 += rhs.m_b2; m_bc += rhs.m_bc; m_bd += rhs.m_bd;
+                m_c2 += rhs.m_c2; m_cd += rhs.m_cd;
+                m_d2 += rhs.m_d2;
+            }
+
+            double Evaluate(const Vec3d& p) const
+            {
+                const double result =
+                    m_a2 * p.x * p.x + 2.0 * m_ab * p.x * p.y + 2.0 * m_ac * p.x * p.z + 2.0 * m_ad * p.x +
+                    m_b2 * p.y * p.y + 2.0 * m_bc * p.y * p.z + 2.0 * m_bd * p.y +
+                    m_c2 * p.z * p.z + 2.0 * m_cd * p.z +
+                    m_d2;
+                // Rounding can push the result slightly below zero for points on the planes.
+                return result > 0.0 ? result : 0.0;
+            }
+        };
+
+        AZ::u64 MakeEdgeKey(AZ::u32 a, AZ::u32 b)
+        {
+            return a < b ? (aznumeric_cast<AZ::u64>(a) << 32) | b : (aznumeric_cast<AZ::u64>(b) << 32) | a;
+        }
+
+        // Maps every vertex to the first vertex that has the exact same position.
+        AZStd::vector<AZ::u32> BuildPositionRemap(const float* positions, size_t vertexCount)
+        {
+            AZStd::vector<AZ::u32> sorted(vertexCount);
+            for (AZ::u32 i = 0; i < vertexCount; ++i)
+            {
+                sorted[i] = i;
+            }
+
+            auto lessThan = [positions](AZ::u32 lhs, AZ::u32 rhs)
+            {
+                const float* a = positions + lhs * 3;
+                const float* b = positions + rhs * 3;
+                if (a[0] != b[0])
+                {
+                    return a[0] < b[0];
+                }
+                if (a[1] != b[1])
+                {
+                    return a[1] < b[1];
+                }
+                if (a[2] != b[2])
+                {
+                    return a[2] < b[2];
+                }
+                return lhs < rhs;
+            };
+            AZStd::sort(sorted.begin(), sorted.end(), lessThan);
+
+            AZStd::vector<AZ::u32> remap(vertexCount);
+            size_t groupStart = 0;
+            for (size_t i = 0; i < vertexCount; ++i)
+            {
+                const float* first = positions + sorted[groupStart] * 3;
+                const float* current = positions + sorted[i] * 3;
+                if (first[0] != current[0] || first[1] != current[1] || first[2] != current[2])
+                {
+                    groupStart = i;
+                }
+                remap[sorted[i]] = sorted[groupStart];
+            }
+            return remap;
+        }
+
+        // Returns true if moving 'from' onto 'to' would turn any of the remaining triangles around 'from' inside out.
+        bool CollapseFlipsTriangle(
+            const float* positions, const AZStd::vector<AZ::u32>& indices, const AZStd::vector<AZ::u32>& collapseRemap,
+            const AZStd::vector<AZ::u32>& triangleOffsets, const AZStd::vector<AZ::u32>& vertexTriangles, AZ::u32 from, AZ::u32 to)
+        {
+            const Vec3d target = LoadPosition(positions, to);
+            for (AZ::u32 i = triangleOffsets[from]; i < triangleOffsets[from + 1]; ++i)
+            {
+                const AZ::u32 triangle = vertexTriangles[i];
+                AZ::u32 corners[3];
+                for (size_t corner = 0; corner < 3; ++corner)
+                {
+                    corners[corner] = collapseRemap[indices[triangle * 3 + corner]];
+                }
+                if (corners[0] == to || corners[1] == to || corners[2] == to)
+                {
+                    // This triangle will degenerate and be removed.
+                    continue;
+                }
+
+                Vec3d before[3];
+                Vec3d after[3];
+                for (size_t corner = 0; corner < 3; ++corner)
+                {
+                    before[corner] = LoadPosition(positions, corners[corner]);
+                    after[corner] = corners[corner] == from ? target : before[corner];
+                }
+
+                const Vec3d normalBefore = Cross(Sub(before[1], before[0]), Sub(before[2], before[0]));
+                const Vec3d normalAfter = Cross(Sub(after[1], after[0]), Sub(after[2], after[0]));
+                if (Dot(normalBefore, normalAfter) <= 0.0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace
+
+    MeshSimplifier::Result MeshSimplifier::Simplify(
+        const float* positions, size_t vertexCount, const AZ::u32* indices, size_t indexCount, const Settings& settings)
+    {
+        AZ_Assert(indexCount % 3 == 0, "Index count (%zu) must be a multiple of 3.", indexCount);
+
+        Result result;
+        result.m_indices.assign(indices, indices + indexCount);
+
+        const size_t triangleCount = indexCount / 3;
+        const float ratio = AZ::GetClamp(settings.m_targetTriangleRatio, 0.0f, 1.0f);
+        const size_t targetTriangleCount = AZStd::max<size_t>(1, aznumeric_cast<size_t>(triangleCount * ratio));
+        if (triangleCount <= targetTriangleCount || vertexCount == 0)
+        {
+            return result;
+        }
+
+        const AZStd::vector<AZ::u32> positionRemap = BuildPositionRemap(positions, vertexCount);
+
+        // Lock vertices that split an attribute seam and vertices on open borders.
+        AZStd::vector<bool> locked(vertexCount, false);
+        if (settings.m_preserveSeams)
+        {
+            for (AZ::u32 i = 0; i < vertexCount; ++i)
+            {
+                if (positionRemap[i] != i)
+                {
+                    locked[i] = true;
+                    locked[positionRemap[i]] = true;
+                }
+            }
+        }
+
+        // Edges are counted on welded positions so edges duplicated along seams aren't treated as borders.
+        AZStd::vector<AZ::u64> edgeKeys;
+        edgeKeys.reserve(indexCount);
+        for (size_t i = 0; i < indexCount; i += 3)
+        {
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                const AZ::u32 a = positionRemap[indices[i + corner]];
+                const AZ::u32 b = positionRemap[indices[i + (corner + 1) % 3]];
+                edgeKeys.push_back(MakeEdgeKey(a, b));
+            }
+        }
+        AZStd::vector<AZ::u64> sortedEdgeKeys = edgeKeys;
+        AZStd::sort(sortedEdgeKeys.begin(), sortedEdgeKeys.end());
+        auto isBorderEdge = [&sortedEdgeKeys](AZ::u64 key)
+        {
+            auto first = AZStd::lower_bound(sortedEdgeKeys.begin(), sortedEdgeKeys.end(), key);
+            auto last = AZStd::upper_bound(first, sortedEdgeKeys.end(), key);
+            return AZStd::distance(first, last) == 1;
+        };
+
+        // Accumulate the face (and border) planes into a quadric per welded position.
+        AZStd::vector<Quadric> quadrics(vertexCount);
+        for (size_t i = 0; i < indexCount; i += 3)
+        {
+            const Vec3d p0 = LoadPosition(positions, indices[i + 0]);
+            const Vec3d p1 = LoadPosition(positions, indices[i + 1]);
+            const Vec3d p2 = LoadPosition(positions, indices[i + 2]);
+            Vec3d normal = Cross(Sub(p1, p0), Sub(p2, p0));
+            const double length = sqrt(Dot(normal, normal));
+            if (length <= 0.0)
+            {
+                continue;
+            }
+            normal = Vec3d{ normal.x / length, normal.y / length, normal.z / length };
+
+            const Quadric faceQuadric = Quadric::CreateFromPlane(normal, -Dot(normal, p0), 1.0);
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                quadrics[positionRemap[indices[i + corner]]].Add(faceQuadric);
+            }
+
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                const AZ::u32 a = indices[i + corner];
+                const AZ::u32 b = indices[i + (corner + 1) % 3];
+                if (!isBorderEdge(edgeKeys[i + corner]))
+                {
+                    continue;
+                }
+
+                if (settings.m_lockBorders)
+                {
+                    locked[a] = true;
+                    locked[b] = true;
+                    locked[positionRemap[a]] = true;
+                    locked[positionRemap[b]] = true;
+                    continue;
+                }
+
+                const Vec3d pa = LoadPosition(positions, a);
+                Vec3d borderNormal = Cross(Sub(LoadPosition(positions, b), pa), normal);
+                const double borderLength = sqrt(Dot(borderNormal, borderNormal));
+                if (borderLength > 0.0)
+                {
+                    borderNormal = Vec3d{ borderNormal.x / borderLength, borderNormal.y / borderLength, borderNormal.z / borderLength };
+                    const Quadric borderQuadric = Quadric::CreateFromPlane(borderNormal, -Dot(borderNormal, pa), BorderPlaneWeight);
+                    quadrics[positionRemap[a]].Add(borderQuadric);
+                    quadrics[positionRemap[b]].Add(borderQuadric);
+                }
+            }
+        }
+
+        struct Collapse
+        {
+            AZ::u32 m_from;
+            AZ::u32 m_to;
+            double m_cost;
+        };
+        AZStd::vector<Collapse> collapses;
+        AZStd::vector<AZ::u32> collapseRemap(vertexCount);
+        AZStd::vector<bool> touched(vertexCount);
+        AZStd::vector<AZ::u32> triangleOffsets(vertexCount + 1);
+        AZStd::vector<AZ::u32> vertexTriangles;
+
+        const double maxErrorSq = settings.m_maxError < AZStd::numeric_limits<float>::max()
+            ? aznumeric_cast<double>(settings.m_maxError) * settings.m_maxError
+            : AZStd::numeric_limits<double>::max();
+        double largestCost = 0.0;
+
+        for (size_t pass = 0; pass < MaxPasses && result.m_indices.size() / 3 > targetTriangleCount; ++pass)
+        {
+            AZStd::vector<AZ::u32>& current = result.m_indices;
+            const size_t currentTriangleCount = current.size() / 3;
+
+            // Build the vertex to triangle adjacency for the current triangle list.
+            AZStd::fill(triangleOffsets.begin(), triangleOffsets.end(), 0);
+            for (AZ::u32 index : current)
+            {
+                ++triangleOffsets[index + 1];
+            }
+            for (size_t i = 0; i < vertexCount; ++i)
+            {
+                triangleOffsets[i + 1] += triangleOffsets[i];
+            }
+            vertexTriangles.resize(current.size());
+            {
+                AZStd::vector<AZ::u32> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+                for (size_t i = 0; i < current.size(); ++i)
+                {
+                    vertexTriangles[fill[current[i]]++] = aznumeric_cast<AZ::u32>(i / 3);
+                }
+            }
+
+            // Gather every unique edge and pick the cheapest direction to collapse it in.
+            AZStd::vector<AZ::u64> passEdges;
+            passEdges.reserve(current.size());
+            for (size_t i = 0; i < current.size(); i += 3)
+            {
+                for (size_t corner = 0; corner < 3; ++corner)
+                {
+                    passEdges.push_back(MakeEdgeKey(current[i + corner], current[i + (corner + 1) % 3]));
+                }
+            }
+            AZStd::sort(passEdges.begin(), passEdges.end());
+            passEdges.erase(AZStd::unique(passEdges.begin(), passEdges.end()), passEdges.end());
+
+            collapses.clear();
+            for (AZ::u64 key : passEdges)
+            {
+                const AZ::u32 a = aznumeric_cast<AZ::u32>(key >> 32);
+                const AZ::u32 b = aznumeric_cast<AZ::u32>(key & 0xFFFFFFFF);
+                const double costAB = locked[a] ? AZStd::numeric_limits<double>::max() :
+                    quadrics[positionRemap[a]].Evaluate(LoadPosition(positions, b)) + quadrics[positionRemap[b]].Evaluate(LoadPosition(positions, b));
+                const double costBA = locked[b] ? AZStd::numeric_limits<double>::max() :
+                    quadrics[positionRemap[a]].Evaluate(LoadPosition(positions, a)) + quadrics[positionRemap[b]].Evaluate(LoadPosition(positions, a));
+                if (costAB == AZStd::numeric_limits<double>::max() && costBA == AZStd::numeric_limits<double>::max())
+                {
+                    continue;
+                }
+                collapses.push_back(costAB <= costBA ? Collapse{ a, b, costAB } : Collapse{ b, a, costBA });
+            }
+            AZStd::sort(collapses.begin(), collapses.end(),
+                [](const Collapse& lhs, const Collapse& rhs) { return lhs.m_cost < rhs.m_cost; });
+
+            for (AZ::u32 i = 0; i < vertexCount; ++i)
+            {
+                collapseRemap[i] = i;
+            }
+            AZStd::fill(touched.begin(), touched.end(), false);
+
+            const size_t trianglesToRemove = currentTriangleCount - targetTriangleCount;
+            size_t removedTriangles = 0;
+            size_t collapseCount = 0;
+            for (const Collapse& collapse : collapses)
+            {
+                if (removedTriangles >= trianglesToRemove || collapse.m_cost > maxErrorSq)
+                {
+                    break;
+                }
+                if (touched[collapse.m_from] || touched[collapse.m_to])
+                {
+                    continue;
+                }
+                if (CollapseFlipsTriangle(positions, current, collapseRemap, triangleOffsets, vertexTriangles, collapse.m_from, collapse.m_to))
+                {
+                    continue;
+                }
+
+                for (AZ::u32 i = triangleOffsets[collapse.m_from]; i < triangleOffsets[collapse.m_from + 1]; ++i)
+                {
+                    const AZ::u32 triangle = vertexTriangles[i];
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        if (collapseRemap[current[triangle * 3 + corner]] == collapse.m_to)
+                        {
+                            ++removedTriangles;
+                            break;
+                        }
+                    }
+                }
+
+                collapseRemap[collapse.m_from] = collapse.m_to;
+                quadrics[positionRemap[collapse.m_to]].Add(quadrics[positionRemap[collapse.m_from]]);
+                touched[collapse.m_from] = true;
+                touched[collapse.m_to] = true;
+                largestCost = AZStd::max(largestCost, collapse.m_cost);
+                ++collapseCount;
+            }
+
+            if (collapseCount == 0)
+            {
+                break;
+            }
+
+            // Apply the collapses and drop the triangles that became degenerate.
+            size_t writeIndex = 0;
+            for (size_t i = 0; i < current.size(); i += 3)
+            {
+                const AZ::u32 a = collapseRemap[current[i + 0]];
+                const AZ::u32 b = collapseRemap[current[i + 1]];
+                const AZ::u32 c = collapseRemap[current[i + 2]];
+                if (a == b || b == c || c == a)
+                {
+                    continue;
+                }
+                current[writeIndex++] = a;
+                current[writeIndex++] = b;
+                current[writeIndex++] = c;
+            }
+            current.resize(writeIndex);
+        }
+
+        result.m_error = aznumeric_cast<float>(sqrt(largestCost));
+        return result;
+    }
+
+    AZStd::vector<AZ::u32> MeshSimplifier::CompactVertices(AZStd::vector<AZ::u32>& indices, size_t vertexCount)
+    {
+        AZStd::vector<AZ::u32> oldToNew(vertexCount, InvalidIndex);
+        AZStd::vector<AZ::u32> newToOld;
+        newToOld.reserve(vertexCount);
+        for (AZ::u32& index : indices)
+        {
+            if (oldToNew[index] == InvalidIndex)
+            {
+                oldToNew[index] = aznumeric_cast<AZ::u32>(newToOld.size());
+                newToOld.push_back(index);
+            }
+            index = oldToNew[index];
+        }
+        return newToOld;
+    }
+} // namespace AZ::SceneAPI::Utilities
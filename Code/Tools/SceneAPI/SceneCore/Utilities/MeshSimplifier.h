@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <SceneAPI/SceneCore/SceneCoreConfiguration.h>
+
+namespace AZ::SceneAPI::Utilities
+{
+    // MeshSimplifier reduces the triangle count of an indexed triangle list using quadric error metrics
+    // (Garland & Heckbert) and half-edge collapses. A half-edge collapse moves one vertex onto one of its
+    // neighbors instead of creating a new vertex, so every vertex that survives keeps its original
+    // attributes (uvs, colors, tangents, skin weights) and the vertex buffers can be reused as-is.
+    // Vertices that share a position with another vertex (attribute seams such as uv seams or hard edges)
+    // and vertices on open borders can be locked so the silhouette and texture layout are preserved.
+    class MeshSimplifier
+    {
+    public:
+        struct Settings
+        {
+            //! Fraction of the input triangles to keep, in the range (0, 1].
+            float m_targetTriangleRatio = 0.5f;
+            //! Upper bound on the geometric error (in mesh units) introduced by a single collapse.
+            float m_maxError = AZStd::numeric_limits<float>::max();
+            //! Prevent vertices that share their position with other vertices from moving.
+            bool m_preserveSeams = true;
+            //! Prevent vertices on open borders from moving.
+            bool m_lockBorders = true;
+        };
+
+        struct Result
+        {
+            AZStd::vector<AZ::u32> m_indices;
+            //! The largest geometric error introduced by the simplification, in mesh units.
+            float m_error = 0.0f;
+        };
+
+        //! Simplifies the triangle list described by indices. Positions are tightly packed xyz floats.
+        //! The returned index list references the same vertices as the input and never contains new ones.
+        SCENE_CORE_API static Result Simplify(
+            const float* positions, size_t vertexCount, const AZ::u32* indices, size_t indexCount, const Settings& settings);
+
+        //! Compacts a set of vertices to the ones referenced by indices. The indices are rewritten in place and
+        //! the returned list maps every new vertex to the vertex it was copied from.
+        SCENE_CORE_API static AZStd::vector<AZ::u32> CompactVertices(AZStd::vector<AZ::u32>& indices, size_t vertexCount);
+    };
+} // namespace AZ::SceneAPI::Utilities
@@ -38,6 +38,7 @@ set(FILES
     DataTypes/Rules/IBlendShapeRule.h
     DataTypes/Rules/ICommentRule.h
     DataTypes/Rules/ILodRule.h
+    DataTypes/Rules/IAutoLodRule.h
     DataTypes/Rules/IMeshAdvancedRule.h
     DataTypes/Rules/IMaterialRule.h
     DataTypes/Rules/IScriptProcessorRule.h
@@ -130,6 +131,8 @@ set(FILES
     Utilities/Reporting.h
     Utilities/PatternMatcher.h
     Utilities/PatternMatcher.cpp
+    Utilities/MeshSimplifier.h
+    Utilities/MeshSimplifier.cpp
     Utilities/HashHelper.h
     Utilities/DebugOutput.h
     Utilities/DebugOutput.cpp
@@ -30,5 +30,6 @@ set(FILES
     Tests/Containers/Utilities/FiltersTests.cpp
     Tests/Utilities/SceneGraphSelectorTests.cpp
     Tests/Utilities/PatternMatcherTests.cpp
+    Tests/Utilities/MeshSimplifierTests.cpp
     Tests/Export/MaterialIOTests.cpp
 )
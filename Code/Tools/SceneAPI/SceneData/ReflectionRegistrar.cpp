@@ -13,6 +13,7 @@
 #include <SceneAPI/SceneData/Rules/BlendShapeRule.h>
 #include <SceneAPI/SceneData/Rules/CommentRule.h>
 #include <SceneAPI/SceneData/Rules/LodRule.h>
+#include <SceneAPI/SceneData/Rules/AutoLodRule.h>
 #include <SceneAPI/SceneData/Rules/StaticMeshAdvancedRule.h>
 #include <SceneAPI/SceneData/Rules/SkinMeshAdvancedRule.h>
 #include <SceneAPI/SceneData/Rules/MaterialRule.h>
@@ -64,6 +65,7 @@ namespace AZ
             SceneData::BlendShapeRule::Reflect(context);
             SceneData::CommentRule::Reflect(context);
             SceneData::LodRule::Reflect(context);
+            SceneData::AutoLodRule::Reflect(context);
             SceneData::StaticMeshAdvancedRule::Reflect(context);
             SceneData::MaterialRule::Reflect(context);
             SceneData::ScriptProcessorRule::Reflect(context);
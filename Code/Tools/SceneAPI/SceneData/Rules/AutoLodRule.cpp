@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <SceneAPI/SceneData/Rules/AutoLodRule.h>
+
+namespace AZ
+{
+    namespace SceneAPI
+    {
+        namespace SceneData
+        {
+            const size_t AutoLodRule::s_maxLods;
+
+            AZ_CLASS_ALLOCATOR_IMPL(AutoLodRule, SystemAllocator, 0)
+
+            AutoLodRule::AutoLodRule()
+                : m_triangleRatios({ 0.5f, 0.25f, 0.125f })
+            {
+            }
+
+            size_t AutoLodRule::GetLodCount() const
+            {
+                return AZStd::min(m_triangleRatios.size(), s_maxLods);
+            }
+
+            float AutoLodRule::GetTriangleRatio(size_t lodIndex) const
+            {
+                if (lodIndex < GetLodCount())
+                {
+                    return AZ::GetClamp(m_triangleRatios[lodIndex], 0.0f, 1.0f);
+                }
+                return 1.0f;
+            }
+
+            float AutoLodRule::GetPixelErrorThreshold() const
+            {
+                return m_pixelErrorThreshold;
+            }
+
+            bool AutoLodRule::PreserveSeams() const
+            {
+                return m_preserveSeams;
+            }
+
+            bool AutoLodRule::LockBorders() const
+            {
+                return m_lockBorders;
+            }
+
+            void AutoLodRule::SetTriangleRatios(AZStd::vector<float> ratios)
+            {
+                m_triangleRatios = AZStd::move(ratios);
+            }
+
+            void AutoLodRule::Reflect(ReflectContext* context)
+            {
+                SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context);
+                if (!serializeContext)
+                {
+                    return;
+                }
+
+                serializeContext->Class<AutoLodRule, DataTypes::IAutoLodRule>()->Version(1)
+                    ->Field("triangleRatios", &AutoLodRule::m_triangleRatios)
+                    ->Field("pixelErrorThreshold", &AutoLodRule::m_pixelErrorThreshold)
+                    ->Field("preserveSeams", &AutoLodRule::m_preserveSeams)
+                    ->Field("lockBorders", &AutoLodRule::m_lockBorders);
+
+                EditContext* editContext = serializeContext->GetEditContext();
+                if (editContext)
+                {
+                    editContext->Class<AutoLodRule>("Generated Level of Detail", "Generate levels of detail by simplifying the base mesh. Only used when no levels of detail have been authored.")
+                        ->ClassElement(Edit::ClassElements::EditorData, "")
+                            ->Attribute("AutoExpand", true)
+                            ->Attribute(AZ::Edit::Attributes::NameLabelOverride, "")
+                        ->DataElement(Edit::UIHandlers::Default, &AutoLodRule::m_triangleRatios, "Triangle ratios",
+                            "The fraction of the base mesh triangles to keep for each generated level of detail, starting with lod 1.")
+                            ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, true)
+                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.01f)
+                            ->ElementAttribute(AZ::Edit::Attributes::Max, 1.0f)
+                            ->ElementAttribute(AZ::Edit::Attributes::Step, 0.05f)
+                        ->DataElement(Edit::UIHandlers::Default, &AutoLodRule::m_pixelErrorThreshold, "Pixel error",
+                            "The largest simplification error, in pixels at 1080p, that's allowed on screen. Used to compute the screen coverage at which each level of detail is selected.")
+                            ->Attribute(AZ::Edit::Attributes::Min, 0.1f)
+                            ->Attribute(AZ::Edit::Attributes::Max, 64.0f)
+                        ->DataElement(Edit::UIHandlers::Default, &AutoLodRule::m_preserveSeams, "Preserve seams",
+                            "Keep vertices on uv seams and hard edges in place so textures and shading don't tear.")
+                        ->DataElement(Edit::UIHandlers::Default, &AutoLodRule::m_lockBorders, "Lock borders",
+                            "Keep vertices on open borders, including borders between materials, in place so the silhouette and material layout are preserved.");
+                }
+            }
+        } // namespace SceneData
+    } // namespace SceneAPI
+} // namespace AZ
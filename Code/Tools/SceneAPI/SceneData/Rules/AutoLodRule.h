@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/IAutoLodRule.h>
+#include <SceneAPI/SceneData/SceneDataConfiguration.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace SceneAPI
+    {
+        namespace SceneData
+        {
+            class SCENE_DATA_CLASS AutoLodRule
+                : public DataTypes::IAutoLodRule
+            {
+            public:
+                AZ_RTTI(AutoLodRule, "{0E8E5D8B-7E65-4B7A-9C0C-2F4B9AE1C6D2}", DataTypes::IAutoLodRule);
+                AZ_CLASS_ALLOCATOR_DECL
+
+                SCENE_DATA_API AutoLodRule();
+                SCENE_DATA_API ~AutoLodRule() override = default;
+
+                SCENE_DATA_API size_t GetLodCount() const override;
+                SCENE_DATA_API float GetTriangleRatio(size_t lodIndex) const override;
+                SCENE_DATA_API float GetPixelErrorThreshold() const override;
+                SCENE_DATA_API bool PreserveSeams() const override;
+                SCENE_DATA_API bool LockBorders() const override;
+
+                SCENE_DATA_API void SetTriangleRatios(AZStd::vector<float> ratios);
+
+                static void Reflect(ReflectContext* context);
+
+                //! Matches the number of lods the LodRule can author on top of the base mesh.
+                static const size_t s_maxLods = 5;
+
+            protected:
+                AZStd::vector<float> m_triangleRatios;
+                float m_pixelErrorThreshold = 1.0f;
+                bool m_preserveSeams = true;
+                bool m_lockBorders = true;
+            };
+        } // SceneData
+    } // SceneAPI
+} // AZ
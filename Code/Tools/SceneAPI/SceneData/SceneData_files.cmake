@@ -52,6 +52,8 @@ set(FILES
     Rules/CommentRule.cpp
     Rules/LodRule.h
     Rules/LodRule.cpp
+    Rules/AutoLodRule.h
+    Rules/AutoLodRule.cpp
     Rules/CoordinateSystemRule.h
     Rules/CoordinateSystemRule.cpp
     Rules/StaticMeshAdvancedRule.h
@@ -67,6 +67,8 @@ namespace AZ
             void UpdateDrawPackets(bool forceUpdate = false);
             void BuildCullable();
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
+            void BuildOccluderGeometry();
+            void UpdateOccluderRegistration();
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
@@ -92,12 +94,16 @@ namespace AZ
 
             Aabb m_aabb = Aabb::CreateNull();
 
+            // Only registered with the culling scene while the mesh is a visible occluder with geometry
+            RPI::CullingScene::OccluderMesh m_occluderMesh;
+
             bool m_cullBoundsNeedsUpdate = false;
             bool m_cullableNeedsRebuild = false;
             bool m_objectSrgNeedsUpdate = true;
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_visible = true;
             bool m_hasForwardPassIblSpecularMaterial = false;
+            bool m_isOccluder = false;
         };
 
         //! This feature processor handles static and dynamic non-skinned meshes.
@@ -161,6 +167,7 @@ namespace AZ
             void SetRayTracingEnabled(const MeshHandle& meshHandle, bool rayTracingEnabled) override;
             void SetVisible(const MeshHandle& meshHandle, bool visible) override;
             void SetUseForwardPassIblSpecular(const MeshHandle& meshHandle, bool useForwardPassIblSpecular) override;
+            void SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder) override;
 
             // called when reflection probes are modified in the editor so that meshes can re-evaluate their probes
             void UpdateMeshReflectionProbes();
@@ -177,6 +184,7 @@ namespace AZ
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline) override;
+
                         
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<MeshDataInstance> m_meshData;
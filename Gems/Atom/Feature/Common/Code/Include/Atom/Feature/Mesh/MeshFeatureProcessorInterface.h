@@ -105,6 +105,9 @@ namespace AZ
             virtual void SetVisible(const MeshHandle& meshHandle, bool visible) = 0;
             //! Sets the mesh to render IBL specular in the forward pass.
             virtual void SetUseForwardPassIblSpecular(const MeshHandle& meshHandle, bool useForwardPassIblSpecular) = 0;
+            //! Sets the mesh as an occluder. The lowest lod of an occluder is rasterized into the software occlusion buffer of each
+            //! camera view, so cullables behind it are not rendered. Best suited for large, opaque and mostly static meshes.
+            virtual void SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder) = 0;
         };
     } // namespace Render
 } // namespace AZ
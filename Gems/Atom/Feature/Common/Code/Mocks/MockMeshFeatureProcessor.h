@@ -39,5 +39,6 @@ namespace UnitTest
         MOCK_METHOD2(SetRayTracingEnabled, void (const MeshHandle&, bool));
         MOCK_METHOD2(SetVisible, void (const MeshHandle&, bool));
         MOCK_METHOD2(SetUseForwardPassIblSpecular, void (const MeshHandle&, bool));
+        MOCK_METHOD2(SetIsOccluder, void (const MeshHandle&, bool));
     };
 } // namespace UnitTest
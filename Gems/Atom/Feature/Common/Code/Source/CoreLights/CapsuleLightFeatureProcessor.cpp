@@ -10,6 +10,7 @@
 #include <AzCore/Debug/EventTrace.h>
 
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/Feature/CoreLights/CoreLightsConstants.h>
@@ -51,12 +52,14 @@ namespace AZ
             desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
 
             m_lightBufferHandler = GpuBufferHandler(desc);
+            m_viewLightBufferHandler.Init(desc);
         }
 
         void CapsuleLightFeatureProcessor::Deactivate()
         {
             m_capsuleLightData.Clear();
             m_lightBufferHandler.Release();
+            m_viewLightBufferHandler.Release();
         }
 
         CapsuleLightFeatureProcessor::LightHandle CapsuleLightFeatureProcessor::AcquireLight()
@@ -104,6 +107,8 @@ namespace AZ
             AZ_ATOM_PROFILE_FUNCTION("RPI", "CapsuleLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
+            // The buffer of every light is kept up to date even while lights are culled per camera view, since other views
+            // and ray tracing keep reading it.
             if (m_deviceBufferNeedsUpdate)
             {
                 [[maybe_unused]] bool success = m_lightBufferHandler.UpdateBuffer(m_capsuleLightData.GetDataVector());
@@ -116,6 +121,22 @@ namespace AZ
         {
             AZ_ATOM_PROFILE_FUNCTION("RPI", "CapsuleLightFeatureProcessor: Render");
 
+            if (r_cpuLightCulling)
+            {
+                m_viewLightBufferHandler.Render(m_capsuleLightData.GetDataVector(), m_lightBufferHandler, packet,
+                    [](const CapsuleLightData& light, Vector3& center, float& radius)
+                {
+                    const float halfLength = light.m_length * 0.5f;
+                    center = Vector3(light.m_startPoint[0], light.m_startPoint[1], light.m_startPoint[2]) +
+                        Vector3(light.m_direction[0], light.m_direction[1], light.m_direction[2]) * halfLength;
+                    radius = light.m_invAttenuationRadiusSquared > 0.0f
+                        ? sqrtf(1.0f / light.m_invAttenuationRadiusSquared) + halfLength
+                        : AZStd::numeric_limits<float>::max();
+                });
+                return;
+            }
+
+            m_viewLightBufferHandler.Release();
             for (const RPI::ViewPtr& view : packet.m_views)
             {
                 m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
@@ -194,5 +215,17 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const Data::Instance<RPI::Buffer> CapsuleLightFeatureProcessor::GetLightBuffer(const RPI::View* view) const
+        {
+            const GpuBufferHandler* viewBufferHandler = m_viewLightBufferHandler.GetViewBuffer(view);
+            return viewBufferHandler ? viewBufferHandler->GetBuffer() : m_lightBufferHandler.GetBuffer();
+        }
+
+        uint32_t CapsuleLightFeatureProcessor::GetLightCount(const RPI::View* view) const
+        {
+            const GpuBufferHandler* viewBufferHandler = m_viewLightBufferHandler.GetViewBuffer(view);
+            return viewBufferHandler ? viewBufferHandler->GetElementCount() : m_lightBufferHandler.GetElementCount();
+        }
+
     } // namespace Render
 } // namespace AZ
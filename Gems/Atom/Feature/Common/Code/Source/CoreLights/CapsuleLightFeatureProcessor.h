@@ -10,6 +10,7 @@
 #include <Atom/Feature/CoreLights/CapsuleLightFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <CoreLights/IndexedDataVector.h>
+#include <CoreLights/ViewLightBufferHandler.h>
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
 
 namespace AZ
@@ -49,6 +50,10 @@ namespace AZ
             const Data::Instance<RPI::Buffer> GetLightBuffer()const;
             uint32_t GetLightCount()const;
 
+            //! Returns the buffer bound to a view. For camera views it only holds the lights visible to them when r_cpuLightCulling is enabled.
+            const Data::Instance<RPI::Buffer> GetLightBuffer(const RPI::View* view) const;
+            uint32_t GetLightCount(const RPI::View* view) const;
+
         private:
             CapsuleLightFeatureProcessor(const CapsuleLightFeatureProcessor&) = delete;
 
@@ -56,6 +61,7 @@ namespace AZ
 
             IndexedDataVector<CapsuleLightData> m_capsuleLightData;
             GpuBufferHandler m_lightBufferHandler;
+            ViewLightBufferHandler<CapsuleLightData> m_viewLightBufferHandler;
             bool m_deviceBufferNeedsUpdate = false;
         };
     } // namespace Render
@@ -49,6 +49,14 @@ namespace AZ
             "Turns on a much more accurate an expensive mode for area lights for validating the accuracy of the inexpensive versions."
         );
 
+        AZ_CVAR(bool,
+            r_cpuLightCulling,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Culls point, disk and capsule lights per camera view on the CPU so each camera view's light buffers only hold the lights that can touch it."
+        );
+
         void CoreLightsSystemComponent::Reflect(ReflectContext* context)
         {
             if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
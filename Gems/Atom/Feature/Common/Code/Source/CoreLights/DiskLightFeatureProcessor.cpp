@@ -12,6 +12,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/limits.h>
 
 #include <Atom/Feature/CoreLights/CoreLightsConstants.h>
 
@@ -52,6 +53,7 @@ namespace AZ
             desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
 
             m_lightBufferHandler = GpuBufferHandler(desc);
+            m_viewLightBufferHandler.Init(desc);
             m_shadowFeatureProcessor = GetParentScene()->GetFeatureProcessor<ProjectedShadowFeatureProcessor>();
         }
 
@@ -59,6 +61,7 @@ namespace AZ
         {
             m_diskLightData.Clear();
             m_lightBufferHandler.Release();
+            m_viewLightBufferHandler.Release();
         }
 
         DiskLightFeatureProcessor::LightHandle DiskLightFeatureProcessor::AcquireLight()
@@ -125,6 +128,8 @@ namespace AZ
             AZ_ATOM_PROFILE_FUNCTION("RPI", "DiskLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
+            // The buffer of every light is kept up to date even while lights are culled per camera view, since other views
+            // and ray tracing keep reading it.
             if (m_deviceBufferNeedsUpdate)
             {
                 m_lightBufferHandler.UpdateBuffer(m_diskLightData.GetDataVector());
@@ -136,6 +141,21 @@ namespace AZ
         {
             AZ_ATOM_PROFILE_FUNCTION("RPI", "DiskLightFeatureProcessor: Simulate");
 
+            if (r_cpuLightCulling)
+            {
+                m_viewLightBufferHandler.Render(m_diskLightData.GetDataVector(), m_lightBufferHandler, packet,
+                    [](const DiskLightData& light, Vector3& center, float& radius)
+                {
+                    // Light reaches the attenuation radius from any point of the disk, not just its center.
+                    center = Vector3(light.m_position[0], light.m_position[1], light.m_position[2]);
+                    radius = light.m_invAttenuationRadiusSquared > 0.0f
+                        ? sqrtf(1.0f / light.m_invAttenuationRadiusSquared) + light.m_diskRadius
+                        : AZStd::numeric_limits<float>::max();
+                });
+                return;
+            }
+
+            m_viewLightBufferHandler.Release();
             for (const RPI::ViewPtr& view : packet.m_views)
             {
                 m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
@@ -267,6 +287,18 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const Data::Instance<RPI::Buffer> DiskLightFeatureProcessor::GetLightBuffer(const RPI::View* view) const
+        {
+            const GpuBufferHandler* viewBufferHandler = m_viewLightBufferHandler.GetViewBuffer(view);
+            return viewBufferHandler ? viewBufferHandler->GetBuffer() : m_lightBufferHandler.GetBuffer();
+        }
+
+        uint32_t DiskLightFeatureProcessor::GetLightCount(const RPI::View* view) const
+        {
+            const GpuBufferHandler* viewBufferHandler = m_viewLightBufferHandler.GetViewBuffer(view);
+            return viewBufferHandler ? viewBufferHandler->GetElementCount() : m_lightBufferHandler.GetElementCount();
+        }
+
         void DiskLightFeatureProcessor::SetShadowsEnabled(LightHandle handle, bool enabled)
         {
             DiskLightData& light = m_diskLightData.GetData(handle.GetIndex());
@@ -11,6 +11,7 @@
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <CoreLights/IndexedDataVector.h>
+#include <CoreLights/ViewLightBufferHandler.h>
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
 namespace AZ
@@ -62,6 +63,10 @@ namespace AZ
             const Data::Instance<RPI::Buffer> GetLightBuffer()const;
             uint32_t GetLightCount()const;
 
+            //! Returns the buffer bound to a view. For camera views it only holds the lights visible to them when r_cpuLightCulling is enabled.
+            const Data::Instance<RPI::Buffer> GetLightBuffer(const RPI::View* view) const;
+            uint32_t GetLightCount(const RPI::View* view) const;
+
         private:
 
             static constexpr const char* FeatureProcessorName = "DiskLightFeatureProcessor";
@@ -84,6 +89,7 @@ namespace AZ
 
             IndexedDataVector<DiskLightData> m_diskLightData;
             GpuBufferHandler m_lightBufferHandler;
+            ViewLightBufferHandler<DiskLightData> m_viewLightBufferHandler;
 
             bool m_deviceBufferNeedsUpdate = false;
         };
@@ -263,6 +263,9 @@ namespace AZ
 
         void LightCullingPass::GetLightDataFromFeatureProcessor()
         {
+            // Lights which are culled on the CPU are uploaded per view, so the tiles must index the same buffer the view uses
+            const RPI::View* view = m_pipeline->GetDefaultView().get();
+
             const auto simplePointLightFP = m_pipeline->GetScene()->GetFeatureProcessor<SimplePointLightFeatureProcessor>();
             m_lightdata[eLightTypes_SimplePoint].m_lightBuffer = simplePointLightFP->GetLightBuffer();
             m_lightdata[eLightTypes_SimplePoint].m_lightCount = simplePointLightFP->GetLightCount();
@@ -272,16 +275,16 @@ namespace AZ
             m_lightdata[eLightTypes_SimpleSpot].m_lightCount = simpleSpotLightFP->GetLightCount();
 
             const auto pointLightFP = m_pipeline->GetScene()->GetFeatureProcessor<PointLightFeatureProcessor>();
-            m_lightdata[eLightTypes_Point].m_lightBuffer = pointLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_Point].m_lightCount = pointLightFP->GetLightCount();
+            m_lightdata[eLightTypes_Point].m_lightBuffer = pointLightFP->GetLightBuffer(view);
+            m_lightdata[eLightTypes_Point].m_lightCount = pointLightFP->GetLightCount(view);
 
             const auto diskLightFP = m_pipeline->GetScene()->GetFeatureProcessor<DiskLightFeatureProcessor>();
-            m_lightdata[eLightTypes_Disk].m_lightBuffer = diskLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_Disk].m_lightCount = diskLightFP->GetLightCount();
+            m_lightdata[eLightTypes_Disk].m_lightBuffer = diskLightFP->GetLightBuffer(view);
+            m_lightdata[eLightTypes_Disk].m_lightCount = diskLightFP->GetLightCount(view);
 
             const auto capsuleLightFP = m_pipeline->GetScene()->GetFeatureProcessor<CapsuleLightFeatureProcessor>();
-            m_lightdata[eLightTypes_Capsule].m_lightBuffer = capsuleLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_Capsule].m_lightCount = capsuleLightFP->GetLightCount();
+            m_lightdata[eLightTypes_Capsule].m_lightBuffer = capsuleLightFP->GetLightBuffer(view);
+            m_lightdata[eLightTypes_Capsule].m_lightCount = capsuleLightFP->GetLightCount(view);
 
             const auto quadLightFP = m_pipeline->GetScene()->GetFeatureProcessor<QuadLightFeatureProcessor>();
             m_lightdata[eLightTypes_Quad].m_lightBuffer = quadLightFP->GetLightBuffer();
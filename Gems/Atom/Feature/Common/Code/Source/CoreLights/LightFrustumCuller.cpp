@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/LightFrustumCuller.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        void LightFrustumCuller::ClearLights()
+        {
+            m_centerX.clear();
+            m_centerY.clear();
+            m_centerZ.clear();
+            m_radius.clear();
+            m_lightCount = 0;
+        }
+
+        uint32_t LightFrustumCuller::AddLight(const Vector3& center, float radius)
+        {
+            if (m_lightCount % 4 == 0)
+            {
+                // Grow by a full group of four. Unused lanes have a negative radius and fail the near plane test.
+                const size_t paddedCount = m_lightCount + 4;
+                m_centerX.resize(paddedCount, 0.0f);
+                m_centerY.resize(paddedCount, 0.0f);
+                m_centerZ.resize(paddedCount, 0.0f);
+                m_radius.resize(paddedCount, -AZStd::numeric_limits<float>::max());
+            }
+
+            m_centerX[m_lightCount] = center.GetX();
+            m_centerY[m_lightCount] = center.GetY();
+            m_centerZ[m_lightCount] = center.GetZ();
+            m_radius[m_lightCount] = radius;
+            return m_lightCount++;
+        }
+
+        uint32_t LightFrustumCuller::GetLightCount() const
+        {
+            return m_lightCount;
+        }
+
+        void LightFrustumCuller::Cull(const Matrix4x4& worldToView, const Matrix4x4& viewToClip)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            AZ_Assert(viewToClip.GetElement(3, 3) == 0.0f, "LightFrustumCuller only supports perspective projections.");
+
+            // Clip z = A * viewZ + B, so the planes at ndc depth 0 and 1 are at view depths B / A and B / (A + 1).
+            // Which one is the near plane depends on whether the projection uses reverse depth.
+            const float depthScale = viewToClip.GetElement(2, 2);
+            const float depthOffset = viewToClip.GetElement(2, 3);
+            const float planeDepth0 = AZStd::abs(depthOffset / depthScale);
+            const float planeDepth1 = AZStd::abs(depthOffset / (depthScale + 1.0f));
+            m_nearDepth = AZStd::min(planeDepth0, planeDepth1);
+            m_farDepth = AZStd::max(planeDepth0, planeDepth1);
+
+            m_tanHalfFovX = 1.0f / viewToClip.GetElement(0, 0);
+            m_tanHalfFovY = 1.0f / viewToClip.GetElement(1, 1);
+
+            CullFrustum(worldToView);
+        }
+
+        void LightFrustumCuller::CullFrustum(const Matrix4x4& worldToView)
+        {
+            using namespace Simd;
+
+            m_visibleLights.clear();
+
+            // Inward facing unit normals of the side planes, which pass through the view origin. For the left plane
+            // x = -tan * depth the normal is (1, 0, -tan) normalized, remembering that depth = -viewZ.
+            const float sideNormalX = 1.0f / AZStd::sqrt(1.0f + m_tanHalfFovX * m_tanHalfFovX);
+            const float sideNormalY = 1.0f / AZStd::sqrt(1.0f + m_tanHalfFovY * m_tanHalfFovY);
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType nearDepth = Vec4::Splat(m_nearDepth);
+            const Vec4::FloatType farDepth = Vec4::Splat(m_farDepth);
+            const Vec4::FloatType planeNormalX = Vec4::Splat(sideNormalX);
+            const Vec4::FloatType planeNormalXZ = Vec4::Splat(-m_tanHalfFovX * sideNormalX);
+            const Vec4::FloatType planeNormalY = Vec4::Splat(sideNormalY);
+            const Vec4::FloatType planeNormalYZ = Vec4::Splat(-m_tanHalfFovY * sideNormalY);
+
+            Vec4::FloatType rows[3][4];
+            for (int32_t row = 0; row < 3; ++row)
+            {
+                for (int32_t col = 0; col < 4; ++col)
+                {
+                    rows[row][col] = Vec4::Splat(worldToView.GetElement(row, col));
+                }
+            }
+
+            alignas(16) int32_t visibleMask[4];
+
+            const uint32_t paddedCount = aznumeric_cast<uint32_t>(m_radius.size());
+            for (uint32_t lightIndex = 0; lightIndex < paddedCount; lightIndex += 4)
+            {
+                const Vec4::FloatType x = Vec4::LoadUnaligned(&m_centerX[lightIndex]);
+                const Vec4::FloatType y = Vec4::LoadUnaligned(&m_centerY[lightIndex]);
+                const Vec4::FloatType z = Vec4::LoadUnaligned(&m_centerZ[lightIndex]);
+                const Vec4::FloatType radius = Vec4::LoadUnaligned(&m_radius[lightIndex]);
+                const Vec4::FloatType negativeRadius = Vec4::Sub(zero, radius);
+
+                const Vec4::FloatType viewX = Vec4::Madd(rows[0][0], x, Vec4::Madd(rows[0][1], y, Vec4::Madd(rows[0][2], z, rows[0][3])));
+                const Vec4::FloatType viewY = Vec4::Madd(rows[1][0], x, Vec4::Madd(rows[1][1], y, Vec4::Madd(rows[1][2], z, rows[1][3])));
+                const Vec4::FloatType viewZ = Vec4::Madd(rows[2][0], x, Vec4::Madd(rows[2][1], y, Vec4::Madd(rows[2][2], z, rows[2][3])));
+                const Vec4::FloatType depth = Vec4::Sub(zero, viewZ);
+
+                Vec4::FloatType visible = Vec4::And(
+                    Vec4::CmpGtEq(Vec4::Add(depth, radius), nearDepth), Vec4::CmpLtEq(Vec4::Sub(depth, radius), farDepth));
+
+                // Signed distances to the side planes, positive inside the frustum.
+                const Vec4::FloatType depthTermX = Vec4::Mul(viewZ, planeNormalXZ);
+                const Vec4::FloatType depthTermY = Vec4::Mul(viewZ, planeNormalYZ);
+                const Vec4::FloatType leftDistance = Vec4::Madd(viewX, planeNormalX, depthTermX);
+                const Vec4::FloatType rightDistance = Vec4::Sub(depthTermX, Vec4::Mul(viewX, planeNormalX));
+                const Vec4::FloatType bottomDistance = Vec4::Madd(viewY, planeNormalY, depthTermY);
+                const Vec4::FloatType topDistance = Vec4::Sub(depthTermY, Vec4::Mul(viewY, planeNormalY));
+
+                visible = Vec4::And(visible, Vec4::And(Vec4::CmpGtEq(leftDistance, negativeRadius), Vec4::CmpGtEq(rightDistance, negativeRadius)));
+                visible = Vec4::And(visible, Vec4::And(Vec4::CmpGtEq(bottomDistance, negativeRadius), Vec4::CmpGtEq(topDistance, negativeRadius)));
+
+                Vec4::StoreUnaligned(visibleMask, Vec4::CastToInt(visible));
+                if ((visibleMask[0] | visibleMask[1] | visibleMask[2] | visibleMask[3]) == 0)
+                {
+                    continue;
+                }
+
+                for (uint32_t lane = 0; lane < 4; ++lane)
+                {
+                    if (visibleMask[lane] != 0)
+                    {
+                        m_visibleLights.push_back(lightIndex + lane);
+                    }
+                }
+            }
+        }
+
+        const AZStd::vector<uint32_t>& LightFrustumCuller::GetVisibleLights() const
+        {
+            return m_visibleLights;
+        }
+    } // namespace Render
+} // namespace AZ
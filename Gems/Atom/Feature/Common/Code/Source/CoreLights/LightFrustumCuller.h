@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Culls light bounding spheres against a perspective view frustum on the CPU.
+        //!
+        //! Lights are stored as structure of arrays and tested against the frustum four at a time. The result is
+        //! the sorted list of visible light indices, which feature processors use to upload only the lights a view
+        //! needs. The per tile light lists are still built on the GPU by the LightCullingPass.
+        class LightFrustumCuller
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(LightFrustumCuller, AZ::SystemAllocator, 0);
+
+            //! Removes every light. Lights are added again each frame before culling the views.
+            void ClearLights();
+
+            //! Adds a light bounding sphere and returns its index, which is the index reported in the culling results.
+            uint32_t AddLight(const Vector3& center, float radius);
+
+            uint32_t GetLightCount() const;
+
+            //! Culls the lights against a view frustum. The view-to-clip matrix must be a symmetric perspective projection
+            //! for a right handed view space looking down -Z; both forward and reverse depth are supported.
+            void Cull(const Matrix4x4& worldToView, const Matrix4x4& viewToClip);
+
+            //! Indices of the lights that touch the view frustum, in ascending order.
+            const AZStd::vector<uint32_t>& GetVisibleLights() const;
+
+        private:
+            void CullFrustum(const Matrix4x4& worldToView);
+
+            // Light bounding spheres, padded to a multiple of 4 with lights that are never visible.
+            AZStd::vector<float> m_centerX;
+            AZStd::vector<float> m_centerY;
+            AZStd::vector<float> m_centerZ;
+            AZStd::vector<float> m_radius;
+            uint32_t m_lightCount = 0;
+
+            // Frustum of the last culled view.
+            float m_nearDepth = 0.0f;
+            float m_farDepth = 0.0f;
+            float m_tanHalfFovX = 0.0f;
+            float m_tanHalfFovY = 0.0f;
+
+            AZStd::vector<uint32_t> m_visibleLights;
+        };
+    } // namespace Render
+} // namespace AZ
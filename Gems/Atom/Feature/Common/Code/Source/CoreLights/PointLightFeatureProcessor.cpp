@@ -10,6 +10,7 @@
 #include <AzCore/Debug/EventTrace.h>
 
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/Feature/CoreLights/CoreLightsConstants.h>
@@ -59,12 +60,14 @@ namespace AZ
             m_shadowFeatureProcessor = GetParentScene()->GetFeatureProcessor<ProjectedShadowFeatureProcessor>();
 
             m_lightBufferHandler = GpuBufferHandler(desc);
+            m_viewLightBufferHandler.Init(desc);
         }
 
         void PointLightFeatureProcessor::Deactivate()
         {
             m_pointLightData.Clear();
             m_lightBufferHandler.Release();
+            m_viewLightBufferHandler.Release();
         }
 
         PointLightFeatureProcessor::LightHandle PointLightFeatureProcessor::AcquireLight()
@@ -121,6 +124,8 @@ namespace AZ
             AZ_ATOM_PROFILE_FUNCTION("RPI", "PointLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
+            // The buffer of every light is kept up to date even while lights are culled per camera view, since other views
+            // and ray tracing keep reading it.
             if (m_deviceBufferNeedsUpdate)
             {
                 m_lightBufferHandler.UpdateBuffer(m_pointLightData.GetDataVector());
@@ -132,6 +137,20 @@ namespace AZ
         {
             AZ_ATOM_PROFILE_FUNCTION("RPI", "PointLightFeatureProcessor: Render");
 
+            if (r_cpuLightCulling)
+            {
+                m_viewLightBufferHandler.Render(m_pointLightData.GetDataVector(), m_lightBufferHandler, packet,
+                    [](const PointLightData& light, Vector3& center, float& radius)
+                {
+                    center = Vector3(light.m_position[0], light.m_position[1], light.m_position[2]);
+                    radius = light.m_invAttenuationRadiusSquared > 0.0f
+                        ? sqrtf(1.0f / light.m_invAttenuationRadiusSquared) + light.m_bulbRadius
+                        : AZStd::numeric_limits<float>::max();
+                });
+                return;
+            }
+
+            m_viewLightBufferHandler.Release();
             for (const RPI::ViewPtr& view : packet.m_views)
             {
                 m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
@@ -190,6 +209,18 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const Data::Instance<RPI::Buffer> PointLightFeatureProcessor::GetLightBuffer(const RPI::View* view) const
+        {
+            const GpuBufferHandler* viewBufferHandler = m_viewLightBufferHandler.GetViewBuffer(view);
+            return viewBufferHandler ? viewBufferHandler->GetBuffer() : m_lightBufferHandler.GetBuffer();
+        }
+
+        uint32_t PointLightFeatureProcessor::GetLightCount(const RPI::View* view) const
+        {
+            const GpuBufferHandler* viewBufferHandler = m_viewLightBufferHandler.GetViewBuffer(view);
+            return viewBufferHandler ? viewBufferHandler->GetElementCount() : m_lightBufferHandler.GetElementCount();
+        }
+
         void PointLightFeatureProcessor::SetShadowsEnabled(LightHandle handle, bool enabled)
         {
             auto& light = m_pointLightData.GetData(handle.GetIndex());
@@ -11,6 +11,7 @@
 #include <Atom/Feature/CoreLights/PointLightFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <CoreLights/IndexedDataVector.h>
+#include <CoreLights/ViewLightBufferHandler.h>
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
 namespace AZ
@@ -58,6 +59,10 @@ namespace AZ
             const Data::Instance<RPI::Buffer>  GetLightBuffer() const;
             uint32_t GetLightCount()const;
 
+            //! Returns the buffer bound to a view. For camera views it only holds the lights visible to them when r_cpuLightCulling is enabled.
+            const Data::Instance<RPI::Buffer> GetLightBuffer(const RPI::View* view) const;
+            uint32_t GetLightCount(const RPI::View* view) const;
+
         private:
             PointLightFeatureProcessor(const PointLightFeatureProcessor&) = delete;
             using ShadowId = ProjectedShadowFeatureProcessor::ShadowId;
@@ -71,6 +76,7 @@ namespace AZ
 
             IndexedDataVector<PointLightData> m_pointLightData;
             GpuBufferHandler m_lightBufferHandler;
+            ViewLightBufferHandler<PointLightData> m_viewLightBufferHandler;
             bool m_deviceBufferNeedsUpdate = false;
 
             AZStd::array<AZ::Transform, PointLightData::NumShadowFaces> m_pointShadowTransforms;
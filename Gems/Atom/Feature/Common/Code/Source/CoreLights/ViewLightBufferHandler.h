@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <Atom/Feature/Utils/GpuBufferHandler.h>
+#include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/View.h>
+#include <CoreLights/LightFrustumCuller.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR_EXTERNED(bool, r_cpuLightCulling);
+
+        //! Manages one light buffer per camera view, each holding only the lights whose bounds touch that view's frustum.
+        //! Light feature processors use this next to their buffer of every light when r_cpuLightCulling is enabled, so
+        //! the shading of camera views only loops over the lights they can see. Other views, such as shadow and
+        //! reflection cubemap views, and ray tracing keep using the buffer of every light.
+        template <typename LightDataType>
+        class ViewLightBufferHandler
+        {
+        public:
+            //! The descriptor is the one used for the feature processor's buffer of every light. Each view's buffer is
+            //! named after it with the view name appended.
+            void Init(const GpuBufferHandler::Descriptor& descriptor);
+            void Release();
+
+            //! Culls the lights against every perspective camera view of the packet and binds the view's buffer to its srg.
+            //! A view's buffer is only uploaded again when the data of the lights it can see changed. The other views get
+            //! allLightsBuffer bound, which is expected to be up to date. Views which weren't rendered this frame release
+            //! their buffers.
+            //! getBoundingSphere(const LightDataType&, Vector3& center, float& radius) returns a light's bounds.
+            template <typename GetBoundingSphereFunction>
+            void Render(
+                const AZStd::vector<LightDataType>& lights,
+                const GpuBufferHandler& allLightsBuffer,
+                const RPI::FeatureProcessor::RenderPacket& packet,
+                GetBoundingSphereFunction&& getBoundingSphere);
+
+            //! Returns the buffer of a camera view rendered this frame, or nullptr if the view uses the buffer of every light.
+            const GpuBufferHandler* GetViewBuffer(const RPI::View* view) const;
+
+        private:
+            struct ViewBuffer
+            {
+                GpuBufferHandler m_bufferHandler;
+                //! Copy of the uploaded lights, used to skip the upload when nothing the view can see changed.
+                AZStd::vector<LightDataType> m_lightData;
+                bool m_uploaded = false;
+                bool m_rendered = false;
+            };
+
+            //! Only perspective camera views are culled, everything else sees every light.
+            static bool IsCulledView(RPI::View& view);
+
+            GpuBufferHandler::Descriptor m_descriptor;
+            LightFrustumCuller m_culler;
+            AZStd::unordered_map<const RPI::View*, ViewBuffer> m_viewBuffers;
+
+            //! Scratch storage for the lights visible in the view being uploaded.
+            AZStd::vector<LightDataType> m_visibleLightData;
+        };
+
+#include "ViewLightBufferHandler.inl"
+    } // namespace Render
+} // namespace AZ
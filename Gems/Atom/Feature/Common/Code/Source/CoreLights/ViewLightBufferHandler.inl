@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+template <typename LightDataType>
+inline void ViewLightBufferHandler<LightDataType>::Init(const GpuBufferHandler::Descriptor& descriptor)
+{
+    m_descriptor = descriptor;
+}
+
+template <typename LightDataType>
+inline void ViewLightBufferHandler<LightDataType>::Release()
+{
+    m_viewBuffers.clear();
+    m_visibleLightData.clear();
+    m_culler.ClearLights();
+}
+
+template <typename LightDataType>
+inline bool ViewLightBufferHandler<LightDataType>::IsCulledView(RPI::View& view)
+{
+    return (view.GetUsageFlags() & RPI::View::UsageCamera) != 0 && view.GetViewToClipMatrix().GetElement(3, 3) == 0.0f;
+}
+
+template <typename LightDataType>
+template <typename GetBoundingSphereFunction>
+inline void ViewLightBufferHandler<LightDataType>::Render(
+    const AZStd::vector<LightDataType>& lights,
+    const GpuBufferHandler& allLightsBuffer,
+    const RPI::FeatureProcessor::RenderPacket& packet,
+    GetBoundingSphereFunction&& getBoundingSphere)
+{
+    bool cullerHasLights = false;
+
+    for (auto& viewBuffer : m_viewBuffers)
+    {
+        viewBuffer.second.m_rendered = false;
+    }
+
+    for (const RPI::ViewPtr& view : packet.m_views)
+    {
+        if (!IsCulledView(*view))
+        {
+            allLightsBuffer.UpdateSrg(view->GetShaderResourceGroup().get());
+            continue;
+        }
+
+        if (!cullerHasLights)
+        {
+            m_culler.ClearLights();
+            for (const LightDataType& light : lights)
+            {
+                Vector3 center;
+                float radius;
+                getBoundingSphere(light, center, radius);
+                m_culler.AddLight(center, radius);
+            }
+            cullerHasLights = true;
+        }
+
+        auto viewBufferIt = m_viewBuffers.find(view.get());
+        if (viewBufferIt == m_viewBuffers.end())
+        {
+            GpuBufferHandler::Descriptor descriptor = m_descriptor;
+            descriptor.m_bufferName = AZStd::string::format("%s_%s", m_descriptor.m_bufferName.c_str(), view->GetName().GetCStr());
+            viewBufferIt = m_viewBuffers.emplace(view.get(), ViewBuffer{ GpuBufferHandler(descriptor) }).first;
+        }
+        ViewBuffer& viewBuffer = viewBufferIt->second;
+
+        m_culler.Cull(view->GetWorldToViewMatrix(), view->GetViewToClipMatrix());
+
+        m_visibleLightData.clear();
+        for (uint32_t lightIndex : m_culler.GetVisibleLights())
+        {
+            m_visibleLightData.push_back(lights[lightIndex]);
+        }
+
+        // Light data is plain old data, so a byte compare tells whether the view would see anything new
+        const bool lightDataChanged = m_visibleLightData.size() != viewBuffer.m_lightData.size() ||
+            (!m_visibleLightData.empty() &&
+             memcmp(m_visibleLightData.data(), viewBuffer.m_lightData.data(), m_visibleLightData.size() * sizeof(LightDataType)) != 0);
+        if (lightDataChanged || !viewBuffer.m_uploaded)
+        {
+            viewBuffer.m_lightData.swap(m_visibleLightData);
+            viewBuffer.m_uploaded = viewBuffer.m_bufferHandler.UpdateBuffer(viewBuffer.m_lightData);
+        }
+
+        viewBuffer.m_bufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+        viewBuffer.m_rendered = true;
+    }
+
+    for (auto viewBufferIt = m_viewBuffers.begin(); viewBufferIt != m_viewBuffers.end();)
+    {
+        if (viewBufferIt->second.m_rendered)
+        {
+            ++viewBufferIt;
+        }
+        else
+        {
+            viewBufferIt = m_viewBuffers.erase(viewBufferIt);
+        }
+    }
+}
+
+template <typename LightDataType>
+inline const GpuBufferHandler* ViewLightBufferHandler<LightDataType>::GetViewBuffer(const RPI::View* view) const
+{
+    auto viewBufferIt = m_viewBuffers.find(view);
+    return viewBufferIt != m_viewBuffers.end() ? &viewBufferIt->second.m_bufferHandler : nullptr;
+}
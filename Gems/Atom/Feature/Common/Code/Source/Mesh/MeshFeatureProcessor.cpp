@@ -15,6 +15,7 @@
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
 #include <Atom/Utils/StableDynamicArray.h>
 
 #include <Atom/RPI.Reflect/Model/ModelAssetCreator.h>
@@ -445,6 +446,26 @@ namespace AZ
             }
         }
 
+        void MeshFeatureProcessor::SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder)
+        {
+            if (meshHandle.IsValid() && meshHandle->m_isOccluder != isOccluder)
+            {
+                meshHandle->m_isOccluder = isOccluder;
+                if (!isOccluder)
+                {
+                    meshHandle->m_occluderMesh.m_geometry.reset();
+                    meshHandle->UpdateOccluderRegistration();
+                }
+                else if (meshHandle->m_model)
+                {
+                    // otherwise the geometry is built once the model is loaded, either way it's registered with its
+                    // transform once the cull bounds are updated
+                    meshHandle->BuildOccluderGeometry();
+                    meshHandle->m_cullBoundsNeedsUpdate = true;
+                }
+            }
+        }
+
         void MeshFeatureProcessor::ForceRebuildDrawPackets([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
         {
             m_forceRebuildDrawPackets = true;
@@ -578,6 +599,8 @@ namespace AZ
             }
 
             m_meshLoader.reset();
+            m_occluderMesh.m_geometry.reset();
+            UpdateOccluderRegistration();
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
             m_shaderResourceGroup = {};
@@ -623,6 +646,11 @@ namespace AZ
 
             m_aabb = model->GetModelAsset()->GetAabb();
 
+            if (m_isOccluder)
+            {
+                BuildOccluderGeometry();
+            }
+
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
@@ -1035,6 +1063,11 @@ namespace AZ
             cullData.m_drawListMask.reset();
 
             const size_t lodCount = lodAssets.size();
+
+            //lods generated by the model builder store the screen coverage they were built for, use it when every lod has one
+            const bool useAssetScreenCoverage = AZStd::all_of(lodAssets.begin(), lodAssets.end(),
+                [](const Data::Asset<RPI::ModelLodAsset>& lodAsset) { return lodAsset->GetScreenCoverageMax() > 0.0f; });
+
             for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
             {
                 //initialize the lod
@@ -1042,25 +1075,36 @@ namespace AZ
                 //[GFX TODO][ATOM-5562] - Level of detail: override lod distances and add global lod multiplier(s)
                 static const float MinimumScreenCoverage = 1.0f/1080.0f;        //mesh should cover at least a screen pixel at 1080p to be drawn
                 static const float ReductionFactor = 0.5f;
-                if (lodIndex == 0)
-                {
-                    //first lod
-                    lod.m_screenCoverageMax = 1.0f;
-                }
-                else
-                {
-                    //every other lod: use the previous lod's min
-                    lod.m_screenCoverageMax = AZStd::GetMax(lodData.m_lods[lodIndex-1].m_screenCoverageMin, MinimumScreenCoverage);
-                }
-                if (lodIndex < lodAssets.size() - 1)
+                if (useAssetScreenCoverage)
                 {
-                    //first and middle lods: compute a stepdown value for the min
-                    lod.m_screenCoverageMin = AZStd::GetMax(ReductionFactor * lod.m_screenCoverageMax, MinimumScreenCoverage);
+                    //each lod is used from its own max down to the max of the next (coarser) lod
+                    lod.m_screenCoverageMax = (lodIndex == 0) ? 1.0f : AZStd::GetMax(lodAssets[lodIndex]->GetScreenCoverageMax(), MinimumScreenCoverage);
+                    lod.m_screenCoverageMin = (lodIndex < lodCount - 1)
+                        ? AZStd::GetMax(lodAssets[lodIndex + 1]->GetScreenCoverageMax(), MinimumScreenCoverage)
+                        : MinimumScreenCoverage;
                 }
                 else
                 {
-                    //last lod: use MinimumScreenCoverage for the min
-                    lod.m_screenCoverageMin = MinimumScreenCoverage;
+                    if (lodIndex == 0)
+                    {
+                        //first lod
+                        lod.m_screenCoverageMax = 1.0f;
+                    }
+                    else
+                    {
+                        //every other lod: use the previous lod's min
+                        lod.m_screenCoverageMax = AZStd::GetMax(lodData.m_lods[lodIndex-1].m_screenCoverageMin, MinimumScreenCoverage);
+                    }
+                    if (lodIndex < lodAssets.size() - 1)
+                    {
+                        //first and middle lods: compute a stepdown value for the min
+                        lod.m_screenCoverageMin = AZStd::GetMax(ReductionFactor * lod.m_screenCoverageMax, MinimumScreenCoverage);
+                    }
+                    else
+                    {
+                        //last lod: use MinimumScreenCoverage for the min
+                        lod.m_screenCoverageMin = MinimumScreenCoverage;
+                    }
                 }
 
                 lod.m_drawPackets.clear();
@@ -1117,7 +1161,86 @@ namespace AZ
             m_cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
             m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
 
+            // the culling scene reads the occluder's transform every frame, so only this occluder is updated
+            if (m_isOccluder)
+            {
+                m_occluderMesh.m_localToWorld = Matrix3x4::CreateFromTransform(localToWorld) * Matrix3x4::CreateScale(nonUniformScale);
+                m_occluderMesh.m_aabb = m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume;
+            }
+
             m_cullBoundsNeedsUpdate = false;
+            UpdateOccluderRegistration();
+        }
+
+        void MeshDataInstance::BuildOccluderGeometry()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            m_occluderMesh.m_geometry.reset();
+
+            const auto& lodAssets = m_model->GetModelAsset()->GetLodAssets();
+            if (lodAssets.empty())
+            {
+                return;
+            }
+
+            // use the most detailed LOD, coarser LODs can extend past the surface and would hide objects in front of it
+            const Data::Asset<RPI::ModelLodAsset>& lodAsset = lodAssets[0];
+            const AZ::Name positionSemantic("POSITION");
+
+            auto geometry = AZStd::make_shared<RPI::CullingScene::OccluderGeometry>();
+            for (const RPI::ModelLodAsset::Mesh& mesh : lodAsset->GetMeshes())
+            {
+                const RPI::BufferAssetView* positionView = mesh.GetSemanticBufferAssetView(positionSemantic);
+                if (!positionView || positionView->GetBufferViewDescriptor().m_elementFormat != RHI::Format::R32G32B32_FLOAT)
+                {
+                    continue;
+                }
+
+                const AZStd::array_view<float> positions = mesh.GetSemanticBufferTyped<float>(positionSemantic);
+                const uint32_t vertexCount = aznumeric_cast<uint32_t>(positions.size() / 3);
+                const uint32_t baseVertex = aznumeric_cast<uint32_t>(geometry->m_positions.size());
+                for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+                {
+                    geometry->m_positions.emplace_back(positions[vertexIndex * 3], positions[vertexIndex * 3 + 1], positions[vertexIndex * 3 + 2]);
+                }
+
+                if (mesh.GetIndexBufferAssetView().GetBufferViewDescriptor().m_elementSize == sizeof(uint16_t))
+                {
+                    for (uint16_t index : mesh.GetIndexBufferTyped<uint16_t>())
+                    {
+                        geometry->m_indices.push_back(baseVertex + index);
+                    }
+                }
+                else
+                {
+                    for (uint32_t index : mesh.GetIndexBufferTyped<uint32_t>())
+                    {
+                        geometry->m_indices.push_back(baseVertex + index);
+                    }
+                }
+            }
+
+            if (!geometry->m_indices.empty())
+            {
+                RPI::SoftwareOcclusionBuffer::BuildTriangleNeighbors(
+                    geometry->m_positions.data(), geometry->m_positions.size(), geometry->m_indices.data(), geometry->m_indices.size(),
+                    geometry->m_triangleNeighbors);
+                m_occluderMesh.m_geometry = AZStd::move(geometry);
+            }
+        }
+
+        void MeshDataInstance::UpdateOccluderRegistration()
+        {
+            RPI::CullingScene* cullingScene = m_scene->GetCullingScene();
+            if (m_isOccluder && m_visible && m_occluderMesh.m_geometry)
+            {
+                cullingScene->RegisterOccluderMesh(m_occluderMesh);
+            }
+            else
+            {
+                cullingScene->UnregisterOccluderMesh(m_occluderMesh);
+            }
         }
 
         void MeshDataInstance::UpdateObjectSrg()
@@ -1217,6 +1340,7 @@ namespace AZ
         {
             m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+            UpdateOccluderRegistration();
         }
     } // namespace Render
 } // namespace AZ
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <CoreLights/LightFrustumCuller.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class LightFrustumCullerTests
+        : public AllocatorsTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            // Camera at the origin looking down -Z with a 90 degree field of view, so the side planes are at |x| = depth
+            m_worldToView = Matrix4x4::CreateIdentity();
+            MakePerspectiveFovMatrixRH(m_viewToClip, Constants::HalfPi, 1.0f, 0.1f, 100.0f);
+        }
+
+        // Reference sphere against frustum test, one light at a time. Returns how far inside the frustum the sphere
+        // reaches; the light is visible if this isn't negative.
+        static float GetFrustumOverlap(const Vector3& viewPosition, float radius)
+        {
+            const float depth = -viewPosition.GetZ();
+            const float sideScale = 1.0f / sqrtf(2.0f);
+            float overlap = AZStd::min(depth + radius - 0.1f, 100.0f - (depth - radius));
+            overlap = AZStd::min(overlap, (depth + viewPosition.GetX()) * sideScale + radius);
+            overlap = AZStd::min(overlap, (depth - viewPosition.GetX()) * sideScale + radius);
+            overlap = AZStd::min(overlap, (depth + viewPosition.GetY()) * sideScale + radius);
+            return AZStd::min(overlap, (depth - viewPosition.GetY()) * sideScale + radius);
+        }
+
+        Matrix4x4 m_worldToView;
+        Matrix4x4 m_viewToClip;
+    };
+
+    TEST_F(LightFrustumCullerTests, Cull_LightsOutsideFrustum_AreRejected)
+    {
+        LightFrustumCuller culler;
+        culler.AddLight(Vector3(0.0f, 0.0f, 5.0f), 1.0f);      // behind the camera
+        culler.AddLight(Vector3(0.0f, 0.0f, -200.0f), 1.0f);   // beyond the far plane
+        culler.AddLight(Vector3(-50.0f, 0.0f, -10.0f), 1.0f);  // left of the frustum
+        culler.AddLight(Vector3(0.0f, 30.0f, -10.0f), 1.0f);   // above the frustum
+        culler.AddLight(Vector3(0.0f, 0.0f, -10.0f), 1.0f);    // in front of the camera
+        culler.AddLight(Vector3(0.0f, 0.0f, 0.5f), 1.0f);      // around the camera, reaching past the near plane
+        culler.AddLight(Vector3(10.5f, 0.0f, -10.0f), 1.0f);   // just past the right plane, but overlapping it
+        EXPECT_EQ(7, culler.GetLightCount());
+
+        culler.Cull(m_worldToView, m_viewToClip);
+
+        const AZStd::vector<uint32_t> expected = { 4, 5, 6 };
+        EXPECT_EQ(expected, culler.GetVisibleLights());
+    }
+
+    TEST_F(LightFrustumCullerTests, Cull_ReverseDepth_MatchesForwardDepth)
+    {
+        Matrix4x4 reverseViewToClip;
+        MakePerspectiveFovMatrixRH(reverseViewToClip, Constants::HalfPi, 1.0f, 0.1f, 100.0f, true);
+
+        LightFrustumCuller culler;
+        culler.AddLight(Vector3(0.0f, 0.0f, -99.5f), 1.0f);
+        culler.AddLight(Vector3(0.0f, 0.0f, -102.0f), 1.0f);
+        culler.AddLight(Vector3(0.0f, 0.0f, -0.5f), 0.25f);
+
+        culler.Cull(m_worldToView, m_viewToClip);
+        const AZStd::vector<uint32_t> forwardVisible = culler.GetVisibleLights();
+
+        culler.Cull(m_worldToView, reverseViewToClip);
+        EXPECT_EQ(forwardVisible, culler.GetVisibleLights());
+        EXPECT_EQ(2, forwardVisible.size());
+    }
+
+    TEST_F(LightFrustumCullerTests, Cull_MovedCamera_UsesWorldToView)
+    {
+        // Camera moved to z = 10, still looking down -Z
+        const Matrix4x4 worldToView = Matrix4x4::CreateTranslation(Vector3(0.0f, 0.0f, -10.0f));
+
+        LightFrustumCuller culler;
+        culler.AddLight(Vector3(0.0f, 0.0f, 5.0f), 1.0f);
+        culler.AddLight(Vector3(0.0f, 0.0f, 15.0f), 1.0f);
+        culler.Cull(worldToView, m_viewToClip);
+
+        const AZStd::vector<uint32_t> expected = { 0 };
+        EXPECT_EQ(expected, culler.GetVisibleLights());
+    }
+
+    TEST_F(LightFrustumCullerTests, Cull_ManyLights_MatchesReference)
+    {
+        SimpleLcgRandom random(1234);
+        auto randomRange = [&random](float minValue, float maxValue)
+        {
+            return minValue + random.GetRandomFloat() * (maxValue - minValue);
+        };
+
+        // A count that isn't a multiple of four, to cover the padding
+        constexpr uint32_t LightCount = 1001;
+        AZStd::vector<Vector3> positions;
+        AZStd::vector<float> radii;
+
+        LightFrustumCuller culler;
+        for (uint32_t i = 0; i < LightCount; ++i)
+        {
+            positions.push_back(Vector3(randomRange(-100.0f, 100.0f), randomRange(-100.0f, 100.0f), randomRange(-150.0f, 50.0f)));
+            radii.push_back(randomRange(0.1f, 10.0f));
+            culler.AddLight(positions.back(), radii.back());
+        }
+        culler.Cull(m_worldToView, m_viewToClip);
+
+        const AZStd::vector<uint32_t>& visibleLights = culler.GetVisibleLights();
+        EXPECT_TRUE(AZStd::is_sorted(visibleLights.begin(), visibleLights.end()));
+        EXPECT_FALSE(visibleLights.empty());
+
+        for (uint32_t i = 0; i < LightCount; ++i)
+        {
+            // Skip lights that graze the frustum, where rounding may go either way
+            const float overlap = GetFrustumOverlap(positions[i], radii[i]);
+            if (AZStd::abs(overlap) > 1.0e-3f)
+            {
+                const bool isVisible = AZStd::binary_search(visibleLights.begin(), visibleLights.end(), i);
+                EXPECT_EQ(overlap > 0.0f, isVisible) << "Light " << i;
+            }
+        }
+
+        culler.ClearLights();
+        culler.Cull(m_worldToView, m_viewToClip);
+        EXPECT_EQ(0, culler.GetLightCount());
+        EXPECT_TRUE(culler.GetVisibleLights().empty());
+    }
+
+    TEST_F(LightFrustumCullerTests, Cull_LightsContainingCamera_AreVisible)
+    {
+        LightFrustumCuller culler;
+        culler.AddLight(Vector3(0.0f, 0.0f, 0.0f), 1000.0f);
+        culler.AddLight(Vector3(0.0f, 0.0f, 0.0f), AZStd::numeric_limits<float>::max());
+        culler.AddLight(Vector3(0.0f, 0.0f, 5.0f), 6.0f);
+        culler.Cull(m_worldToView, m_viewToClip);
+
+        EXPECT_EQ((AZStd::vector<uint32_t>{ 0, 1, 2 }), culler.GetVisibleLights());
+    }
+}
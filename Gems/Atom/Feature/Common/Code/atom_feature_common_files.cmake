@@ -78,6 +78,8 @@ set(FILES
     Source/CoreLights/EsmShadowmapsPass.cpp
     Source/CoreLights/IndexedDataVector.h
     Source/CoreLights/IndexedDataVector.inl
+    Source/CoreLights/LightFrustumCuller.h
+    Source/CoreLights/LightFrustumCuller.cpp
     Source/CoreLights/LtcCommon.h
     Source/CoreLights/LtcCommon.cpp
     Source/CoreLights/PointLightFeatureProcessor.h
@@ -98,6 +100,8 @@ set(FILES
     Source/CoreLights/ShadowmapAtlas.cpp
     Source/CoreLights/ShadowmapPass.h
     Source/CoreLights/ShadowmapPass.cpp
+    Source/CoreLights/ViewLightBufferHandler.h
+    Source/CoreLights/ViewLightBufferHandler.inl
     Source/CoreLights/LightCullingPass.cpp
     Source/CoreLights/LightCullingPass.h
     Source/CoreLights/LightCullingTilePreparePass.cpp
@@ -8,6 +8,7 @@
 set(FILES
     Mocks/MockMeshFeatureProcessor.h
     Tests/CommonTest.cpp
+    Tests/CoreLights/LightFrustumCullerTests.cpp
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
     Tests/IndexableListTests.cpp
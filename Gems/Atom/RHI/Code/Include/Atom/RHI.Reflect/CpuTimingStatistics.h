@@ -29,9 +29,30 @@ namespace AZ
                 AZStd::sys_time_t m_executeDuration{};
             };
 
+            struct ShaderResourceGroupStatistics
+            {
+                //! Number of shader resource groups compiled.
+                uint32_t m_compiledGroupCount = 0;
+
+                //! Number of compile requests skipped because the group data was unchanged.
+                uint32_t m_skippedGroupCount = 0;
+
+                //! Number of constant bytes uploaded by the compiled groups.
+                uint64_t m_constantBytes = 0;
+
+                //! Number of jobs the compilation was split into.
+                uint32_t m_jobCount = 0;
+
+                //! Time spent compiling shader resource groups.
+                AZStd::sys_time_t m_compileDuration{};
+            };
+
             //! Statistics for each command queue.
             AZStd::vector<QueueStatistics> m_queueStatistics;
 
+            //! Statistics for the shader resource groups compiled by the frame scheduler.
+            ShaderResourceGroupStatistics m_shaderResourceGroupStatistics;
+
             //! The amount of time spent between two calls to EndFrame.
             AZStd::sys_time_t m_frameToFrameTime{};
 
@@ -50,7 +50,11 @@ namespace AZ
             DisableAttachmentAliasing = AZ_BIT(2),
 
             /// Disables aliasing of transient attachment memory during async queue regions.
-            DisableAttachmentAliasingAsyncQueue = AZ_BIT(3)
+            DisableAttachmentAliasingAsyncQueue = AZ_BIT(3),
+
+            /// Disables reuse of the previous frame's compiled scope graph and transient attachment lifetimes
+            /// when the frame graph topology is unchanged.
+            DisableTopologyCache = AZ_BIT(4)
         };
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::FrameSchedulerCompileFlags)
 
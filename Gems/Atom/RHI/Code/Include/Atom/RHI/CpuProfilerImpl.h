@@ -9,10 +9,14 @@
 #include <Atom/RHI/CpuProfiler.h>
 #include <Atom/RHI.Reflect/Base.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/threadbus.h>
 #include <AzCore/std/smart_ptr/intrusive_refcount.h>
 
 #include <Atom/RHI/FrameEventBus.h>
@@ -21,9 +25,16 @@ namespace AZ
 {
     namespace RHI
     {
+        //! Number of completed regions every thread keeps for CpuProfilerImpl.DumpTrace, rounded up to a power of two.
+        //! Read when a thread first records a region, so changing it only affects threads that register afterwards.
+        AZ_CVAR_EXTERNED(uint32_t, r_cpuProfilerTraceEventRingSize);
+
         //! Thread local class to keep track of the thread's cached time regions.
         //! Each thread keeps track of its own time regions, which is communicated from the CpuProfilerImpl.
         //! The CpuProfilerImpl is able to request the cached time regions from the CpuTimingLocalStorage.
+        //! Next to the cached regions every thread records its completed regions in a fixed size ring, which is written
+        //! without locking by the thread itself and read by the CpuProfilerImpl when a trace is dumped. Every entry of the
+        //! ring has a sequence number, so a reader can tell an entry that was overwritten while it was copied.
         class CpuTimingLocalStorage :
             public AZStd::intrusive_refcount<AZStd::atomic_uint>
         {
@@ -32,7 +43,8 @@ namespace AZ
         public:
             AZ_CLASS_ALLOCATOR(CpuTimingLocalStorage, AZ::OSAllocator, 0);
 
-            CpuTimingLocalStorage();
+            //! @param traceEventRingSize Number of completed regions kept in the trace event ring, needs to be a power of two.
+            explicit CpuTimingLocalStorage(uint32_t traceEventRingSize);
             ~CpuTimingLocalStorage();
 
         private:
@@ -42,8 +54,9 @@ namespace AZ
             // Adds a region to the stack, gets called each time a region begins
             void RegionStackPushBack(TimeRegion& timeRegion);
 
-            // Pops a region from the stack, gets called each time a region ends
-            void RegionStackPopBack();
+            // Pops a region from the stack, gets called each time a region ends.
+            // The region is cached for the CpuProfiler's time region map and/or recorded in the trace event ring.
+            void RegionStackPopBack(bool cacheRegion, bool recordTraceEvent);
 
             // Add a new cached time region. If the stack is empty, flush all entries to the cached map
             void AddCachedRegion(CachedTimeRegion&& timeRegionCached);
@@ -51,6 +64,13 @@ namespace AZ
             // Tries to flush the map to the passed parameter, only if the thread's mutex is unlocked
             void TryFlushCachedMap(CpuProfiler::ThreadTimeRegionMap& cachedRegionMap);
 
+            // Adds a completed region to the trace event ring, overwriting the oldest one. Only called by the owning thread.
+            void RecordTraceEvent(const CachedTimeRegion& timeRegion);
+
+            // Copies the recorded regions that ended at or after the start tick, can be called from any thread.
+            // Entries the owning thread was writing while they were being copied are discarded.
+            void CopyTraceEvents(AZStd::vector<CachedTimeRegion>& traceEvents, AZStd::sys_time_t startTick) const;
+
             AZStd::thread_id m_executingThreadId;
             // Keeps track of the current thread's stack depth
             uint32_t m_stackLevel = 0u;
@@ -68,7 +88,8 @@ namespace AZ
             AZStd::fixed_vector<CachedTimeRegion, TimeRegionStackSize> m_cachedTimeRegions;
             AZStd::mutex m_cachedTimeRegionMutex;
 
-            // Dirty flag which is set when the CpuProfiler's enabled state is set from false to true
+            // Dirty flag which is set when the CpuProfiler's enabled state is set from false to true, the cached regions of
+            // the previous capture are cleared, the stack is kept since it holds the regions that are still open
             AZStd::atomic_bool m_clearContainers = false;
 
             // When the thread is terminated, it will flag itself for deletion
@@ -76,6 +97,19 @@ namespace AZ
 
             // Keep track of the regions that have hit the size limit so we don't have to lock to check
             AZStd::map<AZStd::string, bool> m_hitSizeLimitMap;
+
+            // Entry of the trace event ring. The sequence is odd while the region is written, and 2 * (index + 1) once the
+            // region of the write index 'index' is complete.
+            struct TraceEventEntry
+            {
+                AZStd::atomic<uint64_t> m_sequence{ 0 };
+                CachedTimeRegion m_value;
+            };
+
+            // Ring of the last completed regions, the write index only ever increases. The size is fixed when the thread
+            // registers, so the owning thread never waits on a resize.
+            AZStd::vector<TraceEventEntry, AZ::OSStdAllocator> m_traceEventRing;
+            AZStd::atomic<uint64_t> m_traceEventWriteIndex = 0;
         };
 
         //! CpuProfiler will keep track of the registered threads, and
@@ -84,6 +118,7 @@ namespace AZ
         class CpuProfilerImpl final
             : public CpuProfiler
             , public FrameEventBus::Handler
+            , public AZStd::ThreadEventBus::Handler
         {
             friend class CpuTimingLocalStorage;
 
@@ -99,7 +134,12 @@ namespace AZ
             //! Unregisters the CpuProfilerImpl instance from the interface 
             void Shutdown();
 
-            void OnFrameBegin();
+            //! FrameEventBus::Handler overrides...
+            void OnFrameBegin() override;
+
+            //! AZStd::ThreadEventBus::Handler overrides...
+            void OnThreadEnter(const AZStd::thread::id& id, const AZStd::thread_desc* desc) override;
+            void OnThreadExit(const AZStd::thread::id& id) override;
 
             //! CpuProfiler overrides...
             void BeginTimeRegion(TimeRegion& timeRegion) final;
@@ -108,10 +148,27 @@ namespace AZ
             void SetProfilerEnabled(bool enabled) final;
             bool IsProfilerEnabled() const final;
 
+            //! Writes the regions recorded by all threads during the last seconds to a trace event file, which can be
+            //! opened in chrome://tracing or Perfetto. Arguments: [seconds] [file path], defaults to the whole ring and
+            //! a file in @user@/CpuProfiler.
+            void DumpTrace(const AZ::ConsoleCommandContainer& arguments);
+            AZ_CONSOLEFUNC(CpuProfilerImpl,
+                DumpTrace,
+                AZ::ConsoleFunctorFlags::Null,
+                "Writes the CPU profiler regions of the last seconds to a Chrome trace event file: [seconds] [file path]");
+
         private:
-            // Lazily create and register the local thread data
+            // Number of frame begin markers kept, needs to be a power of two
+            static constexpr uint32_t FrameMarkerRingSize = 1024u;
+            static_assert((FrameMarkerRingSize & (FrameMarkerRingSize - 1)) == 0, "FrameMarkerRingSize needs to be a power of two");
+
+            // Lazily create and register the local thread data, and name the thread if it was started before the profiler
+            // was initialized
             void RegisterThreadStorage();
 
+            // Serializes the recorded regions and frame markers that ended at or after the start tick to the trace event format
+            void WriteTraceEvents(AZStd::string& trace, AZStd::sys_time_t startTick);
+
             // ThreadId -> ThreadTimeRegionMap
             // On the start of each frame, this map will be updated with the last frame's profiling data. 
             TimeRegionMap m_timeRegionMap;
@@ -120,6 +177,21 @@ namespace AZ
             AZStd::vector<RHI::Ptr<CpuTimingLocalStorage>, AZ::OSStdAllocator> m_registeredThreads;
             AZStd::mutex m_threadRegisterMutex;
 
+            // Names of the threads that were started while the profiler was initialized, used to label the threads in a dumped trace
+            AZStd::unordered_map<AZStd::thread_id, AZStd::string> m_threadNames;
+            AZStd::mutex m_threadNamesMutex;
+
+            // Entry of the frame marker ring, with a sequence like the entries of the trace event ring
+            struct FrameMarkerEntry
+            {
+                AZStd::atomic<uint64_t> m_sequence{ 0 };
+                AZStd::sys_time_t m_value = 0;
+            };
+
+            // Ring of the ticks at which the last frames began, written by OnFrameBegin and read when a trace is dumped
+            AZStd::array<FrameMarkerEntry, FrameMarkerRingSize> m_frameBeginTicks;
+            AZStd::atomic<uint64_t> m_frameBeginWriteIndex = 0;
+
             // Thread local storage, gets lazily allocated when a thread is created
             static thread_local CpuTimingLocalStorage* ms_threadLocalStorage;
 
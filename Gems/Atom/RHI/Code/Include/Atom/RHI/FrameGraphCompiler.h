@@ -7,11 +7,16 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
 
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/utils.h>
+
 namespace AZ
 {
     namespace RHI
@@ -42,6 +47,9 @@ namespace AZ
 
             /// Flags controlling statistics of the pools.
             FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
+
+            /// Controls whether independent platform-independent phases may be distributed across the job system.
+            JobPolicy m_jobPolicy = JobPolicy::Serial;
         };
 
         /**
@@ -50,8 +58,12 @@ namespace AZ
          * Platform implementations, on the other hand, are required to override this class in order to perform
          * platform-specific scope construction.
          *
-         * The compiler is designed to be invoked every frame; the graph is simply rebuilt each time. The compile
-         * operation is also done on a single thread; so overhead should be kept to a minimum.
+         * The compiler is designed to be invoked every frame; the graph is simply rebuilt each time. Since the shape of
+         * the graph rarely changes between frames, the compiler hashes the graph topology (scopes, queues, producer /
+         * consumer edges and transient attachment usage) and, when it matches the previous frame, replays the cross-queue
+         * edges, transient attachment lifetimes and sorted aliasing commands instead of recomputing them. When the job
+         * policy of the request is JobPolicy::Parallel, resource view compilation for images and buffers runs as
+         * separate jobs. Platform scope compilation remains serial.
          *
          * The RHI base class performs platform-independent compilation before passing control down to the derived
          * platform implementation. The provided FrameGraph instance is compiled in-place according to the
@@ -159,7 +171,12 @@ namespace AZ
                 FrameSchedulerCompileFlags compileFlags,
                 FrameSchedulerStatisticsFlags statisticsFlags);
 
-            void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
+            void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase, JobPolicy jobPolicy);
+            void CompileImageViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
+            void CompileBufferViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
+
+            /// Hashes everything the queue-centric graph and the transient attachment lifetimes are derived from.
+            HashValue64 ComputeTopologyHash(const FrameGraphCompileRequest& request) const;
 
             //Returns the resource from local cache if it exists within it or create one if it doesn't and add it to the cache
             ImageView* GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor);
@@ -170,6 +187,40 @@ namespace AZ
             ObjectCache<ImageView> m_imageViewCache;
             ObjectCache<BufferView> m_bufferViewCache;
 
+            enum class TopologyCacheState : uint32_t
+            {
+                /// The cache is not used for the current compile.
+                Disabled = 0,
+
+                /// The topology changed; the current compile records its results into the cache.
+                Record,
+
+                /// The topology matches the cache; the current compile replays the cached results.
+                Replay
+            };
+
+            /// Results of the topology dependent phases of the last compile, stored as scope / attachment indices.
+            struct TopologyCache
+            {
+                HashValue64 m_hash = HashValue64{ 0 };
+                bool m_isValid = false;
+
+                /// Cross-queue producer / consumer edges as pairs of scope indices.
+                AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_crossQueueEdges;
+
+                /// First and last scope indices of each transient attachment after async queue extension.
+                AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_bufferLifetimes;
+                AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_imageLifetimes;
+
+                /// The sorted activation / deactivation commands fed to the transient attachment pool.
+                AZStd::vector<uint32_t> m_transientCommands;
+
+                /// The memory usage computed by the sizing pass when the pool uses HeapAllocationStrategy::MemoryHint.
+                AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_memoryHint;
+            };
+
+            TopologyCache m_topologyCache;
+            TopologyCacheState m_topologyCacheState = TopologyCacheState::Disabled;
         };
     }
 }
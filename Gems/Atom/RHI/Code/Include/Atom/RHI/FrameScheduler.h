@@ -8,6 +8,7 @@
 
 #include <Atom/RHI.Reflect/CpuTimingStatistics.h>
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/Interval.h>
 #include <Atom/RHI.Reflect/MemoryStatistics.h>
 #include <Atom/RHI/FrameGraphBuilder.h>
 #include <Atom/RHI/FrameGraphExecuter.h>
@@ -189,6 +190,9 @@ namespace AZ
             void PrepareProducers();
             void CompileProducers();
             void CompileShaderResourceGroups();
+
+            //! Compiles the interval [min, max) of the groups gathered in m_srgCompileRanges, which may span several pools.
+            void CompileShaderResourceGroupsForInterval(Interval interval) const;
             void BuildRayTracingShaderTables();
 
             ScopeProducer* FindScopeProducer(const ScopeId& scopeId);
@@ -220,6 +224,16 @@ namespace AZ
 
             FrameSchedulerCompileRequest m_compileRequest;
 
+            //! The groups queued on each SRG pool, laid out back to back so compile jobs can be
+            //! batched evenly across pools instead of being split per pool.
+            struct ShaderResourceGroupCompileRange
+            {
+                ShaderResourceGroupPool* m_pool = nullptr;
+                uint32_t m_offset = 0;
+                uint32_t m_count = 0;
+            };
+            AZStd::vector<ShaderResourceGroupCompileRange> m_srgCompileRanges;
+
             Scope* m_rootScope = nullptr;
             AZStd::unique_ptr<ScopeProducerEmpty> m_rootScopeProducer;
             AZStd::vector<ScopeProducer*> m_scopeProducers;
@@ -65,6 +65,12 @@ namespace AZ
 
             // Gates the Compile() function so that the SRG is only queued once.
             bool m_isQueuedForCompile = false;
+
+            // Whether m_data has been compiled by the platform since the group was initialized.
+            bool m_isCompiled = false;
+
+            // The pool compile queue the SRG was added to, valid while m_isQueuedForCompile is set.
+            uint32_t m_compileQueueIndex = 0;
         };
     }
 }
@@ -12,6 +12,8 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ
@@ -29,6 +31,19 @@ namespace AZ
             AZ_RTTI(ShaderResourceGroupPool, "{9AAB5A85-4063-4BAE-9A9C-E25640F18FFA}", ResourcePool);
             virtual ~ShaderResourceGroupPool() override;
 
+            //! Statistics gathered for the groups queued since the previous CompileGroupsBegin() call.
+            struct CompileStatistics
+            {
+                //! Number of groups compiled in the current CompileGroups{Begin, End} region.
+                uint32_t m_compiledGroupCount = 0;
+
+                //! Number of async compile requests dropped because the data matched what was already compiled.
+                uint32_t m_skippedGroupCount = 0;
+
+                //! Number of constant bytes handed to the platform for the compiled groups.
+                uint64_t m_constantBytes = 0;
+            };
+
             //! Initializes the shader resource group pool.
             ResultCode Init(Device& device, const ShaderResourceGroupPoolDescriptor& descriptor);
 
@@ -58,6 +73,9 @@ namespace AZ
             //! Returns the total number of groups that need to be compiled.
             uint32_t GetGroupsToCompileCount() const;
 
+            //! Returns the statistics for the groups compiled in this region.
+            const CompileStatistics& GetCompileStatistics() const;
+
             //////////////////////////////////////////////////////////////////////////
 
             //! Returns whether layout in this pool has constants.
@@ -82,6 +100,22 @@ namespace AZ
             //////////////////////////////////////////////////////////////////////////
 
         private:
+            // Compile requests are queued on one of several queues, selected by the calling thread, so that
+            // feature processors compiling groups from many jobs don't all contend on a single lock.
+            static const uint32_t CompileQueueCount = 8;
+
+            struct CompileQueue
+            {
+                AZStd::mutex m_mutex;
+                AZStd::vector<ShaderResourceGroup*> m_groups;
+            };
+
+            // Returns the compile queue assigned to the calling thread.
+            CompileQueue& GetCompileQueueForCurrentThread();
+
+            // Returns whether the data matches what the group was last compiled with, in which case compiling it again is redundant.
+            bool IsCompiledDataEqual(const ShaderResourceGroup& group, const ShaderResourceGroupData& groupData) const;
+
             // Queues the shader resource group for compile and provides a new data packet (takes a lock).
             void QueueForCompile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
 
@@ -89,7 +123,7 @@ namespace AZ
             void QueueForCompile(ShaderResourceGroup& group);
 
             // Queues the shader resource group for compile. Legal to call on a queued group. Does NOT take a lock.
-            void QueueForCompileNoLock(ShaderResourceGroup& group);
+            void QueueForCompileNoLock(ShaderResourceGroup& group, CompileQueue& compileQueue);
 
             // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes a lock.
             void UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup);
@@ -124,9 +158,14 @@ namespace AZ
             bool m_hasSamplerGroup = false;
             bool m_isCompiling = false;
 
-            mutable AZStd::shared_mutex m_groupsToCompileMutex;
+            AZStd::array<CompileQueue, CompileQueueCount> m_compileQueues;
+
+            // The groups gathered from all compile queues for the current CompileGroups{Begin, End} region.
             AZStd::vector<ShaderResourceGroup*> m_groupsToCompile;
 
+            AZStd::atomic_uint32_t m_skippedGroupCount{ 0 };
+            CompileStatistics m_compileStatistics;
+
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
         };
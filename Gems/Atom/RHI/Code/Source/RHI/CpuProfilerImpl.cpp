@@ -9,14 +9,105 @@
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/time.h>
+#include <AzCore/Utils/Utils.h>
 
 #include <AzCore/Debug/Timer.h>
 #include <Atom/RHI/RHIUtils.h>
+#include <Atom/RHI.Reflect/Bits.h>
+
+#if !AZ_TRAIT_OS_USE_WINDOWS_THREADS
+#include <pthread.h>
+#endif
 
 namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool, r_cpuProfilerContinuousCapture, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Continuously record the CPU profiler regions of all threads in a fixed size ring, so the last seconds can be dumped with CpuProfilerImpl.DumpTrace");
+        AZ_CVAR(uint32_t, r_cpuProfilerTraceEventRingSize, 32768, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of completed regions every thread keeps for CpuProfilerImpl.DumpTrace, rounded up to a power of two. "
+            "Only affects threads that record their first region after it's changed, so set it at startup");
+
+        namespace CpuProfilerImplCPP
+        {
+            // Appends a string to a JSON document, escaping the characters JSON doesn't allow in a string
+            void AppendJsonString(AZStd::string& json, const char* value)
+            {
+                json += '"';
+                for (const char* character = value ? value : ""; *character; ++character)
+                {
+                    switch (*character)
+                    {
+                    case '"':
+                        json += "\\\"";
+                        break;
+                    case '\\':
+                        json += "\\\\";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(*character) >= 0x20)
+                        {
+                            json += *character;
+                        }
+                        break;
+                    }
+                }
+                json += '"';
+            }
+
+            // Writes the entry of a ring with a single writer. The sequence is odd while the value is written, and tells
+            // readers which write index the value belongs to once it's written.
+            template<typename Entry, typename Value>
+            void WriteRingEntry(Entry& entry, uint64_t writeIndex, const Value& value)
+            {
+                entry.m_sequence.store(2 * writeIndex + 1, AZStd::memory_order_relaxed);
+                AZStd::atomic_thread_fence(AZStd::memory_order_release);
+                entry.m_value = value;
+                entry.m_sequence.store(2 * writeIndex + 2, AZStd::memory_order_release);
+            }
+
+            // Reads the value of the write index from the entry of a ring, returns false if the entry was being written or
+            // belongs to another write index, either before or while the value was copied.
+            template<typename Entry, typename Value>
+            bool ReadRingEntry(const Entry& entry, uint64_t writeIndex, Value& value)
+            {
+                const uint64_t writtenSequence = 2 * writeIndex + 2;
+                if (entry.m_sequence.load(AZStd::memory_order_acquire) != writtenSequence)
+                {
+                    return false;
+                }
+                value = entry.m_value;
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                return entry.m_sequence.load(AZStd::memory_order_relaxed) == writtenSequence;
+            }
+
+            uint32_t GetTraceEventRingSize()
+            {
+                // Larger rings are clamped, so the size can't overflow when it's rounded up
+                constexpr uint32_t MaxTraceEventRingSize = 1u << 24;
+                return NextPowerOfTwo(AZStd::clamp(static_cast<uint32_t>(r_cpuProfilerTraceEventRingSize), 1u, MaxTraceEventRingSize));
+            }
+
+            // Gets the name the OS knows the calling thread by, for the threads that were started before the profiler
+            // was initialized and weren't named through the thread events
+            bool GetCurrentThreadName([[maybe_unused]] AZStd::string& name)
+            {
+#if !AZ_TRAIT_OS_USE_WINDOWS_THREADS
+                char threadName[64] = {};
+                if (pthread_getname_np(pthread_self(), threadName, sizeof(threadName)) == 0 && threadName[0])
+                {
+                    name = threadName;
+                    return true;
+                }
+#endif
+                return false;
+            }
+        }
+
         thread_local CpuTimingLocalStorage* CpuProfilerImpl::ms_threadLocalStorage = nullptr;
 
         // --- CpuProfiler ---
@@ -81,6 +172,14 @@ namespace AZ
             m_initialized = true;
             Device* rhiDevice = GetRHIDevice().get();
             FrameEventBus::Handler::BusConnect(rhiDevice);
+
+            // Threads that were started before the profiler was initialized aren't named in a dumped trace, except for the
+            // thread initializing the RHI
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_threadNamesMutex);
+                m_threadNames[AZStd::this_thread::get_id()] = "Main Thread";
+            }
+            AZStd::ThreadEventBus::Handler::BusConnect();
         }
 
         void CpuProfilerImpl::Shutdown()
@@ -97,11 +196,14 @@ namespace AZ
 
             m_enabled = false;
 
-            // Cleanup all TLS
+            // Cleanup all TLS, the calling thread's storage pointer is reset so it registers a new one if the profiler is
+            // initialized again
             m_registeredThreads.clear();
+            ms_threadLocalStorage = nullptr;
             m_timeRegionMap.clear();
             m_initialized = false;
             FrameEventBus::Handler::BusDisconnect();
+            AZStd::ThreadEventBus::Handler::BusDisconnect();
         }
 
         void CpuProfilerImpl::BeginTimeRegion(TimeRegion& timeRegion)
@@ -109,12 +211,16 @@ namespace AZ
             // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
             if (m_shutdownMutex.try_lock_shared())
             {
-                if (m_enabled)
+                if (m_enabled || r_cpuProfilerContinuousCapture)
                 {
                     // Lazy initialization, creates an instance of the Thread local data if it's not created, and registers it
                     RegisterThreadStorage();
+                }
 
-                    // Push it to the stack
+                // Once the thread is registered its stack is kept up to date, also while nothing is recorded, so the stack
+                // never holds regions that already ended when recording starts again
+                if (ms_threadLocalStorage)
+                {
                     ms_threadLocalStorage->RegionStackPushBack(timeRegion);
                 }
 
@@ -127,9 +233,9 @@ namespace AZ
             // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
             if (m_shutdownMutex.try_lock_shared())
             {
-                if (m_enabled)
+                if (ms_threadLocalStorage)
                 {
-                    ms_threadLocalStorage->RegionStackPopBack();
+                    ms_threadLocalStorage->RegionStackPopBack(m_enabled, r_cpuProfilerContinuousCapture);
                 }
 
                 m_shutdownMutex.unlock_shared();
@@ -151,7 +257,7 @@ namespace AZ
                 return;
             }
 
-            // Set the dirty flag in all the TLS to clear the caches
+            // Set the dirty flag in all the TLS to clear the cached regions of the previous capture
             if (enabled)
             {
                 // Iterate through all the threads, and set the clearing flag
@@ -175,6 +281,11 @@ namespace AZ
 
         void CpuProfilerImpl::OnFrameBegin()
         {
+            // Frame markers are recorded for dumped traces, even when the profiler isn't enabled
+            const uint64_t frameIndex = m_frameBeginWriteIndex.load(AZStd::memory_order_relaxed);
+            CpuProfilerImplCPP::WriteRingEntry(m_frameBeginTicks[frameIndex & (FrameMarkerRingSize - 1)], frameIndex, AZStd::GetTimeNowTicks());
+            m_frameBeginWriteIndex.store(frameIndex + 1, AZStd::memory_order_release);
+
             if (!m_enabled)
             {
                 return;
@@ -200,20 +311,218 @@ namespace AZ
         }
 
 
+        void CpuProfilerImpl::OnThreadEnter(const AZStd::thread::id& id, const AZStd::thread_desc* desc)
+        {
+            // The descriptor doesn't have to outlive the thread's creation, so the name is copied
+            if (desc && desc->m_name)
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_threadNamesMutex);
+                m_threadNames[id] = desc->m_name;
+            }
+        }
+
+        void CpuProfilerImpl::OnThreadExit([[maybe_unused]] const AZStd::thread::id& id)
+        {
+            // The name is kept, the thread's regions can still be in its storage's trace event ring
+        }
+
+        void CpuProfilerImpl::DumpTrace(const AZ::ConsoleCommandContainer& arguments)
+        {
+            const AZStd::sys_time_t ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+            const AZStd::sys_time_t nowTick = AZStd::GetTimeNowTicks();
+
+            // Without a duration everything that is still in the rings is dumped
+            AZStd::sys_time_t startTick = 0;
+            if (!arguments.empty())
+            {
+                const AZ::CVarFixedString secondsString(arguments[0]);
+                const double seconds = strtod(secondsString.c_str(), nullptr);
+                if (seconds <= 0.0)
+                {
+                    AZ_Warning("CpuProfiler", false, "Invalid duration '%s', expected a number of seconds", secondsString.c_str());
+                    return;
+                }
+                startTick = AZStd::max(nowTick - static_cast<AZStd::sys_time_t>(seconds * ticksPerSecond), AZStd::sys_time_t(0));
+            }
+
+            const AZStd::string filePath = arguments.size() > 1
+                ? AZStd::string(arguments[1])
+                : AZStd::string::format("@user@/CpuProfiler/CpuTrace_%llu.json", static_cast<unsigned long long>(AZStd::GetTimeUTCMilliSecond()));
+
+            AZStd::string trace;
+            {
+                // Keep the thread storages from being released during shutdown while their rings are copied
+                AZStd::shared_lock<AZStd::shared_mutex> shutdownLock(m_shutdownMutex);
+                if (!m_initialized)
+                {
+                    return;
+                }
+                WriteTraceEvents(trace, startTick);
+            }
+
+            const auto writeOutcome = AZ::Utils::WriteFile(trace, filePath);
+            if (!writeOutcome.IsSuccess())
+            {
+                AZ_Error("CpuProfiler", false, "Failed to dump the CPU trace: %s", writeOutcome.GetError().c_str());
+                return;
+            }
+            AZ_TracePrintf("CpuProfiler", "Dumped the CPU trace to %s\n", filePath.c_str());
+        }
+
+        void CpuProfilerImpl::WriteTraceEvents(AZStd::string& trace, AZStd::sys_time_t startTick)
+        {
+            using namespace CpuProfilerImplCPP;
+
+            // Collect the events of all threads first, so no lock is held while the (large) document is formatted
+            struct ThreadTraceEvents
+            {
+                AZStd::thread_id m_threadId;
+                AZStd::vector<CachedTimeRegion> m_events;
+            };
+            AZStd::vector<ThreadTraceEvents> threads;
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+                threads.resize(m_registeredThreads.size());
+                for (size_t threadIndex = 0; threadIndex < m_registeredThreads.size(); ++threadIndex)
+                {
+                    threads[threadIndex].m_threadId = m_registeredThreads[threadIndex]->m_executingThreadId;
+                    m_registeredThreads[threadIndex]->CopyTraceEvents(threads[threadIndex].m_events, startTick);
+                }
+            }
+
+            AZStd::vector<AZStd::sys_time_t> frameBeginTicks;
+            {
+                const uint64_t endIndex = m_frameBeginWriteIndex.load(AZStd::memory_order_acquire);
+                const uint64_t beginIndex = endIndex > FrameMarkerRingSize ? endIndex - FrameMarkerRingSize : 0;
+                frameBeginTicks.reserve(endIndex - beginIndex);
+                for (uint64_t frameIndex = beginIndex; frameIndex < endIndex; ++frameIndex)
+                {
+                    AZStd::sys_time_t frameBeginTick = 0;
+                    if (ReadRingEntry(m_frameBeginTicks[frameIndex & (FrameMarkerRingSize - 1)], frameIndex, frameBeginTick))
+                    {
+                        frameBeginTicks.push_back(frameBeginTick);
+                    }
+                }
+            }
+
+            // Timestamps are written in microseconds, relative to the oldest event so they keep their precision
+            AZStd::sys_time_t baseTick = AZStd::numeric_limits<AZStd::sys_time_t>::max();
+            for (const ThreadTraceEvents& thread : threads)
+            {
+                for (const CachedTimeRegion& traceEvent : thread.m_events)
+                {
+                    baseTick = AZStd::min(baseTick, traceEvent.m_startTick);
+                }
+            }
+            for (const AZStd::sys_time_t frameBeginTick : frameBeginTicks)
+            {
+                if (frameBeginTick >= startTick)
+                {
+                    baseTick = AZStd::min(baseTick, frameBeginTick);
+                }
+            }
+            const double microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+            auto toMicroseconds = [baseTick, microsecondsPerTick](AZStd::sys_time_t tick)
+            {
+                return static_cast<double>(tick - baseTick) * microsecondsPerTick;
+            };
+
+            size_t eventCount = frameBeginTicks.size() + threads.size() + 1;
+            for (const ThreadTraceEvents& thread : threads)
+            {
+                eventCount += thread.m_events.size();
+            }
+            trace.reserve(trace.size() + 128 * eventCount);
+            trace += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            bool firstEvent = true;
+            auto beginEvent = [&trace, &firstEvent]()
+            {
+                trace += firstEvent ? "\n{" : ",\n{";
+                firstEvent = false;
+            };
+
+            // The frame markers get a track of their own, after the tracks of the threads
+            const size_t frameMarkerTid = threads.size();
+            beginEvent();
+            trace += AZStd::string::format("\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"name\":\"thread_name\",\"args\":{\"name\":\"Frames\"}}", frameMarkerTid);
+
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_threadNamesMutex);
+                for (size_t threadIndex = 0; threadIndex < threads.size(); ++threadIndex)
+                {
+                    auto threadName = m_threadNames.find(threads[threadIndex].m_threadId);
+                    const AZStd::string name = threadName != m_threadNames.end()
+                        ? threadName->second
+                        : AZStd::string::format("Thread %zu", threadIndex);
+
+                    beginEvent();
+                    trace += AZStd::string::format("\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"name\":\"thread_name\",\"args\":{\"name\":", threadIndex);
+                    AppendJsonString(trace, name.c_str());
+                    trace += "}}";
+                }
+            }
+
+            for (const AZStd::sys_time_t frameBeginTick : frameBeginTicks)
+            {
+                if (frameBeginTick >= startTick)
+                {
+                    beginEvent();
+                    trace += AZStd::string::format("\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":%zu,\"name\":\"Frame\",\"ts\":%.3f}",
+                        frameMarkerTid, toMicroseconds(frameBeginTick));
+                }
+            }
+
+            for (size_t threadIndex = 0; threadIndex < threads.size(); ++threadIndex)
+            {
+                for (const CachedTimeRegion& traceEvent : threads[threadIndex].m_events)
+                {
+                    beginEvent();
+                    trace += "\"ph\":\"X\",\"name\":";
+                    AppendJsonString(trace, traceEvent.m_groupRegionName->m_regionName);
+                    trace += ",\"cat\":";
+                    AppendJsonString(trace, traceEvent.m_groupRegionName->m_groupName);
+                    trace += AZStd::string::format(",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}",
+                        threadIndex, toMicroseconds(traceEvent.m_startTick), static_cast<double>(traceEvent.m_endTick - traceEvent.m_startTick) * microsecondsPerTick);
+                }
+            }
+
+            trace += "\n]}\n";
+        }
+
         void CpuProfilerImpl::RegisterThreadStorage()
         {
-            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
-            if (!ms_threadLocalStorage)
+            // The storage is thread local, so only its creation needs to be guarded
+            if (ms_threadLocalStorage)
+            {
+                return;
+            }
+
             {
-                ms_threadLocalStorage = aznew CpuTimingLocalStorage();
+                AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+                if (ms_threadLocalStorage)
+                {
+                    return;
+                }
+                ms_threadLocalStorage = aznew CpuTimingLocalStorage(CpuProfilerImplCPP::GetTraceEventRingSize());
                 m_registeredThreads.emplace_back(ms_threadLocalStorage);
             }
+
+            // Threads that were started before the profiler was initialized, like the job manager's workers, were never named
+            // through OnThreadEnter
+            AZStd::string threadName;
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadNamesMutex);
+            if (m_threadNames.find(AZStd::this_thread::get_id()) == m_threadNames.end() && CpuProfilerImplCPP::GetCurrentThreadName(threadName))
+            {
+                m_threadNames[AZStd::this_thread::get_id()] = AZStd::move(threadName);
+            }
         }
 
         // --- CpuTimingLocalStorage ---
 
-        CpuTimingLocalStorage::CpuTimingLocalStorage()
+        CpuTimingLocalStorage::CpuTimingLocalStorage(uint32_t traceEventRingSize)
+            : m_traceEventRing(traceEventRingSize)
         {
+            AZ_Assert(IsPowerOfTwo(traceEventRingSize), "The size of the trace event ring needs to be a power of two");
             m_executingThreadId = AZStd::this_thread::get_id();
         }
 
@@ -224,15 +533,16 @@ namespace AZ
 
         void CpuTimingLocalStorage::RegionStackPushBack(TimeRegion& timeRegion)
         {
-            // If it was (re)enabled, clear the lists first
+            // If it was (re)enabled, clear the regions cached by the previous capture first. The stack and its level are
+            // kept, they belong to regions that are still open and will be popped when those end.
             if (m_clearContainers)
             {
                 m_clearContainers = false;
 
-                m_stackLevel = 0;
+                AZStd::unique_lock<AZStd::mutex> lock(m_cachedTimeRegionMutex);
                 m_cachedTimeRegionMap.clear();
-                m_timeRegionStack.clear();
                 m_cachedTimeRegions.clear();
+                m_hitSizeLimitMap.clear();
             }
 
             timeRegion.m_stackDepth = m_stackLevel;
@@ -247,7 +557,7 @@ namespace AZ
             timeRegion.m_startTick = AZStd::GetTimeNowTicks();
         }
 
-        void CpuTimingLocalStorage::RegionStackPopBack()
+        void CpuTimingLocalStorage::RegionStackPopBack(bool cacheRegion, bool recordTraceEvent)
         {
             // Early out when the stack is empty, this might happen when the profiler was enabled while the thread encountered profiling markers
             if (m_timeRegionStack.empty())
@@ -268,8 +578,18 @@ namespace AZ
             // Decrement the stack
             m_stackLevel--;
 
+            const CachedTimeRegion timeRegionCached(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick);
+
+            if (recordTraceEvent)
+            {
+                RecordTraceEvent(timeRegionCached);
+            }
+
             // Add an entry to the cached region
-            AddCachedRegion(CachedTimeRegion(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick));
+            if (cacheRegion)
+            {
+                AddCachedRegion(CachedTimeRegion(timeRegionCached));
+            }
         }
 
         // Gets called when region ends and all data is set
@@ -324,5 +644,40 @@ namespace AZ
                 m_cachedTimeRegionMutex.unlock();
             }
         }
+
+        void CpuTimingLocalStorage::RecordTraceEvent(const CachedTimeRegion& timeRegion)
+        {
+            // Single writer: the entry is written under its sequence, and published by the release store of the write index
+            const uint64_t writeIndex = m_traceEventWriteIndex.load(AZStd::memory_order_relaxed);
+            CpuProfilerImplCPP::WriteRingEntry(m_traceEventRing[writeIndex & (m_traceEventRing.size() - 1)], writeIndex, timeRegion);
+            m_traceEventWriteIndex.store(writeIndex + 1, AZStd::memory_order_release);
+        }
+
+        void CpuTimingLocalStorage::CopyTraceEvents(AZStd::vector<CachedTimeRegion>& traceEvents, AZStd::sys_time_t startTick) const
+        {
+            const uint64_t endIndex = m_traceEventWriteIndex.load(AZStd::memory_order_acquire);
+            const uint64_t ringSize = m_traceEventRing.size();
+            const uint64_t beginIndex = endIndex > ringSize ? endIndex - ringSize : 0;
+
+            // The owning thread keeps recording while the entries are copied, the entries it overwrites or is writing
+            // don't have the sequence of their write index and are skipped
+            const size_t firstCopied = traceEvents.size();
+            traceEvents.reserve(firstCopied + (endIndex - beginIndex));
+            for (uint64_t eventIndex = beginIndex; eventIndex < endIndex; ++eventIndex)
+            {
+                CachedTimeRegion traceEvent;
+                if (CpuProfilerImplCPP::ReadRingEntry(m_traceEventRing[eventIndex & (m_traceEventRing.size() - 1)], eventIndex, traceEvent))
+                {
+                    traceEvents.push_back(traceEvent);
+                }
+            }
+
+            traceEvents.erase(
+                AZStd::remove_if(traceEvents.begin() + firstCopied, traceEvents.end(), [startTick](const CachedTimeRegion& traceEvent)
+                {
+                    return traceEvent.m_endTick < startTick;
+                }),
+                traceEvents.end());
+        }
     }
 }
@@ -19,6 +19,9 @@
 #include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
@@ -26,6 +29,57 @@ namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            /**
+             * Builds a sortable key for transient attachment pool commands. The pool iterates each scope and
+             * performs deactivations followed by activations on each attachment.
+             */
+            const uint32_t ATTACHMENT_BIT_COUNT = 16;
+            const uint32_t SCOPE_BIT_COUNT = 14;
+
+            enum class Action
+            {
+                ActivateImage = 0,
+                ActivateBuffer,
+                DeactivateImage,
+                DeactivateBuffer,
+            };
+
+            struct Command
+            {
+                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
+                {
+                    m_bits.m_scopeIndex = scopeIndex;
+                    m_bits.m_action = (uint32_t)action;
+                    m_bits.m_attachmentIndex = attachmentIndex;
+                }
+
+                explicit Command(uint32_t command)
+                    : m_command(command)
+                {}
+
+                struct Bits
+                {
+                    /// Sort by attachment index last
+                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
+
+                    /// Sort by the action after the scope. First by deactivations, then by activations.
+                    uint32_t m_action : 2;
+
+                    /// Sort by scope index first.
+                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
+                };
+
+                union
+                {
+                    Bits m_bits;
+
+                    uint32_t m_command = 0;
+                };
+            };
+        }
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -61,6 +115,7 @@ namespace AZ
             {
                 m_imageViewCache.Clear();
                 m_bufferViewCache.Clear();
+                m_topologyCache = TopologyCache();
 
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -117,6 +172,10 @@ namespace AZ
          *
          *          The final phase is to compile the platform specific scopes and hand-off compilation to the platform-specific
          *          implementation, which may introduce more phases specific to the platform API.
+         *
+         * Phases 1 and 2 only depend on the topology of the graph. Unless disabled via
+         * FrameSchedulerCompileFlags::DisableTopologyCache, their results are cached and replayed on the next
+         * compile if the topology hash matches.
          */
         MessageOutcome FrameGraphCompiler::Compile(const FrameGraphCompileRequest& request)
         {
@@ -130,6 +189,26 @@ namespace AZ
 
             FrameGraph& frameGraph = *request.m_frameGraph;
 
+            if (CheckBitsAny(request.m_compileFlags, FrameSchedulerCompileFlags::DisableTopologyCache))
+            {
+                m_topologyCacheState = TopologyCacheState::Disabled;
+                m_topologyCache = TopologyCache();
+            }
+            else
+            {
+                const HashValue64 topologyHash = ComputeTopologyHash(request);
+                if (m_topologyCache.m_isValid && m_topologyCache.m_hash == topologyHash)
+                {
+                    m_topologyCacheState = TopologyCacheState::Replay;
+                }
+                else
+                {
+                    m_topologyCacheState = TopologyCacheState::Record;
+                    m_topologyCache = TopologyCache();
+                    m_topologyCache.m_hash = topologyHash;
+                }
+            }
+
             /// [Phase 1] Compiles the cross-queue scope graph.
             CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
 
@@ -140,8 +219,13 @@ namespace AZ
                 request.m_compileFlags,
                 request.m_statisticsFlags);
 
+            if (m_topologyCacheState == TopologyCacheState::Record)
+            {
+                m_topologyCache.m_isValid = true;
+            }
+
             /// [Phase 3] Compiles buffer / image views and assigns them to scope attachments.
-            CompileResourceViews(frameGraph.GetAttachmentDatabase());
+            CompileResourceViews(frameGraph.GetAttachmentDatabase(), request.m_jobPolicy);
 
             /// [Phase 4] Compile platform-specific scope data after all attachments and views have been compiled.
             {
@@ -157,6 +241,73 @@ namespace AZ
             return CompileInternal(request);
         }
 
+        HashValue64 FrameGraphCompiler::ComputeTopologyHash(const FrameGraphCompileRequest& request) const
+        {
+            AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: ComputeTopologyHash");
+
+            const FrameGraph& frameGraph = *request.m_frameGraph;
+            HashValue64 hash = TypeHash64(request.m_compileFlags);
+
+            // The memory hint depends on the pool configuration as well as the attachments.
+            if (const TransientAttachmentPool* transientAttachmentPool = request.m_transientAttachmentPool)
+            {
+                const TransientAttachmentPoolDescriptor& poolDescriptor = transientAttachmentPool->GetDescriptor();
+                hash = TypeHash64(transientAttachmentPool, hash);
+                hash = TypeHash64(poolDescriptor.m_heapParameters.m_type, hash);
+                hash = TypeHash64(poolDescriptor.m_bufferBudgetInBytes, hash);
+                hash = TypeHash64(poolDescriptor.m_imageBudgetInBytes, hash);
+                hash = TypeHash64(poolDescriptor.m_renderTargetBudgetInBytes, hash);
+            }
+
+            for (const Scope* scope : frameGraph.GetScopes())
+            {
+                hash = TypeHash64(scope->GetId().GetHash(), hash);
+                hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+
+                const AZStd::vector<Scope*>& consumers = frameGraph.GetConsumers(*scope);
+                hash = TypeHash64(static_cast<uint32_t>(consumers.size()), hash);
+                for (const Scope* consumer : consumers)
+                {
+                    hash = TypeHash64(consumer->GetIndex(), hash);
+                }
+
+                const AZStd::vector<ScopeAttachment*>& transientAttachments = scope->GetTransientAttachments();
+                hash = TypeHash64(static_cast<uint32_t>(transientAttachments.size()), hash);
+                for (const ScopeAttachment* scopeAttachment : transientAttachments)
+                {
+                    hash = TypeHash64(scopeAttachment->GetFrameAttachment().GetId().GetHash(), hash);
+                }
+            }
+
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+
+            const auto hashTransientAttachment = [&hash](const FrameAttachment& frameAttachment)
+            {
+                hash = TypeHash64(frameAttachment.GetId().GetHash(), hash);
+                hash = TypeHash64(frameAttachment.GetSupportedQueueMask(), hash);
+                hash = TypeHash64(frameAttachment.GetFirstScope()->GetIndex(), hash);
+                hash = TypeHash64(frameAttachment.GetLastScope()->GetIndex(), hash);
+            };
+
+            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
+            hash = TypeHash64(static_cast<uint32_t>(transientBufferGraphAttachments.size()), hash);
+            for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
+            {
+                hashTransientAttachment(*transientBuffer);
+                hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+            }
+
+            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
+            hash = TypeHash64(static_cast<uint32_t>(transientImageGraphAttachments.size()), hash);
+            for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
+            {
+                hashTransientAttachment(*transientImage);
+                hash = transientImage->GetImageDescriptor().GetHash(hash);
+            }
+
+            return hash;
+        }
+
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags)
@@ -195,6 +346,17 @@ namespace AZ
                 return;
             }
 
+            /// The topology is unchanged since the edges were recorded, so replay them instead of searching again.
+            if (m_topologyCacheState == TopologyCacheState::Replay)
+            {
+                const auto& scopes = frameGraph.GetScopes();
+                for (const auto& edge : m_topologyCache.m_crossQueueEdges)
+                {
+                    Scope::LinkProducerConsumerByQueues(scopes[edge.first], scopes[edge.second]);
+                }
+                return;
+            }
+
             /**
              * Build cross-queue edges. This is more complicated because each queue forms a "track" of serialized scopes,
              * but each track is able to mark dependencies on nodes in other tracks. In the final graph, each scope is able to have
@@ -237,6 +399,11 @@ namespace AZ
                         if (foundEarlierConsumerOnSameQueue == false)
                         {
                             Scope::LinkProducerConsumerByQueues(producerScopeLast, currentScope);
+
+                            if (m_topologyCacheState == TopologyCacheState::Record)
+                            {
+                                m_topologyCache.m_crossQueueEdges.emplace_back(producerScopeLast->GetIndex(), currentScope->GetIndex());
+                            }
                         }
                     }
                 }
@@ -481,60 +648,46 @@ namespace AZ
 
             AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-
-            /**
-             * Builds a sortable key. It iterates each scope and performs deactivations
-             * followed by activations on each attachment.
-             */
-            const uint32_t ATTACHMENT_BIT_COUNT = 16;
-            const uint32_t SCOPE_BIT_COUNT = 14;
-
-            enum class Action
-            {
-                ActivateImage = 0,
-                ActivateBuffer,
-                DeactivateImage,
-                DeactivateBuffer,
-            };
+            const auto& scopes = frameGraph.GetScopes();
+            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
+            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
 
-            struct Command
+            if (m_topologyCacheState == TopologyCacheState::Replay)
             {
-                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
+                // Restore the lifetimes computed when the topology was recorded, including the async queue extension.
+                for (size_t attachmentIndex = 0; attachmentIndex < transientBufferGraphAttachments.size(); ++attachmentIndex)
                 {
-                    m_bits.m_scopeIndex = scopeIndex;
-                    m_bits.m_action = (uint32_t)action;
-                    m_bits.m_attachmentIndex = attachmentIndex;
+                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                    transientBuffer->m_firstScope = scopes[m_topologyCache.m_bufferLifetimes[attachmentIndex].first];
+                    transientBuffer->m_lastScope = scopes[m_topologyCache.m_bufferLifetimes[attachmentIndex].second];
                 }
 
-                bool operator < (Command rhs) const
+                for (size_t attachmentIndex = 0; attachmentIndex < transientImageGraphAttachments.size(); ++attachmentIndex)
                 {
-                    return m_command < rhs.m_command;
+                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                    transientImage->m_firstScope = scopes[m_topologyCache.m_imageLifetimes[attachmentIndex].first];
+                    transientImage->m_lastScope = scopes[m_topologyCache.m_imageLifetimes[attachmentIndex].second];
                 }
+            }
+            else
+            {
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
 
-                struct Bits
-                {
-                    /// Sort by attachment index last
-                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
-
-                    /// Sort by the action after the scope. First by deactivations, then by activations.
-                    uint32_t m_action : 2;
-
-                    /// Sort by scope index first.
-                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
-                };
-
-                union
+                if (m_topologyCacheState == TopologyCacheState::Record)
                 {
-                    Bits m_bits;
-
-                    uint32_t m_command = 0;
-                };
-            };
+                    m_topologyCache.m_bufferLifetimes.reserve(transientBufferGraphAttachments.size());
+                    for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
+                    {
+                        m_topologyCache.m_bufferLifetimes.emplace_back(transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex());
+                    }
 
-            const auto& scopes = frameGraph.GetScopes();
-            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
-            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
+                    m_topologyCache.m_imageLifetimes.reserve(transientImageGraphAttachments.size());
+                    for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
+                    {
+                        m_topologyCache.m_imageLifetimes.emplace_back(transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex());
+                    }
+                }
+            }
 
             AZ_Assert(scopes.size() < AZ_BIT(SCOPE_BIT_COUNT),
                 "Exceeded maximum number of allowed scopes");
@@ -544,52 +697,61 @@ namespace AZ
 
             AZStd::vector<Buffer*> transientBuffers(transientBufferGraphAttachments.size());
             AZStd::vector<Image*> transientImages(transientImageGraphAttachments.size());
-            AZStd::vector<Command> commands;
-            commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+            // The sorted commands are built in place in the topology cache, unless it is disabled.
+            AZStd::vector<uint32_t> uncachedCommands;
+            AZStd::vector<uint32_t>& commands =
+                m_topologyCacheState == TopologyCacheState::Disabled ? uncachedCommands : m_topologyCache.m_transientCommands;
+
+            // On a replay the cached commands are already sorted.
+            if (m_topologyCacheState != TopologyCacheState::Replay)
             {
-                const uint32_t ScopeIndexFirst = 0;
-                const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
+                commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
-                }
+                    const uint32_t ScopeIndexFirst = 0;
+                    const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
-                {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.push_back(Command(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex).m_command);
+                        commands.push_back(Command(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex).m_command);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.push_back(Command(ScopeIndexFirst, Action::ActivateImage, attachmentIndex).m_command);
+                        commands.push_back(Command(ScopeIndexLast, Action::DeactivateImage, attachmentIndex).m_command);
+                    }
                 }
-            }
-            else
-            {
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                else
                 {
-                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
-                }
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
+                        commands.push_back(Command(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex).m_command);
+                        commands.push_back(Command(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex).m_command);
+                    }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
-                {
-                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
+                        commands.push_back(Command(scopeIndexFirst, Action::ActivateImage, attachmentIndex).m_command);
+                        commands.push_back(Command(scopeIndexLast, Action::DeactivateImage, attachmentIndex).m_command);
+                    }
                 }
-            }
 
-            AZStd::sort(commands.begin(), commands.end());
+                AZStd::sort(commands.begin(), commands.end());
+            }
 
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
@@ -599,8 +761,9 @@ namespace AZ
 
                 bool allocateResources = !CheckBitsAny(compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources);
 
-                for (Command command : commands)
+                for (uint32_t commandBits : commands)
                 {
+                    const Command command(commandBits);
                     const uint32_t scopeIndex = command.m_bits.m_scopeIndex;
                     const uint32_t attachmentIndex = command.m_bits.m_attachmentIndex;
                     const Action action = (Action)command.m_bits.m_action;
@@ -700,9 +863,22 @@ namespace AZ
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                if (m_topologyCacheState == TopologyCacheState::Replay && m_topologyCache.m_memoryHint)
+                {
+                    // Same attachments, lifetimes and pool as the recorded frame, so the size needed is the same too.
+                    memoryUsage = m_topologyCache.m_memoryHint;
+                }
+                else
+                {
+                    // First pass to calculate size needed.
+                    processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+
+                    if (m_topologyCacheState == TopologyCacheState::Record)
+                    {
+                        m_topologyCache.m_memoryHint = memoryUsage;
+                    }
+                }
             }
 
             // Second pass uses the information about memory usage
@@ -766,10 +942,40 @@ namespace AZ
             return bufferView;
         }
 
-        void FrameGraphCompiler::CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase)
+        void FrameGraphCompiler::CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase, JobPolicy jobPolicy)
         {
             AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: CompileResourceViews");
 
+            // Images and buffers use separate view caches, so the two halves can run concurrently.
+            if (jobPolicy == JobPolicy::Parallel &&
+                !attachmentDatabase.GetImageAttachments().empty() &&
+                !attachmentDatabase.GetBufferAttachments().empty())
+            {
+                AZ::JobCompletion jobCompletion;
+
+                const auto compileImageViewsLambda = [this, &attachmentDatabase]()
+                {
+                    AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler : compileImageViewsLambda");
+                    CompileImageViews(attachmentDatabase);
+                };
+
+                AZ::Job* compileImageViewsJob = AZ::CreateJobFunction(AZStd::move(compileImageViewsLambda), true, nullptr);
+                compileImageViewsJob->SetDependent(&jobCompletion);
+                compileImageViewsJob->Start();
+
+                CompileBufferViews(attachmentDatabase);
+
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                CompileImageViews(attachmentDatabase);
+                CompileBufferViews(attachmentDatabase);
+            }
+        }
+
+        void FrameGraphCompiler::CompileImageViews(const FrameGraphAttachmentDatabase& attachmentDatabase)
+        {
             for (ImageFrameAttachment* imageAttachment : attachmentDatabase.GetImageAttachments())
             {
                 Image* image = imageAttachment->GetImage();
@@ -801,7 +1007,10 @@ namespace AZ
                     node->SetImageView(imageView);
                 }
             }
+        }
 
+        void FrameGraphCompiler::CompileBufferViews(const FrameGraphAttachmentDatabase& attachmentDatabase)
+        {
             for (BufferFrameAttachment* bufferAttachment : attachmentDatabase.GetBufferAttachments())
             {
                 Buffer* buffer = bufferAttachment->GetBuffer();
@@ -187,6 +187,7 @@ namespace AZ
             frameGraphCompileRequest.m_logVerbosity = compileRequest.m_logVerbosity;
             frameGraphCompileRequest.m_compileFlags = compileRequest.m_compileFlags;
             frameGraphCompileRequest.m_statisticsFlags = compileRequest.m_statisticsFlags;
+            frameGraphCompileRequest.m_jobPolicy = compileRequest.m_jobPolicy;
 
             const MessageOutcome outcome = m_frameGraphCompiler->Compile(frameGraphCompileRequest);
             if (outcome.IsSuccess())
@@ -257,65 +258,90 @@ namespace AZ
                 ResourceInvalidateBus::ExecuteQueuedEvents();
             }
 
+            CpuTimingStatistics::ShaderResourceGroupStatistics& srgStatistics = m_cpuTimingStatistics.m_shaderResourceGroupStatistics;
+            srgStatistics = {};
+            AZ_PROFILE_RHI_VARIABLE(srgStatistics.m_compileDuration);
+
             const ResourcePoolDatabase& resourcePoolDatabase = m_device->GetResourcePoolDatabase();
 
-            if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel)
+            // Gather the queued groups of every pool into a single range so that jobs are sized by the total
+            // number of groups, not by the number of pools (most pools only have a handful of groups queued).
+            uint32_t groupsToCompileCount = 0;
+            m_srgCompileRanges.clear();
+            const auto compileGroupsBeginFunction = [this, &groupsToCompileCount](ShaderResourceGroupPool* srgPool)
             {
-                const auto compileGroupsBeginFunction = [](ShaderResourceGroupPool* srgPool)
+                srgPool->CompileGroupsBegin();
+
+                const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
+                if (compilesInPool)
                 {
-                    srgPool->CompileGroupsBegin();
-                };
+                    m_srgCompileRanges.push_back({ srgPool, groupsToCompileCount, compilesInPool });
+                    groupsToCompileCount += compilesInPool;
+                }
+            };
 
-                resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
+            resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
 
-                // Iterate over each SRG pool and fork jobs to compile SRGs.
-                const uint32_t compilesPerJob = m_compileRequest.m_shaderResourceGroupCompilesPerJob;
+            const uint32_t compilesPerJob = AZStd::max(m_compileRequest.m_shaderResourceGroupCompilesPerJob, 1u);
+            const uint32_t jobCount = DivideByMultiple(groupsToCompileCount, compilesPerJob);
+
+            if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel && jobCount > 1)
+            {
                 AZ::JobCompletion jobCompletion;
 
-                const auto compileIntervalsFunction = [compilesPerJob, &jobCompletion](ShaderResourceGroupPool* srgPool)
+                for (uint32_t i = 0; i < jobCount; ++i)
                 {
-                    const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
-                    const uint32_t jobCount = DivideByMultiple(compilesInPool, compilesPerJob);
+                    Interval interval;
+                    interval.m_min = i * compilesPerJob;
+                    interval.m_max = AZStd::min(interval.m_min + compilesPerJob, groupsToCompileCount);
 
-                    for (uint32_t i = 0; i < jobCount; ++i)
+                    const auto compileGroupsForIntervalLambda = [this, interval]()
                     {
-                        Interval interval;
-                        interval.m_min = i * compilesPerJob;
-                        interval.m_max = AZStd::min(interval.m_min + compilesPerJob, compilesInPool);
-
-                        const auto compileGroupsForIntervalLambda = [srgPool, interval]()
-                        {
-                            AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameScheduler : compileGroupsForIntervalLambda");
-                            srgPool->CompileGroupsForInterval(interval);
-                        };
-
-                        AZ::Job* executeGroupJob = AZ::CreateJobFunction(AZStd::move(compileGroupsForIntervalLambda), true, nullptr);
-                        executeGroupJob->SetDependent(&jobCompletion);
-                        executeGroupJob->Start();
-                    }
-                };
+                        AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameScheduler : compileGroupsForIntervalLambda");
+                        CompileShaderResourceGroupsForInterval(interval);
+                    };
 
-                resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(AZStd::move(compileIntervalsFunction));
+                    AZ::Job* executeGroupJob = AZ::CreateJobFunction(AZStd::move(compileGroupsForIntervalLambda), true, nullptr);
+                    executeGroupJob->SetDependent(&jobCompletion);
+                    executeGroupJob->Start();
+                }
 
                 jobCompletion.StartAndWaitForCompletion();
-
-                const auto compileGroupsEndFunction = [](ShaderResourceGroupPool* srgPool)
-                {
-                    srgPool->CompileGroupsEnd();
-                };
-
-                resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
+                srgStatistics.m_jobCount = jobCount;
             }
             else
             {
-                const auto compileAllLambda = [](ShaderResourceGroupPool* srgPool)
+                CompileShaderResourceGroupsForInterval(Interval(0, groupsToCompileCount));
+            }
+
+            const auto compileGroupsEndFunction = [&srgStatistics](ShaderResourceGroupPool* srgPool)
+            {
+                const ShaderResourceGroupPool::CompileStatistics& poolStatistics = srgPool->GetCompileStatistics();
+                srgStatistics.m_compiledGroupCount += poolStatistics.m_compiledGroupCount;
+                srgStatistics.m_skippedGroupCount += poolStatistics.m_skippedGroupCount;
+                srgStatistics.m_constantBytes += poolStatistics.m_constantBytes;
+
+                srgPool->CompileGroupsEnd();
+            };
+
+            resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
+        }
+
+        void FrameScheduler::CompileShaderResourceGroupsForInterval(Interval interval) const
+        {
+            // Find the first pool overlapping the interval, then walk forward until the interval is exhausted.
+            auto rangeIt = AZStd::upper_bound(
+                m_srgCompileRanges.begin(), m_srgCompileRanges.end(), interval.m_min,
+                [](uint32_t index, const ShaderResourceGroupCompileRange& range)
                 {
-                    srgPool->CompileGroupsBegin();
-                    srgPool->CompileGroupsForInterval(Interval(0, srgPool->GetGroupsToCompileCount()));
-                    srgPool->CompileGroupsEnd();
-                };
+                    return index < range.m_offset + range.m_count;
+                });
 
-                resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileAllLambda)>(compileAllLambda);
+            for (; rangeIt != m_srgCompileRanges.end() && rangeIt->m_offset < interval.m_max; ++rangeIt)
+            {
+                const uint32_t rangeMin = AZStd::max(interval.m_min, rangeIt->m_offset);
+                const uint32_t rangeMax = AZStd::min(interval.m_max, rangeIt->m_offset + rangeIt->m_count);
+                rangeIt->m_pool->CompileGroupsForInterval(Interval(rangeMin - rangeIt->m_offset, rangeMax - rangeIt->m_offset));
             }
         }
 
@@ -8,6 +8,7 @@
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ
 {
@@ -71,6 +72,7 @@ namespace AZ
 
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
+                group.m_isCompiled = false;
             }
             return resultCode;
         }
@@ -106,41 +108,113 @@ namespace AZ
             shaderResourceGroup.SetData(ShaderResourceGroupData());
         }
 
+        ShaderResourceGroupPool::CompileQueue& ShaderResourceGroupPool::GetCompileQueueForCurrentThread()
+        {
+            const size_t threadHash = AZStd::hash<AZStd::thread_id>()(AZStd::this_thread::get_id());
+            return m_compileQueues[threadHash % CompileQueueCount];
+        }
+
+        bool ShaderResourceGroupPool::IsCompiledDataEqual(const ShaderResourceGroup& group, const ShaderResourceGroupData& groupData) const
+        {
+            const ShaderResourceGroupLayout* layout = GetLayout();
+            if (!group.m_isCompiled ||
+                // Unbounded arrays are resized per compile; always let the platform rebuild them.
+                layout->GetGroupSizeForBufferUnboundedArrays() > 0 ||
+                layout->GetGroupSizeForImageUnboundedArrays() > 0)
+            {
+                return false;
+            }
+
+            const ShaderResourceGroupData& compiledData = group.GetData();
+
+            const AZStd::array_view<uint8_t> compiledConstants = compiledData.GetConstantData();
+            const AZStd::array_view<uint8_t> constants = groupData.GetConstantData();
+            if (compiledConstants.size() != constants.size() ||
+                memcmp(compiledConstants.data(), constants.data(), constants.size()) != 0)
+            {
+                return false;
+            }
+
+            const auto IsViewGroupEqual = [](auto compiledViews, auto views)
+            {
+                if (compiledViews.size() != views.size())
+                {
+                    return false;
+                }
+                for (size_t i = 0; i < views.size(); ++i)
+                {
+                    if (compiledViews[i] != views[i])
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            if (!IsViewGroupEqual(compiledData.GetImageGroup(), groupData.GetImageGroup()) ||
+                !IsViewGroupEqual(compiledData.GetBufferGroup(), groupData.GetBufferGroup()))
+            {
+                return false;
+            }
+
+            const AZStd::array_view<SamplerState> compiledSamplers = compiledData.GetSamplerGroup();
+            const AZStd::array_view<SamplerState> samplers = groupData.GetSamplerGroup();
+            return compiledSamplers.size() == samplers.size() &&
+                memcmp(compiledSamplers.data(), samplers.data(), samplers.size() * sizeof(SamplerState)) == 0;
+        }
+
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            CompileQueue& compileQueue = GetCompileQueueForCurrentThread();
+            AZStd::lock_guard<AZStd::mutex> lock(compileQueue.m_mutex);
 
-            AZ_Assert(!shaderResourceGroup.IsQueuedForCompile(), "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");            
+            AZ_Assert(!shaderResourceGroup.IsQueuedForCompile(), "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");
+
+            // The platform keeps the last compiled data alive until the group is compiled again, so
+            // re-submitting identical data would only copy the same constants and descriptors again.
+            if (IsCompiledDataEqual(shaderResourceGroup, groupData))
+            {
+                m_skippedGroupCount.fetch_add(1, AZStd::memory_order_relaxed);
+                return;
+            }
 
             CalculateGroupDataDiff(shaderResourceGroup, groupData);
 
             shaderResourceGroup.SetData(groupData);
 
-            QueueForCompileNoLock(shaderResourceGroup);
+            QueueForCompileNoLock(shaderResourceGroup, compileQueue);
         }
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
-            QueueForCompileNoLock(group);
+            CompileQueue& compileQueue = GetCompileQueueForCurrentThread();
+            AZStd::lock_guard<AZStd::mutex> lock(compileQueue.m_mutex);
+            QueueForCompileNoLock(group, compileQueue);
         }
 
-        void ShaderResourceGroupPool::QueueForCompileNoLock(ShaderResourceGroup& group)
+        void ShaderResourceGroupPool::QueueForCompileNoLock(ShaderResourceGroup& group, CompileQueue& compileQueue)
         {
             if (!group.m_isQueuedForCompile)
             {
                 group.m_isQueuedForCompile = true;
-                m_groupsToCompile.emplace_back(&group);
+                group.m_compileQueueIndex = static_cast<uint32_t>(&compileQueue - m_compileQueues.data());
+                compileQueue.m_groups.emplace_back(&group);
             }
         }
 
         void ShaderResourceGroupPool::UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            if (!shaderResourceGroup.m_isQueuedForCompile)
+            {
+                return;
+            }
+
+            CompileQueue& compileQueue = m_compileQueues[shaderResourceGroup.m_compileQueueIndex];
+            AZStd::lock_guard<AZStd::mutex> lock(compileQueue.m_mutex);
             if (shaderResourceGroup.m_isQueuedForCompile)
             {
                 shaderResourceGroup.m_isQueuedForCompile = false;
-                m_groupsToCompile.erase(AZStd::find(m_groupsToCompile.begin(), m_groupsToCompile.end(), &shaderResourceGroup));
+                compileQueue.m_groups.erase(AZStd::find(compileQueue.m_groups.begin(), compileQueue.m_groups.end(), &shaderResourceGroup));
             }
         }
 
@@ -149,6 +223,7 @@ namespace AZ
             CalculateGroupDataDiff(group, groupData);
             group.SetData(groupData);
             CompileGroupInternal(group, group.GetData());
+            group.m_isCompiled = true;
         }
 
         void ShaderResourceGroupPool::CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
@@ -223,7 +298,26 @@ namespace AZ
         void ShaderResourceGroupPool::CompileGroupsBegin()
         {
             AZ_Assert(m_isCompiling == false, "Already compiling! Deadlock imminent.");
-            m_groupsToCompileMutex.lock();
+
+            // The queue locks are held until CompileGroupsEnd() so that no group is queued or
+            // unqueued while the gathered list is being compiled.
+            size_t groupCount = 0;
+            for (CompileQueue& compileQueue : m_compileQueues)
+            {
+                compileQueue.m_mutex.lock();
+                groupCount += compileQueue.m_groups.size();
+            }
+
+            m_groupsToCompile.reserve(groupCount);
+            for (CompileQueue& compileQueue : m_compileQueues)
+            {
+                m_groupsToCompile.insert(m_groupsToCompile.end(), compileQueue.m_groups.begin(), compileQueue.m_groups.end());
+                compileQueue.m_groups.clear();
+            }
+
+            m_compileStatistics.m_compiledGroupCount = static_cast<uint32_t>(m_groupsToCompile.size());
+            m_compileStatistics.m_skippedGroupCount = m_skippedGroupCount.exchange(0, AZStd::memory_order_relaxed);
+            m_compileStatistics.m_constantBytes = static_cast<uint64_t>(m_groupsToCompile.size()) * GetLayout()->GetConstantDataSize();
             m_isCompiling = true;
         }
 
@@ -232,7 +326,10 @@ namespace AZ
             AZ_Assert(m_isCompiling, "CompileGroupsBegin() was never called.");
             m_isCompiling = false;
             m_groupsToCompile.clear();
-            m_groupsToCompileMutex.unlock();
+            for (auto it = m_compileQueues.rbegin(); it != m_compileQueues.rend(); ++it)
+            {
+                it->m_mutex.unlock();
+            }
         }
 
         uint32_t ShaderResourceGroupPool::GetGroupsToCompileCount() const
@@ -241,6 +338,11 @@ namespace AZ
             return static_cast<uint32_t>(m_groupsToCompile.size());
         }
 
+        const ShaderResourceGroupPool::CompileStatistics& ShaderResourceGroupPool::GetCompileStatistics() const
+        {
+            return m_compileStatistics;
+        }
+
         void ShaderResourceGroupPool::CompileGroupsForInterval(Interval interval)
         {
             AZ_TRACE_METHOD_NAME("CompileGroupsForInterval");
@@ -256,6 +358,7 @@ namespace AZ
                 ShaderResourceGroup* group = m_groupsToCompile[i];
                 CompileGroupInternal(*group, group->GetData());
                 group->m_isQueuedForCompile = false;
+                group->m_isCompiled = true;
             }
         }
 
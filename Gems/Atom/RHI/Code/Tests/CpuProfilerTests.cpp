@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <Tests/Factory.h>
+#include <Tests/Device.h>
+#include <Atom/RHI/CpuProfilerImpl.h>
+#include <Atom/RHI/FrameScheduler.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI.Reflect/PlatformLimitsDescriptor.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    // The CpuProfilerImpl only needs the device from the RHI system, to connect to its frame events
+    class CpuProfilerTestRHISystem
+        : public RHI::RHISystemInterface
+    {
+    public:
+        explicit CpuProfilerTestRHISystem(RHI::Ptr<RHI::Device> device)
+            : m_device(AZStd::move(device))
+        {
+        }
+
+        RHI::Device* GetDevice() override { return m_device.get(); }
+        RHI::DrawListTagRegistry* GetDrawListTagRegistry() override { return nullptr; }
+        RHI::PipelineStateCache* GetPipelineStateCache() override { return nullptr; }
+        const RHI::FrameSchedulerCompileRequest& GetFrameSchedulerCompileRequest() const override { return m_compileRequest; }
+        void ModifyFrameSchedulerStatisticsFlags(RHI::FrameSchedulerStatisticsFlags, bool) override {}
+        const RHI::CpuTimingStatistics* GetCpuTimingStatistics() const override { return nullptr; }
+        const RHI::TransientAttachmentStatistics* GetTransientAttachmentStatistics() const override { return nullptr; }
+        const RHI::TransientAttachmentPoolDescriptor* GetTransientAttachmentPoolDescriptor() const override { return nullptr; }
+        RHI::ConstPtr<RHI::PlatformLimitsDescriptor> GetPlatformLimitsDescriptor() const override { return nullptr; }
+        void QueueRayTracingShaderTableForBuild(RHI::RayTracingShaderTable*) override {}
+
+    private:
+        RHI::Ptr<RHI::Device> m_device;
+        RHI::FrameSchedulerCompileRequest m_compileRequest;
+    };
+
+    class CpuProfilerTests
+        : public RHITestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            RHITestFixture::SetUp();
+
+            m_priorFileIO = IO::FileIOBase::GetInstance();
+            IO::FileIOBase::SetInstance(nullptr);
+            IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_factory.reset(aznew Factory());
+            m_rhiSystem = AZStd::make_unique<CpuProfilerTestRHISystem>(MakeTestDevice());
+            Interface<RHI::RHISystemInterface>::Register(m_rhiSystem.get());
+
+            m_profiler = AZStd::make_unique<RHI::CpuProfilerImpl>();
+            m_profiler->Init();
+        }
+
+        void TearDown() override
+        {
+            m_profiler->Shutdown();
+            m_profiler.reset();
+
+            Interface<RHI::RHISystemInterface>::Unregister(m_rhiSystem.get());
+            m_rhiSystem.reset();
+            m_factory.reset();
+
+            IO::FileIOBase::SetInstance(nullptr);
+            IO::FileIOBase::SetInstance(m_priorFileIO);
+
+            RHITestFixture::TearDown();
+        }
+
+        // Dumps the trace of the last minute and parses the written file
+        void DumpAndParseTrace(rapidjson::Document& trace)
+        {
+            AZ::Test::ScopedAutoTempDirectory tempDirectory;
+            const AZStd::string filePath = tempDirectory.Resolve("CpuTrace.json");
+
+            AZ::ConsoleCommandContainer arguments;
+            arguments.push_back("60");
+            arguments.push_back(filePath);
+            m_profiler->DumpTrace(arguments);
+
+            auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(filePath);
+            ASSERT_TRUE(readOutcome.IsSuccess());
+            const AZStd::string& json = readOutcome.GetValue();
+            trace.Parse(json.c_str(), json.size());
+            ASSERT_FALSE(trace.HasParseError());
+        }
+
+        // Counts the complete events of the test's category by name
+        static AZStd::unordered_map<AZStd::string, int> CountRegions(const rapidjson::Document& trace)
+        {
+            AZStd::unordered_map<AZStd::string, int> regionCounts;
+            for (const rapidjson::Value& traceEvent : trace["traceEvents"].GetArray())
+            {
+                if (AZStd::string(traceEvent["ph"].GetString()) == "X" && AZStd::string(traceEvent["cat"].GetString()) == "CpuProfilerTests")
+                {
+                    regionCounts[traceEvent["name"].GetString()]++;
+                }
+            }
+            return regionCounts;
+        }
+
+        IO::FileIOBase* m_priorFileIO = nullptr;
+        IO::LocalFileIO m_fileIO;
+        AZStd::unique_ptr<Factory> m_factory;
+        AZStd::unique_ptr<CpuProfilerTestRHISystem> m_rhiSystem;
+        AZStd::unique_ptr<RHI::CpuProfilerImpl> m_profiler;
+    };
+
+    TEST_F(CpuProfilerTests, DumpTrace_RecordedRegionsAndFrames_RoundTripThroughTraceEventFormat)
+    {
+        m_profiler->OnFrameBegin();
+        {
+            AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Outer");
+            {
+                AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Inner \"Quoted\"");
+            }
+        }
+
+        AZStd::thread_desc workerDesc;
+        workerDesc.m_name = "CpuProfilerTests Worker";
+        AZStd::thread worker([]()
+        {
+            AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Worker");
+        }, &workerDesc);
+        worker.join();
+        m_profiler->OnFrameBegin();
+
+        rapidjson::Document trace;
+        DumpAndParseTrace(trace);
+        if (HasFatalFailure())
+        {
+            return;
+        }
+
+        ASSERT_TRUE(trace.IsObject());
+        ASSERT_TRUE(trace.HasMember("traceEvents"));
+        const rapidjson::Value& traceEvents = trace["traceEvents"];
+        ASSERT_TRUE(traceEvents.IsArray());
+
+        AZStd::unordered_map<int64_t, AZStd::string> threadNames;
+        AZStd::unordered_map<AZStd::string, const rapidjson::Value*> regions;
+        AZStd::vector<const rapidjson::Value*> frames;
+        for (const rapidjson::Value& traceEvent : traceEvents.GetArray())
+        {
+            ASSERT_TRUE(traceEvent.HasMember("ph") && traceEvent["ph"].IsString());
+            ASSERT_TRUE(traceEvent.HasMember("tid") && traceEvent["tid"].IsInt64());
+            const AZStd::string phase = traceEvent["ph"].GetString();
+            if (phase == "M")
+            {
+                threadNames[traceEvent["tid"].GetInt64()] = traceEvent["args"]["name"].GetString();
+            }
+            else if (phase == "X" && AZStd::string(traceEvent["cat"].GetString()) == "CpuProfilerTests")
+            {
+                EXPECT_EQ(regions.count(traceEvent["name"].GetString()), 0);
+                regions[traceEvent["name"].GetString()] = &traceEvent;
+            }
+            else if (phase == "i")
+            {
+                frames.push_back(&traceEvent);
+            }
+        }
+
+        ASSERT_EQ(regions.count("Outer"), 1);
+        ASSERT_EQ(regions.count("Inner \"Quoted\""), 1);
+        ASSERT_EQ(regions.count("Worker"), 1);
+        const rapidjson::Value& outer = *regions["Outer"];
+        const rapidjson::Value& inner = *regions["Inner \"Quoted\""];
+        const rapidjson::Value& workerRegion = *regions["Worker"];
+
+        // Timestamps are written with a precision of a nanosecond
+        constexpr double Tolerance = 0.002;
+        EXPECT_EQ(outer["tid"].GetInt64(), inner["tid"].GetInt64());
+        EXPECT_GE(inner["ts"].GetDouble() + Tolerance, outer["ts"].GetDouble());
+        EXPECT_LE(inner["ts"].GetDouble() + inner["dur"].GetDouble(), outer["ts"].GetDouble() + outer["dur"].GetDouble() + Tolerance);
+        EXPECT_LE(outer["ts"].GetDouble() + outer["dur"].GetDouble(), workerRegion["ts"].GetDouble() + Tolerance);
+
+        EXPECT_NE(workerRegion["tid"].GetInt64(), outer["tid"].GetInt64());
+        EXPECT_EQ(threadNames[outer["tid"].GetInt64()], "Main Thread");
+        EXPECT_EQ(threadNames[workerRegion["tid"].GetInt64()], "CpuProfilerTests Worker");
+
+        // The frame markers are on a track of their own, which no thread uses
+        ASSERT_EQ(frames.size(), 2);
+        const int64_t frameTid = (*frames[0])["tid"].GetInt64();
+        EXPECT_EQ((*frames[1])["tid"].GetInt64(), frameTid);
+        EXPECT_NE(frameTid, outer["tid"].GetInt64());
+        EXPECT_NE(frameTid, workerRegion["tid"].GetInt64());
+        EXPECT_EQ(threadNames[frameTid], "Frames");
+        EXPECT_LE((*frames[0])["ts"].GetDouble(), outer["ts"].GetDouble() + Tolerance);
+        EXPECT_GE((*frames[1])["ts"].GetDouble() + Tolerance, workerRegion["ts"].GetDouble() + workerRegion["dur"].GetDouble());
+    }
+
+    TEST_F(CpuProfilerTests, SetProfilerEnabled_WhileRegionIsOpen_KeepsTheOpenRegion)
+    {
+        {
+            AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Outer");
+            m_profiler->SetProfilerEnabled(true);
+            {
+                AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Inner");
+            }
+        }
+        m_profiler->SetProfilerEnabled(false);
+
+        rapidjson::Document trace;
+        DumpAndParseTrace(trace);
+        if (HasFatalFailure())
+        {
+            return;
+        }
+
+        // Enabling the profiler doesn't drop the region that was open, the inner region is still nested in it
+        int64_t outerTid = -1;
+        int64_t innerTid = -1;
+        for (const rapidjson::Value& traceEvent : trace["traceEvents"].GetArray())
+        {
+            if (AZStd::string(traceEvent["ph"].GetString()) != "X" || AZStd::string(traceEvent["cat"].GetString()) != "CpuProfilerTests")
+            {
+                continue;
+            }
+            const AZStd::string name = traceEvent["name"].GetString();
+            if (name == "Outer")
+            {
+                outerTid = traceEvent["tid"].GetInt64();
+            }
+            else if (name == "Inner")
+            {
+                innerTid = traceEvent["tid"].GetInt64();
+            }
+        }
+        EXPECT_NE(outerTid, -1);
+        EXPECT_EQ(outerTid, innerTid);
+    }
+
+    TEST_F(CpuProfilerTests, DumpTrace_TraceEventRingSize_KeepsTheLastRegions)
+    {
+        // The size is read when a thread registers, the calling thread registers again after the profiler is restarted
+        const uint32_t priorRingSize = RHI::r_cpuProfilerTraceEventRingSize;
+        RHI::r_cpuProfilerTraceEventRingSize = 10;
+        m_profiler->Shutdown();
+        m_profiler->Init();
+
+        for (int region = 0; region < 40; ++region)
+        {
+            AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Repeated");
+        }
+        {
+            AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Last");
+        }
+
+        rapidjson::Document trace;
+        DumpAndParseTrace(trace);
+        RHI::r_cpuProfilerTraceEventRingSize = priorRingSize;
+        if (HasFatalFailure())
+        {
+            return;
+        }
+
+        // The size is rounded up to 16 regions, the oldest regions were overwritten
+        AZStd::unordered_map<AZStd::string, int> regionCounts = CountRegions(trace);
+        EXPECT_EQ(regionCounts["Repeated"], 15);
+        EXPECT_EQ(regionCounts["Last"], 1);
+    }
+
+#if !AZ_TRAIT_OS_USE_WINDOWS_THREADS
+    TEST_F(CpuProfilerTests, DumpTrace_ThreadStartedBeforeInit_IsNamedByTheOS)
+    {
+        m_profiler->Shutdown();
+
+        // The thread is started while the profiler isn't listening to the thread events, like the job manager's workers
+        AZStd::binary_semaphore profilerInitialized;
+        AZStd::thread_desc workerDesc;
+        workerDesc.m_name = "CpuProfilerPre";
+        AZStd::thread worker([&profilerInitialized]()
+        {
+            profilerInitialized.acquire();
+            AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Worker");
+        }, &workerDesc);
+
+        m_profiler->Init();
+        profilerInitialized.release();
+        worker.join();
+
+        rapidjson::Document trace;
+        DumpAndParseTrace(trace);
+        if (HasFatalFailure())
+        {
+            return;
+        }
+
+        AZStd::unordered_map<int64_t, AZStd::string> threadNames;
+        int64_t workerTid = -1;
+        for (const rapidjson::Value& traceEvent : trace["traceEvents"].GetArray())
+        {
+            const AZStd::string phase = traceEvent["ph"].GetString();
+            if (phase == "M")
+            {
+                threadNames[traceEvent["tid"].GetInt64()] = traceEvent["args"]["name"].GetString();
+            }
+            else if (phase == "X" && AZStd::string(traceEvent["name"].GetString()) == "Worker")
+            {
+                workerTid = traceEvent["tid"].GetInt64();
+            }
+        }
+        ASSERT_NE(workerTid, -1);
+        EXPECT_EQ(threadNames[workerTid], "CpuProfilerPre");
+    }
+#endif
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <Tests/Device.h>
+#include <Tests/Factory.h>
+#include <Atom/RHI/BufferScopeAttachment.h>
+#include <Atom/RHI/FrameGraph.h>
+#include <Atom/RHI/FrameGraphCompiler.h>
+#include <Atom/RHI/ImageScopeAttachment.h>
+#include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AZ;
+
+    //! Measures the platform-independent part of FrameGraph compilation on the test RHI, which
+    //! (like the Null RHI) does no work in its platform compile.
+    class BM_FrameGraphCompiler
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using ::benchmark::Fixture::SetUp, ::benchmark::Fixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+            NameDictionary::Create();
+
+            m_rootFactory.reset(aznew UnitTest::Factory());
+            m_device = UnitTest::MakeTestDevice();
+
+            m_frameGraphCompiler = RHI::Factory::Get().CreateFrameGraphCompiler();
+            m_frameGraphCompiler->Init(*m_device);
+
+            RHI::TransientAttachmentPoolDescriptor transientAttachmentPoolDescriptor;
+            transientAttachmentPoolDescriptor.m_bufferBudgetInBytes = 80 * 1024 * 1024;
+            m_transientAttachmentPool = RHI::Factory::Get().CreateTransientAttachmentPool();
+            m_transientAttachmentPool->Init(*m_device, transientAttachmentPoolDescriptor);
+
+            const uint32_t scopeCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_scopes.resize(scopeCount);
+            m_transientBufferIds.resize(scopeCount);
+            m_transientImageIds.resize(scopeCount);
+            for (uint32_t i = 0; i < scopeCount; ++i)
+            {
+                m_scopes[i] = RHI::Factory::Get().CreateScope();
+                m_scopes[i]->Init(RHI::ScopeId{ AZStd::string::format("S%d", i) });
+                m_transientBufferIds[i] = RHI::AttachmentId{ AZStd::string::format("TB%d", i) };
+                m_transientImageIds[i] = RHI::AttachmentId{ AZStd::string::format("TI%d", i) };
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_frameGraph.Clear();
+            m_scopes.clear();
+            m_transientBufferIds.clear();
+            m_transientImageIds.clear();
+            m_transientAttachmentPool = nullptr;
+            m_frameGraphCompiler = nullptr;
+            m_device = nullptr;
+            m_rootFactory.reset();
+
+            // Flushing the tick bus queue since AZ::RHI::Factory:Register queues a function
+            SystemTickBus::ClearQueuedEvents();
+
+            NameDictionary::Destroy();
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // Every fourth scope runs on the compute queue. Each scope writes a transient buffer and image
+        // which are read a few scopes later, so the graph has cross-queue edges and overlapping lifetimes.
+        void BuildFrameGraph()
+        {
+            RHI::BufferScopeAttachmentDescriptor bufferBindingDesc;
+            bufferBindingDesc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            RHI::ImageScopeAttachmentDescriptor imageBindingDesc;
+            imageBindingDesc.m_imageViewDescriptor = RHI::ImageViewDescriptor();
+
+            m_frameGraph.Begin();
+
+            const uint32_t scopeCount = aznumeric_cast<uint32_t>(m_scopes.size());
+            for (uint32_t scopeIdx = 0; scopeIdx < scopeCount; ++scopeIdx)
+            {
+                const bool isGraphics = IsGraphicsScope(scopeIdx);
+
+                m_frameGraph.BeginScope(*m_scopes[scopeIdx]);
+                m_frameGraph.SetHardwareQueueClass(isGraphics ? RHI::HardwareQueueClass::Graphics : RHI::HardwareQueueClass::Compute);
+
+                RHI::FrameGraphAttachmentDatabase& attachmentDatabase = m_frameGraph.GetAttachmentDatabase();
+
+                attachmentDatabase.CreateTransientBuffer(RHI::TransientBufferDescriptor{
+                    m_transientBufferIds[scopeIdx], RHI::BufferDescriptor(RHI::BufferBindFlags::ShaderReadWrite, BufferSize) });
+                bufferBindingDesc.m_attachmentId = m_transientBufferIds[scopeIdx];
+                m_frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                if (isGraphics)
+                {
+                    attachmentDatabase.CreateTransientImage(RHI::TransientImageDescriptor{
+                        m_transientImageIds[scopeIdx],
+                        RHI::ImageDescriptor::Create2D(RHI::ImageBindFlags::ShaderReadWrite, ImageSize, ImageSize, RHI::Format::R8G8B8A8_UNORM) });
+                    imageBindingDesc.m_attachmentId = m_transientImageIds[scopeIdx];
+                    m_frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+                }
+
+                if (scopeIdx >= ReadDistance)
+                {
+                    const uint32_t producerIdx = scopeIdx - ReadDistance;
+
+                    bufferBindingDesc.m_attachmentId = m_transientBufferIds[producerIdx];
+                    m_frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::Read);
+
+                    if (IsGraphicsScope(producerIdx))
+                    {
+                        imageBindingDesc.m_attachmentId = m_transientImageIds[producerIdx];
+                        m_frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::Read);
+                    }
+                }
+
+                m_frameGraph.EndScope();
+            }
+
+            m_frameGraph.End();
+        }
+
+        void RunCompile(::benchmark::State& state, RHI::FrameSchedulerCompileFlags compileFlags)
+        {
+            RHI::FrameGraphCompileRequest request;
+            request.m_frameGraph = &m_frameGraph;
+            request.m_transientAttachmentPool = m_transientAttachmentPool.get();
+            request.m_compileFlags = compileFlags;
+
+            for (auto _ : state)
+            {
+                state.PauseTiming();
+                BuildFrameGraph();
+                state.ResumeTiming();
+
+                m_frameGraphCompiler->Compile(request);
+            }
+
+            state.SetComplexityN(state.range(0));
+        }
+
+    private:
+        static bool IsGraphicsScope(uint32_t scopeIdx)
+        {
+            return (scopeIdx % 4) != 3;
+        }
+
+        static const uint32_t ReadDistance = 3;
+        static const uint32_t BufferSize = 64;
+        static const uint32_t ImageSize = 16;
+
+        AZStd::unique_ptr<UnitTest::Factory> m_rootFactory;
+        RHI::Ptr<RHI::Device> m_device;
+        RHI::Ptr<RHI::FrameGraphCompiler> m_frameGraphCompiler;
+        RHI::Ptr<RHI::TransientAttachmentPool> m_transientAttachmentPool;
+        RHI::FrameGraph m_frameGraph;
+        AZStd::vector<RHI::Ptr<RHI::Scope>> m_scopes;
+        AZStd::vector<RHI::AttachmentId> m_transientBufferIds;
+        AZStd::vector<RHI::AttachmentId> m_transientImageIds;
+    };
+
+    BENCHMARK_DEFINE_F(BM_FrameGraphCompiler, Compile_TopologyCache)(::benchmark::State& state)
+    {
+        RunCompile(state, RHI::FrameSchedulerCompileFlags::None);
+    }
+    BENCHMARK_REGISTER_F(BM_FrameGraphCompiler, Compile_TopologyCache)
+        ->RangeMultiplier(10)
+        ->Range(100, 1000)
+        ->Unit(benchmark::kMicrosecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_FrameGraphCompiler, Compile_NoTopologyCache)(::benchmark::State& state)
+    {
+        RunCompile(state, RHI::FrameSchedulerCompileFlags::DisableTopologyCache);
+    }
+    BENCHMARK_REGISTER_F(BM_FrameGraphCompiler, Compile_NoTopologyCache)
+        ->RangeMultiplier(10)
+        ->Range(100, 1000)
+        ->Unit(benchmark::kMicrosecond)
+        ->Complexity();
+} // namespace Benchmark
+
+#endif
@@ -13,6 +13,7 @@
 #include <Atom/RHI/BufferFrameAttachment.h>
 #include <Atom/RHI/ImageScopeAttachment.h>
 #include <Atom/RHI/BufferScopeAttachment.h>
+#include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/Math/Random.h>
 
 using namespace AZ;
@@ -143,8 +144,22 @@ namespace UnitTest
                 m_state->m_scopes[i] = AZStd::move(scope);
             }
 
+            for (uint32_t i = 0; i < AsyncScopeCount; ++i)
+            {
+                m_state->m_transientBufferIds[i] = RHI::AttachmentId(AZStd::string::format("TB%d", i));
+                m_state->m_transientImageIds[i] = RHI::AttachmentId(AZStd::string::format("TI%d", i));
+            }
+
             m_state->m_frameGraphCompiler = RHI::Factory::Get().CreateFrameGraphCompiler();
             m_state->m_frameGraphCompiler->Init(*device);
+
+            {
+                m_state->m_transientAttachmentPool = RHI::Factory::Get().CreateTransientAttachmentPool();
+
+                RHI::TransientAttachmentPoolDescriptor desc;
+                desc.m_bufferBudgetInBytes = 80 * 1024 * 1024;
+                m_state->m_transientAttachmentPool->Init(*device, desc);
+            }
         }
 
         void TearDown() override
@@ -436,6 +451,135 @@ namespace UnitTest
             }
         }
 
+        // Builds a graph where every fourth scope runs on the compute queue and each scope writes transient
+        // attachments that are read two scopes later, so that cross-queue edges and async lifetimes are exercised.
+        void BuildAsyncTransientGraph(RHI::FrameGraph& frameGraph)
+        {
+            RHI::BufferScopeAttachmentDescriptor bufferBindingDesc;
+            bufferBindingDesc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            RHI::ImageScopeAttachmentDescriptor imageBindingDesc;
+            imageBindingDesc.m_imageViewDescriptor = RHI::ImageViewDescriptor();
+
+            frameGraph.Begin();
+
+            for (uint32_t scopeIdx = 0; scopeIdx < AsyncScopeCount; ++scopeIdx)
+            {
+                const bool isGraphics = (scopeIdx % 4) != 3;
+
+                frameGraph.BeginScope(*m_state->m_scopes[scopeIdx]);
+                frameGraph.SetHardwareQueueClass(isGraphics ? RHI::HardwareQueueClass::Graphics : RHI::HardwareQueueClass::Compute);
+
+                RHI::FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+
+                attachmentDatabase.CreateTransientBuffer(RHI::TransientBufferDescriptor{
+                    m_state->m_transientBufferIds[scopeIdx], RHI::BufferDescriptor(RHI::BufferBindFlags::ShaderReadWrite, BufferSize) });
+                bufferBindingDesc.m_attachmentId = m_state->m_transientBufferIds[scopeIdx];
+                frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                // Images are only created on the graphics queue, which is the most capable one.
+                if (isGraphics)
+                {
+                    attachmentDatabase.CreateTransientImage(RHI::TransientImageDescriptor{
+                        m_state->m_transientImageIds[scopeIdx],
+                        RHI::ImageDescriptor::Create2D(RHI::ImageBindFlags::ShaderReadWrite, ImageSize, ImageSize, RHI::Format::R8G8B8A8_UNORM) });
+                    imageBindingDesc.m_attachmentId = m_state->m_transientImageIds[scopeIdx];
+                    frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+                }
+
+                if (scopeIdx >= 2)
+                {
+                    bufferBindingDesc.m_attachmentId = m_state->m_transientBufferIds[scopeIdx - 2];
+                    frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::Read);
+
+                    if ((scopeIdx - 2) % 4 != 3)
+                    {
+                        imageBindingDesc.m_attachmentId = m_state->m_transientImageIds[scopeIdx - 2];
+                        frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::Read);
+                    }
+                }
+
+                frameGraph.EndScope();
+            }
+
+            frameGraph.End();
+        }
+
+        // Flattens the queue-centric links and the transient attachment lifetimes of a compiled graph.
+        AZStd::vector<uint32_t> GetCompiledTopology(const RHI::FrameGraph& frameGraph)
+        {
+            AZStd::vector<uint32_t> topology;
+
+            const auto getScopeIndex = [](const RHI::Scope* scope)
+            {
+                return scope ? scope->GetIndex() + 1 : 0;
+            };
+
+            for (const RHI::Scope* scope : frameGraph.GetScopes())
+            {
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < RHI::HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    const RHI::HardwareQueueClass hardwareQueueClass = static_cast<RHI::HardwareQueueClass>(hardwareQueueClassIdx);
+                    topology.push_back(getScopeIndex(scope->GetProducerByQueue(hardwareQueueClass)));
+                    topology.push_back(getScopeIndex(scope->GetConsumerByQueue(hardwareQueueClass)));
+                }
+            }
+
+            const RHI::FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            for (const RHI::BufferFrameAttachment* attachment : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                topology.push_back(attachment->GetFirstScope()->GetIndex());
+                topology.push_back(attachment->GetLastScope()->GetIndex());
+                EXPECT_TRUE(attachment->GetBuffer() != nullptr);
+            }
+
+            for (const RHI::ImageFrameAttachment* attachment : attachmentDatabase.GetTransientImageAttachments())
+            {
+                topology.push_back(attachment->GetFirstScope()->GetIndex());
+                topology.push_back(attachment->GetLastScope()->GetIndex());
+                EXPECT_TRUE(attachment->GetImage() != nullptr);
+            }
+
+            return topology;
+        }
+
+        void TestTopologyCache()
+        {
+            RHI::FrameGraph frameGraph;
+
+            RHI::FrameGraphCompileRequest request;
+            request.m_frameGraph = &frameGraph;
+            request.m_transientAttachmentPool = m_state->m_transientAttachmentPool.get();
+
+            // Reference result, computed without the cache.
+            BuildAsyncTransientGraph(frameGraph);
+            request.m_compileFlags = RHI::FrameSchedulerCompileFlags::DisableTopologyCache;
+            ASSERT_TRUE(m_state->m_frameGraphCompiler->Compile(request).IsSuccess());
+            const AZStd::vector<uint32_t> expectedTopology = GetCompiledTopology(frameGraph);
+
+            // The first frame records the cache and the following ones replay it.
+            request.m_compileFlags = RHI::FrameSchedulerCompileFlags::None;
+            for (uint32_t frameIdx = 0; frameIdx < FrameIterationCount; ++frameIdx)
+            {
+                BuildAsyncTransientGraph(frameGraph);
+                ASSERT_TRUE(m_state->m_frameGraphCompiler->Compile(request).IsSuccess());
+                ASSERT_TRUE(GetCompiledTopology(frameGraph) == expectedTopology);
+            }
+
+            // A graph with a different topology must not reuse the cached result.
+            frameGraph.Begin();
+            for (uint32_t scopeIdx = 0; scopeIdx < 2; ++scopeIdx)
+            {
+                frameGraph.BeginScope(*m_state->m_scopes[scopeIdx]);
+                frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Compute);
+                frameGraph.EndScope();
+            }
+            frameGraph.End();
+            ASSERT_TRUE(m_state->m_frameGraphCompiler->Compile(request).IsSuccess());
+            ASSERT_TRUE(frameGraph.GetScopes()[0]->GetConsumerOnSameQueue() == frameGraph.GetScopes()[1]);
+            ASSERT_TRUE(frameGraph.GetScopes()[1]->GetProducerByQueue(RHI::HardwareQueueClass::Graphics) == nullptr);
+        }
+
     private:
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
@@ -443,6 +587,7 @@ namespace UnitTest
         static const uint32_t BufferSize = 64;
         static const uint32_t ImageSize = 16;
         static const uint32_t ScopeCount = 128;
+        static const uint32_t AsyncScopeCount = 32;
 
         AZStd::unique_ptr<Factory> m_rootFactory;
 
@@ -463,10 +608,13 @@ namespace UnitTest
             RHI::Ptr<RHI::BufferPool> m_bufferPool;
             RHI::Ptr<RHI::ImagePool> m_imagePool;
             RHI::Ptr<RHI::FrameGraphCompiler> m_frameGraphCompiler;
+            RHI::Ptr<RHI::TransientAttachmentPool> m_transientAttachmentPool;
 
             ImageAttachment m_imageAttachments[ImageCount];
             BufferAttachment m_bufferAttachments[BufferCount];
             RHI::Ptr<RHI::Scope> m_scopes[ScopeCount];
+            RHI::AttachmentId m_transientBufferIds[AsyncScopeCount];
+            RHI::AttachmentId m_transientImageIds[AsyncScopeCount];
 
         };
 
@@ -492,4 +640,9 @@ namespace UnitTest
     {
         TestScopeGraph();
     }
+
+    TEST_F(FrameGraphTests, TestTopologyCache)
+    {
+        TestTopologyCache();
+    }
 }
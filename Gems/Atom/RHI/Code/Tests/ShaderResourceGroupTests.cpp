@@ -636,6 +636,63 @@ namespace UnitTest
         TestShaderResourceGroupPools();
     }
 
+    TEST_F(ShaderResourceGroupTests, CompileGroups_UnchangedData_IsSkipped)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srgA = RHI::Factory::Get().CreateShaderResourceGroup();
+        RHI::Ptr<RHI::ShaderResourceGroup> srgB = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srgA);
+        srgPool->InitGroup(*srgB);
+
+        const RHI::ShaderInputConstantIndex floatValueIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        RHI::ShaderResourceGroupData srgData(*srgA);
+        srgData.SetConstant(floatValueIndex, 1.0f);
+
+        const auto CompileQueuedGroups = [&srgPool]()
+        {
+            srgPool->CompileGroupsBegin();
+            srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+            const RHI::ShaderResourceGroupPool::CompileStatistics statistics = srgPool->GetCompileStatistics();
+            srgPool->CompileGroupsEnd();
+            return statistics;
+        };
+
+        // The first compile of each group always reaches the platform.
+        srgA->Compile(srgData);
+        srgB->Compile(srgData);
+        EXPECT_TRUE(srgA->IsQueuedForCompile());
+        RHI::ShaderResourceGroupPool::CompileStatistics statistics = CompileQueuedGroups();
+        EXPECT_EQ(statistics.m_compiledGroupCount, 2u);
+        EXPECT_EQ(statistics.m_skippedGroupCount, 0u);
+        EXPECT_EQ(statistics.m_constantBytes, 2ull * srgLayout->GetConstantDataSize());
+        EXPECT_FALSE(srgA->IsQueuedForCompile());
+
+        // Identical data is dropped, changed data is compiled.
+        srgA->Compile(srgData);
+        EXPECT_FALSE(srgA->IsQueuedForCompile());
+        srgData.SetConstant(floatValueIndex, 2.0f);
+        srgB->Compile(srgData);
+        EXPECT_TRUE(srgB->IsQueuedForCompile());
+        statistics = CompileQueuedGroups();
+        EXPECT_EQ(statistics.m_compiledGroupCount, 1u);
+        EXPECT_EQ(statistics.m_skippedGroupCount, 1u);
+        EXPECT_EQ(srgB->GetData().GetConstant<float>(floatValueIndex), 2.0f);
+
+        // A group shut down while queued is removed from its compile queue.
+        srgData.SetConstant(floatValueIndex, 3.0f);
+        srgA->Compile(srgData);
+        srgA->Shutdown();
+        statistics = CompileQueuedGroups();
+        EXPECT_EQ(statistics.m_compiledGroupCount, 0u);
+    }
+
 
     TEST_F(ShaderResourceGroupTests, SRGDataSetConstant_Vectors_ValidOutput)
     {
@@ -11,6 +11,7 @@ set(FILES
     Tests/BufferTests.cpp
     Tests/DrawPacketTests.cpp
     Tests/FrameGraphTests.cpp
+    Tests/FrameGraphCompilerPerformanceTests.cpp
     Tests/FrameSchedulerTests.cpp
     Tests/HashingTests.cpp
     Tests/ImageTests.cpp
@@ -22,6 +23,7 @@ set(FILES
     Tests/RenderAttachmentLayoutBuilderTests.cpp
     Tests/ShaderResourceGroupTests.cpp
     Tests/UtilsTests.cpp
+    Tests/CpuProfilerTests.cpp
     Tests/Buffer.h
     Tests/Buffer.cpp
     Tests/Device.h
@@ -9,6 +9,7 @@
 
 #include <AzCore/JSON/document.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Utils/Utils.h>
 #include <AtomCore/Serialization/Json/JsonUtils.h>
 #include <Atom/RPI.Edit/Common/JsonFileLoadContext.h>
 #include <Atom/RPI.Edit/Common/JsonReportingHelper.h>
@@ -38,15 +39,14 @@ namespace AZ
             {
                 objectData = ObjectType();
 
-                auto loadOutcome = AZ::JsonSerializationUtils::ReadJsonFile(path);
-                if (!loadOutcome.IsSuccess())
+                // Load straight from the text so large files don't need a json document for the whole file.
+                auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(path);
+                if (!readOutcome.IsSuccess())
                 {
-                    AZ_Error("AZ::RPI::JsonUtils", false, "%s", loadOutcome.GetError().c_str());
+                    AZ_Error("AZ::RPI::JsonUtils", false, "%s", readOutcome.GetError().c_str());
                     return false;
                 }
 
-                rapidjson::Document& document = loadOutcome.GetValue();
-
                 AZ::RPI::JsonFileLoadContext fileLoadContext;
                 fileLoadContext.PushFilePath(path);
 
@@ -55,7 +55,7 @@ namespace AZ
                 reportingHelper.Attach(jsonSettings);
                 jsonSettings.m_metadata.Add(AZStd::move(fileLoadContext));
 
-                AZ::JsonSerialization::Load(objectData, document, jsonSettings);
+                AZ::JsonSerialization::LoadFromString(objectData, readOutcome.GetValue(), jsonSettings);
                 if (reportingHelper.ErrorsReported())
                 {
                     AZ_Error("AZ::RPI::JsonUtils", false, "Failed to load object from JSON file: %s", path.c_str());
@@ -18,8 +18,10 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Obb.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/vector.h>
 
@@ -124,6 +126,7 @@ namespace AZ
             // UI Options
             bool m_enableStats = false;
             bool m_enableFrustumCulling = true;
+            bool m_enableSoftwareOcclusionCulling = true;
             bool m_parallelOctreeTraversal = true;
             bool m_freezeFrustums = false;
             bool m_debugDraw = false;
@@ -156,6 +159,8 @@ namespace AZ
                     m_numJobs = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_numOccluderTriangles = 0;
+                    m_numOcclusionCulledCullables = 0;
                 }
 
                 AZ::Name m_name;
@@ -163,6 +168,8 @@ namespace AZ
                 AZStd::atomic_uint32_t m_numJobs = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                AZStd::atomic_uint32_t m_numOccluderTriangles = 0;
+                AZStd::atomic_uint32_t m_numOcclusionCulledCullables = 0;
             };
 
             CullingDebugContext() = default;
@@ -226,6 +233,42 @@ namespace AZ
             //! Sets a list of occlusion planes to be used during the culling process.
             void SetOcclusionPlanes(const OcclusionPlaneVector& occlusionPlanes) { m_occlusionPlanes = occlusionPlanes; }
 
+            //! Triangle soup used as an occluder. It has to lie inside the surface it occludes for, so it's either the full
+            //! detail render mesh or a hull built inside of it, never a coarser lod that can extend past the surface.
+            struct OccluderGeometry
+            {
+                AZStd::vector<Vector3> m_positions;
+                AZStd::vector<uint32_t> m_indices;
+
+                // The adjacent triangle of each edge, see SoftwareOcclusionBuffer::BuildTriangleNeighbors
+                AZStd::vector<uint32_t> m_triangleNeighbors;
+            };
+
+            struct OccluderMesh
+            {
+                static constexpr size_t NotRegistered = AZStd::numeric_limits<size_t>::max();
+
+                // Geometry can be shared between instances of the same occluder
+                AZStd::shared_ptr<const OccluderGeometry> m_geometry;
+                Matrix3x4 m_localToWorld = Matrix3x4::CreateIdentity();
+
+                // World space bounds, used to skip occluders outside of the view frustum
+                Aabb m_aabb;
+
+                // Position in the CullingScene's list of occluders, only changed by the CullingScene
+                size_t m_registeredIndex = NotRegistered;
+            };
+
+            //! Adds an occluder mesh, which is rasterized into a software occlusion buffer for each camera view. Unlike
+            //! occlusion planes this works on every platform. The CullingScene keeps a pointer to the occluder mesh and
+            //! reads its transform and bounds every frame, so moving an occluder only means updating its own fields.
+            //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
+            void RegisterOccluderMesh(OccluderMesh& occluderMesh);
+
+            //! Removes an occluder mesh, must be called before the occluder mesh is destroyed.
+            //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
+            void UnregisterOccluderMesh(OccluderMesh& occluderMesh);
+
             //! Notifies the CullingScene that culling will begin for this frame.
             void BeginCulling(const AZStd::vector<ViewPtr>& views);
 
@@ -267,6 +310,7 @@ namespace AZ
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+            AZStd::vector<OccluderMesh*> m_occluderMeshes;
         };
         
 
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A small, platform independent CPU depth buffer used to reject objects hidden behind occluder meshes.
+        //!
+        //! Occluder triangles are rasterized in clip space and depth is stored as 1/w, so larger values are nearer and
+        //! a cleared buffer (0) is infinitely far away. Every pixel is written with the farthest depth the triangle reaches
+        //! inside it, and only if the occluder covers all of it: across the silhouette edges of an occluder a pixel has
+        //! to lie entirely inside the triangle. Edges shared with an adjacent triangle that faces the same way are sampled
+        //! at pixel centers, so the inside of an occluder mesh has no cracks. Boxes are tested against every pixel they
+        //! touch, so an object that shows by less than a pixel is never culled.
+        //!
+        //! The buffer is split into bands of BlockSize rows which are rasterized in parallel, four pixels at a time.
+        class SoftwareOcclusionBuffer
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SoftwareOcclusionBuffer, AZ::SystemAllocator, 0);
+
+            static constexpr uint32_t DefaultWidth = 256;
+            static constexpr uint32_t DefaultHeight = 128;
+
+            //! Size of the square blocks used for the coarse depth test. Also the height of a raster band.
+            static constexpr uint32_t BlockSize = 8;
+
+            //! Marks a triangle edge that isn't shared with another triangle of the mesh.
+            static constexpr uint32_t NoNeighbor = AZStd::numeric_limits<uint32_t>::max();
+
+            //! Finds the triangle adjacent to each edge of a mesh, three entries per triangle where entry i is the edge from
+            //! vertex i to vertex i + 1. Vertices are matched by position, so meshes with split normals or uvs still connect.
+            //! Only edges shared by exactly two triangles that wind them in opposite directions are connected.
+            static void BuildTriangleNeighbors(
+                const Vector3* positions, size_t vertexCount, const uint32_t* indices, size_t indexCount, AZStd::vector<uint32_t>& triangleNeighbors);
+
+            //! Width and height are rounded up to a multiple of BlockSize.
+            explicit SoftwareOcclusionBuffer(uint32_t width = DefaultWidth, uint32_t height = DefaultHeight);
+
+            uint32_t GetWidth() const;
+            uint32_t GetHeight() const;
+
+            //! Resets the buffer to infinitely far away. Must be called before rendering a new set of occluders.
+            void Clear();
+
+            //! Queues the triangles of an occluder mesh for rasterization. Positions are transformed by localToClip;
+            //! triangles are treated as double sided and any triangle crossing the near plane is dropped.
+            //! triangleNeighbors comes from BuildTriangleNeighbors. Without it every edge is treated as a silhouette edge,
+            //! which is still conservative but leaves cracks along the edges inside the mesh.
+            void AddOccluderMesh(
+                const Matrix4x4& localToClip, const Vector3* positions, size_t vertexCount, const uint32_t* indices, size_t indexCount,
+                const uint32_t* triangleNeighbors = nullptr);
+
+            //! Rasterizes every occluder triangle added since the last Clear(). When parallel is true the raster
+            //! bands are distributed over the job system.
+            void Rasterize(bool parallel);
+
+            //! Returns whether any part of a world-space box may be visible. Must be called after Rasterize().
+            bool IsVisible(const Matrix4x4& worldToClip, const Aabb& aabb) const;
+
+            //! Returns whether any part of a rectangle in normalized device coordinates, at a clip-space w of nearestW
+            //! or farther, may be visible. Must be called after Rasterize().
+            bool IsRectVisible(float ndcMinX, float ndcMinY, float ndcMaxX, float ndcMaxY, float nearestW) const;
+
+            //! Returns the number of triangles that were set up for rasterization since the last Clear().
+            uint32_t GetTriangleCount() const;
+
+            //! Returns the stored depth (1/w) of a pixel, 0 if nothing was rendered there.
+            float GetDepth(uint32_t x, uint32_t y) const;
+
+        private:
+            // A triangle in pixel space, set up with its edge equations and conservative depth plane.
+            struct Triangle
+            {
+                // Edge functions E(x, y) = A * x + B * y + C, positive inside the triangle.
+                float m_edgeA[3];
+                float m_edgeB[3];
+                float m_edgeC[3];
+
+                // Depth plane z(x, y) = A * x + B * y + C, biased toward the farthest value inside a pixel.
+                float m_depthA;
+                float m_depthB;
+                float m_depthC;
+                float m_depthMin;
+
+                // Inclusive pixel bounds.
+                int32_t m_minX;
+                int32_t m_minY;
+                int32_t m_maxX;
+                int32_t m_maxY;
+            };
+
+            // Sets up a triangle from pixel space positions with 1/w in z. Bit i of silhouetteEdges is set when edge i
+            // needs to cover whole pixels.
+            void SetupTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2, uint32_t silhouetteEdges);
+            void RasterizeBand(uint32_t bandIndex);
+            void RasterizeTriangle(const Triangle& triangle, int32_t minY, int32_t maxY);
+
+            uint32_t m_width = 0;
+            uint32_t m_height = 0;
+            uint32_t m_blocksX = 0;
+            uint32_t m_blocksY = 0;
+
+            //! Per pixel depth as 1/w.
+            AZStd::vector<float> m_depth;
+
+            //! Per block farthest depth, so that fully covered blocks can be tested with a single compare.
+            AZStd::vector<float> m_blockMinDepth;
+
+            AZStd::vector<Triangle> m_triangles;
+
+            //! Scratch storage for the pixel space vertices (with 1/w in z, 0 if behind the near plane) and the screen
+            //! space winding of the triangles (1, -1 or 0 if dropped) of the occluder being added.
+            AZStd::vector<Vector3> m_pixelPositions;
+            AZStd::vector<int8_t> m_triangleWindings;
+
+            //! Indices into m_triangles for each raster band.
+            AZStd::vector<AZStd::vector<uint32_t>> m_bandTriangles;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -17,6 +17,7 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Name/Name.h>
 
 class MaskedOcclusionCulling;
@@ -31,6 +32,8 @@ namespace AZ
 
     namespace RPI
     {
+        class SoftwareOcclusionBuffer;
+
         //! Represents a view into a scene, and is the primary interface for adding DrawPackets to the draw queues.
         //! It encapsulates the world<->view<->clip transforms and the per-view shader constants.
         //! Use View::CreateView() to make new vew Objects to ensure that you have a shared ViewPtr to pass around the code.
@@ -132,6 +135,9 @@ namespace AZ
             //! Returns the masked occlusion culling interface
             MaskedOcclusionCulling* GetMaskedOcclusionCulling();
 
+            //! Returns the platform independent software occlusion buffer, creating it on first use.
+            SoftwareOcclusionBuffer* GetSoftwareOcclusionBuffer();
+
         private:
             View() = delete;
             View(const AZ::Name& name, UsageFlags usage);
@@ -199,6 +205,9 @@ namespace AZ
 
             // Masked Occlusion Culling interface
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
+
+            // Software occlusion buffer for occluder meshes, only allocated for views that use it
+            AZStd::unique_ptr<SoftwareOcclusionBuffer> m_softwareOcclusionBuffer;
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(View::UsageFlags);
@@ -143,9 +143,15 @@ namespace AZ
             //! Returns the model-space axis-aligned bounding box of all meshes in the lod
             const AZ::Aabb& GetAabb() const;
 
+            //! Returns the largest screen coverage this lod was built for, or 0 if it wasn't specified.
+            //! Generated lods compute this from their simplification error so the runtime can pick them
+            //! before the error becomes visible.
+            float GetScreenCoverageMax() const;
+
         private:
             AZStd::vector<Mesh> m_meshes;
             AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+            float m_screenCoverageMax = 0.0f;
 
             // These buffers owned by the lod are the consolidated super buffers. 
             // Meshes may either have views into these buffers or they may own 
@@ -34,6 +34,10 @@ namespace AZ
             //! @param bufferAsset The buffer asset to add as an lod-wide stream buffer
             void AddLodStreamBuffer(const Data::Asset<BufferAsset>& bufferAsset);
 
+            //! Sets the largest screen coverage (as computed by ModelLodUtils::ApproxScreenPercentage) this lod should be used at.
+            //! Leave unset to let the runtime pick a default lod distribution.
+            void SetScreenCoverageMax(float screenCoverageMax);
+
             //! Begins the addition of a Mesh to the ModelLodAsset. Begin must be called first.
             void BeginMesh();
 
@@ -31,11 +31,13 @@
 #include <SceneAPI/SceneCore/Containers/Views/SceneGraphUpwardsIterator.h>
 #include <SceneAPI/SceneCore/DataTypes/GraphData/IBoneData.h>
 #include <SceneAPI/SceneCore/DataTypes/GraphData/IBlendShapeData.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/IAutoLodRule.h>
 #include <SceneAPI/SceneCore/DataTypes/Rules/ICoordinateSystemRule.h>
 #include <SceneAPI/SceneCore/DataTypes/Rules/ILodRule.h>
 #include <SceneAPI/SceneCore/DataTypes/Rules/ISkinRule.h>
 #include <SceneAPI/SceneCore/DataTypes/Rules/IClothRule.h>
 #include <SceneAPI/SceneCore/Events/ExportEventContext.h>
+#include <SceneAPI/SceneCore/Utilities/MeshSimplifier.h>
 #include <SceneAPI/SceneCore/Utilities/SceneGraphSelector.h>
 #include <SceneAPI/SceneCore/Utilities/Reporting.h>
 #include <SceneAPI/SceneData/Groups/MeshGroup.h>
@@ -93,6 +95,9 @@ namespace
     const char* const ShaderSemanticName_ClothData = "CLOTH_DATA";
     const uint32_t ClothDataFloatsPerVert = 4;
     const AZ::RHI::Format ClothDataFormat = AZ::RHI::Format::R32G32B32A32_FLOAT;
+
+    // Generated lods compute their screen coverage from the simplification error projected onto a screen of this height.
+    const float LodReferenceScreenHeight = 1080.0f;
 }
 
 namespace AZ
@@ -108,7 +113,7 @@ namespace AZ
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
             {
                 serialize->Class<ModelAssetBuilderComponent, SceneAPI::SceneCore::ExportingComponent>()
-                    ->Version(27);  // [ATOM-15658]
+                    ->Version(28);  // Generated lods
             }
         }
 
@@ -353,10 +358,39 @@ namespace AZ
                 }
             }
 
+            // Lods are only generated for mesh groups that don't have any authored lods.
+            size_t generatedLodCount = 0;
+            AZStd::shared_ptr<const SceneAPI::DataTypes::IAutoLodRule> autoLodRule =
+                context.m_group.GetRuleContainerConst().FindFirstByType<SceneAPI::DataTypes::IAutoLodRule>();
+            if (autoLodRule && sourceMeshContentListsByLod.size() == 1)
+            {
+                generatedLodCount = AZStd::min(autoLodRule->GetLodCount(), ModelLodAsset::LodCountMax - 1);
+                for (const SourceMeshContent& sourceMesh : sourceMeshContentListsByLod[0])
+                {
+                    if (sourceMesh.m_isMorphed)
+                    {
+                        // Morph target deltas reference vertices by index, which simplification doesn't preserve.
+                        AZ_Warning(s_builderName, false, "Mesh '%s' has morph targets. Lods won't be generated for this mesh group.", sourceMesh.m_name.GetCStr());
+                        generatedLodCount = 0;
+                        break;
+                    }
+                }
+            }
+            else if (autoLodRule)
+            {
+                AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Mesh group has authored lods, skipping lod generation.");
+            }
+
             // Then in each Lod we need to group all faces by material id.
             // All sub meshes with the same material id get merged
+            const size_t lodCount = sourceMeshContentListsByLod.size() + generatedLodCount;
             AZStd::vector<Data::Asset<ModelLodAsset>> lodAssets;
-            lodAssets.resize(sourceMeshContentListsByLod.size());
+            lodAssets.resize(lodCount);
+
+            // The base lod meshes, kept around as the input for the generated lods.
+            ProductMeshContentList baseLodMeshes;
+            float lodSelectionRadius = 0.0f;
+            float previousScreenCoverageMax = 1.0f;
 
             // Joint name to joint index map used for the skinning influences.
             AZStd::unordered_map<AZStd::string, uint16_t> jointNameToIndexMap;
@@ -367,18 +401,71 @@ namespace AZ
             MorphTargetMetaAssetCreator morphTargetMetaCreator;
             morphTargetMetaCreator.Begin(MorphTargetMetaAsset::ConstructAssetId(modelAssetId, modelAssetName));
 
-            uint32_t lodIndex = 0;
-            for (const SourceMeshContentList& sourceMeshContentList : sourceMeshContentListsByLod)
+            for (uint32_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
             {
+                // Generated lods share the source content of the base lod.
+                const bool isGeneratedLod = lodIndex >= sourceMeshContentListsByLod.size();
+                const SourceMeshContentList& sourceMeshContentList = sourceMeshContentListsByLod[isGeneratedLod ? 0 : lodIndex];
+
                 ModelLodAssetCreator lodAssetCreator;
                 m_lodName = AZStd::string::format("lod%d", lodIndex);
                 AZStd::string lodAssetName = GetAssetFullName(ModelLodAsset::TYPEINFO_Uuid());
                 lodAssetCreator.Begin(CreateAssetId(lodAssetName));
 
                 {
-                    ProductMeshContentList lodMeshes = SourceMeshListToProductMeshList(context, sourceMeshContentList, jointNameToIndexMap, morphTargetMetaCreator);
+                    ProductMeshContentList lodMeshes;
+                    if (isGeneratedLod)
+                    {
+                        const size_t generatedLodIndex = lodIndex - sourceMeshContentListsByLod.size();
+
+                        SceneAPI::Utilities::MeshSimplifier::Settings simplifierSettings;
+                        simplifierSettings.m_targetTriangleRatio = autoLodRule->GetTriangleRatio(generatedLodIndex);
+                        simplifierSettings.m_preserveSeams = autoLodRule->PreserveSeams();
+                        simplifierSettings.m_lockBorders = autoLodRule->LockBorders();
+
+                        float simplificationError = 0.0f;
+                        lodMeshes = SimplifyProductMeshList(baseLodMeshes, simplifierSettings, simplificationError);
+
+                        // Pick this lod once its error projects to less than the pixel threshold. Following the
+                        // derivation in ModelLodUtils::ApproxScreenPercentage, a length L covers L * coverage / (2 * radius)
+                        // of the screen height, so the error stays below the threshold while
+                        // coverage <= 2 * radius * threshold / (error * screenHeight).
+                        float screenCoverageMax = previousScreenCoverageMax;
+                        if (simplificationError > 0.0f)
+                        {
+                            screenCoverageMax = (2.0f * lodSelectionRadius * autoLodRule->GetPixelErrorThreshold()) / (simplificationError * LodReferenceScreenHeight);
+                        }
+                        // Coarser lods can never be selected at a larger coverage than the lods before them.
+                        screenCoverageMax = AZStd::clamp(screenCoverageMax, 1.0f / LodReferenceScreenHeight, previousScreenCoverageMax);
+                        lodAssetCreator.SetScreenCoverageMax(screenCoverageMax);
+                        previousScreenCoverageMax = screenCoverageMax;
+
+                        AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Generated lod %u: %.0f%% of the triangles, error %f, screen coverage %f",
+                            lodIndex, simplifierSettings.m_targetTriangleRatio * 100.0f, simplificationError, screenCoverageMax);
+                    }
+                    else
+                    {
+                        lodMeshes = SourceMeshListToProductMeshList(context, sourceMeshContentList, jointNameToIndexMap, morphTargetMetaCreator);
+
+                        PadVerticesForSkinning(lodMeshes);
+
+                        if (generatedLodCount > 0)
+                        {
+                            baseLodMeshes = lodMeshes;
 
-                    PadVerticesForSkinning(lodMeshes);
+                            // Matches the lod selection radius used at runtime, see MeshFeatureProcessor.
+                            AZ::Aabb aabb = AZ::Aabb::CreateNull();
+                            for (const ProductMeshContent& mesh : baseLodMeshes)
+                            {
+                                for (size_t i = 0; i + 2 < mesh.m_positions.size(); i += PositionFloatsPerVert)
+                                {
+                                    aabb.AddPoint(AZ::Vector3(mesh.m_positions[i], mesh.m_positions[i + 1], mesh.m_positions[i + 2]));
+                                }
+                            }
+                            lodSelectionRadius = aabb.IsValid() ? 0.5f * aabb.GetExtents().GetMaxElement() : 0.0f;
+                            lodAssetCreator.SetScreenCoverageMax(1.0f);
+                        }
+                    }
 
                     // By default, we merge meshes that share the same material
                     bool canMergeMeshes = true;
@@ -463,10 +550,9 @@ namespace AZ
                     return AZ::SceneAPI::Events::ProcessingResult::Failure;
                 }
                 lodAssets[lodIndex].SetHint(lodAssetName); // name will be used for file name when export asset
-
-                lodIndex++;
             }
             sourceMeshContentListsByLod.clear();
+            baseLodMeshes.clear();
 
             // Build the final asset structure
             ModelAssetCreator modelAssetCreator;
@@ -941,6 +1027,79 @@ namespace AZ
             }
         }
 
+        ModelAssetBuilderComponent::ProductMeshContentList ModelAssetBuilderComponent::SimplifyProductMeshList(
+            const ProductMeshContentList& productMeshList,
+            const SceneAPI::Utilities::MeshSimplifier::Settings& settings,
+            float& outError)
+        {
+            outError = 0.0f;
+
+            ProductMeshContentList simplifiedMeshList;
+            simplifiedMeshList.reserve(productMeshList.size());
+
+            for (const ProductMeshContent& mesh : productMeshList)
+            {
+                const size_t vertexCount = mesh.m_positions.size() / PositionFloatsPerVert;
+
+                SceneAPI::Utilities::MeshSimplifier::Result result = SceneAPI::Utilities::MeshSimplifier::Simplify(
+                    mesh.m_positions.data(), vertexCount, mesh.m_indices.data(), mesh.m_indices.size(), settings);
+                outError = AZStd::max(outError, result.m_error);
+
+                ProductMeshContent simplifiedMesh;
+                simplifiedMesh.m_name = mesh.m_name;
+                simplifiedMesh.m_materialUid = mesh.m_materialUid;
+                simplifiedMesh.m_uvCustomNames = mesh.m_uvCustomNames;
+                simplifiedMesh.m_colorCustomNames = mesh.m_colorCustomNames;
+                simplifiedMesh.m_hasMorphedColors = mesh.m_hasMorphedColors;
+                simplifiedMesh.m_indices = AZStd::move(result.m_indices);
+
+                // Half-edge collapses never create vertices, so every stream (including the skinning influences)
+                // can be gathered from the surviving source vertices without any interpolation.
+                const AZStd::vector<AZ::u32> newToOld = SceneAPI::Utilities::MeshSimplifier::CompactVertices(simplifiedMesh.m_indices, vertexCount);
+                auto gatherStream = [&newToOld, vertexCount](const auto& source, auto& destination)
+                {
+                    if (source.empty() || vertexCount == 0)
+                    {
+                        return;
+                    }
+                    const size_t elementsPerVertex = source.size() / vertexCount;
+                    destination.reserve(newToOld.size() * elementsPerVertex);
+                    for (AZ::u32 oldIndex : newToOld)
+                    {
+                        const size_t offset = oldIndex * elementsPerVertex;
+                        destination.insert(destination.end(), source.begin() + offset, source.begin() + offset + elementsPerVertex);
+                    }
+                };
+
+                gatherStream(mesh.m_positions, simplifiedMesh.m_positions);
+                gatherStream(mesh.m_normals, simplifiedMesh.m_normals);
+                gatherStream(mesh.m_tangents, simplifiedMesh.m_tangents);
+                gatherStream(mesh.m_bitangents, simplifiedMesh.m_bitangents);
+                gatherStream(mesh.m_skinJointIndices, simplifiedMesh.m_skinJointIndices);
+                gatherStream(mesh.m_skinWeights, simplifiedMesh.m_skinWeights);
+
+                // Cloth data has to be kept as well, otherwise the generated lods of a cloth mesh become mergeable
+                // and end up with a different vertex layout than the base lod.
+                gatherStream(mesh.m_clothData, simplifiedMesh.m_clothData);
+
+                simplifiedMesh.m_uvSets.resize(mesh.m_uvSets.size());
+                for (size_t i = 0; i < mesh.m_uvSets.size(); ++i)
+                {
+                    gatherStream(mesh.m_uvSets[i], simplifiedMesh.m_uvSets[i]);
+                }
+
+                simplifiedMesh.m_colorSets.resize(mesh.m_colorSets.size());
+                for (size_t i = 0; i < mesh.m_colorSets.size(); ++i)
+                {
+                    gatherStream(mesh.m_colorSets[i], simplifiedMesh.m_colorSets[i]);
+                }
+
+                simplifiedMeshList.emplace_back(AZStd::move(simplifiedMesh));
+            }
+
+            return simplifiedMeshList;
+        }
+
         void ModelAssetBuilderComponent::GatherVertexSkinningInfluences(
             const SourceMeshContent& sourceMesh,
             ProductMeshContent& productMesh,
@@ -22,6 +22,7 @@
 #include <SceneAPI/SceneCore/DataTypes/GraphData/ISkinWeightData.h>
 #include <SceneAPI/SceneCore/DataTypes/Rules/ISkinRule.h>
 #include <SceneAPI/SceneCore/Containers/SceneGraph.h>
+#include <SceneAPI/SceneCore/Utilities/MeshSimplifier.h>
 
 #include <Model/ModelExporterContexts.h>
 
@@ -199,6 +200,15 @@ namespace AZ
             //! Each vertex stream that is modified by skinning is the same length
             void PadVerticesForSkinning(ProductMeshContentList& productMeshList);
 
+            //! Produces a simplified copy of the given product meshes for a generated lod.
+            //! Each mesh is simplified on its own so material boundaries are kept, and vertices that are no
+            //! longer referenced are removed from every stream, including the cloth data. Morph target data isn't carried over.
+            //! outError receives the largest geometric error introduced in any of the meshes.
+            ProductMeshContentList SimplifyProductMeshList(
+                const ProductMeshContentList& productMeshList,
+                const SceneAPI::Utilities::MeshSimplifier::Settings& settings,
+                float& outError);
+
             //! Takes in a ProductMeshContentList and merges all elements that share the same MaterialUid.
             ProductMeshContentList MergeMeshesByMaterialUid(
                 const ProductMeshContentList& productMeshList);
@@ -17,6 +17,7 @@
 #include <AtomCore/Serialization/Json/JsonUtils.h>
 
 #include <AzCore/std/string/string.h>
+#include <AzCore/Utils/Utils.h>
 
 namespace AZ
 {
@@ -60,19 +61,6 @@ namespace AZ
 
             AZ::Outcome<MaterialTypeSourceData> LoadMaterialTypeSourceData(const AZStd::string& filePath, const rapidjson::Value* document)
             {
-                AZ::Outcome<rapidjson::Document, AZStd::string> loadOutcome;
-                if (document == nullptr)
-                {
-                    loadOutcome = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
-                    if (!loadOutcome.IsSuccess())
-                    {
-                        AZ_Error("AZ::RPI::JsonUtils", false, "%s", loadOutcome.GetError().c_str());
-                        return AZ::Failure();
-                    }
-
-                    document = &loadOutcome.GetValue();
-                }
-
                 MaterialTypeSourceData materialType;
 
                 JsonDeserializerSettings settings;
@@ -85,7 +73,22 @@ namespace AZ
                 fileLoadContext.PushFilePath(filePath);
                 settings.m_metadata.Add(fileLoadContext);
 
-                JsonSerialization::Load(materialType, *document, settings);
+                if (document == nullptr)
+                {
+                    // Load straight from the text so the material type doesn't need a json document for the whole file.
+                    auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(filePath);
+                    if (!readOutcome.IsSuccess())
+                    {
+                        AZ_Error("AZ::RPI::JsonUtils", false, "%s", readOutcome.GetError().c_str());
+                        return AZ::Failure();
+                    }
+
+                    JsonSerialization::LoadFromString(materialType, readOutcome.GetValue(), settings);
+                }
+                else
+                {
+                    JsonSerialization::Load(materialType, *document, settings);
+                }
                 materialType.ResolveUvEnums();
 
                 if (reportingHelper.ErrorsReported())
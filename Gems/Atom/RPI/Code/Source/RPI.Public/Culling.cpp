@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
 #include <Atom/RPI.Public/View.h>
 
 #include <Atom/RHI/CpuProfiler.h>
@@ -43,6 +44,7 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(bool, r_softwareOcclusionCulling, true, nullptr, ConsoleFunctorFlags::Null, "Cull camera views against the occluder meshes set on the CullingScene");
 
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
@@ -261,6 +263,38 @@ namespace AZ
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        void CullingScene::RegisterOccluderMesh(OccluderMesh& occluderMesh)
+        {
+            if (occluderMesh.m_registeredIndex != OccluderMesh::NotRegistered)
+            {
+                return;
+            }
+
+            m_cullDataConcurrencyCheck.soft_lock();
+            occluderMesh.m_registeredIndex = m_occluderMeshes.size();
+            m_occluderMeshes.push_back(&occluderMesh);
+            m_cullDataConcurrencyCheck.soft_unlock();
+        }
+
+        void CullingScene::UnregisterOccluderMesh(OccluderMesh& occluderMesh)
+        {
+            if (occluderMesh.m_registeredIndex == OccluderMesh::NotRegistered)
+            {
+                return;
+            }
+
+            m_cullDataConcurrencyCheck.soft_lock();
+            AZ_Assert(m_occluderMeshes[occluderMesh.m_registeredIndex] == &occluderMesh, "Occluder mesh is registered with another CullingScene");
+
+            // Swap with the last occluder so the others keep their place
+            OccluderMesh* lastOccluderMesh = m_occluderMeshes.back();
+            m_occluderMeshes[occluderMesh.m_registeredIndex] = lastOccluderMesh;
+            lastOccluderMesh->m_registeredIndex = occluderMesh.m_registeredIndex;
+            m_occluderMeshes.pop_back();
+            occluderMesh.m_registeredIndex = OccluderMesh::NotRegistered;
+            m_cullDataConcurrencyCheck.soft_unlock();
+        }
+
         uint32_t CullingScene::GetNumCullables() const
         {
             return m_visScene->GetEntryCount();
@@ -278,6 +312,7 @@ namespace AZ
                 const Scene* m_scene = nullptr;
                 View* m_view = nullptr;
                 Frustum m_frustum;
+                const SoftwareOcclusionBuffer* m_softwareOcclusionBuffer = nullptr;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                 MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
@@ -304,6 +339,7 @@ namespace AZ
                 const RHI::DrawListMask drawListMask = m_jobData->m_view->GetDrawListMask();
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
+                uint32_t numOcclusionCulledCullables = 0;
 
                 for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
                 {
@@ -333,6 +369,12 @@ namespace AZ
                                         continue;
                                     }
 
+                                    if (IsHiddenBySoftwareOcclusion(visibleEntry))
+                                    {
+                                        ++numOcclusionCulledCullables;
+                                        continue;
+                                    }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                     if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -368,6 +410,12 @@ namespace AZ
                                 }
                                 else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
                                 {
+                                    if (IsHiddenBySoftwareOcclusion(visibleEntry))
+                                    {
+                                        ++numOcclusionCulledCullables;
+                                        continue;
+                                    }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                     if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -440,10 +488,17 @@ namespace AZ
                     //no need for mutex here since these are all atomics
                     cullStats.m_numVisibleDrawPackets += numDrawPackets;
                     cullStats.m_numVisibleCullables += numVisibleCullables;
+                    cullStats.m_numOcclusionCulledCullables += numOcclusionCulledCullables;
                     ++cullStats.m_numJobs;
                 }
             }
 
+            bool IsHiddenBySoftwareOcclusion(AzFramework::VisibilityEntry* visibleEntry) const
+            {
+                return m_jobData->m_softwareOcclusionBuffer &&
+                    !m_jobData->m_softwareOcclusionBuffer->IsVisible(m_jobData->m_view->GetWorldToClipMatrix(), visibleEntry->m_boundingVolume);
+            }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling::CullingResult TestOcclusionCulling(AzFramework::VisibilityEntry* visibleEntry)
             {
@@ -582,6 +637,36 @@ namespace AZ
             }
 #endif
 
+            // rasterize the occluder meshes into the view's software occlusion buffer, camera views only
+            SoftwareOcclusionBuffer* softwareOcclusionBuffer = nullptr;
+            if (r_softwareOcclusionCulling && m_debugCtx.m_enableSoftwareOcclusionCulling && !m_occluderMeshes.empty() &&
+                (view.GetUsageFlags() & View::UsageFlags::UsageCamera) != 0)
+            {
+                AZ_PROFILE_SCOPE(Debug::ProfileCategory::AzRender, "rasterize occluder meshes");
+
+                softwareOcclusionBuffer = view.GetSoftwareOcclusionBuffer();
+                softwareOcclusionBuffer->Clear();
+                for (const OccluderMesh* occluderMesh : m_occluderMeshes)
+                {
+                    const OccluderGeometry* geometry = occluderMesh->m_geometry.get();
+                    if (geometry && ShapeIntersection::Overlaps(frustum, occluderMesh->m_aabb))
+                    {
+                        const Matrix4x4 localToClip = worldToClip * Matrix4x4::CreateFromMatrix3x4(occluderMesh->m_localToWorld);
+                        softwareOcclusionBuffer->AddOccluderMesh(
+                            localToClip,
+                            geometry->m_positions.data(), geometry->m_positions.size(),
+                            geometry->m_indices.data(), geometry->m_indices.size(),
+                            geometry->m_triangleNeighbors.size() * 3 == geometry->m_indices.size() ? geometry->m_triangleNeighbors.data() : nullptr);
+                    }
+                }
+                softwareOcclusionBuffer->Rasterize(r_CullInParallel);
+
+                if (m_debugCtx.m_enableStats)
+                {
+                    m_debugCtx.GetCullStatsForView(&view).m_numOccluderTriangles = softwareOcclusionBuffer->GetTriangleCount();
+                }
+            }
+
             WorkListType worklist;
 
             AZStd::shared_ptr<AddObjectsToViewJob::JobData> jobData = AZStd::make_shared<AddObjectsToViewJob::JobData>();
@@ -589,6 +674,7 @@ namespace AZ
             jobData->m_scene = &scene;
             jobData->m_view = &view;
             jobData->m_frustum = frustum;
+            jobData->m_softwareOcclusionBuffer = softwareOcclusionBuffer;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             jobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
 #endif
@@ -629,6 +715,7 @@ namespace AZ
                 remainingJobData->m_scene = &scene;
                 remainingJobData->m_view = &view;
                 remainingJobData->m_frustum = frustum;
+                remainingJobData->m_softwareOcclusionBuffer = softwareOcclusionBuffer;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                 remainingJobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
 #endif
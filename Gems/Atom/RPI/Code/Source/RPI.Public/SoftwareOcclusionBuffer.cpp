@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            // Vertices closer than this (in clip-space w) are considered to be crossing the near plane.
+            const float NearPlaneEpsilon = 1.0e-4f;
+
+            // Triangles with a smaller pixel area are degenerate.
+            const float MinimumTriangleArea = 1.0e-6f;
+
+            // Relative depth tolerance, so that objects lying on an occluder's surface are not culled by rounding error.
+            const float DepthTolerance = 1.0e-4f;
+
+            struct PositionHash
+            {
+                size_t operator()(const Vector3& position) const
+                {
+                    size_t seed = 0;
+                    AZStd::hash_combine(seed, position.GetX(), position.GetY(), position.GetZ());
+                    return seed;
+                }
+            };
+
+            uint32_t RoundUpToBlockSize(uint32_t value)
+            {
+                const uint32_t blockSize = SoftwareOcclusionBuffer::BlockSize;
+                return AZStd::max((value + blockSize - 1) / blockSize, 1u) * blockSize;
+            }
+        }
+
+        SoftwareOcclusionBuffer::SoftwareOcclusionBuffer(uint32_t width, uint32_t height)
+            : m_width(RoundUpToBlockSize(width))
+            , m_height(RoundUpToBlockSize(height))
+        {
+            m_blocksX = m_width / BlockSize;
+            m_blocksY = m_height / BlockSize;
+            m_depth.resize(m_width * m_height, 0.0f);
+            m_blockMinDepth.resize(m_blocksX * m_blocksY, 0.0f);
+            m_bandTriangles.resize(m_blocksY);
+        }
+
+        uint32_t SoftwareOcclusionBuffer::GetWidth() const
+        {
+            return m_width;
+        }
+
+        uint32_t SoftwareOcclusionBuffer::GetHeight() const
+        {
+            return m_height;
+        }
+
+        void SoftwareOcclusionBuffer::Clear()
+        {
+            AZStd::fill(m_depth.begin(), m_depth.end(), 0.0f);
+            AZStd::fill(m_blockMinDepth.begin(), m_blockMinDepth.end(), 0.0f);
+            m_triangles.clear();
+            for (AZStd::vector<uint32_t>& bandTriangles : m_bandTriangles)
+            {
+                bandTriangles.clear();
+            }
+        }
+
+        void SoftwareOcclusionBuffer::BuildTriangleNeighbors(
+            const Vector3* positions, size_t vertexCount, const uint32_t* indices, size_t indexCount, AZStd::vector<uint32_t>& triangleNeighbors)
+        {
+            const size_t triangleCount = indexCount / 3;
+            triangleNeighbors.assign(triangleCount * 3, NoNeighbor);
+
+            // Weld the vertices by position, meshes split vertices that share a position for their normals and uvs
+            AZStd::unordered_map<Vector3, uint32_t, PositionHash> weldedIndices;
+            AZStd::vector<uint32_t> welded(vertexCount);
+            for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                welded[vertexIndex] = weldedIndices.emplace(positions[vertexIndex], aznumeric_cast<uint32_t>(vertexIndex)).first->second;
+            }
+
+            // Directed edge (from, to) -> the edge slot using it, or NoNeighbor once it's used more than once
+            struct EdgeUse
+            {
+                uint32_t m_slot;
+                uint32_t m_count;
+            };
+            AZStd::unordered_map<uint64_t, EdgeUse> directedEdges;
+            auto edgeKey = [](uint32_t from, uint32_t to)
+            {
+                return (aznumeric_cast<uint64_t>(from) << 32) | to;
+            };
+            for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+            {
+                for (uint32_t edge = 0; edge < 3; ++edge)
+                {
+                    const uint32_t from = indices[triangle * 3 + edge];
+                    const uint32_t to = indices[triangle * 3 + (edge + 1) % 3];
+                    if (from >= vertexCount || to >= vertexCount)
+                    {
+                        continue;
+                    }
+                    EdgeUse& edgeUse = directedEdges.emplace(edgeKey(welded[from], welded[to]), EdgeUse{ aznumeric_cast<uint32_t>(triangle * 3 + edge), 0 }).first->second;
+                    ++edgeUse.m_count;
+                }
+            }
+
+            for (const auto& [key, edgeUse] : directedEdges)
+            {
+                const auto reverse = directedEdges.find(edgeKey(aznumeric_cast<uint32_t>(key & 0xFFFFFFFF), aznumeric_cast<uint32_t>(key >> 32)));
+                if (edgeUse.m_count == 1 && reverse != directedEdges.end() && reverse->second.m_count == 1)
+                {
+                    triangleNeighbors[edgeUse.m_slot] = reverse->second.m_slot / 3;
+                }
+            }
+        }
+
+        void SoftwareOcclusionBuffer::AddOccluderMesh(
+            const Matrix4x4& localToClip, const Vector3* positions, size_t vertexCount, const uint32_t* indices, size_t indexCount,
+            const uint32_t* triangleNeighbors)
+        {
+            m_pixelPositions.resize(vertexCount);
+            for (size_t i = 0; i < vertexCount; ++i)
+            {
+                const Vector4 clipPosition = localToClip * Vector4::CreateFromVector3AndFloat(positions[i], 1.0f);
+                if (clipPosition.GetW() < NearPlaneEpsilon)
+                {
+                    // Triangles using this vertex cross the near plane
+                    m_pixelPositions[i] = Vector3::CreateZero();
+                    continue;
+                }
+                const float invW = 1.0f / clipPosition.GetW();
+                m_pixelPositions[i].Set(
+                    (clipPosition.GetX() * invW * 0.5f + 0.5f) * m_width,
+                    (clipPosition.GetY() * invW * 0.5f + 0.5f) * m_height,
+                    invW);
+            }
+
+            // The winding on screen tells which side of a shared edge each triangle lies on
+            const size_t triangleCount = indexCount / 3;
+            m_triangleWindings.resize(triangleCount);
+            for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+            {
+                m_triangleWindings[triangle] = 0;
+                const uint32_t* triangleIndices = indices + triangle * 3;
+                if (triangleIndices[0] >= vertexCount || triangleIndices[1] >= vertexCount || triangleIndices[2] >= vertexCount)
+                {
+                    AZ_Assert(false, "Occluder mesh index out of range");
+                    continue;
+                }
+
+                const Vector3& v0 = m_pixelPositions[triangleIndices[0]];
+                const Vector3& v1 = m_pixelPositions[triangleIndices[1]];
+                const Vector3& v2 = m_pixelPositions[triangleIndices[2]];
+                if (v0.GetZ() == 0.0f || v1.GetZ() == 0.0f || v2.GetZ() == 0.0f)
+                {
+                    // Dropping a triangle only makes the occlusion test less aggressive, so triangles crossing the
+                    // near plane are skipped rather than clipped.
+                    continue;
+                }
+
+                const float area = (v1.GetX() - v0.GetX()) * (v2.GetY() - v0.GetY()) - (v2.GetX() - v0.GetX()) * (v1.GetY() - v0.GetY());
+                if (AZStd::abs(area) >= MinimumTriangleArea)
+                {
+                    m_triangleWindings[triangle] = area > 0.0f ? 1 : -1;
+                }
+            }
+
+            for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+            {
+                const int8_t winding = m_triangleWindings[triangle];
+                if (winding == 0)
+                {
+                    continue;
+                }
+
+                // An edge is only inside the occluder on screen if the triangle on its other side faces the same way,
+                // otherwise both triangles are on the same side of it and it's part of the silhouette
+                uint32_t silhouetteEdges = 0;
+                for (uint32_t edge = 0; edge < 3; ++edge)
+                {
+                    const uint32_t neighbor = triangleNeighbors ? triangleNeighbors[triangle * 3 + edge] : NoNeighbor;
+                    if (neighbor >= triangleCount || m_triangleWindings[neighbor] != winding)
+                    {
+                        silhouetteEdges |= 1u << edge;
+                    }
+                }
+
+                const uint32_t* triangleIndices = indices + triangle * 3;
+                SetupTriangle(m_pixelPositions[triangleIndices[0]], m_pixelPositions[triangleIndices[1]], m_pixelPositions[triangleIndices[2]], silhouetteEdges);
+            }
+        }
+
+        void SoftwareOcclusionBuffer::SetupTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2, uint32_t silhouetteEdges)
+        {
+            float x[3] = { v0.GetX(), v1.GetX(), v2.GetX() };
+            float y[3] = { v0.GetY(), v1.GetY(), v2.GetY() };
+            float z[3] = { v0.GetZ(), v1.GetZ(), v2.GetZ() };
+
+            float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+
+            // Occluders are double sided; flip clockwise triangles so the edge functions are positive inside.
+            // Swapping vertex 1 and 2 swaps edge 0 (0 to 1) with edge 2 (2 to 0).
+            if (area < 0.0f)
+            {
+                AZStd::swap(x[1], x[2]);
+                AZStd::swap(y[1], y[2]);
+                AZStd::swap(z[1], z[2]);
+                area = -area;
+                silhouetteEdges = (silhouetteEdges & 2u) | ((silhouetteEdges & 1u) << 2) | ((silhouetteEdges & 4u) >> 2);
+            }
+
+            // Clamp in floating point first; vertices near the camera can project far outside of the int range.
+            const float maxPixelX = aznumeric_cast<float>(m_width - 1);
+            const float maxPixelY = aznumeric_cast<float>(m_height - 1);
+            Triangle triangle;
+            triangle.m_minX = aznumeric_cast<int32_t>(AZStd::clamp(AZStd::floor(AZStd::min(AZStd::min(x[0], x[1]), x[2])), 0.0f, maxPixelX + 1.0f));
+            triangle.m_minY = aznumeric_cast<int32_t>(AZStd::clamp(AZStd::floor(AZStd::min(AZStd::min(y[0], y[1]), y[2])), 0.0f, maxPixelY + 1.0f));
+            triangle.m_maxX = aznumeric_cast<int32_t>(AZStd::clamp(AZStd::floor(AZStd::max(AZStd::max(x[0], x[1]), x[2])), -1.0f, maxPixelX));
+            triangle.m_maxY = aznumeric_cast<int32_t>(AZStd::clamp(AZStd::floor(AZStd::max(AZStd::max(y[0], y[1]), y[2])), -1.0f, maxPixelY));
+            if (triangle.m_minX > triangle.m_maxX || triangle.m_minY > triangle.m_maxY)
+            {
+                return;
+            }
+
+            // Edge i goes from vertex i to vertex i + 1 and is opposite to vertex i + 2.
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                const uint32_t next = (i + 1) % 3;
+                const float a = y[i] - y[next];
+                const float b = x[next] - x[i];
+                triangle.m_edgeA[i] = a;
+                triangle.m_edgeB[i] = b;
+                triangle.m_edgeC[i] = -(a * x[i] + b * y[i]);
+            }
+
+            // Interpolate 1/w with barycentric weights; the weight of vertex i is the edge opposite to it.
+            const float invArea = 1.0f / area;
+            triangle.m_depthA = (triangle.m_edgeA[1] * z[0] + triangle.m_edgeA[2] * z[1] + triangle.m_edgeA[0] * z[2]) * invArea;
+            triangle.m_depthB = (triangle.m_edgeB[1] * z[0] + triangle.m_edgeB[2] * z[1] + triangle.m_edgeB[0] * z[2]) * invArea;
+            triangle.m_depthC = (triangle.m_edgeC[1] * z[0] + triangle.m_edgeC[2] * z[1] + triangle.m_edgeC[0] * z[2]) * invArea;
+
+            // Bias the plane toward the farthest depth anywhere in the pixel, and never beyond the farthest vertex.
+            triangle.m_depthC -= 0.5f * (AZStd::abs(triangle.m_depthA) + AZStd::abs(triangle.m_depthB));
+            triangle.m_depthMin = AZStd::min(AZStd::min(z[0], z[1]), z[2]);
+
+            // Edges are evaluated at pixel centers. Across a silhouette edge the whole pixel has to be inside, so the
+            // edge is moved in by the farthest any point of the pixel can be from its center.
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                if (silhouetteEdges & (1u << i))
+                {
+                    triangle.m_edgeC[i] -= 0.5f * (AZStd::abs(triangle.m_edgeA[i]) + AZStd::abs(triangle.m_edgeB[i]));
+                }
+            }
+
+            const uint32_t triangleIndex = aznumeric_cast<uint32_t>(m_triangles.size());
+            m_triangles.push_back(triangle);
+            const int32_t bandHeight = aznumeric_cast<int32_t>(BlockSize);
+            for (int32_t band = triangle.m_minY / bandHeight; band <= triangle.m_maxY / bandHeight; ++band)
+            {
+                m_bandTriangles[band].push_back(triangleIndex);
+            }
+        }
+
+        void SoftwareOcclusionBuffer::Rasterize(bool parallel)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            if (m_triangles.empty())
+            {
+                return;
+            }
+
+            if (parallel)
+            {
+                AZ::JobCompletion jobCompletion;
+                for (uint32_t bandIndex = 0; bandIndex < m_blocksY; ++bandIndex)
+                {
+                    if (m_bandTriangles[bandIndex].empty())
+                    {
+                        continue;
+                    }
+
+                    const auto rasterizeBandLambda = [this, bandIndex]()
+                    {
+                        RasterizeBand(bandIndex);
+                    };
+                    AZ::Job* rasterizeBandJob = AZ::CreateJobFunction(AZStd::move(rasterizeBandLambda), true, nullptr);
+                    rasterizeBandJob->SetDependent(&jobCompletion);
+                    rasterizeBandJob->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (uint32_t bandIndex = 0; bandIndex < m_blocksY; ++bandIndex)
+                {
+                    if (!m_bandTriangles[bandIndex].empty())
+                    {
+                        RasterizeBand(bandIndex);
+                    }
+                }
+            }
+        }
+
+        void SoftwareOcclusionBuffer::RasterizeBand(uint32_t bandIndex)
+        {
+            const int32_t bandMinY = aznumeric_cast<int32_t>(bandIndex * BlockSize);
+            const int32_t bandMaxY = bandMinY + aznumeric_cast<int32_t>(BlockSize) - 1;
+
+            for (uint32_t triangleIndex : m_bandTriangles[bandIndex])
+            {
+                const Triangle& triangle = m_triangles[triangleIndex];
+                RasterizeTriangle(triangle, AZStd::max(triangle.m_minY, bandMinY), AZStd::min(triangle.m_maxY, bandMaxY));
+            }
+
+            // Update the farthest depth of each block in this band.
+            for (uint32_t blockX = 0; blockX < m_blocksX; ++blockX)
+            {
+                float blockMinDepth = AZStd::numeric_limits<float>::max();
+                for (uint32_t y = 0; y < BlockSize; ++y)
+                {
+                    const float* row = &m_depth[(bandMinY + y) * m_width + blockX * BlockSize];
+                    for (uint32_t x = 0; x < BlockSize; ++x)
+                    {
+                        blockMinDepth = AZStd::min(blockMinDepth, row[x]);
+                    }
+                }
+                m_blockMinDepth[bandIndex * m_blocksX + blockX] = blockMinDepth;
+            }
+        }
+
+        void SoftwareOcclusionBuffer::RasterizeTriangle(const Triangle& triangle, int32_t minY, int32_t maxY)
+        {
+            using namespace Simd;
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType pixelCenterOffsets = Vec4::LoadImmediate(0.5f, 1.5f, 2.5f, 3.5f);
+            const Vec4::FloatType edgeA0 = Vec4::Splat(triangle.m_edgeA[0]);
+            const Vec4::FloatType edgeA1 = Vec4::Splat(triangle.m_edgeA[1]);
+            const Vec4::FloatType edgeA2 = Vec4::Splat(triangle.m_edgeA[2]);
+            const Vec4::FloatType depthA = Vec4::Splat(triangle.m_depthA);
+            const Vec4::FloatType depthMin = Vec4::Splat(triangle.m_depthMin);
+
+            // The buffer width is a multiple of 4, so starting on a multiple of 4 keeps every group of 4 pixels in the row.
+            const int32_t startX = triangle.m_minX & ~3;
+
+            for (int32_t y = minY; y <= maxY; ++y)
+            {
+                const float pixelCenterY = aznumeric_cast<float>(y) + 0.5f;
+                const Vec4::FloatType rowEdge0 = Vec4::Splat(triangle.m_edgeB[0] * pixelCenterY + triangle.m_edgeC[0]);
+                const Vec4::FloatType rowEdge1 = Vec4::Splat(triangle.m_edgeB[1] * pixelCenterY + triangle.m_edgeC[1]);
+                const Vec4::FloatType rowEdge2 = Vec4::Splat(triangle.m_edgeB[2] * pixelCenterY + triangle.m_edgeC[2]);
+                const Vec4::FloatType rowDepth = Vec4::Splat(triangle.m_depthB * pixelCenterY + triangle.m_depthC);
+
+                float* row = &m_depth[y * m_width];
+                for (int32_t x = startX; x <= triangle.m_maxX; x += 4)
+                {
+                    const Vec4::FloatType pixelCenterX = Vec4::Add(Vec4::Splat(aznumeric_cast<float>(x)), pixelCenterOffsets);
+
+                    const Vec4::FloatType edge0 = Vec4::Madd(edgeA0, pixelCenterX, rowEdge0);
+                    const Vec4::FloatType edge1 = Vec4::Madd(edgeA1, pixelCenterX, rowEdge1);
+                    const Vec4::FloatType edge2 = Vec4::Madd(edgeA2, pixelCenterX, rowEdge2);
+                    const Vec4::FloatType covered = Vec4::And(
+                        Vec4::And(Vec4::CmpGtEq(edge0, zero), Vec4::CmpGtEq(edge1, zero)), Vec4::CmpGtEq(edge2, zero));
+
+                    const Vec4::FloatType depth = Vec4::Max(Vec4::Madd(depthA, pixelCenterX, rowDepth), depthMin);
+                    const Vec4::FloatType previousDepth = Vec4::LoadUnaligned(row + x);
+                    Vec4::StoreUnaligned(row + x, Vec4::Select(Vec4::Max(previousDepth, depth), previousDepth, covered));
+                }
+            }
+        }
+
+        bool SoftwareOcclusionBuffer::IsVisible(const Matrix4x4& worldToClip, const Aabb& aabb) const
+        {
+            const Vector3& minBound = aabb.GetMin();
+            const Vector3& maxBound = aabb.GetMax();
+
+            float nearestW = AZStd::numeric_limits<float>::max();
+            float ndcMinX = AZStd::numeric_limits<float>::max();
+            float ndcMinY = AZStd::numeric_limits<float>::max();
+            float ndcMaxX = -AZStd::numeric_limits<float>::max();
+            float ndcMaxY = -AZStd::numeric_limits<float>::max();
+            for (uint32_t corner = 0; corner < 8; ++corner)
+            {
+                const Vector4 clipPosition = worldToClip * Vector4(
+                    (corner & 1) ? maxBound.GetX() : minBound.GetX(),
+                    (corner & 2) ? maxBound.GetY() : minBound.GetY(),
+                    (corner & 4) ? maxBound.GetZ() : minBound.GetZ(),
+                    1.0f);
+
+                const float w = clipPosition.GetW();
+                if (w < NearPlaneEpsilon)
+                {
+                    // The box crosses the near plane (or contains the camera)
+                    return true;
+                }
+
+                nearestW = AZStd::min(nearestW, w);
+                ndcMinX = AZStd::min(ndcMinX, clipPosition.GetX() / w);
+                ndcMinY = AZStd::min(ndcMinY, clipPosition.GetY() / w);
+                ndcMaxX = AZStd::max(ndcMaxX, clipPosition.GetX() / w);
+                ndcMaxY = AZStd::max(ndcMaxY, clipPosition.GetY() / w);
+            }
+
+            return IsRectVisible(ndcMinX, ndcMinY, ndcMaxX, ndcMaxY, nearestW);
+        }
+
+        bool SoftwareOcclusionBuffer::IsRectVisible(float ndcMinX, float ndcMinY, float ndcMaxX, float ndcMaxY, float nearestW) const
+        {
+            if (nearestW < NearPlaneEpsilon)
+            {
+                return true;
+            }
+
+            const float width = aznumeric_cast<float>(m_width);
+            const float height = aznumeric_cast<float>(m_height);
+            const float minX = AZStd::floor((ndcMinX * 0.5f + 0.5f) * width);
+            const float minY = AZStd::floor((ndcMinY * 0.5f + 0.5f) * height);
+            const float maxX = AZStd::floor((ndcMaxX * 0.5f + 0.5f) * width);
+            const float maxY = AZStd::floor((ndcMaxY * 0.5f + 0.5f) * height);
+            if (maxX < 0.0f || maxY < 0.0f || minX >= width || minY >= height)
+            {
+                // Entirely off screen, which is up to the frustum test to decide.
+                return true;
+            }
+
+            const uint32_t pixelMinX = aznumeric_cast<uint32_t>(AZStd::max(minX, 0.0f));
+            const uint32_t pixelMinY = aznumeric_cast<uint32_t>(AZStd::max(minY, 0.0f));
+            const uint32_t pixelMaxX = aznumeric_cast<uint32_t>(AZStd::min(maxX, width - 1.0f));
+            const uint32_t pixelMaxY = aznumeric_cast<uint32_t>(AZStd::min(maxY, height - 1.0f));
+
+            // The rect is hidden only if every pixel it touches holds an occluder strictly nearer than its nearest point.
+            const float nearestDepth = (1.0f + DepthTolerance) / nearestW;
+            for (uint32_t blockY = pixelMinY / BlockSize; blockY <= pixelMaxY / BlockSize; ++blockY)
+            {
+                for (uint32_t blockX = pixelMinX / BlockSize; blockX <= pixelMaxX / BlockSize; ++blockX)
+                {
+                    if (m_blockMinDepth[blockY * m_blocksX + blockX] > nearestDepth)
+                    {
+                        continue;
+                    }
+
+                    const uint32_t blockMinX = AZStd::max(blockX * BlockSize, pixelMinX);
+                    const uint32_t blockMaxX = AZStd::min(blockX * BlockSize + BlockSize - 1, pixelMaxX);
+                    const uint32_t blockMinY = AZStd::max(blockY * BlockSize, pixelMinY);
+                    const uint32_t blockMaxY = AZStd::min(blockY * BlockSize + BlockSize - 1, pixelMaxY);
+                    for (uint32_t y = blockMinY; y <= blockMaxY; ++y)
+                    {
+                        const float* row = &m_depth[y * m_width];
+                        for (uint32_t x = blockMinX; x <= blockMaxX; ++x)
+                        {
+                            if (row[x] <= nearestDepth)
+                            {
+                                return true;
+                            }
+                        }
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        uint32_t SoftwareOcclusionBuffer::GetTriangleCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_triangles.size());
+        }
+
+        float SoftwareOcclusionBuffer::GetDepth(uint32_t x, uint32_t y) const
+        {
+            AZ_Assert(x < m_width && y < m_height, "Pixel out of range");
+            return m_depth[y * m_width + x];
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
 #include <Atom/RPI.Public/Pass/Specific/SwapChainPass.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
 
@@ -431,5 +432,14 @@ namespace AZ
         {
             return m_maskedOcclusionCulling;
         }
+
+        SoftwareOcclusionBuffer* View::GetSoftwareOcclusionBuffer()
+        {
+            if (!m_softwareOcclusionBuffer)
+            {
+                m_softwareOcclusionBuffer = AZStd::make_unique<SoftwareOcclusionBuffer>();
+            }
+            return m_softwareOcclusionBuffer.get();
+        }
     } // namespace RPI
 } // namespace AZ
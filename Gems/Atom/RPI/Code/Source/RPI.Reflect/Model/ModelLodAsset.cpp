@@ -22,9 +22,10 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
                 serializeContext->Class<ModelLodAsset>()
-                    ->Version(0)
+                    ->Version(1)
                     ->Field("Meshes", &ModelLodAsset::m_meshes)
                     ->Field("Aabb", &ModelLodAsset::m_aabb)
+                    ->Field("ScreenCoverageMax", &ModelLodAsset::m_screenCoverageMax)
                     ;
             }
 
@@ -118,6 +119,11 @@ namespace AZ
             return m_aabb;
         }
 
+        float ModelLodAsset::GetScreenCoverageMax() const
+        {
+            return m_screenCoverageMax;
+        }
+
         const BufferAssetView* ModelLodAsset::Mesh::GetSemanticBufferAssetView(const AZ::Name& semantic) const
         {
             const AZStd::array_view<ModelLodAsset::Mesh::StreamBufferInfo>& streamBufferList = GetStreamBufferInfoList();
@@ -35,6 +35,14 @@ namespace AZ
             }
         }
 
+        void ModelLodAssetCreator::SetScreenCoverageMax(float screenCoverageMax)
+        {
+            if (ValidateIsReady())
+            {
+                m_asset->m_screenCoverageMax = screenCoverageMax;
+            }
+        }
+
         void ModelLodAssetCreator::BeginMesh()
         {
             if (ValidateIsReady())
@@ -249,6 +257,7 @@ namespace AZ
             ModelLodAssetCreator creator;
             inOutLastCreatedAssetId.m_subId = inOutLastCreatedAssetId.m_subId + 1;
             creator.Begin(inOutLastCreatedAssetId);
+            creator.SetScreenCoverageMax(sourceAsset->GetScreenCoverageMax());
 
             // Add the index buffer
             const Data::Asset<BufferAsset> sourceIndexBufferAsset = sourceMeshes[0].GetIndexBufferAssetView().GetBufferAsset();
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#include <Atom/RPI.Public/Buffer/BufferSystem.h>
+#include <Atom/RPI.Public/Model/ModelSystem.h>
+#include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+#include <Atom/RPI.Reflect/Model/MorphTargetMetaAsset.h>
+#include <Atom/RPI.Reflect/Model/SkinMetaAsset.h>
+
+#include <SceneAPI/SceneCore/Containers/Scene.h>
+#include <SceneAPI/SceneCore/DataTypes/Groups/IMeshGroup.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/IClothRule.h>
+#include <SceneAPI/SceneData/GraphData/MeshData.h>
+#include <SceneAPI/SceneData/ManifestBase/SceneNodeSelectionList.h>
+#include <SceneAPI/SceneData/Rules/AutoLodRule.h>
+
+#include <Model/ModelAssetBuilderComponent.h>
+
+#include <Common/AssetSystemStub.h>
+#include <Tests.Builders/BuilderTestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    // Minimal mesh group, the builder only needs the node selection and the rules.
+    class TestMeshGroup
+        : public SceneAPI::DataTypes::IMeshGroup
+    {
+    public:
+        AZ_RTTI(TestMeshGroup, "{2B7C3A0E-5E8F-4D36-9C0B-6F1E8B7D4A21}", SceneAPI::DataTypes::IMeshGroup);
+        AZ_CLASS_ALLOCATOR(TestMeshGroup, SystemAllocator, 0);
+
+        const AZStd::string& GetName() const override { return m_name; }
+        void SetName(AZStd::string&& name) override { m_name = AZStd::move(name); }
+        const Uuid& GetId() const override { return m_id; }
+        void OverrideId(const Uuid& id) override { m_id = id; }
+        SceneAPI::Containers::RuleContainer& GetRuleContainer() override { return m_rules; }
+        const SceneAPI::Containers::RuleContainer& GetRuleContainerConst() const override { return m_rules; }
+        SceneAPI::DataTypes::ISceneNodeSelectionList& GetSceneNodeSelectionList() override { return m_nodeSelectionList; }
+        const SceneAPI::DataTypes::ISceneNodeSelectionList& GetSceneNodeSelectionList() const override { return m_nodeSelectionList; }
+
+    private:
+        SceneAPI::SceneData::SceneNodeSelectionList m_nodeSelectionList;
+        SceneAPI::Containers::RuleContainer m_rules;
+        AZStd::string m_name = "TestModel";
+        Uuid m_id = Uuid::CreateRandom();
+    };
+
+    // Cloth rule that marks every vertex of a mesh as simulated.
+    class TestClothRule
+        : public SceneAPI::DataTypes::IClothRule
+    {
+    public:
+        AZ_RTTI(TestClothRule, "{8D4E1F62-3C7A-4B59-A0E2-5B9C7D3F1A84}", SceneAPI::DataTypes::IClothRule);
+        AZ_CLASS_ALLOCATOR(TestClothRule, SystemAllocator, 0);
+
+        explicit TestClothRule(const AZStd::string& meshNodeName)
+            : m_meshNodeName(meshNodeName)
+        {
+        }
+
+        const AZStd::string& GetMeshNodeName() const override { return m_meshNodeName; }
+
+        AZStd::vector<AZ::Color> ExtractClothData([[maybe_unused]] const SceneAPI::Containers::SceneGraph& graph, const size_t numVertices) const override
+        {
+            return AZStd::vector<AZ::Color>(numVertices, AZ::Color(1.0f, 1.0f, 1.0f, 1.0f));
+        }
+
+    private:
+        AZStd::string m_meshNodeName;
+    };
+
+    class ModelAssetBuilderTests
+        : public BuilderTestFixture
+    {
+    protected:
+        static constexpr AZ::u32 GridCellCount = 16;
+
+        void SetUp() override
+        {
+            BuilderTestFixture::SetUp();
+
+            RPI::BufferSystem::GetAssetHandlers(m_assetHandlers);
+            RPI::ModelSystem::GetAssetHandlers(m_assetHandlers);
+
+            m_assetSystemStub.Activate();
+            m_assetSystemStub.RegisterSourceInfo("ResourcePools/DefaultVertexBufferPool.resourcepool", Data::AssetId(Uuid::CreateRandom(), 0));
+        }
+
+        void TearDown() override
+        {
+            m_assetSystemStub.Deactivate();
+
+            // The handlers unregister themselves when they are destroyed.
+            m_assetHandlers.clear();
+
+            BuilderTestFixture::TearDown();
+        }
+
+        // Adds a bumpy grid to the scene, so simplifying it introduces an error.
+        SceneAPI::Containers::SceneGraph::NodeIndex AddGridMesh(SceneAPI::Containers::Scene& scene)
+        {
+            auto meshData = AZStd::make_shared<SceneAPI::SceneData::GraphData::MeshData>();
+
+            const AZ::u32 rowSize = GridCellCount + 1;
+            for (AZ::u32 y = 0; y < rowSize; ++y)
+            {
+                for (AZ::u32 x = 0; x < rowSize; ++x)
+                {
+                    const float height = 0.25f * sinf(0.7f * x) * cosf(0.9f * y);
+                    meshData->AddPosition(AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), height));
+                    meshData->AddNormal(AZ::Vector3::CreateAxisZ());
+                }
+            }
+            for (AZ::u32 y = 0; y < GridCellCount; ++y)
+            {
+                for (AZ::u32 x = 0; x < GridCellCount; ++x)
+                {
+                    const AZ::u32 i0 = y * rowSize + x;
+                    const AZ::u32 i1 = i0 + 1;
+                    const AZ::u32 i2 = i0 + rowSize;
+                    const AZ::u32 i3 = i2 + 1;
+                    meshData->AddFace(i0, i1, i3);
+                    meshData->AddFace(i0, i3, i2);
+                }
+            }
+
+            SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
+            return graph.AddChild(graph.GetRoot(), "Grid", AZStd::move(meshData));
+        }
+
+        RPI::AssetHandlerPtrList m_assetHandlers;
+        AssetSystemStub m_assetSystemStub;
+    };
+
+    TEST_F(ModelAssetBuilderTests, BuildModel_AutoLodRule_GeneratesCoarserLods)
+    {
+        SceneAPI::Containers::Scene scene("TestScene");
+        const SceneAPI::Containers::SceneGraph::NodeIndex meshNode = AddGridMesh(scene);
+
+        TestMeshGroup meshGroup;
+        meshGroup.GetSceneNodeSelectionList().AddSelectedNode(scene.GetGraph().GetNodeName(meshNode).GetPath());
+        meshGroup.GetRuleContainer().AddRule(AZStd::make_shared<SceneAPI::SceneData::AutoLodRule>());
+
+        Data::Asset<RPI::ModelAsset> modelAsset;
+        Data::Asset<RPI::SkinMetaAsset> skinMetaAsset;
+        Data::Asset<RPI::MorphTargetMetaAsset> morphTargetMetaAsset;
+        RPI::MaterialAssetsByUid materials;
+        RPI::ModelAssetBuilderContext context(scene, meshGroup, SceneAPI::CoordinateSystemConverter(), materials, modelAsset, skinMetaAsset, morphTargetMetaAsset);
+
+        RPI::ModelAssetBuilderComponent builder;
+        EXPECT_EQ(SceneAPI::Events::ProcessingResult::Success, builder.BuildModel(context));
+        ASSERT_TRUE(modelAsset.Get());
+
+        // The base lod and one lod for each of the default triangle ratios.
+        const AZStd::array_view<Data::Asset<RPI::ModelLodAsset>> lodAssets = modelAsset->GetLodAssets();
+        ASSERT_EQ(4, lodAssets.size());
+
+        const AZ::Name positionSemantic("POSITION");
+        const AZ::Name normalSemantic("NORMAL");
+        for (size_t lodIndex = 0; lodIndex < lodAssets.size(); ++lodIndex)
+        {
+            const RPI::ModelLodAsset* lodAsset = lodAssets[lodIndex].Get();
+            ASSERT_NE(nullptr, lodAsset);
+            ASSERT_EQ(1, lodAsset->GetMeshes().size());
+            const RPI::ModelLodAsset::Mesh& mesh = lodAsset->GetMeshes()[0];
+
+            // Every stream of a generated lod has an element for each of the vertices that are left.
+            const RPI::BufferAssetView* positions = mesh.GetSemanticBufferAssetView(positionSemantic);
+            const RPI::BufferAssetView* normals = mesh.GetSemanticBufferAssetView(normalSemantic);
+            ASSERT_NE(nullptr, positions);
+            ASSERT_NE(nullptr, normals);
+            EXPECT_EQ(mesh.GetVertexCount(), positions->GetBufferViewDescriptor().m_elementCount);
+            EXPECT_EQ(mesh.GetVertexCount(), normals->GetBufferViewDescriptor().m_elementCount);
+            EXPECT_EQ(0, mesh.GetIndexCount() % 3);
+
+            if (lodIndex == 0)
+            {
+                EXPECT_FLOAT_EQ(1.0f, lodAsset->GetScreenCoverageMax());
+                continue;
+            }
+
+            // Coarser lods have less triangles and are never selected at a larger screen coverage than the lods before them.
+            const RPI::ModelLodAsset* previousLodAsset = lodAssets[lodIndex - 1].Get();
+            EXPECT_LT(mesh.GetIndexCount(), previousLodAsset->GetMeshes()[0].GetIndexCount());
+            EXPECT_LE(mesh.GetVertexCount(), previousLodAsset->GetMeshes()[0].GetVertexCount());
+            EXPECT_LE(lodAsset->GetScreenCoverageMax(), previousLodAsset->GetScreenCoverageMax());
+            EXPECT_GT(lodAsset->GetScreenCoverageMax(), 0.0f);
+        }
+        EXPECT_LT(lodAssets[lodAssets.size() - 1]->GetScreenCoverageMax(), 1.0f);
+    }
+
+    TEST_F(ModelAssetBuilderTests, BuildModel_AutoLodRuleOnClothMesh_KeepsClothDataInGeneratedLods)
+    {
+        SceneAPI::Containers::Scene scene("TestScene");
+        const SceneAPI::Containers::SceneGraph::NodeIndex meshNode = AddGridMesh(scene);
+        const AZStd::string meshPath = scene.GetGraph().GetNodeName(meshNode).GetPath();
+
+        TestMeshGroup meshGroup;
+        meshGroup.GetSceneNodeSelectionList().AddSelectedNode(meshPath);
+        meshGroup.GetRuleContainer().AddRule(AZStd::make_shared<SceneAPI::SceneData::AutoLodRule>());
+        meshGroup.GetRuleContainer().AddRule(AZStd::make_shared<TestClothRule>(meshPath));
+
+        Data::Asset<RPI::ModelAsset> modelAsset;
+        Data::Asset<RPI::SkinMetaAsset> skinMetaAsset;
+        Data::Asset<RPI::MorphTargetMetaAsset> morphTargetMetaAsset;
+        RPI::MaterialAssetsByUid materials;
+        RPI::ModelAssetBuilderContext context(scene, meshGroup, SceneAPI::CoordinateSystemConverter(), materials, modelAsset, skinMetaAsset, morphTargetMetaAsset);
+
+        RPI::ModelAssetBuilderComponent builder;
+        EXPECT_EQ(SceneAPI::Events::ProcessingResult::Success, builder.BuildModel(context));
+        ASSERT_TRUE(modelAsset.Get());
+
+        const AZStd::array_view<Data::Asset<RPI::ModelLodAsset>> lodAssets = modelAsset->GetLodAssets();
+        ASSERT_EQ(4, lodAssets.size());
+
+        const AZ::Name clothDataSemantic("CLOTH_DATA");
+        for (const Data::Asset<RPI::ModelLodAsset>& lodAsset : lodAssets)
+        {
+            // Cloth meshes aren't merged, so every lod keeps the single cloth mesh with the same layout as the base lod.
+            ASSERT_EQ(1, lodAsset->GetMeshes().size());
+            const RPI::ModelLodAsset::Mesh& mesh = lodAsset->GetMeshes()[0];
+            const RPI::BufferAssetView* clothData = mesh.GetSemanticBufferAssetView(clothDataSemantic);
+            ASSERT_NE(nullptr, clothData);
+            EXPECT_EQ(mesh.GetVertexCount(), clothData->GetBufferViewDescriptor().m_elementCount);
+        }
+    }
+} // namespace UnitTest
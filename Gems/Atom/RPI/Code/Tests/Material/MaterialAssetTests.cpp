@@ -15,6 +15,10 @@
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
 #include <Atom/RPI.Reflect/Material/MaterialTypeAssetCreator.h>
 
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/chrono/clocks.h>
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -311,5 +315,65 @@ namespace UnitTest
             creator.SetPropertyValue(Name{ "MyEnum" }, -1);
         });
     }
+
+    TEST_F(MaterialAssetTests, BinarySerialization_RoundTrips)
+    {
+        Data::AssetId assetId(Uuid::CreateRandom());
+
+        MaterialAssetCreator creator;
+        creator.Begin(assetId, *m_testMaterialTypeAsset);
+        creator.SetPropertyValue(Name{ "MyFloat3" }, Vector3{ 1.1f, 1.2f, 1.3f });
+        creator.SetPropertyValue(Name{ "MyInt" }, -2);
+        creator.SetPropertyValue(Name{ "MyImage" }, m_testImageAsset);
+        Data::Asset<MaterialAsset> materialAsset;
+        EXPECT_TRUE(creator.End(materialAsset));
+
+        SerializeTester<RPI::MaterialAsset> tester(GetSerializeContext());
+        tester.SerializeOut(materialAsset.Get(), DataStream::ST_BINARY);
+
+        ObjectStream::FilterDescriptor noAssets{ AZ::Data::AssetFilterNoAssetLoading };
+        Data::Asset<RPI::MaterialAsset> serializedAsset = tester.SerializeIn(Data::AssetId(Uuid::CreateRandom()), noAssets);
+        EXPECT_EQ(m_testMaterialTypeAsset, serializedAsset->GetMaterialTypeAsset());
+        ASSERT_EQ(materialAsset->GetPropertyValues().size(), serializedAsset->GetPropertyValues().size());
+        EXPECT_EQ(serializedAsset->GetPropertyValues()[1].GetValue<int32_t>(), -2);
+        EXPECT_EQ(serializedAsset->GetPropertyValues()[5].GetValue<Vector3>(), Vector3(1.1f, 1.2f, 1.3f));
+        EXPECT_EQ(serializedAsset->GetPropertyValues()[8].GetValue<Data::Asset<ImageAsset>>(), m_testImageAsset);
+    }
+
+    // Measures loading a material asset from binary and XML object streams. Disabled by default since it's a performance measurement.
+    TEST_F(MaterialAssetTests, DISABLED_LoadFromObjectStream_Performance)
+    {
+        constexpr int LoadCount = 2000;
+
+        Data::AssetId assetId(Uuid::CreateRandom());
+        MaterialAssetCreator creator;
+        creator.Begin(assetId, *m_testMaterialTypeAsset);
+        creator.SetPropertyValue(Name{ "MyFloat4" }, Vector4{ 2.1f, 2.2f, 2.3f, 2.4f });
+        creator.SetPropertyValue(Name{ "MyImage" }, m_testImageAsset);
+        Data::Asset<MaterialAsset> materialAsset;
+        EXPECT_TRUE(creator.End(materialAsset));
+
+        ObjectStream::FilterDescriptor noAssets{ AZ::Data::AssetFilterNoAssetLoading };
+        for (DataStream::StreamType streamType : { DataStream::ST_BINARY, DataStream::ST_XML })
+        {
+            AZStd::vector<char> buffer;
+            IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            ASSERT_TRUE(Utils::SaveObjectToStream(stream, streamType, materialAsset.Get(), GetSerializeContext()));
+
+            const auto start = AZStd::chrono::high_resolution_clock::now();
+            for (int i = 0; i < LoadCount; ++i)
+            {
+                stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                MaterialAsset* loadedAsset = aznew MaterialAsset();
+                EXPECT_TRUE(Utils::LoadObjectFromStreamInPlace(stream, *loadedAsset, GetSerializeContext(), noAssets));
+                delete loadedAsset;
+            }
+            const auto end = AZStd::chrono::high_resolution_clock::now();
+
+            printf("Loading a material asset from a %s object stream of %zu bytes: %.3f us per load\n",
+                streamType == DataStream::ST_BINARY ? "binary" : "XML", buffer.size(),
+                AZStd::chrono::duration<double, AZStd::micro>(end - start).count() / LoadCount);
+        }
+    }
 }
 
@@ -6,15 +6,21 @@
  */
 
 #include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <Atom/RPI.Public/FeatureProcessorFactory.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
 #include <Atom/RPI.Public/View.h>
 
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MatrixUtils.h>
+
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #include <AzTest/AzTest.h>
@@ -435,4 +441,84 @@ namespace UnitTest
         testScene->Deactivate();
     }
 
+
+    TEST_F(SceneTests, ProcessCullables_CullableBehindOccluderMesh_IsCountedAsOcclusionCulled)
+    {
+        SceneDescriptor sceneDesc;
+        ScenePtr testScene = Scene::CreateScene(sceneDesc);
+        testScene->Activate();
+
+        CullingScene* cullingScene = testScene->GetCullingScene();
+        cullingScene->GetDebugContext().m_enableStats = true;
+        cullingScene->GetDebugContext().m_enableSoftwareOcclusionCulling = true;
+
+        RHI::DrawListMask drawListMask;
+        drawListMask.set(0);
+
+        // Camera at the origin looking along +Y
+        ViewPtr view = View::CreateView(AZ::Name("TestCamera"), View::UsageCamera);
+        view->SetDrawListMask(drawListMask);
+        Matrix4x4 viewToClip;
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.0f, 0.1f, 100.0f);
+        view->SetViewToClipMatrix(viewToClip);
+        view->SetCameraTransform(Matrix3x4::CreateIdentity());
+
+        auto registerCullable = [&](Cullable& cullable, const Aabb& aabb)
+        {
+            Vector3 center;
+            float radius;
+            aabb.GetAsSphere(center, radius);
+
+            cullable.m_cullData.m_boundingSphere = Sphere(center, radius);
+            cullable.m_cullData.m_boundingObb = Obb::CreateFromAabb(aabb);
+            cullable.m_cullData.m_drawListMask = drawListMask;
+            cullable.m_cullData.m_scene = testScene.get();
+            cullable.m_cullData.m_visibilityEntry.m_boundingVolume = aabb;
+            cullable.m_cullData.m_visibilityEntry.m_userData = &cullable;
+            cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
+            cullingScene->RegisterOrUpdateCullable(cullable);
+        };
+
+        // One box in front of a wall and one box hidden behind it
+        Cullable visibleCullable;
+        registerCullable(visibleCullable, Aabb::CreateFromMinMax(Vector3(-1.0f, 4.0f, -1.0f), Vector3(1.0f, 5.0f, 1.0f)));
+        Cullable occludedCullable;
+        registerCullable(occludedCullable, Aabb::CreateFromMinMax(Vector3(-1.0f, 19.0f, -1.0f), Vector3(1.0f, 20.0f, 1.0f)));
+
+        auto wall = AZStd::make_shared<CullingScene::OccluderGeometry>();
+        wall->m_positions = { Vector3(-10.0f, 0.0f, -10.0f), Vector3(10.0f, 0.0f, -10.0f), Vector3(10.0f, 0.0f, 10.0f), Vector3(-10.0f, 0.0f, 10.0f) };
+        wall->m_indices = { 0, 1, 2, 0, 2, 3 };
+        SoftwareOcclusionBuffer::BuildTriangleNeighbors(
+            wall->m_positions.data(), wall->m_positions.size(), wall->m_indices.data(), wall->m_indices.size(), wall->m_triangleNeighbors);
+
+        CullingScene::OccluderMesh occluderMesh;
+        occluderMesh.m_geometry = wall;
+        occluderMesh.m_localToWorld = Matrix3x4::CreateTranslation(Vector3(0.0f, 10.0f, 0.0f));
+        occluderMesh.m_aabb = Aabb::CreateFromMinMax(Vector3(-10.0f, 10.0f, -10.0f), Vector3(10.0f, 10.0f, 10.0f));
+        cullingScene->RegisterOccluderMesh(occluderMesh);
+
+        AZStd::vector<ViewPtr> views = { view };
+        cullingScene->BeginCulling(views);
+        AZ::JobCompletion completion;
+        AZ::Job* processCullablesJob = AZ::CreateJobFunction([&](AZ::Job& thisJob)
+            {
+                cullingScene->ProcessCullables(*testScene, *view, thisJob);
+            },
+            true, nullptr);
+        processCullablesJob->SetDependent(&completion);
+        processCullablesJob->Start();
+        completion.StartAndWaitForCompletion();
+        cullingScene->EndCulling();
+
+        const CullingDebugContext::CullStats& cullStats = cullingScene->GetDebugContext().GetCullStatsForView(view.get());
+        EXPECT_EQ(2, cullStats.m_numOccluderTriangles.load());
+        EXPECT_EQ(1, cullStats.m_numVisibleCullables.load());
+        EXPECT_EQ(1, cullStats.m_numOcclusionCulledCullables.load());
+
+        cullingScene->UnregisterOccluderMesh(occluderMesh);
+        cullingScene->UnregisterCullable(visibleCullable);
+        cullingScene->UnregisterCullable(occludedCullable);
+        testScene->Deactivate();
+    }
+
 }  // namespace UnitTest
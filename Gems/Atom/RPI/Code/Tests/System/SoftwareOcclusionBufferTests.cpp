@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
+
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class SoftwareOcclusionBufferTests
+        : public RPITestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+
+            // Camera at the origin looking down -Z with a 90 degree field of view
+            MakePerspectiveFovMatrixRH(m_worldToClip, Constants::HalfPi, 1.0f, 0.1f, 100.0f);
+        }
+
+        // Renders a square occluder of the given half size facing the camera at the given distance
+        void AddQuadOccluder(SoftwareOcclusionBuffer& buffer, float halfSize, float distance)
+        {
+            const Vector3 positions[] =
+            {
+                Vector3(-halfSize, -halfSize, -distance),
+                Vector3(halfSize, -halfSize, -distance),
+                Vector3(halfSize, halfSize, -distance),
+                Vector3(-halfSize, halfSize, -distance)
+            };
+            const uint32_t indices[] = { 0, 1, 2, 0, 2, 3 };
+            AZStd::vector<uint32_t> triangleNeighbors;
+            SoftwareOcclusionBuffer::BuildTriangleNeighbors(positions, 4, indices, 6, triangleNeighbors);
+            buffer.AddOccluderMesh(m_worldToClip, positions, 4, indices, 6, triangleNeighbors.data());
+        }
+
+        Matrix4x4 m_worldToClip;
+    };
+
+    TEST_F(SoftwareOcclusionBufferTests, IsVisible_EmptyBuffer_EverythingVisible)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+        buffer.Rasterize(false);
+
+        EXPECT_EQ(0, buffer.GetTriangleCount());
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -21.0f), Vector3(1.0f, 1.0f, -20.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsVisible_BoxBehindOccluder_IsHidden)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+        AddQuadOccluder(buffer, 5.0f, 10.0f);
+        buffer.Rasterize(false);
+
+        EXPECT_EQ(2, buffer.GetTriangleCount());
+        EXPECT_FALSE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -21.0f), Vector3(1.0f, 1.0f, -20.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsVisible_BoxInFrontOfOccluder_IsVisible)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+        AddQuadOccluder(buffer, 5.0f, 10.0f);
+        buffer.Rasterize(false);
+
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -6.0f), Vector3(1.0f, 1.0f, -5.0f))));
+
+        // Touching the occluder's surface must not be culled either
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -10.5f), Vector3(1.0f, 1.0f, -10.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsVisible_BoxPeekingPastOccluderEdge_IsVisible)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+        AddQuadOccluder(buffer, 5.0f, 10.0f);
+        buffer.Rasterize(false);
+
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(12.0f, -1.0f, -21.0f), Vector3(14.0f, 1.0f, -20.0f))));
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(9.0f, -1.0f, -21.0f), Vector3(11.0f, 1.0f, -20.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsVisible_BoxPeekingPastOccluderEdgeByLessThanAPixel_IsVisible)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+
+        // The occluder's right edge ends at 48.6 pixels, past the center of pixel 48 but not covering all of it
+        AddQuadOccluder(buffer, 5.1875f, 10.0f);
+        buffer.Rasterize(false);
+
+        // The box is between 48.7 and 48.9 pixels, so it's only visible in the partly covered pixel
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(10.4375f, -1.0f, -20.01f), Vector3(10.5625f, 1.0f, -20.0f))));
+        EXPECT_FALSE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -21.0f), Vector3(1.0f, 1.0f, -20.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, BuildTriangleNeighbors_Quad_ConnectsOnlyTheSharedEdge)
+    {
+        const Vector3 positions[] = { Vector3(-1.0f, -1.0f, 0.0f), Vector3(1.0f, -1.0f, 0.0f), Vector3(1.0f, 1.0f, 0.0f), Vector3(-1.0f, 1.0f, 0.0f) };
+        const uint32_t indices[] = { 0, 1, 2, 0, 2, 3 };
+        AZStd::vector<uint32_t> triangleNeighbors;
+        SoftwareOcclusionBuffer::BuildTriangleNeighbors(positions, 4, indices, 6, triangleNeighbors);
+
+        // Edge i of a triangle goes from its vertex i to vertex i + 1, the diagonal is edge 2 of the first triangle and edge 0 of the second
+        ASSERT_EQ(6, triangleNeighbors.size());
+        EXPECT_EQ(SoftwareOcclusionBuffer::NoNeighbor, triangleNeighbors[0]);
+        EXPECT_EQ(SoftwareOcclusionBuffer::NoNeighbor, triangleNeighbors[1]);
+        EXPECT_EQ(1, triangleNeighbors[2]);
+        EXPECT_EQ(0, triangleNeighbors[3]);
+        EXPECT_EQ(SoftwareOcclusionBuffer::NoNeighbor, triangleNeighbors[4]);
+        EXPECT_EQ(SoftwareOcclusionBuffer::NoNeighbor, triangleNeighbors[5]);
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsVisible_CameraInsideBox_IsVisible)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+        AddQuadOccluder(buffer, 5.0f, 10.0f);
+        buffer.Rasterize(false);
+
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -1.0f), Vector3(1.0f, 1.0f, 1.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, Rasterize_TriangleCrossingNearPlane_IsDropped)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+
+        const Vector3 positions[] = { Vector3(-5.0f, -5.0f, 1.0f), Vector3(5.0f, -5.0f, -10.0f), Vector3(0.0f, 5.0f, -10.0f) };
+        const uint32_t indices[] = { 0, 1, 2 };
+        buffer.AddOccluderMesh(m_worldToClip, positions, 3, indices, 3);
+        buffer.Rasterize(false);
+
+        EXPECT_EQ(0, buffer.GetTriangleCount());
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, Rasterize_SlopedOccluder_NeverStoresDepthNearerThanSurface)
+    {
+        SoftwareOcclusionBuffer buffer(64, 64);
+        buffer.Clear();
+
+        // A floor one unit below the camera, stretching away from it
+        const Vector3 positions[] =
+        {
+            Vector3(-50.0f, -1.0f, -1.0f),
+            Vector3(50.0f, -1.0f, -1.0f),
+            Vector3(50.0f, -1.0f, -99.0f),
+            Vector3(-50.0f, -1.0f, -99.0f)
+        };
+        const uint32_t indices[] = { 0, 1, 2, 0, 2, 3 };
+        buffer.AddOccluderMesh(m_worldToClip, positions, 4, indices, 6);
+        buffer.Rasterize(false);
+
+        // Objects resting on the floor are visible, objects below it are not
+        EXPECT_TRUE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-0.5f, -1.0f, -20.0f), Vector3(0.5f, 0.0f, -19.0f))));
+        EXPECT_FALSE(buffer.IsVisible(m_worldToClip, Aabb::CreateFromMinMax(Vector3(-0.5f, -3.0f, -20.0f), Vector3(0.5f, -2.0f, -19.0f))));
+
+        // Every sample inside a written pixel must be at or behind the stored depth
+        const float height = aznumeric_cast<float>(buffer.GetHeight());
+        for (uint32_t y = 0; y < buffer.GetHeight(); ++y)
+        {
+            for (uint32_t x = 0; x < buffer.GetWidth(); ++x)
+            {
+                const float depth = buffer.GetDepth(x, y);
+                if (depth == 0.0f)
+                {
+                    continue;
+                }
+
+                for (float sampleY = 0.0f; sampleY <= 1.0f; sampleY += 0.25f)
+                {
+                    // The floor is level, so its depth only depends on the row
+                    const float ndcY = (y + sampleY) / height * 2.0f - 1.0f;
+                    if (ndcY >= 0.0f)
+                    {
+                        continue;
+                    }
+
+                    // The ray through this sample hits the floor at a view distance (and w) of -1 / ndcY
+                    const float w = -1.0f / ndcY;
+                    if (w >= 1.0f && w <= 99.0f)
+                    {
+                        EXPECT_GE(1.0f / w, depth - 1.0e-6f);
+                    }
+                }
+            }
+        }
+    }
+}
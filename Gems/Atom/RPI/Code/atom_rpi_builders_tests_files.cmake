@@ -6,10 +6,13 @@
 #
 
 set(FILES
+    Tests/Common/AssetSystemStub.cpp
+    Tests/Common/AssetSystemStub.h
     Tests.Builders/AnyAssetBuilderTest.cpp
     Tests.Builders/AtomRPIBuildersTests.cpp
     Tests.Builders/BuilderTestFixture.cpp
     Tests.Builders/BuilderTestFixture.h
+    Tests.Builders/ModelAssetBuilderTest.cpp
     Tests.Builders/PassBuilderTest.cpp
     Tests.Builders/ResourcePoolBuilderTest.cpp
 )
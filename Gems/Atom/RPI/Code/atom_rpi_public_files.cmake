@@ -19,6 +19,7 @@ set(FILES
     Include/Atom/RPI.Public/RPIUtils.h
     Include/Atom/RPI.Public/Scene.h
     Include/Atom/RPI.Public/SceneBus.h
+    Include/Atom/RPI.Public/SoftwareOcclusionBuffer.h
     Include/Atom/RPI.Public/View.h
     Include/Atom/RPI.Public/ViewportContext.h
     Include/Atom/RPI.Public/ViewportContextBus.h
@@ -106,6 +107,7 @@ set(FILES
     Source/RPI.Public/RPISystem.cpp
     Source/RPI.Public/RPIUtils.cpp
     Source/RPI.Public/Scene.cpp
+    Source/RPI.Public/SoftwareOcclusionBuffer.cpp
     Source/RPI.Public/View.cpp
     Source/RPI.Public/ViewportContext.cpp
     Source/RPI.Public/ViewportContextManager.cpp
@@ -51,5 +51,6 @@ set(FILES
     Tests/System/GpuQueryTests.cpp
     Tests/System/RenderPipelineTests.cpp
     Tests/System/SceneTests.cpp
+    Tests/System/SoftwareOcclusionBufferTests.cpp
     Tests/System/ViewTests.cpp
 )
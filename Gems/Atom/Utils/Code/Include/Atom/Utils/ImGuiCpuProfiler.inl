@@ -167,6 +167,12 @@ namespace AZ
                     ShowRow(queueStatistics.m_queueName.GetCStr(), queueStatistics.m_executeDuration);
                 }
 
+                const AZ::RHI::CpuTimingStatistics::ShaderResourceGroupStatistics& srgStatistics = cpuTimingStatistics.m_shaderResourceGroupStatistics;
+                const AZStd::string srgLabel = AZStd::string::format(
+                    "SRG Compile (%u compiled, %u unchanged, %.1f KiB constants, %u jobs)", srgStatistics.m_compiledGroupCount,
+                    srgStatistics.m_skippedGroupCount, aznumeric_cast<double>(srgStatistics.m_constantBytes) / 1024.0, srgStatistics.m_jobCount);
+                ShowRow(srgLabel.c_str(), srgStatistics.m_compileDuration);
+
                 ImGui::Separator();
                 ImGui::Columns(1, "view", false);
 
@@ -40,6 +40,7 @@ namespace AZ
                 ImGui::Separator();
 
                 ImGui::Checkbox("Enable Frustum Culling", &debugCtx.m_enableFrustumCulling);
+                ImGui::Checkbox("Enable Software Occlusion Culling", &debugCtx.m_enableSoftwareOcclusionCulling);
                 ImGui::Checkbox("Enable Parallel Octree Traversal",  &debugCtx.m_parallelOctreeTraversal);
                 ImGui::Checkbox("Freeze Frustums", &debugCtx.m_freezeFrustums);
                 ImGui::Checkbox("Debug Draw", &debugCtx.m_debugDraw);
@@ -59,6 +60,7 @@ namespace AZ
                 uint32_t totalVisibleCullables = 0;
                 uint32_t totalVisibleDrawPackets = 0;
                 uint32_t totalCullJobs = 0;
+                uint32_t totalOcclusionCulledCullables = 0;
                 size_t numViews = 0;
 
                 auto& perViewCullStats = debugCtx.LockAndGetAllCullStats();
@@ -82,10 +84,12 @@ namespace AZ
                 for (CullStatsType* cullStats : cullStatsSorted)
                 {
                     // create formatted display strings
-                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs",
+                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d occluded (%d occluder tris), %d drawPackets visible, %d cull jobs",
                         cullStats->m_name.GetCStr(),
                         static_cast<uint32_t>(cullStats->m_numVisibleCullables),
                         static_cast<uint32_t>(debugCtx.m_numCullablesInScene),
+                        static_cast<uint32_t>(cullStats->m_numOcclusionCulledCullables),
+                        static_cast<uint32_t>(cullStats->m_numOccluderTriangles),
                         static_cast<uint32_t>(cullStats->m_numVisibleDrawPackets),
                         static_cast<uint32_t>(cullStats->m_numJobs)
                     ));
@@ -95,15 +99,17 @@ namespace AZ
                     totalVisibleCullables += cullStats->m_numVisibleCullables;
                     totalVisibleDrawPackets += cullStats->m_numVisibleDrawPackets;
                     totalCullJobs += cullStats->m_numJobs;
+                    totalOcclusionCulledCullables += cullStats->m_numOcclusionCulledCullables;
                 }
 
-                if (ImGui::BeginChild("Totals", ImVec2(0, 120.0f), true, ImGuiWindowFlags_None))
+                if (ImGui::BeginChild("Totals", ImVec2(0, 140.0f), true, ImGuiWindowFlags_None))
                 {
                     ImGui::Text("Totals:");
                     ImGui::Separator();
                     ImGui::Text("   %zu Views", numViews);
                     ImGui::Text("   %u Cull Jobs", totalCullJobs);
                     ImGui::Text("   %d/%d Visible Cullables", totalVisibleCullables, totalCullables);
+                    ImGui::Text("   %u Occlusion Culled Cullables", totalOcclusionCulledCullables);
                     ImGui::Text("   %d Submitted DrawPackets", totalVisibleDrawPackets);
                 }                
                 ImGui::EndChild();
@@ -47,6 +47,7 @@ namespace AZ
             RPI::Cullable::LodOverride m_lodOverride = RPI::Cullable::NoLodOverride;
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_useForwardPassIblSpecular = false;
+            bool m_isOccluder = false;
         };
 
         class MeshComponentController final
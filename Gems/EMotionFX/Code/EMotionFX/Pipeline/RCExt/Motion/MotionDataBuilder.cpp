@@ -25,6 +25,7 @@
 
 #include <EMotionFX/Source/Motion.h>
 #include <EMotionFX/Source/MotionManager.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
@@ -85,6 +86,15 @@ namespace EMotionFX
             optimizeSettings.m_jointIgnoreList = rootJoints; // Skip optimizing root joints, as that makes the feet jitter.
             optimizeSettings.m_updateDuration = samplingRule ? !samplingRule->GetKeepDuration() : false;
             finalMotionData->Optimize(optimizeSettings);
+
+            if (const CompressedMotionData* compressedMotionData = azrtti_cast<const CompressedMotionData*>(finalMotionData))
+            {
+                const CompressedMotionData::CompressionStats stats = compressedMotionData->GetCompressionStats();
+                AZ_TracePrintf("EMotionFX", "Compression ratio = %.2f (%zu bytes of full precision tracks to %zu bytes)",
+                    stats.GetCompressionRatio(), stats.m_uncompressedNumBytes, stats.m_compressedNumBytes);
+                AZ_TracePrintf("EMotionFX", "Max compression errors: position = %f, rotation = %f degrees, scale = %f, morph = %f, float = %f",
+                    stats.m_maxPosError, stats.m_maxRotError, stats.m_maxScaleError, stats.m_maxMorphError, stats.m_maxFloatError);
+            }
         }
 
         // Automatically determine what produces the smallest memory footprint motion data, either UniformMotionData or NonUniformMotionData.
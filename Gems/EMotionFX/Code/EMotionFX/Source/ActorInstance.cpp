@@ -64,6 +64,14 @@ namespace EMotionFX
         mVisualizeScale         = 1.0f;
         mMotionSamplingRate     = 0.0f;
         mMotionSamplingTimer    = 0.0f;
+        m_updateLODTimePassed   = 0.0f;
+        m_updateLODLeadTime     = 0.0f;
+        m_updateLODFrame        = 0;
+        m_updateLODMotionPosition = AZ::Vector3::CreateZero();
+        m_updateLODMotionRotation = AZ::Quaternion::CreateIdentity();
+        m_updateLODMotionFrames = 0;
+        m_hasUpdateLODPoses     = false;
+        m_optionalAnimGraphNodesEnabled = true;
 
         mTrajectoryDelta.IdentityWithZeroScale();
         mStaticAABB.Init();
@@ -364,6 +372,141 @@ namespace EMotionFX
         }
     }
 
+    bool ActorInstance::UpdateTransformationsWithLOD(float timePassedInSeconds, bool updateJointTransforms, bool sampleMotions, uint32 updateInterval, bool evaluate, bool interpolatePoses)
+    {
+        m_updateLODTimePassed += timePassedInSeconds;
+
+        // Skin attachments follow the joints of their parent and recorded actor instances are driven by the recorder, so always update those fully.
+        const bool isSkinAttachment = mSelfAttachment && mSelfAttachment->GetIsInfluencedByMultipleJoints();
+        const Recorder& recorder = GetRecorder();
+        if (updateInterval <= 1 || isSkinAttachment || (recorder.GetIsInPlayMode() && recorder.GetHasRecorded(this)))
+        {
+            // Finish the extracted motion that is still being spread, and let the anim graph run out of its lead.
+            ApplyUpdateLODMotion(m_updateLODMotionFrames);
+            m_updateLODFrame = 0;
+            m_hasUpdateLODPoses = false;
+            UpdateTransformations(ConsumeUpdateLODTime(0.0f), updateJointTransforms, sampleMotions);
+            return true;
+        }
+
+        if (evaluate)
+        {
+            ApplyUpdateLODMotion(m_updateLODMotionFrames);
+            m_updateLODFrame = 0;
+
+            // Only interpolate between poses that were both output by the anim graph or motion system.
+            // The pose is evaluated ahead by the frames until the next evaluation and the displayed pose moves towards it,
+            // so it reaches the evaluated pose at the time it was evaluated for instead of lagging one update interval behind.
+            m_hasUpdateLODPoses = interpolatePoses && updateJointTransforms && sampleMotions;
+            const float leadTime = m_hasUpdateLODPoses ? static_cast<float>(updateInterval - 1) * timePassedInSeconds : 0.0f;
+
+            if (m_hasUpdateLODPoses)
+            {
+                if (!m_updateLODFromPose)
+                {
+                    m_updateLODFromPose.reset(new Pose());
+                    m_updateLODFromPose->LinkToActorInstance(this);
+                    m_updateLODToPose.reset(new Pose());
+                    m_updateLODToPose->LinkToActorInstance(this);
+                }
+                *m_updateLODFromPose = *mTransformData->GetCurrentPose();
+            }
+
+            const Transform localTransform = mLocalTransform;
+            UpdateTransformations(ConsumeUpdateLODTime(leadTime), updateJointTransforms, sampleMotions);
+
+            if (m_hasUpdateLODPoses)
+            {
+                *m_updateLODToPose = *mTransformData->GetCurrentPose();
+            }
+
+            // Spread the motion extracted by this evaluation over the frames until the next one, so root motion doesn't move in steps.
+            m_updateLODMotionPosition = mLocalTransform.mPosition - localTransform.mPosition;
+            m_updateLODMotionRotation = (localTransform.mRotation.GetConjugate() * mLocalTransform.mRotation).GetNormalized();
+            m_updateLODMotionFrames = updateInterval;
+            mLocalTransform.mPosition = localTransform.mPosition;
+            mLocalTransform.mRotation = localTransform.mRotation;
+        }
+        else
+        {
+            ++m_updateLODFrame;
+        }
+
+        ApplyUpdateLODMotion(1);
+        UpdateWorldTransform();
+
+        if (updateJointTransforms && m_hasUpdateLODPoses)
+        {
+            const float weight = AZStd::min(static_cast<float>(m_updateLODFrame + 1) / static_cast<float>(updateInterval), 1.0f);
+            ApplyUpdateLODPose(weight);
+        }
+        else
+        {
+            UpdateAttachments();
+        }
+
+        return evaluate;
+    }
+
+
+    float ActorInstance::ConsumeUpdateLODTime(float leadTime)
+    {
+        // The anim graph is m_updateLODLeadTime ahead of the actor instance. When the requested lead shrinks by more than the
+        // time that passed, it waits for the actor instance to catch up instead of going back in time.
+        const float timePassed = m_updateLODTimePassed + leadTime - m_updateLODLeadTime;
+        m_updateLODLeadTime = AZStd::max(m_updateLODLeadTime - m_updateLODTimePassed, leadTime);
+        m_updateLODTimePassed = 0.0f;
+        return AZStd::max(timePassed, 0.0f);
+    }
+
+
+    void ActorInstance::ApplyUpdateLODMotion(uint32 numFrames)
+    {
+        numFrames = AZStd::min(numFrames, m_updateLODMotionFrames);
+        if (numFrames == 0)
+        {
+            return;
+        }
+
+        const float fraction = static_cast<float>(numFrames) / static_cast<float>(m_updateLODMotionFrames);
+        const AZ::Vector3 position = m_updateLODMotionPosition * fraction;
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateIdentity().Slerp(m_updateLODMotionRotation, fraction);
+
+        mLocalTransform.mPosition += position;
+        mLocalTransform.mRotation = (mLocalTransform.mRotation * rotation).GetNormalized();
+
+        m_updateLODMotionPosition -= position;
+        m_updateLODMotionRotation = (rotation.GetConjugate() * m_updateLODMotionRotation).GetNormalized();
+        m_updateLODMotionFrames -= numFrames;
+    }
+
+
+    void ActorInstance::ApplyUpdateLODPose(float weight)
+    {
+        Pose* currentPose = mTransformData->GetCurrentPose();
+        *currentPose = *m_updateLODFromPose;
+        currentPose->Blend(m_updateLODToPose.get(), weight);
+        currentPose->InvalidateAllModelSpaceTransforms();
+
+        currentPose->ApplyMorphWeightsToActorInstance();
+        ApplyMorphSetup();
+        UpdateSkinningMatrices();
+        UpdateAttachments();
+    }
+
+
+    void ActorInstance::SetOptionalAnimGraphNodesEnabled(bool enabled)
+    {
+        m_optionalAnimGraphNodesEnabled = enabled;
+    }
+
+
+    bool ActorInstance::GetOptionalAnimGraphNodesEnabled() const
+    {
+        return m_optionalAnimGraphNodesEnabled;
+    }
+
+
     // update the world transformation
     void ActorInstance::UpdateWorldTransform()
     {
@@ -1886,6 +2029,16 @@ namespace EMotionFX
 #endif
     }
 
+    void ActorInstance::SetSkinPositionsOnly(bool positionsOnly)
+    {
+        m_skinPositionsOnly = positionsOnly;
+    }
+
+    bool ActorInstance::GetSkinPositionsOnly() const
+    {
+        return m_skinPositionsOnly;
+    }
+
     uint32 ActorInstance::GetThreadIndex() const
     {
         return mThreadIndex;
@@ -36,6 +36,7 @@ namespace EMotionFX
     class Attachment;
     class AnimGraphInstance;
     class MorphSetupInstance;
+    class Pose;
     class RagdollInstance;
 
 
@@ -281,6 +282,30 @@ namespace EMotionFX
          */
         void UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true);
 
+        /**
+         * Update the transformations at a reduced rate, as chosen by the update LOD of the actor update scheduler.
+         * The anim graph or motion system is only evaluated on frames where evaluate is true, using all time passed since the previous evaluation.
+         * When interpolating, it is evaluated ahead by the frames until the next evaluation and the pose moves from the displayed pose towards the evaluated one,
+         * reaching it at the time it was evaluated for. The motion extracted by an evaluation is spread over the frames until the next one.
+         * Skin attachments and actor instances that are played back by the recorder are always evaluated.
+         * @param timePassedInSeconds The time passed in seconds, since the last frame or update.
+         * @param updateJointTransforms When set to true the joint transformations will be calculated by calculating the animation graph output for example.
+         * @param sampleMotions When set to true motions will be sampled, or whole anim graphs if using those.
+         * @param updateInterval The number of frames between evaluations, where 1 means every frame.
+         * @param evaluate Set to true to evaluate the anim graph or motion system this frame.
+         * @param interpolatePoses Set to true to interpolate the pose on frames that aren't evaluated, otherwise the last evaluated pose is kept.
+         * @result Returns true when the anim graph or motion system got evaluated.
+         */
+        bool UpdateTransformationsWithLOD(float timePassedInSeconds, bool updateJointTransforms, bool sampleMotions, uint32 updateInterval, bool evaluate, bool interpolatePoses);
+
+        /**
+         * Enable or disable the optional anim graph nodes, like IK, look-at and simulated objects, which then act as pass-through nodes.
+         * This is controlled by the update LOD of the actor update scheduler.
+         * @param enabled Set to false to skip the optional nodes.
+         */
+        void SetOptionalAnimGraphNodesEnabled(bool enabled);
+        bool GetOptionalAnimGraphNodesEnabled() const;
+
         /**
          * Update/Process the mesh deformers.
          * This will apply skinning and morphing deformations to the meshes used by the actor instance.
@@ -792,6 +817,20 @@ namespace EMotionFX
         void SetIsOwnedByRuntime(bool isOwnedByRuntime);
         bool GetIsOwnedByRuntime() const;
 
+        /**
+         * Enable or disable position only skinning for this actor instance.
+         * When enabled the software skinning deformers only skin the vertex positions, while normals, tangents and bitangents keep their original values.
+         * This is enabled automatically for actor instances that are not rendered, such as on dedicated servers, where the skinned meshes are only used for things like hit detection.
+         * @param positionsOnly Set to true to only skin positions, false to skin all vertex data (default).
+         */
+        void SetSkinPositionsOnly(bool positionsOnly);
+
+        /**
+         * Check whether the software skinning deformers only skin the vertex positions of this actor instance.
+         * @result Returns true when normals, tangents and bitangents are not skinned, otherwise false.
+         */
+        bool GetSkinPositionsOnly() const;
+
         /**
          * Enable a specific node.
          * This will activate motion sampling, transformation and blending calculations for the given node.
@@ -913,6 +952,16 @@ namespace EMotionFX
         float                   mBoundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   mMotionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   mMotionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        float                   m_updateLODTimePassed;  /**< The time passed since the last update LOD evaluation. */
+        float                   m_updateLODLeadTime;    /**< The time the anim graph or motion system was evaluated ahead of the actor instance. */
+        uint32                  m_updateLODFrame;       /**< The number of frames since the last update LOD evaluation. */
+        AZ::Vector3             m_updateLODMotionPosition; /**< The extracted motion translation that still has to be applied over the next frames. */
+        AZ::Quaternion          m_updateLODMotionRotation; /**< The extracted motion rotation that still has to be applied over the next frames. */
+        uint32                  m_updateLODMotionFrames; /**< The number of frames to spread the remaining extracted motion over. */
+        AZStd::unique_ptr<Pose> m_updateLODFromPose;    /**< The pose displayed when the update LOD last evaluated, which we interpolate from. */
+        AZStd::unique_ptr<Pose> m_updateLODToPose;      /**< The last pose evaluated with update LOD, which we interpolate towards. */
+        bool                    m_hasUpdateLODPoses;    /**< Are the update LOD poses valid to interpolate between? */
+        bool                    m_optionalAnimGraphNodesEnabled; /**< Are the optional anim graph nodes evaluated? */
         float                   mVisualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         uint32                  mLODLevel;              /**< The current LOD level, where 0 is the highest detail. */
         uint32                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -922,6 +971,7 @@ namespace EMotionFX
         EBoundsType             mBoundsUpdateType;      /**< The bounds update type (node based, mesh based or colliison mesh based). */
         uint8                   mNumAttachmentRefs;     /**< Specifies how many actor instances use this actor instance as attachment. */
         uint8                   mBoolFlags;             /**< Boolean flags. */
+        bool                    m_skinPositionsOnly = false; /**< Only skin vertex positions in the software skinning deformers? */
 
         /**
          * Boolean masks, as replacement for having several bools as members.
@@ -1032,5 +1082,24 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /**
+         * Interpolate the update LOD poses into the current pose and update the skinning matrices and attachments from it.
+         * @param weight The interpolation weight, where 0 is the from pose and 1 the to pose.
+         */
+        void ApplyUpdateLODPose(float weight);
+
+        /**
+         * Take the time passed since the last update LOD evaluation, to evaluate the anim graph or motion system with.
+         * @param leadTime The time the evaluation should run ahead of the actor instance.
+         * @result The time to evaluate the anim graph or motion system with, which is never negative.
+         */
+        float ConsumeUpdateLODTime(float leadTime);
+
+        /**
+         * Apply a part of the extracted motion that is spread over the frames between update LOD evaluations.
+         * @param numFrames The number of frames to apply the motion of, out of the remaining frames.
+         */
+        void ApplyUpdateLODMotion(uint32 numFrames);
     };
 }   // namespace EMotionFX
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "ActorUpdateScheduler.h"
+#include "ActorInstance.h"
+#include <AzCore/std/chrono/clocks.h>
+
+
+namespace EMotionFX
+{
+    void ActorUpdateScheduler::SetUpdateLODSettings(const UpdateLODSettings& settings)
+    {
+        AZ_Warning("EMotionFX", settings.m_buckets.size() <= s_maxNumUpdateLODBuckets,
+            "Too many update LOD buckets (%zu), only the first %u will be used.", settings.m_buckets.size(), s_maxNumUpdateLODBuckets);
+
+        m_updateLODSettings = settings;
+        if (m_updateLODSettings.m_buckets.size() > s_maxNumUpdateLODBuckets)
+        {
+            m_updateLODSettings.m_buckets.resize(s_maxNumUpdateLODBuckets);
+        }
+
+        for (UpdateLODCounters& counters : m_updateLODCounters)
+        {
+            counters.m_numActorInstances.SetValue(0);
+            counters.m_numEvaluated.SetValue(0);
+            counters.m_updateTimeInMicroseconds.SetValue(0);
+        }
+    }
+
+
+    UpdateLODStats ActorUpdateScheduler::GetUpdateLODStats(uint32 bucketIndex) const
+    {
+        UpdateLODStats stats;
+        if (bucketIndex >= GetNumUpdateLODBuckets())
+        {
+            return stats;
+        }
+
+        const UpdateLODCounters& counters = m_updateLODCounters[bucketIndex];
+        stats.m_numActorInstances = counters.m_numActorInstances.GetValue();
+        stats.m_numEvaluated = counters.m_numEvaluated.GetValue();
+        stats.m_updateTimeInMs = static_cast<float>(counters.m_updateTimeInMicroseconds.GetValue()) * 0.001f;
+        return stats;
+    }
+
+
+    void ActorUpdateScheduler::BeginExecute()
+    {
+        mNumUpdated.SetValue(0);
+        mNumVisible.SetValue(0);
+        mNumSampled.SetValue(0);
+
+        for (UpdateLODCounters& counters : m_updateLODCounters)
+        {
+            counters.m_numActorInstances.SetValue(0);
+            counters.m_numEvaluated.SetValue(0);
+            counters.m_updateTimeInMicroseconds.SetValue(0);
+        }
+
+        m_updateLODFrame++;
+    }
+
+
+    uint32 ActorUpdateScheduler::FindUpdateLODBucket(const ActorInstance* actorInstance) const
+    {
+        const uint32 numBuckets = static_cast<uint32>(m_updateLODSettings.m_buckets.size());
+        if (!actorInstance->GetIsVisible() || numBuckets == 0)
+        {
+            return numBuckets;
+        }
+
+        const float distanceSq = actorInstance->GetWorldSpaceTransform().mPosition.GetDistanceSq(m_updateLODReferencePoint);
+        for (uint32 i = 0; i < numBuckets; ++i)
+        {
+            const float maxDistance = m_updateLODSettings.m_buckets[i].m_maxDistance;
+            if (distanceSq <= maxDistance * maxDistance)
+            {
+                return i;
+            }
+        }
+
+        return numBuckets - 1;
+    }
+
+
+    void ActorUpdateScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        mNumUpdated.Increment();
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            mNumVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                mNumSampled.Increment();
+            }
+        }
+
+        if (!m_updateLODSettings.m_enabled)
+        {
+            // An update interval of one evaluates every frame, after finishing what an earlier update LOD left in progress.
+            actorInstance->SetOptionalAnimGraphNodesEnabled(true);
+            actorInstance->UpdateTransformationsWithLOD(timePassedInSeconds, isVisible, sampleMotions, 1, true, false);
+            return;
+        }
+
+        const uint32 bucketIndex = FindUpdateLODBucket(actorInstance);
+        const UpdateLODBucket& bucket = (bucketIndex < m_updateLODSettings.m_buckets.size()) ? m_updateLODSettings.m_buckets[bucketIndex] : m_updateLODSettings.m_invisibleBucket;
+        const uint32 updateInterval = AZStd::max<uint32>(bucket.m_updateInterval, 1);
+
+        // Offset the frame by the actor instance id, so that the actor instances inside a bucket don't all evaluate on the same frame.
+        const bool evaluate = ((m_updateLODFrame + actorInstance->GetID()) % updateInterval) == 0;
+
+        const AZStd::chrono::high_resolution_clock::time_point startTime = AZStd::chrono::high_resolution_clock::now();
+
+        actorInstance->SetOptionalAnimGraphNodesEnabled(bucket.m_optionalNodesEnabled);
+        const bool evaluated = actorInstance->UpdateTransformationsWithLOD(timePassedInSeconds, isVisible, sampleMotions, updateInterval, evaluate, m_updateLODSettings.m_interpolatePoses);
+
+        const AZStd::chrono::microseconds updateTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - startTime);
+
+        UpdateLODCounters& counters = m_updateLODCounters[bucketIndex];
+        counters.m_numActorInstances.Increment();
+        if (evaluated)
+        {
+            counters.m_numEvaluated.Increment();
+        }
+        counters.m_updateTimeInMicroseconds.Add(static_cast<uint32>(updateTime.count()));
+    }
+}   // namespace EMotionFX
@@ -10,6 +10,10 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "BaseObject.h"
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <MCore/Source/MultiThreadManager.h>
 
 
 namespace EMotionFX
@@ -19,6 +23,41 @@ namespace EMotionFX
     class ActorManager;
 
 
+    /**
+     * An update LOD bucket, which specifies how often the actor instances inside it evaluate their anim graph or motion system.
+     */
+    struct EMFX_API UpdateLODBucket
+    {
+        float   m_maxDistance = 0.0f;           /**< Visible actor instances up to this distance from the reference point fall in this bucket. */
+        uint32  m_updateInterval = 1;           /**< Evaluate every Nth frame, where 1 means every frame. */
+        bool    m_optionalNodesEnabled = true;  /**< Evaluate optional anim graph nodes, like IK, look-at and simulated objects? */
+    };
+
+    /**
+     * The update LOD settings of the actor update scheduler.
+     * Visible actor instances are placed in the first bucket whose max distance they are within, or the last bucket if they are further away.
+     * Invisible actor instances are placed in the invisible bucket. Actor instances that skip a frame have their pose interpolated
+     * towards a pose evaluated ahead of time, and the motion extracted by an evaluation is spread over the skipped frames.
+     */
+    struct EMFX_API UpdateLODSettings
+    {
+        AZStd::vector<UpdateLODBucket>  m_buckets;                      /**< The buckets for visible actor instances, sorted on increasing max distance. */
+        UpdateLODBucket                 m_invisibleBucket{ 0.0f, 4, false }; /**< The bucket for actor instances that aren't visible. */
+        bool                            m_enabled = false;              /**< When disabled, all actor instances are evaluated every frame. */
+        bool                            m_interpolatePoses = true;      /**< Interpolate poses in the frames an actor instance doesn't evaluate? */
+    };
+
+    /**
+     * The statistics of a single update LOD bucket, for the last executed frame.
+     */
+    struct EMFX_API UpdateLODStats
+    {
+        uint32  m_numActorInstances = 0;        /**< The number of actor instances in the bucket. */
+        uint32  m_numEvaluated = 0;             /**< The number of those that evaluated their anim graph or motion system. */
+        float   m_updateTimeInMs = 0.0f;        /**< The time spent updating the actor instances in the bucket, summed over all threads. */
+    };
+
+
     /**
      * The actor update scheduler base class.
      * This class is responsible for updating the transformations of all actor instances, in the right order.
@@ -83,6 +122,36 @@ namespace EMotionFX
         uint32 GetNumVisibleActorInstances() const                  { return mNumVisible.GetValue(); }
         uint32 GetNumSampledActorInstances() const                  { return mNumSampled.GetValue(); }
 
+        /**
+         * Set the update LOD settings. This should not be called while the schedule executes.
+         * @param settings The new settings. The number of buckets for visible actor instances is limited to s_maxNumUpdateLODBuckets.
+         */
+        void SetUpdateLODSettings(const UpdateLODSettings& settings);
+        const UpdateLODSettings& GetUpdateLODSettings() const       { return m_updateLODSettings; }
+
+        /**
+         * Set the point the update LOD distances are measured from, which usually is the camera position.
+         * The EMotion FX system component sets this to the active camera position every tick.
+         * @param referencePoint The reference point, in world space.
+         */
+        void SetUpdateLODReferencePoint(const AZ::Vector3& referencePoint) { m_updateLODReferencePoint = referencePoint; }
+        const AZ::Vector3& GetUpdateLODReferencePoint() const       { return m_updateLODReferencePoint; }
+
+        /**
+         * Get the number of update LOD buckets, which are the buckets for visible actor instances followed by the invisible bucket.
+         * @result The number of update LOD buckets.
+         */
+        uint32 GetNumUpdateLODBuckets() const                       { return static_cast<uint32>(m_updateLODSettings.m_buckets.size()) + 1; }
+
+        /**
+         * Get the statistics of an update LOD bucket for the last executed frame.
+         * @param bucketIndex The bucket index, in range of [0..GetNumUpdateLODBuckets()-1].
+         * @result The bucket statistics.
+         */
+        UpdateLODStats GetUpdateLODStats(uint32 bucketIndex) const;
+
+        static constexpr uint32 s_maxNumUpdateLODBuckets = 8;
+
     protected:
         MCore::AtomicUInt32 mNumUpdated;
         MCore::AtomicUInt32 mNumVisible;
@@ -94,9 +163,42 @@ namespace EMotionFX
         ActorUpdateScheduler()
             : BaseObject()   {}
 
+        /**
+         * Reset the statistics and advance the update LOD frame. Call this at the start of Execute().
+         */
+        void BeginExecute();
+
+        /**
+         * Update a single actor instance, taking the motion sampling rate and the update LOD into account.
+         * This is safe to call for several actor instances in parallel.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds);
+
+        /**
+         * Find the update LOD bucket an actor instance falls in.
+         * @param actorInstance The actor instance.
+         * @result The bucket index, in range of [0..GetNumUpdateLODBuckets()-1].
+         */
+        uint32 FindUpdateLODBucket(const ActorInstance* actorInstance) const;
+
         /**
          * The destructor.
          */
         virtual ~ActorUpdateScheduler() {}
+
+    private:
+        struct UpdateLODCounters
+        {
+            MCore::AtomicUInt32 m_numActorInstances;
+            MCore::AtomicUInt32 m_numEvaluated;
+            MCore::AtomicUInt32 m_updateTimeInMicroseconds;
+        };
+
+        UpdateLODSettings   m_updateLODSettings;
+        AZ::Vector3         m_updateLODReferencePoint = AZ::Vector3::CreateZero();
+        uint32              m_updateLODFrame = 0;
+        AZStd::array<UpdateLODCounters, s_maxNumUpdateLODBuckets + 1> m_updateLODCounters;
     };
 }   // namespace EMotionFX
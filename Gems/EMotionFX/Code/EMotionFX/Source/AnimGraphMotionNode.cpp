@@ -392,15 +392,20 @@ namespace EMotionFX
 
     // the main process method of the final node
     void AnimGraphMotionNode::Output(AnimGraphInstance* animGraphInstance)
+    {
+        // request poses to use from the pool, so that all output pose ports have a valid pose to output to we reuse them using a pool system to save memory
+        RequestPoses(animGraphInstance);
+        OutputPose(animGraphInstance, *GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue());
+    }
+
+
+    void AnimGraphMotionNode::OutputPose(AnimGraphInstance* animGraphInstance, AnimGraphPose& outputPose)
     {
         // if this motion is disabled, output the bind pose
+        ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
         if (mDisabled)
         {
-            // request poses to use from the pool, so that all output pose ports have a valid pose to output to we reuse them using a pool system to save memory
-            RequestPoses(animGraphInstance);
-            AnimGraphPose* outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
-            ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
-            outputPose->InitFromBindPose(actorInstance);
+            outputPose.InitFromBindPose(actorInstance);
             return;
         }
 
@@ -412,7 +417,6 @@ namespace EMotionFX
         }
 
         // create and register the motion instance when this is the first time its being when it hasn't been registered yet
-        ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
         MotionInstance* motionInstance = nullptr;
         UniqueData* uniqueData = static_cast<UniqueData*>(FindOrCreateUniqueNodeData(animGraphInstance));
         if (uniqueData->mReload)
@@ -430,10 +434,7 @@ namespace EMotionFX
 
         if (motionInstance == nullptr)
         {
-            // request poses to use from the pool, so that all output pose ports have a valid pose to output to we reuse them using a pool system to save memory
-            RequestPoses(animGraphInstance);
-            AnimGraphPose* outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
-            outputPose->InitFromBindPose(actorInstance);
+            outputPose.InitFromBindPose(actorInstance);
 
             if (GetEMotionFX().GetIsInEditorMode())
             {
@@ -453,13 +454,10 @@ namespace EMotionFX
             OutputIncomingNode(animGraphInstance, inPlaceConnection->GetSourceNode());
         }
 
-        // request poses to use from the pool, so that all output pose ports have a valid pose to output to we reuse them using a pool system to save memory
-        RequestPoses(animGraphInstance);
-        AnimGraphPose* outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
-        Pose& outputTransformPose = outputPose->GetPose();
+        Pose& outputTransformPose = outputPose.GetPose();
 
         // fill the output with the bind pose
-        outputPose->InitFromBindPose(actorInstance); // TODO: is this really needed?
+        outputPose.InitFromBindPose(actorInstance); // TODO: is this really needed?
 
         // we use as input pose the same as the output, as this blend tree node takes no input
         motionInstance->GetMotion()->Update(&outputTransformPose, &outputTransformPose, motionInstance);
@@ -476,7 +474,7 @@ namespace EMotionFX
         // visualize it
         if (GetEMotionFX().GetIsInEditorMode() && GetCanVisualize(animGraphInstance))
         {
-            actorInstance->DrawSkeleton(outputPose->GetPose(), mVisualizeColor);
+            actorInstance->DrawSkeleton(outputTransformPose, mVisualizeColor);
         }
     }
 
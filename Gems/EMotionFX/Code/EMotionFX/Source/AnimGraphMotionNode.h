@@ -102,6 +102,14 @@ namespace EMotionFX
 
         AnimGraphPose* GetMainOutputPose(AnimGraphInstance* animGraphInstance) const override             { return GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue(); }
 
+        /**
+         * Sample the motion into the given pose, which is what the output of this node does with its own output pose.
+         * Used by the anim graph program to write the motion straight into the pose slot of the instruction compiled from this node.
+         * @param animGraphInstance The anim graph instance to output.
+         * @param outputPose The pose to sample the motion into.
+         */
+        void OutputPose(AnimGraphInstance* animGraphInstance, AnimGraphPose& outputPose);
+
         void SetCurrentPlayTime(AnimGraphInstance* animGraphInstance, float timeInSeconds) override;
         void Rewind(AnimGraphInstance* animGraphInstance) override;
 
@@ -189,6 +189,10 @@ namespace EMotionFX
             mConnections.push_back(connection);
             mInputPorts[targetPort].mConnection = connection;
             sourceNode->mOutputPorts[sourcePort].mConnection = connection;
+            if (mParentNode)
+            {
+                mParentNode->OnChildConnectionsChanged();
+            }
             return connection;
         }
         return nullptr;
@@ -199,6 +203,10 @@ namespace EMotionFX
     {
         BlendTreeConnection* connection = aznew BlendTreeConnection(sourceNode, sourcePort, targetPort);
         mConnections.push_back(connection);
+        if (mParentNode)
+        {
+            mParentNode->OnChildConnectionsChanged();
+        }
         return connection;
     }
 
@@ -473,6 +481,11 @@ namespace EMotionFX
         {
             delete connection;
         }
+
+        if (mParentNode)
+        {
+            mParentNode->OnChildConnectionsChanged();
+        }
     }
 
 
@@ -512,6 +525,11 @@ namespace EMotionFX
                 }
 
                 mConnections.erase(mConnections.begin() + i);
+
+                if (mParentNode)
+                {
+                    mParentNode->OnChildConnectionsChanged();
+                }
             }
         }
 
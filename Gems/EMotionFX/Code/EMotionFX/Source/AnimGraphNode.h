@@ -187,6 +187,11 @@ namespace EMotionFX
 
         void OnRemoveNode(AnimGraph* animGraph, AnimGraphNode* nodeToRemove) override;
 
+        /**
+         * Called when a connection got added to or removed from one of the child nodes.
+         */
+        virtual void OnChildConnectionsChanged()                        {}
+
         void PerformOutput(AnimGraphInstance* animGraphInstance);
         void PerformTopDownUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds);
         void PerformUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds);
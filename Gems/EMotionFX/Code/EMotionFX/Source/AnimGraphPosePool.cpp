@@ -8,6 +8,8 @@
 // include required headers
 #include "AnimGraphPosePool.h"
 #include "AnimGraphPose.h"
+#include "ActorInstance.h"
+#include "SoAPose.h"
 
 
 namespace EMotionFX
@@ -17,6 +19,8 @@ namespace EMotionFX
     {
         mPoses.SetMemoryCategory(EMFX_MEMCATEGORY_ANIMGRAPH_POSEPOOL);
         mFreePoses.SetMemoryCategory(EMFX_MEMCATEGORY_ANIMGRAPH_POSEPOOL);
+        mSoAPoses.SetMemoryCategory(EMFX_MEMCATEGORY_ANIMGRAPH_POSEPOOL);
+        mFreeSoAPoses.SetMemoryCategory(EMFX_MEMCATEGORY_ANIMGRAPH_POSEPOOL);
         mPoses.Reserve(12);
         mFreePoses.Reserve(12);
         Resize(8);
@@ -37,6 +41,15 @@ namespace EMotionFX
 
         // clear the free array
         mFreePoses.Clear();
+
+        // delete all SoA poses
+        const uint32 numSoAPoses = mSoAPoses.GetLength();
+        for (uint32 i = 0; i < numSoAPoses; ++i)
+        {
+            delete mSoAPoses[i];
+        }
+        mSoAPoses.Clear();
+        mFreeSoAPoses.Clear();
     }
 
 
@@ -105,6 +118,34 @@ namespace EMotionFX
     }
 
 
+    // request a SoA pose
+    SoAPose* AnimGraphPosePool::RequestSoAPose(const ActorInstance* actorInstance)
+    {
+        SoAPose* pose = nullptr;
+        if (mFreeSoAPoses.GetLength() == 0)
+        {
+            pose = new SoAPose();
+            mSoAPoses.Add(pose);
+        }
+        else
+        {
+            pose = mFreeSoAPoses[mFreeSoAPoses.GetLength() - 1];
+            mFreeSoAPoses.RemoveLast();
+        }
+
+        // relinking to the same actor keeps the hierarchy schedule, so reusing poses across frames is cheap
+        pose->LinkToActor(actorInstance->GetActor());
+        return pose;
+    }
+
+
+    // free the SoA pose again
+    void AnimGraphPosePool::FreeSoAPose(SoAPose* pose)
+    {
+        mFreeSoAPoses.Add(pose);
+    }
+
+
     // free all poses
     void AnimGraphPosePool::FreeAllPoses()
     {
@@ -117,5 +158,13 @@ namespace EMotionFX
                 FreePose(curPose);
             }
         }
+
+        // all SoA poses are free again
+        mFreeSoAPoses.Clear(false);
+        const uint32 numSoAPoses = mSoAPoses.GetLength();
+        for (uint32 i = 0; i < numSoAPoses; ++i)
+        {
+            mFreeSoAPoses.Add(mSoAPoses[i]);
+        }
     }
 }   // namespace EMotionFX
@@ -18,6 +18,7 @@ namespace EMotionFX
     // forward declarations
     class AnimGraphPose;
     class ActorInstance;
+    class SoAPose;
 
 
     /**
@@ -40,15 +41,29 @@ namespace EMotionFX
 
         void FreeAllPoses();
 
+        /**
+         * Request a structure of arrays pose, used by the SIMD blend paths.
+         * The pose is linked to the actor of the given actor instance, but its transforms are not initialized.
+         * SoA poses are returned to the pool by FreeSoAPose or FreeAllPoses.
+         * @param actorInstance The actor instance to link the pose to.
+         * @result The pose.
+         */
+        SoAPose* RequestSoAPose(const ActorInstance* actorInstance);
+        void FreeSoAPose(SoAPose* pose);
+
         MCORE_INLINE uint32 GetNumFreePoses() const             { return mFreePoses.GetLength(); }
         MCORE_INLINE uint32 GetNumPoses() const                 { return mPoses.GetLength(); }
         MCORE_INLINE uint32 GetNumUsedPoses() const             { return (mPoses.GetLength() - mFreePoses.GetLength()); }
         MCORE_INLINE uint32 GetNumMaxUsedPoses() const          { return mMaxUsed; }
         MCORE_INLINE void ResetMaxUsedPoses()                   { mMaxUsed = 0; }
+        MCORE_INLINE uint32 GetNumFreeSoAPoses() const          { return mFreeSoAPoses.GetLength(); }
+        MCORE_INLINE uint32 GetNumSoAPoses() const              { return mSoAPoses.GetLength(); }
 
     private:
         MCore::Array<AnimGraphPose*>   mPoses;
         MCore::Array<AnimGraphPose*>   mFreePoses;
+        MCore::Array<SoAPose*>         mSoAPoses;
+        MCore::Array<SoAPose*>         mFreeSoAPoses;
         uint32                         mMaxUsed;
     };
 }   // namespace EMotionFX
@@ -0,0 +1,610 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include "EMotionFXConfig.h"
+#include "AnimGraphProgram.h"
+#include "ActorInstance.h"
+#include "AnimGraphBindPoseNode.h"
+#include "AnimGraphInstance.h"
+#include "AnimGraphMotionNode.h"
+#include "AnimGraphPose.h"
+#include "AnimGraphPosePool.h"
+#include "BlendTree.h"
+#include "BlendTreeBlend2Node.h"
+#include "BlendTreeBlendNNode.h"
+#include "BlendTreeFinalNode.h"
+#include "EMotionFXManager.h"
+#include "Pose.h"
+#include "ThreadData.h"
+#include "Transform.h"
+
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // Only exact types are compiled, so that nodes inheriting from them keep their own output implementation.
+        bool IsCompilable(const AnimGraphNode* node)
+        {
+            const AZ::TypeId typeId = azrtti_typeid(node);
+            return typeId == azrtti_typeid<BlendTreeBlend2Node>() ||
+                   typeId == azrtti_typeid<BlendTreeBlendNNode>() ||
+                   typeId == azrtti_typeid<AnimGraphBindPoseNode>() ||
+                   typeId == azrtti_typeid<AnimGraphMotionNode>() ||
+                   typeId == azrtti_typeid<BlendTreeFinalNode>();
+        }
+
+        uint8 FindOperandIndex(const AnimGraphProgram::Instruction& instruction, const AnimGraphNode* node)
+        {
+            return (instruction.mOperands[0].mNode == node) ? 0 : 1;
+        }
+
+        bool IsWeightInput(const AnimGraphNode* targetNode, const BlendTreeConnection* connection)
+        {
+            const AZ::TypeId typeId = azrtti_typeid(targetNode);
+            return (typeId == azrtti_typeid<BlendTreeBlend2Node>() && connection->GetTargetPort() == BlendTreeBlend2Node::INPUTPORT_WEIGHT) ||
+                   (typeId == azrtti_typeid<BlendTreeBlendNNode>() && connection->GetTargetPort() == BlendTreeBlendNNode::INPUTPORT_WEIGHT);
+        }
+    }
+
+
+    AnimGraphProgram::AnimGraphProgram()
+        : mNumSlots(0)
+    {
+    }
+
+
+    AnimGraphProgram* AnimGraphProgram::Compile(const BlendTree* blendTree)
+    {
+        AnimGraphNode* rootNode = blendTree->GetRealFinalNode();
+        if (!rootNode || !IsCompilable(rootNode))
+        {
+            return nullptr;
+        }
+
+        // Sort the nodes that are reachable from the root node, so that every node comes after the nodes it depends on.
+        AZStd::vector<AnimGraphNode*> sortedNodes;
+        AZStd::unordered_map<const AnimGraphNode*, bool> visitedNodes; // The value is true once all inputs of the node got visited.
+        AZStd::vector<AZStd::pair<AnimGraphNode*, uint32>> stack;
+        stack.emplace_back(rootNode, 0);
+        visitedNodes.emplace(rootNode, false);
+        while (!stack.empty())
+        {
+            AnimGraphNode* node = stack.back().first;
+            const uint32 connectionIndex = stack.back().second;
+            if (connectionIndex < node->GetNumConnections())
+            {
+                stack.back().second++;
+
+                AnimGraphNode* sourceNode = node->GetConnection(connectionIndex)->GetSourceNode();
+                if (!sourceNode)
+                {
+                    continue;
+                }
+
+                const auto visitedNode = visitedNodes.find(sourceNode);
+                if (visitedNode == visitedNodes.end())
+                {
+                    visitedNodes.emplace(sourceNode, false);
+                    stack.emplace_back(sourceNode, 0);
+                }
+                else if (!visitedNode->second)
+                {
+                    // The blend tree contains a cycle, leave it to the interpreter.
+                    return nullptr;
+                }
+                continue;
+            }
+
+            visitedNodes[node] = true;
+            sortedNodes.emplace_back(node);
+            stack.pop_back();
+        }
+
+        // A node can only be compiled when all nodes reading its output pose are compiled as well, as its output pose won't be stored inside the node.
+        // Iterate from the root towards the leaves, so that all consumers of a node are known before the node itself is processed.
+        AZStd::unordered_map<const AnimGraphNode*, AZStd::vector<const BlendTreeConnection*>> consumers;
+        for (const AnimGraphNode* node : sortedNodes)
+        {
+            const uint32 numConnections = node->GetNumConnections();
+            for (uint32 i = 0; i < numConnections; ++i)
+            {
+                const BlendTreeConnection* connection = node->GetConnection(i);
+                if (connection->GetSourceNode())
+                {
+                    consumers[connection->GetSourceNode()].emplace_back(connection);
+                }
+            }
+        }
+
+        AZStd::unordered_set<const AnimGraphNode*> compiledNodes;
+        AZStd::unordered_map<const BlendTreeConnection*, const AnimGraphNode*> connectionTargets;
+        for (const AnimGraphNode* node : sortedNodes)
+        {
+            const uint32 numConnections = node->GetNumConnections();
+            for (uint32 i = 0; i < numConnections; ++i)
+            {
+                connectionTargets.emplace(node->GetConnection(i), node);
+            }
+        }
+
+        uint32 numReplacedNodes = 0;
+        for (auto nodeIterator = sortedNodes.rbegin(); nodeIterator != sortedNodes.rend(); ++nodeIterator)
+        {
+            const AnimGraphNode* node = *nodeIterator;
+            if (!IsCompilable(node))
+            {
+                continue;
+            }
+
+            bool allConsumersCompiled = true;
+            for (const BlendTreeConnection* connection : consumers[node])
+            {
+                const AnimGraphNode* targetNode = connectionTargets[connection];
+                if (IsWeightInput(targetNode, connection) || compiledNodes.find(targetNode) == compiledNodes.end())
+                {
+                    allConsumersCompiled = false;
+                    break;
+                }
+            }
+
+            if (node == rootNode || allConsumersCompiled)
+            {
+                compiledNodes.emplace(node);
+                if (azrtti_typeid(node) != azrtti_typeid<BlendTreeFinalNode>())
+                {
+                    numReplacedNodes++;
+                }
+            }
+        }
+
+        if (compiledNodes.find(rootNode) == compiledNodes.end() || numReplacedNodes == 0)
+        {
+            return nullptr;
+        }
+
+        // Emit the instructions in dependency order.
+        AnimGraphProgram* program = new AnimGraphProgram();
+        program->mInstructions.reserve(compiledNodes.size());
+        AZStd::unordered_map<const AnimGraphNode*, uint32> instructionIndices;
+        for (AnimGraphNode* node : sortedNodes)
+        {
+            if (compiledNodes.find(node) == compiledNodes.end())
+            {
+                continue;
+            }
+
+            Instruction instruction;
+            instruction.mNode = node;
+
+            const AZ::TypeId typeId = azrtti_typeid(node);
+            if (typeId == azrtti_typeid<BlendTreeBlend2Node>())
+            {
+                instruction.mOpCode = OPCODE_BLEND2;
+                instruction.mNumOperands = 2;
+                for (uint32 i = 0; i < 2; ++i)
+                {
+                    const BlendTreeConnection* connection = node->GetInputPort(BlendTreeBlend2Node::INPUTPORT_POSE_A + i).mConnection;
+                    instruction.mOperands[i].mNode = connection ? connection->GetSourceNode() : nullptr;
+                }
+            }
+            else if (typeId == azrtti_typeid<BlendTreeBlendNNode>())
+            {
+                instruction.mOpCode = OPCODE_BLENDN;
+                instruction.mNumOperands = MaxOperands;
+                for (uint32 i = 0; i < MaxOperands; ++i)
+                {
+                    const BlendTreeConnection* connection = node->GetInputPort(BlendTreeBlendNNode::INPUTPORT_POSE_0 + i).mConnection;
+                    instruction.mOperands[i].mNode = connection ? connection->GetSourceNode() : nullptr;
+                }
+            }
+            else if (typeId == azrtti_typeid<BlendTreeFinalNode>())
+            {
+                instruction.mOpCode = OPCODE_PASSTHROUGH;
+                instruction.mNumOperands = 1;
+                instruction.mOperands[0].mNode = (node->GetNumConnections() > 0) ? node->GetConnection(0)->GetSourceNode() : nullptr;
+            }
+            else if (typeId == azrtti_typeid<AnimGraphMotionNode>())
+            {
+                instruction.mOpCode = OPCODE_MOTION;
+            }
+            else
+            {
+                instruction.mOpCode = OPCODE_BINDPOSE;
+            }
+
+            for (uint32 i = 0; i < instruction.mNumOperands; ++i)
+            {
+                Operand& operand = instruction.mOperands[i];
+                const auto producer = instructionIndices.find(operand.mNode);
+                if (producer != instructionIndices.end())
+                {
+                    operand.mInstruction = producer->second;
+                }
+            }
+
+            instructionIndices.emplace(node, static_cast<uint32>(program->mInstructions.size()));
+            program->mInstructions.emplace_back(instruction);
+        }
+
+        program->AssignSlots();
+        return program;
+    }
+
+
+    // assign pose slots based on the lifetime of the instruction results
+    void AnimGraphProgram::AssignSlots()
+    {
+        const uint32 numInstructions = GetNumInstructions();
+
+        AZStd::vector<uint32> lastUses(numInstructions, MCORE_INVALIDINDEX32);
+        for (uint32 i = 0; i < numInstructions; ++i)
+        {
+            const Instruction& instruction = mInstructions[i];
+            for (uint32 j = 0; j < instruction.mNumOperands; ++j)
+            {
+                if (instruction.mOperands[j].mInstruction != MCORE_INVALIDINDEX32)
+                {
+                    lastUses[instruction.mOperands[j].mInstruction] = i;
+                }
+            }
+        }
+
+        mNumSlots = 0;
+        AZStd::vector<uint32> freeSlots;
+        AZStd::vector<uint32> releasedProducers;
+        for (uint32 i = 0; i < numInstructions; ++i)
+        {
+            Instruction& instruction = mInstructions[i];
+
+            // Collect the producers whose result is read for the last time by this instruction, once each.
+            releasedProducers.clear();
+            for (uint32 j = 0; j < instruction.mNumOperands; ++j)
+            {
+                const uint32 producer = instruction.mOperands[j].mInstruction;
+                if (producer != MCORE_INVALIDINDEX32 && lastUses[producer] == i &&
+                    AZStd::find(releasedProducers.begin(), releasedProducers.end(), producer) == releasedProducers.end())
+                {
+                    releasedProducers.emplace_back(producer);
+                }
+            }
+
+            // A blend two result is allowed to reuse the slot of its first operand, as that pose is copied into the result before anything
+            // is blended into it. Blend N picks its operands at runtime, so it never shares a slot with any of them.
+            // All other released slots are only freed after the result got its slot, as they are read while writing the result.
+            const uint32 first = instruction.mOperands[0].mInstruction;
+            bool firstReleased = false;
+            if (instruction.mOpCode != OPCODE_BLENDN && first != MCORE_INVALIDINDEX32 && lastUses[first] == i)
+            {
+                firstReleased = true;
+                for (uint32 j = 1; j < instruction.mNumOperands; ++j)
+                {
+                    firstReleased &= (instruction.mOperands[j].mInstruction != first);
+                }
+                if (firstReleased)
+                {
+                    freeSlots.emplace_back(mInstructions[first].mResultSlot);
+                }
+            }
+
+            if (i == numInstructions - 1)
+            {
+                instruction.mResultSlot = MCORE_INVALIDINDEX32;
+            }
+            else if (!freeSlots.empty())
+            {
+                instruction.mResultSlot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else
+            {
+                instruction.mResultSlot = mNumSlots++;
+            }
+
+            for (const uint32 producer : releasedProducers)
+            {
+                if (!firstReleased || producer != first)
+                {
+                    freeSlots.emplace_back(mInstructions[producer].mResultSlot);
+                }
+            }
+        }
+    }
+
+
+    bool AnimGraphProgram::GetIsCompiled(const AnimGraphNode* node) const
+    {
+        for (const Instruction& instruction : mInstructions)
+        {
+            if (instruction.mNode == node)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    // walk from the root towards the leaves and decide what each needed instruction has to do
+    void AnimGraphProgram::Demand(AnimGraphInstance* animGraphInstance, InstanceState& state) const
+    {
+        const uint32 numInstructions = GetNumInstructions();
+        state.mSteps.resize(numInstructions);
+        for (InstanceState::Step& step : state.mSteps)
+        {
+            step.mAction = InstanceState::ACTION_SKIP;
+        }
+
+        AZStd::vector<InstanceState::Step>& steps = state.mSteps;
+        steps[numInstructions - 1].mAction = InstanceState::ACTION_PENDING;
+        for (uint32 i = numInstructions; i-- > 0;)
+        {
+            InstanceState::Step& step = steps[i];
+            if (step.mAction == InstanceState::ACTION_SKIP)
+            {
+                continue;
+            }
+
+            const Instruction& instruction = mInstructions[i];
+            step.mAction = InstanceState::ACTION_BINDPOSE;
+            step.mFirst = 0;
+            step.mSecond = 0;
+            step.mWeight = 0.0f;
+
+            switch (instruction.mOpCode)
+            {
+            case OPCODE_PASSTHROUGH:
+            {
+                if (instruction.mOperands[0].mNode)
+                {
+                    step.mAction = InstanceState::ACTION_COPY;
+                }
+                break;
+            }
+
+            case OPCODE_BLEND2:
+            {
+                BlendTreeBlend2Node* blendNode = static_cast<BlendTreeBlend2Node*>(instruction.mNode);
+                if (!blendNode->GetIsEnabled())
+                {
+                    break;
+                }
+
+                AnimGraphNode* weightNode = blendNode->GetInputNode(BlendTreeBlend2Node::INPUTPORT_WEIGHT);
+                if (weightNode)
+                {
+                    weightNode->PerformOutput(animGraphInstance);
+                }
+
+                AnimGraphNode* nodeA;
+                AnimGraphNode* nodeB;
+                float weight;
+                blendNode->FindBlendNodes(animGraphInstance, &nodeA, &nodeB, &weight, false, true);
+                if (!nodeA)
+                {
+                    break;
+                }
+
+                const BlendTreeBlend2Node::UniqueData* uniqueData = static_cast<BlendTreeBlend2Node::UniqueData*>(blendNode->FindOrCreateUniqueNodeData(animGraphInstance));
+                const bool useMask = !uniqueData->mMask.empty();
+
+                step.mAction = InstanceState::ACTION_COPY;
+                step.mFirst = FindOperandIndex(instruction, nodeA);
+                if (!nodeB || weight < MCore::Math::epsilon)
+                {
+                    break;
+                }
+
+                step.mSecond = FindOperandIndex(instruction, nodeB);
+                step.mWeight = weight;
+                if (useMask)
+                {
+                    step.mAction = InstanceState::ACTION_BLEND_MASKED;
+                }
+                else if (weight < 1.0f - MCore::Math::epsilon)
+                {
+                    step.mAction = InstanceState::ACTION_BLEND;
+                }
+                else
+                {
+                    step.mFirst = step.mSecond;
+                }
+                break;
+            }
+
+            case OPCODE_BLENDN:
+            {
+                BlendTreeBlendNNode* blendNode = static_cast<BlendTreeBlendNNode*>(instruction.mNode);
+                if (!blendNode->GetIsEnabled() || !blendNode->HasRequiredInputs())
+                {
+                    break;
+                }
+
+                AnimGraphNode* weightNode = blendNode->GetInputNode(BlendTreeBlendNNode::INPUTPORT_WEIGHT);
+                if (weightNode)
+                {
+                    weightNode->PerformOutput(animGraphInstance);
+                }
+
+                AnimGraphNode* nodeA;
+                AnimGraphNode* nodeB;
+                uint32 poseIndexA;
+                uint32 poseIndexB;
+                float weight;
+                blendNode->FindBlendNodes(animGraphInstance, &nodeA, &nodeB, &poseIndexA, &poseIndexB, &weight);
+                if (!nodeA)
+                {
+                    break;
+                }
+
+                // The pose indices are the input ports, which are the operand indices as well.
+                step.mAction = InstanceState::ACTION_COPY;
+                step.mFirst = static_cast<uint8>(poseIndexA);
+                if (!nodeB || nodeA == nodeB || weight < MCore::Math::epsilon)
+                {
+                    break;
+                }
+
+                step.mSecond = static_cast<uint8>(poseIndexB);
+                step.mWeight = weight;
+                if (weight < 1.0f - MCore::Math::epsilon)
+                {
+                    step.mAction = InstanceState::ACTION_BLEND;
+                }
+                else
+                {
+                    step.mFirst = step.mSecond;
+                }
+                break;
+            }
+
+            case OPCODE_MOTION:
+            {
+                step.mAction = InstanceState::ACTION_MOTION;
+                break;
+            }
+
+            default:
+                break;
+            }
+
+            // Mark the compiled producers of the used operands as needed.
+            const bool usesFirst = (step.mAction != InstanceState::ACTION_BINDPOSE && step.mAction != InstanceState::ACTION_MOTION);
+            const bool usesSecond = (step.mAction == InstanceState::ACTION_BLEND || step.mAction == InstanceState::ACTION_BLEND_MASKED);
+            const uint32 firstProducer = instruction.mOperands[step.mFirst].mInstruction;
+            const uint32 secondProducer = instruction.mOperands[step.mSecond].mInstruction;
+            if (usesFirst && firstProducer != MCORE_INVALIDINDEX32)
+            {
+                steps[firstProducer].mAction = InstanceState::ACTION_PENDING;
+            }
+            if (usesSecond && secondProducer != MCORE_INVALIDINDEX32)
+            {
+                steps[secondProducer].mAction = InstanceState::ACTION_PENDING;
+            }
+        }
+    }
+
+
+    void AnimGraphProgram::Execute(AnimGraphInstance* animGraphInstance, InstanceState& state, AnimGraphPose* outputPose) const
+    {
+        Demand(animGraphInstance, state);
+
+        ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
+        AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(actorInstance->GetThreadIndex())->GetPosePool();
+        state.mSlotPoses.resize(mNumSlots);
+        for (AnimGraphPose*& slotPose : state.mSlotPoses)
+        {
+            slotPose = posePool.RequestPose(actorInstance);
+        }
+
+        const auto getResultPose = [this, &state, outputPose](uint32 instructionIndex)
+        {
+            const uint32 slot = mInstructions[instructionIndex].mResultSlot;
+            return (slot != MCORE_INVALIDINDEX32) ? state.mSlotPoses[slot] : outputPose;
+        };
+
+        // Interpreted nodes are output on demand, their poses are released when the instruction reading them frees its incoming poses.
+        const auto getOperandPose = [animGraphInstance, &getResultPose](const Operand& operand)
+        {
+            if (operand.mInstruction != MCORE_INVALIDINDEX32)
+            {
+                return getResultPose(operand.mInstruction);
+            }
+
+            operand.mNode->PerformOutput(animGraphInstance);
+            return operand.mNode->GetMainOutputPose(animGraphInstance);
+        };
+
+        const uint32 numInstructions = GetNumInstructions();
+        for (uint32 i = 0; i < numInstructions; ++i)
+        {
+            const InstanceState::Step& step = state.mSteps[i];
+            if (step.mAction == InstanceState::ACTION_SKIP)
+            {
+                continue;
+            }
+
+            const Instruction& instruction = mInstructions[i];
+            AnimGraphPose* resultPose = getResultPose(i);
+            switch (step.mAction)
+            {
+            case InstanceState::ACTION_BINDPOSE:
+            {
+                resultPose->InitFromBindPose(actorInstance);
+                break;
+            }
+
+            case InstanceState::ACTION_COPY:
+            {
+                const AnimGraphPose* pose = getOperandPose(instruction.mOperands[step.mFirst]);
+                if (pose != resultPose)
+                {
+                    *resultPose = *pose;
+                }
+                break;
+            }
+
+            case InstanceState::ACTION_BLEND:
+            {
+                const AnimGraphPose* poseA = getOperandPose(instruction.mOperands[step.mFirst]);
+                const AnimGraphPose* poseB = getOperandPose(instruction.mOperands[step.mSecond]);
+                AZ_Assert(poseB != resultPose || poseA == poseB, "The blend result overlaps with its second input pose.");
+                if (poseA != resultPose)
+                {
+                    *resultPose = *poseA;
+                }
+                BlendTreeBlend2Node::BlendPoses(animGraphInstance->GetActorInstance(), resultPose->GetPose(), poseB->GetPose(), step.mWeight);
+                break;
+            }
+
+            case InstanceState::ACTION_BLEND_MASKED:
+            {
+                const AnimGraphPose* poseA = getOperandPose(instruction.mOperands[step.mFirst]);
+                const AnimGraphPose* poseB = getOperandPose(instruction.mOperands[step.mSecond]);
+                if (poseA != resultPose)
+                {
+                    *resultPose = *poseA;
+                }
+
+                const BlendTreeBlend2Node::UniqueData* uniqueData = static_cast<BlendTreeBlend2Node::UniqueData*>(instruction.mNode->FindOrCreateUniqueNodeData(animGraphInstance));
+                const Pose& maskPose = poseB->GetPose();
+                Pose& outputLocalPose = resultPose->GetPose();
+                for (const uint32 jointIndex : uniqueData->mMask)
+                {
+                    Transform transform = outputLocalPose.GetLocalSpaceTransform(jointIndex);
+                    transform.Blend(maskPose.GetLocalSpaceTransform(jointIndex), step.mWeight);
+                    outputLocalPose.SetLocalSpaceTransform(jointIndex, transform);
+                }
+                break;
+            }
+
+            case InstanceState::ACTION_MOTION:
+            {
+                static_cast<AnimGraphMotionNode*>(instruction.mNode)->OutputPose(animGraphInstance, *resultPose);
+                break;
+            }
+
+            default:
+                break;
+            }
+
+            // Do what AnimGraphNode::PerformOutput does for the compiled node.
+            AnimGraphNode* node = instruction.mNode;
+            animGraphInstance->EnableObjectFlags(node->GetObjectIndex(), AnimGraphInstance::OBJECTFLAGS_OUTPUT_READY);
+            node->FreeIncomingPoses(animGraphInstance);
+        }
+
+        for (AnimGraphPose* slotPose : state.mSlotPoses)
+        {
+            posePool.FreePose(slotPose);
+        }
+    }
+}   // namespace EMotionFX
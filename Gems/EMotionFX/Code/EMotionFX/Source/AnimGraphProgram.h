@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "EMotionFXConfig.h"
+#include <AzCore/std/containers/vector.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class AnimGraphInstance;
+    class AnimGraphNode;
+    class AnimGraphPose;
+    class BlendTree;
+
+    /**
+     * A blend tree compiled into a flat list of instructions.
+     * The pose producing nodes that are reachable from the final node of a blend tree are sorted so that every node comes after its inputs.
+     * Bind pose, motion, blend two, blend N and final nodes are turned into instructions which write into pose slots that got assigned at compile time,
+     * based on the lifetime of their results. Motion nodes are the leaves of most blend trees, compiling them samples the motion straight into
+     * the slot of the blend reading it, instead of into a pose requested by the node that is then copied into the blend result.
+     * Nodes of any other type, such as nested state machines, keep being evaluated by the regular node output path,
+     * and their output pose is read when an instruction needs it.
+     * A program is immutable and shared by all anim graph instances. The per instance data is stored in an InstanceState.
+     * Output is performed in two passes over the instructions. The first pass goes from the final node to the leaves
+     * and decides, based on the blend weights, which instructions are needed. The second pass executes the needed instructions in order.
+     */
+    class EMFX_API AnimGraphProgram
+    {
+        MCORE_MEMORYOBJECTCATEGORY(AnimGraphProgram, EMFX_DEFAULT_ALIGNMENT, EMFX_MEMCATEGORY_ANIMGRAPH_BLENDTREES);
+
+    public:
+        enum EOpCode : uint8
+        {
+            OPCODE_BINDPOSE     = 0,    /**< Output the bind pose, compiled from an AnimGraphBindPoseNode. */
+            OPCODE_PASSTHROUGH  = 1,    /**< Output the first operand, compiled from a BlendTreeFinalNode. */
+            OPCODE_BLEND2       = 2,    /**< Blend the two operands, compiled from a BlendTreeBlend2Node. */
+            OPCODE_BLENDN       = 3,    /**< Blend the two operands picked by the weight, compiled from a BlendTreeBlendNNode. */
+            OPCODE_MOTION       = 4     /**< Sample the motion, compiled from an AnimGraphMotionNode. */
+        };
+
+        static constexpr uint32 MaxOperands = 10;  /**< The number of pose inputs of a BlendTreeBlendNNode. */
+
+        /**
+         * An input pose of an instruction.
+         * The pose is either the result of an earlier instruction or the main output pose of an interpreted node.
+         */
+        struct EMFX_API Operand
+        {
+            AnimGraphNode*  mNode = nullptr;                        /**< The connected source node, or nullptr when the port is not connected. */
+            uint32          mInstruction = MCORE_INVALIDINDEX32;    /**< The instruction producing the pose, or MCORE_INVALIDINDEX32 when the source node is interpreted. */
+        };
+
+        struct EMFX_API Instruction
+        {
+            AnimGraphNode*  mNode = nullptr;                        /**< The node this instruction got compiled from. */
+            Operand         mOperands[MaxOperands];                 /**< The pose inputs, indexed by input port. */
+            uint32          mResultSlot = MCORE_INVALIDINDEX32;     /**< The pose slot to write to, or MCORE_INVALIDINDEX32 for the output pose of the blend tree. */
+            uint8           mNumOperands = 0;                       /**< The number of pose inputs. Blend N uses ten, blend two two, pass through one, bind pose and motion none. */
+            EOpCode         mOpCode = OPCODE_BINDPOSE;
+        };
+
+        /**
+         * The per anim graph instance data, which is resized on demand when executing the program.
+         */
+        class EMFX_API InstanceState
+        {
+            friend class AnimGraphProgram;
+
+        public:
+            InstanceState() = default;
+
+        private:
+            enum EAction : uint8
+            {
+                ACTION_SKIP         = 0,
+                ACTION_BINDPOSE     = 1,
+                ACTION_COPY         = 2,
+                ACTION_BLEND        = 3,
+                ACTION_BLEND_MASKED = 4,
+                ACTION_MOTION       = 5,
+                ACTION_PENDING      = 6     /**< Needed, but not decided yet what to do. */
+            };
+
+            struct Step
+            {
+                float   mWeight = 0.0f;
+                uint8   mAction = ACTION_SKIP;
+                uint8   mFirst = 0;     /**< The operand index of the pose to start from. */
+                uint8   mSecond = 0;    /**< The operand index of the pose to blend into. */
+            };
+
+            AZStd::vector<Step>             mSteps;
+            AZStd::vector<AnimGraphPose*>   mSlotPoses;
+        };
+
+        /**
+         * Compile the given blend tree.
+         * @param blendTree The blend tree to compile.
+         * @result The compiled program, or nullptr in case the blend tree has no final node, its final node can't be compiled,
+         *         or compiling would not replace any node evaluation. The caller owns the program and has to delete it.
+         */
+        static AnimGraphProgram* Compile(const BlendTree* blendTree);
+
+        /**
+         * Output the final pose of the blend tree.
+         * This performs the output of the compiled nodes and of all interpreted nodes they depend on, including the reference counting
+         * of their poses, just like AnimGraphNode::PerformOutput would do.
+         * @param animGraphInstance The anim graph instance to output.
+         * @param state The program state of the given instance.
+         * @param outputPose The pose to write the final pose into.
+         */
+        void Execute(AnimGraphInstance* animGraphInstance, InstanceState& state, AnimGraphPose* outputPose) const;
+
+        MCORE_INLINE uint32 GetNumInstructions() const                          { return static_cast<uint32>(mInstructions.size()); }
+        MCORE_INLINE const Instruction& GetInstruction(uint32 index) const      { return mInstructions[index]; }
+        MCORE_INLINE uint32 GetNumSlots() const                                 { return mNumSlots; }
+        MCORE_INLINE AnimGraphNode* GetRootNode() const                         { return mInstructions.back().mNode; }
+        bool GetIsCompiled(const AnimGraphNode* node) const;
+
+    private:
+        AZStd::vector<Instruction>  mInstructions;  /**< The instructions, where the last one produces the final pose. */
+        uint32                      mNumSlots;      /**< The number of pose slots needed to execute the program. */
+
+        AnimGraphProgram();
+
+        void AssignSlots();
+        void Demand(AnimGraphInstance* animGraphInstance, InstanceState& state) const;
+    };
+}   // namespace EMotionFX
@@ -24,12 +24,21 @@
 namespace EMotionFX
 {
     AZ_CLASS_ALLOCATOR_IMPL(BlendTree, AnimGraphAllocator, 0)
+    AZ_CLASS_ALLOCATOR_IMPL(BlendTree::UniqueData, AnimGraphObjectUniqueDataAllocator, 0)
+
+    BlendTree::UniqueData::UniqueData(AnimGraphNode* node, AnimGraphInstance* animGraphInstance)
+        : AnimGraphNodeData(node, animGraphInstance)
+    {
+    }
+
 
     BlendTree::BlendTree()
         : AnimGraphNode()
         , m_finalNodeId(AnimGraphNodeId::InvalidId)
         , m_finalNode(nullptr)
         , mVirtualFinalNode(nullptr)
+        , mProgram(nullptr)
+        , mProgramEnabled(true)
     {
         // setup output ports
         InitOutputPorts(1);
@@ -40,12 +49,14 @@ namespace EMotionFX
     BlendTree::~BlendTree()
     {
         // NOTE: child nodes get removed by the base class already
+        ReleaseProgram();
     }
 
 
     void BlendTree::Reinit()
     {
         m_finalNode = nullptr;
+        ReleaseProgram();
 
         if (m_finalNodeId == AnimGraphNodeId::InvalidId)
         {
@@ -72,6 +83,39 @@ namespace EMotionFX
                 }
             }
         }
+
+        CompileProgram();
+    }
+
+
+    void BlendTree::CompileProgram()
+    {
+        ReleaseProgram();
+        if (mProgramEnabled)
+        {
+            mProgram = AnimGraphProgram::Compile(this);
+        }
+    }
+
+
+    void BlendTree::ReleaseProgram()
+    {
+        delete mProgram;
+        mProgram = nullptr;
+    }
+
+
+    void BlendTree::SetProgramEnabled(bool enabled)
+    {
+        mProgramEnabled = enabled;
+        CompileProgram();
+    }
+
+
+    // the connections changed, so the program might not match the blend tree anymore
+    void BlendTree::OnChildConnectionsChanged()
+    {
+        ReleaseProgram();
     }
 
 
@@ -135,7 +179,17 @@ namespace EMotionFX
 
         // output final node
         AnimGraphNode* finalNode = GetRealFinalNode();
-        if (finalNode)
+        if (mProgram && finalNode && !GetEMotionFX().GetIsInEditorMode())
+        {
+            RequestPoses(animGraphInstance);
+            outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
+
+            UniqueData* uniqueData = static_cast<UniqueData*>(FindOrCreateUniqueNodeData(animGraphInstance));
+            mProgram->Execute(animGraphInstance, uniqueData->mProgramState, outputPose);
+
+            finalNode->DecreaseRef(animGraphInstance);
+        }
+        else if (finalNode)
         {
             OutputIncomingNode(animGraphInstance, finalNode);
 
@@ -302,6 +356,8 @@ namespace EMotionFX
             m_finalNode = nullptr;
         }
 
+        ReleaseProgram();
+
         // call it for all children
         AnimGraphNode::OnRemoveNode(animGraph, nodeToRemove);
     }
@@ -310,6 +366,10 @@ namespace EMotionFX
     void BlendTree::SetVirtualFinalNode(AnimGraphNode* node)
     {
         mVirtualFinalNode = node;
+        if (mAnimGraph)
+        {
+            CompileProgram();
+        }
 
         AnimGraphNotificationBus::Broadcast(&AnimGraphNotificationBus::Events::OnVirtualFinalNodeSet, this);
     }
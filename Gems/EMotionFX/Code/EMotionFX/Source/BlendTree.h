@@ -10,6 +10,7 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "BlendTreeFinalNode.h"
+#include "AnimGraphProgram.h"
 
 
 namespace EMotionFX
@@ -42,6 +43,18 @@ namespace EMotionFX
             PORTID_OUTPUT_POSE = 0
         };
 
+        class EMFX_API UniqueData
+            : public AnimGraphNodeData
+        {
+        public:
+            AZ_CLASS_ALLOCATOR_DECL
+
+            UniqueData(AnimGraphNode* node, AnimGraphInstance* animGraphInstance);
+
+        public:
+            AnimGraphProgram::InstanceState mProgramState;
+        };
+
         BlendTree();
         ~BlendTree();
 
@@ -62,6 +75,20 @@ namespace EMotionFX
         void Rewind(AnimGraphInstance* animGraphInstance) override;
         bool GetHasOutputPose() const override                          { return true; }
 
+        AnimGraphObjectData* CreateUniqueData(AnimGraphInstance* animGraphInstance) override { return aznew UniqueData(this, animGraphInstance); }
+
+        /**
+         * Enable or disable the compiled program of this blend tree.
+         * When enabled, the blend tree gets compiled into an AnimGraphProgram when it is reinitialized, which is used to output the blend tree
+         * outside of the editor. Nodes that can't be compiled are still output by the regular node output path.
+         * Changing the connections inside the blend tree releases the program until the blend tree gets reinitialized again.
+         * @param enabled Set to true to use the compiled program, false to always use the regular node output path.
+         */
+        void SetProgramEnabled(bool enabled);
+        MCORE_INLINE bool GetProgramEnabled() const                     { return mProgramEnabled; }
+        MCORE_INLINE const AnimGraphProgram* GetProgram() const         { return mProgram; }
+        void OnChildConnectionsChanged() override;
+
         void SetVirtualFinalNode(AnimGraphNode* node);
         MCORE_INLINE AnimGraphNode* GetVirtualFinalNode() const         { return mVirtualFinalNode; }
 
@@ -100,6 +127,11 @@ namespace EMotionFX
         AZ::u64                 m_finalNodeId;      /**< Id of the final node that gets serialized. The final node represents the output of the blend tree. */
         BlendTreeFinalNode*     m_finalNode;        /**< The cached final node pointer based on the final node id. */
         AnimGraphNode*          mVirtualFinalNode;  /**< The virtual final node, which is the node who's output is used as final output. A value of nullptr means it will use the real mFinalNode. */
+        AnimGraphProgram*       mProgram;           /**< The compiled program shared by all anim graph instances, or nullptr when the nodes are output one by one. */
+        bool                    mProgramEnabled;    /**< Compile the blend tree into a program when reinitializing? */
+
+        void CompileProgram();
+        void ReleaseProgram();
 
         /**
         * Helper function that recursively (through incoming connections) detect cycles. The function performs a DFS to find back edges (connections to itself or to one of its ancestors).
@@ -18,6 +18,10 @@
 #include "TransformData.h"
 #include "Node.h"
 #include "AnimGraph.h"
+#include "AnimGraphPosePool.h"
+#include "EMotionFXManager.h"
+#include "SoAPose.h"
+#include "ThreadData.h"
 
 
 namespace EMotionFX
@@ -162,7 +166,7 @@ namespace EMotionFX
             RequestPoses(animGraphInstance);
             outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
             *outputPose = *nodeA->GetMainOutputPose(animGraphInstance);
-            outputPose->GetPose().Blend(&nodeB->GetMainOutputPose(animGraphInstance)->GetPose(), weight);
+            BlendPoses(actorInstance, outputPose->GetPose(), nodeB->GetMainOutputPose(animGraphInstance)->GetPose(), weight);
         }
         else
         {
@@ -174,6 +178,40 @@ namespace EMotionFX
     }
 
 
+    void BlendTreeBlend2Node::BlendPoses(const ActorInstance* actorInstance, Pose& inOutPose, const Pose& destPose, float weight)
+    {
+        const uint32 minJoints = GetEMotionFX().GetSoABlendMinJoints();
+        if (minJoints == 0 || inOutPose.GetNumTransforms() < minJoints)
+        {
+            inOutPose.Blend(&destPose, weight);
+            return;
+        }
+
+        AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(actorInstance->GetThreadIndex())->GetPosePool();
+        SoAPose* soaPose = posePool.RequestSoAPose(actorInstance);
+        SoAPose* soaDestPose = posePool.RequestSoAPose(actorInstance);
+        soaPose->InitFromPose(inOutPose);
+        soaDestPose->InitFromPose(destPose);
+        soaPose->Blend(*soaDestPose, weight);
+        soaPose->CopyToPose(inOutPose);
+        posePool.FreeSoAPose(soaDestPose);
+        posePool.FreeSoAPose(soaPose);
+
+        // The SoA poses only hold the joint transforms, blend the morph weights and pose datas like Pose::Blend does.
+        const uint32 numMorphs = inOutPose.GetNumMorphWeights();
+        AZ_Assert(numMorphs == destPose.GetNumMorphWeights(), "The poses have a different number of morph weights.");
+        for (uint32 i = 0; i < numMorphs; ++i)
+        {
+            inOutPose.SetMorphWeight(i, MCore::LinearInterpolate<float>(inOutPose.GetMorphWeight(i), destPose.GetMorphWeight(i), weight));
+        }
+
+        for (const auto& poseDataItem : inOutPose.GetPoseDatas())
+        {
+            poseDataItem.second->Blend(&destPose, weight);
+        }
+    }
+
+
     void BlendTreeBlend2Node::OutputFeathering(AnimGraphInstance* animGraphInstance, UniqueData* uniqueData)
     {
         AnimGraphPose* outputPose;
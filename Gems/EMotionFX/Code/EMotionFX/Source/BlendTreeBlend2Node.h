@@ -13,8 +13,10 @@
 
 namespace EMotionFX
 {
+    class ActorInstance;
     class AnimGraphPose;
     class AnimGraphInstance;
+    class Pose;
 
     class EMFX_API BlendTreeBlend2Node
         : public BlendTreeBlend2NodeBase
@@ -30,6 +32,17 @@ namespace EMotionFX
 
         static void Reflect(AZ::ReflectContext* context);
 
+        /**
+         * Blend a pose towards a destination pose, like Pose::Blend.
+         * Skeletons with at least EMotionFXManager::GetSoABlendMinJoints() joints are blended as SoA poses from the pose pool of the actor instance,
+         * which is disabled by default.
+         * @param actorInstance The actor instance both poses belong to.
+         * @param inOutPose The pose to blend, which receives the result.
+         * @param destPose The pose to blend into.
+         * @param weight The blend weight, where 0 keeps the pose and 1 results in the destination pose.
+         */
+        static void BlendPoses(const ActorInstance* actorInstance, Pose& inOutPose, const Pose& destPose, float weight);
+
     private:
         void Update(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
         void TopDownUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
@@ -12,6 +12,7 @@
 
 #include <MCore/Source/AzCoreConversions.h>
 
+#include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/AnimGraph.h>
 #include <EMotionFX/Source/BlendTreeFootIKNode.h>
 #include <EMotionFX/Source/Node.h>
@@ -846,8 +847,8 @@ namespace EMotionFX
             weight = MCore::Clamp<float>(weight, 0.0f, 1.0f);
         }
 
-        // If the weight is near zero or if this node is disabled or if the node is enable for server optimization, we can skip all calculations and just output the input pose.
-        if (weight < MCore::Math::epsilon || mDisabled || GetEMotionFX().GetEnableServerOptimization())
+        // If the weight is near zero or if this node is disabled or if the node is enable for server optimization or skipped by the update LOD, we can skip all calculations and just output the input pose.
+        if (weight < MCore::Math::epsilon || mDisabled || GetEMotionFX().GetEnableServerOptimization() || !animGraphInstance->GetActorInstance()->GetOptionalAnimGraphNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
@@ -129,8 +129,8 @@ namespace EMotionFX
             weight = MCore::Clamp<float>(weight, 0.0f, 1.0f);
         }
 
-        // if the weight is near zero, we can skip all calculations and act like a pass-trough node
-        if (weight < MCore::Math::epsilon || mDisabled)
+        // if the weight is near zero or the update LOD skips optional nodes, we can skip all calculations and act like a pass-trough node
+        if (weight < MCore::Math::epsilon || mDisabled || !animGraphInstance->GetActorInstance()->GetOptionalAnimGraphNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             RequestPoses(animGraphInstance);
@@ -8,6 +8,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/functional.h>
+#include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/AnimGraph.h>
 #include <EMotionFX/Source/Attachment.h>
 #include <EMotionFX/Source/BlendTreeSimulatedObjectNode.h>
@@ -228,8 +229,8 @@ namespace EMotionFX
             isActive = GetInputNumberAsBool(animGraphInstance, INPUTPORT_ACTIVE);
         }
 
-        // If we're not active or if this node is disabled or it is optimized for server, we can skip all calculations and just output the input pose.
-        if (!isActive || mDisabled || GetEMotionFX().GetEnableServerOptimization())
+        // If we're not active or if this node is disabled or it is optimized for server or skipped by the update LOD, we can skip all calculations and just output the input pose.
+        if (!isActive || mDisabled || GetEMotionFX().GetEnableServerOptimization() || !animGraphInstance->GetActorInstance()->GetOptionalAnimGraphNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
@@ -6,6 +6,7 @@
  */
 
 #include "BlendTreeTwoLinkIKNode.h"
+#include "ActorInstance.h"
 #include "AnimGraphManager.h"
 #include "EventManager.h"
 #include "Node.h"
@@ -227,8 +228,8 @@ namespace EMotionFX
             weight = MCore::Clamp<float>(weight, 0.0f, 1.0f);
         }
 
-        // if the IK weight is near zero, we can skip all calculations and act like a pass-trough node
-        if (weight < MCore::Math::epsilon || mDisabled)
+        // if the IK weight is near zero or the update LOD skips optional nodes, we can skip all calculations and act like a pass-trough node
+        if (weight < MCore::Math::epsilon || mDisabled || !animGraphInstance->GetActorInstance()->GetOptionalAnimGraphNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
@@ -131,6 +131,9 @@ namespace EMotionFX
         // EMotionFX will do optimization in server mode when this is enabled.
         m_enableServerOptimization = true;
 
+        // Blend2 nodes blend regular poses until the SoA blend has been measured to be faster on real skeletons.
+        m_soaBlendMinJoints = 0;
+
         if (MCore::GetMCore().GetIsTrackingMemory())
         {
             RegisterMemoryCategories(MCore::GetMemoryTracker());
@@ -336,6 +336,19 @@ namespace EMotionFX
          */
         bool GetEnableServerOptimization() const { return m_isInServerMode && m_enableServerOptimization; }
 
+        /**
+         * Get the number of joints from which BlendTreeBlend2Node blends through SoA poses.
+         * @return The joint count, or 0 when poses are always blended as regular poses, which is the default.
+         */
+        uint32 GetSoABlendMinJoints() const { return m_soaBlendMinJoints; }
+
+        /**
+         * Set the number of joints from which BlendTreeBlend2Node blends through SoA poses.
+         * Converting the poses from and to SoA poses costs more than the SIMD blend saves on small skeletons.
+         * @param numJoints The joint count, or 0 to always blend regular poses.
+         */
+        void SetSoABlendMinJoints(uint32 numJoints) { m_soaBlendMinJoints = numJoints; }
+
     private:
         AZStd::string               mVersionString;         /**< The version string. */
         AZStd::string               mCompilationDate;       /**< The compilation date string. */
@@ -359,6 +372,7 @@ namespace EMotionFX
         bool                        m_isInEditorMode;       /**< True when the runtime requires to support an editor. Optimizations can be made if there is no need for editor support. */
         bool                        m_isInServerMode;       /**< True when emotionfx is running on server. */
         bool                        m_enableServerOptimization; /**< True when optimization can be made when emotionfx is running in server mode. */
+        uint32                      m_soaBlendMinJoints;    /**< The number of joints from which Blend2 nodes blend through SoA poses, 0 when disabled. */
 
         /**
          * The constructor.
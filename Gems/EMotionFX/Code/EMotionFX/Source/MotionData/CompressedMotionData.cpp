@@ -0,0 +1,1450 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    float CompressedMotionData::CompressionStats::GetCompressionRatio() const
+    {
+        return (m_compressedNumBytes > 0) ? static_cast<float>(m_uncompressedNumBytes) / static_cast<float>(m_compressedNumBytes) : 1.0f;
+    }
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Quantized Keyframes (smallest, error bounded)";
+    }
+
+    size_t CompressedMotionData::GetNumComponents(TrackType type)
+    {
+        switch (type)
+        {
+            case TrackType::Rotation:
+                return 4;
+            case TrackType::Morph:
+            case TrackType::Float:
+                return 1;
+            default:
+                return 3;
+        }
+    }
+
+    float CompressedMotionData::CalcError(TrackType type, const AZ::Vector4& value, const AZ::Vector4& sourceValue)
+    {
+        switch (type)
+        {
+            case TrackType::Rotation:
+            {
+                // The angle between the two rotations, in degrees.
+                const float dot = AZ::GetMin(AZ::GetAbs(value.GetNormalized().Dot(sourceValue)), 1.0f);
+                return AZ::RadToDeg(2.0f * acosf(dot));
+            }
+            case TrackType::Morph:
+            case TrackType::Float:
+                return AZ::GetAbs(value.GetX() - sourceValue.GetX());
+            default:
+                return (value - sourceValue).GetLength();
+        }
+    }
+
+    CompressedMotionData::QuantizedTrack& CompressedMotionData::GetTrack(TrackType type, size_t dataIndex)
+    {
+        return const_cast<QuantizedTrack&>(static_cast<const CompressedMotionData*>(this)->GetTrack(type, dataIndex));
+    }
+
+    const CompressedMotionData::QuantizedTrack& CompressedMotionData::GetTrack(TrackType type, size_t dataIndex) const
+    {
+        switch (type)
+        {
+            case TrackType::Position:
+                return m_jointData[dataIndex].m_position;
+            case TrackType::Rotation:
+                return m_jointData[dataIndex].m_rotation;
+            case TrackType::Scale:
+                return m_jointData[dataIndex].m_scale;
+            case TrackType::Morph:
+                return m_morphData[dataIndex];
+            default:
+                return m_floatData[dataIndex];
+        }
+    }
+
+    void CompressedMotionData::SetStaticValue(TrackType type, size_t dataIndex, const AZ::Vector4& value)
+    {
+        switch (type)
+        {
+            case TrackType::Position:
+                m_staticJointData[dataIndex].m_staticTransform.mPosition = value.GetAsVector3();
+                break;
+            case TrackType::Rotation:
+                m_staticJointData[dataIndex].m_staticTransform.mRotation = AZ::Quaternion(value.GetSimdValue()).GetNormalized();
+                break;
+            case TrackType::Scale:
+                EMFX_SCALECODE
+                (
+                    m_staticJointData[dataIndex].m_staticTransform.mScale = value.GetAsVector3();
+                )
+                break;
+            case TrackType::Morph:
+                m_staticMorphData[dataIndex].m_staticValue = value.GetX();
+                break;
+            default:
+                m_staticFloatData[dataIndex].m_staticValue = value.GetX();
+                break;
+        }
+    }
+
+    AZ::Vector4 CompressedMotionData::DecodeSample(const QuantizedTrack& track, size_t numComponents, size_t sampleIndex) const
+    {
+        const size_t firstValue = sampleIndex * numComponents;
+        if (track.m_numBits == 32)
+        {
+            // Tracks that can't be quantized within their maximum error store the values as floats, with a zero minimum and unit scale.
+            AZ_ALIGN(float floatValues[4], 16) = { 0.0f, 0.0f, 0.0f, 0.0f };
+            memcpy(floatValues, reinterpret_cast<const float*>(&m_sampleData[track.m_offset]) + firstValue, numComponents * sizeof(float));
+            return AZ::Vector4(AZ::Simd::Vec4::Madd(AZ::Simd::Vec4::LoadAligned(floatValues), track.m_scale.GetSimdValue(), track.m_min.GetSimdValue()));
+        }
+
+        AZ_ALIGN(AZ::s32 quantized[4], 16) = { 0, 0, 0, 0 };
+        if (track.m_numBits == 16)
+        {
+            const AZ::u16* values = reinterpret_cast<const AZ::u16*>(&m_sampleData[track.m_offset]) + firstValue;
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                quantized[c] = values[c];
+            }
+        }
+        else
+        {
+            const AZ::u8* values = &m_sampleData[track.m_offset] + firstValue;
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                quantized[c] = values[c];
+            }
+        }
+
+        // Dequantize all components at once: min + quantized * scale.
+        const AZ::Simd::Vec4::FloatType quantizedFloats = AZ::Simd::Vec4::ConvertToFloat(AZ::Simd::Vec4::LoadAligned(quantized));
+        return AZ::Vector4(AZ::Simd::Vec4::Madd(quantizedFloats, track.m_scale.GetSimdValue(), track.m_min.GetSimdValue()));
+    }
+
+    AZ::Vector4 CompressedMotionData::DecodeInterpolated(const QuantizedTrack& track, size_t numComponents, size_t indexA, size_t indexB, float t) const
+    {
+        const AZ::Simd::Vec4::FloatType valueA = DecodeSample(track, numComponents, indexA).GetSimdValue();
+        const AZ::Simd::Vec4::FloatType valueB = DecodeSample(track, numComponents, indexB).GetSimdValue();
+        return AZ::Vector4(AZ::Simd::Vec4::Madd(AZ::Simd::Vec4::Sub(valueB, valueA), AZ::Simd::Vec4::Splat(t), valueA));
+    }
+
+    AZ::Quaternion CompressedMotionData::DecodeRotation(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const
+    {
+        // The rotations of a track are stored in the same hemisphere, so a plain linear interpolation takes the shortest path.
+        return AZ::Quaternion(DecodeInterpolated(track, 4, indexA, indexB, t).GetSimdValue()).GetNormalized();
+    }
+
+    void CompressedMotionData::AddTrackSource(AZStd::vector<TrackSource>& sources, TrackType type, size_t dataIndex, float maxError, bool keepPrecision) const
+    {
+        const QuantizedTrack& track = GetTrack(type, dataIndex);
+        if (track.m_numBits == 0)
+        {
+            return;
+        }
+
+        TrackSource& source = sources.emplace_back();
+        source.m_type = type;
+        source.m_dataIndex = dataIndex;
+        source.m_baseError = track.m_maxError;
+        source.m_maxError = maxError;
+        if (keepPrecision)
+        {
+            // Requantizing the decoded values with the same bit depth and range reproduces the same values.
+            source.m_keepPrecision = true;
+            source.m_minNumBits = track.m_numBits;
+        }
+
+        const size_t numComponents = GetNumComponents(type);
+        source.m_values.resize(m_numSamples);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            source.m_values[s] = DecodeSample(track, numComponents, s);
+        }
+    }
+
+    void CompressedMotionData::EncodeTracks(AZStd::vector<TrackSource>& sources)
+    {
+        m_sampleData.clear();
+        for (TrackSource& source : sources)
+        {
+            QuantizedTrack& track = GetTrack(source.m_type, source.m_dataIndex);
+            track = QuantizedTrack();
+            track.m_maxError = source.m_baseError;
+            if (source.m_values.empty())
+            {
+                continue;
+            }
+
+            // Calculate the value range of every component.
+            const AZStd::vector<AZ::Vector4>& values = source.m_values;
+            AZ::Vector4 minValue = values[0];
+            AZ::Vector4 maxValue = values[0];
+            for (const AZ::Vector4& value : values)
+            {
+                minValue = minValue.GetMin(value);
+                maxValue = maxValue.GetMax(value);
+            }
+            const AZ::Vector4 range = maxValue - minValue;
+
+            // Try the smallest bit depth first, and fall back to 16 bits when that exceeds the maximum error.
+            // When even 16 bits exceed it, which happens for tracks with a large value range, store the values as floats.
+            const size_t numComponents = GetNumComponents(source.m_type);
+            const size_t startSize = m_sampleData.size();
+            for (AZ::u8 numBits : { AZ::u8(8), AZ::u8(16) })
+            {
+                if (numBits < source.m_minNumBits)
+                {
+                    continue;
+                }
+
+                const size_t numBytesPerComponent = numBits / 8;
+                const AZ::u32 maxQuantizedValue = (1 << numBits) - 1;
+                track.m_numBits = numBits;
+                track.m_min = minValue;
+                track.m_scale = range / static_cast<float>(maxQuantizedValue);
+                track.m_offset = AZ_SIZE_ALIGN_UP(startSize, numBytesPerComponent);
+                m_sampleData.resize(track.m_offset + m_numSamples * numComponents * numBytesPerComponent);
+
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    for (size_t c = 0; c < numComponents; ++c)
+                    {
+                        const int componentIndex = static_cast<int>(c);
+                        const float componentRange = range.GetElement(componentIndex);
+                        const float normalized = (componentRange > 0.0f) ? (values[s].GetElement(componentIndex) - minValue.GetElement(componentIndex)) / componentRange : 0.0f;
+                        const AZ::u32 quantized = AZ::GetClamp(static_cast<AZ::u32>(normalized * maxQuantizedValue + 0.5f), 0u, maxQuantizedValue);
+
+                        const size_t valueIndex = s * numComponents + c;
+                        if (numBits == 16)
+                        {
+                            reinterpret_cast<AZ::u16*>(&m_sampleData[track.m_offset])[valueIndex] = static_cast<AZ::u16>(quantized);
+                        }
+                        else
+                        {
+                            m_sampleData[track.m_offset + valueIndex] = static_cast<AZ::u8>(quantized);
+                        }
+                    }
+                }
+
+                // Measure the error the quantization introduced.
+                float quantizationError = 0.0f;
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    quantizationError = AZ::GetMax(quantizationError, CalcError(source.m_type, DecodeSample(track, numComponents, s), values[s]));
+                }
+
+                track.m_maxError = source.m_baseError + quantizationError;
+                if (track.m_maxError <= source.m_maxError || source.m_keepPrecision)
+                {
+                    break;
+                }
+
+                m_sampleData.resize(startSize);
+                if (numBits == 16)
+                {
+                    AZ_Warning("EMotionFX", false, "Quantizing track %zu of type %d to 16 bits results in an error of %f, which exceeds the maximum error of %f. Storing it uncompressed.",
+                        source.m_dataIndex, static_cast<int>(source.m_type), track.m_maxError, source.m_maxError);
+                    track.m_numBits = 0;
+                }
+            }
+
+            if (track.m_numBits == 0)
+            {
+                track.m_numBits = 32;
+                track.m_min = AZ::Vector4::CreateZero();
+                track.m_scale = AZ::Vector4::CreateOne();
+                track.m_maxError = source.m_baseError;
+                track.m_offset = AZ_SIZE_ALIGN_UP(startSize, sizeof(float));
+                m_sampleData.resize(track.m_offset + m_numSamples * numComponents * sizeof(float));
+                float* trackValues = reinterpret_cast<float*>(&m_sampleData[track.m_offset]);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    for (size_t c = 0; c < numComponents; ++c)
+                    {
+                        trackValues[s * numComponents + c] = values[s].GetElement(static_cast<int>(c));
+                    }
+                }
+            }
+        }
+
+        m_sampleData.shrink_to_fit();
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        SetSampleRate(keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate);
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), m_sampleRate, numSamples, sampleSpacing);
+
+        InitSettings initSettings;
+        initSettings.m_numJoints = motionData->GetNumJoints();
+        initSettings.m_numMorphs = motionData->GetNumMorphs();
+        initSettings.m_numFloats = motionData->GetNumFloats();
+        initSettings.m_sampleRate = m_sampleRate;
+        initSettings.m_numSamples = numSamples;
+        Init(initSettings);
+        CopyBaseMotionData(motionData);
+
+        // Sample the source data at full precision.
+        // Tracks are quantized to 16 bits, unless that exceeds the default maximum errors of the optimize settings.
+        const OptimizeSettings defaultSettings;
+        AZStd::vector<TrackSource> sources;
+        auto addSource = [&sources, &defaultSettings, numSamples](TrackType type, size_t dataIndex) -> AZStd::vector<AZ::Vector4>&
+        {
+            TrackSource& source = sources.emplace_back();
+            source.m_type = type;
+            source.m_dataIndex = dataIndex;
+            source.m_minNumBits = 16;
+            switch (type)
+            {
+                case TrackType::Position:
+                    source.m_maxError = defaultSettings.m_maxPosError;
+                    break;
+                case TrackType::Rotation:
+                    source.m_maxError = defaultSettings.m_maxRotError;
+                    break;
+                case TrackType::Scale:
+                    source.m_maxError = defaultSettings.m_maxScaleError;
+                    break;
+                case TrackType::Morph:
+                    source.m_maxError = defaultSettings.m_maxMorphError;
+                    break;
+                default:
+                    source.m_maxError = defaultSettings.m_maxFloatError;
+                    break;
+            }
+            source.m_values.resize(numSamples);
+            return source.m_values;
+        };
+
+        for (size_t i = 0; i < initSettings.m_numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            AZStd::vector<AZ::Vector4>* positions = motionData->IsJointPositionAnimated(i) ? &addSource(TrackType::Position, i) : nullptr;
+            AZStd::vector<AZ::Vector4>* rotations = motionData->IsJointRotationAnimated(i) ? &addSource(TrackType::Rotation, i) : nullptr;
+            AZStd::vector<AZ::Vector4>* scales = nullptr;
+            EMFX_SCALECODE
+            (
+                scales = motionData->IsJointScaleAnimated(i) ? &addSource(TrackType::Scale, i) : nullptr;
+            )
+
+            AZ::Quaternion previousRotation = AZ::Quaternion::CreateIdentity();
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const Transform transform = motionData->SampleJointTransform(s * sampleSpacing, i);
+                if (positions)
+                {
+                    (*positions)[s] = AZ::Vector4::CreateFromVector3(transform.mPosition);
+                }
+
+                if (rotations)
+                {
+                    // Keep the rotations in the same hemisphere as the previous sample, so the quantization ranges stay small.
+                    AZ::Quaternion rotation = transform.mRotation.GetNormalized();
+                    if (s > 0 && rotation.Dot(previousRotation) < 0.0f)
+                    {
+                        rotation = -rotation;
+                    }
+                    previousRotation = rotation;
+                    (*rotations)[s] = AZ::Vector4(rotation.GetSimdValue());
+                }
+
+                EMFX_SCALECODE
+                (
+                    if (scales)
+                    {
+                        (*scales)[s] = AZ::Vector4::CreateFromVector3(transform.mScale);
+                    }
+                )
+            }
+        }
+
+        for (size_t i = 0; i < initSettings.m_numMorphs; ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                AZStd::vector<AZ::Vector4>& values = addSource(TrackType::Morph, i);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    values[s] = AZ::Vector4(motionData->SampleMorph(s * sampleSpacing, i), 0.0f, 0.0f, 0.0f);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < initSettings.m_numFloats; ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                AZStd::vector<AZ::Vector4>& values = addSource(TrackType::Float, i);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    values[s] = AZ::Vector4(motionData->SampleFloat(s * sampleSpacing, i), 0.0f, 0.0f, 0.0f);
+                }
+            }
+        }
+
+        // Quantize every track at the highest precision, Optimize lowers it where the error allows.
+        m_uncompressedNumBytes = 0;
+        for (const TrackSource& source : sources)
+        {
+            m_uncompressedNumBytes += numSamples * GetNumComponents(source.m_type) * sizeof(float);
+        }
+        EncodeTracks(sources);
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        auto isIgnored = [](const AZStd::vector<size_t>& ignoreList, size_t dataIndex)
+        {
+            return AZStd::find(ignoreList.begin(), ignoreList.end(), dataIndex) != ignoreList.end();
+        };
+
+        // Decode all tracks, skipping the optimization of ignored ones by keeping their bit depth.
+        AZStd::vector<TrackSource> sources;
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            const bool ignored = isIgnored(settings.m_jointIgnoreList, i);
+            AddTrackSource(sources, TrackType::Position, i, settings.m_maxPosError, ignored);
+            AddTrackSource(sources, TrackType::Rotation, i, settings.m_maxRotError, ignored);
+            AddTrackSource(sources, TrackType::Scale, i, settings.m_maxScaleError, ignored);
+        }
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            AddTrackSource(sources, TrackType::Morph, i, settings.m_maxMorphError, isIgnored(settings.m_morphIgnoreList, i));
+        }
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            AddTrackSource(sources, TrackType::Float, i, settings.m_maxFloatError, isIgnored(settings.m_floatIgnoreList, i));
+        }
+
+        // Turn tracks that don't move more than the maximum error into static values.
+        for (TrackSource& source : sources)
+        {
+            float deviation = 0.0f;
+            for (const AZ::Vector4& value : source.m_values)
+            {
+                deviation = AZ::GetMax(deviation, CalcError(source.m_type, source.m_values[0], value));
+            }
+
+            if (!source.m_keepPrecision && source.m_baseError + deviation <= source.m_maxError)
+            {
+                SetStaticValue(source.m_type, source.m_dataIndex, source.m_values[0]);
+                source.m_baseError += deviation;
+                source.m_values.clear();
+            }
+        }
+
+        EncodeTracks(sources);
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    CompressedMotionData::CompressionStats CompressedMotionData::GetCompressionStats() const
+    {
+        CompressionStats stats;
+        stats.m_uncompressedNumBytes = m_uncompressedNumBytes;
+        stats.m_compressedNumBytes = m_sampleData.size();
+
+        auto addTrack = [&stats](const QuantizedTrack& track, size_t numComponents, float& inOutMaxError)
+        {
+            inOutMaxError = AZ::GetMax(inOutMaxError, track.m_maxError);
+            if (track.m_numBits > 0)
+            {
+                stats.m_compressedNumBytes += numComponents * 2 * sizeof(float); // The minimum and scale of each component.
+            }
+        };
+
+        for (const JointData& jointData : m_jointData)
+        {
+            addTrack(jointData.m_position, 3, stats.m_maxPosError);
+            addTrack(jointData.m_rotation, 4, stats.m_maxRotError);
+            addTrack(jointData.m_scale, 3, stats.m_maxScaleError);
+        }
+        for (const QuantizedTrack& track : m_morphData)
+        {
+            addTrack(track, 1, stats.m_maxMorphError);
+        }
+        for (const QuantizedTrack& track : m_floatData)
+        {
+            addTrack(track, 1, stats.m_maxFloatError);
+        }
+
+        return stats;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const AZ::u32 jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex32)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const bool inPlace = (settings.m_inPlace && skeleton->GetNode(jointSkeletonIndex)->GetIsRootNode());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex32 && !inPlace)
+        {
+            result = SampleJointTransform(settings.m_sampleTime, jointDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.mAxis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).mSourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.mFlags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const SampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<AZ::u32>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const AZ::u32 numNodes = actorInstance->GetNumEnabledNodes();
+        for (AZ::u32 i = 0; i < numNodes; ++i)
+        {
+            const AZ::u32 skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            // Dequantize and interpolate the samples.
+            Transform result;
+            const AZ::u32 jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex32 && !inPlace)
+            {
+                const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
+                const JointData& jointData = m_jointData[jointDataIndex];
+                result.mPosition = (jointData.m_position.m_numBits > 0) ? DecodeInterpolated(jointData.m_position, 3, indexA, indexB, t).GetAsVector3() : staticJointData.m_staticTransform.mPosition;
+                result.mRotation = (jointData.m_rotation.m_numBits > 0) ? DecodeRotation(jointData.m_rotation, indexA, indexB, t) : staticJointData.m_staticTransform.mRotation;
+#ifndef EMFX_SCALE_DISABLED
+                result.mScale = (jointData.m_scale.m_numBits > 0) ? DecodeInterpolated(jointData.m_scale, 3, indexA, indexB, t).GetAsVector3() : staticJointData.m_staticTransform.mScale;
+#endif
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex32)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const AZ::u32 numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (AZ::u32 i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const QuantizedTrack& track = m_morphData[realIndex];
+                if (track.m_numBits > 0)
+                {
+                    outputPose->SetMorphWeight(i, DecodeInterpolated(track, 1, indexA, indexB, t).GetX());
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const QuantizedTrack& track = m_morphData[morphDataIndex];
+        if (track.m_numBits == 0)
+        {
+            return m_staticMorphData[morphDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeInterpolated(track, 1, indexA, indexB, t).GetX();
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const QuantizedTrack& track = m_floatData[floatDataIndex];
+        if (track.m_numBits == 0)
+        {
+            return m_staticFloatData[floatDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeInterpolated(track, 1, indexA, indexB, t).GetX();
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const QuantizedTrack& track = m_jointData[jointDataIndex].m_position;
+        if (track.m_numBits == 0)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mPosition;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeInterpolated(track, 3, indexA, indexB, t).GetAsVector3();
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const QuantizedTrack& track = m_jointData[jointDataIndex].m_rotation;
+        if (track.m_numBits == 0)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mRotation;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeRotation(track, indexA, indexB, t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const QuantizedTrack& track = m_jointData[jointDataIndex].m_scale;
+        if (track.m_numBits == 0)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mScale;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeInterpolated(track, 3, indexA, indexB, t).GetAsVector3();
+    }
+#endif
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+        return Transform
+        (
+            (jointData.m_position.m_numBits > 0) ? DecodeInterpolated(jointData.m_position, 3, indexA, indexB, t).GetAsVector3() : staticTransform.mPosition,
+            (jointData.m_rotation.m_numBits > 0) ? DecodeRotation(jointData.m_rotation, indexA, indexB, t) : staticTransform.mRotation
+#ifndef EMFX_SCALE_DISABLED
+            ,(jointData.m_scale.m_numBits > 0) ? DecodeInterpolated(jointData.m_scale, 3, indexA, indexB, t).GetAsVector3() : staticTransform.mScale
+#endif
+        );
+    }
+
+    void CompressedMotionData::Init(const InitSettings& settings)
+    {
+        if (settings.m_numSamples > 0)
+        {
+            AZ_Error("EMotionFX", settings.m_sampleRate > 0.0f, "Sample rate should be larger than zero.");
+        }
+        Clear();
+        Resize(settings.m_numJoints, settings.m_numMorphs, settings.m_numFloats);
+        m_numSamples = settings.m_numSamples;
+        SetSampleRate(settings.m_sampleRate);
+        UpdateDuration();
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+        m_sampleData.clear();
+        m_sampleData.shrink_to_fit();
+
+        m_uncompressedNumBytes = 0;
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the range of the position tracks scales all their samples.
+        for (JointData& jointData : m_jointData)
+        {
+            jointData.m_position.m_min *= scaleFactor;
+            jointData.m_position.m_scale *= scaleFactor;
+            jointData.m_position.m_maxError *= scaleFactor;
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.m_numBits > 0;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.m_numBits > 0;
+    }
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        return (jointData.m_position.m_numBits > 0 || jointData.m_rotation.m_numBits > 0 || jointData.m_scale.m_numBits > 0);
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_numBits > 0;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_numBits > 0;
+    }
+
+    AZ::u8 CompressedMotionData::GetJointPositionNumBits(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.m_numBits;
+    }
+
+    AZ::u8 CompressedMotionData::GetJointRotationNumBits(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.m_numBits;
+    }
+
+    AZ::u8 CompressedMotionData::GetMorphNumBits(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_numBits;
+    }
+
+    AZ::u8 CompressedMotionData::GetFloatNumBits(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_numBits;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scale.m_numBits > 0;
+    }
+
+    AZ::u8 CompressedMotionData::GetJointScaleNumBits(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scale.m_numBits;
+    }
+
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_scale = QuantizedTrack();
+    }
+#endif
+
+    // Clearing only resets the tracks, their samples are released the next time the data gets optimized.
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointData& jointData : m_jointData)
+        {
+            jointData = JointData();
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (QuantizedTrack& track : m_morphData)
+        {
+            track = QuantizedTrack();
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (QuantizedTrack& track : m_floatData)
+        {
+            track = QuantizedTrack();
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_position = QuantizedTrack();
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_rotation = QuantizedTrack();
+    }
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex] = JointData();
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex] = QuantizedTrack();
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex] = QuantizedTrack();
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        struct File_CompressedMotionData_Info
+        {
+            AZ::u32 m_numJoints = 0;
+            AZ::u32 m_numMorphs = 0;
+            AZ::u32 m_numFloats = 0;
+            AZ::u32 m_numSamples = 0;
+            AZ::u32 m_uncompressedNumBytes = 0;
+            float m_sampleRate = 30.0f;
+
+            // Followed by:
+            // File_CompressedMotionData_Joint[m_numJoints]
+            // File_CompressedMotionData_Float[m_numMorphs]
+            // File_CompressedMotionData_Float[m_numFloats]
+        };
+
+        struct File_CompressedMotionData_Track
+        {
+            float m_min[4] = { 0.0f, 0.0f, 0.0f, 0.0f };    // The minimum value of each component.
+            float m_scale[4] = { 0.0f, 0.0f, 0.0f, 0.0f };  // The range of each component divided by the largest quantized value.
+            float m_maxError = 0.0f;                        // The largest error compared to the source data.
+            AZ::u8 m_numBits = 0;                           // The number of bits per component (8, 16 or 32 for floats), or zero when not animated.
+
+            // Followed by:
+            // AZ::u8[File_CompressedMotionData_Info.m_numSamples * numComponents]  (only when m_numBits is 8).
+            // AZ::u16[File_CompressedMotionData_Info.m_numSamples * numComponents] (only when m_numBits is 16).
+            // float[File_CompressedMotionData_Info.m_numSamples * numComponents]   (only when m_numBits is 32).
+        };
+
+        struct File_CompressedMotionData_Joint
+        {
+            FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+            FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+            FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+            FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+            FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+            FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+
+            // Followed by:
+            // string : The name of the joint.
+            // File_CompressedMotionData_Track : The position track.
+            // File_CompressedMotionData_Track : The rotation track.
+            // File_CompressedMotionData_Track : The scale track.
+        };
+
+        struct File_CompressedMotionData_Float
+        {
+            float m_staticValue = 0.0f; // The static (first frame) value.
+
+            // Followed by:
+            // string : The name of the channel.
+            // File_CompressedMotionData_Track : The samples.
+        };
+    } // namespace
+
+    bool CompressedMotionData::SaveTrack(MCore::Stream* stream, TrackType type, size_t dataIndex, MCore::Endian::EEndianType targetEndianType) const
+    {
+        const QuantizedTrack& track = GetTrack(type, dataIndex);
+
+        File_CompressedMotionData_Track trackChunk;
+        track.m_min.StoreToFloat4(trackChunk.m_min);
+        track.m_scale.StoreToFloat4(trackChunk.m_scale);
+        trackChunk.m_maxError = track.m_maxError;
+        trackChunk.m_numBits = track.m_numBits;
+        for (size_t c = 0; c < 4; ++c)
+        {
+            ExporterLib::ConvertFloat(&trackChunk.m_min[c], targetEndianType);
+            ExporterLib::ConvertFloat(&trackChunk.m_scale[c], targetEndianType);
+        }
+        ExporterLib::ConvertFloat(&trackChunk.m_maxError, targetEndianType);
+        if (stream->Write(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+        {
+            return false;
+        }
+
+        if (track.m_numBits == 0)
+        {
+            return true;
+        }
+
+        const size_t numValues = m_numSamples * GetNumComponents(type);
+        if (track.m_numBits == 32)
+        {
+            AZStd::vector<float> values(numValues);
+            memcpy(values.data(), &m_sampleData[track.m_offset], numValues * sizeof(float));
+            for (float& value : values)
+            {
+                ExporterLib::ConvertFloat(&value, targetEndianType);
+            }
+            return stream->Write(values.data(), numValues * sizeof(float)) != 0;
+        }
+
+        if (track.m_numBits == 16)
+        {
+            AZStd::vector<AZ::u16> values(numValues);
+            memcpy(values.data(), &m_sampleData[track.m_offset], numValues * sizeof(AZ::u16));
+            for (AZ::u16& value : values)
+            {
+                ExporterLib::ConvertUnsignedShort(&value, targetEndianType);
+            }
+            return stream->Write(values.data(), numValues * sizeof(AZ::u16)) != 0;
+        }
+
+        return stream->Write(&m_sampleData[track.m_offset], numValues) != 0;
+    }
+
+    bool CompressedMotionData::ReadTrack(MCore::Stream* stream, TrackType type, size_t dataIndex, MCore::Endian::EEndianType sourceEndianType)
+    {
+        File_CompressedMotionData_Track trackChunk;
+        if (stream->Read(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+        {
+            return false;
+        }
+        MCore::Endian::ConvertFloat(trackChunk.m_min, sourceEndianType, 4);
+        MCore::Endian::ConvertFloat(trackChunk.m_scale, sourceEndianType, 4);
+        MCore::Endian::ConvertFloat(&trackChunk.m_maxError, sourceEndianType);
+
+        if (trackChunk.m_numBits != 0 && trackChunk.m_numBits != 8 && trackChunk.m_numBits != 16 && trackChunk.m_numBits != 32)
+        {
+            AZ_Error("EMotionFX", false, "Unsupported number of bits (%d) in compressed motion data track.", trackChunk.m_numBits);
+            return false;
+        }
+
+        QuantizedTrack& track = GetTrack(type, dataIndex);
+        track.m_min = AZ::Vector4::CreateFromFloat4(trackChunk.m_min);
+        track.m_scale = AZ::Vector4::CreateFromFloat4(trackChunk.m_scale);
+        track.m_maxError = trackChunk.m_maxError;
+        track.m_numBits = trackChunk.m_numBits;
+        if (track.m_numBits == 0)
+        {
+            return true;
+        }
+
+        const size_t numBytesPerComponent = track.m_numBits / 8;
+        const size_t numValues = m_numSamples * GetNumComponents(type);
+        track.m_offset = AZ_SIZE_ALIGN_UP(m_sampleData.size(), numBytesPerComponent);
+        m_sampleData.resize(track.m_offset + numValues * numBytesPerComponent);
+        if (stream->Read(&m_sampleData[track.m_offset], numValues * numBytesPerComponent) == 0)
+        {
+            return false;
+        }
+
+        if (track.m_numBits == 32)
+        {
+            MCore::Endian::ConvertFloat(reinterpret_cast<float*>(&m_sampleData[track.m_offset]), sourceEndianType, static_cast<AZ::u32>(numValues));
+        }
+        else if (track.m_numBits == 16)
+        {
+            MCore::Endian::ConvertUnsignedInt16(reinterpret_cast<AZ::u16*>(&m_sampleData[track.m_offset]), sourceEndianType, static_cast<AZ::u32>(numValues));
+        }
+
+        return true;
+    }
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        auto calcTrackSize = [this](TrackType type, size_t dataIndex)
+        {
+            const AZ::u8 numBits = GetTrack(type, dataIndex).m_numBits;
+            return sizeof(File_CompressedMotionData_Track) + m_numSamples * GetNumComponents(type) * (numBits / 8);
+        };
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+            numBytes += calcTrackSize(TrackType::Position, i);
+            numBytes += calcTrackSize(TrackType::Rotation, i);
+            numBytes += calcTrackSize(TrackType::Scale, i);
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += calcTrackSize(TrackType::Morph, i);
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += calcTrackSize(TrackType::Float, i);
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_uncompressedNumBytes = static_cast<AZ::u32>(m_uncompressedNumBytes);
+        info.m_sampleRate = GetSampleRate();
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_uncompressedNumBytes, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        if (saveSettings.m_logDetails)
+        {
+            const CompressionStats stats = GetCompressionStats();
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + Compression ratio = %.2f (%zu to %zu bytes)", stats.GetCompressionRatio(), stats.m_uncompressedNumBytes, stats.m_compressedNumBytes);
+            MCore::LogDetailedInfo("  + Max errors        = pos %f, rot %f deg, scale %f, morph %f, float %f", stats.m_maxPosError, stats.m_maxRotError, stats.m_maxScaleError, stats.m_maxMorphError, stats.m_maxFloatError);
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, MCore::Compressed16BitQuaternion(GetJointStaticRotation(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, MCore::Compressed16BitQuaternion(GetJointBindPoseRotation(i)));
+            EMFX_SCALECODE
+            (
+                ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+                ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+            )
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+
+            if (!SaveTrack(stream, TrackType::Position, i, targetEndianType) ||
+                !SaveTrack(stream, TrackType::Rotation, i, targetEndianType) ||
+                !SaveTrack(stream, TrackType::Scale, i, targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph and float channels.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = GetMorphStaticValue(i);
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetMorphName(i), stream, targetEndianType);
+
+            if (!SaveTrack(stream, TrackType::Morph, i, targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = GetFloatStaticValue(i);
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetFloatName(i), stream, targetEndianType);
+
+            if (!SaveTrack(stream, TrackType::Float, i, targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_uncompressedNumBytes, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        InitSettings initSettings;
+        initSettings.m_numJoints = info.m_numJoints;
+        initSettings.m_numMorphs = info.m_numMorphs;
+        initSettings.m_numFloats = info.m_numFloats;
+        initSettings.m_numSamples = info.m_numSamples;
+        initSettings.m_sampleRate = info.m_sampleRate;
+        Init(initSettings);
+        m_uncompressedNumBytes = info.m_uncompressedNumBytes;
+
+        // Read all joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.mX, jointInfo.m_staticPos.mY, jointInfo.m_staticPos.mZ);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.mX, jointInfo.m_staticScale.mY, jointInfo.m_staticScale.mZ);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.mX, jointInfo.m_staticRot.mY, jointInfo.m_staticRot.mZ, jointInfo.m_staticRot.mW);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.mX, jointInfo.m_bindPosePos.mY, jointInfo.m_bindPosePos.mZ);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.mX, jointInfo.m_bindPoseScale.mY, jointInfo.m_bindPoseScale.mZ);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.mX, jointInfo.m_bindPoseRot.mY, jointInfo.m_bindPoseRot.mZ, jointInfo.m_bindPoseRot.mW);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+            SetJointName(i, MotionData::ReadStringFromStream(stream, sourceEndianType));
+
+            if (!ReadTrack(stream, TrackType::Position, i, sourceEndianType) ||
+                !ReadTrack(stream, TrackType::Rotation, i, sourceEndianType) ||
+                !ReadTrack(stream, TrackType::Scale, i, sourceEndianType))
+            {
+                return false;
+            }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s' (pos bits=%d, rot bits=%d, scale bits=%d)", i, GetJointName(i).c_str(),
+                    m_jointData[i].m_position.m_numBits, m_jointData[i].m_rotation.m_numBits, m_jointData[i].m_scale.m_numBits);
+            }
+        }
+
+        // Read the morphs.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            SetMorphStaticValue(i, floatInfo.m_staticValue);
+            SetMorphName(i, MotionData::ReadStringFromStream(stream, sourceEndianType));
+
+            if (!ReadTrack(stream, TrackType::Morph, i, sourceEndianType))
+            {
+                return false;
+            }
+        }
+
+        // Read the floats.
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            SetFloatStaticValue(i, floatInfo.m_staticValue);
+            SetFloatName(i, MotionData::ReadStringFromStream(stream, sourceEndianType));
+
+            if (!ReadTrack(stream, TrackType::Float, i, sourceEndianType))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
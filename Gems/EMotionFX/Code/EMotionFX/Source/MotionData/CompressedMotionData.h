@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    /**
+     * Motion data that stores evenly spaced samples, quantized per track.
+     * Every animated track stores its samples as 8 or 16 bit integers, normalized to the value range of that track.
+     * Tracks with a value range too large to quantize to 16 bits within the maximum error store their samples as floats.
+     * Optimize picks the smallest bit depth per track that stays within the maximum errors of the optimize settings, and turns
+     * tracks that don't move more than the maximum error into static values.
+     * Sampling dequantizes and interpolates four components at a time using SIMD math.
+     */
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{6C3A0C1B-8E4B-4A52-9E55-2F7D1D3B6A41}", MotionData)
+
+        struct EMFX_API InitSettings
+        {
+            size_t m_numJoints = 0;
+            size_t m_numMorphs = 0;
+            size_t m_numFloats = 0;
+            size_t m_numSamples = 0;
+            float m_sampleRate = 30.0f;
+        };
+
+        /**
+         * The compression results, as reported after InitFromNonUniformData and Optimize.
+         * The errors are the largest differences between the sampled keys and the keys of the source data.
+         */
+        struct EMFX_API CompressionStats
+        {
+            size_t m_uncompressedNumBytes = 0;  // The size of the animated tracks when stored as full precision floats.
+            size_t m_compressedNumBytes = 0;    // The size of the quantized samples and the track ranges.
+            float m_maxPosError = 0.0f;         // In units.
+            float m_maxRotError = 0.0f;         // In degrees.
+            float m_maxScaleError = 0.0f;       // In scale factor.
+            float m_maxMorphError = 0.0f;       // Morph difference.
+            float m_maxFloatError = 0.0f;       // Float difference.
+
+            float GetCompressionRatio() const;
+        };
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const override;
+        void SamplePose(const SampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        // Initialize and clear.
+        void Init(const InitSettings& settings);
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+        // Get the number of bits per quantized component of a track, or zero when the track isn't animated.
+        AZ::u8 GetJointPositionNumBits(size_t jointDataIndex) const;
+        AZ::u8 GetJointRotationNumBits(size_t jointDataIndex) const;
+        AZ::u8 GetMorphNumBits(size_t morphDataIndex) const;
+        AZ::u8 GetFloatNumBits(size_t floatDataIndex) const;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+        AZ::u8 GetJointScaleNumBits(size_t jointDataIndex) const;
+#endif
+
+        CompressionStats GetCompressionStats() const;
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        enum class TrackType : AZ::u8
+        {
+            Position,
+            Rotation,
+            Scale,
+            Morph,
+            Float
+        };
+
+        struct EMFX_API QuantizedTrack
+        {
+            AZ::Vector4 m_min = AZ::Vector4::CreateZero();      // The minimum value of each component.
+            AZ::Vector4 m_scale = AZ::Vector4::CreateZero();    // The value range of each component, divided by the largest quantized value.
+            size_t m_offset = 0;                                // The byte offset of the first sample inside the sample data.
+            float m_maxError = 0.0f;                            // The largest error compared to the source data.
+            AZ::u8 m_numBits = 0;                               // The number of bits per component (8, 16 or 32 for floats), or zero when not animated.
+        };
+
+        struct EMFX_API JointData
+        {
+            QuantizedTrack m_position;
+            QuantizedTrack m_rotation;
+            QuantizedTrack m_scale; // Never animated when scale is disabled.
+        };
+
+        // The full precision values of a track, before quantization.
+        struct EMFX_API TrackSource
+        {
+            TrackType m_type = TrackType::Position;
+            size_t m_dataIndex = 0;
+            AZStd::vector<AZ::Vector4> m_values;
+            float m_baseError = 0.0f;   // The error the values already have compared to the source data.
+            float m_maxError = 0.0f;    // The maximum allowed error after quantization.
+            AZ::u8 m_minNumBits = 8;    // The smallest number of bits per component to try.
+            bool m_keepPrecision = false; // Keep the bit depth of m_minNumBits regardless of the error, used for ignored tracks.
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+        void UpdateSampleSpacing();
+
+        static size_t GetNumComponents(TrackType type);
+        static float CalcError(TrackType type, const AZ::Vector4& value, const AZ::Vector4& sourceValue);
+        QuantizedTrack& GetTrack(TrackType type, size_t dataIndex);
+        const QuantizedTrack& GetTrack(TrackType type, size_t dataIndex) const;
+        void SetStaticValue(TrackType type, size_t dataIndex, const AZ::Vector4& value);
+
+        // Quantization.
+        void EncodeTracks(AZStd::vector<TrackSource>& sources);
+        void AddTrackSource(AZStd::vector<TrackSource>& sources, TrackType type, size_t dataIndex, float maxError, bool keepPrecision) const;
+        AZ::Vector4 DecodeSample(const QuantizedTrack& track, size_t numComponents, size_t sampleIndex) const;
+        AZ::Vector4 DecodeInterpolated(const QuantizedTrack& track, size_t numComponents, size_t indexA, size_t indexB, float t) const;
+        AZ::Quaternion DecodeRotation(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const;
+
+        // Serialization.
+        bool SaveTrack(MCore::Stream* stream, TrackType type, size_t dataIndex, MCore::Endian::EEndianType targetEndianType) const;
+        bool ReadTrack(MCore::Stream* stream, TrackType type, size_t dataIndex, MCore::Endian::EEndianType sourceEndianType);
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<QuantizedTrack> m_morphData;
+        AZStd::vector<QuantizedTrack> m_floatData;
+        AZStd::vector<AZ::u8> m_sampleData;
+        size_t m_uncompressedNumBytes = 0;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
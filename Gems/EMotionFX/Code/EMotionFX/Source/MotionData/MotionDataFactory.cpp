@@ -5,6 +5,7 @@
  *
  */
 
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
@@ -21,6 +22,7 @@ namespace EMotionFX
     {
         Register(aznew UniformMotionData());
         Register(aznew NonUniformMotionData());
+        Register(aznew CompressedMotionData());
     }
 
     void MotionDataFactory::Clear()
@@ -143,9 +143,7 @@ namespace EMotionFX
         }
 
         // reset stats
-        mNumUpdated.SetValue(0);
-        mNumVisible.SetValue(0);
-        mNumSampled.SetValue(0);
+        BeginExecute();
 
         for (uint32 s = 0; s < numSteps; ++s)
         {
@@ -176,34 +174,12 @@ namespace EMotionFX
                     const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
                     actorInstance->SetThreadIndex(threadIndex);
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        mNumVisible.Increment();
-                    }
-
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            mNumSampled.Increment();
-                        }
-                    }
-
                     // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    UpdateActorInstance(actorInstance, timePassedInSeconds);
                 }, true, jobContext);
 
                 job->SetDependent(&jobCompletion);               
                 job->Start();
-
-                mNumUpdated.Increment();
             }
 
             jobCompletion.StartAndWaitForCompletion();
@@ -44,9 +44,7 @@ namespace EMotionFX
         const ActorManager& actorManager = GetActorManager();
 
         // reset stats
-        mNumUpdated.SetValue(0);
-        mNumVisible.SetValue(0);
-        mNumSampled.SetValue(0);
+        BeginExecute();
 
         // propagate root actor instance visibility to their attachments
         const uint32 numRootActorInstances = GetActorManager().GetNumRootActorInstances();
@@ -89,31 +87,8 @@ namespace EMotionFX
     {
         actorInstance->SetThreadIndex(0);
 
-        mNumUpdated.Increment();
-
-        const bool isVisible = actorInstance->GetIsVisible();
-
-        // check if we want to sample motions
-        bool sampleMotions = false;
-        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-        {
-            sampleMotions = true;
-            actorInstance->SetMotionSamplingTimer(0.0f);
-
-            if (isVisible)
-            {
-                mNumSampled.Increment();
-            }
-        }
-
-        if (isVisible)
-        {
-            mNumVisible.Increment();
-        }
-
         // update the transformations
-        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+        UpdateActorInstance(actorInstance, timePassedInSeconds);
 
         // recursively process the attachments
         const uint32 numAttachments = actorInstance->GetNumAttachments();
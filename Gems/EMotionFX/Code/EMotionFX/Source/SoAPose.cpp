@@ -0,0 +1,576 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoAPose.h>
+
+
+namespace EMotionFX
+{
+    namespace
+    {
+        using AZ::Simd::Vec4;
+        using FloatType = Vec4::FloatType;
+
+        // Four vectors, one per lane.
+        struct Vector3x4
+        {
+            FloatType x;
+            FloatType y;
+            FloatType z;
+        };
+
+        // Four quaternions, one per lane.
+        struct Quaternionx4
+        {
+            FloatType x;
+            FloatType y;
+            FloatType z;
+            FloatType w;
+        };
+
+        AZ_FORCE_INLINE Vector3x4 LoadVector3(const float* streams, uint32 streamLength, uint32 firstStream, uint32 offset)
+        {
+            const float* data = streams + firstStream * streamLength + offset;
+            return { Vec4::LoadAligned(data), Vec4::LoadAligned(data + streamLength), Vec4::LoadAligned(data + 2 * streamLength) };
+        }
+
+        AZ_FORCE_INLINE Quaternionx4 LoadQuaternion(const float* streams, uint32 streamLength, uint32 offset)
+        {
+            const float* data = streams + SoAPose::STREAM_ROTATION_X * streamLength + offset;
+            return { Vec4::LoadAligned(data), Vec4::LoadAligned(data + streamLength), Vec4::LoadAligned(data + 2 * streamLength), Vec4::LoadAligned(data + 3 * streamLength) };
+        }
+
+        AZ_FORCE_INLINE void StoreVector3(float* streams, uint32 streamLength, uint32 firstStream, uint32 offset, const Vector3x4& value)
+        {
+            float* data = streams + firstStream * streamLength + offset;
+            Vec4::StoreAligned(data, value.x);
+            Vec4::StoreAligned(data + streamLength, value.y);
+            Vec4::StoreAligned(data + 2 * streamLength, value.z);
+        }
+
+        AZ_FORCE_INLINE void StoreQuaternion(float* streams, uint32 streamLength, uint32 offset, const Quaternionx4& value)
+        {
+            float* data = streams + SoAPose::STREAM_ROTATION_X * streamLength + offset;
+            Vec4::StoreAligned(data, value.x);
+            Vec4::StoreAligned(data + streamLength, value.y);
+            Vec4::StoreAligned(data + 2 * streamLength, value.z);
+            Vec4::StoreAligned(data + 3 * streamLength, value.w);
+        }
+
+        // Load one component of four joints that are not stored next to each other.
+        AZ_FORCE_INLINE FloatType Gather(const float* stream, const uint32* indices)
+        {
+            return Vec4::LoadImmediate(stream[indices[0]], stream[indices[1]], stream[indices[2]], stream[indices[3]]);
+        }
+
+        AZ_FORCE_INLINE void Scatter(float* stream, const uint32* indices, FloatType value)
+        {
+            AZ_ALIGN(float values[4], 16);
+            Vec4::StoreAligned(values, value);
+            stream[indices[0]] = values[0];
+            stream[indices[1]] = values[1];
+            stream[indices[2]] = values[2];
+            stream[indices[3]] = values[3];
+        }
+
+        AZ_FORCE_INLINE Vector3x4 Lerp(const Vector3x4& a, const Vector3x4& b, FloatType t)
+        {
+            return { Vec4::Madd(Vec4::Sub(b.x, a.x), t, a.x), Vec4::Madd(Vec4::Sub(b.y, a.y), t, a.y), Vec4::Madd(Vec4::Sub(b.z, a.z), t, a.z) };
+        }
+
+        AZ_FORCE_INLINE Vector3x4 Add(const Vector3x4& a, const Vector3x4& b)
+        {
+            return { Vec4::Add(a.x, b.x), Vec4::Add(a.y, b.y), Vec4::Add(a.z, b.z) };
+        }
+
+        AZ_FORCE_INLINE Vector3x4 Sub(const Vector3x4& a, const Vector3x4& b)
+        {
+            return { Vec4::Sub(a.x, b.x), Vec4::Sub(a.y, b.y), Vec4::Sub(a.z, b.z) };
+        }
+
+        AZ_FORCE_INLINE Vector3x4 Mul(const Vector3x4& a, const Vector3x4& b)
+        {
+            return { Vec4::Mul(a.x, b.x), Vec4::Mul(a.y, b.y), Vec4::Mul(a.z, b.z) };
+        }
+
+        // Calculate a + b * t.
+        AZ_FORCE_INLINE Vector3x4 Madd(const Vector3x4& a, const Vector3x4& b, FloatType t)
+        {
+            return { Vec4::Madd(b.x, t, a.x), Vec4::Madd(b.y, t, a.y), Vec4::Madd(b.z, t, a.z) };
+        }
+
+        AZ_FORCE_INLINE Vector3x4 Cross(const Vector3x4& a, const Vector3x4& b)
+        {
+            return {
+                Vec4::Sub(Vec4::Mul(a.y, b.z), Vec4::Mul(a.z, b.y)),
+                Vec4::Sub(Vec4::Mul(a.z, b.x), Vec4::Mul(a.x, b.z)),
+                Vec4::Sub(Vec4::Mul(a.x, b.y), Vec4::Mul(a.y, b.x))
+            };
+        }
+
+        AZ_FORCE_INLINE FloatType Dot(const Quaternionx4& a, const Quaternionx4& b)
+        {
+            return Vec4::Madd(a.w, b.w, Vec4::Madd(a.z, b.z, Vec4::Madd(a.y, b.y, Vec4::Mul(a.x, b.x))));
+        }
+
+        AZ_FORCE_INLINE Quaternionx4 Normalize(const Quaternionx4& q)
+        {
+            const FloatType invLength = Vec4::SqrtInv(Dot(q, q));
+            return { Vec4::Mul(q.x, invLength), Vec4::Mul(q.y, invLength), Vec4::Mul(q.z, invLength), Vec4::Mul(q.w, invLength) };
+        }
+
+        AZ_FORCE_INLINE Quaternionx4 Conjugate(const Quaternionx4& q)
+        {
+            const FloatType zero = Vec4::ZeroFloat();
+            return { Vec4::Sub(zero, q.x), Vec4::Sub(zero, q.y), Vec4::Sub(zero, q.z), q.w };
+        }
+
+        // The same multiplication order as AZ::Quaternion::operator*.
+        AZ_FORCE_INLINE Quaternionx4 Multiply(const Quaternionx4& a, const Quaternionx4& b)
+        {
+            return {
+                Vec4::Madd(a.x, b.w, Vec4::Madd(a.w, b.x, Vec4::Sub(Vec4::Mul(a.y, b.z), Vec4::Mul(a.z, b.y)))),
+                Vec4::Madd(a.y, b.w, Vec4::Madd(a.w, b.y, Vec4::Sub(Vec4::Mul(a.z, b.x), Vec4::Mul(a.x, b.z)))),
+                Vec4::Madd(a.z, b.w, Vec4::Madd(a.w, b.z, Vec4::Sub(Vec4::Mul(a.x, b.y), Vec4::Mul(a.y, b.x)))),
+                Vec4::Sub(Vec4::Mul(a.w, b.w), Vec4::Madd(a.z, b.z, Vec4::Madd(a.y, b.y, Vec4::Mul(a.x, b.x))))
+            };
+        }
+
+        // Rotate a vector by a unit quaternion.
+        AZ_FORCE_INLINE Vector3x4 Rotate(const Quaternionx4& q, const Vector3x4& v)
+        {
+            const Vector3x4 axis = { q.x, q.y, q.z };
+            const Vector3x4 cross = Cross(axis, v);
+            const FloatType two = Vec4::Splat(2.0f);
+            const Vector3x4 t = { Vec4::Mul(cross.x, two), Vec4::Mul(cross.y, two), Vec4::Mul(cross.z, two) };
+            return Add(Madd(v, t, q.w), Cross(axis, t));
+        }
+
+        // Normalized linear interpolation, taking the shortest path, just like MCore::NLerp.
+        AZ_FORCE_INLINE Quaternionx4 NLerp(const Quaternionx4& a, const Quaternionx4& b, FloatType t)
+        {
+            const FloatType zero = Vec4::ZeroFloat();
+            const FloatType oneMinusT = Vec4::Sub(Vec4::Splat(1.0f), t);
+            const FloatType signedT = Vec4::Select(Vec4::Sub(zero, t), t, Vec4::CmpLt(Dot(a, b), zero));
+            const Quaternionx4 result = {
+                Vec4::Madd(b.x, signedT, Vec4::Mul(a.x, oneMinusT)),
+                Vec4::Madd(b.y, signedT, Vec4::Mul(a.y, oneMinusT)),
+                Vec4::Madd(b.z, signedT, Vec4::Mul(a.z, oneMinusT)),
+                Vec4::Madd(b.w, signedT, Vec4::Mul(a.w, oneMinusT))
+            };
+            return Normalize(result);
+        }
+    } // namespace
+
+
+    SoAPose::SoAPose()
+    {
+        mActor              = nullptr;
+        mNumJoints          = 0;
+        mNumPaddedJoints    = 0;
+        mModelSpaceReady    = false;
+        mLocalSpaceStreams.SetMemoryCategory(EMFX_MEMCATEGORY_ANIMGRAPH_POSE);
+        mModelSpaceStreams.SetMemoryCategory(EMFX_MEMCATEGORY_ANIMGRAPH_POSE);
+    }
+
+
+    SoAPose::SoAPose(const SoAPose& other)
+        : SoAPose()
+    {
+        *this = other;
+    }
+
+
+    SoAPose::~SoAPose()
+    {
+        mLocalSpaceStreams.Clear(true);
+        mModelSpaceStreams.Clear(true);
+    }
+
+
+    SoAPose& SoAPose::operator=(const SoAPose& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        mActor = other.mActor;
+        mParentIndices = other.mParentIndices;
+        mLevelJoints = other.mLevelJoints;
+        mLevelOffsets = other.mLevelOffsets;
+        mNumJoints = other.mNumJoints;
+        mNumPaddedJoints = other.mNumPaddedJoints;
+        mModelSpaceReady = other.mModelSpaceReady;
+        mLocalSpaceStreams.MemCopyContentsFrom(other.mLocalSpaceStreams);
+        mModelSpaceStreams.MemCopyContentsFrom(other.mModelSpaceStreams);
+        return *this;
+    }
+
+
+    void SoAPose::LinkToActor(const Actor* actor)
+    {
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const uint32 numJoints = skeleton->GetNumNodes();
+        if (mActor == actor && mNumJoints == numJoints)
+        {
+            return;
+        }
+
+        mParentIndices.resize(numJoints);
+        for (uint32 i = 0; i < numJoints; ++i)
+        {
+            mParentIndices[i] = skeleton->GetNode(i)->GetParentIndex();
+        }
+
+        mActor = actor;
+        Resize(numJoints);
+        BuildLevelSchedule();
+    }
+
+
+    void SoAPose::LinkToHierarchy(const AZStd::vector<uint32>& parentIndices)
+    {
+        mActor = nullptr;
+        mParentIndices = parentIndices;
+        Resize(static_cast<uint32>(parentIndices.size()));
+        BuildLevelSchedule();
+    }
+
+
+    // resize the streams and reset all joints to identity, including the padding
+    void SoAPose::Resize(uint32 numJoints)
+    {
+        mNumJoints = numJoints;
+        mNumPaddedJoints = (numJoints + 3) & ~3u;
+        mModelSpaceReady = false;
+
+        const uint32 numFloats = mNumPaddedJoints * NUM_STREAMS;
+        mLocalSpaceStreams.ResizeFast(numFloats);
+        mModelSpaceStreams.ResizeFast(numFloats);
+
+        float* data = mLocalSpaceStreams.GetPtr();
+        for (uint32 stream = 0; stream < NUM_STREAMS; ++stream)
+        {
+            const float value = (stream == STREAM_ROTATION_W || stream >= STREAM_SCALE_X) ? 1.0f : 0.0f;
+            for (uint32 i = 0; i < mNumPaddedJoints; ++i)
+            {
+                data[stream * mNumPaddedJoints + i] = value;
+            }
+        }
+        mModelSpaceStreams.MemCopyContentsFrom(mLocalSpaceStreams);
+    }
+
+
+    // sort the joints on their depth inside the hierarchy, so that each level only depends on the previous ones
+    void SoAPose::BuildLevelSchedule()
+    {
+        AZStd::vector<uint32> depths(mNumJoints, 0);
+        uint32 numLevels = 0;
+        for (uint32 i = 0; i < mNumJoints; ++i)
+        {
+            const uint32 parentIndex = mParentIndices[i];
+            if (parentIndex != MCORE_INVALIDINDEX32)
+            {
+                AZ_Assert(parentIndex < i, "The parent of joint %u is stored after the joint itself.", i);
+                depths[i] = depths[parentIndex] + 1;
+            }
+            numLevels = MCore::Max<uint32>(numLevels, depths[i] + 1);
+        }
+
+        mLevelJoints.clear();
+        mLevelOffsets.clear();
+        mLevelJoints.reserve(mNumPaddedJoints + numLevels * 3);
+        mLevelOffsets.reserve(numLevels + 1);
+        for (uint32 level = 0; level < numLevels; ++level)
+        {
+            mLevelOffsets.emplace_back(static_cast<uint32>(mLevelJoints.size()));
+            for (uint32 i = 0; i < mNumJoints; ++i)
+            {
+                if (depths[i] == level)
+                {
+                    mLevelJoints.emplace_back(i);
+                }
+            }
+
+            // pad the level by recalculating its last joint, which writes the same result again
+            while ((mLevelJoints.size() - mLevelOffsets.back()) % 4 != 0)
+            {
+                mLevelJoints.emplace_back(mLevelJoints.back());
+            }
+        }
+        mLevelOffsets.emplace_back(static_cast<uint32>(mLevelJoints.size()));
+    }
+
+
+    void SoAPose::InitFromPose(const Pose& pose)
+    {
+        if (pose.GetActor())
+        {
+            LinkToActor(pose.GetActor());
+        }
+        AZ_Assert(pose.GetNumTransforms() == mNumJoints, "The pose and the SoA pose have a different number of joints.");
+
+        for (uint32 i = 0; i < mNumJoints; ++i)
+        {
+            SetLocalSpaceTransform(i, pose.GetLocalSpaceTransform(i));
+        }
+    }
+
+
+    void SoAPose::InitFromSoAPose(const SoAPose& other)
+    {
+        *this = other;
+    }
+
+
+    void SoAPose::CopyToPose(Pose& outPose) const
+    {
+        AZ_Assert(outPose.GetNumTransforms() == mNumJoints, "The pose and the SoA pose have a different number of joints.");
+
+        for (uint32 i = 0; i < mNumJoints; ++i)
+        {
+            outPose.SetLocalSpaceTransformDirect(i, GetLocalSpaceTransform(i));
+            if (mModelSpaceReady)
+            {
+                outPose.SetModelSpaceTransformDirect(i, GetModelSpaceTransform(i));
+            }
+            else
+            {
+                outPose.InvalidateModelSpaceTransform(i);
+            }
+        }
+    }
+
+
+    void SoAPose::SetLocalSpaceTransform(uint32 jointIndex, const Transform& transform)
+    {
+        float* data = mLocalSpaceStreams.GetPtr() + jointIndex;
+        data[STREAM_POSITION_X * mNumPaddedJoints] = transform.mPosition.GetX();
+        data[STREAM_POSITION_Y * mNumPaddedJoints] = transform.mPosition.GetY();
+        data[STREAM_POSITION_Z * mNumPaddedJoints] = transform.mPosition.GetZ();
+        data[STREAM_ROTATION_X * mNumPaddedJoints] = transform.mRotation.GetX();
+        data[STREAM_ROTATION_Y * mNumPaddedJoints] = transform.mRotation.GetY();
+        data[STREAM_ROTATION_Z * mNumPaddedJoints] = transform.mRotation.GetZ();
+        data[STREAM_ROTATION_W * mNumPaddedJoints] = transform.mRotation.GetW();
+        EMFX_SCALECODE
+        (
+            data[STREAM_SCALE_X * mNumPaddedJoints] = transform.mScale.GetX();
+            data[STREAM_SCALE_Y * mNumPaddedJoints] = transform.mScale.GetY();
+            data[STREAM_SCALE_Z * mNumPaddedJoints] = transform.mScale.GetZ();
+        )
+        mModelSpaceReady = false;
+    }
+
+
+    Transform SoAPose::GetLocalSpaceTransform(uint32 jointIndex) const
+    {
+        const float* data = mLocalSpaceStreams.GetReadPtr() + jointIndex;
+        Transform result;
+        result.mPosition.Set(data[STREAM_POSITION_X * mNumPaddedJoints], data[STREAM_POSITION_Y * mNumPaddedJoints], data[STREAM_POSITION_Z * mNumPaddedJoints]);
+        result.mRotation.Set(data[STREAM_ROTATION_X * mNumPaddedJoints], data[STREAM_ROTATION_Y * mNumPaddedJoints], data[STREAM_ROTATION_Z * mNumPaddedJoints], data[STREAM_ROTATION_W * mNumPaddedJoints]);
+        EMFX_SCALECODE
+        (
+            result.mScale.Set(data[STREAM_SCALE_X * mNumPaddedJoints], data[STREAM_SCALE_Y * mNumPaddedJoints], data[STREAM_SCALE_Z * mNumPaddedJoints]);
+        )
+        return result;
+    }
+
+
+    Transform SoAPose::GetModelSpaceTransform(uint32 jointIndex) const
+    {
+        AZ_Assert(mModelSpaceReady, "The model space transforms are outdated, call UpdateModelSpaceTransforms first.");
+        const float* data = mModelSpaceStreams.GetReadPtr() + jointIndex;
+        Transform result;
+        result.mPosition.Set(data[STREAM_POSITION_X * mNumPaddedJoints], data[STREAM_POSITION_Y * mNumPaddedJoints], data[STREAM_POSITION_Z * mNumPaddedJoints]);
+        result.mRotation.Set(data[STREAM_ROTATION_X * mNumPaddedJoints], data[STREAM_ROTATION_Y * mNumPaddedJoints], data[STREAM_ROTATION_Z * mNumPaddedJoints], data[STREAM_ROTATION_W * mNumPaddedJoints]);
+        EMFX_SCALECODE
+        (
+            result.mScale.Set(data[STREAM_SCALE_X * mNumPaddedJoints], data[STREAM_SCALE_Y * mNumPaddedJoints], data[STREAM_SCALE_Z * mNumPaddedJoints]);
+        )
+        return result;
+    }
+
+
+    void SoAPose::InitJointWeights(JointWeights& outWeights, float weight) const
+    {
+        outWeights.ResizeFast(mNumPaddedJoints);
+        for (uint32 i = 0; i < mNumPaddedJoints; ++i)
+        {
+            outWeights[i] = weight;
+        }
+    }
+
+
+    void SoAPose::Blend(const SoAPose& destPose, float weight)
+    {
+        BlendWithJointWeights(destPose, weight, nullptr);
+    }
+
+
+    void SoAPose::BlendMasked(const SoAPose& destPose, float weight, const JointWeights& jointWeights)
+    {
+        AZ_Assert(jointWeights.GetLength() == mNumPaddedJoints, "Expected the joint weights to be initialized using InitJointWeights.");
+        BlendWithJointWeights(destPose, weight, jointWeights.GetReadPtr());
+    }
+
+
+    void SoAPose::BlendWithJointWeights(const SoAPose& destPose, float weight, const float* jointWeights)
+    {
+        AZ_Assert(destPose.mNumPaddedJoints == mNumPaddedJoints, "Poses must be of the same size");
+        const uint32 length = mNumPaddedJoints;
+        float* streams = mLocalSpaceStreams.GetPtr();
+        const float* destStreams = destPose.mLocalSpaceStreams.GetReadPtr();
+        const FloatType weights = Vec4::Splat(weight);
+
+        for (uint32 i = 0; i < length; i += 4)
+        {
+            const FloatType t = jointWeights ? Vec4::Mul(Vec4::LoadAligned(jointWeights + i), weights) : weights;
+
+            const Vector3x4 position = Lerp(LoadVector3(streams, length, STREAM_POSITION_X, i), LoadVector3(destStreams, length, STREAM_POSITION_X, i), t);
+            StoreVector3(streams, length, STREAM_POSITION_X, i, position);
+
+            const Quaternionx4 rotation = NLerp(LoadQuaternion(streams, length, i), LoadQuaternion(destStreams, length, i), t);
+            StoreQuaternion(streams, length, i, rotation);
+
+            EMFX_SCALECODE
+            (
+                const Vector3x4 scale = Lerp(LoadVector3(streams, length, STREAM_SCALE_X, i), LoadVector3(destStreams, length, STREAM_SCALE_X, i), t);
+                StoreVector3(streams, length, STREAM_SCALE_X, i, scale);
+            )
+        }
+
+        mModelSpaceReady = false;
+    }
+
+
+    void SoAPose::BlendAdditive(const SoAPose& destPose, const SoAPose& basePose, float weight)
+    {
+        AZ_Assert(destPose.mNumPaddedJoints == mNumPaddedJoints && basePose.mNumPaddedJoints == mNumPaddedJoints, "Poses must be of the same size");
+        const uint32 length = mNumPaddedJoints;
+        float* streams = mLocalSpaceStreams.GetPtr();
+        const float* destStreams = destPose.mLocalSpaceStreams.GetReadPtr();
+        const float* baseStreams = basePose.mLocalSpaceStreams.GetReadPtr();
+        const FloatType t = Vec4::Splat(weight);
+
+        for (uint32 i = 0; i < length; i += 4)
+        {
+            const Vector3x4 relativePosition = Sub(LoadVector3(destStreams, length, STREAM_POSITION_X, i), LoadVector3(baseStreams, length, STREAM_POSITION_X, i));
+            StoreVector3(streams, length, STREAM_POSITION_X, i, Madd(LoadVector3(streams, length, STREAM_POSITION_X, i), relativePosition, t));
+
+            const Quaternionx4 baseRotation = LoadQuaternion(baseStreams, length, i);
+            const Quaternionx4 blendedRotation = NLerp(baseRotation, LoadQuaternion(destStreams, length, i), t);
+            const Quaternionx4 rotation = Multiply(LoadQuaternion(streams, length, i), Multiply(Conjugate(baseRotation), blendedRotation));
+            StoreQuaternion(streams, length, i, Normalize(rotation));
+
+            EMFX_SCALECODE
+            (
+                const Vector3x4 relativeScale = Sub(LoadVector3(destStreams, length, STREAM_SCALE_X, i), LoadVector3(baseStreams, length, STREAM_SCALE_X, i));
+                StoreVector3(streams, length, STREAM_SCALE_X, i, Madd(LoadVector3(streams, length, STREAM_SCALE_X, i), relativeScale, t));
+            )
+        }
+
+        mModelSpaceReady = false;
+    }
+
+
+    void SoAPose::ApplyAdditive(const SoAPose& additivePose, float weight)
+    {
+        AZ_Assert(additivePose.mNumPaddedJoints == mNumPaddedJoints, "Poses must be of the same size");
+        const uint32 length = mNumPaddedJoints;
+        float* streams = mLocalSpaceStreams.GetPtr();
+        const float* additiveStreams = additivePose.mLocalSpaceStreams.GetReadPtr();
+        const FloatType t = Vec4::Splat(weight);
+
+        for (uint32 i = 0; i < length; i += 4)
+        {
+            StoreVector3(streams, length, STREAM_POSITION_X, i, Madd(LoadVector3(streams, length, STREAM_POSITION_X, i), LoadVector3(additiveStreams, length, STREAM_POSITION_X, i), t));
+
+            const Quaternionx4 rotation = LoadQuaternion(streams, length, i);
+            StoreQuaternion(streams, length, i, NLerp(rotation, Multiply(rotation, LoadQuaternion(additiveStreams, length, i)), t));
+
+        #ifndef EMFX_SCALE_DISABLED
+            const FloatType one = Vec4::Splat(1.0f);
+            const Vector3x4 identityScale = { one, one, one };
+            const Vector3x4 scale = Mul(LoadVector3(streams, length, STREAM_SCALE_X, i), Lerp(identityScale, LoadVector3(additiveStreams, length, STREAM_SCALE_X, i), t));
+            StoreVector3(streams, length, STREAM_SCALE_X, i, scale);
+        #endif
+        }
+
+        mModelSpaceReady = false;
+    }
+
+
+    void SoAPose::UpdateModelSpaceTransforms()
+    {
+        const uint32 length = mNumPaddedJoints;
+        const float* localStreams = mLocalSpaceStreams.GetReadPtr();
+        float* modelStreams = mModelSpaceStreams.GetPtr();
+
+        // the first level holds the root joints, of which the model space transform equals the local space one
+        const uint32 numLevels = static_cast<uint32>(mLevelOffsets.size()) - 1;
+        if (numLevels > 0)
+        {
+            for (uint32 i = mLevelOffsets[0]; i < mLevelOffsets[1]; ++i)
+            {
+                const uint32 jointIndex = mLevelJoints[i];
+                for (uint32 stream = 0; stream < NUM_STREAMS; ++stream)
+                {
+                    modelStreams[stream * length + jointIndex] = localStreams[stream * length + jointIndex];
+                }
+            }
+        }
+
+        AZ_ALIGN(uint32 parentIndices[4], 16);
+        for (uint32 level = 1; level < numLevels; ++level)
+        {
+            const uint32 levelEnd = mLevelOffsets[level + 1];
+            for (uint32 i = mLevelOffsets[level]; i < levelEnd; i += 4)
+            {
+                const uint32* jointIndices = &mLevelJoints[i];
+                for (uint32 lane = 0; lane < 4; ++lane)
+                {
+                    parentIndices[lane] = mParentIndices[jointIndices[lane]];
+                }
+
+                const Vector3x4 localPosition = { Gather(localStreams + STREAM_POSITION_X * length, jointIndices), Gather(localStreams + STREAM_POSITION_Y * length, jointIndices), Gather(localStreams + STREAM_POSITION_Z * length, jointIndices) };
+                const Quaternionx4 localRotation = { Gather(localStreams + STREAM_ROTATION_X * length, jointIndices), Gather(localStreams + STREAM_ROTATION_Y * length, jointIndices), Gather(localStreams + STREAM_ROTATION_Z * length, jointIndices), Gather(localStreams + STREAM_ROTATION_W * length, jointIndices) };
+                const Vector3x4 parentPosition = { Gather(modelStreams + STREAM_POSITION_X * length, parentIndices), Gather(modelStreams + STREAM_POSITION_Y * length, parentIndices), Gather(modelStreams + STREAM_POSITION_Z * length, parentIndices) };
+                const Quaternionx4 parentRotation = { Gather(modelStreams + STREAM_ROTATION_X * length, parentIndices), Gather(modelStreams + STREAM_ROTATION_Y * length, parentIndices), Gather(modelStreams + STREAM_ROTATION_Z * length, parentIndices), Gather(modelStreams + STREAM_ROTATION_W * length, parentIndices) };
+
+                // the same as Transform::PreMultiply, with the parent on the left hand side
+            #ifdef EMFX_SCALE_DISABLED
+                const Vector3x4 position = Add(parentPosition, Rotate(parentRotation, localPosition));
+            #else
+                const Vector3x4 localScale = { Gather(localStreams + STREAM_SCALE_X * length, jointIndices), Gather(localStreams + STREAM_SCALE_Y * length, jointIndices), Gather(localStreams + STREAM_SCALE_Z * length, jointIndices) };
+                const Vector3x4 parentScale = { Gather(modelStreams + STREAM_SCALE_X * length, parentIndices), Gather(modelStreams + STREAM_SCALE_Y * length, parentIndices), Gather(modelStreams + STREAM_SCALE_Z * length, parentIndices) };
+                const Vector3x4 position = Add(parentPosition, Mul(Rotate(parentRotation, localPosition), parentScale));
+                const Vector3x4 scale = Mul(parentScale, localScale);
+                Scatter(modelStreams + STREAM_SCALE_X * length, jointIndices, scale.x);
+                Scatter(modelStreams + STREAM_SCALE_Y * length, jointIndices, scale.y);
+                Scatter(modelStreams + STREAM_SCALE_Z * length, jointIndices, scale.z);
+            #endif
+                const Quaternionx4 rotation = Normalize(Multiply(parentRotation, localRotation));
+
+                Scatter(modelStreams + STREAM_POSITION_X * length, jointIndices, position.x);
+                Scatter(modelStreams + STREAM_POSITION_Y * length, jointIndices, position.y);
+                Scatter(modelStreams + STREAM_POSITION_Z * length, jointIndices, position.z);
+                Scatter(modelStreams + STREAM_ROTATION_X * length, jointIndices, rotation.x);
+                Scatter(modelStreams + STREAM_ROTATION_Y * length, jointIndices, rotation.y);
+                Scatter(modelStreams + STREAM_ROTATION_Z * length, jointIndices, rotation.z);
+                Scatter(modelStreams + STREAM_ROTATION_W * length, jointIndices, rotation.w);
+            }
+        }
+
+        mModelSpaceReady = true;
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "EMotionFXConfig.h"
+#include "Transform.h"
+#include <AzCore/std/containers/vector.h>
+#include <MCore/Source/AlignedArray.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Actor;
+    class Pose;
+
+    /**
+     * A pose that stores its local and model space joint transforms as separate component streams (structure of arrays).
+     * Every component (position x, position y, ..., scale z) is stored in its own float stream, padded to a multiple of four joints.
+     * This allows the blend, additive and mask operations to process four joints at a time using SIMD math.
+     * The model space transforms are calculated in a batch, one hierarchy depth level at a time, as all joints of a level
+     * only depend on the already calculated joints of the previous level.
+     * Morph weights and pose datas are not stored, use CopyToPose and InitFromPose to convert from and to a regular pose.
+     */
+    class EMFX_API SoAPose
+    {
+        MCORE_MEMORYOBJECTCATEGORY(SoAPose, EMFX_DEFAULT_ALIGNMENT, EMFX_MEMCATEGORY_ANIMGRAPH_POSE);
+
+    public:
+        /**
+         * The component streams.
+         * The scale streams are always present, but contain a scale of one when scale is disabled.
+         */
+        enum EStream : uint32
+        {
+            STREAM_POSITION_X   = 0,
+            STREAM_POSITION_Y   = 1,
+            STREAM_POSITION_Z   = 2,
+            STREAM_ROTATION_X   = 3,
+            STREAM_ROTATION_Y   = 4,
+            STREAM_ROTATION_Z   = 5,
+            STREAM_ROTATION_W   = 6,
+            STREAM_SCALE_X      = 7,
+            STREAM_SCALE_Y      = 8,
+            STREAM_SCALE_Z      = 9,
+            NUM_STREAMS         = 10
+        };
+
+        /**
+         * Per joint weights, used to mask blends.
+         * Use InitJointWeights to size it to the padded number of joints, after which the weight of a joint can be set using its joint index.
+         */
+        using JointWeights = MCore::AlignedArray<float, 16>;
+
+        SoAPose();
+        SoAPose(const SoAPose& other);
+        ~SoAPose();
+
+        /**
+         * Link the pose to a given actor.
+         * This resizes the streams and builds the depth level schedule used by UpdateModelSpaceTransforms.
+         * Relinking to the same actor again is cheap and keeps the schedule.
+         * @param actor The actor to link to.
+         */
+        void LinkToActor(const Actor* actor);
+
+        /**
+         * Link the pose to a hierarchy defined by parent indices, without an actor.
+         * Parents have to be stored before their children, just like inside a skeleton.
+         * @param parentIndices The parent index of every joint, or MCORE_INVALIDINDEX32 for root joints.
+         */
+        void LinkToHierarchy(const AZStd::vector<uint32>& parentIndices);
+
+        void InitFromPose(const Pose& pose);
+        void InitFromSoAPose(const SoAPose& other);
+
+        /**
+         * Write the local space transforms into a regular pose, which has to be linked to the same skeleton.
+         * The model space transforms are written as well when they are up to date, otherwise they get invalidated.
+         * @param outPose The pose to write the transforms to. Its morph weights and pose datas remain untouched.
+         */
+        void CopyToPose(Pose& outPose) const;
+
+        void SetLocalSpaceTransform(uint32 jointIndex, const Transform& transform);
+        Transform GetLocalSpaceTransform(uint32 jointIndex) const;
+        Transform GetModelSpaceTransform(uint32 jointIndex) const;
+
+        /**
+         * Blend this pose towards a destination pose.
+         * Positions and scales are linearly interpolated, rotations are normalized linearly interpolated, just like Transform::Blend.
+         * @param destPose The pose to blend into.
+         * @param weight The blend weight, where 0 keeps this pose and 1 results in the destination pose.
+         */
+        void Blend(const SoAPose& destPose, float weight);
+
+        /**
+         * Blend this pose towards a destination pose, where the weight of each joint is scaled by a per joint weight.
+         * @param destPose The pose to blend into.
+         * @param weight The blend weight.
+         * @param jointWeights The per joint weights, as initialized by InitJointWeights.
+         */
+        void BlendMasked(const SoAPose& destPose, float weight, const JointWeights& jointWeights);
+
+        /**
+         * Additively blend the difference between a destination pose and a base pose on top of this pose, like Transform::BlendAdditive.
+         * @param destPose The destination pose.
+         * @param basePose The pose the destination pose is relative to, usually the bind pose.
+         * @param weight The blend weight.
+         */
+        void BlendAdditive(const SoAPose& destPose, const SoAPose& basePose, float weight);
+
+        /**
+         * Apply an additive pose, as created by Pose::MakeAdditive, on top of this pose, like Transform::ApplyAdditive.
+         * @param additivePose The additive pose.
+         * @param weight The weight of the additive pose.
+         */
+        void ApplyAdditive(const SoAPose& additivePose, float weight);
+
+        void InitJointWeights(JointWeights& outWeights, float weight) const;
+
+        /**
+         * Calculate the model space transforms of all joints from their local space transforms.
+         * Processes one depth level at a time, four joints at once.
+         */
+        void UpdateModelSpaceTransforms();
+
+        MCORE_INLINE bool GetModelSpaceTransformsReady() const              { return mModelSpaceReady; }
+        MCORE_INLINE const Actor* GetActor() const                          { return mActor; }
+        MCORE_INLINE uint32 GetNumJoints() const                            { return mNumJoints; }
+        MCORE_INLINE uint32 GetNumPaddedJoints() const                      { return mNumPaddedJoints; }
+        MCORE_INLINE float* GetLocalSpaceStream(EStream stream)             { mModelSpaceReady = false; return mLocalSpaceStreams.GetPtr() + stream * mNumPaddedJoints; }
+        MCORE_INLINE const float* GetLocalSpaceStream(EStream stream) const { return mLocalSpaceStreams.GetReadPtr() + stream * mNumPaddedJoints; }
+        MCORE_INLINE const float* GetModelSpaceStream(EStream stream) const { return mModelSpaceStreams.GetReadPtr() + stream * mNumPaddedJoints; }
+
+        SoAPose& operator=(const SoAPose& other);
+
+    private:
+        MCore::AlignedArray<float, 16>  mLocalSpaceStreams;     /**< The local space component streams, each of them mNumPaddedJoints floats long. */
+        MCore::AlignedArray<float, 16>  mModelSpaceStreams;     /**< The model space component streams. */
+        AZStd::vector<uint32>           mParentIndices;         /**< The parent index of each joint. */
+        AZStd::vector<uint32>           mLevelJoints;           /**< The joint indices sorted on depth, where each level is padded to a multiple of four by repeating its last joint. */
+        AZStd::vector<uint32>           mLevelOffsets;          /**< The start of each depth level inside mLevelJoints, plus the end of the last level. */
+        const Actor*                    mActor;
+        uint32                          mNumJoints;
+        uint32                          mNumPaddedJoints;
+        bool                            mModelSpaceReady;
+
+        void Resize(uint32 numJoints);
+        void BuildLevelSchedule();
+        void BlendWithJointWeights(const SoAPose& destPose, float weight, const float* jointWeights);
+    };
+}   // namespace EMotionFX
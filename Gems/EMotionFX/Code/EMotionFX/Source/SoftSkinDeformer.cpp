@@ -6,6 +6,9 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -21,6 +24,74 @@
 
 namespace EMotionFX
 {
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        // The number of elements of a row major 3x4 matrix.
+        constexpr uint32 s_numMatrixElements = 12;
+
+        // The x, y and z components of one vector of each vertex in a group, one vertex per lane.
+        struct GroupVectors
+        {
+            Vec4::FloatType mX;
+            Vec4::FloatType mY;
+            Vec4::FloatType mZ;
+        };
+
+        template <typename VectorType>
+        MCORE_INLINE GroupVectors LoadGroupVectors(const VectorType* vectors)
+        {
+            return GroupVectors{
+                Vec4::LoadImmediate(vectors[0].GetX(), vectors[1].GetX(), vectors[2].GetX(), vectors[3].GetX()),
+                Vec4::LoadImmediate(vectors[0].GetY(), vectors[1].GetY(), vectors[2].GetY(), vectors[3].GetY()),
+                Vec4::LoadImmediate(vectors[0].GetZ(), vectors[1].GetZ(), vectors[2].GetZ(), vectors[3].GetZ()) };
+        }
+
+        // Multiply the upper 3x3 part of the blended matrices with the vectors, and add the translation when transforming points.
+        MCORE_INLINE GroupVectors TransformGroupVectors(const Vec4::FloatType* matrix, const GroupVectors& vectors, bool isPoint)
+        {
+            GroupVectors result;
+            Vec4::FloatType* outputs[3] = { &result.mX, &result.mY, &result.mZ };
+            for (uint32 row = 0; row < 3; ++row)
+            {
+                const Vec4::FloatType* rowElements = &matrix[row * 4];
+                const Vec4::FloatType start = isPoint ? rowElements[3] : Vec4::ZeroFloat();
+                *outputs[row] = Vec4::Madd(rowElements[0], vectors.mX, Vec4::Madd(rowElements[1], vectors.mY, Vec4::Madd(rowElements[2], vectors.mZ, start)));
+            }
+            return result;
+        }
+
+        MCORE_INLINE void StoreGroupVectors(const GroupVectors& vectors, AZ::Vector3* outVectors)
+        {
+            AZ_ALIGN(float x[4], 16);
+            AZ_ALIGN(float y[4], 16);
+            AZ_ALIGN(float z[4], 16);
+            Vec4::StoreAligned(x, vectors.mX);
+            Vec4::StoreAligned(y, vectors.mY);
+            Vec4::StoreAligned(z, vectors.mZ);
+            for (uint32 i = 0; i < 4; ++i)
+            {
+                outVectors[i].Set(x[i], y[i], z[i]);
+            }
+        }
+
+        MCORE_INLINE void StoreGroupVectors(const GroupVectors& vectors, AZ::Vector4* outVectors)
+        {
+            AZ_ALIGN(float x[4], 16);
+            AZ_ALIGN(float y[4], 16);
+            AZ_ALIGN(float z[4], 16);
+            Vec4::StoreAligned(x, vectors.mX);
+            Vec4::StoreAligned(y, vectors.mY);
+            Vec4::StoreAligned(z, vectors.mZ);
+            for (uint32 i = 0; i < 4; ++i)
+            {
+                outVectors[i].Set(x[i], y[i], z[i], outVectors[i].GetW());
+            }
+        }
+    }
+
+
     AZ_CLASS_ALLOCATOR_IMPL(SoftSkinDeformer, DeformerAllocator, 0)
 
     // constructor
@@ -35,6 +106,10 @@ namespace EMotionFX
     {
         mNodeNumbers.clear();
         mBoneMatrices.clear();
+        mBoneElements.clear();
+        mGroupOffsets.clear();
+        mInfluenceBones.clear();
+        mInfluenceWeights.clear();
     }
 
 
@@ -66,8 +141,13 @@ namespace EMotionFX
         SoftSkinDeformer* result = aznew SoftSkinDeformer(mesh);
 
         // copy the bone info (for precalc/optimization reasons)
-        result->mNodeNumbers    = mNodeNumbers;
-        result->mBoneMatrices   = mBoneMatrices;
+        result->mNodeNumbers        = mNodeNumbers;
+        result->mBoneMatrices       = mBoneMatrices;
+        result->mBoneElements       = mBoneElements;
+        result->mGroupOffsets       = mGroupOffsets;
+        result->mInfluenceBones     = mInfluenceBones;
+        result->mInfluenceWeights   = mInfluenceWeights;
+        result->mSkinPositionsOnly  = mSkinPositionsOnly;
 
         // return the result
         return result;
@@ -86,10 +166,12 @@ namespace EMotionFX
 
         // precalc the skinning matrices
         const size_t numBones = mBoneMatrices.size();
+        mBoneElements.resize(numBones * s_numMatrixElements);
         for (size_t i = 0; i < numBones; i++)
         {
             const uint32 nodeIndex = mNodeNumbers[i];
             mBoneMatrices[i] = skinningMatrices[nodeIndex];
+            mBoneMatrices[i].StoreToRowMajorFloat12(&mBoneElements[i * s_numMatrixElements]);
         }
 
         // find the skinning layer
@@ -102,7 +184,112 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(mMesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(mMesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(mMesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, mMesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+        if (mSkinPositionsOnly || actorInstance->GetSkinPositionsOnly())
+        {
+            normals     = nullptr;
+            tangents    = nullptr;
+            bitangents  = nullptr;
+        }
+
+        // Small meshes are not worth the job overhead.
+        const uint32 numVertices = mMesh->GetNumVertices();
+        if (numVertices <= s_numVerticesPerBatch)
+        {
+            SkinBatch(0, numVertices, positions, normals, tangents, bitangents, orgVerts, layer);
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+
+        // Split up the skinned vertices into batches and skin them simultaneously.
+        for (uint32 startVertex = 0; startVertex < numVertices; startVertex += s_numVerticesPerBatch)
+        {
+            const uint32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer]()
+                {
+                    SkinBatch(startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+                }, /*isAutoDelete=*/true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    void SoftSkinDeformer::SkinBatch(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+    {
+        AZ_Assert(startVertex % s_numVerticesPerGroup == 0, "The start vertex has to be at the start of a vertex group.");
+
+        // The influence tables only cover complete groups, the vertices after the last group get skinned one by one.
+        const uint32 numGroups = mGroupOffsets.empty() ? 0 : static_cast<uint32>(mGroupOffsets.size()) - 1;
+        const uint32 startGroup = startVertex / s_numVerticesPerGroup;
+        const uint32 endGroup = AZStd::min(endVertex / s_numVerticesPerGroup, numGroups);
+        if (startGroup < endGroup)
+        {
+            SkinVertexGroups(startGroup, endGroup, positions, normals, tangents, bitangents);
+        }
+
+        const uint32 firstRemainingVertex = AZStd::max(startVertex, endGroup * s_numVerticesPerGroup);
+        if (firstRemainingVertex < endVertex)
+        {
+            SkinVertexRange(firstRemainingVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+    }
+
+
+    void SoftSkinDeformer::SkinVertexGroups(uint32 startGroup, uint32 endGroup, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const
+    {
+        static_assert(s_numVerticesPerGroup == 4, "The kernel processes one vertex per SIMD lane.");
+
+        const float* boneElements = mBoneElements.data();
+        const uint16* influenceBones = mInfluenceBones.data();
+        const float* influenceWeights = mInfluenceWeights.data();
+
+        // Every matrix element holds the blended value of all vertices in the group, one vertex per lane.
+        Vec4::FloatType matrix[s_numMatrixElements];
+        for (uint32 group = startGroup; group < endGroup; ++group)
+        {
+            for (Vec4::FloatType& element : matrix)
+            {
+                element = Vec4::ZeroFloat();
+            }
+
+            // Gather the matrix elements of the bone of each vertex into the lanes, and blend them with the weights of the vertices.
+            const uint32 endSlot = mGroupOffsets[group + 1];
+            for (uint32 slot = mGroupOffsets[group]; slot < endSlot; ++slot)
+            {
+                const uint16* bones = &influenceBones[slot * s_numVerticesPerGroup];
+                const Vec4::FloatType weights = Vec4::LoadUnaligned(&influenceWeights[slot * s_numVerticesPerGroup]);
+                const float* elements0 = &boneElements[bones[0] * s_numMatrixElements];
+                const float* elements1 = &boneElements[bones[1] * s_numMatrixElements];
+                const float* elements2 = &boneElements[bones[2] * s_numMatrixElements];
+                const float* elements3 = &boneElements[bones[3] * s_numMatrixElements];
+                for (uint32 e = 0; e < s_numMatrixElements; ++e)
+                {
+                    matrix[e] = Vec4::Madd(Vec4::LoadImmediate(elements0[e], elements1[e], elements2[e], elements3[e]), weights, matrix[e]);
+                }
+            }
+
+            // Transform the vertex data of the group with the blended matrices.
+            const uint32 firstVertex = group * s_numVerticesPerGroup;
+            StoreGroupVectors(TransformGroupVectors(matrix, LoadGroupVectors(&positions[firstVertex]), /*isPoint=*/true), &positions[firstVertex]);
+            if (normals)
+            {
+                StoreGroupVectors(TransformGroupVectors(matrix, LoadGroupVectors(&normals[firstVertex]), /*isPoint=*/false), &normals[firstVertex]);
+                if (tangents)
+                {
+                    StoreGroupVectors(TransformGroupVectors(matrix, LoadGroupVectors(&tangents[firstVertex]), /*isPoint=*/false), &tangents[firstVertex]);
+                    if (bitangents)
+                    {
+                        StoreGroupVectors(TransformGroupVectors(matrix, LoadGroupVectors(&bitangents[firstVertex]), /*isPoint=*/false), &bitangents[firstVertex]);
+                    }
+                }
+            }
+        }
     }
 
 
@@ -113,8 +300,26 @@ namespace EMotionFX
         AZ::Vector4 tangent, newTangent;
         AZ::Vector3 bitangent, newBitangent;
 
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
+        // if only the positions have to be skinned
+        if (!normals)
+        {
+            for (uint32 v = startVertex; v < endVertex; ++v)
+            {
+                newPos = AZ::Vector3::CreateZero();
+                vtxPos = positions[v];
+
+                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
+                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+                    newPos += influence->GetWeight() * (mBoneMatrices[influence->GetBoneNr()] * vtxPos);
+                }
+
+                positions[v] = newPos;
+            }
+        }
+        else if (tangents && bitangents) // if there are tangents and bitangents to skin
         {
             for (uint32 v = startVertex; v < endVertex; ++v)
             {
@@ -210,6 +415,10 @@ namespace EMotionFX
         // clear the bone information array
         mBoneMatrices.clear();
         mNodeNumbers.clear();
+        mBoneElements.clear();
+        mGroupOffsets.clear();
+        mInfluenceBones.clear();
+        mInfluenceWeights.clear();
 
         // if there is no mesh
         if (mMesh == nullptr)
@@ -257,5 +466,55 @@ namespace EMotionFX
         }
         // get rid of all items in the used bones array
         //  mBones.Shrink();
+
+        mBoneElements.resize(mBoneMatrices.size() * s_numMatrixElements);
+        BuildInfluenceTables(skinningLayer);
+    }
+
+
+    // build the structure of arrays influence tables for the vectorized skinning kernel
+    void SoftSkinDeformer::BuildInfluenceTables(SkinningInfoVertexAttributeLayer* skinningLayer)
+    {
+        const uint32* orgVerts = static_cast<uint32*>(mMesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        if (!skinningLayer || !orgVerts)
+        {
+            return;
+        }
+
+        const uint32 numGroups = mMesh->GetNumVertices() / s_numVerticesPerGroup;
+        mGroupOffsets.reserve(numGroups + 1);
+
+        uint32 numSlots = 0;
+        for (uint32 group = 0; group < numGroups; ++group)
+        {
+            mGroupOffsets.emplace_back(numSlots);
+
+            // the group needs as many slots as the vertex with the most influences
+            const uint32 firstVertex = group * s_numVerticesPerGroup;
+            size_t numGroupSlots = 0;
+            for (uint32 i = 0; i < s_numVerticesPerGroup; ++i)
+            {
+                numGroupSlots = AZStd::max(numGroupSlots, skinningLayer->GetNumInfluences(orgVerts[firstVertex + i]));
+            }
+
+            mInfluenceBones.resize((numSlots + numGroupSlots) * s_numVerticesPerGroup, 0);
+            mInfluenceWeights.resize((numSlots + numGroupSlots) * s_numVerticesPerGroup, 0.0f);
+            for (uint32 i = 0; i < s_numVerticesPerGroup; ++i)
+            {
+                const uint32 orgVertex = orgVerts[firstVertex + i];
+                const size_t numInfluences = skinningLayer->GetNumInfluences(orgVertex);
+                for (size_t a = 0; a < numInfluences; ++a)
+                {
+                    const SkinInfluence* influence = skinningLayer->GetInfluence(orgVertex, a);
+                    const size_t index = (numSlots + a) * s_numVerticesPerGroup + i;
+                    mInfluenceBones[index] = influence->GetBoneNr();
+                    mInfluenceWeights[index] = influence->GetWeight();
+                }
+            }
+
+            numSlots += static_cast<uint32>(numGroupSlots);
+        }
+
+        mGroupOffsets.emplace_back(numSlots);
     }
 } // namespace EMotionFX
@@ -115,10 +115,35 @@ namespace EMotionFX
          */
         MCORE_INLINE void ReserveLocalBones(uint32 numBones)                { mNodeNumbers.reserve(numBones); mBoneMatrices.reserve(numBones); }
 
+        /**
+         * Enable or disable position only skinning.
+         * When enabled only the vertex positions get skinned, while normals, tangents and bitangents keep their original values.
+         * This is useful when the skinned mesh is only used for things like hit detection and is never rendered, such as on dedicated servers.
+         * Position only skinning can also be enabled per actor instance, using ActorInstance::SetSkinPositionsOnly().
+         * @param positionsOnly Set to true to only skin positions, false to skin all vertex data (default).
+         */
+        MCORE_INLINE void SetSkinPositionsOnly(bool positionsOnly)          { mSkinPositionsOnly = positionsOnly; }
+
+        /**
+         * Check whether only the vertex positions get skinned.
+         * @result Returns true when normals, tangents and bitangents are not skinned, otherwise false.
+         */
+        MCORE_INLINE bool GetSkinPositionsOnly() const                      { return mSkinPositionsOnly; }
+
+        //! Number of vertices processed together by the vectorized skinning kernel.
+        static constexpr uint32 s_numVerticesPerGroup = 4;
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning. This is a multiple of the group size.
+        static constexpr uint32 s_numVerticesPerBatch = 8192;
 
     protected:
         AZStd::vector<AZ::Matrix3x4>    mBoneMatrices;
         AZStd::vector<uint32>           mNodeNumbers;
+        AZStd::vector<float>            mBoneElements;          /**< The row major elements of the skinning matrices, twelve per local bone, which the vectorized kernel gathers per vertex. */
+        AZStd::vector<uint32>           mGroupOffsets;          /**< The first influence slot of each group of vertices, with one extra entry at the end. */
+        AZStd::vector<uint16>           mInfluenceBones;        /**< The local bone numbers per influence slot, one for each vertex in the group. */
+        AZStd::vector<float>            mInfluenceWeights;      /**< The weights per influence slot, one for each vertex in the group. Unused slots have a weight of zero. */
+        bool                            mSkinPositionsOnly = false;
 
         /**
          * Default constructor.
@@ -150,6 +175,37 @@ namespace EMotionFX
             return MCORE_INVALIDINDEX32;
         }
 
+        /**
+         * Build the influence tables used by the vectorized kernel.
+         * The influences of every group of s_numVerticesPerGroup vertices are stored as structure of arrays. Each influence slot holds
+         * the bone number and weight of every vertex in the group, and vertices with less influences than others in their group are padded with zero weights.
+         * This has to be called after the bone numbers of the influences got assigned.
+         * @param skinningLayer The skinning layer of the mesh.
+         */
+        void BuildInfluenceTables(SkinningInfoVertexAttributeLayer* skinningLayer);
+
+        /**
+         * Skin a batch of vertices. The groups of vertices inside the batch are skinned by the vectorized kernel, while the remaining vertices are skinned one by one.
+         * Normals, tangents and bitangents are skipped when passing nullptr for the normals.
+         * @param startVertex The first vertex to skin, which must be a multiple of s_numVerticesPerGroup.
+         * @param endVertex The vertex after the last one to skin.
+         */
+        void SkinBatch(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin groups of s_numVerticesPerGroup vertices using the influence tables.
+         * Each vertex of a group occupies one SIMD lane. For every influence slot the matrix elements of the bones of the four vertices are gathered
+         * into the lanes and blended with their weights, after which the vertex data of the group is transposed into lanes and transformed at once.
+         * Normals, tangents and bitangents are skipped when passing nullptr for the normals.
+         * @param startGroup The first group to skin.
+         * @param endGroup The group after the last one to skin.
+         */
+        void SkinVertexGroups(uint32 startGroup, uint32 endGroup, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const;
+
+        /**
+         * Skin a range of vertices one by one, directly from the skinning layer.
+         * Normals, tangents and bitangents are skipped when passing nullptr for the normals.
+         */
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
     };
 } // namespace EMotionFX
@@ -14,6 +14,7 @@ set(FILES
     Source/ActorInstanceBus.h
     Source/ActorManager.cpp
     Source/ActorManager.h
+    Source/ActorUpdateScheduler.cpp
     Source/ActorUpdateScheduler.h
     Source/Algorithms.h
     Source/Allocators.cpp
@@ -125,6 +126,8 @@ set(FILES
     Source/Skeleton.h
     Source/SkinningInfoVertexAttributeLayer.cpp
     Source/SkinningInfoVertexAttributeLayer.h
+    Source/SoAPose.cpp
+    Source/SoAPose.h
     Source/SoftSkinDeformer.cpp
     Source/SoftSkinDeformer.h
     Source/SoftSkinManager.cpp
@@ -189,6 +192,8 @@ set(FILES
     Source/AnimGraphPose.h
     Source/AnimGraphPosePool.cpp
     Source/AnimGraphPosePool.h
+    Source/AnimGraphProgram.cpp
+    Source/AnimGraphProgram.h
     Source/AnimGraphRefCountedData.h
     Source/AnimGraphRefCountedDataPool.cpp
     Source/AnimGraphRefCountedDataPool.h
@@ -345,6 +350,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
@@ -97,6 +97,7 @@ namespace MCore
 
         MCORE_INLINE uint32 Increment()             { return mAtomic++; }
         MCORE_INLINE uint32 Decrement()             { return mAtomic--; }
+        MCORE_INLINE uint32 Add(uint32 value)       { return mAtomic.fetch_add(value); }
 
     private:
         AZStd::atomic<uint32> mAtomic;
@@ -337,6 +337,9 @@ namespace EMotionFX
                     m_renderActorInstance->SetIsVisible(m_configuration.m_renderCharacter);
                 }
             }
+
+            // Without a render actor instance, such as on dedicated servers, the skinned meshes are never rendered and only the positions are needed.
+            m_actorInstance->SetSkinPositionsOnly(!m_renderActorInstance);
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -14,5 +14,8 @@ namespace EMotionFX::Integration
     public:
         static inline int emfx_updateEnabled = 1;
         static inline int emfx_actorRenderEnabled = 1;
+        static inline int emfx_updateLODEnabled = 0;
+        static inline float emfx_updateLODNearDistance = 20.0f;
+        static inline float emfx_updateLODFarDistance = 50.0f;
     };
 };
@@ -15,9 +15,12 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Utils/Utils.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/CharacterBus.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/SingleThreadScheduler.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
@@ -585,6 +588,13 @@ namespace EMotionFX
 
             REGISTER_CVAR2("emfx_updateEnabled", &CVars::emfx_updateEnabled, 1, VF_DEV_ONLY, "Enable main EMFX update");
             REGISTER_CVAR2("emfx_actorRenderEnabled", &CVars::emfx_actorRenderEnabled, 1, VF_DEV_ONLY, "Enable ActorRenderNode rendering");
+            REGISTER_CVAR2("emfx_updateLODEnabled", &CVars::emfx_updateLODEnabled, 0, VF_NULL,
+                "Evaluate the anim graphs of actors further away from the active camera, or not visible, at a reduced rate");
+            REGISTER_CVAR2("emfx_updateLODNearDistance", &CVars::emfx_updateLODNearDistance, 20.0f, VF_NULL,
+                "Actors up to this distance from the active camera are evaluated every frame with all anim graph nodes");
+            REGISTER_CVAR2("emfx_updateLODFarDistance", &CVars::emfx_updateLODFarDistance, 50.0f, VF_NULL,
+                "Actors up to this distance from the active camera are evaluated every second frame without optional anim graph nodes, "
+                "those further away every fourth frame");
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -592,6 +602,9 @@ namespace EMotionFX
         {
             gEnv->pConsole->UnregisterVariable("emfx_updateEnabled");
             gEnv->pConsole->UnregisterVariable("emfx_actorRenderEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLODEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLODNearDistance");
+            gEnv->pConsole->UnregisterVariable("emfx_updateLODFarDistance");
 
 #if !defined(AZ_MONOLITHIC_BUILD)
             gEnv = nullptr;
@@ -638,6 +651,7 @@ namespace EMotionFX
             if (CVars::emfx_updateEnabled)
             {
                 // Main EMotionFX runtime update.
+                UpdateActorUpdateLOD();
                 GetEMotionFX().Update(realDelta);
             }
 
@@ -666,6 +680,7 @@ namespace EMotionFX
             if (CVars::emfx_updateEnabled)
             {
                 // Main EMotionFX runtime update.
+                UpdateActorUpdateLOD();
                 GetEMotionFX().Update(delta);
             }
 #endif
@@ -738,6 +753,42 @@ namespace EMotionFX
             }
         }
 
+        void SystemComponent::UpdateActorUpdateLOD()
+        {
+            ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            if (!scheduler)
+            {
+                return;
+            }
+
+            // Only apply changed settings, as that resets the update LOD statistics.
+            const bool enabled = CVars::emfx_updateLODEnabled != 0;
+            const float nearDistance = AZ::GetMax(CVars::emfx_updateLODNearDistance, 0.0f);
+            const float farDistance = AZ::GetMax(CVars::emfx_updateLODFarDistance, nearDistance);
+            const UpdateLODSettings& currentSettings = scheduler->GetUpdateLODSettings();
+            if (currentSettings.m_enabled != enabled ||
+                currentSettings.m_buckets.size() != 3 ||
+                currentSettings.m_buckets[0].m_maxDistance != nearDistance ||
+                currentSettings.m_buckets[1].m_maxDistance != farDistance)
+            {
+                UpdateLODSettings settings;
+                settings.m_enabled = enabled;
+                settings.m_buckets = {
+                    UpdateLODBucket{ nearDistance, 1, true },
+                    UpdateLODBucket{ farDistance, 2, false },
+                    UpdateLODBucket{ AZStd::numeric_limits<float>::max(), 4, false }
+                };
+                scheduler->SetUpdateLODSettings(settings);
+            }
+
+            if (enabled && Camera::ActiveCameraRequestBus::HasHandlers())
+            {
+                AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+                Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+                scheduler->SetUpdateLODReferencePoint(cameraTransform.GetTranslation());
+            }
+        }
+
         int SystemComponent::GetTickOrder()
         {
             return AZ::TICK_ANIMATION;
@@ -106,6 +106,9 @@ namespace EMotionFX
             void RegisterAssetTypesAndHandlers();
             void SetMediaRoot(const char* alias);
 
+            // Apply the update LOD cvars to the actor update scheduler and measure its distances from the active camera.
+            void UpdateActorUpdateLOD();
+
 #if defined (EMOTIONFXANIMATION_EDITOR)
             void UpdateAnimationEditorPlugins(float delta);
             void NotifyRegisterViews() override;
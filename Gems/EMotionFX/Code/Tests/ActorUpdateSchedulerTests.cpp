@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    class ActorUpdateSchedulerLODFixture
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            // Use the scheduler type of the test parameter, before creating any actor instances.
+            ActorUpdateScheduler* scheduler = nullptr;
+            if (GetParam())
+            {
+                scheduler = MultiThreadScheduler::Create();
+            }
+            else
+            {
+                scheduler = SingleThreadScheduler::Create();
+            }
+            GetEMotionFX().GetActorManager()->SetScheduler(scheduler);
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        ActorInstance* CreateActorInstance(const AZ::Vector3& position, bool isVisible)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            actorInstance->SetLocalSpacePosition(position);
+            actorInstance->SetIsVisible(isVisible);
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+        ActorUpdateScheduler* GetScheduler() const
+        {
+            return GetEMotionFX().GetActorManager()->GetScheduler();
+        }
+
+    protected:
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_P(ActorUpdateSchedulerLODFixture, UpdateLOD_BucketsEvaluateAtTheirInterval)
+    {
+        ActorInstance* nearInstance = CreateActorInstance(AZ::Vector3(1.0f, 0.0f, 0.0f), true);
+        ActorInstance* farInstance = CreateActorInstance(AZ::Vector3(100.0f, 0.0f, 0.0f), true);
+        ActorInstance* hiddenInstance = CreateActorInstance(AZ::Vector3(1.0f, 0.0f, 0.0f), false);
+
+        // Update once without LOD, so that the world transforms the buckets are chosen on are up to date.
+        GetEMotionFX().Update(0.0f);
+
+        UpdateLODSettings settings;
+        settings.m_enabled = true;
+        settings.m_buckets.push_back({ 10.0f, 1, true });
+        settings.m_buckets.push_back({ 50.0f, 4, false });
+        settings.m_invisibleBucket = { 0.0f, 8, false };
+        ActorUpdateScheduler* scheduler = GetScheduler();
+        scheduler->SetUpdateLODSettings(settings);
+        scheduler->SetUpdateLODReferencePoint(AZ::Vector3::CreateZero());
+        ASSERT_EQ(scheduler->GetNumUpdateLODBuckets(), 3);
+
+        AZStd::vector<uint32> numEvaluated(scheduler->GetNumUpdateLODBuckets(), 0);
+        const uint32 numFrames = 8;
+        for (uint32 frame = 0; frame < numFrames; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+
+            for (uint32 bucket = 0; bucket < scheduler->GetNumUpdateLODBuckets(); ++bucket)
+            {
+                const UpdateLODStats stats = scheduler->GetUpdateLODStats(bucket);
+                EXPECT_EQ(stats.m_numActorInstances, 1) << "Bucket " << bucket << " should hold a single actor instance.";
+                numEvaluated[bucket] += stats.m_numEvaluated;
+            }
+        }
+
+        // Actor instances beyond the last bucket distance use the last bucket.
+        EXPECT_EQ(numEvaluated[0], 8);
+        EXPECT_EQ(numEvaluated[1], 2);
+        EXPECT_EQ(numEvaluated[2], 1);
+
+        EXPECT_TRUE(nearInstance->GetOptionalAnimGraphNodesEnabled());
+        EXPECT_FALSE(farInstance->GetOptionalAnimGraphNodesEnabled());
+        EXPECT_FALSE(hiddenInstance->GetOptionalAnimGraphNodesEnabled());
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 3);
+    }
+
+    TEST_P(ActorUpdateSchedulerLODFixture, UpdateLOD_Disabled_UpdatesEveryFrame)
+    {
+        ActorInstance* farInstance = CreateActorInstance(AZ::Vector3(100.0f, 0.0f, 0.0f), true);
+        GetEMotionFX().Update(0.0f);
+
+        UpdateLODSettings settings;
+        settings.m_buckets.push_back({ 10.0f, 4, false });
+        ActorUpdateScheduler* scheduler = GetScheduler();
+        scheduler->SetUpdateLODSettings(settings);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetUpdateLODStats(0).m_numActorInstances, 0) << "No bucket statistics are gathered while the update LOD is disabled.";
+        EXPECT_TRUE(farInstance->GetOptionalAnimGraphNodesEnabled());
+
+        settings.m_enabled = true;
+        scheduler->SetUpdateLODSettings(settings);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetUpdateLODStats(0).m_numActorInstances, 1);
+        EXPECT_FALSE(farInstance->GetOptionalAnimGraphNodesEnabled());
+
+        // Out of range buckets return empty statistics.
+        EXPECT_EQ(scheduler->GetUpdateLODStats(scheduler->GetNumUpdateLODBuckets()).m_numActorInstances, 0);
+    }
+
+    INSTANTIATE_TEST_CASE_P(ActorUpdateSchedulerLOD, ActorUpdateSchedulerLODFixture, ::testing::Bool());
+} // namespace EMotionFX
@@ -0,0 +1,587 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphBindPoseNode.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphPosePool.h>
+#include <EMotionFX/Source/AnimGraphProgram.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeBlendNNode.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/ThreadData.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/AnimGraphFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    // Outputs the bind pose with the position and rotation of every joint derived from an identification value.
+    class ProgramTestInputNode
+        : public AnimGraphNode
+    {
+    public:
+        AZ_RTTI(ProgramTestInputNode, "{5C3E0D4B-43A7-4A1C-9D8C-7A6B1E8C2F31}", AnimGraphNode)
+
+        enum
+        {
+            OUTPUTPORT_RESULT = 0
+        };
+
+        ProgramTestInputNode(float value)
+            : AnimGraphNode()
+            , m_identificationValue(value)
+        {
+            InitOutputPorts(1);
+            SetupOutputPortAsPose("Output Pose", OUTPUTPORT_RESULT, OUTPUTPORT_RESULT);
+        }
+
+        bool GetHasOutputPose() const override { return true; }
+        const char* GetPaletteName() const override { return "ProgramTestInputNode"; }
+        AnimGraphObject::ECategory GetPaletteCategory() const override { return AnimGraphObject::CATEGORY_SOURCES; }
+        AnimGraphPose* GetMainOutputPose(AnimGraphInstance* animGraphInstance) const override { return GetOutputPose(animGraphInstance, OUTPUTPORT_RESULT)->GetValue(); }
+
+        bool InitAfterLoading(AnimGraph* animGraph) override
+        {
+            if (!AnimGraphNode::InitAfterLoading(animGraph))
+            {
+                return false;
+            }
+
+            InitInternalAttributesForAllInstances();
+
+            Reinit();
+            return true;
+        }
+
+        void Output(AnimGraphInstance* animGraphInstance) override
+        {
+            RequestPoses(animGraphInstance);
+            AnimGraphPose* outputAnimGraphPose = GetOutputPose(animGraphInstance, OUTPUTPORT_RESULT)->GetValue();
+            outputAnimGraphPose->InitFromBindPose(animGraphInstance->GetActorInstance());
+            Pose& outputPose = outputAnimGraphPose->GetPose();
+
+            const AZ::u32 numJoints = outputPose.GetNumTransforms();
+            for (AZ::u32 i = 0; i < numJoints; ++i)
+            {
+                Transform transform = outputPose.GetLocalSpaceTransform(i);
+                transform.mPosition = AZ::Vector3(m_identificationValue, static_cast<float>(i), -m_identificationValue);
+                transform.mRotation = AZ::Quaternion::CreateRotationZ(m_identificationValue + static_cast<float>(i) * 0.1f);
+                outputPose.SetLocalSpaceTransform(i, transform);
+            }
+        }
+
+    private:
+        float m_identificationValue;
+    };
+
+
+    struct AnimGraphProgramTestParam
+    {
+        float m_weightA;
+        float m_weightB;
+        float m_weightRoot;
+        bool m_useMask;
+    };
+
+    /*
+     * Compiles a blend tree with three blend two nodes and compares the output of the compiled program against the regular node output path.
+     * The input nodes can't be compiled, so they are output by the regular node output path, where the second one is read by both inner blend nodes.
+     *
+     * +---------+
+     * | Input 0 +---------------->+---------+
+     * +---------+                 | Blend A +--------->+------------+     +-------+
+     * +---------+     +---------->+---------+          | Blend Root +---->+ Final |
+     * | Input 1 +-----+                           +--->+------------+     +-------+
+     * +---------+     |           +---------+     |
+     * +-----------+   +---------->+ Blend B +-----+
+     * | Bind Pose +-------------->+---------+
+     * +-----------+
+     */
+    class AnimGraphProgramFixture
+        : public AnimGraphFixture
+        , public ::testing::WithParamInterface<AnimGraphProgramTestParam>
+    {
+    public:
+        void ConstructActor() override
+        {
+            m_actor = ActorFactory::CreateAndInit<AllRootJointsActor>(m_numJoints);
+        }
+
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            m_blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            m_blendTree->AddChildNode(finalNode);
+
+            for (uint32 i = 0; i < 2; ++i)
+            {
+                m_inputNodes[i] = aznew ProgramTestInputNode(static_cast<float>(i + 1));
+                m_blendTree->AddChildNode(m_inputNodes[i]);
+            }
+
+            AnimGraphBindPoseNode* bindPoseNode = aznew AnimGraphBindPoseNode();
+            m_blendTree->AddChildNode(bindPoseNode);
+
+            for (uint32 i = 0; i < 3; ++i)
+            {
+                m_blendNodes[i] = aznew BlendTreeBlend2Node();
+                m_blendTree->AddChildNode(m_blendNodes[i]);
+
+                m_weightNodes[i] = aznew BlendTreeFloatConstantNode();
+                m_blendTree->AddChildNode(m_weightNodes[i]);
+                m_blendNodes[i]->AddConnection(m_weightNodes[i], BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_WEIGHT);
+            }
+
+            m_blendNodes[0]->AddConnection(m_inputNodes[0], ProgramTestInputNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_POSE_A);
+            m_blendNodes[0]->AddConnection(m_inputNodes[1], ProgramTestInputNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+            m_blendNodes[1]->AddConnection(bindPoseNode, AnimGraphBindPoseNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_POSE_A);
+            m_blendNodes[1]->AddConnection(m_inputNodes[1], ProgramTestInputNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+            m_blendNodes[2]->AddConnection(m_blendNodes[0], BlendTreeBlend2Node::OUTPUTPORT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_A);
+            m_blendNodes[2]->AddConnection(m_blendNodes[1], BlendTreeBlend2Node::OUTPUTPORT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+            finalNode->AddConnection(m_blendNodes[2], BlendTreeBlend2Node::OUTPUTPORT_POSE, BlendTreeFinalNode::INPUTPORT_POSE);
+
+            if (GetParam().m_useMask)
+            {
+                m_blendNodes[2]->SetWeightedNodeMask({ { "rootJoint1", 1.0f }, { "rootJoint3", 1.0f } });
+            }
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+
+            const AnimGraphProgramTestParam& param = GetParam();
+            m_weightNodes[0]->SetValue(param.m_weightA);
+            m_weightNodes[1]->SetValue(param.m_weightB);
+            m_weightNodes[2]->SetValue(param.m_weightRoot);
+        }
+
+        void EvaluateAndStorePose(AZStd::vector<Transform>& outTransforms, uint32& outNumUsedPoses)
+        {
+            GetEMotionFX().Update(0.0f);
+
+            const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            outTransforms.clear();
+            for (uint32 i = 0; i < m_numJoints; ++i)
+            {
+                outTransforms.emplace_back(pose->GetLocalSpaceTransform(i));
+            }
+
+            outNumUsedPoses = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool().GetNumUsedPoses();
+        }
+
+    protected:
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
+        BlendTree* m_blendTree = nullptr;
+        ProgramTestInputNode* m_inputNodes[2] = { nullptr, nullptr };
+        BlendTreeBlend2Node* m_blendNodes[3] = { nullptr, nullptr, nullptr };
+        BlendTreeFloatConstantNode* m_weightNodes[3] = { nullptr, nullptr, nullptr };
+        uint32 m_numJoints = 5;
+    };
+
+    TEST_P(AnimGraphProgramFixture, CompilesSupportedNodes)
+    {
+        const AnimGraphProgram* program = m_blendTree->GetProgram();
+        ASSERT_NE(program, nullptr);
+
+        for (const BlendTreeBlend2Node* blendNode : m_blendNodes)
+        {
+            EXPECT_TRUE(program->GetIsCompiled(blendNode));
+        }
+        EXPECT_TRUE(program->GetIsCompiled(m_blendTree->GetFinalNode()));
+        EXPECT_FALSE(program->GetIsCompiled(m_inputNodes[0]));
+        EXPECT_FALSE(program->GetIsCompiled(m_inputNodes[1]));
+        EXPECT_EQ(program->GetRootNode(), m_blendTree->GetFinalNode());
+
+        // Blend nodes, the bind pose node and the final node.
+        EXPECT_EQ(program->GetNumInstructions(), 5u);
+
+        // The final node writes into the blend tree output pose, the root blend node reuses the slot of its first input.
+        EXPECT_EQ(program->GetNumSlots(), 2u);
+    }
+
+    TEST_P(AnimGraphProgramFixture, MatchesInterpreter)
+    {
+        AZStd::vector<Transform> compiledTransforms;
+        AZStd::vector<Transform> interpretedTransforms;
+        uint32 compiledNumUsedPoses = 0;
+        uint32 interpretedNumUsedPoses = 0;
+
+        ASSERT_NE(m_blendTree->GetProgram(), nullptr);
+        EvaluateAndStorePose(compiledTransforms, compiledNumUsedPoses);
+
+        m_blendTree->SetProgramEnabled(false);
+        ASSERT_EQ(m_blendTree->GetProgram(), nullptr);
+        EvaluateAndStorePose(interpretedTransforms, interpretedNumUsedPoses);
+
+        // All poses that got requested while outputting, got returned to the pool again.
+        EXPECT_EQ(compiledNumUsedPoses, interpretedNumUsedPoses);
+
+        for (uint32 i = 0; i < m_numJoints; ++i)
+        {
+            EXPECT_TRUE(compiledTransforms[i].mPosition.IsClose(interpretedTransforms[i].mPosition, 0.0001f)) << "Joint " << i;
+            EXPECT_TRUE(compiledTransforms[i].mRotation.IsClose(interpretedTransforms[i].mRotation, 0.0001f)) << "Joint " << i;
+        }
+    }
+
+    TEST_P(AnimGraphProgramFixture, ConnectionChangesReleaseProgram)
+    {
+        ASSERT_NE(m_blendTree->GetProgram(), nullptr);
+
+        m_blendNodes[2]->RemoveConnection(m_blendNodes[1], BlendTreeBlend2Node::OUTPUTPORT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+        EXPECT_EQ(m_blendTree->GetProgram(), nullptr);
+
+        m_blendTree->Reinit();
+        ASSERT_NE(m_blendTree->GetProgram(), nullptr);
+        EXPECT_FALSE(m_blendTree->GetProgram()->GetIsCompiled(m_blendNodes[1]));
+        EXPECT_EQ(m_blendTree->GetProgram()->GetNumInstructions(), 3u);
+    }
+
+    TEST_P(AnimGraphProgramFixture, DISABLED_FiveHundredInstancesPerformance)
+    {
+        const uint32 numInstances = 500;
+        const uint32 numFrames = 100;
+        const float timeDelta = 1.0f / 60.0f;
+
+        AZStd::unique_ptr<Actor> actor = ActorFactory::CreateAndInit<AllRootJointsActor>(100);
+        AZStd::vector<ActorInstance*> actorInstances;
+        actorInstances.reserve(numInstances);
+        for (uint32 i = 0; i < numInstances; ++i)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+            AnimGraphInstance* animGraphInstance = AnimGraphInstance::Create(m_blendTreeAnimGraph.get(), actorInstance, m_motionSet);
+            actorInstance->SetAnimGraphInstance(animGraphInstance);
+            actorInstances.emplace_back(actorInstance);
+        }
+
+        AZ::Debug::Timer timer;
+        float frameTimes[2] = { 0.0f, 0.0f };
+        for (uint32 pass = 0; pass < 2; ++pass)
+        {
+            m_blendTree->SetProgramEnabled(pass == 0);
+            GetEMotionFX().Update(0.0f);
+
+            timer.Stamp();
+            for (uint32 frame = 0; frame < numFrames; ++frame)
+            {
+                GetEMotionFX().Update(timeDelta);
+            }
+            frameTimes[pass] = timer.StampAndGetDeltaTimeInSeconds() / static_cast<float>(numFrames);
+        }
+
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+
+        printf("----------------------------------------------------\n");
+        printf("- Anim Graph Program Performance (%u instances)\n", numInstances);
+        printf("    Compiled Mean Frame:             %.4f ms\n", frameTimes[0] * 1000.0f);
+        printf("    Interpreted Mean Frame:          %.4f ms\n", frameTimes[1] * 1000.0f);
+        printf("    Speedup:                         %.2fx\n", frameTimes[0] > 0.0f ? frameTimes[1] / frameTimes[0] : 0.0f);
+        printf("----------------------------------------------------\n");
+    }
+
+    /*
+     * Compiles a blend tree with a blend N node, of which the second input is a compiled blend two node, and compares the output of the
+     * compiled program against the regular node output path for weights selecting every pair of inputs.
+     *
+     * +---------+
+     * | Input 0 +------------------------------>+---------+
+     * +---------+                               |         |
+     * +---------+     +---------+               |         |     +-------+
+     * | Input 1 +--+->+ Blend 2 +-------------->+ Blend N +---->+ Final |
+     * +---------+  |  |         |               |         |     +-------+
+     * +-----------+|  |         |               |         |
+     * | Bind Pose +|->+---------+               |         |
+     * +-----------+|                            |         |
+     *              +--------------------------->+---------+
+     */
+    class AnimGraphProgramBlendNFixture
+        : public AnimGraphFixture
+        , public ::testing::WithParamInterface<float>
+    {
+    public:
+        void ConstructActor() override
+        {
+            m_actor = ActorFactory::CreateAndInit<AllRootJointsActor>(m_numJoints);
+        }
+
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            m_blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            m_blendTree->AddChildNode(finalNode);
+
+            ProgramTestInputNode* inputNodes[2];
+            for (uint32 i = 0; i < 2; ++i)
+            {
+                inputNodes[i] = aznew ProgramTestInputNode(static_cast<float>(i + 1));
+                m_blendTree->AddChildNode(inputNodes[i]);
+            }
+
+            AnimGraphBindPoseNode* bindPoseNode = aznew AnimGraphBindPoseNode();
+            m_blendTree->AddChildNode(bindPoseNode);
+
+            BlendTreeFloatConstantNode* blend2WeightNode = aznew BlendTreeFloatConstantNode();
+            blend2WeightNode->SetValue(0.5f);
+            m_blendTree->AddChildNode(blend2WeightNode);
+
+            m_blend2Node = aznew BlendTreeBlend2Node();
+            m_blendTree->AddChildNode(m_blend2Node);
+            m_blend2Node->AddConnection(inputNodes[1], ProgramTestInputNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_POSE_A);
+            m_blend2Node->AddConnection(bindPoseNode, AnimGraphBindPoseNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+            m_blend2Node->AddConnection(blend2WeightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_WEIGHT);
+
+            m_weightNode = aznew BlendTreeFloatConstantNode();
+            m_blendTree->AddChildNode(m_weightNode);
+
+            m_blendNNode = aznew BlendTreeBlendNNode();
+            m_blendTree->AddChildNode(m_blendNNode);
+            m_blendNNode->AddConnection(inputNodes[0], ProgramTestInputNode::OUTPUTPORT_RESULT, BlendTreeBlendNNode::INPUTPORT_POSE_0);
+            m_blendNNode->AddConnection(m_blend2Node, BlendTreeBlend2Node::OUTPUTPORT_POSE, BlendTreeBlendNNode::INPUTPORT_POSE_1);
+            m_blendNNode->AddConnection(inputNodes[1], ProgramTestInputNode::OUTPUTPORT_RESULT, BlendTreeBlendNNode::INPUTPORT_POSE_2);
+            m_blendNNode->AddConnection(m_weightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlendNNode::INPUTPORT_WEIGHT);
+            m_blendNNode->UpdateParamWeights();
+            m_blendNNode->SetParamWeightsEquallyDistributed(0.0f, 1.0f);
+
+            finalNode->AddConnection(m_blendNNode, BlendTreeBlendNNode::OUTPUTPORT_POSE, BlendTreeFinalNode::INPUTPORT_POSE);
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+            m_weightNode->SetValue(GetParam());
+        }
+
+        void EvaluateAndStorePose(AZStd::vector<Transform>& outTransforms, uint32& outNumUsedPoses)
+        {
+            GetEMotionFX().Update(0.0f);
+
+            const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            outTransforms.clear();
+            for (uint32 i = 0; i < m_numJoints; ++i)
+            {
+                outTransforms.emplace_back(pose->GetLocalSpaceTransform(i));
+            }
+
+            outNumUsedPoses = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool().GetNumUsedPoses();
+        }
+
+    protected:
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
+        BlendTree* m_blendTree = nullptr;
+        BlendTreeBlend2Node* m_blend2Node = nullptr;
+        BlendTreeBlendNNode* m_blendNNode = nullptr;
+        BlendTreeFloatConstantNode* m_weightNode = nullptr;
+        uint32 m_numJoints = 5;
+    };
+
+    TEST_P(AnimGraphProgramBlendNFixture, CompilesBlendN)
+    {
+        const AnimGraphProgram* program = m_blendTree->GetProgram();
+        ASSERT_NE(program, nullptr);
+        EXPECT_TRUE(program->GetIsCompiled(m_blendNNode));
+        EXPECT_TRUE(program->GetIsCompiled(m_blend2Node));
+
+        // The bind pose, blend two, blend N and final node.
+        EXPECT_EQ(program->GetNumInstructions(), 4u);
+    }
+
+    TEST_P(AnimGraphProgramBlendNFixture, MatchesInterpreter)
+    {
+        AZStd::vector<Transform> compiledTransforms;
+        AZStd::vector<Transform> interpretedTransforms;
+        uint32 compiledNumUsedPoses = 0;
+        uint32 interpretedNumUsedPoses = 0;
+
+        ASSERT_NE(m_blendTree->GetProgram(), nullptr);
+        EvaluateAndStorePose(compiledTransforms, compiledNumUsedPoses);
+
+        m_blendTree->SetProgramEnabled(false);
+        ASSERT_EQ(m_blendTree->GetProgram(), nullptr);
+        EvaluateAndStorePose(interpretedTransforms, interpretedNumUsedPoses);
+
+        EXPECT_EQ(compiledNumUsedPoses, interpretedNumUsedPoses);
+        for (uint32 i = 0; i < m_numJoints; ++i)
+        {
+            EXPECT_TRUE(compiledTransforms[i].mPosition.IsClose(interpretedTransforms[i].mPosition, 0.0001f)) << "Joint " << i;
+            EXPECT_TRUE(compiledTransforms[i].mRotation.IsClose(interpretedTransforms[i].mRotation, 0.0001f)) << "Joint " << i;
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(AnimGraphProgram,
+        AnimGraphProgramBlendNFixture,
+        ::testing::Values(0.0f, 0.25f, 0.5f, 0.8f, 1.0f));
+
+    /*
+     * Compiles a blend tree blending two motion nodes, which sample their motions straight into the pose slots of the program,
+     * and compares the output of the compiled program against the regular node output path.
+     *
+     * +----------+
+     * | Motion 0 +---->+---------+     +-------+
+     * +----------+     | Blend 2 +---->+ Final |
+     * | Motion 1 +---->+---------+     +-------+
+     * +----------+
+     */
+    class AnimGraphProgramMotionFixture
+        : public AnimGraphFixture
+        , public ::testing::WithParamInterface<float>
+    {
+    public:
+        void ConstructActor() override
+        {
+            m_actor = ActorFactory::CreateAndInit<AllRootJointsActor>(m_numJoints);
+        }
+
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            m_blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            m_blendTree->AddChildNode(finalNode);
+
+            m_weightNode = aznew BlendTreeFloatConstantNode();
+            m_blendTree->AddChildNode(m_weightNode);
+
+            m_blend2Node = aznew BlendTreeBlend2Node();
+            m_blendTree->AddChildNode(m_blend2Node);
+            for (uint32 i = 0; i < 2; ++i)
+            {
+                m_motionNodes[i] = aznew AnimGraphMotionNode();
+                m_blendTree->AddChildNode(m_motionNodes[i]);
+                m_blend2Node->AddConnection(m_motionNodes[i], AnimGraphMotionNode::OUTPUTPORT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_A + i);
+            }
+            m_blend2Node->AddConnection(m_weightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_WEIGHT);
+
+            finalNode->AddConnection(m_blend2Node, BlendTreeBlend2Node::OUTPUTPORT_POSE, BlendTreeFinalNode::INPUTPORT_POSE);
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            for (uint32 i = 0; i < 2; ++i)
+            {
+                const AZStd::string motionId = AZStd::string::format("programTestMotion%u", i);
+                AddMotionEntry(motionId, 1.0f);
+                m_motionNodes[i]->AddMotionId(motionId);
+            }
+
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+            m_weightNode->SetValue(GetParam());
+        }
+
+    protected:
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
+        BlendTree* m_blendTree = nullptr;
+        AnimGraphMotionNode* m_motionNodes[2] = { nullptr, nullptr };
+        BlendTreeBlend2Node* m_blend2Node = nullptr;
+        BlendTreeFloatConstantNode* m_weightNode = nullptr;
+        uint32 m_numJoints = 5;
+    };
+
+    TEST_P(AnimGraphProgramMotionFixture, CompilesMotionNodes)
+    {
+        const AnimGraphProgram* program = m_blendTree->GetProgram();
+        ASSERT_NE(program, nullptr);
+        EXPECT_TRUE(program->GetIsCompiled(m_motionNodes[0]));
+        EXPECT_TRUE(program->GetIsCompiled(m_motionNodes[1]));
+        EXPECT_TRUE(program->GetIsCompiled(m_blend2Node));
+
+        // The motion nodes, the blend node and the final node. The blend node reuses the slot of the first motion.
+        EXPECT_EQ(program->GetNumInstructions(), 4u);
+        EXPECT_EQ(program->GetNumSlots(), 2u);
+    }
+
+    TEST_P(AnimGraphProgramMotionFixture, MatchesInterpreter)
+    {
+        const auto evaluate = [this](AZStd::vector<Transform>& outTransforms, uint32& outNumUsedPoses)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+
+            const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            outTransforms.clear();
+            for (uint32 i = 0; i < m_numJoints; ++i)
+            {
+                outTransforms.emplace_back(pose->GetLocalSpaceTransform(i));
+            }
+
+            outNumUsedPoses = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool().GetNumUsedPoses();
+        };
+
+        AZStd::vector<Transform> compiledTransforms;
+        AZStd::vector<Transform> interpretedTransforms;
+        uint32 compiledNumUsedPoses = 0;
+        uint32 interpretedNumUsedPoses = 0;
+
+        ASSERT_NE(m_blendTree->GetProgram(), nullptr);
+        evaluate(compiledTransforms, compiledNumUsedPoses);
+
+        m_blendTree->SetProgramEnabled(false);
+        ASSERT_EQ(m_blendTree->GetProgram(), nullptr);
+        evaluate(interpretedTransforms, interpretedNumUsedPoses);
+
+        EXPECT_EQ(compiledNumUsedPoses, interpretedNumUsedPoses);
+        for (uint32 i = 0; i < m_numJoints; ++i)
+        {
+            EXPECT_TRUE(compiledTransforms[i].mPosition.IsClose(interpretedTransforms[i].mPosition, 0.0001f)) << "Joint " << i;
+            EXPECT_TRUE(compiledTransforms[i].mRotation.IsClose(interpretedTransforms[i].mRotation, 0.0001f)) << "Joint " << i;
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(AnimGraphProgram,
+        AnimGraphProgramMotionFixture,
+        ::testing::Values(0.0f, 0.5f, 1.0f));
+
+    static const std::vector<AnimGraphProgramTestParam> animGraphProgramTestData
+    {
+        { 0.0f, 0.0f, 0.0f, false },
+        { 1.0f, 1.0f, 1.0f, false },
+        { 0.25f, 0.75f, 0.5f, false },
+        { 0.5f, 0.0f, 1.0f, false },
+        { 0.0f, 1.0f, 0.3f, false },
+        { 0.25f, 0.75f, 0.5f, true },
+        { 0.5f, 0.5f, 0.0f, true },
+        { 0.5f, 0.5f, 1.0f, true }
+    };
+
+    INSTANTIATE_TEST_CASE_P(AnimGraphProgram,
+        AnimGraphProgramFixture,
+        ::testing::ValuesIn(animGraphProgramTestData));
+} // namespace EMotionFX
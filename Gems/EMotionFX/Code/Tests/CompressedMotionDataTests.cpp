@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+
+            // One second of motion for a joint of the actor, with a moving and rotating joint, plus a morph and float channel.
+            const Transform bindTransform = Transform::CreateIdentity();
+            m_sourceData.AddJoint("l_upLeg", bindTransform, bindTransform);
+            m_sourceData.AddJoint("l_loLeg", bindTransform, bindTransform);
+            m_sourceData.AddMorph("morph", 0.0f);
+            m_sourceData.AddFloat("float", 0.0f);
+
+            const size_t numKeys = 11;
+            m_sourceData.AllocateJointPositionSamples(0, numKeys);
+            m_sourceData.AllocateJointRotationSamples(0, numKeys);
+            m_sourceData.AllocateJointPositionSamples(1, numKeys);
+            m_sourceData.AllocateMorphSamples(0, numKeys);
+            m_sourceData.AllocateFloatSamples(0, numKeys);
+            for (size_t i = 0; i < numKeys; ++i)
+            {
+                const float time = i / static_cast<float>(numKeys - 1);
+                m_sourceData.SetJointPositionSample(0, i, { time, AZ::Vector3(time * 2.0f, 1.0f - time, 0.5f) });
+                m_sourceData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(time * AZ::Constants::HalfPi) });
+                m_sourceData.SetJointPositionSample(1, i, { time, AZ::Vector3(0.0f, 0.0f, (i % 2) * 0.0001f) }); // Barely moves.
+                m_sourceData.SetMorphSample(0, i, { time, time });
+                m_sourceData.SetFloatSample(0, i, { time, time * 10.0f });
+            }
+            m_sourceData.UpdateDuration();
+            ASSERT_TRUE(m_sourceData.VerifyIntegrity());
+        }
+
+        void TearDown() override
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+        // Compare the samples at every key of the compressed data against the source data.
+        void VerifyMatchesSource(const CompressedMotionData& motionData, float maxPosError, float maxRotErrorInDegrees, float maxFloatError) const
+        {
+            for (size_t s = 0; s < motionData.GetNumSamples(); ++s)
+            {
+                const float time = s * motionData.GetSampleSpacing();
+                for (size_t j = 0; j < m_sourceData.GetNumJoints(); ++j)
+                {
+                    const AZ::Vector3 position = motionData.SampleJointPosition(time, j);
+                    EXPECT_LE(position.GetDistance(m_sourceData.SampleJointPosition(time, j)), maxPosError) << "Joint " << j << " at time " << time;
+
+                    const AZ::Quaternion rotation = motionData.SampleJointRotation(time, j);
+                    const float dot = AZ::GetMin(AZ::GetAbs(rotation.Dot(m_sourceData.SampleJointRotation(time, j))), 1.0f);
+                    EXPECT_LE(AZ::RadToDeg(2.0f * acosf(dot)), maxRotErrorInDegrees) << "Joint " << j << " at time " << time;
+                }
+
+                EXPECT_NEAR(motionData.SampleMorph(time, 0), m_sourceData.SampleMorph(time, 0), maxFloatError);
+                EXPECT_NEAR(motionData.SampleFloat(time, 0), m_sourceData.SampleFloat(time, 0), maxFloatError * 10.0f);
+            }
+        }
+
+    protected:
+        NonUniformMotionData m_sourceData;
+    };
+
+    TEST_F(CompressedMotionDataTests, InitFromNonUniformData_MatchesSource)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        EXPECT_EQ(motionData.GetNumSamples(), 31);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 1.0f);
+        EXPECT_EQ(motionData.GetNumJoints(), 2);
+        EXPECT_EQ(motionData.GetNumMorphs(), 1);
+        EXPECT_EQ(motionData.GetNumFloats(), 1);
+
+        // Without optimizing, all animated tracks use the highest precision.
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(1));
+        EXPECT_FALSE(motionData.IsJointRotationAnimated(1));
+        EXPECT_EQ(motionData.GetJointPositionNumBits(0), 16);
+        EXPECT_EQ(motionData.GetJointRotationNumBits(0), 16);
+        EXPECT_EQ(motionData.GetMorphNumBits(0), 16);
+        EXPECT_EQ(motionData.GetFloatNumBits(0), 16);
+
+        VerifyMatchesSource(motionData, 0.0001f, 0.01f, 0.0001f);
+
+        const CompressedMotionData::CompressionStats stats = motionData.GetCompressionStats();
+        EXPECT_EQ(stats.m_uncompressedNumBytes, 31 * (3 + 4 + 3 + 1 + 1) * sizeof(float));
+        EXPECT_GT(stats.GetCompressionRatio(), 1.5f);
+        EXPECT_LE(stats.m_maxPosError, 0.0001f);
+        EXPECT_LE(stats.m_maxRotError, 0.01f);
+    }
+
+    TEST_F(CompressedMotionDataTests, Optimize_StaysWithinMaxError)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        const float initialRatio = motionData.GetCompressionStats().GetCompressionRatio();
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.5f;
+        settings.m_maxMorphError = 0.01f;
+        settings.m_maxFloatError = 0.1f;
+        motionData.Optimize(settings);
+
+        EXPECT_EQ(motionData.GetJointPositionNumBits(0), 8);
+        EXPECT_EQ(motionData.GetJointRotationNumBits(0), 8);
+        EXPECT_EQ(motionData.GetMorphNumBits(0), 8);
+        EXPECT_EQ(motionData.GetFloatNumBits(0), 8);
+
+        // The joint that barely moves turned into a static value.
+        EXPECT_FALSE(motionData.IsJointAnimated(1));
+
+        VerifyMatchesSource(motionData, settings.m_maxPosError, settings.m_maxRotError, settings.m_maxMorphError);
+
+        const CompressedMotionData::CompressionStats stats = motionData.GetCompressionStats();
+        EXPECT_GT(stats.GetCompressionRatio(), initialRatio);
+        EXPECT_LE(stats.m_maxPosError, settings.m_maxPosError);
+        EXPECT_LE(stats.m_maxRotError, settings.m_maxRotError);
+        EXPECT_LE(stats.m_maxMorphError, settings.m_maxMorphError);
+        EXPECT_LE(stats.m_maxFloatError, settings.m_maxFloatError);
+    }
+
+    TEST_F(CompressedMotionDataTests, Optimize_IgnoredJointsKeepPrecision)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.5f;
+        settings.m_jointIgnoreList = { 0, 1 };
+        motionData.Optimize(settings);
+
+        EXPECT_EQ(motionData.GetJointPositionNumBits(0), 16);
+        EXPECT_EQ(motionData.GetJointRotationNumBits(0), 16);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(1));
+        VerifyMatchesSource(motionData, 0.0001f, 0.01f, 0.0001f);
+    }
+
+    TEST_F(CompressedMotionDataTests, HighRangeTrack_StoredAsFloats)
+    {
+        // A position track covering 100 km, which 16 bit quantization can't represent within a millimeter.
+        const size_t numKeys = m_sourceData.GetNumJointPositionSamples(0);
+        for (size_t i = 0; i < numKeys; ++i)
+        {
+            const float time = i / static_cast<float>(numKeys - 1);
+            m_sourceData.SetJointPositionSample(0, i, { time, AZ::Vector3(time * 100000.0f, 0.25f * (i % 3), 0.5f) });
+        }
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        EXPECT_EQ(motionData.GetJointPositionNumBits(0), 32);
+        EXPECT_EQ(motionData.GetJointRotationNumBits(0), 16);
+        VerifyMatchesSource(motionData, 0.001f, 0.01f, 0.0001f);
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.5f;
+        motionData.Optimize(settings);
+        EXPECT_EQ(motionData.GetJointPositionNumBits(0), 32);
+        EXPECT_EQ(motionData.GetJointRotationNumBits(0), 8);
+        EXPECT_LE(motionData.GetCompressionStats().m_maxPosError, settings.m_maxPosError);
+        VerifyMatchesSource(motionData, settings.m_maxPosError, settings.m_maxRotError, settings.m_maxMorphError);
+
+        // The float samples survive saving and reading.
+        MCore::MemoryFile file;
+        file.Open();
+        MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedData;
+        file.Seek(0);
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        EXPECT_EQ(loadedData.GetJointPositionNumBits(0), 32);
+        for (size_t s = 0; s < motionData.GetNumSamples(); ++s)
+        {
+            const float time = s * motionData.GetSampleSpacing();
+            EXPECT_THAT(loadedData.SampleJointPosition(time, 0), IsClose(motionData.SampleJointPosition(time, 0)));
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, SamplePose_MatchesSampleJointTransform)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+
+        Pose pose;
+        pose.LinkToActorInstance(m_actorInstance);
+        pose.InitFromBindPose(m_actor.get());
+
+        MotionData::SampleSettings sampleSettings;
+        sampleSettings.m_actorInstance = m_actorInstance;
+        sampleSettings.m_sampleTime = 0.45f;
+        motionData.SamplePose(sampleSettings, &pose);
+
+        const Skeleton* skeleton = m_actor->GetSkeleton();
+        for (size_t j = 0; j < motionData.GetNumJoints(); ++j)
+        {
+            AZ::u32 jointIndex = InvalidIndex32;
+            ASSERT_NE(skeleton->FindNodeAndIndexByName(motionData.GetJointName(j).c_str(), jointIndex), nullptr);
+            EXPECT_THAT(pose.GetLocalSpaceTransform(jointIndex), IsClose(motionData.SampleJointTransform(sampleSettings.m_sampleTime, j)));
+            EXPECT_THAT(pose.GetLocalSpaceTransform(jointIndex), IsClose(motionData.SampleJointTransform(sampleSettings, jointIndex)));
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead_RoundTrip)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        MotionData::OptimizeSettings optimizeSettings;
+        optimizeSettings.m_maxPosError = 0.01f;
+        optimizeSettings.m_maxRotError = 0.5f;
+        motionData.Optimize(optimizeSettings);
+
+        MCore::MemoryFile file;
+        file.Open();
+        MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedData;
+        file.Seek(0);
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+
+        ASSERT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        ASSERT_EQ(loadedData.GetNumJoints(), motionData.GetNumJoints());
+        EXPECT_EQ(loadedData.GetJointName(0), "l_upLeg");
+        EXPECT_EQ(loadedData.GetMorphName(0), "morph");
+        EXPECT_EQ(loadedData.GetFloatName(0), "float");
+        EXPECT_EQ(loadedData.GetCompressionStats().m_compressedNumBytes, motionData.GetCompressionStats().m_compressedNumBytes);
+        EXPECT_FLOAT_EQ(loadedData.GetCompressionStats().GetCompressionRatio(), motionData.GetCompressionStats().GetCompressionRatio());
+
+        for (size_t s = 0; s < motionData.GetNumSamples(); ++s)
+        {
+            const float time = s * motionData.GetSampleSpacing();
+            for (size_t j = 0; j < motionData.GetNumJoints(); ++j)
+            {
+                EXPECT_THAT(loadedData.SampleJointTransform(time, j), IsClose(motionData.SampleJointTransform(time, j)));
+            }
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+            EXPECT_FLOAT_EQ(loadedData.SampleFloat(time, 0), motionData.SampleFloat(time, 0));
+        }
+    }
+} // namespace EMotionFX
@@ -12,6 +12,8 @@
 #include <EMotionFX/Source/AnimGraphStateMachine.h>
 #include <EMotionFX/Source/AnimGraphParameterCondition.h>
 #include <EMotionFX/Source/AnimGraphStateTransition.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
 #include <EMotionFX/Source/BlendTree.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/Importer/Importer.h>
@@ -231,6 +233,41 @@ namespace EMotionFX
     }
 #endif
 
+    TEST_F(MotionExtractionFixtureBase, UpdateLOD_SkippedFrames_ExtractedMotionIsSpread)
+    {
+        m_actorInstance->SetIsVisible(true);
+        GetEMotionFX().Update(0.0f);
+
+        // Evaluate every fourth frame, with the extracted motion spread over the frames in between.
+        UpdateLODSettings settings;
+        settings.m_enabled = true;
+        settings.m_buckets.push_back({ 0.0f, 4, true });
+        ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        scheduler->SetUpdateLODSettings(settings);
+
+        const float timeDelta = 1.0f / 60.0f;
+        const AZ::u32 numFrames = 24;
+        AZ::u32 numEvaluated = 0;
+        float lastPositionY = m_actorInstance->GetWorldSpaceTransform().mPosition.GetY();
+        for (AZ::u32 i = 0; i < numFrames; ++i)
+        {
+            GetEMotionFX().Update(timeDelta);
+            numEvaluated += scheduler->GetUpdateLODStats(0).m_numEvaluated;
+
+            // Once evaluated, the actor instance moves forward every frame instead of only on the frames it evaluates.
+            const float positionY = m_actorInstance->GetWorldSpaceTransform().mPosition.GetY();
+            if (numEvaluated > 0)
+            {
+                EXPECT_GT(positionY, lastPositionY) << "The actor instance didn't move in frame " << i;
+            }
+            lastPositionY = positionY;
+        }
+        EXPECT_EQ(numEvaluated, numFrames / 4);
+
+        settings.m_enabled = false;
+        scheduler->SetUpdateLODSettings(settings);
+    }
+
     TEST_P(MotionExtractionFixture, ReverseRotationMotionExtractionOutputsCorrectDelta)
     {
         // Test motion extraction with reverse effect on and off, rotation to 90 degrees left and right
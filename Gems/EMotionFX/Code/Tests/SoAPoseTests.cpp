@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/string/conversions.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraphPosePool.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoAPose.h>
+#include <EMotionFX/Source/ThreadData.h>
+#include <EMotionFX/Source/Transform.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    // An actor with a branching hierarchy, where every joint has up to three child joints.
+    class BranchingJointsActor
+        : public Actor
+    {
+    public:
+        explicit BranchingJointsActor(size_t jointCount, const char* name = "Test actor")
+            : Actor(name)
+        {
+            for (uint32 i = 0; i < jointCount; ++i)
+            {
+                const uint32 parentIndex = (i == 0) ? MCORE_INVALIDINDEX32 : (i - 1) / 3;
+                AddNode(i, ("joint" + AZStd::to_string(i)).c_str(), parentIndex);
+                GetBindPose()->SetLocalSpaceTransform(i, Transform::CreateIdentity());
+            }
+        }
+    };
+
+    class SoAPoseFixture
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<size_t>
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<BranchingJointsActor>(GetParam());
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            m_random.SetSeed(875960);
+        }
+
+        void TearDown() override
+        {
+            m_actorInstance->Destroy();
+            m_actor.reset();
+            SystemComponentFixture::TearDown();
+        }
+
+        float RandomRange(float min, float max)
+        {
+            return min + m_random.GetRandomFloat() * (max - min);
+        }
+
+        Transform CreateRandomTransform()
+        {
+            const AZ::Vector3 axis = AZ::Vector3(RandomRange(-1.0f, 1.0f), RandomRange(-1.0f, 1.0f), RandomRange(0.1f, 1.0f)).GetNormalized();
+            Transform transform(
+                AZ::Vector3(RandomRange(-1.0f, 1.0f), RandomRange(-1.0f, 1.0f), RandomRange(-1.0f, 1.0f)),
+                AZ::Quaternion::CreateFromAxisAngle(axis, RandomRange(-AZ::Constants::Pi, AZ::Constants::Pi)));
+            EMFX_SCALECODE
+            (
+                transform.mScale = AZ::Vector3(RandomRange(0.5f, 1.5f), RandomRange(0.5f, 1.5f), RandomRange(0.5f, 1.5f));
+            )
+            return transform;
+        }
+
+        void InitRandomPose(Pose& pose)
+        {
+            pose.LinkToActorInstance(m_actorInstance);
+            for (uint32 i = 0; i < pose.GetNumTransforms(); ++i)
+            {
+                pose.SetLocalSpaceTransform(i, CreateRandomTransform());
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<BranchingJointsActor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    TEST_P(SoAPoseFixture, InitFromPose_CopyToPose_RoundTrip)
+    {
+        Pose pose;
+        InitRandomPose(pose);
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(pose);
+        EXPECT_EQ(soaPose.GetNumJoints(), pose.GetNumTransforms());
+        EXPECT_EQ(soaPose.GetNumPaddedJoints() % 4, 0);
+        EXPECT_FALSE(soaPose.GetModelSpaceTransformsReady());
+
+        Pose outPose;
+        outPose.LinkToActorInstance(m_actorInstance);
+        soaPose.CopyToPose(outPose);
+        for (uint32 i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            EXPECT_EQ(outPose.GetLocalSpaceTransform(i), pose.GetLocalSpaceTransform(i));
+            EXPECT_THAT(outPose.GetModelSpaceTransform(i), IsClose(pose.GetModelSpaceTransform(i)));
+        }
+    }
+
+    TEST_P(SoAPoseFixture, Blend_MatchesTransformBlend)
+    {
+        Pose sourcePose;
+        Pose destPose;
+        InitRandomPose(sourcePose);
+        InitRandomPose(destPose);
+
+        SoAPose soaDestPose;
+        soaDestPose.InitFromPose(destPose);
+
+        for (const float weight : { 0.0f, 0.25f, 0.5f, 0.77f, 1.0f })
+        {
+            SoAPose soaPose;
+            soaPose.InitFromPose(sourcePose);
+            soaPose.Blend(soaDestPose, weight);
+
+            for (uint32 i = 0; i < sourcePose.GetNumTransforms(); ++i)
+            {
+                Transform expected = sourcePose.GetLocalSpaceTransform(i);
+                expected.Blend(destPose.GetLocalSpaceTransform(i), weight);
+                EXPECT_THAT(soaPose.GetLocalSpaceTransform(i), IsClose(expected)) << "Joint " << i << " with weight " << weight;
+            }
+        }
+    }
+
+    TEST_P(SoAPoseFixture, BlendMasked_UsesJointWeights)
+    {
+        Pose sourcePose;
+        Pose destPose;
+        InitRandomPose(sourcePose);
+        InitRandomPose(destPose);
+
+        SoAPose soaPose;
+        SoAPose soaDestPose;
+        soaPose.InitFromPose(sourcePose);
+        soaDestPose.InitFromPose(destPose);
+
+        // Only blend every other joint.
+        SoAPose::JointWeights jointWeights;
+        soaPose.InitJointWeights(jointWeights, 0.0f);
+        EXPECT_EQ(jointWeights.GetLength(), soaPose.GetNumPaddedJoints());
+        for (uint32 i = 0; i < soaPose.GetNumJoints(); i += 2)
+        {
+            jointWeights[i] = 1.0f;
+        }
+
+        const float weight = 0.6f;
+        soaPose.BlendMasked(soaDestPose, weight, jointWeights);
+
+        for (uint32 i = 0; i < sourcePose.GetNumTransforms(); ++i)
+        {
+            Transform expected = sourcePose.GetLocalSpaceTransform(i);
+            expected.Blend(destPose.GetLocalSpaceTransform(i), weight * jointWeights[i]);
+            EXPECT_THAT(soaPose.GetLocalSpaceTransform(i), IsClose(expected)) << "Joint " << i;
+        }
+    }
+
+    TEST_P(SoAPoseFixture, BlendAdditive_MatchesTransformBlendAdditive)
+    {
+        Pose pose;
+        Pose destPose;
+        Pose basePose;
+        InitRandomPose(pose);
+        InitRandomPose(destPose);
+        InitRandomPose(basePose);
+
+        SoAPose soaPose;
+        SoAPose soaDestPose;
+        SoAPose soaBasePose;
+        soaPose.InitFromPose(pose);
+        soaDestPose.InitFromPose(destPose);
+        soaBasePose.InitFromPose(basePose);
+
+        const float weight = 0.35f;
+        soaPose.BlendAdditive(soaDestPose, soaBasePose, weight);
+
+        for (uint32 i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            Transform expected = pose.GetLocalSpaceTransform(i);
+            expected.BlendAdditive(destPose.GetLocalSpaceTransform(i), basePose.GetLocalSpaceTransform(i), weight);
+            EXPECT_THAT(soaPose.GetLocalSpaceTransform(i), IsClose(expected)) << "Joint " << i;
+        }
+    }
+
+    TEST_P(SoAPoseFixture, ApplyAdditive_MatchesTransformApplyAdditive)
+    {
+        Pose pose;
+        Pose additivePose;
+        InitRandomPose(pose);
+        InitRandomPose(additivePose);
+
+        SoAPose soaPose;
+        SoAPose soaAdditivePose;
+        soaPose.InitFromPose(pose);
+        soaAdditivePose.InitFromPose(additivePose);
+
+        const float weight = 0.8f;
+        soaPose.ApplyAdditive(soaAdditivePose, weight);
+
+        for (uint32 i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            Transform expected = pose.GetLocalSpaceTransform(i);
+            expected.ApplyAdditive(additivePose.GetLocalSpaceTransform(i), weight);
+            EXPECT_THAT(soaPose.GetLocalSpaceTransform(i), IsClose(expected)) << "Joint " << i;
+        }
+    }
+
+    TEST_P(SoAPoseFixture, UpdateModelSpaceTransforms_MatchesPose)
+    {
+        Pose pose;
+        InitRandomPose(pose);
+        pose.ForceUpdateFullModelSpacePose();
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(pose);
+        soaPose.UpdateModelSpaceTransforms();
+        ASSERT_TRUE(soaPose.GetModelSpaceTransformsReady());
+
+        for (uint32 i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            EXPECT_THAT(soaPose.GetModelSpaceTransform(i), IsClose(pose.GetModelSpaceTransform(i))) << "Joint " << i;
+        }
+
+        // Copying the pose over should also copy the model space transforms.
+        Pose outPose;
+        outPose.LinkToActorInstance(m_actorInstance);
+        soaPose.CopyToPose(outPose);
+        for (uint32 i = 0; i < pose.GetNumTransforms(); ++i)
+        {
+            EXPECT_TRUE(outPose.GetFlags(i) & Pose::FLAG_MODELTRANSFORMREADY);
+            EXPECT_THAT(outPose.GetModelSpaceTransformDirect(i), IsClose(pose.GetModelSpaceTransform(i))) << "Joint " << i;
+        }
+
+        // Changing a local transform invalidates the model space transforms.
+        soaPose.SetLocalSpaceTransform(0, Transform::CreateIdentity());
+        EXPECT_FALSE(soaPose.GetModelSpaceTransformsReady());
+    }
+
+    TEST_P(SoAPoseFixture, PosePool_RequestAndFreeSoAPoses)
+    {
+        AnimGraphPosePool posePool;
+        EXPECT_EQ(posePool.GetNumSoAPoses(), 0);
+
+        SoAPose* poseA = posePool.RequestSoAPose(m_actorInstance);
+        SoAPose* poseB = posePool.RequestSoAPose(m_actorInstance);
+        ASSERT_NE(poseA, poseB);
+        EXPECT_EQ(poseA->GetActor(), m_actor.get());
+        EXPECT_EQ(poseA->GetNumJoints(), m_actor->GetSkeleton()->GetNumNodes());
+        EXPECT_EQ(posePool.GetNumSoAPoses(), 2);
+        EXPECT_EQ(posePool.GetNumFreeSoAPoses(), 0);
+
+        posePool.FreeSoAPose(poseB);
+        EXPECT_EQ(posePool.GetNumFreeSoAPoses(), 1);
+        EXPECT_EQ(posePool.RequestSoAPose(m_actorInstance), poseB) << "Expected the freed pose to be reused.";
+
+        posePool.FreeAllPoses();
+        EXPECT_EQ(posePool.GetNumSoAPoses(), 2);
+        EXPECT_EQ(posePool.GetNumFreeSoAPoses(), 2);
+    }
+
+    // Compares the regular pose against the SoA pose, for skeletons of different sizes.
+    TEST_P(SoAPoseFixture, Blend2BlendPoses_MatchesPoseBlend)
+    {
+        Pose sourcePose;
+        Pose destPose;
+        InitRandomPose(sourcePose);
+        InitRandomPose(destPose);
+
+        const AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool();
+        const uint32 numFreeSoAPoses = posePool.GetNumFreeSoAPoses();
+
+        // The SoA blend is disabled by default, then enabled for every skeleton.
+        for (const uint32 soaBlendMinJoints : { 0u, 1u })
+        {
+            GetEMotionFX().SetSoABlendMinJoints(soaBlendMinJoints);
+            for (const float weight : { 0.0f, 0.3f, 1.0f })
+            {
+                Pose expectedPose = sourcePose;
+                expectedPose.Blend(&destPose, weight);
+
+                Pose pose = sourcePose;
+                BlendTreeBlend2Node::BlendPoses(m_actorInstance, pose, destPose, weight);
+                for (uint32 i = 0; i < pose.GetNumTransforms(); ++i)
+                {
+                    EXPECT_THAT(pose.GetLocalSpaceTransform(i), IsClose(expectedPose.GetLocalSpaceTransform(i))) << "Joint " << i << " with weight " << weight;
+                    EXPECT_THAT(pose.GetModelSpaceTransform(i), IsClose(expectedPose.GetModelSpaceTransform(i))) << "Joint " << i << " with weight " << weight;
+                }
+            }
+
+            // Blending through SoA poses returns them to the pool afterwards.
+            if (soaBlendMinJoints == 0)
+            {
+                EXPECT_EQ(posePool.GetNumFreeSoAPoses(), numFreeSoAPoses);
+            }
+            else
+            {
+                EXPECT_EQ(posePool.GetNumFreeSoAPoses(), AZStd::max(numFreeSoAPoses, 2u));
+            }
+        }
+        GetEMotionFX().SetSoABlendMinJoints(0);
+    }
+
+    TEST_P(SoAPoseFixture, DISABLED_BlendAndUpdateModelSpacePerformance)
+    {
+        const uint32 numIterations = 10000;
+
+        Pose sourcePose;
+        Pose destPose;
+        InitRandomPose(sourcePose);
+        InitRandomPose(destPose);
+
+        SoAPose soaPose;
+        SoAPose soaDestPose;
+        soaPose.InitFromPose(sourcePose);
+        soaDestPose.InitFromPose(destPose);
+
+        SoAPose::JointWeights jointWeights;
+        soaPose.InitJointWeights(jointWeights, 0.5f);
+
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+        for (uint32 i = 0; i < numIterations; ++i)
+        {
+            sourcePose.Blend(&destPose, 0.5f);
+        }
+        const float poseBlendTime = timer.StampAndGetDeltaTimeInSeconds();
+
+        for (uint32 i = 0; i < numIterations; ++i)
+        {
+            soaPose.Blend(soaDestPose, 0.5f);
+        }
+        const float soaBlendTime = timer.StampAndGetDeltaTimeInSeconds();
+
+        for (uint32 i = 0; i < numIterations; ++i)
+        {
+            soaPose.BlendMasked(soaDestPose, 0.5f, jointWeights);
+        }
+        const float soaBlendMaskedTime = timer.StampAndGetDeltaTimeInSeconds();
+
+        for (uint32 i = 0; i < numIterations; ++i)
+        {
+            sourcePose.ForceUpdateFullModelSpacePose();
+        }
+        const float poseModelSpaceTime = timer.StampAndGetDeltaTimeInSeconds();
+
+        for (uint32 i = 0; i < numIterations; ++i)
+        {
+            soaPose.UpdateModelSpaceTransforms();
+        }
+        const float soaModelSpaceTime = timer.StampAndGetDeltaTimeInSeconds();
+
+        const float toMicroseconds = 1000000.0f / static_cast<float>(numIterations);
+        printf("-------------------------------\n");
+        printf("- Num joints:                   %zu\n", GetParam());
+        printf("- Pose::Blend:                  %.3f us\n", poseBlendTime * toMicroseconds);
+        printf("- SoAPose::Blend:               %.3f us\n", soaBlendTime * toMicroseconds);
+        printf("- SoAPose::BlendMasked:         %.3f us\n", soaBlendMaskedTime * toMicroseconds);
+        printf("- Pose model space update:      %.3f us\n", poseModelSpaceTime * toMicroseconds);
+        printf("- SoAPose model space update:   %.3f us\n", soaModelSpaceTime * toMicroseconds);
+    }
+
+    INSTANTIATE_TEST_CASE_P(SoAPose, SoAPoseFixture, ::testing::Values(1, 5, 50, 100, 200, 300));
+} // namespace EMotionFX
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <EMotionFX/Source/VertexAttributeLayerAbstractData.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    struct SoftSkinDeformerTestParam
+    {
+        uint32 m_numVertices;
+        bool m_positionsOnly;
+    };
+
+    class SoftSkinDeformerFixture
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<SoftSkinDeformerTestParam>
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(m_numJoints);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            m_random.SetSeed(162534);
+        }
+
+        void TearDown() override
+        {
+            if (m_deformer)
+            {
+                m_deformer->Destroy();
+            }
+            if (m_mesh)
+            {
+                m_mesh->Destroy();
+            }
+            m_actorInstance->Destroy();
+            m_actor.reset();
+            SystemComponentFixture::TearDown();
+        }
+
+        float RandomRange(float min, float max)
+        {
+            return min + m_random.GetRandomFloat() * (max - min);
+        }
+
+        AZ::Vector3 RandomVector3()
+        {
+            return AZ::Vector3(RandomRange(-1.0f, 1.0f), RandomRange(-1.0f, 1.0f), RandomRange(-1.0f, 1.0f));
+        }
+
+        template <typename T>
+        T* AddVertexLayer(uint32 layerTypeId)
+        {
+            VertexAttributeLayerAbstractData* layer = VertexAttributeLayerAbstractData::Create(m_mesh->GetNumVertices(), layerTypeId, sizeof(T), /*keepOriginals=*/true);
+            m_mesh->AddVertexAttributeLayer(layer);
+            return static_cast<T*>(layer->GetData());
+        }
+
+        // Create a mesh with random vertex data, where every vertex is skinned to one up to four random joints.
+        // The original vertex numbers are reversed, so that the skinning data has to be looked up through them.
+        void CreateSkinnedMesh(uint32 numVertices)
+        {
+            m_mesh = Mesh::Create(numVertices, 0, 0, numVertices, false);
+            AZ::Vector3* positions = AddVertexLayer<AZ::Vector3>(Mesh::ATTRIB_POSITIONS);
+            AZ::Vector3* normals = AddVertexLayer<AZ::Vector3>(Mesh::ATTRIB_NORMALS);
+            AZ::Vector4* tangents = AddVertexLayer<AZ::Vector4>(Mesh::ATTRIB_TANGENTS);
+            AZ::Vector3* bitangents = AddVertexLayer<AZ::Vector3>(Mesh::ATTRIB_BITANGENTS);
+            uint32* orgVerts = AddVertexLayer<uint32>(Mesh::ATTRIB_ORGVTXNUMBERS);
+
+            SkinningInfoVertexAttributeLayer* skinningLayer = SkinningInfoVertexAttributeLayer::Create(numVertices);
+            m_mesh->AddSharedVertexAttributeLayer(skinningLayer);
+
+            for (uint32 v = 0; v < numVertices; ++v)
+            {
+                positions[v] = RandomVector3();
+                normals[v] = RandomVector3().GetNormalized();
+                tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(RandomVector3().GetNormalized(), (v % 2) ? 1.0f : -1.0f);
+                bitangents[v] = RandomVector3().GetNormalized();
+                orgVerts[v] = numVertices - 1 - v;
+
+                const uint32 numInfluences = 1 + m_random.GetRandom() % 4;
+                float weights[4];
+                float totalWeight = 0.0f;
+                for (uint32 i = 0; i < numInfluences; ++i)
+                {
+                    weights[i] = RandomRange(0.1f, 1.0f);
+                    totalWeight += weights[i];
+                }
+                for (uint32 i = 0; i < numInfluences; ++i)
+                {
+                    skinningLayer->AddInfluence(orgVerts[v], m_random.GetRandom() % m_numJoints, weights[i] / totalWeight);
+                }
+            }
+
+            // Store the random vertex data as the original data, which the deformer starts from on every update.
+            const uint32 numLayers = m_mesh->GetNumVertexAttributeLayers();
+            for (uint32 i = 0; i < numLayers; ++i)
+            {
+                VertexAttributeLayerAbstractData* layer = static_cast<VertexAttributeLayerAbstractData*>(m_mesh->GetVertexAttributeLayer(i));
+                memcpy(layer->GetOriginalData(), layer->GetData(), layer->GetAttributeSizeInBytes() * numVertices);
+            }
+
+            m_deformer = SoftSkinDeformer::Create(m_mesh);
+            m_deformer->Reinitialize(m_actor.get(), nullptr, 0);
+        }
+
+        void SetRandomPose()
+        {
+            Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            for (uint32 i = 0; i < m_numJoints; ++i)
+            {
+                const AZ::Vector3 axis = RandomVector3().GetNormalized();
+                pose->SetLocalSpaceTransform(i, Transform(RandomVector3(), AZ::Quaternion::CreateFromAxisAngle(axis, RandomRange(-AZ::Constants::Pi, AZ::Constants::Pi))));
+            }
+            pose->ForceUpdateFullModelSpacePose();
+            m_actorInstance->UpdateSkinningMatrices();
+        }
+
+    protected:
+        const uint32 m_numJoints = 5;
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Mesh* m_mesh = nullptr;
+        SoftSkinDeformer* m_deformer = nullptr;
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    TEST_P(SoftSkinDeformerFixture, MatchesScalarSkinning)
+    {
+        const SoftSkinDeformerTestParam& param = GetParam();
+        CreateSkinnedMesh(param.m_numVertices);
+        m_deformer->SetSkinPositionsOnly(param.m_positionsOnly);
+        SetRandomPose();
+
+        m_mesh->ResetToOriginalData();
+        m_deformer->Update(m_actorInstance, nullptr, 0.0f);
+
+        const AZ::Matrix3x4* skinningMatrices = m_actorInstance->GetTransformData()->GetSkinningMatrices();
+        SkinningInfoVertexAttributeLayer* skinningLayer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        const AZ::Vector3* positions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZ::Vector3* normals = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        const AZ::Vector4* tangents = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+        const AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+        const AZ::Vector3* orgPositions = static_cast<AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZ::Vector3* orgNormals = static_cast<AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_NORMALS));
+        const AZ::Vector4* orgTangents = static_cast<AZ::Vector4*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_TANGENTS));
+        const AZ::Vector3* orgBitangents = static_cast<AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_BITANGENTS));
+        const uint32* orgVerts = static_cast<uint32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+
+        for (uint32 v = 0; v < param.m_numVertices; ++v)
+        {
+            AZ::Vector3 expectedPosition = AZ::Vector3::CreateZero();
+            AZ::Vector3 expectedNormal = AZ::Vector3::CreateZero();
+            AZ::Vector4 expectedTangent = AZ::Vector4::CreateZero();
+            AZ::Vector3 expectedBitangent = AZ::Vector3::CreateZero();
+
+            const size_t numInfluences = skinningLayer->GetNumInfluences(orgVerts[v]);
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = skinningLayer->GetInfluence(orgVerts[v], i);
+                MCore::Skin(skinningMatrices[influence->GetNodeNr()], &orgPositions[v], &orgNormals[v], &orgTangents[v], &orgBitangents[v],
+                    &expectedPosition, &expectedNormal, &expectedTangent, &expectedBitangent, influence->GetWeight());
+            }
+
+            EXPECT_THAT(positions[v], IsClose(expectedPosition));
+            if (param.m_positionsOnly)
+            {
+                EXPECT_EQ(normals[v], orgNormals[v]);
+                EXPECT_EQ(tangents[v], orgTangents[v]);
+                EXPECT_EQ(bitangents[v], orgBitangents[v]);
+            }
+            else
+            {
+                EXPECT_THAT(normals[v], IsClose(expectedNormal));
+                EXPECT_THAT(tangents[v], IsClose(expectedTangent));
+                EXPECT_THAT(bitangents[v], IsClose(expectedBitangent));
+            }
+        }
+    }
+
+    TEST_P(SoftSkinDeformerFixture, CloneMatchesOriginal)
+    {
+        const SoftSkinDeformerTestParam& param = GetParam();
+        CreateSkinnedMesh(param.m_numVertices);
+        m_deformer->SetSkinPositionsOnly(param.m_positionsOnly);
+        SetRandomPose();
+
+        m_mesh->ResetToOriginalData();
+        m_deformer->Update(m_actorInstance, nullptr, 0.0f);
+        const AZ::Vector3* positions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZStd::vector<AZ::Vector3> expectedPositions(positions, positions + param.m_numVertices);
+
+        MeshDeformer* clone = m_deformer->Clone(m_mesh);
+        EXPECT_EQ(static_cast<SoftSkinDeformer*>(clone)->GetSkinPositionsOnly(), param.m_positionsOnly);
+        m_mesh->ResetToOriginalData();
+        clone->Update(m_actorInstance, nullptr, 0.0f);
+        clone->Destroy();
+
+        for (uint32 v = 0; v < param.m_numVertices; ++v)
+        {
+            EXPECT_EQ(positions[v], expectedPositions[v]);
+        }
+    }
+
+    TEST_P(SoftSkinDeformerFixture, ActorInstanceSkinPositionsOnly_MatchesDeformerSetting)
+    {
+        const SoftSkinDeformerTestParam& param = GetParam();
+        CreateSkinnedMesh(param.m_numVertices);
+        SetRandomPose();
+
+        m_deformer->SetSkinPositionsOnly(param.m_positionsOnly);
+        m_mesh->ResetToOriginalData();
+        m_deformer->Update(m_actorInstance, nullptr, 0.0f);
+        const AZ::Vector3* positions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        const AZ::Vector3* normals = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        const AZStd::vector<AZ::Vector3> expectedPositions(positions, positions + param.m_numVertices);
+        const AZStd::vector<AZ::Vector3> expectedNormals(normals, normals + param.m_numVertices);
+
+        // Enabling it on the actor instance skins the same vertex data as enabling it on the deformer.
+        m_deformer->SetSkinPositionsOnly(false);
+        m_actorInstance->SetSkinPositionsOnly(param.m_positionsOnly);
+        m_mesh->ResetToOriginalData();
+        m_deformer->Update(m_actorInstance, nullptr, 0.0f);
+
+        for (uint32 v = 0; v < param.m_numVertices; ++v)
+        {
+            EXPECT_EQ(positions[v], expectedPositions[v]);
+            EXPECT_EQ(normals[v], expectedNormals[v]);
+        }
+    }
+
+    TEST_P(SoftSkinDeformerFixture, DISABLED_SkinningPerformance)
+    {
+        const SoftSkinDeformerTestParam& param = GetParam();
+        const uint32 numIterations = 100;
+        CreateSkinnedMesh(param.m_numVertices);
+        m_deformer->SetSkinPositionsOnly(param.m_positionsOnly);
+        SetRandomPose();
+
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+        for (uint32 i = 0; i < numIterations; ++i)
+        {
+            m_mesh->ResetToOriginalData();
+            m_deformer->Update(m_actorInstance, nullptr, 0.0f);
+        }
+        const float skinningTime = timer.StampAndGetDeltaTimeInSeconds();
+
+        const float numVerticesSkinned = static_cast<float>(param.m_numVertices) * static_cast<float>(numIterations);
+        printf("Soft skinning of %d vertices (%s): %.2f million vertices/sec\n", param.m_numVertices,
+            param.m_positionsOnly ? "positions only" : "all vertex data", numVerticesSkinned / skinningTime / 1000000.0f);
+    }
+
+    INSTANTIATE_TEST_CASE_P(SoftSkinDeformerTests,
+        SoftSkinDeformerFixture,
+        ::testing::ValuesIn(std::vector<SoftSkinDeformerTestParam>{
+            {3, false},
+            {3, true},
+            {38, false},
+            {38, true},
+            {20003, false},
+            {20003, true},
+            {100000, false},
+            {100000, true}
+        })
+    );
+} // namespace EMotionFX
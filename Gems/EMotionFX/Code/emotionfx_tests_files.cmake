@@ -11,6 +11,7 @@ set(FILES
     Tests/ActorFixture.cpp
     Tests/ActorFixture.h
     Tests/ActorInstanceCommandTests.cpp
+    Tests/ActorUpdateSchedulerTests.cpp
     Tests/AdditiveMotionSamplingTests.cpp
     Tests/AnimAudioComponentTests.cpp
     Tests/AnimGraphActionTests.cpp
@@ -34,6 +35,7 @@ set(FILES
     Tests/AnimGraphNodeEventFilterTests.cpp
     Tests/AnimGraphNodeGroupTests.cpp
     Tests/AnimGraphNodeProcessingTests.cpp
+    Tests/AnimGraphProgramTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterConditionCommandTests.cpp
@@ -76,6 +78,7 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -107,6 +110,8 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SoAPoseTests.cpp
+    Tests/SoftSkinDeformerTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
@@ -22,6 +22,11 @@ namespace GradientSignal
          */
         static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
 
+        /**
+         * The component connects while entities are activated on worker threads, see IsActivationThreadSafe.
+         */
+        using MutexType = AZStd::recursive_mutex;
+
         virtual float GetConstantValue() const = 0;
         virtual void SetConstantValue(float constant) = 0;
     };
@@ -21,6 +21,11 @@ namespace GradientSignal
          */
         static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
 
+        /**
+         * The component connects while entities are activated on worker threads, see IsActivationThreadSafe.
+         */
+        using MutexType = AZStd::recursive_mutex;
+
         virtual size_t GetNumTags() const = 0;
         virtual AZ::Crc32 GetTag(int tagIndex) const = 0;
         virtual void RemoveTag(int tagIndex) = 0;
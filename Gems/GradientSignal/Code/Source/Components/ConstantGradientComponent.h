@@ -45,6 +45,8 @@ namespace GradientSignal
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& services);
+        //! Activation only connects to buses that lock, so the component can be activated on a job, see Entity::ActivateEntities.
+        static bool IsActivationThreadSafe() { return true; }
         static void Reflect(AZ::ReflectContext* context);
 
         ConstantGradientComponent(const ConstantGradientConfig& configuration);
@@ -53,6 +53,8 @@ namespace GradientSignal
         AZ_COMPONENT(SurfaceMaskGradientComponent, SurfaceMaskGradientComponentTypeId);
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
+        //! Activation only connects to buses that lock, so the component can be activated on a job, see Entity::ActivateEntities.
+        static bool IsActivationThreadSafe() { return true; }
         static void Reflect(AZ::ReflectContext* context);
 
         SurfaceMaskGradientComponent(const SurfaceMaskGradientConfig& configuration);
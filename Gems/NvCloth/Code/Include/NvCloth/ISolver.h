@@ -64,6 +64,10 @@ namespace NvCloth
         //! Note: This is a blocking call that will wait for the simulation jobs to complete.
         virtual void FinishSimulation() = 0;
 
+        //! Returns whether the simulation has been started and not finished yet.
+        //! The cloths of the solver cannot be modified while it's simulating.
+        virtual bool IsSimulating() const = 0;
+
         //! Specifies the distance (meters) that cloths' particles need to be separated from each other.
         //! Inter-collision refers to collisions between different cloth instances in the solver,
         //! do not confuse with self-collision, which is available per cloth through IClothConfigurator.
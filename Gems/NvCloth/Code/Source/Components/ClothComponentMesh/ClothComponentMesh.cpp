@@ -23,6 +23,7 @@
 #include <Components/ClothComponentMesh/ClothDebugDisplay.h>
 #include <Components/ClothComponentMesh/ClothComponentMesh.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/WindBus.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -35,6 +36,12 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    AZ_CVAR(float, cloth_LodReducedRateDistance, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The distance in meters from the active camera beyond which cloth is simulated at half of its solver frequency. 0 disables it.");
+
+    AZ_CVAR(float, cloth_LodFreezeDistance, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The distance in meters from the active camera beyond which cloth simulation is frozen. 0 disables it.");
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -243,6 +250,10 @@ namespace NvCloth
         m_motionConstraints.clear();
         m_separationConstraints.clear();
         m_clothDebugDisplay.reset();
+        m_simulationLod = SimulationLod::Full;
+        m_frozenRenderDataCopied = false;
+        m_pendingWorldTransform.reset();
+        m_pendingWindUpdate = false;
     }
 
     void ClothComponentMesh::OnPreSimulation(
@@ -276,23 +287,38 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
     {
-        // At the moment there is no way to distinguish "move" from "teleport".
-        // As a workaround we will consider a teleport if the position has changed considerably.
-        bool teleport = (m_worldPosition.GetDistance(world.GetTranslation()) >= cloth_DistanceToTeleport);
-
-        if (teleport)
+        // The cloth system simulates from the physics tick until right before the pre-render tick,
+        // transforms changing in between are applied to the cloth for the next simulation.
+        if (IsClothSimulating())
         {
-            TeleportCloth(world);
-        }
-        else
-        {
-            MoveCloth(world);
+            m_pendingWorldTransform = world;
+            return;
         }
+
+        ApplyWorldTransform(world);
     }
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        CopyRenderDataToModel();
+        if (m_pendingWorldTransform)
+        {
+            ApplyWorldTransform(*m_pendingWorldTransform);
+            m_pendingWorldTransform.reset();
+        }
+        if (m_pendingWindUpdate)
+        {
+            OnGlobalWindChanged();
+        }
+
+        // The simulation of this frame has finished already, so the level of detail
+        // change will be in effect for the next simulation.
+        UpdateSimulationLod();
+
+        if (m_simulationLod != SimulationLod::Frozen || !m_frozenRenderDataCopied)
+        {
+            CopyRenderDataToModel();
+            m_frozenRenderDataCopied = (m_simulationLod == SimulationLod::Frozen);
+        }
     }
 
     int ClothComponentMesh::GetTickOrder()
@@ -302,7 +328,11 @@ namespace NvCloth
 
     void ClothComponentMesh::OnGlobalWindChanged()
     {
-        m_cloth->GetClothConfigurator()->SetWindVelocity(GetWindBusVelocity());
+        m_pendingWindUpdate = IsClothSimulating();
+        if (!m_pendingWindUpdate)
+        {
+            m_cloth->GetClothConfigurator()->SetWindVelocity(GetWindBusVelocity());
+        }
     }
 
     void ClothComponentMesh::OnWindChanged([[maybe_unused]] const AZ::Aabb& aabb)
@@ -310,6 +340,83 @@ namespace NvCloth
         OnGlobalWindChanged();
     }
 
+    ClothComponentMesh::SimulationLod ClothComponentMesh::GetSimulationLod() const
+    {
+        return m_simulationLod;
+    }
+
+    void ClothComponentMesh::SetSimulationLod(SimulationLod lod)
+    {
+        if (!m_cloth || lod == m_simulationLod)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+        if (m_simulationLod == SimulationLod::Frozen)
+        {
+            AZ::Interface<IClothSystem>::Get()->AddCloth(m_cloth);
+
+            // The entity might have moved a long distance while frozen, avoid a sudden impulse when resuming.
+            m_cloth->GetClothConfigurator()->ClearInertia();
+            m_timeClothSkinningUpdates = 0.0f;
+            m_frozenRenderDataCopied = false;
+        }
+
+        m_simulationLod = lod;
+
+        if (m_simulationLod == SimulationLod::Frozen)
+        {
+            // Frozen cloth is not simulated and skips the pre and post simulation work.
+            AZ::Interface<IClothSystem>::Get()->RemoveCloth(m_cloth);
+        }
+        else
+        {
+            m_cloth->GetClothConfigurator()->SetSolverFrequency(GetLodSolverFrequency());
+        }
+    }
+
+    void ClothComponentMesh::UpdateSimulationLod()
+    {
+        const float reducedRateDistance = cloth_LodReducedRateDistance;
+        const float freezeDistance = cloth_LodFreezeDistance;
+
+        SimulationLod lod = SimulationLod::Full;
+        if ((reducedRateDistance > 0.0f || freezeDistance > 0.0f) &&
+            Camera::ActiveCameraRequestBus::HasHandlers())
+        {
+            AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+            Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+
+            const float distance = m_worldPosition.GetDistance(cameraTransform.GetTranslation());
+            lod = CalculateSimulationLod(distance, reducedRateDistance, freezeDistance);
+        }
+
+        SetSimulationLod(lod);
+    }
+
+    ClothComponentMesh::SimulationLod ClothComponentMesh::CalculateSimulationLod(
+        float cameraDistance, float reducedRateDistance, float freezeDistance)
+    {
+        if (freezeDistance > 0.0f && cameraDistance >= freezeDistance)
+        {
+            return SimulationLod::Frozen;
+        }
+        if (reducedRateDistance > 0.0f && cameraDistance >= reducedRateDistance)
+        {
+            return SimulationLod::ReducedRate;
+        }
+        return SimulationLod::Full;
+    }
+
+    float ClothComponentMesh::GetLodSolverFrequency() const
+    {
+        return (m_simulationLod == SimulationLod::ReducedRate)
+            ? m_config.m_solverFrequency * 0.5f
+            : m_config.m_solverFrequency;
+    }
+
     ClothComponentMesh::RenderData& ClothComponentMesh::GetRenderData()
     {
         return const_cast<RenderData&>(
@@ -722,7 +829,7 @@ namespace NvCloth
         clothConfig->SetTetherConstraintScale(m_config.m_tetherConstraintScale);
 
         // Quality parameters
-        clothConfig->SetSolverFrequency(m_config.m_solverFrequency);
+        clothConfig->SetSolverFrequency(GetLodSolverFrequency());
         clothConfig->SetAcceleationFilterWidth(m_config.m_accelerationFilterIterations);
 
         // Fabric Phases
@@ -748,6 +855,28 @@ namespace NvCloth
             m_config.m_shearingStretchLimit);
     }
 
+    bool ClothComponentMesh::IsClothSimulating() const
+    {
+        const ISolver* solver = AZ::Interface<IClothSystem>::Get()->GetSolver(DefaultSolverName);
+        return solver && solver->IsSimulating();
+    }
+
+    void ClothComponentMesh::ApplyWorldTransform(const AZ::Transform& worldTransform)
+    {
+        // At the moment there is no way to distinguish "move" from "teleport".
+        // As a workaround we will consider a teleport if the position has changed considerably.
+        bool teleport = (m_worldPosition.GetDistance(worldTransform.GetTranslation()) >= cloth_DistanceToTeleport);
+
+        if (teleport)
+        {
+            TeleportCloth(worldTransform);
+        }
+        else
+        {
+            MoveCloth(worldTransform);
+        }
+    }
+
     void ClothComponentMesh::MoveCloth(const AZ::Transform& worldTransform)
     {
         m_worldPosition = worldTransform.GetTranslation();
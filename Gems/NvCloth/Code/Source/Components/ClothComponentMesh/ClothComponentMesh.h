@@ -9,7 +9,9 @@
 
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/optional.h>
 
 #include <AzFramework/Physics/WindBus.h>
 
@@ -21,6 +23,9 @@
 
 namespace NvCloth
 {
+    AZ_CVAR_EXTERNED(float, cloth_LodReducedRateDistance);
+    AZ_CVAR_EXTERNED(float, cloth_LodFreezeDistance);
+
     class ActorClothColliders;
     class ActorClothSkinning;
     class ClothConstraints;
@@ -58,6 +63,25 @@ namespace NvCloth
 
         void CopyRenderDataToModel();
 
+        //! Level of detail of the cloth simulation, based on the distance to the active camera.
+        enum class SimulationLod
+        {
+            Full,           //!< Simulated at the configured solver frequency.
+            ReducedRate,    //!< Simulated at half of the configured solver frequency.
+            Frozen          //!< Removed from its solver, keeping the last simulated shape.
+        };
+
+        SimulationLod GetSimulationLod() const;
+
+        //! Changes the simulation level of detail of the cloth.
+        //! This is called every frame with the level of detail calculated from the distance to the active camera
+        //! and must not be called while the solver of the cloth is simulating.
+        void SetSimulationLod(SimulationLod lod);
+
+        //! Returns the simulation level of detail for a distance to the active camera.
+        //! A distance of 0 disables the corresponding level of detail.
+        static SimulationLod CalculateSimulationLod(float cameraDistance, float reducedRateDistance, float freezeDistance);
+
     protected:
         // Functions used to setup and tear down cloth component mesh
         void Setup(AZ::EntityId entityId, const ClothConfiguration& config);
@@ -83,9 +107,13 @@ namespace NvCloth
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
         void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles);
+        void UpdateSimulationLod();
+        float GetLodSolverFrequency() const;
 
         bool CreateCloth();
         void ApplyConfigurationToCloth();
+        bool IsClothSimulating() const;
+        void ApplyWorldTransform(const AZ::Transform& worldTransform);
         void MoveCloth(const AZ::Transform& worldTransform);
         void TeleportCloth(const AZ::Transform& worldTransform);
 
@@ -103,6 +131,17 @@ namespace NvCloth
         // Instance of cloth simulation
         ICloth* m_cloth = nullptr;
 
+        // Current simulation level of detail
+        SimulationLod m_simulationLod = SimulationLod::Full;
+
+        // Transform and wind changes received while the cloth is simulating, which are applied once the simulation has finished.
+        AZStd::optional<AZ::Transform> m_pendingWorldTransform;
+        bool m_pendingWindUpdate = false;
+
+        // Set when the render data has been copied to the model after the cloth got frozen,
+        // as there is no need to copy it again until the simulation resumes.
+        bool m_frozenRenderDataCopied = false;
+
         // Cloth event handlers
         ICloth::PreSimulationEvent::Handler m_preSimulationEventHandler;
         ICloth::PostSimulationEvent::Handler m_postSimulationEventHandler;
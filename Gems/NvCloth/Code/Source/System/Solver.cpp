@@ -155,6 +155,11 @@ namespace NvCloth
         m_postSimulationEvent.Signal(m_name, m_deltaTime);
     }
 
+    bool Solver::IsSimulating() const
+    {
+        return m_isSimulating;
+    }
+
     void Solver::SetInterCollisionDistance(float distance)
     {
         m_nvSolver->setInterCollisionDistance(distance);
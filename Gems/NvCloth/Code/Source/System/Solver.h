@@ -45,6 +45,7 @@ namespace NvCloth
         bool IsUserSimulated() const override;
         void StartSimulation(float deltaTime) override;
         void FinishSimulation() override;
+        bool IsSimulating() const override;
         void SetInterCollisionDistance(float distance) override;
         void SetInterCollisionStiffness(float stiffness) override;
         void SetInterCollisionIterations(AZ::u32 iterations) override;
@@ -252,6 +252,8 @@ namespace NvCloth
 
             if (solverIt != m_solvers.end())
             {
+                FinishSolver(solverIt->get());
+
                 // The solver will remove all its remaining cloths from it when destroyed
                 m_solvers.erase(solverIt);
                 solver = nullptr;
@@ -337,6 +339,11 @@ namespace NvCloth
         {
             FabricId fabricId = cloth->GetFabricCookedData().m_id;
 
+            if (Cloth* clothInstance = azdynamic_cast<Cloth*>(cloth))
+            {
+                FinishSolver(clothInstance->GetSolver());
+            }
+
             // Cloth will decrement its fabric's counter on destruction.
             // In addition, if the cloth still remains added into a solver, it will remove itself from it.
             m_cloths.erase(cloth->GetId());
@@ -375,6 +382,10 @@ namespace NvCloth
             Solver* solverInstance = azdynamic_cast<Solver*>(solver);
             AZ_Assert(solverInstance, "Dynamic casting from ISolver to Solver failed.");
 
+            // The cloth might be moved from another solver, neither of them can be simulating while it's being modified.
+            FinishSolver(clothInstance->GetSolver());
+            FinishSolver(solverInstance);
+
             solverInstance->AddCloth(clothInstance);
 
             return true;
@@ -393,6 +404,7 @@ namespace NvCloth
             Solver* solverInstance = clothInstance->GetSolver();
             if (solverInstance)
             {
+                FinishSolver(solverInstance);
                 solverInstance->RemoveCloth(clothInstance);
             }
         }
@@ -404,12 +416,14 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
+        // Start the simulation jobs of all solvers, so the pre-simulation, simulation and post-simulation jobs
+        // of all cloths run in parallel. They are finished by the FinishSolversTickHandler later in the frame,
+        // so the simulation overlaps with the tick handlers in between as well.
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
-                solverIt->FinishSimulation();
             }
         }
     }
@@ -419,6 +433,42 @@ namespace NvCloth
         return AZ::TICK_PHYSICS;
     }
 
+    SystemComponent::FinishSolversTickHandler::FinishSolversTickHandler(SystemComponent& systemComponent)
+        : m_systemComponent(systemComponent)
+    {
+    }
+
+    void SystemComponent::FinishSolversTickHandler::OnTick(
+        [[maybe_unused]] float deltaTime,
+        [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_systemComponent.FinishSolvers();
+    }
+
+    int SystemComponent::FinishSolversTickHandler::GetTickOrder()
+    {
+        // Right before the cloth components copy the simulation results to their meshes.
+        return AZ::TICK_PRE_RENDER - 1;
+    }
+
+    void SystemComponent::FinishSolvers()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+        for (auto& solverIt : m_solvers)
+        {
+            FinishSolver(solverIt.get());
+        }
+    }
+
+    void SystemComponent::FinishSolver(Solver* solver)
+    {
+        if (solver && !solver->IsUserSimulated())
+        {
+            solver->FinishSimulation();
+        }
+    }
+
     void SystemComponent::InitializeSystem()
     {
         // Create Factory
@@ -431,13 +481,18 @@ namespace NvCloth
 
         AZ::Interface<IClothSystem>::Register(this);
         AZ::TickBus::Handler::BusConnect();
+        m_finishSolversTickHandler.BusConnect();
     }
 
     void SystemComponent::DestroySystem()
     {
+        m_finishSolversTickHandler.BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
         AZ::Interface<IClothSystem>::Unregister(this);
 
+        // Wait for any simulation started this frame before destroying the cloths and solvers.
+        FinishSolvers();
+
         // Destroy Cloths
         m_cloths.clear();
 
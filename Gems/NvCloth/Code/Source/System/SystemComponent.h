@@ -25,7 +25,9 @@ namespace NvCloth
     //!
     //! This class has the responsibility to initialize and tear down NvCloth library.
     //! It owns all Solvers, Cloths and Fabrics, and it manages their creation and destruction.
-    //! It's also the responsible for updating (on Physics Tick) all the solvers that are not flagged as "user simulated".
+    //! It's also the responsible for updating all the solvers that are not flagged as "user simulated".
+    //! Those solvers are started on the physics tick and finished right before the pre-render tick,
+    //! so their simulations run in parallel with each other and with the rest of the frame in between.
     class SystemComponent
         : public AZ::Component
         , protected IClothSystem
@@ -71,9 +73,31 @@ namespace NvCloth
         int GetTickOrder() override;
 
     private:
+        //! Finishes the simulation of the solvers before the cloth components copy the simulated particles to their render meshes.
+        class FinishSolversTickHandler
+            : public AZ::TickBus::Handler
+        {
+        public:
+            explicit FinishSolversTickHandler(SystemComponent& systemComponent);
+
+        protected:
+            // AZ::TickBus::Handler overrides ...
+            void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+            int GetTickOrder() override;
+
+        private:
+            SystemComponent& m_systemComponent;
+        };
+
         void InitializeSystem();
         void DestroySystem();
 
+        //! Waits for the simulation of all solvers that are not user simulated.
+        void FinishSolvers();
+
+        //! Waits for the simulation of a solver that is not user simulated, so its cloths can be modified.
+        static void FinishSolver(Solver* solver);
+
         FabricId FindOrCreateFabric(const FabricCookedData& fabricCookedData);
         void DestroyFabric(FabricId fabricId);
 
@@ -88,5 +112,7 @@ namespace NvCloth
 
         // List of all the cloths created.
         AZStd::unordered_map<ClothId, AZStd::unique_ptr<Cloth>> m_cloths;
+
+        FinishSolversTickHandler m_finishSolversTickHandler{ *this };
     };
 } // namespace NvCloth
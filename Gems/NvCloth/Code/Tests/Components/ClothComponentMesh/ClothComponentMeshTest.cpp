@@ -9,6 +9,7 @@
 
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzCore/Component/Entity.h>
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Components/TransformComponent.h>
 
 #include <Components/ClothComponentMesh/ClothComponentMesh.h>
@@ -19,6 +20,38 @@
 
 namespace UnitTest
 {
+    //! Active camera placed at a given transform, used to drive the cloth simulation level of detail.
+    class ActiveCameraStub
+        : public Camera::ActiveCameraRequestBus::Handler
+    {
+    public:
+        explicit ActiveCameraStub(const AZ::Transform& transform)
+            : m_transform(transform)
+        {
+            Camera::ActiveCameraRequestBus::Handler::BusConnect();
+        }
+
+        ~ActiveCameraStub()
+        {
+            Camera::ActiveCameraRequestBus::Handler::BusDisconnect();
+        }
+
+        // Camera::ActiveCameraRequestBus::Handler overrides ...
+        const AZ::Transform& GetActiveCameraTransform() override
+        {
+            return m_transform;
+        }
+
+        const Camera::Configuration& GetActiveCameraConfiguration() override
+        {
+            return m_configuration;
+        }
+
+    private:
+        AZ::Transform m_transform;
+        Camera::Configuration m_configuration;
+    };
+
     //! Fixture to setup entity with actor component and the tests data.
     class NvClothComponentMesh
         : public ::testing::Test
@@ -479,4 +512,115 @@ namespace UnitTest
         }
         */
     }
+
+    TEST_F(NvClothComponentMesh, ClothComponentMesh_CalculateSimulationLodDistancesDisabled_ReturnsFull)
+    {
+        using SimulationLod = NvCloth::ClothComponentMesh::SimulationLod;
+
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(0.0f, 0.0f, 0.0f), SimulationLod::Full);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(1000.0f, 0.0f, 0.0f), SimulationLod::Full);
+    }
+
+    TEST_F(NvClothComponentMesh, ClothComponentMesh_CalculateSimulationLodBeyondReducedRateDistance_ReturnsReducedRate)
+    {
+        using SimulationLod = NvCloth::ClothComponentMesh::SimulationLod;
+        const float reducedRateDistance = 10.0f;
+
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(9.9f, reducedRateDistance, 0.0f), SimulationLod::Full);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(10.0f, reducedRateDistance, 0.0f), SimulationLod::ReducedRate);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(1000.0f, reducedRateDistance, 0.0f), SimulationLod::ReducedRate);
+
+        // Closer than the freeze distance the reduced rate still applies
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(15.0f, reducedRateDistance, 20.0f), SimulationLod::ReducedRate);
+    }
+
+    TEST_F(NvClothComponentMesh, ClothComponentMesh_CalculateSimulationLodBeyondFreezeDistance_ReturnsFrozen)
+    {
+        using SimulationLod = NvCloth::ClothComponentMesh::SimulationLod;
+        const float freezeDistance = 20.0f;
+
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(19.9f, 0.0f, freezeDistance), SimulationLod::Full);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(20.0f, 0.0f, freezeDistance), SimulationLod::Frozen);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(20.0f, 10.0f, freezeDistance), SimulationLod::Frozen);
+
+        // The freeze distance takes precedence when it is closer than the reduced rate distance
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(15.0f, 30.0f, 10.0f), SimulationLod::Frozen);
+    }
+
+    // [TODO LYN-1891]
+    // Revisit when Cloth Component Mesh works with Actors adapted to Atom models.
+    // At the moment, CreateAssetFromActor fills only Actor to the ActorAsset, but not the RenderActor,
+    // because of that the AtomModel is not created and the cloth is not created.
+    TEST_F(NvClothComponentMesh, DISABLED_ClothComponentMesh_TickWithCameraBeyondLodDistances_ReducesRateAndFreezesSimulation)
+    {
+        {
+            auto actor = AZStd::make_unique<ActorHelper>("actor_test");
+            auto meshNodeIndex = actor->AddJoint(MeshNodeName);
+            actor->SetMesh(LodLevel, meshNodeIndex, CreateEMotionFXMesh(MeshVertices, MeshIndices, MeshSkinningInfo, MeshUVs/*, MeshClothData*/));
+            actor->FinishSetup();
+
+            m_actorComponent->SetActorAsset(CreateAssetFromActor(AZStd::move(actor)));
+        }
+
+        NvCloth::ClothConfiguration clothConfig;
+        clothConfig.m_meshNode = MeshNodeName;
+
+        NvCloth::ClothComponentMesh clothComponentMesh(m_actorComponent->GetEntityId(), clothConfig);
+
+        auto tickClothSystem = [](size_t numTicks)
+        {
+            for (size_t i = 0; i < numTicks; ++i)
+            {
+                const float deltaTimeSim = 1.0f / 60.0f;
+                AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick,
+                    deltaTimeSim,
+                    AZ::ScriptTimePoint(AZStd::chrono::system_clock::now()));
+            }
+        };
+
+        const float prevReducedRateDistance = NvCloth::cloth_LodReducedRateDistance;
+        const float prevFreezeDistance = NvCloth::cloth_LodFreezeDistance;
+        ActiveCameraStub activeCamera(AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 15.0f, 0.0f)));
+
+        // Beyond the reduced rate distance the cloth keeps falling, at a reduced solver frequency
+        NvCloth::cloth_LodReducedRateDistance = 10.0f;
+        NvCloth::cloth_LodFreezeDistance = 20.0f;
+        const AZStd::vector<NvCloth::SimParticleFormat> particlesBeforeReducedRate = clothComponentMesh.GetRenderData().m_particles;
+        tickClothSystem(60);
+        EXPECT_EQ(clothComponentMesh.GetSimulationLod(), NvCloth::ClothComponentMesh::SimulationLod::ReducedRate);
+        const AZStd::vector<NvCloth::SimParticleFormat> particlesAfterReducedRate = clothComponentMesh.GetRenderData().m_particles;
+        EXPECT_EQ(particlesAfterReducedRate.size(), particlesBeforeReducedRate.size());
+        for (size_t i = 0; i < particlesAfterReducedRate.size(); ++i)
+        {
+            EXPECT_LT(particlesAfterReducedRate[i].GetZ(), particlesBeforeReducedRate[i].GetZ());
+        }
+
+        // Beyond the freeze distance the cloth keeps its last simulated shape
+        NvCloth::cloth_LodFreezeDistance = 12.0f;
+        tickClothSystem(1);
+        EXPECT_EQ(clothComponentMesh.GetSimulationLod(), NvCloth::ClothComponentMesh::SimulationLod::Frozen);
+        const AZStd::vector<NvCloth::SimParticleFormat> particlesBeforeFrozen = clothComponentMesh.GetRenderData().m_particles;
+        tickClothSystem(60);
+        EXPECT_EQ(clothComponentMesh.GetSimulationLod(), NvCloth::ClothComponentMesh::SimulationLod::Frozen);
+        const AZStd::vector<NvCloth::SimParticleFormat> particlesAfterFrozen = clothComponentMesh.GetRenderData().m_particles;
+        EXPECT_EQ(particlesAfterFrozen.size(), particlesBeforeFrozen.size());
+        for (size_t i = 0; i < particlesAfterFrozen.size(); ++i)
+        {
+            EXPECT_THAT(particlesAfterFrozen[i], IsCloseTolerance(particlesBeforeFrozen[i], Tolerance));
+        }
+
+        // Disabling the level of detail resumes the full simulation
+        NvCloth::cloth_LodReducedRateDistance = 0.0f;
+        NvCloth::cloth_LodFreezeDistance = 0.0f;
+        tickClothSystem(60);
+        EXPECT_EQ(clothComponentMesh.GetSimulationLod(), NvCloth::ClothComponentMesh::SimulationLod::Full);
+        const AZStd::vector<NvCloth::SimParticleFormat> particlesAfterResumed = clothComponentMesh.GetRenderData().m_particles;
+        for (size_t i = 0; i < particlesAfterResumed.size(); ++i)
+        {
+            EXPECT_LT(particlesAfterResumed[i].GetZ(), particlesAfterFrozen[i].GetZ());
+        }
+
+        NvCloth::cloth_LodReducedRateDistance = prevReducedRateDistance;
+        NvCloth::cloth_LodFreezeDistance = prevFreezeDistance;
+    }
 } // namespace UnitTest
@@ -457,4 +457,114 @@ namespace UnitTest
         AZ::Interface<NvCloth::IClothSystem>::Get()->DestroyCloth(cloth);
         AZ::Interface<NvCloth::IClothSystem>::Get()->DestroySolver(solver);
     }
+
+    TEST(NvClothSystem, ClothSystem_TickWithMultipleSolvers_AllNonUserSimulatedSolversAreUpdated)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        const AZStd::vector<AZStd::string> solverNames = { "Solver_TickA", "Solver_TickB", "Solver_TickUserSimulated" };
+
+        AZStd::vector<NvCloth::ISolver*> solvers;
+        AZStd::vector<NvCloth::ICloth*> cloths;
+        const NvCloth::FabricCookedData fabricCookedData = CreateTestFabricCookedData();
+        for (const AZStd::string& solverName : solverNames)
+        {
+            solvers.push_back(AZ::Interface<NvCloth::IClothSystem>::Get()->FindOrCreateSolver(solverName));
+            cloths.push_back(AZ::Interface<NvCloth::IClothSystem>::Get()->CreateCloth(fabricCookedData.m_particles, fabricCookedData));
+            AZ::Interface<NvCloth::IClothSystem>::Get()->AddCloth(cloths.back(), solverName);
+        }
+        solvers.back()->SetUserSimulated(true);
+
+        AZStd::vector<int> clothPostSimulationEventCounts(cloths.size(), 0);
+        AZStd::vector<NvCloth::ICloth::PostSimulationEvent::Handler> clothPostSimulationEventHandlers;
+        clothPostSimulationEventHandlers.reserve(cloths.size());
+        for (size_t i = 0; i < cloths.size(); ++i)
+        {
+            clothPostSimulationEventHandlers.emplace_back(
+                [&clothPostSimulationEventCounts, i](NvCloth::ClothId, float, const AZStd::vector<NvCloth::SimParticleFormat>&)
+                {
+                    ++clothPostSimulationEventCounts[i];
+                });
+            cloths[i]->ConnectPostSimulationEventHandler(clothPostSimulationEventHandlers.back());
+        }
+
+        // Ticking Cloth System to update all its solvers
+        AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick,
+            deltaTimeSim,
+            AZ::ScriptTimePoint(AZStd::chrono::system_clock::now()));
+
+        EXPECT_EQ(clothPostSimulationEventCounts[0], 1);
+        EXPECT_EQ(clothPostSimulationEventCounts[1], 1);
+        EXPECT_EQ(clothPostSimulationEventCounts[2], 0);
+
+        // NOTE: IClothSystem is persistent as it's part of the test environment.
+        //       Destroying cloths and solvers to avoid leaving them in the environment.
+        clothPostSimulationEventHandlers.clear();
+        for (size_t i = 0; i < cloths.size(); ++i)
+        {
+            AZ::Interface<NvCloth::IClothSystem>::Get()->DestroyCloth(cloths[i]);
+            AZ::Interface<NvCloth::IClothSystem>::Get()->DestroySolver(solvers[i]);
+        }
+    }
+
+    //! Tick handler placed between the physics and pre-render ticks, which records whether the solver is simulating while it ticks.
+    class SimulationOverlapTickHandler
+        : public AZ::TickBus::Handler
+    {
+    public:
+        explicit SimulationOverlapTickHandler(const NvCloth::ISolver* solver)
+            : m_solver(solver)
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
+
+        ~SimulationOverlapTickHandler()
+        {
+            AZ::TickBus::Handler::BusDisconnect();
+        }
+
+        void OnTick(float, AZ::ScriptTimePoint) override
+        {
+            m_solverWasSimulating = m_solver->IsSimulating();
+        }
+
+        int GetTickOrder() override
+        {
+            return AZ::TICK_ATTACHMENT;
+        }
+
+        const NvCloth::ISolver* m_solver = nullptr;
+        bool m_solverWasSimulating = false;
+    };
+
+    TEST(NvClothSystem, ClothSystem_Tick_SimulationOverlapsWithTickHandlersBeforePreRender)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+
+        NvCloth::ISolver* solver = AZ::Interface<NvCloth::IClothSystem>::Get()->FindOrCreateSolver("Solver_TickOverlap");
+        const NvCloth::FabricCookedData fabricCookedData = CreateTestFabricCookedData();
+        NvCloth::ICloth* cloth = AZ::Interface<NvCloth::IClothSystem>::Get()->CreateCloth(fabricCookedData.m_particles, fabricCookedData);
+        AZ::Interface<NvCloth::IClothSystem>::Get()->AddCloth(cloth, solver->GetName());
+
+        SimulationOverlapTickHandler overlapTickHandler(solver);
+
+        // Ticking Cloth System to update all its solvers
+        AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick,
+            deltaTimeSim,
+            AZ::ScriptTimePoint(AZStd::chrono::system_clock::now()));
+
+        // The solver was still simulating while the attachment tick handlers ran, and it finished before the end of the tick.
+        EXPECT_TRUE(overlapTickHandler.m_solverWasSimulating);
+        EXPECT_FALSE(solver->IsSimulating());
+
+        // Removing a cloth while its solver is simulating waits for the simulation to finish.
+        solver->StartSimulation(deltaTimeSim);
+        EXPECT_TRUE(solver->IsSimulating());
+        AZ::Interface<NvCloth::IClothSystem>::Get()->RemoveCloth(cloth);
+        EXPECT_FALSE(solver->IsSimulating());
+
+        // NOTE: IClothSystem is persistent as it's part of the test environment.
+        //       Destroying cloth and solver to avoid leaving it in the environment.
+        AZ::Interface<NvCloth::IClothSystem>::Get()->DestroyCloth(cloth);
+        AZ::Interface<NvCloth::IClothSystem>::Get()->DestroySolver(solver);
+    }
 } // namespace UnitTest
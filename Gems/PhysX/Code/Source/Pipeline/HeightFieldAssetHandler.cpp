@@ -16,6 +16,7 @@
 #include <PhysX/SystemComponentBus.h>
 #include <PhysX/ComponentTypeIds.h>
 #include <Source/Pipeline/HeightFieldAssetHandler.h>
+#include <System/PhysXCookedDataCache.h>
 
 #include <extensions/PxSerialization.h>
 #include <extensions/PxDefaultStreams.h>
@@ -201,16 +202,34 @@ namespace PhysX
                 heightFieldDesc.samples.data = samples.data();
                 heightFieldDesc.samples.stride = heightField->getSampleStride();
 
+                // Heightfields with identical samples are reused from the cooked data cache
+                CookedDataKeyBuilder keyBuilder(CookedDataType::HeightField);
+                keyBuilder.AddCookingParams(cooking->getParams());
+                keyBuilder.AddValue(static_cast<AZ::u32>(heightFieldDesc.format));
+                keyBuilder.AddValue(heightFieldDesc.nbColumns);
+                keyBuilder.AddValue(heightFieldDesc.nbRows);
+                keyBuilder.AddBytes(samples.data(), samples.size() * sizeof(physx::PxHeightFieldSample));
+
                 // Cook description to file
-                physx::PxDefaultMemoryOutputStream writer;
-                bool success = cooking->cookHeightField(heightFieldDesc, writer);
-                header.m_assetDataSize = writer.getSize() + 2 * sizeof(float);
+                AZStd::vector<AZ::u8> cookedData;
+                bool success = FindOrCookCachedData(keyBuilder.GetKey(), CookedDataType::HeightField, cookedData,
+                    [cooking, &heightFieldDesc](AZStd::vector<AZ::u8>& cookedHeightField)
+                    {
+                        physx::PxDefaultMemoryOutputStream writer;
+                        const bool cookingResult = cooking->cookHeightField(heightFieldDesc, writer);
+                        if (cookingResult)
+                        {
+                            cookedHeightField.assign(writer.getData(), writer.getData() + writer.getSize());
+                        }
+                        return cookingResult;
+                    });
+                header.m_assetDataSize = static_cast<AZ::u32>(cookedData.size() + 2 * sizeof(float));
 
                 PhysX::StreamWrapper writerStream(stream);
                 writerStream.write(&header, sizeof(header));
                 writerStream.write(&physXHeightFieldAsset->m_minHeight, sizeof(physXHeightFieldAsset->m_minHeight));
                 writerStream.write(&physXHeightFieldAsset->m_maxHeight, sizeof(physXHeightFieldAsset->m_maxHeight));
-                writerStream.write(writer.getData(), writer.getSize());
+                writerStream.write(cookedData.data(), static_cast<physx::PxU32>(cookedData.size()));
 
                 return success;
             }
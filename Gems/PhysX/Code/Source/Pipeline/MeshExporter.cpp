@@ -26,6 +26,7 @@
 #include <Source/Pipeline/PrimitiveShapeFitter/PrimitiveShapeFitter.h>
 #include <Source/Pipeline/MeshGroup.h>
 #include <Source/Utils.h>
+#include <System/PhysXCookedDataCache.h>
 
 #include <PxPhysicsAPI.h>
 #include <VHACD.h>
@@ -369,8 +370,6 @@ namespace PhysX
             const MeshGroup& meshGroup,
             const AZStd::string& platformIdentifier)
         {
-            bool cookingSuccessful = false;
-            AZStd::string cookingResultErrorCodeString;
             const ConvexAssetParams& convexAssetParams = meshGroup.GetConvexAssetParams();
             const TriangleMeshAssetParams& triangleMeshAssetParams = meshGroup.GetTriangleMeshAssetParams();
             bool shouldExportAsConvex = meshGroup.GetExportAsConvex();
@@ -413,72 +412,100 @@ namespace PhysX
                 }
             }
 
-            physx::PxCooking* pxCooking = PxCreateCooking(PX_PHYSICS_VERSION, PxGetFoundation(), pxCookingParams);
-            AZ_Assert(pxCooking, "Failed to create PxCooking");
-
-            physx::PxBoundedData strideData;
-            strideData.count = vertices.size();
-            strideData.stride = sizeof(Vec3);
-            strideData.data = vertices.data();
-
-            physx::PxDefaultMemoryOutputStream cookedMeshData;
-
+            physx::PxConvexFlags convexFlags = physx::PxConvexFlag::eCOMPUTE_CONVEX;
             if (shouldExportAsConvex)
             {
-                physx::PxConvexMeshDesc convexDesc;
-                convexDesc.points = strideData;
-                convexDesc.flags = physx::PxConvexFlag::eCOMPUTE_CONVEX;
-
-                SET_BITS(convexDesc.flags, convexAssetParams.GetUse16bitIndices(), physx::PxConvexFlag::e16_BIT_INDICES);
-                SET_BITS(convexDesc.flags, convexAssetParams.GetCheckZeroAreaTriangles(), physx::PxConvexFlag::eCHECK_ZERO_AREA_TRIANGLES);
-                SET_BITS(convexDesc.flags, convexAssetParams.GetQuantizeInput(), physx::PxConvexFlag::eQUANTIZE_INPUT);
-                SET_BITS(convexDesc.flags, convexAssetParams.GetUsePlaneShifting(), physx::PxConvexFlag::ePLANE_SHIFTING);
-                SET_BITS(convexDesc.flags, convexAssetParams.GetBuildGpuData(), physx::PxConvexFlag::eGPU_COMPATIBLE);
-                SET_BITS(convexDesc.flags, convexAssetParams.GetShiftVertices(), physx::PxConvexFlag::eSHIFT_VERTICES);
-
-                physx::PxConvexMeshCookingResult::Enum convexCookingResultCode = physx::PxConvexMeshCookingResult::eSUCCESS;
-
-                cookingSuccessful =
-                    pxCooking->cookConvexMesh(convexDesc, cookedMeshData, &convexCookingResultCode)
-                    && Utils::ValidateCookedConvexMesh(cookedMeshData.getData(), cookedMeshData.getSize());
-
-                cookingResultErrorCodeString = PhysX::Utils::ConvexCookingResultToString(convexCookingResultCode);
+                SET_BITS(convexFlags, convexAssetParams.GetUse16bitIndices(), physx::PxConvexFlag::e16_BIT_INDICES);
+                SET_BITS(convexFlags, convexAssetParams.GetCheckZeroAreaTriangles(), physx::PxConvexFlag::eCHECK_ZERO_AREA_TRIANGLES);
+                SET_BITS(convexFlags, convexAssetParams.GetQuantizeInput(), physx::PxConvexFlag::eQUANTIZE_INPUT);
+                SET_BITS(convexFlags, convexAssetParams.GetUsePlaneShifting(), physx::PxConvexFlag::ePLANE_SHIFTING);
+                SET_BITS(convexFlags, convexAssetParams.GetBuildGpuData(), physx::PxConvexFlag::eGPU_COMPATIBLE);
+                SET_BITS(convexFlags, convexAssetParams.GetShiftVertices(), physx::PxConvexFlag::eSHIFT_VERTICES);
 
                 // Check how many unique materials are assigned onto the convex mesh.
                 // Report it to the user if there's more than 1 since PhysX only supports a single material assigned to a convex
                 RequireSingleFaceMaterial(faceMaterials);
             }
+
+            // Identical geometry cooked with the same parameters is reused from the cooked data cache,
+            // skipping the creation of the cooking interface as well as the cooking itself.
+            const CookedDataType cookedDataType = shouldExportAsConvex ? CookedDataType::ConvexMesh : CookedDataType::TriangleMesh;
+            CookedDataKeyBuilder keyBuilder(cookedDataType);
+            keyBuilder.AddCookingParams(pxCookingParams);
+            keyBuilder.AddBytes(vertices.data(), vertices.size() * sizeof(Vec3));
+            if (shouldExportAsConvex)
+            {
+                keyBuilder.AddValue(static_cast<AZ::u32>(convexFlags));
+            }
             else
             {
-                physx::PxTriangleMeshDesc meshDesc;
-                meshDesc.points = strideData;
+                keyBuilder.AddBytes(indices.data(), indices.size() * sizeof(AZ::u32));
+                keyBuilder.AddBytes(faceMaterials.data(), faceMaterials.size() * sizeof(AZ::u16));
+            }
 
-                meshDesc.triangles.count = indices.size() / 3;
-                meshDesc.triangles.stride = sizeof(AZ::u32) * 3;
-                meshDesc.triangles.data = indices.data();
+            const bool cookingSuccessful = FindOrCookCachedData(keyBuilder.GetKey(), cookedDataType, *output,
+                [&](AZStd::vector<AZ::u8>& cookedData)
+                {
+                    physx::PxCooking* pxCooking = PxCreateCooking(PX_PHYSICS_VERSION, PxGetFoundation(), pxCookingParams);
+                    AZ_Assert(pxCooking, "Failed to create PxCooking");
 
-                meshDesc.materialIndices.stride = sizeof(AZ::u16);
-                meshDesc.materialIndices.data = faceMaterials.data();
+                    physx::PxBoundedData strideData;
+                    strideData.count = vertices.size();
+                    strideData.stride = sizeof(Vec3);
+                    strideData.data = vertices.data();
 
-                physx::PxTriangleMeshCookingResult::Enum trimeshCookingResultCode = physx::PxTriangleMeshCookingResult::eSUCCESS;
+                    physx::PxDefaultMemoryOutputStream cookedMeshData;
+                    bool success = false;
+                    AZStd::string cookingResultErrorCodeString;
 
-                cookingSuccessful =
-                    pxCooking->cookTriangleMesh(meshDesc, cookedMeshData, &trimeshCookingResultCode)
-                    && Utils::ValidateCookedTriangleMesh(cookedMeshData.getData(), cookedMeshData.getSize());
+                    if (shouldExportAsConvex)
+                    {
+                        physx::PxConvexMeshDesc convexDesc;
+                        convexDesc.points = strideData;
+                        convexDesc.flags = convexFlags;
 
-                cookingResultErrorCodeString = PhysX::Utils::TriMeshCookingResultToString(trimeshCookingResultCode);
-            }
+                        physx::PxConvexMeshCookingResult::Enum convexCookingResultCode = physx::PxConvexMeshCookingResult::eSUCCESS;
 
-            if (cookingSuccessful)
-            {
-                output->insert(output->end(), cookedMeshData.getData(), cookedMeshData.getData() + cookedMeshData.getSize());
-            }
-            else
-            {
-                AZ_TracePrintf(AZ::SceneAPI::Utilities::ErrorWindow, "Cooking Mesh failed: %s", cookingResultErrorCodeString.c_str());
-            }
+                        success =
+                            pxCooking->cookConvexMesh(convexDesc, cookedMeshData, &convexCookingResultCode)
+                            && Utils::ValidateCookedConvexMesh(cookedMeshData.getData(), cookedMeshData.getSize());
+
+                        cookingResultErrorCodeString = PhysX::Utils::ConvexCookingResultToString(convexCookingResultCode);
+                    }
+                    else
+                    {
+                        physx::PxTriangleMeshDesc meshDesc;
+                        meshDesc.points = strideData;
+
+                        meshDesc.triangles.count = indices.size() / 3;
+                        meshDesc.triangles.stride = sizeof(AZ::u32) * 3;
+                        meshDesc.triangles.data = indices.data();
+
+                        meshDesc.materialIndices.stride = sizeof(AZ::u16);
+                        meshDesc.materialIndices.data = faceMaterials.data();
+
+                        physx::PxTriangleMeshCookingResult::Enum trimeshCookingResultCode = physx::PxTriangleMeshCookingResult::eSUCCESS;
+
+                        success =
+                            pxCooking->cookTriangleMesh(meshDesc, cookedMeshData, &trimeshCookingResultCode)
+                            && Utils::ValidateCookedTriangleMesh(cookedMeshData.getData(), cookedMeshData.getSize());
+
+                        cookingResultErrorCodeString = PhysX::Utils::TriMeshCookingResultToString(trimeshCookingResultCode);
+                    }
+
+                    if (success)
+                    {
+                        cookedData.assign(cookedMeshData.getData(), cookedMeshData.getData() + cookedMeshData.getSize());
+                    }
+                    else
+                    {
+                        AZ_TracePrintf(AZ::SceneAPI::Utilities::ErrorWindow, "Cooking Mesh failed: %s", cookingResultErrorCodeString.c_str());
+                    }
+
+                    pxCooking->release();
+                    return success;
+                });
 
-            pxCooking->release();
             return cookingSuccessful;
         }
 
@@ -7,4 +7,5 @@
 #pragma once
 
 #define AZ_TRAIT_PHYSX_FORCE_LOAD_MODULES 0
+#define AZ_TRAIT_PHYSX_CPU_DISPATCHER_SHARE_GLOBAL_JOBS 1
 
@@ -13,6 +13,7 @@
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <PhysX/ColliderComponentBus.h>
@@ -20,6 +21,8 @@
 #include <Source/RigidBodyComponent.h>
 #include <Source/Shape.h>
 #include <Source/RigidBody.h>
+#include <Scene/PhysXScene.h>
+#include <Scene/PhysXSceneTransformWriter.h>
 
 namespace PhysX
 {
@@ -90,16 +93,12 @@ namespace PhysX
         }
     }
 
-    RigidBodyComponent::RigidBodyComponent()
-    {
-        InitPhysicsTickHandler();
-    }
+    RigidBodyComponent::RigidBodyComponent() = default;
 
     RigidBodyComponent::RigidBodyComponent(const AzPhysics::RigidBodyConfiguration& config, AzPhysics::SceneHandle sceneHandle)
         : m_configuration(config)
         , m_attachedSceneHandle(sceneHandle)
     {
-        InitPhysicsTickHandler();
     }
 
     void RigidBodyComponent::Init()
@@ -176,6 +175,11 @@ namespace PhysX
             return;
         }
 
+        if (SceneTransformWriter* transformWriter = GetSceneTransformWriter())
+        {
+            transformWriter->RemoveComponent(this);
+        }
+
         if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
         {
             sceneInterface->RemoveSimulatedBody(m_attachedSceneHandle, m_rigidBodyHandle);
@@ -184,7 +188,6 @@ namespace PhysX
         Physics::RigidBodyRequestBus::Handler::BusDisconnect();
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
-        m_sceneFinishSimHandler.Disconnect();
         AZ::TickBus::Handler::BusDisconnect();
     }
 
@@ -206,55 +209,42 @@ namespace PhysX
         return AZ::ComponentTickBus::TICK_PHYSICS;
     }
 
-    void RigidBodyComponent::InitPhysicsTickHandler()
-    {
-        m_sceneFinishSimHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler([this](
-            [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
-            float fixedDeltatime
-            )
-            {
-                this->PostPhysicsTick(fixedDeltatime);
-            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
-    }
-
-    void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime)
+    bool RigidBodyComponent::ShouldWriteSimulatedTransform(const AzPhysics::RigidBody& rigidBody) const
     {
         // When transform changes, Kinematic Target is updated with the new transform, so don't set the transform again.
         // But in the case of setting the Kinematic Target directly, the transform needs to reflect the new kinematic target
         //    User sets kinematic Target ---> Update transform
         //    User sets transform        ---> Update kinematic target
+        return rigidBody.m_simulating && !(rigidBody.IsKinematic() && !m_isLastMovementFromKinematicSource);
+    }
 
-        if (!IsPhysicsEnabled() || (IsKinematic() && !m_isLastMovementFromKinematicSource))
+    void RigidBodyComponent::WriteSimulatedTransform(const AZ::Vector3& position, const AZ::Quaternion& orientation, float fixedDeltaTime)
+    {
+        if (m_configuration.m_interpolateMotion)
         {
-            return;
+            m_interpolator->SetTarget(position, orientation, fixedDeltaTime);
         }
-
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-        if (sceneInterface == nullptr)
+        else if (AZ::TransformInterface* transform = GetEntity()->GetTransform())
         {
-            AZ_Error("RigidBodyComponent", false, "PostPhysicsTick, SceneInterface is null");
-            return;
+            // Set rotation and translation together, so listeners get a single transform change.
+            AZ::Transform worldTM = transform->GetWorldTM();
+            worldTM.SetRotation(orientation);
+            worldTM.SetTranslation(position);
+            transform->SetWorldTM(worldTM);
         }
+        m_isLastMovementFromKinematicSource = false;
+    }
 
-        AzPhysics::SimulatedBody* rigidBody =
-            sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle);
-        if (rigidBody == nullptr)
-        {
-            AZ_Error("RigidBodyComponent", false, "Unable to retrieve simulated rigid body");
-            return;
-        }
-        
-        AZ::Transform transform = rigidBody->GetTransform();
-        if (m_configuration.m_interpolateMotion)
-        {
-            m_interpolator->SetTarget(transform.GetTranslation(), rigidBody->GetOrientation(), fixedDeltaTime);
-        }
-        else
+    SceneTransformWriter* RigidBodyComponent::GetSceneTransformWriter() const
+    {
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
         {
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldRotationQuaternion, rigidBody->GetOrientation());
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTranslation, rigidBody->GetPosition());
+            if (auto* physXScene = azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(m_attachedSceneHandle)))
+            {
+                return &physXScene->GetTransformWriter();
+            }
         }
-        m_isLastMovementFromKinematicSource = false;
+        return nullptr;
     }
 
     void RigidBodyComponent::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
@@ -299,10 +289,13 @@ namespace PhysX
             m_rigidBodyHandle = sceneInterface->AddSimulatedBody(m_attachedSceneHandle, &m_configuration);
         }
 
-        // Listen to the PhysX system for events concerning this entity.
-        if (sceneInterface != nullptr)
+        // Follow the rigid body after each simulation step.
+        if (SceneTransformWriter* transformWriter = GetSceneTransformWriter())
         {
-            sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
+            if (AzPhysics::RigidBody* rigidBody = GetRigidBody())
+            {
+                transformWriter->AddComponent(this, rigidBody);
+            }
         }
         AZ::TickBus::Handler::BusConnect();
         AZ::TransformNotificationBus::MultiHandler::BusConnect(GetEntityId());
@@ -24,6 +24,7 @@ namespace AzPhysics
 
 namespace PhysX
 {
+    class SceneTransformWriter;
     class TransformForwardTimeInterpolator;
 
     /// Component used to register an entity as a dynamic rigid body in the PhysX simulation.
@@ -145,8 +146,14 @@ namespace PhysX
     private:
         void SetupConfiguration();
         void CreatePhysics();
-        void InitPhysicsTickHandler();
-        void PostPhysicsTick(float fixedDeltaTime);
+
+        friend class SceneTransformWriter;
+        //! Whether the entity should follow the rigid body after a simulation step.
+        //! Called from job threads while the scene is read locked.
+        bool ShouldWriteSimulatedTransform(const AzPhysics::RigidBody& rigidBody) const;
+        //! Moves the entity to the simulated pose of the rigid body, or makes it the interpolation target.
+        void WriteSimulatedTransform(const AZ::Vector3& position, const AZ::Quaternion& orientation, float fixedDeltaTime);
+        SceneTransformWriter* GetSceneTransformWriter() const;
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
@@ -159,8 +166,6 @@ namespace PhysX
         bool m_staticTransformAtActivation = false; ///< Whether the transform was static when the component last activated.
         bool m_isLastMovementFromKinematicSource = false; ///< True when the source of the movement comes from SetKinematicTarget as opposed to coming from a Transform change
         bool m_rigidBodyTransformNeedsUpdateOnPhysReEnable = false; ///< True if rigid body transform needs to be synced to the entity's when physics is re-enabled
-
-        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
     };
 
     class TransformForwardTimeInterpolator
@@ -8,7 +8,12 @@
 
 #include <Scene/PhysXScene.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzFramework/Physics/Character.h>
@@ -37,8 +42,88 @@ namespace PhysX
     /*static*/ thread_local AZStd::vector<physx::PxSweepHit> PhysXScene::s_sweepBuffer;
     /*static*/ thread_local AZStd::vector<physx::PxOverlapHit> PhysXScene::s_overlapBuffer;
 
+    AZ_CVAR(AZ::u32, physx_asyncSceneQueryCompletion, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When the callbacks of asynchronous scene queries are called. "
+        "0: at the start of the next simulation step, 1: at the end of the simulation step, once its results are fetched.");
+    AZ_CVAR(AZ::u32, physx_sceneQueryBatchJobSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Minimum number of requests run by each job of a scene query batch. Smaller batches run on the calling thread.");
+
+    struct PhysXScene::AsyncSceneQuery
+    {
+        AzPhysics::SceneQuery::AsyncRequestId m_requestId;
+        AzPhysics::SceneQueryRequests m_ownedRequests; //!< Keeps the requests alive until the query completes.
+        AZStd::vector<const AzPhysics::SceneQueryRequest*> m_requests;
+        AzPhysics::SceneQueryHitsList m_results;
+        AzPhysics::SceneQuery::AsyncCallback m_callback;
+        AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback;
+        AZStd::unique_ptr<AZ::JobCompletion> m_completion; //!< Null when the queries ran on the calling thread.
+    };
+
     namespace Internal
     {
+        enum AsyncSceneQueryCompletion : AZ::u32
+        {
+            SimulationStart = 0,
+            SimulationFinish = 1
+        };
+
+        bool IsAsyncSceneQueryCompletionStage(AsyncSceneQueryCompletion stage)
+        {
+            // Any value other than SimulationStart completes at the end of the step, so queries are never left waiting.
+            const bool completeAtStart = static_cast<AZ::u32>(physx_asyncSceneQueryCompletion) == SimulationStart;
+            return completeAtStart == (stage == SimulationStart);
+        }
+
+        //! Returns how many jobs a batch of queries should be split into, 0 if there is no job system to run them.
+        size_t GetSceneQueryJobCount(size_t requestCount)
+        {
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (jobContext == nullptr)
+            {
+                return 0;
+            }
+
+            const size_t minJobSize = AZStd::max<size_t>(static_cast<AZ::u32>(physx_sceneQueryBatchJobSize), 1);
+            const size_t workerCount = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1);
+            return AZStd::min((requestCount + minJobSize - 1) / minJobSize, workerCount);
+        }
+
+        //! Copies a request, so an asynchronous query doesn't depend on the caller keeping it alive.
+        //! Returns nullptr if the request isn't one of RayCastRequest, ShapeCastRequest or OverlapRequest.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CopySceneQueryRequest(const AzPhysics::SceneQueryRequest& request)
+        {
+            if (const auto* raycastRequest = azrtti_cast<const AzPhysics::RayCastRequest*>(&request))
+            {
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*raycastRequest);
+            }
+            if (const auto* shapecastRequest = azrtti_cast<const AzPhysics::ShapeCastRequest*>(&request))
+            {
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*shapecastRequest);
+            }
+            if (const auto* overlapRequest = azrtti_cast<const AzPhysics::OverlapRequest*>(&request))
+            {
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*overlapRequest);
+            }
+            return nullptr;
+        }
+
+        //! Splits [0, count) into jobCount contiguous ranges and starts a job running rangeFunction(begin, end) on each.
+        template<typename RangeFunction>
+        void StartRangeJobs(size_t count, size_t jobCount, AZ::JobCompletion& completion, const RangeFunction& rangeFunction)
+        {
+            for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                const size_t begin = count * jobIndex / jobCount;
+                const size_t end = count * (jobIndex + 1) / jobCount;
+                AZ::Job* job = AZ::CreateJobFunction([rangeFunction, begin, end]()
+                    {
+                        rangeFunction(begin, end);
+                    }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+        }
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -461,6 +546,10 @@ namespace PhysX
                 m_shapecastBufferSize = config->m_shapecastBufferSize;
                 m_overlapBufferSize = config->m_overlapBufferSize;
             })
+        , m_transformWriterHandler([this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                m_transformWriter.WriteTransforms(m_pxScene, fixedDeltaTime);
+            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics))
     {
         //setup the scene query buffer sizes
         if (auto* physXSystem = GetPhysXSystem())
@@ -485,11 +574,24 @@ namespace PhysX
         m_pxScene->userData = this;
 
         m_gravity = m_config.m_gravity;
+
+        RegisterSceneSimulationFinishHandler(m_transformWriterHandler);
     }
 
     PhysXScene::~PhysXScene()
     {
         m_physicsSystemConfigChanged.Disconnect();
+        m_transformWriterHandler.Disconnect();
+
+        // Queries still in flight read from the scene, wait for them but drop their callbacks.
+        for (AZStd::unique_ptr<AsyncSceneQuery>& asyncQuery : m_asyncSceneQueries)
+        {
+            if (asyncQuery->m_completion)
+            {
+                asyncQuery->m_completion->StartAndWaitForCompletion();
+            }
+        }
+        m_asyncSceneQueries.clear();
 
         for (auto& simulatedBody : m_simulatedBodies)
         {
@@ -525,6 +627,11 @@ namespace PhysX
     {
         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::StartSimulation");
 
+        if (Internal::IsAsyncSceneQueryCompletionStage(Internal::SimulationStart))
+        {
+            CompleteAsyncSceneQueries();
+        }
+
         if (!IsEnabled())
         {
             return;
@@ -547,6 +654,10 @@ namespace PhysX
 
         if (!IsEnabled())
         {
+            if (Internal::IsAsyncSceneQueryCompletionStage(Internal::SimulationFinish))
+            {
+                CompleteAsyncSceneQueries();
+            }
             return;
         }
 
@@ -589,12 +700,26 @@ namespace PhysX
                     activeBodyHandles.emplace_back(actorData->GetBodyHandle());
                 }
             }
+
+            // Only the bodies that moved are in the active actors list, resolve them before the handlers below can
+            // remove bodies. The transforms are written by m_transformWriterHandler.
+            m_transformWriter.GatherActiveComponents(activeActors, numActiveActors);
+
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
         }
+        else
+        {
+            m_transformWriter.GatherAllComponents();
+        }
 
         FlushQueuedEvents();
         ClearDeferedDeletions();
 
+        if (Internal::IsAsyncSceneQueryCompletionStage(Internal::SimulationFinish))
+        {
+            CompleteAsyncSceneQueries();
+        }
+
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "OnSceneSimulationFinishedEvent::Signaled");
             m_sceneSimuationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
@@ -943,27 +1068,146 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::QuerySceneBatch");
+
+        AZStd::vector<const AzPhysics::SceneQueryRequest*> requestList;
+        requestList.reserve(requests.size());
+        for (const auto& request : requests)
         {
-            results.emplace_back(QueryScene(request.get()));
+            requestList.push_back(request.get());
         }
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        const size_t jobCount = Internal::GetSceneQueryJobCount(requestList.size());
+        if (jobCount <= 1)
+        {
+            QuerySceneRange(requestList.data(), 0, requestList.size(), results.data());
+            return results;
+        }
+
+        AZ::JobCompletion completion;
+        Internal::StartRangeJobs(requestList.size(), jobCount, completion,
+            [this, &requestList, &results](size_t begin, size_t end)
+            {
+                QuerySceneRange(requestList.data(), begin, end, results.data());
+            });
+        completion.StartAndWaitForCompletion();
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
+    {
+        if (request == nullptr || !callback)
+        {
+            AZ_Warning("Physx", false, "QuerySceneAsync needs a request and a callback.");
+            return false;
+        }
+
+        // The request is read by the jobs after this returns, so the query keeps its own copy.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> ownedRequest = Internal::CopySceneQueryRequest(*request);
+        if (ownedRequest == nullptr)
+        {
+            AZ_Warning("Physx", false, "QuerySceneAsync: Unknown request type (%s).", request->RTTI_GetTypeName());
+            return false;
+        }
+
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_requests.push_back(ownedRequest.get());
+        asyncQuery->m_ownedRequests.push_back(AZStd::move(ownedRequest));
+        asyncQuery->m_callback = AZStd::move(callback);
+        StartAsyncSceneQuery(AZStd::move(asyncQuery));
+        return true;
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    {
+        if (!callback)
+        {
+            AZ_Warning("Physx", false, "QuerySceneAsyncBatch needs a callback.");
+            return false;
+        }
+
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_ownedRequests = requests;
+        asyncQuery->m_requests.reserve(requests.size());
+        for (const auto& request : requests)
+        {
+            asyncQuery->m_requests.push_back(request.get());
+        }
+        asyncQuery->m_batchCallback = AZStd::move(callback);
+        StartAsyncSceneQuery(AZStd::move(asyncQuery));
+        return true;
+    }
+
+    void PhysXScene::QuerySceneRange(const AzPhysics::SceneQueryRequest* const* requests, size_t begin, size_t end, AzPhysics::SceneQueryHits* results)
+    {
+        // Hold the read lock across the whole range so the scene can't change between its queries.
+        // The lock is reentrant, so the per query locks are cheap.
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+        for (size_t i = begin; i < end; ++i)
+        {
+            results[i] = QueryScene(requests[i]);
+        }
+    }
+
+    void PhysXScene::StartAsyncSceneQuery(AZStd::unique_ptr<AsyncSceneQuery> asyncQuery)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AsyncSceneQuery& query = *asyncQuery;
+        const size_t requestCount = query.m_requests.size();
+        query.m_results.resize(requestCount);
+
+        const size_t jobCount = Internal::GetSceneQueryJobCount(requestCount);
+        if (jobCount == 0 || requestCount == 0)
+        {
+            QuerySceneRange(query.m_requests.data(), 0, requestCount, query.m_results.data());
+        }
+        else
+        {
+            // The query is heap allocated, so it can be referenced by the jobs while it waits in the queue.
+            query.m_completion = AZStd::make_unique<AZ::JobCompletion>();
+            Internal::StartRangeJobs(requestCount, jobCount, *query.m_completion,
+                [this, &query](size_t begin, size_t end)
+                {
+                    QuerySceneRange(query.m_requests.data(), begin, end, query.m_results.data());
+                });
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueriesMutex);
+        m_asyncSceneQueries.push_back(AZStd::move(asyncQuery));
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    void PhysXScene::CompleteAsyncSceneQueries()
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::CompleteAsyncSceneQueries");
+
+        // Queries made from the callbacks complete at the next completion stage.
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> asyncQueries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueriesMutex);
+            asyncQueries.swap(m_asyncSceneQueries);
+        }
+
+        for (AZStd::unique_ptr<AsyncSceneQuery>& asyncQuery : asyncQueries)
+        {
+            if (asyncQuery->m_completion)
+            {
+                asyncQuery->m_completion->StartAndWaitForCompletion();
+            }
+
+            if (asyncQuery->m_batchCallback)
+            {
+                asyncQuery->m_batchCallback(asyncQuery->m_requestId, AZStd::move(asyncQuery->m_results));
+            }
+            else
+            {
+                asyncQuery->m_callback(asyncQuery->m_requestId, AZStd::move(asyncQuery->m_results.front()));
+            }
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -11,9 +11,12 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
+#include <Scene/PhysXSceneTransformWriter.h>
 
 namespace physx
 {
@@ -23,6 +26,11 @@ namespace physx
 namespace PhysX
 {
     //! PhysX implementation of the AzPhysics::Scene.
+    //!
+    //! Large query batches are split across the job system, so filter callbacks of batched and asynchronous
+    //! requests may be called from job threads. Asynchronous queries start running as soon as they are queued and
+    //! their callbacks are called on the simulating thread at the stage selected by physx_asyncSceneQueryCompletion.
+    //! Callbacks of queries still in flight when the scene is destroyed are never called.
     class PhysXScene
         : public AzPhysics::Scene
     {
@@ -74,6 +82,9 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Writes the transforms of the scene's rigid body components back to their entities after each step.
+        SceneTransformWriter& GetTransformWriter() { return m_transformWriter; }
+
     private:
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
@@ -85,6 +96,15 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        struct AsyncSceneQuery;
+
+        //! Runs the requests in [begin, end) under a single scene read lock, writing the hits to the matching results.
+        void QuerySceneRange(const AzPhysics::SceneQueryRequest* const* requests, size_t begin, size_t end, AzPhysics::SceneQueryHits* results);
+        //! Starts the queries on the job system, or runs them right away if there is none.
+        void StartAsyncSceneQuery(AZStd::unique_ptr<AsyncSceneQuery> asyncQuery);
+        //! Waits for the queued asynchronous queries and calls their callbacks.
+        void CompleteAsyncSceneQueries();
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -107,8 +127,13 @@ namespace PhysX
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> m_asyncSceneQueries; //!< Queued asynchronous queries, in the order they were made.
+        AZStd::mutex m_asyncSceneQueriesMutex;
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
+        SceneTransformWriter m_transformWriter; //!< Writes the simulated transforms of rigid body components.
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_transformWriterHandler; //!< Runs m_transformWriter at physics priority.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
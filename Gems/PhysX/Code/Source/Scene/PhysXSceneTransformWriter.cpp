@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PhysX_precompiled.h>
+#include <Scene/PhysXSceneTransformWriter.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
+#include <PhysX/PhysXLocks.h>
+#include <PhysX/Utils.h>
+#include <RigidBodyComponent.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        //! Below this many bodies per job the poses are read on the calling thread.
+        static constexpr size_t MinTransformsPerJob = 256;
+
+        //! Calls function(begin, end) over contiguous ranges of [0, count), in parallel when there are enough items.
+        //! Each range holds a scene read lock, as the poses are read from the PhysX actors.
+        template<typename RangeFunction>
+        void ForEachRange(physx::PxScene* pxScene, size_t count, const RangeFunction& function)
+        {
+            const size_t jobCount = count / MinTransformsPerJob;
+            if (jobCount <= 1 || AZ::JobContext::GetGlobalContext() == nullptr)
+            {
+                PHYSX_SCENE_READ_LOCK(pxScene);
+                function(size_t{ 0 }, count);
+                return;
+            }
+
+            AZ::parallel_for(size_t{ 0 }, jobCount,
+                [pxScene, count, jobCount, &function](size_t jobIndex)
+                {
+                    PHYSX_SCENE_READ_LOCK(pxScene);
+                    function(count * jobIndex / jobCount, count * (jobIndex + 1) / jobCount);
+                },
+                AZ::simple_partitioner(1));
+        }
+    } // namespace Internal
+
+    void SceneTransformWriter::AddComponent(RigidBodyComponent* component, AzPhysics::RigidBody* rigidBody)
+    {
+        AZ_Assert(component && rigidBody, "SceneTransformWriter::AddComponent needs a component and its rigid body.");
+        if (m_componentIndices.find(component) != m_componentIndices.end())
+        {
+            RemoveComponent(component);
+        }
+
+        m_componentIndices[component] = m_entries.size();
+        m_rigidBodyIndices[rigidBody] = m_entries.size();
+        m_entries.push_back({ component, rigidBody });
+
+        if (component->m_configuration.m_interpolateMotion)
+        {
+            m_interpolatedComponents.push_back(component);
+        }
+    }
+
+    void SceneTransformWriter::RemoveComponent(RigidBodyComponent* component)
+    {
+        auto componentIt = m_componentIndices.find(component);
+        if (componentIt == m_componentIndices.end())
+        {
+            return;
+        }
+
+        // Swap with the last entry to keep the entries packed.
+        const size_t index = componentIt->second;
+        m_componentIndices.erase(componentIt);
+        m_rigidBodyIndices.erase(m_entries[index].m_rigidBody);
+
+        if (index != m_entries.size() - 1)
+        {
+            m_entries[index] = m_entries.back();
+            m_componentIndices[m_entries[index].m_component] = index;
+            m_rigidBodyIndices[m_entries[index].m_rigidBody] = index;
+        }
+        m_entries.pop_back();
+
+        auto interpolatedIt = AZStd::find(m_interpolatedComponents.begin(), m_interpolatedComponents.end(), component);
+        if (interpolatedIt != m_interpolatedComponents.end())
+        {
+            *interpolatedIt = m_interpolatedComponents.back();
+            m_interpolatedComponents.pop_back();
+        }
+    }
+
+    void SceneTransformWriter::GatherActiveComponents(physx::PxActor* const* activeActors, size_t activeActorCount)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "SceneTransformWriter::GatherActiveComponents");
+
+        // Resolve the actors now, the list and the actors in it can be released once the scene lock is given up.
+        m_gatheredComponents.clear();
+        if (m_entries.empty())
+        {
+            return;
+        }
+
+        m_gatheredComponents.reserve(activeActorCount);
+        for (size_t i = 0; i < activeActorCount; ++i)
+        {
+            // Active actors also include bodies without a rigid body component, such as ragdoll nodes.
+            const ActorData* actorData = Utils::GetUserData(activeActors[i]);
+            if (actorData == nullptr)
+            {
+                continue;
+            }
+
+            auto entryIt = m_rigidBodyIndices.find(actorData->GetRigidBody());
+            if (entryIt != m_rigidBodyIndices.end())
+            {
+                RigidBodyComponent* component = m_entries[entryIt->second].m_component;
+                if (!component->m_configuration.m_interpolateMotion)
+                {
+                    m_gatheredComponents.push_back(component);
+                }
+            }
+        }
+
+        // The interpolators advance their fixed time with each target, so they're fed while their bodies sleep too.
+        // Otherwise the real time runs ahead of it and the motion snaps to the targets once the body wakes.
+        m_gatheredComponents.insert(m_gatheredComponents.end(), m_interpolatedComponents.begin(), m_interpolatedComponents.end());
+    }
+
+    void SceneTransformWriter::GatherAllComponents()
+    {
+        m_gatheredComponents.clear();
+        m_gatheredComponents.reserve(m_entries.size());
+        for (const Entry& entry : m_entries)
+        {
+            m_gatheredComponents.push_back(entry.m_component);
+        }
+    }
+
+    void SceneTransformWriter::WriteTransforms(physx::PxScene* pxScene, float fixedDeltaTime)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "SceneTransformWriter::WriteTransforms");
+
+        m_pendingTransforms.clear();
+        m_pendingTransforms.resize(m_gatheredComponents.size());
+
+        // Collision and trigger handlers ran since the components were gathered, those removed since are skipped.
+        Internal::ForEachRange(pxScene, m_gatheredComponents.size(),
+            [this](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    auto componentIt = m_componentIndices.find(m_gatheredComponents[i]);
+                    if (componentIt != m_componentIndices.end())
+                    {
+                        ReadTransform(m_entries[componentIt->second], m_pendingTransforms[i]);
+                    }
+                }
+            });
+        m_gatheredComponents.clear();
+
+        // Writing a transform notifies its listeners, which may change the scene, so this stays on the calling thread.
+        // A listener may also deactivate another entity, so check its component is still here.
+        for (const PendingTransform& pendingTransform : m_pendingTransforms)
+        {
+            if (pendingTransform.m_component &&
+                m_componentIndices.find(pendingTransform.m_component) != m_componentIndices.end())
+            {
+                pendingTransform.m_component->WriteSimulatedTransform(
+                    pendingTransform.m_position, pendingTransform.m_orientation, fixedDeltaTime);
+            }
+        }
+    }
+
+    void SceneTransformWriter::ReadTransform(const Entry& entry, PendingTransform& pendingTransform)
+    {
+        if (entry.m_component->ShouldWriteSimulatedTransform(*entry.m_rigidBody))
+        {
+            pendingTransform.m_component = entry.m_component;
+            pendingTransform.m_position = entry.m_rigidBody->GetPosition();
+            pendingTransform.m_orientation = entry.m_rigidBody->GetOrientation();
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace physx
+{
+    class PxActor;
+    class PxScene;
+}
+
+namespace AzPhysics
+{
+    struct RigidBody;
+}
+
+namespace PhysX
+{
+    class RigidBodyComponent;
+
+    //! Helper class that writes the simulated transforms of a scene's rigid body components back to their entities.
+    //! The scene gathers the components to write while its active actors list is valid, before collision and trigger
+    //! handlers can remove bodies. The transforms are written from a simulation finish handler at physics priority,
+    //! the slot each component's own handler used to run in. Poses are read in parallel on the job system, then
+    //! written on the simulating thread through the entities' transform interfaces, with one transform change per entity.
+    class SceneTransformWriter
+    {
+    public:
+        //! Adds a component whose rigid body was added to the scene. The body must stay in the scene until the
+        //! component is removed.
+        void AddComponent(RigidBodyComponent* component, AzPhysics::RigidBody* rigidBody);
+        void RemoveComponent(RigidBodyComponent* component);
+
+        //! Gathers the components whose bodies are in the scene's active actors, to be written by WriteTransforms.
+        //! Components interpolating their motion are always gathered, their interpolators need a target every step.
+        //! Must be called under a scene read lock, as long as the active actors list is valid.
+        void GatherActiveComponents(physx::PxActor* const* activeActors, size_t activeActorCount);
+
+        //! Gathers every component to be written by WriteTransforms, for scenes which don't report their active actors.
+        void GatherAllComponents();
+
+        //! Writes the transforms of the gathered components which are still added.
+        void WriteTransforms(physx::PxScene* pxScene, float fixedDeltaTime);
+
+    private:
+        struct Entry
+        {
+            RigidBodyComponent* m_component = nullptr;
+            AzPhysics::RigidBody* m_rigidBody = nullptr;
+        };
+
+        struct PendingTransform
+        {
+            RigidBodyComponent* m_component = nullptr; //!< Null if the transform doesn't need writing.
+            AZ::Vector3 m_position;
+            AZ::Quaternion m_orientation;
+        };
+
+        static void ReadTransform(const Entry& entry, PendingTransform& pendingTransform);
+
+        AZStd::vector<Entry> m_entries;
+        AZStd::unordered_map<const RigidBodyComponent*, size_t> m_componentIndices; //!< Index of each component in m_entries.
+        AZStd::unordered_map<const AzPhysics::RigidBody*, size_t> m_rigidBodyIndices; //!< Index of each body in m_entries.
+        AZStd::vector<RigidBodyComponent*> m_interpolatedComponents; //!< Added components which interpolate their motion.
+        AZStd::vector<RigidBodyComponent*> m_gatheredComponents; //!< Components to write after the current step.
+        AZStd::vector<PendingTransform> m_pendingTransforms; //!< Kept between steps to avoid reallocating.
+    };
+} // namespace PhysX
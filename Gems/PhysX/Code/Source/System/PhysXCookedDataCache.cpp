@@ -0,0 +1,558 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <PhysX_precompiled.h>
+
+#include <System/PhysXCookedDataCache.h>
+#include <System/PhysXSystem.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace PhysX
+{
+    static void OnCookedDataCacheDirectoryChanged(const AZ::CVarFixedString& directory)
+    {
+        if (PhysXSystem* physXSystem = GetPhysXSystem())
+        {
+            physXSystem->GetCookedDataCache().SetDiskCacheDirectory(directory.c_str());
+        }
+    }
+
+    static void OnCookedDataCacheMemoryBudgetChanged(const AZ::u32& budgetMB)
+    {
+        if (PhysXSystem* physXSystem = GetPhysXSystem())
+        {
+            physXSystem->GetCookedDataCache().SetMemoryBudget(static_cast<size_t>(budgetMB) * 1024 * 1024);
+        }
+    }
+
+    static void OnCookedDataCacheDiskBudgetChanged(const AZ::u32& budgetMB)
+    {
+        if (PhysXSystem* physXSystem = GetPhysXSystem())
+        {
+            physXSystem->GetCookedDataCache().SetDiskBudget(static_cast<AZ::u64>(budgetMB) * 1024 * 1024);
+        }
+    }
+
+    AZ_CVAR(AZ::CVarFixedString, physx_cookedDataCacheDirectory, "", &OnCookedDataCacheDirectoryChanged, AZ::ConsoleFunctorFlags::Null,
+        "Directory where cooked PhysX geometry is cached on disk, shared by the Asset Processor and the runtime. "
+        "Empty disables the disk cache.");
+
+    AZ_CVAR(AZ::u32, physx_cookedDataCacheMemoryBudgetMB, 64, &OnCookedDataCacheMemoryBudgetChanged, AZ::ConsoleFunctorFlags::Null,
+        "Maximum size in megabytes of the cooked PhysX geometry kept in memory.");
+
+    AZ_CVAR(AZ::u32, physx_cookedDataCacheDiskBudgetMB, 1024, &OnCookedDataCacheDiskBudgetChanged, AZ::ConsoleFunctorFlags::Null,
+        "Maximum size in megabytes of the cooked PhysX geometry cached on disk, the oldest files are removed when exceeded. "
+        "0 disables the limit.");
+
+    static void physx_cookedDataCacheStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (PhysXSystem* physXSystem = GetPhysXSystem())
+        {
+            const CookedDataCache& cache = physXSystem->GetCookedDataCache();
+            [[maybe_unused]] const CookedDataCacheStatistics stats = cache.GetStatistics();
+            AZ_TracePrintf("PhysX", "Cooked data cache: %llu memory hits, %llu disk hits, %llu misses, hit rate %.1f%%, %llu invalid disk entries.\n",
+                stats.m_memoryHits, stats.m_diskHits, stats.m_misses, stats.GetHitRate() * 100.0f, stats.m_invalidDiskEntries);
+            AZ_TracePrintf("PhysX", "Cooked data cache: %.3f ms spent cooking, %.3f ms saved, %zu of %zu bytes used in memory.\n",
+                stats.m_cookingTime.count() / 1000.0, stats.m_timeSaved.count() / 1000.0, cache.GetMemoryUsage(), cache.GetMemoryBudget());
+        }
+    }
+
+    AZ_CONSOLEFREEFUNC(physx_cookedDataCacheStats, AZ::ConsoleFunctorFlags::Null,
+        "Prints the hit rate and the cooking time saved by the cooked PhysX geometry cache.");
+
+    CookedDataKeyBuilder::CookedDataKeyBuilder(CookedDataType type)
+    {
+        // The PhysX version is part of the key so data cooked by a different SDK is never reused.
+        AddValue(static_cast<AZ::u32>(PX_PHYSICS_VERSION));
+        AddValue(type);
+    }
+
+    void CookedDataKeyBuilder::AddBytes(const void* data, size_t byteCount)
+    {
+        // The size is part of the hash so consecutive buffers cannot be confused with each other.
+        const AZ::u64 size = byteCount;
+        m_sha.ProcessBytes(&size, sizeof(size));
+        if (byteCount > 0)
+        {
+            m_sha.ProcessBytes(data, byteCount);
+        }
+    }
+
+    void CookedDataKeyBuilder::AddVertices(const AZ::Vector3* vertices, AZ::u32 vertexCount)
+    {
+        AddValue(vertexCount);
+        for (AZ::u32 i = 0; i < vertexCount; ++i)
+        {
+            float components[3];
+            vertices[i].StoreToFloat3(components);
+            m_sha.ProcessBytes(components, sizeof(components));
+        }
+    }
+
+    void CookedDataKeyBuilder::AddCookingParams(const physx::PxCookingParams& params)
+    {
+        // Hash the members one by one, the padding of the structure is not initialized.
+        AddValue(params.areaTestEpsilon);
+        AddValue(params.planeTolerance);
+        AddValue(static_cast<AZ::u32>(params.convexMeshCookingType));
+        AddValue(params.suppressTriangleMeshRemapTable);
+        AddValue(params.buildTriangleAdjacencies);
+        AddValue(params.buildGPUData);
+        AddValue(params.scale.length);
+        AddValue(params.scale.speed);
+        AddValue(static_cast<AZ::u32>(params.meshPreprocessParams));
+        AddValue(params.meshWeldTolerance);
+        AddValue(params.gaussMapLimit);
+
+        const physx::PxMeshMidPhase::Enum midphaseType = params.midphaseDesc.getType();
+        AddValue(static_cast<AZ::u32>(midphaseType));
+        if (midphaseType == physx::PxMeshMidPhase::eBVH33)
+        {
+            AddValue(static_cast<AZ::u32>(params.midphaseDesc.mBVH33Desc.meshCookingHint));
+            AddValue(params.midphaseDesc.mBVH33Desc.meshSizePerformanceTradeOff);
+        }
+        else
+        {
+            AddValue(params.midphaseDesc.mBVH34Desc.numPrimsPerLeaf);
+        }
+    }
+
+    CookedDataKey CookedDataKeyBuilder::GetKey()
+    {
+        AZ::u32 digest[5];
+        m_sha.GetDigest(digest);
+
+        CookedDataKey key;
+        for (int i = 0; i < 4; ++i)
+        {
+            key.data[i * 4 + 0] = static_cast<AZ::u8>((digest[i] >> 24) & 0xff);
+            key.data[i * 4 + 1] = static_cast<AZ::u8>((digest[i] >> 16) & 0xff);
+            key.data[i * 4 + 2] = static_cast<AZ::u8>((digest[i] >> 8) & 0xff);
+            key.data[i * 4 + 3] = static_cast<AZ::u8>((digest[i] >> 0) & 0xff);
+        }
+        return key;
+    }
+
+    AZ::u64 CookedDataCacheStatistics::GetHits() const
+    {
+        return m_memoryHits + m_diskHits;
+    }
+
+    float CookedDataCacheStatistics::GetHitRate() const
+    {
+        const AZ::u64 requests = GetHits() + m_misses;
+        return requests > 0 ? static_cast<float>(GetHits()) / static_cast<float>(requests) : 0.0f;
+    }
+
+    bool CookedDataCache::FindOrCook(const CookedDataKey& key, AZStd::vector<AZ::u8>& result, const CookFunction& cookFunction,
+        const ValidateFunction& validateFunction)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        AZStd::chrono::microseconds cookingTime(0);
+        if (FindInMemory(key, result, cookingTime))
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_statistics.m_memoryHits++;
+            m_statistics.m_timeSaved += cookingTime;
+            return true;
+        }
+
+        Entry entry;
+        if (FindOnDisk(key, entry, validateFunction))
+        {
+            result.insert(result.end(), entry.m_data.begin(), entry.m_data.end());
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_statistics.m_diskHits++;
+            m_statistics.m_timeSaved += entry.m_cookingTime;
+            StoreInMemory(key, AZStd::move(entry));
+            return true;
+        }
+
+        const AZStd::chrono::high_resolution_clock::time_point cookingStart = AZStd::chrono::high_resolution_clock::now();
+        if (!cookFunction(entry.m_data))
+        {
+            return false;
+        }
+        entry.m_cookingTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - cookingStart);
+
+        result.insert(result.end(), entry.m_data.begin(), entry.m_data.end());
+        StoreOnDisk(key, entry);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_statistics.m_misses++;
+        m_statistics.m_cookingTime += entry.m_cookingTime;
+        StoreInMemory(key, AZStd::move(entry));
+        return true;
+    }
+
+    bool CookedDataCache::Find(const CookedDataKey& key, AZStd::vector<AZ::u8>& result, const ValidateFunction& validateFunction)
+    {
+        AZStd::chrono::microseconds cookingTime(0);
+        if (FindInMemory(key, result, cookingTime))
+        {
+            return true;
+        }
+
+        Entry entry;
+        if (FindOnDisk(key, entry, validateFunction))
+        {
+            result.insert(result.end(), entry.m_data.begin(), entry.m_data.end());
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            StoreInMemory(key, AZStd::move(entry));
+            return true;
+        }
+        return false;
+    }
+
+    void CookedDataCache::Store(const CookedDataKey& key, const AZStd::vector<AZ::u8>& cookedData, AZStd::chrono::microseconds cookingTime)
+    {
+        Entry entry{ cookedData, cookingTime };
+        StoreOnDisk(key, entry);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        StoreInMemory(key, AZStd::move(entry));
+    }
+
+    void CookedDataCache::SetDiskCacheDirectory(const AZStd::string& directory)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_diskCacheDirectory = directory;
+        m_diskUsageKnown = false;
+    }
+
+    AZStd::string CookedDataCache::GetDiskCacheDirectory() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_diskCacheDirectory;
+    }
+
+    void CookedDataCache::SetDiskBudget(AZ::u64 bytes)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_diskBudget = bytes;
+        m_diskUsageKnown = false;
+    }
+
+    AZ::u64 CookedDataCache::GetDiskBudget() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_diskBudget;
+    }
+
+    void CookedDataCache::EvictDiskCache()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZStd::string directory;
+        AZ::u64 diskBudget = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            directory = m_diskCacheDirectory;
+            diskBudget = m_diskBudget;
+        }
+        if (!fileIO || directory.empty() || diskBudget == 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> evictionLock(m_diskEvictionMutex);
+
+        struct DiskFile
+        {
+            AZStd::string m_path;
+            AZ::u64 m_size = 0;
+            AZ::u64 m_modificationTime = 0;
+        };
+        AZStd::vector<DiskFile> files;
+        AZ::u64 diskUsage = 0;
+        const AZStd::string filter = AZStd::string::format("*%s", CookedDataFileExtension);
+        fileIO->FindFiles(directory.c_str(), filter.c_str(),
+            [fileIO, &files, &diskUsage](const char* path)
+            {
+                DiskFile file;
+                file.m_path = path;
+                fileIO->Size(path, file.m_size);
+                file.m_modificationTime = fileIO->ModificationTime(path);
+                diskUsage += file.m_size;
+                files.push_back(AZStd::move(file));
+                return true;
+            });
+
+        if (diskUsage > diskBudget)
+        {
+            // Evict below the budget, so the directory is not scanned again for every file stored afterwards.
+            const AZ::u64 targetUsage = diskBudget - diskBudget / 4;
+            AZStd::sort(files.begin(), files.end(),
+                [](const DiskFile& lhs, const DiskFile& rhs)
+                {
+                    return lhs.m_modificationTime < rhs.m_modificationTime;
+                });
+            for (const DiskFile& file : files)
+            {
+                if (diskUsage <= targetUsage)
+                {
+                    break;
+                }
+                // The file may have been removed by another process sharing the directory.
+                fileIO->Remove(file.m_path.c_str());
+                diskUsage -= file.m_size;
+            }
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_diskUsage = diskUsage;
+        m_diskUsageKnown = true;
+    }
+
+    void CookedDataCache::SetMemoryBudget(size_t bytes)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_memoryBudget = bytes;
+        EvictToBudget();
+    }
+
+    size_t CookedDataCache::GetMemoryBudget() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_memoryBudget;
+    }
+
+    size_t CookedDataCache::GetMemoryUsage() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_memoryUsage;
+    }
+
+    void CookedDataCache::ClearMemory()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_insertionOrder.clear();
+        m_memoryUsage = 0;
+    }
+
+    CookedDataCacheStatistics CookedDataCache::GetStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_statistics;
+    }
+
+    void CookedDataCache::ResetStatistics()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_statistics = CookedDataCacheStatistics();
+    }
+
+    bool CookedDataCache::FindInMemory(const CookedDataKey& key, AZStd::vector<AZ::u8>& result, AZStd::chrono::microseconds& cookingTime)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto entryIt = m_entries.find(key);
+        if (entryIt == m_entries.end())
+        {
+            return false;
+        }
+
+        result.insert(result.end(), entryIt->second.m_data.begin(), entryIt->second.m_data.end());
+        cookingTime = entryIt->second.m_cookingTime;
+        return true;
+    }
+
+    bool CookedDataCache::FindOnDisk(const CookedDataKey& key, Entry& entry, const ValidateFunction& validateFunction)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        const AZStd::string directory = GetDiskCacheDirectory();
+        if (!fileIO || directory.empty())
+        {
+            return false;
+        }
+
+        const AZStd::string path = GetDiskEntryPath(directory, key);
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        if (!fileIO->Exists(path.c_str()) || !fileIO->Open(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, file))
+        {
+            return false;
+        }
+
+        // The data size is checked against the size of the file before anything is allocated,
+        // so a corrupted or truncated file cannot cause an oversized allocation or a partial read.
+        AZ::u64 fileSize = 0;
+        DiskEntryHeader header;
+        bool success = fileIO->Size(file, fileSize) &&
+            fileSize >= sizeof(header) &&
+            fileIO->Read(file, &header, sizeof(header), true) &&
+            header.m_magic == DiskEntryHeader::Magic &&
+            header.m_version == DiskEntryHeader::CurrentVersion &&
+            header.m_dataSize == fileSize - sizeof(header);
+        if (success)
+        {
+            entry.m_data.resize_no_construct(header.m_dataSize);
+            entry.m_cookingTime = AZStd::chrono::microseconds(header.m_cookingTimeMicroseconds);
+            success = header.m_dataSize == 0 || fileIO->Read(file, entry.m_data.data(), header.m_dataSize, true);
+        }
+        fileIO->Close(file);
+
+        // The file may have been written by a different build or damaged, check that PhysX accepts the data.
+        success = success && (!validateFunction || validateFunction(entry.m_data));
+        if (!success)
+        {
+            AZ_Warning("PhysX", false, "Removing invalid cooked data cache file %s.", path.c_str());
+            fileIO->Remove(path.c_str());
+            entry = Entry();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_statistics.m_invalidDiskEntries++;
+        }
+        return success;
+    }
+
+    void CookedDataCache::StoreInMemory(const CookedDataKey& key, Entry&& entry)
+    {
+        // Expects m_mutex to be locked.
+        if (entry.m_data.size() > m_memoryBudget || m_entries.find(key) != m_entries.end())
+        {
+            return;
+        }
+
+        m_memoryUsage += entry.m_data.size();
+        m_entries.emplace(key, AZStd::move(entry));
+        m_insertionOrder.push_back(key);
+        EvictToBudget();
+    }
+
+    void CookedDataCache::StoreOnDisk(const CookedDataKey& key, const Entry& entry)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        const AZStd::string directory = GetDiskCacheDirectory();
+        if (!fileIO || directory.empty())
+        {
+            return;
+        }
+
+        const AZStd::string path = GetDiskEntryPath(directory, key);
+        if (fileIO->Exists(path.c_str()))
+        {
+            return;
+        }
+
+        fileIO->CreatePath(directory.c_str());
+
+        // Write to a unique temporary file first and rename it, so other processes sharing
+        // the directory never read a partially written entry.
+        const AZStd::string temporaryPath = path + AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false);
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(temporaryPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, file))
+        {
+            AZ_Warning("PhysX", false, "Failed to write cooked data cache file %s.", temporaryPath.c_str());
+            return;
+        }
+
+        DiskEntryHeader header;
+        header.m_cookingTimeMicroseconds = static_cast<AZ::u64>(entry.m_cookingTime.count());
+        header.m_dataSize = entry.m_data.size();
+        const bool success = fileIO->Write(file, &header, sizeof(header)) &&
+            fileIO->Write(file, entry.m_data.data(), entry.m_data.size());
+        fileIO->Close(file);
+
+        if (!success || !fileIO->Rename(temporaryPath.c_str(), path.c_str()))
+        {
+            // Another process may have stored the same entry in the meantime.
+            fileIO->Remove(temporaryPath.c_str());
+            return;
+        }
+
+        bool evict = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_diskUsage += sizeof(header) + entry.m_data.size();
+            evict = m_diskBudget > 0 && (!m_diskUsageKnown || m_diskUsage > m_diskBudget);
+        }
+        if (evict)
+        {
+            EvictDiskCache();
+        }
+    }
+
+    void CookedDataCache::EvictToBudget()
+    {
+        // Expects m_mutex to be locked.
+        while (m_memoryUsage > m_memoryBudget && !m_insertionOrder.empty())
+        {
+            auto entryIt = m_entries.find(m_insertionOrder.front());
+            m_insertionOrder.pop_front();
+            if (entryIt != m_entries.end())
+            {
+                m_memoryUsage -= entryIt->second.m_data.size();
+                m_entries.erase(entryIt);
+            }
+        }
+    }
+
+    AZStd::string CookedDataCache::GetDiskEntryPath(const AZStd::string& directory, const CookedDataKey& key) const
+    {
+        return AZStd::string::format("%s/%s%s", directory.c_str(), key.ToString<AZStd::string>(false, false).c_str(), CookedDataFileExtension);
+    }
+
+    bool ValidateCookedData(CookedDataType type, const AZStd::vector<AZ::u8>& cookedData)
+    {
+        if (cookedData.empty() || cookedData.size() > AZStd::numeric_limits<physx::PxU32>::max())
+        {
+            return false;
+        }
+
+        physx::PxDefaultMemoryInputData inputData(const_cast<physx::PxU8*>(cookedData.data()), static_cast<physx::PxU32>(cookedData.size()));
+        physx::PxBase* object = nullptr;
+        switch (type)
+        {
+        case CookedDataType::ConvexMesh:
+            object = PxGetPhysics().createConvexMesh(inputData);
+            break;
+        case CookedDataType::TriangleMesh:
+            object = PxGetPhysics().createTriangleMesh(inputData);
+            break;
+        case CookedDataType::HeightField:
+            object = PxGetPhysics().createHeightField(inputData);
+            break;
+        }
+
+        if (!object)
+        {
+            return false;
+        }
+        object->release();
+        return true;
+    }
+
+    bool FindOrCookCachedData(const CookedDataKey& key, CookedDataType type, AZStd::vector<AZ::u8>& result,
+        const CookedDataCache::CookFunction& cookFunction)
+    {
+        if (PhysXSystem* physXSystem = GetPhysXSystem())
+        {
+            return physXSystem->GetCookedDataCache().FindOrCook(key, result, cookFunction,
+                [type](const AZStd::vector<AZ::u8>& cookedData)
+                {
+                    return ValidateCookedData(type, cookedData);
+                });
+        }
+
+        AZStd::vector<AZ::u8> cookedData;
+        if (!cookFunction(cookedData))
+        {
+            return false;
+        }
+        result.insert(result.end(), cookedData.begin(), cookedData.end());
+        return true;
+    }
+} // namespace PhysX
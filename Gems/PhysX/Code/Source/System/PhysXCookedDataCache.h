@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+#include <PxPhysicsAPI.h>
+
+namespace PhysX
+{
+    AZ_CVAR_EXTERNED(AZ::CVarFixedString, physx_cookedDataCacheDirectory);
+    AZ_CVAR_EXTERNED(AZ::u32, physx_cookedDataCacheMemoryBudgetMB);
+    AZ_CVAR_EXTERNED(AZ::u32, physx_cookedDataCacheDiskBudgetMB);
+
+    //! Kind of geometry the cooked data was produced from.
+    enum class CookedDataType : AZ::u8
+    {
+        ConvexMesh,
+        TriangleMesh,
+        HeightField
+    };
+
+    //! Content hash identifying a piece of cooked data.
+    using CookedDataKey = AZ::Uuid;
+
+    //! Builds a CookedDataKey by hashing the geometry and the cooking parameters it is cooked with.
+    //! Everything that can change the cooked output must be added to the key.
+    class CookedDataKeyBuilder
+    {
+    public:
+        explicit CookedDataKeyBuilder(CookedDataType type);
+
+        void AddBytes(const void* data, size_t byteCount);
+
+        template<typename T>
+        void AddValue(const T& value)
+        {
+            m_sha.ProcessBytes(&value, sizeof(T));
+        }
+
+        //! Adds the x, y and z components of the vertices, ignoring the padding of AZ::Vector3.
+        void AddVertices(const AZ::Vector3* vertices, AZ::u32 vertexCount);
+
+        //! Adds all the parameters of PxCookingParams that affect the cooked data.
+        void AddCookingParams(const physx::PxCookingParams& params);
+
+        CookedDataKey GetKey();
+
+    private:
+        AZ::Sha1 m_sha;
+    };
+
+    //! Statistics of a CookedDataCache.
+    struct CookedDataCacheStatistics
+    {
+        AZ::u64 m_memoryHits = 0; //!< Requests served from the in-memory cache.
+        AZ::u64 m_diskHits = 0; //!< Requests served from the disk cache.
+        AZ::u64 m_misses = 0; //!< Requests that had to be cooked.
+        AZ::u64 m_invalidDiskEntries = 0; //!< Disk cache files that were rejected and removed.
+        AZStd::chrono::microseconds m_cookingTime = AZStd::chrono::microseconds(0); //!< Time spent cooking the misses.
+        AZStd::chrono::microseconds m_timeSaved = AZStd::chrono::microseconds(0); //!< Cooking time of the data served from the cache.
+
+        AZ::u64 GetHits() const;
+
+        //! Returns the ratio of requests served from the cache, between 0 and 1.
+        float GetHitRate() const;
+    };
+
+    //! Content addressed cache of cooked PhysX geometry.
+    //! Cooked data is kept in memory within a budget and, when a directory is set, stored on disk
+    //! so it can be shared between runs and between the Asset Processor and the runtime.
+    //! Files in the disk cache are written by other processes, so they are validated when loaded
+    //! and the oldest ones are removed when the disk cache exceeds its budget.
+    //! The cache is thread safe. Concurrent misses of the same key may cook the data more than once.
+    class CookedDataCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CookedDataCache, AZ::SystemAllocator, 0);
+
+        //! Function cooking the data on a cache miss. Returns false if cooking failed.
+        using CookFunction = AZStd::function<bool(AZStd::vector<AZ::u8>& cookedData)>;
+
+        //! Function checking that data loaded from the disk cache can be used. Returns false to reject it.
+        using ValidateFunction = AZStd::function<bool(const AZStd::vector<AZ::u8>& cookedData)>;
+
+        static constexpr size_t DefaultMemoryBudget = 64 * 1024 * 1024;
+        static constexpr AZ::u64 DefaultDiskBudget = 1024 * 1024 * 1024;
+        static constexpr const char* CookedDataFileExtension = ".pxcooked";
+
+        CookedDataCache() = default;
+        AZ_DISABLE_COPY_MOVE(CookedDataCache);
+
+        //! Appends the cooked data of the key to result, cooking it with cookFunction on a cache miss.
+        //! Data is only cached when cooking succeeds. Data loaded from disk that validateFunction rejects
+        //! is removed from the disk cache and cooked again.
+        bool FindOrCook(const CookedDataKey& key, AZStd::vector<AZ::u8>& result, const CookFunction& cookFunction,
+            const ValidateFunction& validateFunction = {});
+
+        //! Appends the cached data of the key to result, looking in memory first and then on disk.
+        //! Does not update the statistics.
+        bool Find(const CookedDataKey& key, AZStd::vector<AZ::u8>& result, const ValidateFunction& validateFunction = {});
+
+        //! Stores cooked data in memory and, if enabled, on disk.
+        //! @param cookingTime Time it took to cook the data, reported as time saved on later hits.
+        void Store(const CookedDataKey& key, const AZStd::vector<AZ::u8>& cookedData, AZStd::chrono::microseconds cookingTime);
+
+        //! Sets the directory of the disk cache. An empty path disables the disk cache.
+        void SetDiskCacheDirectory(const AZStd::string& directory);
+        AZStd::string GetDiskCacheDirectory() const;
+
+        //! Sets the maximum size of the disk cache directory. 0 disables the eviction of disk cache files.
+        void SetDiskBudget(AZ::u64 bytes);
+        AZ::u64 GetDiskBudget() const;
+
+        //! Removes the oldest disk cache files until the directory is below its budget.
+        //! This is done automatically when storing data makes the disk cache exceed its budget.
+        void EvictDiskCache();
+
+        //! Sets the maximum size of the data kept in memory, evicting the oldest entries when exceeded.
+        void SetMemoryBudget(size_t bytes);
+        size_t GetMemoryBudget() const;
+        size_t GetMemoryUsage() const;
+
+        //! Removes all the entries kept in memory. The disk cache is not affected.
+        void ClearMemory();
+
+        CookedDataCacheStatistics GetStatistics() const;
+        void ResetStatistics();
+
+    private:
+        struct Entry
+        {
+            AZStd::vector<AZ::u8> m_data;
+            AZStd::chrono::microseconds m_cookingTime = AZStd::chrono::microseconds(0);
+        };
+
+        //! Header written in front of the cooked data in the disk cache files.
+        struct DiskEntryHeader
+        {
+            static constexpr AZ::u32 Magic = 0x4B435850; // "PXCK"
+            static constexpr AZ::u32 CurrentVersion = 1;
+
+            AZ::u32 m_magic = Magic;
+            AZ::u32 m_version = CurrentVersion;
+            AZ::u64 m_cookingTimeMicroseconds = 0;
+            AZ::u64 m_dataSize = 0;
+        };
+
+        bool FindInMemory(const CookedDataKey& key, AZStd::vector<AZ::u8>& result, AZStd::chrono::microseconds& cookingTime);
+        bool FindOnDisk(const CookedDataKey& key, Entry& entry, const ValidateFunction& validateFunction);
+        void StoreInMemory(const CookedDataKey& key, Entry&& entry);
+        void StoreOnDisk(const CookedDataKey& key, const Entry& entry);
+        void EvictToBudget();
+        AZStd::string GetDiskEntryPath(const AZStd::string& directory, const CookedDataKey& key) const;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<CookedDataKey, Entry> m_entries;
+        AZStd::deque<CookedDataKey> m_insertionOrder; //!< Keys in insertion order, oldest first, used for eviction.
+        size_t m_memoryUsage = 0;
+        size_t m_memoryBudget = DefaultMemoryBudget;
+        AZStd::string m_diskCacheDirectory;
+        AZ::u64 m_diskBudget = DefaultDiskBudget;
+        AZ::u64 m_diskUsage = 0; //!< Size of the disk cache directory, counted by the last eviction plus the files stored since.
+        bool m_diskUsageKnown = false; //!< Set once the disk cache directory has been scanned.
+        AZStd::mutex m_diskEvictionMutex; //!< Only one thread scans the disk cache directory at a time.
+        CookedDataCacheStatistics m_statistics;
+    };
+
+    //! Returns true if the PhysX SDK is able to create an object of the type from the cooked data.
+    bool ValidateCookedData(CookedDataType type, const AZStd::vector<AZ::u8>& cookedData);
+
+    //! Appends the cooked data of the key to result using the cache of the PhysX system,
+    //! cooking it with cookFunction on a miss. Cooks without caching if the PhysX system is not available.
+    //! Data loaded from the disk cache is validated as cooked data of the type.
+    bool FindOrCookCachedData(const CookedDataKey& key, CookedDataType type, AZStd::vector<AZ::u8>& result,
+        const CookedDataCache::CookFunction& cookFunction);
+} // namespace PhysX
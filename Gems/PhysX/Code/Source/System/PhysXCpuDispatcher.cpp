@@ -6,25 +6,139 @@
  */
 
 #include <PhysX_precompiled.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/thread.h>
+#include <PhysX_Traits_Platform.h>
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
+#include <System/PhysXSystem.h>
 
 namespace PhysX
 {
+    static void OnCpuDispatcherWorkerCountChanged([[maybe_unused]] const int32_t& workerCount)
+    {
+        // The cvar can be set from any thread while a scene is simulating, the worker count is only changed between steps.
+        if (PhysXSystem* physXSystem = GetPhysXSystem())
+        {
+            physXSystem->GetCpuDispatcher()->RequestWorkerCount(GetCpuDispatcherWorkerCount());
+        }
+    }
+
+    AZ_CVAR(int32_t, physx_cpuDispatcherWorkerCount, PhysXCpuDispatcher::SharedWorkers, &OnCpuDispatcherWorkerCountChanged,
+        AZ::ConsoleFunctorFlags::Null,
+        "Number of dedicated worker threads running PhysX simulation tasks. "
+        "-1 shares the workers of the global job manager (a dedicated worker per hardware thread but one on platforms which don't support it), "
+        "0 runs every task on the simulating thread. Applied between simulation steps.");
+
+    int32_t GetCpuDispatcherWorkerCount()
+    {
+        const int32_t workerCount = physx_cpuDispatcherWorkerCount;
+        if (workerCount < 0)
+        {
+#if AZ_TRAIT_PHYSX_CPU_DISPATCHER_SHARE_GLOBAL_JOBS
+            return PhysXCpuDispatcher::SharedWorkers;
+#else
+            // A dedicated worker per hardware thread, leaving one for the simulating thread
+            const int32_t hardwareThreads = static_cast<int32_t>(AZStd::thread::hardware_concurrency());
+            return AZStd::max(hardwareThreads - 1, 1);
+#endif
+        }
+        return workerCount;
+    }
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
-        return aznew PhysXCpuDispatcher();
+        return aznew PhysXCpuDispatcher(GetCpuDispatcherWorkerCount());
+    }
+
+    PhysXCpuDispatcher::PhysXCpuDispatcher(int32_t workerCount)
+    {
+        SetWorkerCount(workerCount);
+    }
+
+    PhysXCpuDispatcher::~PhysXCpuDispatcher()
+    {
+        WaitForRunningTasks();
+    }
+
+    void PhysXCpuDispatcher::WaitForRunningTasks()
+    {
+        // Jobs decrement the count right after releasing their task, so between steps this only waits for that tail.
+        while (m_runningTaskCount.load() > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void PhysXCpuDispatcher::SetWorkerCount(int32_t workerCount)
+    {
+        AZ::JobManagerDesc desc;
+        workerCount = workerCount < 0 ? SharedWorkers : AZStd::min(workerCount, static_cast<int32_t>(desc.m_workerThreads.capacity()));
+        if (workerCount == m_workerCount && (m_jobContext != nullptr || workerCount == 0))
+        {
+            return;
+        }
+
+        // Destroying the job manager joins its threads, which must not happen while tasks are queued on it.
+        WaitForRunningTasks();
+
+        m_jobContext = nullptr;
+        m_ownedJobContext.reset();
+        m_jobManager.reset();
+        m_workerCount = workerCount;
+
+        if (workerCount == SharedWorkers)
+        {
+            m_jobContext = AZ::JobContext::GetGlobalContext();
+            AZ_Warning("PhysXCpuDispatcher", m_jobContext, "No global job context, PhysX tasks run on the simulating thread");
+        }
+        else if (workerCount > 0)
+        {
+            desc.m_workerThreads.resize(workerCount);
+            m_jobManager.reset(aznew AZ::JobManager(desc));
+            m_ownedJobContext.reset(aznew AZ::JobContext(*m_jobManager));
+            m_jobContext = m_ownedJobContext.get();
+        }
+    }
+
+    void PhysXCpuDispatcher::RequestWorkerCount(int32_t workerCount)
+    {
+        m_pendingWorkerCount = workerCount;
+    }
+
+    void PhysXCpuDispatcher::ApplyPendingWorkerCount()
+    {
+        const int32_t workerCount = m_pendingWorkerCount.exchange(NoPendingWorkerCount);
+        if (workerCount != NoPendingWorkerCount)
+        {
+            SetWorkerCount(workerCount);
+        }
     }
 
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
+        if (!m_jobContext)
+        {
+            // Same as the PhysX default dispatcher without worker threads.
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, task.getName());
+            task.run();
+            task.release();
+            return;
+        }
+
+        m_runningTaskCount.fetch_add(1);
+        auto azJob = aznew PhysXJob(task, m_jobContext, &m_runningTaskCount);
         azJob->Start();
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
-        return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        if (m_workerCount == SharedWorkers)
+        {
+            return m_jobContext ? m_jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        }
+        return static_cast<physx::PxU32>(m_workerCount);
     }
 } // namespace PhysX
-
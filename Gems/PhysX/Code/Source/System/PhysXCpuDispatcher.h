@@ -7,26 +7,75 @@
 
 #pragma once
 #include <PxPhysicsAPI.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <System/PhysXAllocator.h>
 
+namespace AZ
+{
+    class JobContext;
+    class JobManager;
+}
+
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(int32_t, physx_cpuDispatcherWorkerCount);
+
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //!
+    //! By default tasks run on the workers of the global job manager, which already has one per hardware thread.
+    //! A dedicated job manager can be selected instead, its workers only run PhysX tasks. Threads waiting on the global
+    //! job manager help with its queued jobs, so with the global one a PhysX task can run nested inside unrelated code;
+    //! platforms where that trips the PhysX mutex ownership assert default to dedicated workers instead.
+    //! Each task is run and released by the same thread.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator, 0);
 
-        PhysXCpuDispatcher() = default;
-        ~PhysXCpuDispatcher() = default;
-        
+        //! Worker count which runs the tasks on the global job manager.
+        static constexpr int32_t SharedWorkers = -1;
+
+        //! @param workerCount Number of dedicated worker threads, SharedWorkers to use the global job manager.
+        //! With no workers, tasks run on the thread submitting them.
+        explicit PhysXCpuDispatcher(int32_t workerCount);
+        ~PhysXCpuDispatcher();
+
+        //! Recreates the worker threads once the running tasks finished. Must not be called while a scene is simulating,
+        //! PhysX could submit tasks while the job context is replaced.
+        void SetWorkerCount(int32_t workerCount);
+
+        //! Stores a worker count to be set by ApplyPendingWorkerCount, safe to call while a scene is simulating.
+        void RequestWorkerCount(int32_t workerCount);
+
+        //! Sets the worker count stored by RequestWorkerCount, called by the PhysX system between simulation steps.
+        void ApplyPendingWorkerCount();
+
     private:
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        void WaitForRunningTasks();
+
+        static constexpr int32_t NoPendingWorkerCount = AZStd::numeric_limits<int32_t>::min();
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_ownedJobContext;
+        AZ::JobContext* m_jobContext = nullptr; //!< Owned or global job context the tasks are started in, null to run them inline.
+        int32_t m_workerCount = 0;
+        AZStd::atomic<int32_t> m_pendingWorkerCount{ NoPendingWorkerCount };
+        AZStd::atomic<AZ::u32> m_runningTaskCount{ 0 }; //!< Tasks started as jobs which have not been released yet.
     };
 
-    //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! Returns the worker count selected by physx_cpuDispatcherWorkerCount for this platform,
+    //! PhysXCpuDispatcher::SharedWorkers to use the global job manager.
+    int32_t GetCpuDispatcherWorkerCount();
+
+    //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system,
+    //! with the number of worker threads selected by physx_cpuDispatcherWorkerCount.
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate();
 } // namespace PhysX
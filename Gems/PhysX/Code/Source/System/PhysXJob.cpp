@@ -11,9 +11,10 @@
 
 namespace PhysX
 {
-    PhysXJob::PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context)
+    PhysXJob::PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context, AZStd::atomic<AZ::u32>* runningTaskCount)
         : AZ::Job(true, context)
         , m_pxTask(pxTask)
+        , m_runningTaskCount(runningTaskCount)
     {
     }
 
@@ -22,5 +23,10 @@ namespace PhysX
         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, m_pxTask.getName());
         m_pxTask.run();
         m_pxTask.release();
+
+        if (m_runningTaskCount)
+        {
+            m_runningTaskCount->fetch_sub(1);
+        }
     }
 }
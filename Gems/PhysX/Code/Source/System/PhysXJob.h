@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <task/PxTask.h>
 
 namespace PhysX
@@ -19,7 +20,8 @@ namespace PhysX
     public:
         AZ_CLASS_ALLOCATOR(PhysXJob, AZ::ThreadPoolAllocator, 0);
 
-        PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context = nullptr);
+        //! @param runningTaskCount Optional counter decremented once the task has been released.
+        PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context = nullptr, AZStd::atomic<AZ::u32>* runningTaskCount = nullptr);
         ~PhysXJob() = default;
 
     protected:
@@ -27,5 +29,6 @@ namespace PhysX
 
     private:
         physx::PxBaseTask& m_pxTask;
+        AZStd::atomic<AZ::u32>* m_runningTaskCount = nullptr;
     };
 }
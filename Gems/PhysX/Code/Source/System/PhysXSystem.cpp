@@ -75,6 +75,10 @@ namespace PhysX
         AZ::AllocatorInstance<PhysXAllocator>::Create();
 
         InitializePhysXSdk(cookingParams);
+
+        m_cookedDataCache.SetDiskCacheDirectory(static_cast<AZ::CVarFixedString>(physx_cookedDataCacheDirectory).c_str());
+        m_cookedDataCache.SetMemoryBudget(static_cast<size_t>(static_cast<AZ::u32>(physx_cookedDataCacheMemoryBudgetMB)) * 1024 * 1024);
+        m_cookedDataCache.SetDiskBudget(static_cast<AZ::u64>(static_cast<AZ::u32>(physx_cookedDataCacheDiskBudgetMB)) * 1024 * 1024);
     }
 
     PhysXSystem::~PhysXSystem()
@@ -140,6 +144,9 @@ namespace PhysX
 
         auto simulateScenes = [this](float timeStep)
         {
+            // No scene is simulating between steps, so a worker count change requested through the cvar is safe here.
+            m_cpuDispatcher->ApplyPendingWorkerCount();
+
             for (auto& scenePtr : m_sceneList)
             {
                 if (scenePtr != nullptr && scenePtr->IsEnabled())
@@ -417,13 +424,7 @@ namespace PhysX
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
 
         // Set up CPU dispatcher
-#if defined(AZ_PLATFORM_LINUX)
-        // Temporary workaround for linux. At the moment using AzPhysXCpuDispatcher results in an assert at
-        // PhysX mutex indicating it must be unlocked only by the thread that has already acquired lock.
-        m_cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(0);
-#else
         m_cpuDispatcher = PhysXCpuDispatcherCreate();
-#endif
 
         PxSetProfilerCallback(&m_pxAzProfilerCallback);
     }
@@ -17,6 +17,8 @@
 #include <Debug/PhysXDebug.h>
 #include <Scene/PhysXSceneInterface.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXCookedDataCache.h>
+#include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXSdkCallbacks.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
@@ -27,7 +29,6 @@ namespace physx
     class PxFoundation;
     class PxPhysics;
     class PxCooking;
-    class PxCpuDispatcher;
 }
 
 namespace PhysX
@@ -74,11 +75,18 @@ namespace PhysX
         //TEMP -- until these are fully moved over here
         physx::PxPhysics* GetPxPhysics() { return m_physXSdk.m_physics; }
         physx::PxCooking* GetPxCooking() { return m_physXSdk.m_cooking; }
+        //! Cache of cooked geometry, used to avoid cooking identical geometry more than once.
+        CookedDataCache& GetCookedDataCache() { return m_cookedDataCache; }
         physx::PxCpuDispatcher* GetPxCpuDispathcher()
         {
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
         }
+        PhysXCpuDispatcher* GetCpuDispatcher()
+        {
+            AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
+            return m_cpuDispatcher;
+        }
         void SetCollisionLayerName(int index, const AZStd::string& layerName);
         void CreateCollisionGroup(const AZStd::string& groupName, const AzPhysics::CollisionGroup& group);
         //TEMP -- until these are fully moved over here
@@ -111,7 +119,8 @@ namespace PhysX
         PxAzErrorCallback m_physXErrorCallback;
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
-        physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXCpuDispatcher* m_cpuDispatcher = nullptr;
+        CookedDataCache m_cookedDataCache;
 
         enum class State : AZ::u8
         {
@@ -281,30 +281,50 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
-        
-        if(cookingResult)
-        {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
-        }
-        
-        return cookingResult;
+        CookedDataKeyBuilder keyBuilder(CookedDataType::ConvexMesh);
+        keyBuilder.AddCookingParams(m_physXSystem->GetPxCooking()->getParams());
+        keyBuilder.AddVertices(vertices, vertexCount);
+
+        return m_physXSystem->GetCookedDataCache().FindOrCook(keyBuilder.GetKey(), result,
+            [vertices, vertexCount](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                const bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
+                if (cookingResult)
+                {
+                    cookedData.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                }
+                return cookingResult;
+            },
+            [](const AZStd::vector<AZ::u8>& cookedData)
+            {
+                return ValidateCookedData(CookedDataType::ConvexMesh, cookedData);
+            });
     }
 
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+        CookedDataKeyBuilder keyBuilder(CookedDataType::TriangleMesh);
+        keyBuilder.AddCookingParams(m_physXSystem->GetPxCooking()->getParams());
+        keyBuilder.AddVertices(vertices, vertexCount);
+        keyBuilder.AddBytes(indices, indexCount * sizeof(AZ::u32));
 
-        if (cookingResult)
-        {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
-        }
-
-        return cookingResult;
+        return m_physXSystem->GetCookedDataCache().FindOrCook(keyBuilder.GetKey(), result,
+            [vertices, vertexCount, indices, indexCount](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                const bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+                if (cookingResult)
+                {
+                    cookedData.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                }
+                return cookingResult;
+            },
+            [](const AZStd::vector<AZ::u8>& cookedData)
+            {
+                return ValidateCookedData(CookedDataType::TriangleMesh, cookedData);
+            });
     }
 
     physx::PxConvexMesh* SystemComponent::CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
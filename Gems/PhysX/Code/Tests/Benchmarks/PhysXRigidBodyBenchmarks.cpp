@@ -20,6 +20,7 @@
 
 #include <PhysXTestCommon.h>
 #include <PhysXTestUtil.h>
+#include <System/PhysXSystem.h>
 
 namespace PhysX::Benchmarks
 {
@@ -65,6 +66,9 @@ namespace PhysX::Benchmarks
             static const int EndRange = 8192;
             static const int RangeMultipler = 2;
 
+            //! Number of rigid bodies spawned by the CPU dispatcher stress test
+            static const int StressTestRigidBodies = 10000;
+
             //!Flags to adjust how the collision handlers benchmark runs
             static const int AllCollisionHanders = 0; // create the same number of handlers as rigid bodies
             static const int HalfCollisionHandlers = 1; // create half the number of handlers as rigid bodies
@@ -154,6 +158,79 @@ namespace PhysX::Benchmarks
         }
 
     protected:
+        //! Creates the physics washing machine and spawns state.range(0) rigid bodies above it, then times
+        //! ~1800 game frames at 60fps of them falling into the spinning blade.
+        void RunMovingAndColliding(benchmark::State& state)
+        {
+            //setup some pieces for the test
+            AZ::SimpleLcgRandom rand;
+            rand.SetSeed(RigidBodyConstants::RandGenSeed);
+
+            //Create a washing machine of physx objects. This is a cylinder with a spinning blade that rigid bodies are placed inside
+            const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
+            WashingMachine washingMachine;
+            washingMachine.SetupWashingMachine(
+                m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
+                washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
+
+            //get the request number of rigid bodies and prepare to spawn them
+            const int numRigidBodies = static_cast<int>(state.range(0));
+
+            //add the rigid bodies
+            //function to generate the rigid bodies position / orientation / mass
+            Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+                const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
+                const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+                const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+                const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
+                return AZ::Vector3(x, y, z);
+            };
+            Utils::GenerateSpawnOrientationFuncPtr oriGenerator = [&rand]([[maybe_unused]] int idx) -> AZ::Quaternion {
+                return AZ::CreateRandomQuaternion(rand);
+            };
+            Utils::GenerateMassFuncPtr massGenerator = [&rand]([[maybe_unused]] int idx) -> float {
+                return rand.GetRandomFloat() * 25.0f + 5.0f;
+            };
+            auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+            Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+            {
+                return boxShapeConfiguration;
+            };
+            //spawn the rigid bodies
+            AzPhysics::SimulatedBodyHandleList rigidBodies = Utils::CreateRigidBodies(numRigidBodies, m_defaultScene,
+                RigidBodyConstants::CCDEnabled, &colliderGenerator, &posGenerator, &oriGenerator, &massGenerator);
+
+            //setup the sub tick tracker
+            Utils::PrePostSimulationEventHandler subTickTracker;
+            subTickTracker.Start(m_defaultScene);
+
+            //setup the frame timer tracker
+            AZStd::vector<double> tickTimes;
+            tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
+            for (auto _ : state)
+            {
+                for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
+                {
+                    auto start = AZStd::chrono::system_clock::now();
+                    StepScene1Tick(DefaultTimeStep);
+
+                    //time each physics tick and store it to analyze
+                    auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                    tickTimes.emplace_back(tickElapsedMilliseconds.count());
+                }
+            }
+            subTickTracker.Stop();
+
+            //object clean up
+            washingMachine.TearDownWashingMachine();
+            m_defaultScene->RemoveSimulatedBodies(rigidBodies);
+            rigidBodies.clear();
+
+            //sort the frame times and get the P50, P90, P99 percentiles
+            Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+            Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        }
+
         // PhysXBaseBenchmarkFixture Interface ---------
         AzPhysics::SceneConfiguration GetDefaultSceneConfiguration() override
         {
@@ -241,73 +318,7 @@ namespace PhysX::Benchmarks
     //! The test will run the simulation for ~1800 game frames at 60fps.
     BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MovingAndColliding)(benchmark::State &state)
     {
-        //setup some pieces for the test
-        AZ::SimpleLcgRandom rand;
-        rand.SetSeed(RigidBodyConstants::RandGenSeed);
-
-        //Create a washing machine of physx objects. This is a cylinder with a spinning blade that rigid bodies are placed inside
-        const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
-        WashingMachine washingMachine;
-        washingMachine.SetupWashingMachine(
-            m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
-            washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
-
-        //get the request number of rigid bodies and prepare to spawn them
-        const int numRigidBodies = static_cast<int>(state.range(0));
-
-        //add the rigid bodies
-        //function to generate the rigid bodies position / orientation / mass
-        Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
-            const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
-            const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
-            const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
-            const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
-            return AZ::Vector3(x, y, z);
-        };
-        Utils::GenerateSpawnOrientationFuncPtr oriGenerator = [&rand]([[maybe_unused]] int idx) -> AZ::Quaternion {
-            return AZ::CreateRandomQuaternion(rand);
-        };
-        Utils::GenerateMassFuncPtr massGenerator = [&rand]([[maybe_unused]] int idx) -> float {
-            return rand.GetRandomFloat() * 25.0f + 5.0f;
-        };
-        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
-        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
-        {
-            return boxShapeConfiguration;
-        };
-        //spawn the rigid bodies
-        AzPhysics::SimulatedBodyHandleList rigidBodies = Utils::CreateRigidBodies(numRigidBodies, m_defaultScene,
-            RigidBodyConstants::CCDEnabled, &colliderGenerator, &posGenerator, &oriGenerator, &massGenerator);
-
-        //setup the sub tick tracker
-        Utils::PrePostSimulationEventHandler subTickTracker;
-        subTickTracker.Start(m_defaultScene);
-
-        //setup the frame timer tracker
-        AZStd::vector<double> tickTimes;
-        tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
-        for (auto _ : state)
-        {
-            for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
-            {
-                auto start = AZStd::chrono::system_clock::now();
-                StepScene1Tick(DefaultTimeStep);
-
-                //time each physics tick and store it to analyze
-                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
-                tickTimes.emplace_back(tickElapsedMilliseconds.count());
-            }
-        }
-        subTickTracker.Stop();
-
-        //object clean up
-        washingMachine.TearDownWashingMachine();
-        m_defaultScene->RemoveSimulatedBodies(rigidBodies);
-        rigidBodies.clear();
-
-        //sort the frame times and get the P50, P90, P99 percentiles
-        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
-        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        RunMovingAndColliding(state);
     }
 
     //! Same as the PhysXRigidbodyBenchmarkFixture, adds a world event handler to receive collision events
@@ -467,6 +478,36 @@ namespace PhysX::Benchmarks
         state.counters["Collisions-End"] = static_cast<double>(m_collisionEndCount);
     }
 
+    //! Same as the PhysXRigidbodyBenchmarkFixture, runs the PhysX tasks on state.range(1) CPU dispatcher worker threads.
+    //! With no worker threads every task runs on the simulating thread, -1 shares the global job manager workers.
+    class PhysXRigidbodyDispatcherBenchmarkFixture
+        : public PhysXRigidbodyBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            // Scenes are created with the dispatcher, so set the worker count first
+            GetPhysXSystem()->GetCpuDispatcher()->SetWorkerCount(aznumeric_cast<int32_t>(state.range(1)));
+
+            PhysXRigidbodyBenchmarkFixture::SetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            PhysXRigidbodyBenchmarkFixture::TearDown(state);
+
+            GetPhysXSystem()->GetCpuDispatcher()->SetWorkerCount(GetCpuDispatcherWorkerCount());
+        }
+    };
+
+    //! BM_RigidBody_MovingAndColliding_DispatcherWorkers - Runs the same benchmark as BM_RigidBody_MovingAndColliding with a
+    //! given number of CPU dispatcher worker threads, to compare running the simulation tasks inline with the job system.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyDispatcherBenchmarkFixture, BM_RigidBody_MovingAndColliding_DispatcherWorkers)(benchmark::State& state)
+    {
+        RunMovingAndColliding(state);
+        state.counters["DispatcherWorkers"] = static_cast<double>(state.range(1));
+    }
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_AtRest)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
@@ -501,5 +542,14 @@ namespace PhysX::Benchmarks
         ->Unit(benchmark::kMillisecond)
         ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
         ;
+    BENCHMARK_REGISTER_F(PhysXRigidbodyDispatcherBenchmarkFixture, BM_RigidBody_MovingAndColliding_DispatcherWorkers)
+        ->Args({ RigidBodyConstants::BenchmarkSettings::StressTestRigidBodies, PhysXCpuDispatcher::SharedWorkers })
+        ->Args({ RigidBodyConstants::BenchmarkSettings::StressTestRigidBodies, 0 })
+        ->Args({ RigidBodyConstants::BenchmarkSettings::StressTestRigidBodies, 2 })
+        ->Args({ RigidBodyConstants::BenchmarkSettings::StressTestRigidBodies, 4 })
+        ->Args({ RigidBodyConstants::BenchmarkSettings::StressTestRigidBodies, 8 })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
 } // namespace PhysX::Benchmarks
 #endif
@@ -210,6 +210,46 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Accepts a 3rd parameter from \state.
+    //!
+    //! \state.range(2) - number of ray casts in each batch
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        const auto batchSize = aznumeric_cast<AZ::u32>(state.range(2));
+
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(batchSize);
+        for (AZ::u32 i = 0; i < batchSize; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            auto start = std::chrono::system_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * batchSize);
+
+        //get the P50, P90, P99 percentiles of each batch and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -234,5 +274,11 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->Args({ 1024, 64, 1000 })
+        ->Args({ 1024, 64, 10000 })
+        ->Args({ 1024, 64, 100000 })
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
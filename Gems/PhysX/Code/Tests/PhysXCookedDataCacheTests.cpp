@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <PhysX_precompiled.h>
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzFramework/Physics/SystemBus.h>
+
+#include <System/PhysXCookedDataCache.h>
+#include <System/PhysXCookingParams.h>
+#include <System/PhysXSystem.h>
+#include <Tests/PhysXTestCommon.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        CookedDataKey CreateTestKey(const AZStd::vector<AZ::Vector3>& vertices, const physx::PxCookingParams& params)
+        {
+            CookedDataKeyBuilder keyBuilder(CookedDataType::ConvexMesh);
+            keyBuilder.AddCookingParams(params);
+            keyBuilder.AddVertices(vertices.data(), static_cast<AZ::u32>(vertices.size()));
+            return keyBuilder.GetKey();
+        }
+
+        CookedDataCache::CookFunction CreateTestCookFunction(AZ::u32& cookCount, size_t dataSize = 16)
+        {
+            return [&cookCount, dataSize](AZStd::vector<AZ::u8>& cookedData)
+            {
+                cookCount++;
+                cookedData.resize(dataSize, static_cast<AZ::u8>(cookCount));
+                return true;
+            };
+        }
+
+        AZStd::string GetTestDiskEntryPath(const AZStd::string& directory, const CookedDataKey& key)
+        {
+            return AZStd::string::format("%s/%s%s", directory.c_str(), key.ToString<AZStd::string>(false, false).c_str(),
+                CookedDataCache::CookedDataFileExtension);
+        }
+
+        AZ::u32 CountDiskEntries(const AZStd::string& directory)
+        {
+            AZ::u32 count = 0;
+            const AZStd::string filter = AZStd::string::format("*%s", CookedDataCache::CookedDataFileExtension);
+            AZ::IO::FileIOBase::GetInstance()->FindFiles(directory.c_str(), filter.c_str(),
+                [&count](const char*)
+                {
+                    count++;
+                    return true;
+                });
+            return count;
+        }
+    }
+
+    TEST(PhysXCookedDataCache, KeyBuilder_SameGeometryAndParams_ProducesSameKey)
+    {
+        const AZStd::vector<AZ::Vector3> vertices = TestUtils::GeneratePyramidPoints(1.0f);
+        const physx::PxCookingParams params = PxCooking::GetRealTimeCookingParams();
+
+        EXPECT_EQ(Internal::CreateTestKey(vertices, params), Internal::CreateTestKey(vertices, params));
+    }
+
+    TEST(PhysXCookedDataCache, KeyBuilder_DifferentGeometryOrParams_ProducesDifferentKeys)
+    {
+        const AZStd::vector<AZ::Vector3> vertices = TestUtils::GeneratePyramidPoints(1.0f);
+        const AZStd::vector<AZ::Vector3> scaledVertices = TestUtils::GeneratePyramidPoints(2.0f);
+        const physx::PxCookingParams realTimeParams = PxCooking::GetRealTimeCookingParams();
+        const physx::PxCookingParams editTimeParams = PxCooking::GetEditTimeCookingParams();
+
+        const CookedDataKey key = Internal::CreateTestKey(vertices, realTimeParams);
+        EXPECT_NE(key, Internal::CreateTestKey(scaledVertices, realTimeParams));
+        EXPECT_NE(key, Internal::CreateTestKey(vertices, editTimeParams));
+
+        CookedDataKeyBuilder triangleMeshKeyBuilder(CookedDataType::TriangleMesh);
+        triangleMeshKeyBuilder.AddCookingParams(realTimeParams);
+        triangleMeshKeyBuilder.AddVertices(vertices.data(), static_cast<AZ::u32>(vertices.size()));
+        EXPECT_NE(key, triangleMeshKeyBuilder.GetKey());
+    }
+
+    TEST(PhysXCookedDataCache, FindOrCook_SameKeyTwice_CooksOnceAndReportsHit)
+    {
+        CookedDataCache cache;
+        const CookedDataKey key = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(1.0f), PxCooking::GetRealTimeCookingParams());
+        AZ::u32 cookCount = 0;
+
+        AZStd::vector<AZ::u8> firstResult;
+        AZStd::vector<AZ::u8> secondResult;
+        EXPECT_TRUE(cache.FindOrCook(key, firstResult, Internal::CreateTestCookFunction(cookCount)));
+        EXPECT_TRUE(cache.FindOrCook(key, secondResult, Internal::CreateTestCookFunction(cookCount)));
+
+        EXPECT_EQ(cookCount, 1u);
+        EXPECT_EQ(firstResult, secondResult);
+
+        const CookedDataCacheStatistics stats = cache.GetStatistics();
+        EXPECT_EQ(stats.m_misses, 1u);
+        EXPECT_EQ(stats.m_memoryHits, 1u);
+        EXPECT_EQ(stats.m_diskHits, 0u);
+        EXPECT_FLOAT_EQ(stats.GetHitRate(), 0.5f);
+        EXPECT_EQ(stats.m_timeSaved, stats.m_cookingTime);
+    }
+
+    TEST(PhysXCookedDataCache, FindOrCook_CookingFails_NothingIsCached)
+    {
+        CookedDataCache cache;
+        const CookedDataKey key = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(1.0f), PxCooking::GetRealTimeCookingParams());
+
+        AZStd::vector<AZ::u8> result;
+        EXPECT_FALSE(cache.FindOrCook(key, result, [](AZStd::vector<AZ::u8>&) { return false; }));
+        EXPECT_TRUE(result.empty());
+        EXPECT_FALSE(cache.Find(key, result));
+        EXPECT_EQ(cache.GetMemoryUsage(), 0u);
+    }
+
+    TEST(PhysXCookedDataCache, Store_ExceedingMemoryBudget_EvictsOldestEntries)
+    {
+        CookedDataCache cache;
+        cache.SetMemoryBudget(64);
+
+        const physx::PxCookingParams params = PxCooking::GetRealTimeCookingParams();
+        const CookedDataKey firstKey = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(1.0f), params);
+        const CookedDataKey secondKey = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(2.0f), params);
+        const CookedDataKey thirdKey = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(3.0f), params);
+
+        const AZStd::vector<AZ::u8> data(32, 1);
+        cache.Store(firstKey, data, AZStd::chrono::microseconds(0));
+        cache.Store(secondKey, data, AZStd::chrono::microseconds(0));
+        cache.Store(thirdKey, data, AZStd::chrono::microseconds(0));
+
+        EXPECT_LE(cache.GetMemoryUsage(), cache.GetMemoryBudget());
+
+        AZStd::vector<AZ::u8> result;
+        EXPECT_FALSE(cache.Find(firstKey, result));
+        EXPECT_TRUE(cache.Find(secondKey, result));
+        EXPECT_TRUE(cache.Find(thirdKey, result));
+    }
+
+    TEST(PhysXCookedDataCache, FindOrCook_DiskCacheEnabled_DataIsSharedBetweenCaches)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const CookedDataKey key = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(1.0f), PxCooking::GetRealTimeCookingParams());
+        AZ::u32 cookCount = 0;
+
+        AZStd::vector<AZ::u8> cookedResult;
+        {
+            CookedDataCache writingCache;
+            writingCache.SetDiskCacheDirectory(tempDirectory.GetDirectory());
+            EXPECT_TRUE(writingCache.FindOrCook(key, cookedResult, Internal::CreateTestCookFunction(cookCount)));
+        }
+
+        CookedDataCache readingCache;
+        readingCache.SetDiskCacheDirectory(tempDirectory.GetDirectory());
+        AZStd::vector<AZ::u8> cachedResult;
+        EXPECT_TRUE(readingCache.FindOrCook(key, cachedResult, Internal::CreateTestCookFunction(cookCount)));
+
+        EXPECT_EQ(cookCount, 1u);
+        EXPECT_EQ(cookedResult, cachedResult);
+        EXPECT_EQ(readingCache.GetStatistics().m_diskHits, 1u);
+    }
+
+    TEST(PhysXCookedDataCache, FindOrCook_TruncatedDiskEntry_IsRemovedAndCookedAgain)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const CookedDataKey key = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(1.0f), PxCooking::GetRealTimeCookingParams());
+        const AZStd::string path = Internal::GetTestDiskEntryPath(tempDirectory.GetDirectory(), key);
+        AZ::u32 cookCount = 0;
+
+        {
+            CookedDataCache writingCache;
+            writingCache.SetDiskCacheDirectory(tempDirectory.GetDirectory());
+            AZStd::vector<AZ::u8> result;
+            EXPECT_TRUE(writingCache.FindOrCook(key, result, Internal::CreateTestCookFunction(cookCount, 1024)));
+        }
+
+        // Cut the file in the middle of the data, leaving the header with the full data size
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::u64 fileSize = 0;
+        ASSERT_TRUE(fileIO->Size(path.c_str(), fileSize));
+        AZStd::vector<AZ::u8> fileContents(fileSize);
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        ASSERT_TRUE(fileIO->Open(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, file));
+        EXPECT_TRUE(fileIO->Read(file, fileContents.data(), fileSize, true));
+        fileIO->Close(file);
+        ASSERT_TRUE(fileIO->Open(path.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, file));
+        EXPECT_TRUE(fileIO->Write(file, fileContents.data(), fileSize / 2));
+        fileIO->Close(file);
+
+        CookedDataCache readingCache;
+        readingCache.SetDiskCacheDirectory(tempDirectory.GetDirectory());
+        AZStd::vector<AZ::u8> result;
+        EXPECT_TRUE(readingCache.FindOrCook(key, result, Internal::CreateTestCookFunction(cookCount, 1024)));
+
+        EXPECT_EQ(cookCount, 2u);
+        EXPECT_EQ(result.size(), 1024u);
+        const CookedDataCacheStatistics stats = readingCache.GetStatistics();
+        EXPECT_EQ(stats.m_diskHits, 0u);
+        EXPECT_EQ(stats.m_misses, 1u);
+        EXPECT_EQ(stats.m_invalidDiskEntries, 1u);
+
+        // The entry was cooked again and replaced the invalid file
+        ASSERT_TRUE(fileIO->Size(path.c_str(), fileSize));
+        EXPECT_EQ(fileSize, fileContents.size());
+    }
+
+    TEST(PhysXCookedDataCache, FindOrCook_DiskEntryRejectedByValidation_IsCookedAgain)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const CookedDataKey key = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(1.0f), PxCooking::GetRealTimeCookingParams());
+        AZ::u32 cookCount = 0;
+
+        {
+            CookedDataCache writingCache;
+            writingCache.SetDiskCacheDirectory(tempDirectory.GetDirectory());
+            AZStd::vector<AZ::u8> result;
+            EXPECT_TRUE(writingCache.FindOrCook(key, result, Internal::CreateTestCookFunction(cookCount)));
+        }
+
+        CookedDataCache readingCache;
+        readingCache.SetDiskCacheDirectory(tempDirectory.GetDirectory());
+        AZStd::vector<AZ::u8> result;
+        EXPECT_TRUE(readingCache.FindOrCook(key, result, Internal::CreateTestCookFunction(cookCount),
+            [](const AZStd::vector<AZ::u8>&) { return false; }));
+
+        EXPECT_EQ(cookCount, 2u);
+        EXPECT_EQ(readingCache.GetStatistics().m_invalidDiskEntries, 1u);
+        EXPECT_EQ(readingCache.GetStatistics().m_diskHits, 0u);
+    }
+
+    TEST(PhysXCookedDataCache, ValidateCookedData_CookedConvexMeshAndGarbage_OnlyCookedMeshIsValid)
+    {
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+        AZStd::vector<AZ::u8> cookedData;
+        bool cookingResult = false;
+        Physics::SystemRequestBus::BroadcastResult(cookingResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), cookedData);
+        ASSERT_TRUE(cookingResult);
+
+        EXPECT_TRUE(ValidateCookedData(CookedDataType::ConvexMesh, cookedData));
+        EXPECT_FALSE(ValidateCookedData(CookedDataType::ConvexMesh, AZStd::vector<AZ::u8>()));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(ValidateCookedData(CookedDataType::ConvexMesh, AZStd::vector<AZ::u8>(cookedData.size(), 0xcd)));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    TEST(PhysXCookedDataCache, Store_ExceedingDiskBudget_RemovesFilesUntilBelowBudget)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const physx::PxCookingParams params = PxCooking::GetRealTimeCookingParams();
+        constexpr AZ::u32 NumEntries = 8;
+        constexpr size_t EntrySize = 1024;
+
+        CookedDataCache cache;
+        cache.SetDiskCacheDirectory(tempDirectory.GetDirectory());
+        cache.SetDiskBudget(4 * EntrySize);
+
+        const AZStd::vector<AZ::u8> data(EntrySize, 1);
+        for (AZ::u32 i = 0; i < NumEntries; ++i)
+        {
+            const CookedDataKey key = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(static_cast<float>(i + 1)), params);
+            cache.Store(key, data, AZStd::chrono::microseconds(0));
+        }
+
+        // Every file is slightly larger than the entry size because of its header, so at most 3 fit in the budget
+        const AZ::u32 numDiskEntries = Internal::CountDiskEntries(tempDirectory.GetDirectory());
+        EXPECT_GT(numDiskEntries, 0u);
+        EXPECT_LE(numDiskEntries, 3u);
+
+        // Without a budget nothing is removed
+        cache.SetDiskBudget(0);
+        for (AZ::u32 i = 0; i < NumEntries; ++i)
+        {
+            const CookedDataKey key = Internal::CreateTestKey(TestUtils::GeneratePyramidPoints(static_cast<float>(i + 1)), params);
+            cache.Store(key, data, AZStd::chrono::microseconds(0));
+        }
+        EXPECT_EQ(Internal::CountDiskEntries(tempDirectory.GetDirectory()), NumEntries);
+    }
+
+    TEST(PhysXCookedDataCache, CookConvexMeshToMemory_SameGeometryTwice_SecondRequestIsServedFromCache)
+    {
+        PhysXSystem* physXSystem = GetPhysXSystem();
+        ASSERT_NE(physXSystem, nullptr);
+        CookedDataCache& cache = physXSystem->GetCookedDataCache();
+        cache.ClearMemory();
+        cache.ResetStatistics();
+
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+        AZStd::vector<AZ::u8> firstCookedData;
+        AZStd::vector<AZ::u8> secondCookedData;
+        bool firstCookingResult = false;
+        bool secondCookingResult = false;
+        Physics::SystemRequestBus::BroadcastResult(firstCookingResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), firstCookedData);
+        Physics::SystemRequestBus::BroadcastResult(secondCookingResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), secondCookedData);
+
+        EXPECT_TRUE(firstCookingResult);
+        EXPECT_TRUE(secondCookingResult);
+        EXPECT_FALSE(firstCookedData.empty());
+        EXPECT_EQ(firstCookedData, secondCookedData);
+
+        const CookedDataCacheStatistics stats = cache.GetStatistics();
+        EXPECT_EQ(stats.m_misses, 1u);
+        EXPECT_EQ(stats.m_memoryHits, 1u);
+    }
+} // namespace PhysX
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PhysX_precompiled.h>
+
+#include <AzTest/AzTest.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <System/PhysXCpuDispatcher.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        //! Task counting how often it runs and is released, signaling the semaphore once released.
+        class CountingTask
+            : public physx::PxBaseTask
+        {
+        public:
+            CountingTask(AZStd::semaphore& releasedSemaphore, AZStd::atomic<AZ::u32>& runCount)
+                : m_releasedSemaphore(releasedSemaphore)
+                , m_runCount(runCount)
+            {
+            }
+
+            void run() override
+            {
+                m_runThreadId = AZStd::this_thread::get_id();
+                m_runCount.fetch_add(1);
+            }
+
+            void release() override
+            {
+                m_releaseThreadId = AZStd::this_thread::get_id();
+                m_releasedSemaphore.release();
+            }
+
+            const char* getName() const override { return "CountingTask"; }
+            void addReference() override {}
+            void removeReference() override {}
+            int32_t getReference() const override { return 1; }
+
+            AZStd::thread_id m_runThreadId;
+            AZStd::thread_id m_releaseThreadId;
+
+        private:
+            AZStd::semaphore& m_releasedSemaphore;
+            AZStd::atomic<AZ::u32>& m_runCount;
+        };
+    } // namespace Internal
+
+    class PhysXCpuDispatcherFixture
+        : public testing::TestWithParam<int32_t>
+    {
+    };
+
+    TEST_P(PhysXCpuDispatcherFixture, SubmitTasks_AllTasksRunAndAreReleased)
+    {
+        constexpr AZ::u32 NumTasks = 64;
+        const int32_t workerCount = GetParam();
+
+        auto dispatcher = AZStd::make_unique<PhysXCpuDispatcher>(workerCount);
+        physx::PxCpuDispatcher* pxDispatcher = dispatcher.get();
+        EXPECT_EQ(pxDispatcher->getWorkerCount(), static_cast<physx::PxU32>(workerCount));
+
+        AZStd::semaphore releasedSemaphore;
+        AZStd::atomic<AZ::u32> runCount{ 0 };
+        AZStd::vector<AZStd::unique_ptr<Internal::CountingTask>> tasks;
+        for (AZ::u32 i = 0; i < NumTasks; ++i)
+        {
+            tasks.emplace_back(AZStd::make_unique<Internal::CountingTask>(releasedSemaphore, runCount));
+        }
+
+        for (auto& task : tasks)
+        {
+            pxDispatcher->submitTask(*task);
+        }
+
+        AZ::u32 releasedCount = 0;
+        while (releasedCount < NumTasks && releasedSemaphore.try_acquire_for(AZStd::chrono::seconds(10)))
+        {
+            ++releasedCount;
+        }
+        EXPECT_EQ(releasedCount, NumTasks);
+        EXPECT_EQ(runCount.load(), NumTasks);
+
+        // Without workers every task runs on the submitting thread, otherwise each task is run and released by one worker
+        const AZStd::thread_id thisThreadId = AZStd::this_thread::get_id();
+        for (const auto& task : tasks)
+        {
+            EXPECT_EQ(task->m_runThreadId, task->m_releaseThreadId);
+            if (workerCount == 0)
+            {
+                EXPECT_EQ(task->m_runThreadId, thisThreadId);
+            }
+            else
+            {
+                EXPECT_NE(task->m_runThreadId, thisThreadId);
+            }
+        }
+
+        // Destroying the dispatcher waits for the jobs which released their tasks to finish
+        dispatcher.reset();
+    }
+
+    INSTANTIATE_TEST_CASE_P(PhysX, PhysXCpuDispatcherFixture, ::testing::Values(0, 1, 4));
+
+    TEST(PhysXCpuDispatcherTest, GetCpuDispatcherWorkerCount_Default_HasWorkers)
+    {
+        // Every platform either shares the global job workers or gets dedicated ones, never the single threaded fallback
+        ASSERT_EQ(static_cast<int32_t>(physx_cpuDispatcherWorkerCount), PhysXCpuDispatcher::SharedWorkers);
+        const int32_t workerCount = GetCpuDispatcherWorkerCount();
+        EXPECT_TRUE(workerCount == PhysXCpuDispatcher::SharedWorkers || workerCount > 0);
+
+        if (workerCount > 0)
+        {
+            PhysXCpuDispatcher dispatcher(workerCount);
+            const physx::PxCpuDispatcher& pxDispatcher = dispatcher;
+            EXPECT_GT(pxDispatcher.getWorkerCount(), 0u);
+        }
+    }
+
+    TEST(PhysXCpuDispatcherTest, RequestWorkerCount_OnlyAppliedBetweenSteps)
+    {
+        PhysXCpuDispatcher dispatcher(0);
+        physx::PxCpuDispatcher& pxDispatcher = dispatcher;
+
+        dispatcher.RequestWorkerCount(2);
+        EXPECT_EQ(pxDispatcher.getWorkerCount(), 0u);
+
+        dispatcher.ApplyPendingWorkerCount();
+        EXPECT_EQ(pxDispatcher.getWorkerCount(), 2u);
+
+        // Nothing pending, the worker count stays
+        dispatcher.ApplyPendingWorkerCount();
+        EXPECT_EQ(pxDispatcher.getWorkerCount(), 2u);
+    }
+} // namespace PhysX
@@ -1010,4 +1010,178 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_MatchesSingleQueries)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup a ring of bodies around the origin
+        constexpr AZ::u32 NumBodies = 16;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (AZ::u32 i = 0; i < NumBodies; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * i / NumBodies;
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(cosf(angle), sinf(angle), 0.0f) * 10.0f, 1.0f));
+        }
+
+        //create enough ray casts to be split across several jobs, some of them missing every body
+        constexpr AZ::u32 NumRequests = 1000;
+        AzPhysics::SceneQueryRequests requests;
+        for (AZ::u32 i = 0; i < NumRequests; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * i / NumRequests;
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = AZ::Vector3(cosf(angle), sinf(angle), 0.0f);
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //each result should match the same request made on its own, in the same order
+        ASSERT_EQ(results.size(), requests.size());
+        size_t numHits = 0;
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits expected = sceneInterface->QueryScene(m_testSceneHandle, requests[i].get());
+            ASSERT_EQ(results[i].m_hits.size(), expected.m_hits.size());
+            for (size_t j = 0; j < expected.m_hits.size(); j++)
+            {
+                EXPECT_TRUE(results[i].m_hits[j].m_bodyHandle == expected.m_hits[j].m_bodyHandle);
+            }
+            numHits += results[i].m_hits.size();
+        }
+        EXPECT_GT(numHits, 0);
+        EXPECT_LT(numHits, NumRequests);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackCalledWhenSceneUpdates)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX();
+        request.m_distance = 200.0f;
+
+        static constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 42;
+        int numCallbacks = 0;
+        AzPhysics::SceneQueryHits asyncResult;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, RequestId, &request,
+            [&numCallbacks, &asyncResult](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(requestId, RequestId);
+                asyncResult = AZStd::move(hits);
+                ++numCallbacks;
+            });
+        ASSERT_TRUE(queued);
+
+        //callbacks are only called when the scene updates
+        EXPECT_EQ(numCallbacks, 0);
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(numCallbacks, 1);
+        ASSERT_EQ(asyncResult.m_hits.size(), 1);
+        EXPECT_TRUE(asyncResult.m_hits[0].m_bodyHandle == sphereHandle);
+
+        //and only once
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(numCallbacks, 1);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_RequestDestroyedBeforeUpdate_UsesCopyOfRequest)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        int numCallbacks = 0;
+        AzPhysics::SceneQueryHits asyncResult;
+        {
+            auto request = AZStd::make_unique<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = AZ::Vector3::CreateAxisX();
+            request->m_distance = 200.0f;
+
+            const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 0, request.get(),
+                [&numCallbacks, &asyncResult](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHits hits)
+                {
+                    asyncResult = AZStd::move(hits);
+                    ++numCallbacks;
+                });
+            ASSERT_TRUE(queued);
+
+            //point the request away from the sphere before it goes out of scope, the query must not see either
+            request->m_direction = -AZ::Vector3::CreateAxisX();
+        }
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(numCallbacks, 1);
+        ASSERT_EQ(asyncResult.m_hits.size(), 1);
+        EXPECT_TRUE(asyncResult.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackReceivesHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        static constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 7;
+        int numCallbacks = 0;
+        AzPhysics::SceneQueryHitsList asyncResults;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, RequestId, requests,
+            [&numCallbacks, &asyncResults](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                EXPECT_EQ(requestId, RequestId);
+                asyncResults = AZStd::move(hits);
+                ++numCallbacks;
+            });
+        ASSERT_TRUE(queued);
+
+        //the batch keeps its own references to the requests
+        requests.clear();
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(numCallbacks, 1);
+        ASSERT_EQ(asyncResults.size(), positions.size());
+        for (size_t i = 0; i < asyncResults.size(); i++)
+        {
+            ASSERT_EQ(asyncResults[i].m_hits.size(), 1);
+            EXPECT_TRUE(asyncResults[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_NoCallback_IsNotQueued)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::RayCastRequest request;
+        request.m_direction = AZ::Vector3::CreateAxisX();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(sceneInterface->QuerySceneAsync(m_testSceneHandle, 0, &request, {}));
+        EXPECT_FALSE(sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, {}, {}));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
 }
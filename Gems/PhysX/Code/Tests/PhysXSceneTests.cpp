@@ -9,9 +9,14 @@
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
+#include <AzCore/Component/TickBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
+#include <RigidBodyComponent.h>
+#include <SphereColliderComponent.h>
+#include <Tests/PhysXTestUtil.h>
 
 namespace PhysX
 {
@@ -586,4 +591,160 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    TEST_F(PhysXSceneActiveSimulatedBodiesFixture, RigidBodyComponents_EntityTransformsFollowActiveBodies)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        EntityPtr sphereA = TestUtils::CreateSphereEntity(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f), 0.5f);
+        EntityPtr sphereB = TestUtils::CreateSphereEntity(m_testSceneHandle, AZ::Vector3(5.0f, 0.0f, 20.0f), 0.5f);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+
+        for (const EntityPtr& entity : { sphereA, sphereB })
+        {
+            AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle,
+                entity->FindComponent<RigidBodyComponent>()->GetSimulatedBodyHandle());
+            ASSERT_TRUE(body != nullptr);
+
+            // the bodies have fallen and the entities moved with them
+            const AZ::Vector3 entityPosition = entity->GetTransform()->GetWorldTranslation();
+            EXPECT_TRUE(entityPosition.IsClose(body->GetPosition()));
+        }
+        EXPECT_LT(sphereA->GetTransform()->GetWorldTranslation().GetZ(), 10.0f);
+        EXPECT_LT(sphereB->GetTransform()->GetWorldTranslation().GetZ(), 20.0f);
+    }
+
+    TEST_F(PhysXSceneActiveSimulatedBodiesFixture, RigidBodyComponents_BodiesRemovedInCollisionCallback_RemainingTransformsWritten)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        TestUtils::AddStaticFloorToScene(m_testSceneHandle);
+
+        // the first sphere lands on the floor while the other bodies are still falling, so they are all active actors
+        EntityPtr landingSphere = TestUtils::CreateSphereEntity(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 3.0f), 0.5f);
+        EntityPtr removedSphere = TestUtils::CreateSphereEntity(m_testSceneHandle, AZ::Vector3(5.0f, 0.0f, 20.0f), 0.5f);
+        EntityPtr fallingSphere = TestUtils::CreateSphereEntity(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 20.0f), 0.5f);
+        AzPhysics::SimulatedBodyHandle removedBodyHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(15.0f, 0.0f, 20.0f));
+
+        // remove a component's body and a body without a component from the collision callback, in the middle of the step
+        bool bodiesRemoved = false;
+        CollisionCallbacksListener collisionListener(landingSphere->GetId());
+        collisionListener.m_onCollisionBegin = [&]([[maybe_unused]] const AzPhysics::CollisionEvent& collisionEvent)
+        {
+            if (!bodiesRemoved)
+            {
+                removedSphere->Deactivate();
+                sceneInterface->RemoveSimulatedBody(m_testSceneHandle, removedBodyHandle);
+                bodiesRemoved = true;
+            }
+        };
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 60);
+
+        EXPECT_TRUE(bodiesRemoved);
+
+        // the remaining entities still follow their bodies
+        for (const EntityPtr& entity : { landingSphere, fallingSphere })
+        {
+            AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle,
+                entity->FindComponent<RigidBodyComponent>()->GetSimulatedBodyHandle());
+            ASSERT_TRUE(body != nullptr);
+
+            const AZ::Vector3 entityPosition = entity->GetTransform()->GetWorldTranslation();
+            EXPECT_TRUE(entityPosition.IsClose(body->GetPosition()));
+        }
+        EXPECT_LT(fallingSphere->GetTransform()->GetWorldTranslation().GetZ(), 20.0f);
+
+        // the deactivated entity stopped where its body was removed
+        const float removedSphereHeight = removedSphere->GetTransform()->GetWorldTranslation().GetZ();
+        EXPECT_LT(removedSphereHeight, 20.0f);
+        EXPECT_GT(removedSphereHeight, fallingSphere->GetTransform()->GetWorldTranslation().GetZ());
+    }
+
+    TEST_F(PhysXSceneActiveSimulatedBodiesFixture, RigidBodyComponents_InterpolatedBodyWakingUp_KeepsInterpolating)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        TestUtils::AddStaticFloorToScene(m_testSceneHandle);
+
+        EntityPtr sphere = AZStd::make_shared<AZ::Entity>("InterpolatedSphere");
+        sphere->CreateComponent(AZ::Uuid::CreateString("{22B10178-39B6-4C12-BB37-77DB45FDD3B6}")); // TransformComponent
+        sphere->Init();
+        sphere->Activate();
+        AZ::TransformBus::Event(sphere->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, 0.0f, 2.0f));
+        sphere->Deactivate();
+
+        auto* sphereColliderComponent = sphere->CreateComponent<SphereColliderComponent>();
+        sphereColliderComponent->SetShapeConfigurationList({ AzPhysics::ShapeColliderPair(
+            AZStd::make_shared<Physics::ColliderConfiguration>(), AZStd::make_shared<Physics::SphereShapeConfiguration>(0.5f)) });
+        AzPhysics::RigidBodyConfiguration rigidBodyConfig;
+        rigidBodyConfig.m_computeMass = false;
+        rigidBodyConfig.m_interpolateMotion = true;
+        auto* rigidBodyComponent = sphere->CreateComponent<RigidBodyComponent>(rigidBodyConfig, m_testSceneHandle);
+        sphere->Activate();
+
+        auto* body = azdynamic_cast<AzPhysics::RigidBody*>(
+            sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, rigidBodyComponent->GetSimulatedBodyHandle()));
+        ASSERT_TRUE(body != nullptr);
+
+        // the interpolator advances with the real frame time, which matches the fixed time step here
+        const float timeStep = AzPhysics::SystemConfiguration::DefaultFixedTimestep;
+        auto stepAndTick = [this, timeStep](AZ::u32 numSteps)
+        {
+            for (AZ::u32 i = 0; i < numSteps; ++i)
+            {
+                TestUtils::UpdateScene(m_testSceneHandle, timeStep, 1);
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, timeStep, AZ::ScriptTimePoint());
+            }
+        };
+
+        // land on the floor and stay asleep for a while, the body isn't an active actor anymore
+        stepAndTick(600);
+        ASSERT_FALSE(body->IsAwake());
+        stepAndTick(120);
+
+        // once woken, the entity still trails the rising body instead of snapping to each new position
+        body->ApplyLinearImpulse(AZ::Vector3(0.0f, 0.0f, 5.0f));
+        stepAndTick(3);
+        const float bodyHeight = body->GetPosition().GetZ();
+        const float entityHeight = sphere->GetTransform()->GetWorldTranslation().GetZ();
+        EXPECT_GT(bodyHeight, 1.01f);
+        EXPECT_LT(entityHeight, bodyHeight);
+        EXPECT_GT(entityHeight, 0.99f);
+    }
+
+    TEST_F(PhysXSceneFixture, RigidBodyComponents_ManyBodies_EntityTransformsFollowBodies)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        // enough bodies for the transforms to be read on several jobs
+        constexpr int NumEntities = 1000;
+        AZStd::vector<EntityPtr> entities;
+        entities.reserve(NumEntities);
+        for (int i = 0; i < NumEntities; ++i)
+        {
+            const AZ::Vector3 position(static_cast<float>(i % 32) * 2.0f, static_cast<float>(i / 32) * 2.0f, 10.0f);
+            entities.emplace_back(TestUtils::CreateSphereEntity(m_testSceneHandle, position, 0.5f));
+        }
+
+        // deactivating an entity stops its transform being written
+        EntityPtr deactivatedEntity = entities.back();
+        entities.pop_back();
+        deactivatedEntity->Deactivate();
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+
+        for (const EntityPtr& entity : entities)
+        {
+            AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle,
+                entity->FindComponent<RigidBodyComponent>()->GetSimulatedBodyHandle());
+            ASSERT_TRUE(body != nullptr);
+
+            const AZ::Vector3 entityPosition = entity->GetTransform()->GetWorldTranslation();
+            EXPECT_TRUE(entityPosition.IsClose(body->GetPosition()));
+            EXPECT_LT(entityPosition.GetZ(), 10.0f);
+        }
+        EXPECT_FLOAT_EQ(deactivatedEntity->GetTransform()->GetWorldTranslation().GetZ(), 10.0f);
+    }
 }
@@ -120,8 +120,12 @@ set(FILES
     Source/Scene/PhysXSceneSimulationEventCallback.cpp
     Source/Scene/PhysXSceneSimulationFilterCallback.h
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
+    Source/Scene/PhysXSceneTransformWriter.h
+    Source/Scene/PhysXSceneTransformWriter.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
+    Source/System/PhysXCookedDataCache.h
+    Source/System/PhysXCookedDataCache.cpp
     Source/System/PhysXCookingParams.h
     Source/System/PhysXCookingParams.cpp
     Source/System/PhysXCpuDispatcher.cpp
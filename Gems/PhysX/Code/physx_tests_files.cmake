@@ -9,6 +9,8 @@ set(FILES
     Source/ComponentDescriptors.cpp
     Source/ComponentDescriptors.h
     Tests/PhysXComponentBusTests.cpp
+    Tests/PhysXCookedDataCacheTests.cpp
+    Tests/PhysXCpuDispatcherTests.cpp
     Tests/PhysXGenericTestFixture.h
     Tests/PhysXGenericTestFixture.cpp
     Tests/PhysXTestCommon.h
@@ -45,6 +45,18 @@ namespace ScriptCanvasBuilder
     constexpr const char* s_scriptCanvasProcessJobKey = "Script Canvas Process Job";
     constexpr const char* s_unitTestParseErrorPrefix = "LY_SC_UnitTest";
 
+    // the C++ translation of a graph, output as plain source files to be compiled into the module that registers it,
+    // these are product types only, they are never loaded by the asset manager
+    struct NativeHeaderAsset
+    {
+        AZ_TYPE_INFO(NativeHeaderAsset, "{5B0C5A7E-7D43-4F36-9E3C-6B2C1E4F9A10}");
+    };
+
+    struct NativeSourceAsset
+    {
+        AZ_TYPE_INFO(NativeSourceAsset, "{0E8F3B52-2C4D-4B8A-A1E6-3D7F5C9B8E21}");
+    };
+
     enum class BuilderVersion : int
     {
         SplitCopyFromCompileJobs = 9,
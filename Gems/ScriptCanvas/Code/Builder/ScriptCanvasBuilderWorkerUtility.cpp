@@ -14,6 +14,7 @@
 #include <AzCore/IO/IOUtils.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzFramework/Script/ScriptComponent.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <Builder/ScriptCanvasBuilderWorker.h>
@@ -30,6 +31,64 @@
 #include <ScriptCanvas/Utils/BehaviorContextUtils.h>
 #include <Source/Components/SceneComponent.h>
 
+namespace ScriptCanvasBuilderWorkerUtilityCPP
+{
+    // the C++ translation of a graph is output as plain source files, the engine build doesn't compile them: a gem that ships
+    // the graph natively adds them to its module and calls Register() of each translated class from its module constructor,
+    // generating that module is not done by the builder
+    AZ::Outcome<void, AZStd::string> AddNativeProducts(ScriptCanvasBuilder::ProcessTranslationJobInput& input, const ScriptCanvas::Translation::Result& translationResult)
+    {
+        using namespace ScriptCanvas::Translation;
+
+        auto errors = translationResult.m_errors.find(TargetFlags::Cpp);
+        if (errors != translationResult.m_errors.end())
+        {
+            AZStd::string errorString;
+
+            for (const auto& error : errors->second)
+            {
+                errorString += "* ";
+                errorString += error;
+            }
+
+            return AZ::Failure(errorString);
+        }
+
+        const AZStd::pair<TargetFlags, const char*> k_nativeProducts[] =
+        {
+            { TargetFlags::Hpp, ".h" },
+            { TargetFlags::Cpp, ".cpp" },
+        };
+
+        for (const auto& nativeProduct : k_nativeProducts)
+        {
+            auto translation = translationResult.m_translations.find(nativeProduct.first);
+            if (translation == translationResult.m_translations.end())
+            {
+                return AZ::Failure(AZStd::string::format("Missing %s translation of %s", nativeProduct.second, input.fileNameOnly.c_str()));
+            }
+
+            AZStd::string productPath;
+            AzFramework::StringFunc::Path::Join(input.request->m_tempDirPath.c_str(), (input.fileNameOnly + nativeProduct.second).c_str(), productPath);
+
+            auto writeOutcome = AZ::Utils::WriteFile(translation->second.m_text, productPath);
+            if (!writeOutcome.IsSuccess())
+            {
+                return writeOutcome;
+            }
+
+            AssetBuilderSDK::JobProduct jobProduct;
+            jobProduct.m_productFileName = productPath;
+            jobProduct.m_productAssetType = nativeProduct.first == TargetFlags::Hpp ? azrtti_typeid<ScriptCanvasBuilder::NativeHeaderAsset>() : azrtti_typeid<ScriptCanvasBuilder::NativeSourceAsset>();
+            jobProduct.m_productSubID = nativeProduct.first == TargetFlags::Hpp ? AZ_CRC_CE("NativeHeader") : AZ_CRC_CE("NativeSource");
+            jobProduct.m_dependenciesHandled = true;
+            input.response->m_outputProducts.push_back(AZStd::move(jobProduct));
+        }
+
+        return AZ::Success();
+    }
+}
+
 namespace ScriptCanvasBuilder
 {
     AssetHandlers::AssetHandlers(SharedHandlers& source)
@@ -505,13 +564,22 @@ namespace ScriptCanvasBuilder
         request.rawSaveDebugOutput = ScriptCanvas::Grammar::g_saveRawTranslationOuputToFile;
         request.printModelToConsole = ScriptCanvas::Grammar::g_printAbstractCodeModel;
 
-        ScriptCanvas::Translation::Result translationResult = TranslateToLua(request);
+        ScriptCanvas::Translation::Result translationResult = ScriptCanvas::Grammar::g_translateToNativeAtBuildTime
+            ? ScriptCanvas::Translation::ToCPlusPlusAndLua(request)
+            : TranslateToLua(request);
         auto outcome = translationResult.IsSuccess(ScriptCanvas::Translation::TargetFlags::Lua);
         if (!outcome.IsSuccess())
         {
             return AZ::Failure(outcome.GetError());
         }
 
+        if (ScriptCanvas::Grammar::g_translateToNativeAtBuildTime)
+        {
+            // the Lua translation remains the fallback for graphs that use features the C++ translation does not support yet
+            auto nativeOutcome = ScriptCanvasBuilderWorkerUtilityCPP::AddNativeProducts(input, translationResult);
+            AZ_Warning(s_scriptCanvasBuilder, nativeOutcome.IsSuccess(), "%s was not translated to C++: %s", input.fileNameOnly.c_str(), nativeOutcome.IsSuccess() ? "" : nativeOutcome.GetError().c_str());
+        }
+
         const auto& translation = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Lua)->second;
 
         AZ::IO::MemoryStream inputStream(translation.m_text.data(), translation.m_text.size());
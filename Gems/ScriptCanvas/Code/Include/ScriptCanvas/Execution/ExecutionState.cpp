@@ -13,6 +13,8 @@
 #include "Interpreted/ExecutionStateInterpretedPure.h"
 #include "Interpreted/ExecutionStateInterpretedPerActivation.h"
 #include "Interpreted/ExecutionStateInterpretedSingleton.h"
+#include "Native/ExecutionStateNative.h"
+#include "NativeHostDefinitions.h"
 
 #include "ExecutionState.h"
 
@@ -30,6 +32,12 @@ namespace ScriptCanvas
 
     ExecutionStatePtr ExecutionState::Create(const ExecutionStateConfig& config)
     {
+        // a graph translated to C++ executes the nodeable its module registered, instead of its Lua
+        if (NativeNodeable* nodeable = CreateNativeNodeable(config.asset.GetId().m_guid))
+        {
+            return AZStd::make_shared<ExecutionStateNative>(config, nodeable);
+        }
+
         Grammar::ExecutionStateSelection selection = config.runtimeData.m_input.m_executionSelection;
 
         switch (selection)
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionStateNative.h"
+
+#include <ScriptCanvas/Core/Core.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+namespace ScriptCanvas
+{
+    ExecutionStateNative::ExecutionStateNative(const ExecutionStateConfig& config, NativeNodeable* nodeable)
+        : ExecutionState(config)
+        , m_nodeable(nodeable)
+    {
+        const Grammar::ExecutionStateSelection selection = config.runtimeData.m_input.m_executionSelection;
+        m_executesOnGraphStart = selection == Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart
+            || selection == Grammar::ExecutionStateSelection::InterpretedObjectOnGraphStart;
+    }
+
+    ExecutionStateNative::~ExecutionStateNative()
+    {
+        StopExecution();
+    }
+
+    void ExecutionStateNative::Execute()
+    {
+        if (m_executesOnGraphStart)
+        {
+            m_nodeable->OnGraphStart();
+        }
+    }
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNative::Initialize()
+    {
+        m_nodeable->Activate(this);
+        m_isActive = true;
+    }
+
+    void ExecutionStateNative::StopExecution()
+    {
+        if (m_isActive)
+        {
+            m_isActive = false;
+            m_nodeable->Deactivate();
+        }
+    }
+}
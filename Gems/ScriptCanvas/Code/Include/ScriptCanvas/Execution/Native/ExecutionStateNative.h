@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include "Execution/ExecutionState.h"
+#include "Execution/Native/NativeNodeable.h"
+
+namespace ScriptCanvas
+{
+    // executes the nodeable a graph was translated to in C++, which a module registered for the asset of the graph
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{B3F6D2A9-8E1C-4C57-A4D0-5E9B7C3F2A18}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator, 0);
+
+        ExecutionStateNative(const ExecutionStateConfig& config, NativeNodeable* nodeable);
+
+        ~ExecutionStateNative() override;
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        void StopExecution() override;
+
+    private:
+        AZStd::unique_ptr<NativeNodeable> m_nodeable;
+        bool m_isActive = false;
+        bool m_executesOnGraphStart = false;
+    };
+}
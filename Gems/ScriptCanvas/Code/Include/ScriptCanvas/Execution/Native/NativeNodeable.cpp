@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "NativeNodeable.h"
+
+namespace ScriptCanvas
+{
+    void NativeNodeable::Activate(ExecutionState* executionState)
+    {
+        m_nativeExecutionState = executionState->WeakFromThis();
+        InitializeExecutionState(executionState);
+    }
+
+    ExecutionStateWeakPtr NativeNodeable::GetExecutionState() const
+    {
+        return m_nativeExecutionState;
+    }
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <ScriptCanvas/Core/Nodeable.h>
+
+namespace ScriptCanvas
+{
+    // the base of the nodeables graphs are translated to in C++, which ExecutionStateNative executes in place of the Lua of the graph
+    class NativeNodeable
+        : public Nodeable
+    {
+    public:
+        AZ_RTTI(NativeNodeable, "{4A5E8C1D-6B2F-4E7A-9C3B-1D8F2E6A7B40}", Nodeable);
+        AZ_CLASS_ALLOCATOR(NativeNodeable, AZ::SystemAllocator, 0);
+
+        NativeNodeable() = default;
+
+        ~NativeNodeable() override = default;
+
+        void Activate(ExecutionState* executionState);
+
+        // called when the graph starts, for graphs that have a start node
+        virtual void OnGraphStart() {}
+
+    protected:
+        ExecutionStateWeakPtr GetExecutionState() const;
+
+    private:
+        ExecutionStateWeakPtr m_nativeExecutionState = nullptr;
+    };
+}
@@ -7,6 +7,8 @@
 
 #include "NativeHostDefinitions.h"
 #include <AzCore/std/containers/unordered_map.h>
+#include <ScriptCanvas/Core/MethodConfiguration.h>
+#include <ScriptCanvas/Utils/BehaviorContextUtils.h>
 
 namespace NativeHostDefinitionsCPP
 {
@@ -14,6 +16,17 @@ namespace NativeHostDefinitionsCPP
 
     using FunctionMap = AZStd::unordered_map<AZStd::string, GraphStartFunction>;
     FunctionMap s_functionMap;
+
+    using NodeableFactoryMap = AZStd::unordered_map<AZ::Uuid, NativeNodeableFactory>;
+    NodeableFactoryMap s_nodeableFactoryMap;
+
+    template<typename... t_Arithmetic>
+    bool ReadArithmeticArgument(const AZ::BehaviorValueParameter& argument, Data::NumberType& number)
+    {
+        // the first type that matches the argument is read and converted
+        return ((argument.m_typeId == azrtti_typeid<t_Arithmetic>()
+            && (number = static_cast<Data::NumberType>(*argument.GetAsUnsafe<t_Arithmetic>()), true)) || ...);
+    }
 }
 
 namespace ScriptCanvas
@@ -61,4 +74,118 @@ namespace ScriptCanvas
         return false;
     }
 
+    NativeNodeable* CreateNativeNodeable(const AZ::Uuid& graphAssetId)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        auto iter = s_nodeableFactoryMap.find(graphAssetId);
+        return iter != s_nodeableFactoryMap.end() ? iter->second() : nullptr;
+    }
+
+    bool RegisterNativeNodeable(const AZ::Uuid& graphAssetId, NativeNodeableFactory factory)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        auto iter = s_nodeableFactoryMap.find(graphAssetId);
+        if (iter == s_nodeableFactoryMap.end())
+        {
+            s_nodeableFactoryMap.insert({ graphAssetId, factory });
+            return true;
+        }
+
+        return false;
+    }
+
+    bool UnregisterNativeNodeable(const AZ::Uuid& graphAssetId)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        auto iter = s_nodeableFactoryMap.find(graphAssetId);
+        if (iter != s_nodeableFactoryMap.end())
+        {
+            s_nodeableFactoryMap.erase(iter);
+            return true;
+        }
+
+        return false;
+    }
+
+    const AZ::BehaviorMethod* FindNativeMethod(MethodType methodType, AZStd::string_view className, AZStd::string_view methodName)
+    {
+        const AZ::BehaviorClass* behaviorClass{};
+        const AZ::BehaviorMethod* method{};
+
+        // matches the look up done by the Method node in Method::GetBehaviorContextClassMethod
+        if (BehaviorContextUtils::FindExplicitOverload(method, behaviorClass, className, methodName))
+        {
+            return method;
+        }
+
+        switch (methodType)
+        {
+        case MethodType::Event:
+            BehaviorContextUtils::FindEvent(method, className, methodName);
+            break;
+
+        case MethodType::Free:
+            BehaviorContextUtils::FindFree(method, methodName);
+            break;
+
+        case MethodType::Member:
+        case MethodType::Getter:
+        case MethodType::Setter:
+        {
+            PropertyStatus status = methodType == MethodType::Getter ? PropertyStatus::Getter : methodType == MethodType::Setter ? PropertyStatus::Setter : PropertyStatus::None;
+            BehaviorContextUtils::FindClass(method, behaviorClass, className, methodName, status);
+        }
+        break;
+
+        default:
+            AZ_Error("ScriptCanvas", false, "unsupported method type for %.*s", aznumeric_cast<int>(methodName.size()), methodName.data());
+            break;
+        }
+
+        return method;
+    }
+
+    template<>
+    Data::NumberType ReadNativeArgument<Data::NumberType>(const AZ::BehaviorValueParameter& argument)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        if (argument.GetValueAddress())
+        {
+            Data::NumberType number{};
+            if (ReadArithmeticArgument<double, float, AZ::s8, AZ::s16, AZ::s32, AZ::s64, AZ::u8, AZ::u16, AZ::u32, AZ::u64, char, bool>(argument, number))
+            {
+                return number;
+            }
+        }
+
+        AZ_Error("ScriptCanvas", false, "Failed to read a Number argument in a graph translated to C++");
+        return Data::NumberType{};
+    }
+
+    template<>
+    Data::StringType ReadNativeArgument<Data::StringType>(const AZ::BehaviorValueParameter& argument)
+    {
+        if (argument.GetValueAddress())
+        {
+            if (argument.m_typeId == azrtti_typeid<Data::StringType>())
+            {
+                return *argument.GetAsUnsafe<Data::StringType>();
+            }
+            else if (argument.m_typeId == azrtti_typeid<AZStd::string_view>())
+            {
+                return Data::StringType(*argument.GetAsUnsafe<AZStd::string_view>());
+            }
+            else if (argument.m_typeId == azrtti_typeid<char>() && (argument.m_traits & AZ::BehaviorParameter::TR_POINTER))
+            {
+                return Data::StringType(reinterpret_cast<const char*>(argument.GetValueAddress()));
+            }
+        }
+
+        AZ_Error("ScriptCanvas", false, "Failed to read a String argument in a graph translated to C++");
+        return Data::StringType{};
+    }
 }
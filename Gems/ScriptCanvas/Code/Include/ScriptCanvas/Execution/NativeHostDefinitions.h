@@ -5,19 +5,84 @@
  *
  */
 
+#pragma once
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <ScriptCanvas/Data/Data.h>
+
 #include "NativeHostDeclarations.h"
 
 namespace ScriptCanvas
 {
+    class NativeNodeable;
+
+    enum class MethodType;
+
     typedef void (*GraphStartFunction)(const RuntimeContext&);
 
     using GraphStartFunction = void(*)(const RuntimeContext&);
 
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context);
-    
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function);
-    
+
     // this may never have to be necessary
     bool UnregisterNativeGraphStart(AZStd::string_view name);
 
+    // graphs translated to C++ register a factory for their nodeable, by the asset id guid of the graph, when the module that
+    // compiled them is loaded, and ExecutionState::Create executes the registered nodeable in place of the Lua of the graph
+    using NativeNodeableFactory = NativeNodeable*(*)();
+
+    NativeNodeable* CreateNativeNodeable(const AZ::Uuid& graphAssetId);
+
+    bool RegisterNativeNodeable(const AZ::Uuid& graphAssetId, NativeNodeableFactory factory);
+
+    bool UnregisterNativeNodeable(const AZ::Uuid& graphAssetId);
+
+    // finds the reflected method a Method node of a graph translated to C++ calls, the same way the node found it in the editor
+    const AZ::BehaviorMethod* FindNativeMethod(MethodType methodType, AZStd::string_view className, AZStd::string_view methodName);
+
+    // calls a reflected method from a graph translated to C++, the arguments are handed to the method as they are,
+    // without any of the marshaling the interpreted (Lua) execution requires
+    template<typename... t_Args>
+    void CallNativeMethod(const AZ::BehaviorMethod* method, t_Args&&... args)
+    {
+        if (!method || !method->Invoke(AZStd::forward<t_Args>(args)...))
+        {
+            AZ_Error("ScriptCanvas", false, "Failed to call %s from a graph translated to C++", method ? method->m_name.c_str() : "a missing method");
+        }
+    }
+
+    template<typename t_Return, typename... t_Args>
+    t_Return CallNativeMethodResult(const AZ::BehaviorMethod* method, t_Args&&... args)
+    {
+        t_Return result{};
+
+        if (!method || !method->InvokeResult(result, AZStd::forward<t_Args>(args)...))
+        {
+            AZ_Error("ScriptCanvas", false, "Failed to call %s from a graph translated to C++", method ? method->m_name.c_str() : "a missing method");
+        }
+
+        return result;
+    }
+
+    // reads an argument an EBus handler of a graph translated to C++ was called with, the Number and String of the graph are
+    // read from any arithmetic and string type, all other types have to match exactly
+    template<typename t_Value>
+    t_Value ReadNativeArgument(const AZ::BehaviorValueParameter& argument)
+    {
+        if (argument.m_typeId == azrtti_typeid<t_Value>() && argument.GetValueAddress())
+        {
+            return *argument.GetAsUnsafe<t_Value>();
+        }
+
+        AZ_Error("ScriptCanvas", false, "Failed to read an argument of type %s in a graph translated to C++", AZ::AzTypeInfo<t_Value>::Name());
+        return t_Value{};
+    }
+
+    template<>
+    Data::NumberType ReadNativeArgument<Data::NumberType>(const AZ::BehaviorValueParameter& argument);
+
+    template<>
+    Data::StringType ReadNativeArgument<Data::StringType>(const AZ::BehaviorValueParameter& argument);
 }
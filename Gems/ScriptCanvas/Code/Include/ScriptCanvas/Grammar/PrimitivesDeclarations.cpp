@@ -16,5 +16,6 @@ namespace ScriptCanvas
         AZ_CVAR(bool, g_printAbstractCodeModelAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Print out the Abstract Code Model at the end of parsing (at prefab time) for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFile, true, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFileAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation (at prefab time) for debug purposes.");
+        AZ_CVAR(bool, g_translateToNativeAtBuildTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Translate graphs to C++ as well as Lua at build time, and output the C++ as products to compile into a module.");
     }
 }
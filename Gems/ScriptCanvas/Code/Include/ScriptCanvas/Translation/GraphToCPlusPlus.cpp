@@ -1,14 +1,287 @@
 /*
  * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
- * 
+ *
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
 
 #include "GraphToCPlusPlus.h"
 
+#include <cmath>
+#include <cstdlib>
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <ScriptCanvas/Core/MethodConfiguration.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingMetaData.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
 #include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
+#include <ScriptCanvas/Results/ErrorText.h>
+
+namespace GraphToCPlusPlusCPP
+{
+    using namespace ScriptCanvas;
+
+    constexpr const char* k_floatingPointEqualityTolerance = "0.000001";
+    constexpr const char* k_reflectedMethodName = "m_reflectedMethod";
+
+    constexpr const char* k_unsupportedArgument = "C++ translation does not support passing a %s to argument %zu of %s";
+    constexpr const char* k_unsupportedArithmetic = "C++ translation only supports arithmetic on operands of the same Number, Vector, or String (addition only) type";
+    constexpr const char* k_unsupportedConversion = "C++ translation does not support converting %s to %s";
+    constexpr const char* k_unsupportedDependencies = "C++ translation does not support graphs that depend on other graphs yet";
+    constexpr const char* k_unsupportedEBusConnectionControl = "C++ translation does not support connecting or disconnecting EBus handlers from the graph yet, the %s handler is";
+    constexpr const char* k_unsupportedEBusEvent = "EBus handler did not return a valid index for event %s";
+    constexpr const char* k_unsupportedEBusResult = "C++ translation does not support handling EBus events with results yet, %s is one";
+    constexpr const char* k_unsupportedEntityId = "C++ translation does not support entity ids that have to be remapped at run-time yet";
+    constexpr const char* k_unsupportedEventHandling = "C++ translation does not support AZ::Event handlers yet";
+    constexpr const char* k_unsupportedFunctionCall = "C++ translation only supports calls of reflected methods, %s is not one";
+    constexpr const char* k_unsupportedIsNull = "C++ translation does not support null checks yet";
+    constexpr const char* k_unsupportedMathExpression = "C++ translation does not support the math expression: %s";
+    constexpr const char* k_unsupportedMethod = "C++ translation does not support overloaded, branching, or checked methods yet, %s is one";
+    constexpr const char* k_unsupportedMethodResult = "C++ translation does not support writing the result of %s to a %s";
+    constexpr const char* k_unsupportedMissingInput = "Execution is missing the input the C++ translation requires";
+    constexpr const char* k_unsupportedMultipleOutput = "C++ translation does not support functions calls with multiple results yet";
+    constexpr const char* k_unsupportedName = "%s is a reserved word in the C++ translation";
+    constexpr const char* k_unsupportedOmittedParameter = "C++ translation does not support reading %s, since it does not support its type: %s";
+    constexpr const char* k_unsupportedNodeable = "C++ translation does not support nodeable nodes yet";
+    constexpr const char* k_unsupportedStaticVariables = "C++ translation does not support variables that require static initialization yet";
+    constexpr const char* k_unsupportedSymbol = "C++ translation does not support %s yet";
+    constexpr const char* k_unsupportedType = "C++ translation does not support the type of %s: %s";
+    constexpr const char* k_unsupportedVariableConstruction = "C++ translation does not support variables that are provided on construction, %s is one";
+    constexpr const char* k_unsupportedVariableHandling = "C++ translation does not support variable change handling yet, %s is handled";
+
+    const char* GetArithmeticTypeName(const AZ::TypeId& typeId)
+    {
+        static const AZStd::pair<AZ::TypeId, const char*> k_arithmeticTypes[] =
+        {
+            { azrtti_typeid<bool>(), "bool" },
+            { azrtti_typeid<char>(), "char" },
+            { azrtti_typeid<double>(), "double" },
+            { azrtti_typeid<float>(), "float" },
+            { azrtti_typeid<AZ::s8>(), "AZ::s8" },
+            { azrtti_typeid<AZ::s16>(), "AZ::s16" },
+            { azrtti_typeid<AZ::s32>(), "AZ::s32" },
+            { azrtti_typeid<AZ::s64>(), "AZ::s64" },
+            { azrtti_typeid<AZ::u8>(), "AZ::u8" },
+            { azrtti_typeid<AZ::u16>(), "AZ::u16" },
+            { azrtti_typeid<AZ::u32>(), "AZ::u32" },
+            { azrtti_typeid<AZ::u64>(), "AZ::u64" },
+        };
+
+        for (const auto& arithmeticType : k_arithmeticTypes)
+        {
+            if (arithmeticType.first == typeId)
+            {
+                return arithmeticType.second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    const char* GetDataTypeName(Data::eType type)
+    {
+        switch (type)
+        {
+        case Data::eType::AABB:
+            return "Data::AABBType";
+        case Data::eType::Boolean:
+            return "Data::BooleanType";
+        case Data::eType::Color:
+            return "Data::ColorType";
+        case Data::eType::CRC:
+            return "Data::CRCType";
+        case Data::eType::EntityID:
+            return "Data::EntityIDType";
+        case Data::eType::Matrix3x3:
+            return "Data::Matrix3x3Type";
+        case Data::eType::Matrix4x4:
+            return "Data::Matrix4x4Type";
+        case Data::eType::Number:
+            return "Data::NumberType";
+        case Data::eType::OBB:
+            return "Data::OBBType";
+        case Data::eType::Plane:
+            return "Data::PlaneType";
+        case Data::eType::Quaternion:
+            return "Data::QuaternionType";
+        case Data::eType::String:
+            return "Data::StringType";
+        case Data::eType::Transform:
+            return "Data::TransformType";
+        case Data::eType::Vector2:
+            return "Data::Vector2Type";
+        case Data::eType::Vector3:
+            return "Data::Vector3Type";
+        case Data::eType::Vector4:
+            return "Data::Vector4Type";
+        default:
+            return nullptr;
+        }
+    }
+
+    const char* GetMethodTypeName(MethodType methodType)
+    {
+        switch (methodType)
+        {
+        case MethodType::Event:
+            return "Event";
+        case MethodType::Free:
+            return "Free";
+        case MethodType::Getter:
+            return "Getter";
+        case MethodType::Setter:
+            return "Setter";
+        case MethodType::Member:
+        default:
+            return "Member";
+        }
+    }
+
+    bool IsReservedName(AZStd::string_view name)
+    {
+        // C++ keywords, and the names the generated nodeable, or the Nodeable it derives from, declare
+        static const char* const k_reservedNames[] =
+        {
+            "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch", "char",
+            "char16_t", "char32_t", "class", "compl", "const", "const_cast", "constexpr", "continue", "decltype", "default",
+            "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for",
+            "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+            "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "return",
+            "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template", "this",
+            "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual",
+            "void", "volatile", "wchar_t", "while", "xor", "xor_eq",
+            "Activate", "CallOut", "Deactivate", "ExecutionOut", "ExecutionOutResult", "GetAssetId", "GetEntityId",
+            "GetExecutionOut", "GetExecutionState", "GetRequiredOutCount", "GetScriptCanvasId", "InitializeExecutionOuts",
+            "InitializeExecutionState", "IsActive", "OnDeactivate", "OnGraphStart", "OnInitializeExecutionState", "Register",
+            "SetExecutionOut", "Unregister",
+        };
+
+        for (const char* reservedName : k_reservedNames)
+        {
+            if (name == reservedName)
+            {
+                return true;
+            }
+        }
+
+        return name.starts_with(k_reflectedMethodName);
+    }
+
+    AZStd::string ToFloatingPointString(double value, bool isFloat)
+    {
+        const char* limits = isFloat ? "AZStd::numeric_limits<float>" : "AZStd::numeric_limits<Data::NumberType>";
+
+        if (std::isnan(value))
+        {
+            return AZStd::string::format("%s::quiet_NaN()", limits);
+        }
+        else if (std::isinf(value))
+        {
+            return AZStd::string::format("%s%s::infinity()", value < 0.0 ? "-" : "", limits);
+        }
+
+        // the shortest text that reads back as the same value keeps the generated code legible
+        AZStd::string text;
+        for (int digits = isFloat ? 6 : 15, maxDigits = isFloat ? 9 : 17; digits <= maxDigits; ++digits)
+        {
+            text = AZStd::string::format("%.*g", digits, value);
+
+            if (isFloat ? strtof(text.c_str(), nullptr) == static_cast<float>(value) : strtod(text.c_str(), nullptr) == value)
+            {
+                break;
+            }
+        }
+
+        if (text.find_first_of(".eE") == AZStd::string::npos)
+        {
+            text += ".0";
+        }
+
+        if (isFloat)
+        {
+            text += "f";
+        }
+
+        return text;
+    }
+
+    AZStd::string ToFloatString(float value)
+    {
+        return ToFloatingPointString(value, true);
+    }
+
+    AZStd::string ToStringLiteral(AZStd::string_view text)
+    {
+        AZStd::string literal = "\"";
+
+        for (char character : text)
+        {
+            switch (character)
+            {
+            case '\"':
+                literal += "\\\"";
+                break;
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20 || character == 0x7f)
+                {
+                    literal += AZStd::string::format("\\%03o", static_cast<unsigned int>(static_cast<unsigned char>(character)));
+                }
+                else
+                {
+                    literal += character;
+                }
+                break;
+            }
+        }
+
+        literal += "\"";
+        return literal;
+    }
+
+    AZStd::string ToQuaternionString(const AZ::Quaternion& value)
+    {
+        return AZStd::string::format("Data::QuaternionType(%s, %s, %s, %s)"
+            , ToFloatString(value.GetX()).c_str()
+            , ToFloatString(value.GetY()).c_str()
+            , ToFloatString(value.GetZ()).c_str()
+            , ToFloatString(value.GetW()).c_str());
+    }
+
+    AZStd::string ToVector3String(const AZ::Vector3& value)
+    {
+        return AZStd::string::format("Data::Vector3Type(%s, %s, %s)"
+            , ToFloatString(value.GetX()).c_str()
+            , ToFloatString(value.GetY()).c_str()
+            , ToFloatString(value.GetZ()).c_str());
+    }
+
+    AZStd::string ToVector4String(const AZ::Vector4& value)
+    {
+        return AZStd::string::format("Data::Vector4Type(%s, %s, %s, %s)"
+            , ToFloatString(value.GetX()).c_str()
+            , ToFloatString(value.GetY()).c_str()
+            , ToFloatString(value.GetZ()).c_str()
+            , ToFloatString(value.GetW()).c_str());
+    }
+}
 
 namespace ScriptCanvas
 {
@@ -19,6 +292,11 @@ namespace ScriptCanvas
             Configuration configuration;
             configuration.m_blockCommentClose = "*/";
             configuration.m_blockCommentOpen = "/*";
+            configuration.m_executionStateEntityIdRef = "GetEntityId()";
+            configuration.m_executionStateScriptCanvasIdRef = "GetScriptCanvasId()";
+            configuration.m_functionBlockClose = "}";
+            configuration.m_functionBlockOpen = "{";
+            configuration.m_lexicalScopeDelimiter = "::";
             configuration.m_namespaceClose = "}";
             configuration.m_namespaceOpen = "{";
             configuration.m_namespaceOpenPrefix = "namespace";
@@ -29,173 +307,1455 @@ namespace ScriptCanvas
         }
 
         GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
-            : GraphToX(CreateCPlusPluseConfig(), model) 
+            : GraphToX(CreateCPlusPluseConfig(), model)
+            , m_className(Grammar::ToSafeName(AZStd::string(GetGraphName())))
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
-            
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
-                        
+            MarkTranslationStart();
+            CheckSupportedFeatures();
+
+            WriteHeader();
+            TranslateDependencies();
             TranslateNamespaceOpen();
             {
                 TranslateClassOpen();
                 {
-                    TranslateVariables();
-                    TranslateHandlers();
+                    // the private members are declared last, once the functions have found all the reflected methods they call
+                    TranslateFunctions();
                     TranslateConstruction();
-                    TranslateDestruction();
-                    TranslateStartNode();
+                    TranslateRegistration();
+                    TranslateVariables();
                 }
                 TranslateClassClose();
             }
             TranslateNamespaceClose();
+            MarkTranslationStop();
         }
 
-        AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
+        AZ::Outcome<void, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
         {
             GraphToCPlusPlus translation(model);
 
             if (translation.IsSuccessfull())
             {
-                dotH = AZStd::move(translation.m_dotH.MoveOutput());
-                dotCPP = AZStd::move(translation.m_dotCPP.MoveOutput());
+                dotH = translation.m_dotH.MoveOutput();
+                dotCPP = translation.m_dotCPP.MoveOutput();
                 return AZ::Success();
             }
             else
             {
-                return AZ::Failure(AZStd::make_pair(AZStd::string(".h errors"), AZStd::string(".cpp errors")));
+                ErrorList errors;
+
+                for (const auto& error : translation.GetErrors())
+                {
+                    errors.push_back(error->GetDescription());
+                }
+
+                return AZ::Failure(errors);
             }
         }
 
-        void GraphToCPlusPlus::TranslateClassClose()
+        size_t GraphToCPlusPlus::AddReflectedMethod(const Nodes::Core::Method& node, const AZ::BehaviorMethod& method)
         {
-            m_dotH.Outdent();
-            m_dotH.WriteIndent();
-            m_dotH.Write("};");
-            m_dotH.WriteSpace();
-            SingleLineComment(m_dotH);
-            m_dotH.WriteSpace();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
+            for (size_t index = 0; index < m_reflectedMethods.size(); ++index)
+            {
+                if (m_reflectedMethods[index].m_method == &method)
+                {
+                    return index;
+                }
+            }
+
+            m_reflectedMethods.push_back({ &method, &node });
+            return m_reflectedMethods.size() - 1;
         }
 
-        void GraphToCPlusPlus::TranslateClassOpen()
+        void GraphToCPlusPlus::AddTranslationError(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view description)
         {
-            m_dotH.WriteIndent();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
-            m_dotH.WriteIndent();
-            m_dotH.WriteLine("{");
-            m_dotH.Indent();
+            AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId(), description));
         }
 
-        void GraphToCPlusPlus::TranslateConstruction()
+        void GraphToCPlusPlus::CheckSupportedEBusHandling(Grammar::EBusHandlingConstPtr ebusHandling)
         {
+            using namespace GraphToCPlusPlusCPP;
+
+            // the handler is only connected on construction, the connect and disconnect nodes of the graph call the handler in Lua
+            if (ebusHandling->RequiresConnectionControl())
+            {
+                AddTranslationError(nullptr, AZStd::string::format(k_unsupportedEBusConnectionControl, ebusHandling->m_ebusName.c_str()));
+                return;
+            }
 
+            CheckSupportedName(nullptr, ebusHandling->m_handlerName);
+
+            for (const auto& nameAndEventThread : ebusHandling->m_events)
+            {
+                const Grammar::ExecutionTreeConstPtr& eventThread = nameAndEventThread.second;
+
+                if (eventThread->HasReturnValues())
+                {
+                    AddTranslationError(eventThread, AZStd::string::format(k_unsupportedEBusResult, nameAndEventThread.first.c_str()));
+                }
+                else if (!ebusHandling->m_node->GetEventIndex(nameAndEventThread.first))
+                {
+                    AddTranslationError(eventThread, AZStd::string::format(k_unsupportedEBusEvent, nameAndEventThread.first.c_str()));
+                }
+                else
+                {
+                    m_ebusEventFunctionNames[eventThread] = Grammar::ToSafeName(AZStd::string::format("%s_%s", ebusHandling->m_handlerName.c_str(), nameAndEventThread.first.c_str()));
+                }
+            }
+
+            m_ebusHandlings.push_back(ebusHandling);
         }
 
-        void GraphToCPlusPlus::TranslateDependencies()
+        void GraphToCPlusPlus::CheckSupportedFeatures()
         {
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
+            using namespace GraphToCPlusPlusCPP;
+
+            for (const auto& ebusHandling : m_model.GetEBusHandlings())
+            {
+                CheckSupportedEBusHandling(ebusHandling);
+            }
+
+            if (!m_model.GetEventHandlings().empty())
+            {
+                AddTranslationError(nullptr, k_unsupportedEventHandling);
+            }
+
+            if (!m_model.GetNodeableParse().empty())
+            {
+                AddTranslationError(nullptr, k_unsupportedNodeable);
+            }
+
+            if (!m_model.GetOrderedDependencies().orderedAssetIds.empty())
+            {
+                AddTranslationError(nullptr, k_unsupportedDependencies);
+            }
+
+            if (!m_model.GetStaticVariablesNames().empty())
+            {
+                AddTranslationError(nullptr, k_unsupportedStaticVariables);
+            }
+
+            for (const auto& variable : m_model.GetVariables())
+            {
+                if (!m_model.GetVariableHandling(variable).empty())
+                {
+                    AddTranslationError(nullptr, AZStd::string::format(k_unsupportedVariableHandling, variable->m_name.c_str()));
+                }
+
+                if (m_model.IsUserNodeable(variable))
+                {
+                    AddTranslationError(nullptr, k_unsupportedNodeable);
+                }
+                else if (variable->m_isMember && !variable->m_isDebugOnly)
+                {
+                    if (Grammar::ParseConstructionRequirement(variable) == Grammar::VariableConstructionRequirement::None)
+                    {
+                        CheckSupportedName(nullptr, variable->m_name);
+                        m_memberVariables.push_back(variable);
+                    }
+                    else
+                    {
+                        AddTranslationError(nullptr, AZStd::string::format(k_unsupportedVariableConstruction, variable->m_name.c_str()));
+                    }
+                }
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotH()
+        void GraphToCPlusPlus::CheckSupportedName(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name)
         {
-
+            if (GraphToCPlusPlusCPP::IsReservedName(name))
+            {
+                AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedName, AZStd::string(name).c_str()));
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotCPP()
+        AZStd::string GraphToCPlusPlus::GetArgumentString(Grammar::ExecutionTreeConstPtr execution, size_t index, const AZ::BehaviorMethod& method)
         {
+            using namespace GraphToCPlusPlusCPP;
 
+            // the reflected methods require an exact type match, so arguments of other arithmetic types are cast from the graph's Number
+            const AZ::TypeId& parameterType = method.GetArgument(index)->m_typeId;
+            const AZStd::string input = GetInputString(execution, index);
+            const Data::Type inputType = GetInputType(execution, index);
+
+            if (parameterType == inputType.GetAZType())
+            {
+                return input;
+            }
+
+            const char* arithmeticTypeName = GetArithmeticTypeName(parameterType);
+
+            if (arithmeticTypeName && (inputType == Data::Type::Number() || inputType == Data::Type::Boolean()))
+            {
+                return AZStd::string::format("static_cast<%s>(%s)", arithmeticTypeName, input.c_str());
+            }
+            else if (parameterType == azrtti_typeid<AZStd::string_view>() && inputType == Data::Type::String())
+            {
+                return AZStd::string::format("AZStd::string_view(%s)", input.c_str());
+            }
+
+            AddTranslationError(execution, AZStd::string::format(k_unsupportedArgument, Data::GetName(inputType).c_str(), index, method.m_name.c_str()));
+            return input;
         }
 
-        void GraphToCPlusPlus::TranslateDestruction()
+        AZStd::string GraphToCPlusPlus::GetConvertedString(Grammar::ExecutionTreeConstPtr execution, const AZStd::string& source, const Data::Type& sourceType, const Grammar::ConversionByIndex& conversions, size_t index)
         {
+            auto conversion = conversions.find(index);
+            if (conversion == conversions.end() || conversion->second == sourceType)
+            {
+                return source;
+            }
+
+            if (conversion->second == Data::Type::Boolean() && sourceType == Data::Type::Number())
+            {
+                return AZStd::string::format("(%s != 0.0)", source.c_str());
+            }
+            else if (conversion->second == Data::Type::Number() && sourceType == Data::Type::Boolean())
+            {
+                return AZStd::string::format("(%s ? 1.0 : 0.0)", source.c_str());
+            }
 
+            AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedConversion, Data::GetName(sourceType).c_str(), Data::GetName(conversion->second).c_str()));
+            return source;
         }
-                
-        void GraphToCPlusPlus::TranslateHandlers()
+
+        AZStd::string GraphToCPlusPlus::GetInputString(Grammar::ExecutionTreeConstPtr execution, size_t index)
         {
+            const auto& input = execution->GetInput(index).m_value;
+
+            if (m_omittedParameters.count(input) > 0)
+            {
+                AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedOmittedParameter, input->m_name.c_str(), Data::GetName(input->m_datum.GetType()).c_str()));
+            }
 
+            const bool isNamed = input->m_source != execution || input->m_requiresCreationFunction;
+            const AZStd::string source = isNamed ? input->m_name : GetValueString(execution, input);
+            return GetConvertedString(execution, source, input->m_datum.GetType(), execution->GetConversions(), index);
         }
 
-        void GraphToCPlusPlus::TranslateNamespaceOpen()
+        Data::Type GraphToCPlusPlus::GetInputType(Grammar::ExecutionTreeConstPtr execution, size_t index) const
         {
-            OpenNamespace(m_dotH, "ScriptCanvas");
-            OpenNamespace(m_dotH, GetAutoNativeNamespace());
-            OpenNamespace(m_dotCPP, "ScriptCanvas");
-            OpenNamespace(m_dotCPP, GetAutoNativeNamespace());
+            const auto& conversions = execution->GetConversions();
+            auto conversion = conversions.find(index);
+            return conversion != conversions.end() ? conversion->second : execution->GetInput(index).m_value->m_datum.GetType();
         }
 
-        void GraphToCPlusPlus::TranslateNamespaceClose()
+        AZStd::string GraphToCPlusPlus::GetReturnTypeName(Grammar::ExecutionTreeConstPtr execution)
         {
-            CloseNamespace(m_dotH, "ScriptCanvas");
-            CloseNamespace(m_dotH, GetAutoNativeNamespace());
-            CloseNamespace(m_dotCPP, "ScriptCanvas");
-            CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            if (!IsReturnValueWritten(execution))
+            {
+                return "void";
+            }
+            else if (execution->GetReturnValueCount() == 1)
+            {
+                return GetTypeName(execution, execution->GetReturnValue(0).second->m_source);
+            }
+
+            AZStd::string typeName = "AZStd::tuple<";
+
+            for (size_t index = 0; index < execution->GetReturnValueCount(); ++index)
+            {
+                if (index > 0)
+                {
+                    typeName += ", ";
+                }
+
+                typeName += GetTypeName(execution, execution->GetReturnValue(index).second->m_source);
+            }
+
+            typeName += ">";
+            return typeName;
         }
 
-        void GraphToCPlusPlus::TranslateStartNode()
+        AZStd::string GraphToCPlusPlus::GetTypeName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
         {
-            // write a start function
-            const Node* startNode = nullptr;
-            
-            if (startNode)
+            if (const char* typeName = GraphToCPlusPlusCPP::GetDataTypeName(variable->m_datum.GetType().GetType()))
             {
-                { // .h
-                    m_dotH.WriteIndent();
-                    m_dotH.WriteLine("public: static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
-                }
-                
-                { // .cpp
-                    m_dotCPP.WriteIndent();
-                    m_dotCPP.WriteLine("void %s::%s(const RuntimeContext& context)", GetGraphName().data(), Grammar::k_OnGraphStartFunctionName);
-                    OpenScope(m_dotCPP);
-                    {
-                        m_dotCPP.WriteIndent();
-                        m_dotCPP.WriteLine("AZ_TracePrintf(\"ScriptCanvas\", \"This call wasn't generated from parsing a print node!\");");
-                        m_dotCPP.WriteLine("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, \"This call wasn't generated from parsing a print node!\");");
-                        // get the related function call and call it
-                        // with possible appropriate variables
-                    }
-                    CloseScope(m_dotCPP);
-                }
+                return typeName;
             }
+
+            AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedType, variable->m_name.c_str(), Data::GetName(variable->m_datum.GetType()).c_str()));
+            return "void";
         }
 
-        void GraphToCPlusPlus::TranslateVariables()
+        AZStd::string GraphToCPlusPlus::GetValueString(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
         {
+            using namespace GraphToCPlusPlusCPP;
+
+            const Datum& datum = variable->m_datum;
+
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::AABB:
+            {
+                const auto value = datum.GetAs<Data::AABBType>();
+                return AZStd::string::format("Data::AABBType::CreateFromMinMax(%s, %s)"
+                    , ToVector3String(value->GetMin()).c_str()
+                    , ToVector3String(value->GetMax()).c_str());
+            }
+
+            case Data::eType::Boolean:
+                return *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+
+            case Data::eType::Color:
+            {
+                const auto value = datum.GetAs<Data::ColorType>();
+                return AZStd::string::format("Data::ColorType(%s, %s, %s, %s)"
+                    , ToFloatString(value->GetR()).c_str()
+                    , ToFloatString(value->GetG()).c_str()
+                    , ToFloatString(value->GetB()).c_str()
+                    , ToFloatString(value->GetA()).c_str());
+            }
+
+            case Data::eType::CRC:
+                return AZStd::string::format("Data::CRCType(%uu)", static_cast<AZ::u32>(*datum.GetAs<Data::CRCType>()));
+
+            case Data::eType::EntityID:
+            {
+                if (Grammar::IsEntityIdThatRequiresRuntimeRemap(variable))
+                {
+                    AddTranslationError(execution, k_unsupportedEntityId);
+                    return "Data::EntityIDType()";
+                }
+
+                const Data::EntityIDType& value = *datum.GetAs<Data::EntityIDType>();
+                return value.IsValid() ? EntityIdValueToString(value, m_configuration) : "Data::EntityIDType()";
+            }
+
+            case Data::eType::Matrix3x3:
+            {
+                Data::Vector3Type row0, row1, row2;
+                datum.GetAs<Data::Matrix3x3Type>()->GetRows(&row0, &row1, &row2);
+                return AZStd::string::format("Data::Matrix3x3Type::CreateFromRows(%s, %s, %s)"
+                    , ToVector3String(row0).c_str()
+                    , ToVector3String(row1).c_str()
+                    , ToVector3String(row2).c_str());
+            }
+
+            case Data::eType::Matrix4x4:
+            {
+                Data::Vector4Type row0, row1, row2, row3;
+                datum.GetAs<Data::Matrix4x4Type>()->GetRows(&row0, &row1, &row2, &row3);
+                return AZStd::string::format("Data::Matrix4x4Type::CreateFromRows(%s, %s, %s, %s)"
+                    , ToVector4String(row0).c_str()
+                    , ToVector4String(row1).c_str()
+                    , ToVector4String(row2).c_str()
+                    , ToVector4String(row3).c_str());
+            }
+
+            case Data::eType::Number:
+                return ToFloatingPointString(*datum.GetAs<Data::NumberType>(), false);
+
+            case Data::eType::OBB:
+            {
+                const auto value = datum.GetAs<Data::OBBType>();
+                return AZStd::string::format("Data::OBBType::CreateFromPositionRotationAndHalfLengths(%s, %s, %s)"
+                    , ToVector3String(value->GetPosition()).c_str()
+                    , ToQuaternionString(value->GetRotation()).c_str()
+                    , ToVector3String(value->GetHalfLengths()).c_str());
+            }
+
+            case Data::eType::Plane:
+            {
+                const AZ::Vector4& coefficients = datum.GetAs<Data::PlaneType>()->GetPlaneEquationCoefficients();
+                return AZStd::string::format("Data::PlaneType::CreateFromCoefficients(%s, %s, %s, %s)"
+                    , ToFloatString(coefficients.GetX()).c_str()
+                    , ToFloatString(coefficients.GetY()).c_str()
+                    , ToFloatString(coefficients.GetZ()).c_str()
+                    , ToFloatString(coefficients.GetW()).c_str());
+            }
 
+            case Data::eType::Quaternion:
+                return ToQuaternionString(*datum.GetAs<Data::QuaternionType>());
+
+            case Data::eType::String:
+                return AZStd::string::format("Data::StringType(%s)", ToStringLiteral(*datum.GetAs<Data::StringType>()).c_str());
+
+            case Data::eType::Transform:
+            {
+                const auto value = datum.GetAs<Data::TransformType>();
+                return AZStd::string::format("Data::TransformType(%s, %s, %s)"
+                    , ToVector3String(value->GetTranslation()).c_str()
+                    , ToQuaternionString(value->GetRotation()).c_str()
+                    , ToFloatString(value->GetUniformScale()).c_str());
+            }
+
+            case Data::eType::Vector2:
+            {
+                const auto value = datum.GetAs<Data::Vector2Type>();
+                return AZStd::string::format("Data::Vector2Type(%s, %s)"
+                    , ToFloatString(value->GetX()).c_str()
+                    , ToFloatString(value->GetY()).c_str());
+            }
+
+            case Data::eType::Vector3:
+                return ToVector3String(*datum.GetAs<Data::Vector3Type>());
+
+            case Data::eType::Vector4:
+                return ToVector4String(*datum.GetAs<Data::Vector4Type>());
+
+            default:
+                AddTranslationError(execution, AZStd::string::format(k_unsupportedType, variable->m_name.c_str(), Data::GetName(datum.GetType()).c_str()));
+                return "";
+            }
         }
 
-        void GraphToCPlusPlus::WriteHeader()
+        bool GraphToCPlusPlus::IsReturnValueWritten(Grammar::ExecutionTreeConstPtr execution) const
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
+            return execution->HasReturnValues() && !execution->HasExplicitUserOutCalls();
         }
 
-        void GraphToCPlusPlus::WriteHeaderDotCPP()
+        void GraphToCPlusPlus::TranslateClassClose()
         {
-            WriteCopyright(m_dotCPP);
-            m_dotCPP.WriteNewLine();
-            WriteDoNotModify(m_dotCPP);
-            m_dotCPP.WriteNewLine();
-            m_dotCPP.WriteLine("#include \"precompiled.h\"");
-            m_dotCPP.WriteLine("#include \"%s.h\"", GetGraphName().data());
-            m_dotCPP.WriteNewLine();
+            // the class declaration needs the trailing semicolon the scope doesn't write
+            m_dotH.Outdent();
+            m_dotH.WriteLineIndented("};");
         }
 
-        void GraphToCPlusPlus::WriteHeaderDotH()
+        void GraphToCPlusPlus::TranslateClassOpen()
         {
-            WriteCopyright(m_dotH);
-            m_dotH.WriteNewLine();
-            m_dotH.WriteLine("#pragma once");
-            m_dotH.WriteNewLine();
-            WriteDoNotModify(m_dotH);
+            m_dotH.WriteLineIndented("class %s", m_className.c_str());
+            m_dotH.WriteLineIndented("    : public NativeNodeable");
+            OpenScope(m_dotH);
+            m_dotH.Outdent();
+            m_dotH.WriteLineIndented("public:");
+            m_dotH.Indent();
+            m_dotH.WriteLineIndented(AZStd::string::format("AZ_RTTI(%s, \"%s\", NativeNodeable);"
+                , m_className.c_str()
+                , AZ::Uuid::CreateName(AZStd::string::format("ScriptCanvas::AutoNative::%s", m_className.c_str()).c_str()).ToString<AZStd::string>().c_str()));
+            m_dotH.WriteLineIndented("AZ_CLASS_ALLOCATOR(%s, AZ::SystemAllocator, 0);", m_className.c_str());
             m_dotH.WriteNewLine();
-            m_dotH.WriteLine("#include <Execution/NativeHostDeclarations.h>");
+            m_dotH.WriteLineIndented("static void Register();");
+            m_dotH.WriteLineIndented("static void Unregister();");
             m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("%s() = default;", m_className.c_str());
+            m_dotH.WriteLineIndented("~%s() override = default;", m_className.c_str());
         }
 
-    } 
-} 
+        void GraphToCPlusPlus::TranslateConstruction()
+        {
+            using namespace GraphToCPlusPlusCPP;
+
+            m_dotH.WriteNewLine();
+            m_dotH.Outdent();
+            m_dotH.WriteLineIndented("protected:");
+            m_dotH.Indent();
+            m_dotH.WriteLineIndented("void OnInitializeExecutionState() override;");
+            m_dotH.WriteNewLine();
+
+            if (!m_ebusHandlings.empty())
+            {
+                m_dotH.WriteLineIndented("void OnDeactivate() override;");
+                m_dotH.WriteNewLine();
+            }
+
+            m_dotH.WriteLineIndented("size_t GetRequiredOutCount() const override;");
+
+            // the member variables are initialized here, since some of their values depend on the execution state
+            m_dotCPP.WriteLineIndented("void %s::OnInitializeExecutionState()", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+            {
+                for (const auto& variable : m_memberVariables)
+                {
+                    m_dotCPP.WriteLineIndented(AZStd::string::format("%s = %s;", variable->m_name.c_str(), GetValueString(nullptr, variable).c_str()));
+                }
+
+                for (size_t index = 0; index < m_reflectedMethods.size(); ++index)
+                {
+                    const Nodes::Core::Method& node = *m_reflectedMethods[index].m_node;
+                    m_dotCPP.WriteLineIndented(AZStd::string::format("%s%zu = FindNativeMethod(MethodType::%s, %s, %s);"
+                        , k_reflectedMethodName
+                        , index
+                        , GetMethodTypeName(node.GetMethodType())
+                        , ToStringLiteral(node.GetRawMethodClassName()).c_str()
+                        , ToStringLiteral(node.GetName()).c_str()));
+                }
+
+                // the handlers are created last, since the address they connect to is a member variable
+                for (const auto& ebusHandling : m_ebusHandlings)
+                {
+                    TranslateEBusHandlerCreation(ebusHandling);
+                }
+            }
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+
+            if (!m_ebusHandlings.empty())
+            {
+                m_dotCPP.WriteLineIndented("void %s::OnDeactivate()", m_className.c_str());
+                OpenFunctionBlock(m_dotCPP);
+                for (const auto& ebusHandling : m_ebusHandlings)
+                {
+                    m_dotCPP.WriteLineIndented("%s.reset();", ebusHandling->m_handlerName.c_str());
+                }
+                CloseFunctionBlock(m_dotCPP);
+                m_dotCPP.WriteNewLine();
+            }
+
+            m_dotCPP.WriteLineIndented("size_t %s::GetRequiredOutCount() const", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteLineIndented("return %zu;", m_requiredOutCount);
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::TranslateDependencies()
+        {
+            TranslateDependenciesDotH();
+            TranslateDependenciesDotCPP();
+        }
+
+        void GraphToCPlusPlus::TranslateDependenciesDotH()
+        {
+            if (!m_ebusHandlings.empty())
+            {
+                m_dotH.WriteLine("#include <AzCore/std/smart_ptr/unique_ptr.h>");
+            }
+
+            m_dotH.WriteLine("#include <AzCore/std/tuple.h>");
+
+            if (!m_ebusHandlings.empty())
+            {
+                m_dotH.WriteLine("#include <ScriptCanvas/Core/EBusHandler.h>");
+            }
+
+            m_dotH.WriteLine("#include <ScriptCanvas/Data/Data.h>");
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/Native/NativeNodeable.h>");
+            m_dotH.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::TranslateDependenciesDotCPP()
+        {
+            m_dotCPP.WriteLine("#include \"%s.h\"", GetGraphName().data());
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLine("#include <AzCore/Math/MathUtils.h>");
+            m_dotCPP.WriteLine("#include <AzCore/std/limits.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Core/MethodConfiguration.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/NativeHostDefinitions.h>");
+            m_dotCPP.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::TranslateEBusHandlerCreation(Grammar::EBusHandlingConstPtr ebusHandling)
+        {
+            const char* handlerName = ebusHandling->m_handlerName.c_str();
+
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLineIndented("%s.reset(EBusHandler::Create(GetExecutionState(), %s));", handlerName, GraphToCPlusPlusCPP::ToStringLiteral(ebusHandling->m_ebusName).c_str());
+
+            for (const auto& nameAndEventThread : ebusHandling->m_events)
+            {
+                const Grammar::ExecutionTreeConstPtr& eventThread = nameAndEventThread.second;
+
+                if (m_ebusEventFunctionNames.count(eventThread) > 0)
+                {
+                    WriteEBusEventOut(ebusHandling, eventThread, *ebusHandling->m_node->GetEventIndex(nameAndEventThread.first));
+                }
+            }
+
+            if (!ebusHandling->m_startsConnected)
+            {
+                return;
+            }
+
+            if (ebusHandling->m_isAddressed)
+            {
+                OpenScope(m_dotCPP);
+                m_dotCPP.WriteLineIndented("AZ::BehaviorValueParameter address(&%s);", ebusHandling->m_startingAdress->m_name.c_str());
+                m_dotCPP.WriteLineIndented("%s->ConnectTo(address);", handlerName);
+                CloseScope(m_dotCPP);
+            }
+            else
+            {
+                m_dotCPP.WriteLineIndented("%s->Connect();", handlerName);
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution)
+        {
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto symbol = execution->GetSymbol();
+
+            switch (symbol)
+            {
+            case Grammar::Symbol::Break:
+                m_dotCPP.WriteLineIndented("break;");
+                break;
+
+            case Grammar::Symbol::UserOut:
+                TranslateExecutionTreeUserOutCall(execution);
+                break;
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::IsNull:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                m_dotCPP.WriteLineIndented(AZStd::string::format("[[maybe_unused]] %s %s = %s;"
+                    , GetTypeName(execution, variable).c_str()
+                    , variable->m_name.c_str()
+                    , GetValueString(execution, variable).c_str()));
+                break;
+            }
+
+            // these translate their own children, in their own scopes
+            case Grammar::Symbol::Cycle:
+            case Grammar::Symbol::Switch:
+                TranslateExecutionTreeSwitch(execution);
+                return;
+
+            case Grammar::Symbol::IfCondition:
+                TranslateExecutionTreeIfCondition(execution);
+                return;
+
+            case Grammar::Symbol::While:
+                TranslateExecutionTreeWhile(execution);
+                return;
+
+            case Grammar::Symbol::ForEach:
+            case Grammar::Symbol::RandomSwitch:
+                AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedSymbol, Grammar::GetSymbolName(symbol)));
+                return;
+
+            default:
+                break;
+            }
+
+            TranslateExecutionTreeChildren(execution);
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCPP;
+
+            if (execution->GetNodeable())
+            {
+                AddTranslationError(execution, k_unsupportedNodeable);
+                return;
+            }
+
+            Grammar::VariableConstPtr result;
+
+            if (execution->GetChildrenCount() == 1)
+            {
+                const auto& output = execution->GetChild(0).m_output;
+
+                if (output.size() > 1)
+                {
+                    AddTranslationError(execution, k_unsupportedMultipleOutput);
+                    return;
+                }
+                else if (!output.empty())
+                {
+                    result = output[0].second->m_source;
+                }
+            }
+
+            const bool isExpression = Grammar::IsLogicalExpression(execution)
+                || Grammar::IsVariableGet(execution)
+                || Grammar::IsVariableSet(execution)
+                || execution->GetSymbol() == Grammar::Symbol::VariableAssignment
+                || Grammar::IsWrittenMathExpression(execution)
+                || Grammar::IsOperatorArithmetic(execution);
+
+            // an expression that isn't written anywhere has no effect, and would only produce a compiler warning
+            if (!isExpression || result)
+            {
+                m_dotCPP.WriteIndent();
+
+                if (result)
+                {
+                    WriteVariableWrite(execution, result);
+                }
+
+                if (Grammar::IsLogicalExpression(execution))
+                {
+                    WriteLogicalExpression(execution);
+                }
+                else if (Grammar::IsVariableGet(execution))
+                {
+                    m_dotCPP.Write(execution->GetInput(0).m_value->m_name);
+                }
+                else if (Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+                {
+                    WriteFunctionCallInput(execution);
+                }
+                else if (Grammar::IsWrittenMathExpression(execution))
+                {
+                    WriteWrittenMathExpression(execution);
+                }
+                else if (Grammar::IsOperatorArithmetic(execution))
+                {
+                    WriteOperatorArithmetic(execution);
+                }
+                else if (Grammar::IsExecutedPropertyExtraction(execution)
+                    || Grammar::IsEventConnectCall(execution)
+                    || Grammar::IsEventDisconnectCall(execution)
+                    || Grammar::IsGlobalPropertyRead(execution)
+                    || Grammar::IsClassPropertyRead(execution)
+                    || Grammar::IsClassPropertyWrite(execution)
+                    || Grammar::IsUserFunctionCall(execution)
+                    || (execution->GetId().m_node && execution->GetId().m_node->ConvertsInputToStrings()))
+                {
+                    AddTranslationError(execution, AZStd::string::format(k_unsupportedFunctionCall, execution->GetName().c_str()));
+                }
+                else
+                {
+                    WriteFunctionCallOfNode(execution, result);
+                }
+
+                m_dotCPP.WriteLine(";");
+            }
+
+            WriteOutputAssignments(execution);
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetInputCount() == 0)
+            {
+                AddTranslationError(execution, GraphToCPlusPlusCPP::k_unsupportedMissingInput);
+                return;
+            }
+
+            m_dotCPP.WriteIndented("if (");
+            m_dotCPP.Write(GetInputString(execution, 0));
+            m_dotCPP.WriteLine(")");
+
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                if (childIndex > 0)
+                {
+                    m_dotCPP.WriteLineIndented("else");
+                }
+
+                OpenScope(m_dotCPP);
+                {
+                    const auto& child = execution->GetChild(childIndex);
+
+                    if (child.m_execution && !child.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+                }
+                CloseScope(m_dotCPP);
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeSwitch(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetInputCount() == 0)
+            {
+                AddTranslationError(execution, GraphToCPlusPlusCPP::k_unsupportedMissingInput);
+                return;
+            }
+
+            const bool isCycle = execution->GetSymbol() == Grammar::Symbol::Cycle;
+            const AZStd::string control = GetInputString(execution, 0);
+            const size_t childCount = execution->GetChildrenCount();
+            bool isFirstCase = true;
+
+            for (size_t childIndex = 0; childIndex < childCount; ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+                const bool isChildTranslated = child.m_execution && !child.m_execution->IsInternalOut();
+
+                // a cycle has to advance even when the current out isn't connected
+                if (!child.m_slot || (!isChildTranslated && !isCycle))
+                {
+                    continue;
+                }
+
+                m_dotCPP.WriteLineIndented(AZStd::string::format("%sif (%s == %s)"
+                    , isFirstCase ? "" : "else "
+                    , control.c_str()
+                    , Grammar::SlotNameToIndexString(*child.m_slot).c_str()));
+                isFirstCase = false;
+
+                OpenScope(m_dotCPP);
+                {
+                    if (isCycle)
+                    {
+                        const AZStd::string& cycle = execution->GetInput(0).m_value->m_name;
+                        m_dotCPP.WriteLineIndented(AZStd::string::format("%s = %s + 1.0 >= %zu.0 ? 0.0 : %s + 1.0;", cycle.c_str(), cycle.c_str(), childCount, cycle.c_str()));
+                    }
+
+                    if (isChildTranslated)
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+                }
+                CloseScope(m_dotCPP);
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeUserOutCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            auto outCallIndexOptional = execution->GetOutCallIndex();
+            if (!outCallIndexOptional)
+            {
+                AddError(nullptr, aznew Internal::ParseError(execution->GetNodeId(), "Execution did not return required out call index"));
+                return;
+            }
+
+            const size_t outIndex = *outCallIndexOptional;
+            m_requiredOutCount = AZStd::max(m_requiredOutCount, outIndex + 1);
+
+            m_dotCPP.WriteIndented("ExecutionOut(%zu", outIndex);
+
+            if (execution->GetInputCount() > 0)
+            {
+                m_dotCPP.Write(", ");
+                WriteFunctionCallInput(execution);
+            }
+
+            m_dotCPP.WriteLine("); // %s", execution->GetName().c_str());
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeWhile(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetInputCount() == 0)
+            {
+                AddTranslationError(execution, GraphToCPlusPlusCPP::k_unsupportedMissingInput);
+                return;
+            }
+
+            m_dotCPP.WriteIndented("while (");
+            m_dotCPP.Write(GetInputString(execution, 0));
+            m_dotCPP.WriteLine(")");
+
+            // the first child is the loop body, the others execute once the loop is done
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+                const bool isChildTranslated = child.m_execution && !child.m_execution->IsInternalOut();
+
+                if (childIndex == 0)
+                {
+                    OpenScope(m_dotCPP);
+
+                    if (isChildTranslated)
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+
+                    CloseScope(m_dotCPP);
+                }
+                else if (isChildTranslated)
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateFunction(Grammar::ExecutionTreeConstPtr execution)
+        {
+            TranslateFunctionDefinition(execution);
+            OpenFunctionBlock(m_dotCPP);
+            TranslateFunctionBlock(execution);
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::TranslateFunctionBlock(Grammar::ExecutionTreeConstPtr functionBlock)
+        {
+            WriteOutputAssignments(functionBlock);
+            WriteLocalVariableInitialization(functionBlock);
+            WriteReturnValueInitialization(functionBlock);
+
+            if (functionBlock->GetChildrenCount() > 0 && functionBlock->GetChild(0).m_execution)
+            {
+                TranslateExecutionTreeEntry(functionBlock->GetChild(0).m_execution);
+            }
+
+            WriteReturnStatement(functionBlock);
+        }
+
+        void GraphToCPlusPlus::TranslateFunctionDefinition(Grammar::ExecutionTreeConstPtr execution)
+        {
+            auto ebusEventFunctionName = m_ebusEventFunctionNames.find(execution);
+            const bool isEBusEvent = ebusEventFunctionName != m_ebusEventFunctionNames.end();
+            // the start is called by ExecutionStateNative, through the override of NativeNodeable::OnGraphStart
+            const bool isStart = execution->IsStart();
+            const AZStd::string& name = isEBusEvent ? ebusEventFunctionName->second : execution->GetName();
+
+            if (isStart)
+            {
+                AZ_Assert(name == Grammar::k_OnGraphStartFunctionName, "the start of a graph translated to C++ must override NativeNodeable::OnGraphStart");
+            }
+            else
+            {
+                CheckSupportedName(execution, name);
+            }
+
+            AZStd::string declarationParameters;
+            AZStd::string definitionParameters;
+
+            // the execution state a start function is handed in Lua is already available to the nodeable
+            if (!isStart && execution->GetChildrenCount() > 0)
+            {
+                const auto& output = execution->GetChild(0).m_output;
+                // the same parameters as the Lua translation, where the first output of the functions of graphs that aren't user
+                // nodeables is not a parameter, while the event handlers take all the outputs of the event
+                size_t outputIndex = !isEBusEvent && !execution->IsPure() && !m_model.IsUserNodeable() ? 1 : 0;
+
+                for (; outputIndex < output.size(); ++outputIndex)
+                {
+                    const auto& parameter = output[outputIndex].second->m_source;
+
+                    // an event argument of a type the translation can't name is only an error if the event handler reads it
+                    if (isEBusEvent && !GraphToCPlusPlusCPP::GetDataTypeName(parameter->m_datum.GetType().GetType()))
+                    {
+                        m_omittedParameters.insert(parameter);
+                        continue;
+                    }
+
+                    CheckSupportedName(execution, parameter->m_name);
+                    const AZStd::string parameterType = GetTypeName(execution, parameter);
+
+                    if (!declarationParameters.empty())
+                    {
+                        declarationParameters += ", ";
+                        definitionParameters += ", ";
+                    }
+
+                    declarationParameters += AZStd::string::format("%s %s", parameterType.c_str(), parameter->m_name.c_str());
+                    definitionParameters += AZStd::string::format("[[maybe_unused]] %s %s", parameterType.c_str(), parameter->m_name.c_str());
+                }
+            }
+
+            const AZStd::string returnType = GetReturnTypeName(execution);
+            m_dotH.WriteLineIndented(AZStd::string::format("%s %s(%s)%s;", returnType.c_str(), name.c_str(), declarationParameters.c_str(), isStart ? " override" : ""));
+            m_dotCPP.WriteLineIndented(AZStd::string::format("%s %s::%s(%s)", returnType.c_str(), m_className.c_str(), name.c_str(), definitionParameters.c_str()));
+        }
+
+        void GraphToCPlusPlus::TranslateFunctions()
+        {
+            m_dotH.WriteNewLine();
+
+            if (auto start = m_model.GetStart())
+            {
+                TranslateFunction(start);
+            }
+
+            for (auto function : m_model.GetFunctions())
+            {
+                TranslateFunction(function);
+            }
+
+            for (const auto& ebusHandling : m_ebusHandlings)
+            {
+                for (const auto& nameAndEventThread : ebusHandling->m_events)
+                {
+                    if (m_ebusEventFunctionNames.count(nameAndEventThread.second) > 0)
+                    {
+                        TranslateFunction(nameAndEventThread.second);
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateNamespaceOpen()
+        {
+            OpenNamespace(m_dotH, "ScriptCanvas");
+            OpenNamespace(m_dotH, GetAutoNativeNamespace());
+            OpenNamespace(m_dotCPP, "ScriptCanvas");
+            OpenNamespace(m_dotCPP, GetAutoNativeNamespace());
+        }
+
+        void GraphToCPlusPlus::TranslateNamespaceClose()
+        {
+            CloseNamespace(m_dotH, GetAutoNativeNamespace());
+            CloseNamespace(m_dotH, "ScriptCanvas");
+            CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCPP, "ScriptCanvas");
+        }
+
+        void GraphToCPlusPlus::TranslateRegistration()
+        {
+            // the nodeable is registered for the asset of the graph, which ExecutionState::Create looks it up by
+            const AZStd::string graphAssetId = AZStd::string::format("AZ::Uuid(\"%s\")", m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>().c_str());
+
+            m_dotCPP.WriteLineIndented("void %s::Register()", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteLineIndented(AZStd::string::format("RegisterNativeNodeable(%s, []() -> NativeNodeable* { return aznew %s(); });", graphAssetId.c_str(), m_className.c_str()));
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+
+            m_dotCPP.WriteLineIndented("void %s::Unregister()", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteLineIndented(AZStd::string::format("UnregisterNativeNodeable(%s);", graphAssetId.c_str()));
+            CloseFunctionBlock(m_dotCPP);
+        }
+
+        void GraphToCPlusPlus::TranslateVariables()
+        {
+            if (m_memberVariables.empty() && m_reflectedMethods.empty() && m_ebusHandlings.empty())
+            {
+                return;
+            }
+
+            m_dotH.WriteNewLine();
+            m_dotH.Outdent();
+            m_dotH.WriteLineIndented("private:");
+            m_dotH.Indent();
+
+            for (const auto& variable : m_memberVariables)
+            {
+                m_dotH.WriteLineIndented(AZStd::string::format("%s %s;", GetTypeName(nullptr, variable).c_str(), variable->m_name.c_str()));
+            }
+
+            for (size_t index = 0; index < m_reflectedMethods.size(); ++index)
+            {
+                m_dotH.WriteLineIndented("const AZ::BehaviorMethod* %s%zu = nullptr;", GraphToCPlusPlusCPP::k_reflectedMethodName, index);
+            }
+
+            for (const auto& ebusHandling : m_ebusHandlings)
+            {
+                m_dotH.WriteLineIndented("AZStd::unique_ptr<EBusHandler> %s;", ebusHandling->m_handlerName.c_str());
+            }
+        }
+
+        void GraphToCPlusPlus::WriteEBusEventOut(Grammar::EBusHandlingConstPtr ebusHandling, Grammar::ExecutionTreeConstPtr eventThread, size_t eventIndex)
+        {
+            // the handler calls the out with the arguments of the event, which are read in the order of the outputs of the event
+            AZStd::string arguments;
+
+            if (eventThread->GetChildrenCount() > 0)
+            {
+                const auto& output = eventThread->GetChild(0).m_output;
+
+                for (size_t outputIndex = 0; outputIndex < output.size(); ++outputIndex)
+                {
+                    const auto& parameter = output[outputIndex].second->m_source;
+
+                    if (m_omittedParameters.count(parameter) == 0)
+                    {
+                        arguments += arguments.empty() ? "" : ", ";
+                        arguments += AZStd::string::format("ReadNativeArgument<%s>(arguments[%zu])", GetTypeName(eventThread, parameter).c_str(), outputIndex);
+                    }
+                }
+            }
+
+            const char* handlerName = ebusHandling->m_handlerName.c_str();
+            m_dotCPP.WriteLineIndented("%s->HandleEvent(%zu);", handlerName, eventIndex);
+            m_dotCPP.WriteLineIndented(AZStd::string::format("%s->SetExecutionOut(%zu, [this](AZ::BehaviorValueParameter*, %sAZ::BehaviorValueParameter* arguments, int)"
+                , handlerName
+                , eventIndex
+                , arguments.empty() ? "[[maybe_unused]] " : ""));
+            OpenScope(m_dotCPP);
+            m_dotCPP.WriteLineIndented("%s(%s);", m_ebusEventFunctionNames[eventThread].c_str(), arguments.c_str());
+            m_dotCPP.Outdent();
+            m_dotCPP.WriteLineIndented("});");
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution)
+        {
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                if (index > 0)
+                {
+                    m_dotCPP.Write(", ");
+                }
+
+                m_dotCPP.Write(GetInputString(execution, index));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr result)
+        {
+            using namespace GraphToCPlusPlusCPP;
+
+            const auto node = azrtti_cast<const Nodes::Core::Method*>(execution->GetId().m_node);
+            const AZ::BehaviorMethod* method = node ? node->GetMethod() : nullptr;
+            if (!method)
+            {
+                AddTranslationError(execution, AZStd::string::format(k_unsupportedFunctionCall, execution->GetName().c_str()));
+                return;
+            }
+
+            AZ::CheckedOperationInfo checkedOperationInfo;
+            AZStd::string exposedName;
+            Grammar::LexicalScope lexicalScope;
+
+            if (node->IsMethodOverloaded()
+                || node->BranchesOnResult()
+                || node->GetCheckedOperationInfo(checkedOperationInfo, exposedName, lexicalScope)
+                || method->GetNumArguments() != execution->GetInputCount())
+            {
+                AddTranslationError(execution, AZStd::string::format(k_unsupportedMethod, method->m_name.c_str()));
+                return;
+            }
+
+            AZStd::string call = AZStd::string::format("%s%zu", k_reflectedMethodName, AddReflectedMethod(*node, *method));
+
+            for (size_t index = 0; index < method->GetNumArguments(); ++index)
+            {
+                call += ", ";
+                call += GetArgumentString(execution, index, *method);
+            }
+
+            if (!result)
+            {
+                m_dotCPP.Write(AZStd::string::format("CallNativeMethod(%s)", call.c_str()));
+                return;
+            }
+
+            const AZ::TypeId& resultType = method->HasResult() ? method->GetResult()->m_typeId : AZ::TypeId::CreateNull();
+            const Data::Type outputType = result->m_datum.GetType();
+            const char* arithmeticTypeName = GetArithmeticTypeName(resultType);
+
+            if (method->HasResult() && resultType == outputType.GetAZType())
+            {
+                m_dotCPP.Write(AZStd::string::format("CallNativeMethodResult<%s>(%s)", GetTypeName(execution, result).c_str(), call.c_str()));
+            }
+            else if (arithmeticTypeName && (outputType == Data::Type::Number() || outputType == Data::Type::Boolean()))
+            {
+                m_dotCPP.Write(AZStd::string::format("static_cast<%s>(CallNativeMethodResult<%s>(%s))", GetTypeName(execution, result).c_str(), arithmeticTypeName, call.c_str()));
+            }
+            else if (resultType == azrtti_typeid<AZStd::string_view>() && outputType == Data::Type::String())
+            {
+                m_dotCPP.Write(AZStd::string::format("Data::StringType(CallNativeMethodResult<AZStd::string_view>(%s))", call.c_str()));
+            }
+            else
+            {
+                AddTranslationError(execution, AZStd::string::format(k_unsupportedMethodResult, method->m_name.c_str(), Data::GetName(outputType).c_str()));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteHeader()
+        {
+            WriteHeaderDotH();
+            WriteHeaderDotCPP();
+        }
+
+        void GraphToCPlusPlus::WriteHeaderDotCPP()
+        {
+            WriteCopyright(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+            WriteDoNotModify(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::WriteHeaderDotH()
+        {
+            WriteCopyright(m_dotH);
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#pragma once");
+            m_dotH.WriteNewLine();
+            WriteDoNotModify(m_dotH);
+            m_dotH.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto& localDeclaredVariables = m_model.GetLocalVariables(execution))
+            {
+                for (const auto& variable : *localDeclaredVariables)
+                {
+                    const auto requirement = Grammar::ParseConstructionRequirement(variable);
+
+                    if (requirement == Grammar::VariableConstructionRequirement::None || (requirement != Grammar::VariableConstructionRequirement::Static && !execution->IsStart()))
+                    {
+                        m_dotCPP.WriteLineIndented(AZStd::string::format("[[maybe_unused]] %s %s = %s;"
+                            , GetTypeName(execution, variable).c_str()
+                            , variable->m_name.c_str()
+                            , GetValueString(execution, variable).c_str()));
+                    }
+                    else
+                    {
+                        AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedVariableConstruction, variable->m_name.c_str()));
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCPP;
+
+            const auto symbol = execution->GetSymbol();
+
+            if (symbol == Grammar::Symbol::IsNull)
+            {
+                AddTranslationError(execution, k_unsupportedIsNull);
+            }
+            else if (symbol == Grammar::Symbol::LogicalNOT)
+            {
+                m_dotCPP.Write("!");
+                m_dotCPP.Write(GetInputString(execution, 0));
+            }
+            else if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                m_dotCPP.Write(AZStd::string::format("%sAZ::IsClose(%s, %s, %s)"
+                    , symbol == Grammar::Symbol::CompareEqual ? "" : "!"
+                    , GetInputString(execution, 0).c_str()
+                    , GetInputString(execution, 1).c_str()
+                    , k_floatingPointEqualityTolerance));
+            }
+            else
+            {
+                const char* operatorString = nullptr;
+
+                switch (symbol)
+                {
+                case Grammar::Symbol::CompareEqual:
+                    operatorString = " == ";
+                    break;
+                case Grammar::Symbol::CompareGreater:
+                    operatorString = " > ";
+                    break;
+                case Grammar::Symbol::CompareGreaterEqual:
+                    operatorString = " >= ";
+                    break;
+                case Grammar::Symbol::CompareLess:
+                    operatorString = " < ";
+                    break;
+                case Grammar::Symbol::CompareLessEqual:
+                    operatorString = " <= ";
+                    break;
+                case Grammar::Symbol::CompareNotEqual:
+                    operatorString = " != ";
+                    break;
+                case Grammar::Symbol::LogicalAND:
+                    operatorString = " && ";
+                    break;
+                case Grammar::Symbol::LogicalOR:
+                    operatorString = " || ";
+                    break;
+                default:
+                    AddTranslationError(execution, AZStd::string::format(k_unsupportedSymbol, Grammar::GetSymbolName(symbol)));
+                    return;
+                }
+
+                m_dotCPP.Write(GetInputString(execution, 0));
+                m_dotCPP.Write(AZStd::string_view(operatorString));
+                m_dotCPP.Write(GetInputString(execution, 1));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddTranslationError(execution, ParseErrors::NotEnoughInputForArithmeticOperator);
+                return;
+            }
+
+            const auto symbol = execution->GetSymbol();
+            const Data::eType type = GetInputType(execution, 0).GetType();
+            bool isSupported = type == Data::eType::Number
+                || type == Data::eType::Vector2
+                || type == Data::eType::Vector3
+                || type == Data::eType::Vector4
+                || (type == Data::eType::String && symbol == Grammar::Symbol::OperatorAddition);
+
+            for (size_t i(1); i < count && isSupported; ++i)
+            {
+                isSupported = GetInputType(execution, i).GetType() == type;
+            }
+
+            if (!isSupported)
+            {
+                AddTranslationError(execution, GraphToCPlusPlusCPP::k_unsupportedArithmetic);
+                return;
+            }
+
+            AZStd::string_view operatorString;
+
+            switch (symbol)
+            {
+            case Grammar::Symbol::OperatorAddition:
+                operatorString = " + ";
+                break;
+            case Grammar::Symbol::OperatorDivision:
+                operatorString = " / ";
+                break;
+            case Grammar::Symbol::OperatorMultiplication:
+                operatorString = " * ";
+                break;
+            case Grammar::Symbol::OperatorSubraction:
+                operatorString = " - ";
+                break;
+            default:
+                AddTranslationError(execution, ParseErrors::UntranslatedArithmetic);
+                return;
+            }
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_dotCPP.Write("(");
+            }
+
+            // write operand 0 + operand 1
+            m_dotCPP.Write(GetInputString(execution, 0));
+            m_dotCPP.Write(operatorString);
+            m_dotCPP.Write(GetInputString(execution, 1));
+            m_dotCPP.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_dotCPP.Write(operatorString);
+                m_dotCPP.Write(GetInputString(execution, i));
+                m_dotCPP.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto output = execution->GetLocalOutput())
+            {
+                for (const auto& outputIter : *output)
+                {
+                    const auto& outputAssignment = outputIter.second;
+
+                    if (!outputAssignment->m_assignments.empty() && m_omittedParameters.count(outputAssignment->m_source) > 0)
+                    {
+                        AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedOmittedParameter, outputAssignment->m_source->m_name.c_str(), Data::GetName(outputAssignment->m_source->m_datum.GetType()).c_str()));
+                        continue;
+                    }
+
+                    for (size_t i(0); i < outputAssignment->m_assignments.size(); ++i)
+                    {
+                        const AZStd::string source = GetConvertedString(execution, outputAssignment->m_source->m_name, outputAssignment->m_source->m_datum.GetType(), outputAssignment->m_sourceConversions, i);
+                        m_dotCPP.WriteLineIndented(AZStd::string::format("%s = %s;", outputAssignment->m_assignments[i]->m_name.c_str(), source.c_str()));
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteReturnStatement(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (!IsReturnValueWritten(execution))
+            {
+                return;
+            }
+
+            if (execution->GetReturnValueCount() == 1)
+            {
+                m_dotCPP.WriteLineIndented("return %s;", execution->GetReturnValue(0).second->m_source->m_name.c_str());
+                return;
+            }
+
+            m_dotCPP.WriteIndented("return AZStd::make_tuple(%s", execution->GetReturnValue(0).second->m_source->m_name.c_str());
+
+            for (size_t i = 1; i < execution->GetReturnValueCount(); ++i)
+            {
+                m_dotCPP.Write(", %s", execution->GetReturnValue(i).second->m_source->m_name.c_str());
+            }
+
+            m_dotCPP.WriteLine(");");
+        }
+
+        void GraphToCPlusPlus::WriteReturnValueInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->HasReturnValues())
+            {
+                for (size_t index(0), sentinel(execution->GetReturnValueCount()); index < sentinel; ++index)
+                {
+                    const auto& returnValue = execution->GetReturnValue(index).second;
+
+                    if (returnValue->m_isNewValue)
+                    {
+                        const auto& variable = returnValue->m_source;
+                        const AZStd::string value = returnValue->m_initializationValue ? returnValue->m_initializationValue->m_name : GetValueString(execution, variable);
+                        m_dotCPP.WriteLineIndented(AZStd::string::format("[[maybe_unused]] %s %s = %s;", GetTypeName(execution, variable).c_str(), variable->m_name.c_str(), value.c_str()));
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            if (variable->m_source == execution)
+            {
+                m_dotCPP.Write(AZStd::string::format("[[maybe_unused]] %s %s = ", GetTypeName(execution, variable).c_str(), variable->m_name.c_str()));
+            }
+            else
+            {
+                m_dotCPP.Write(AZStd::string::format("%s = ", variable->m_name.c_str()));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteWrittenMathExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            auto meta = AZStd::rtti_pointer_cast<const Grammar::MathExpressionMetaData>(execution->GetMetaData());
+            if (!meta)
+            {
+                AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedMathExpression, "missing meta data"));
+                return;
+            }
+
+            // the expression is already valid C++, as long as it only uses the arithmetic operators, on floating point literals
+            const AZStd::string& expression = meta->m_expressionString;
+            AZStd::string translation;
+            size_t inputIndex = 0;
+
+            for (size_t index = 0; index < expression.size(); ++index)
+            {
+                const char character = expression[index];
+
+                if (character == '@' && inputIndex < execution->GetInputCount())
+                {
+                    translation += GetInputString(execution, inputIndex);
+                    ++inputIndex;
+                }
+                else if ((character >= '0' && character <= '9') || character == '.')
+                {
+                    const size_t numberEnd = AZStd::min(expression.find_first_not_of("0123456789.", index), expression.size());
+                    AZStd::string number = expression.substr(index, numberEnd - index);
+
+                    if (number.find('.') == AZStd::string::npos)
+                    {
+                        number += ".0";
+                    }
+
+                    translation += number;
+                    index = numberEnd - 1;
+                }
+                else if (AZStd::string_view("+-*/() \t").find(character) != AZStd::string_view::npos)
+                {
+                    translation += character;
+                }
+                else
+                {
+                    AddTranslationError(execution, AZStd::string::format(GraphToCPlusPlusCPP::k_unsupportedMathExpression, expression.c_str()));
+                    return;
+                }
+            }
+
+            m_dotCPP.Write(translation);
+        }
+    }
+}
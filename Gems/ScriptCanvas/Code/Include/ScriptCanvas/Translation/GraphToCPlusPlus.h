@@ -8,7 +8,10 @@
 #pragma once
 
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 
+#include "TranslationResult.h"
 #include "TranslationUtilities.h"
 #include "GraphToX.h"
 
@@ -21,39 +24,96 @@ namespace ScriptCanvas
         class AbstractCodeModel;
     }
 
+    namespace Nodes
+    {
+        namespace Core
+        {
+            class Method;
+        }
+    }
+
     namespace Translation
     {
+        // Translates the abstract code model to a C++ Nodeable that calls the reflected methods of the graph directly,
+        // instead of interpreting the graph in Lua. Graphs that use features the C++ translation does not support yet
+        // fail translation with an error per unsupported construct, and are expected to keep executing in Lua.
         class GraphToCPlusPlus
             : public GraphToX
         {
         public:
-            static AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
-            
-            AZ_INLINE bool IsSuccessfull() const { return false;  }
-        private:         
+            static AZ::Outcome<void, ErrorList> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
+
+        private:
+            struct ReflectedMethod
+            {
+                const AZ::BehaviorMethod* m_method = nullptr;
+                const Nodes::Core::Method* m_node = nullptr;
+            };
+
             // cpp only
             Writer m_dotH;
             Writer m_dotCPP;
-            
+            AZStd::string m_className;
+            AZStd::vector<Grammar::EBusHandlingConstPtr> m_ebusHandlings;
+            AZStd::unordered_map<Grammar::ExecutionTreeConstPtr, AZStd::string> m_ebusEventFunctionNames;
+            // the event parameters of types the translation can't name are left out of the handler functions
+            AZStd::unordered_set<Grammar::VariableConstPtr> m_omittedParameters;
+            AZStd::vector<Grammar::VariableConstPtr> m_memberVariables;
+            AZStd::vector<ReflectedMethod> m_reflectedMethods;
+            size_t m_requiredOutCount = 0;
+
             GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
 
+            size_t AddReflectedMethod(const Nodes::Core::Method& node, const AZ::BehaviorMethod& method);
+            void AddTranslationError(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view description);
+            void CheckSupportedEBusHandling(Grammar::EBusHandlingConstPtr ebusHandling);
+            void CheckSupportedFeatures();
+            void CheckSupportedName(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name);
+            AZStd::string GetArgumentString(Grammar::ExecutionTreeConstPtr execution, size_t index, const AZ::BehaviorMethod& method);
+            AZStd::string GetConvertedString(Grammar::ExecutionTreeConstPtr execution, const AZStd::string& source, const Data::Type& sourceType, const Grammar::ConversionByIndex& conversions, size_t index);
+            AZStd::string GetInputString(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            Data::Type GetInputType(Grammar::ExecutionTreeConstPtr execution, size_t index) const;
+            AZStd::string GetReturnTypeName(Grammar::ExecutionTreeConstPtr execution);
+            AZStd::string GetTypeName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            AZStd::string GetValueString(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            bool IsReturnValueWritten(Grammar::ExecutionTreeConstPtr execution) const;
             void TranslateClassClose();
             void TranslateClassOpen();
             void TranslateConstruction();
             void TranslateDependencies();
             void TranslateDependenciesDotH();
             void TranslateDependenciesDotCPP();
-            void TranslateDestruction();
+            void TranslateEBusHandlerCreation(Grammar::EBusHandlingConstPtr ebusHandling);
+            void TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeSwitch(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeUserOutCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeWhile(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateFunction(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateFunctionBlock(Grammar::ExecutionTreeConstPtr functionBlock);
+            void TranslateFunctionDefinition(Grammar::ExecutionTreeConstPtr execution);
             void TranslateFunctions();
-            void TranslateHandlers();
             void TranslateNamespaceOpen();
             void TranslateNamespaceClose();
-            void TranslateStartNode();
+            void TranslateRegistration();
             void TranslateVariables();
+            void WriteEBusEventOut(Grammar::EBusHandlingConstPtr ebusHandling, Grammar::ExecutionTreeConstPtr eventThread, size_t eventIndex);
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution);
+            void WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr result);
             void WriteHeader(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotH(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotCPP(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteReturnStatement(Grammar::ExecutionTreeConstPtr execution);
+            void WriteReturnValueInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            void WriteWrittenMathExpression(Grammar::ExecutionTreeConstPtr execution);
         };
-    } 
+    }
 
 }
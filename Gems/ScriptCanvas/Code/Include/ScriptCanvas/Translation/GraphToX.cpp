@@ -76,6 +76,11 @@ namespace ScriptCanvas
             return m_model.GetSource().m_name;
         }
 
+        const AZStd::vector<ValidationConstPtr>& GraphToX::GetErrors() const
+        {
+            return m_errors;
+        }
+
         AZStd::string_view GraphToX::GetFullPath() const
         {
             return m_model.GetSource().m_path;
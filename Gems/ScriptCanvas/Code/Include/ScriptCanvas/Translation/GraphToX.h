@@ -48,6 +48,7 @@ namespace ScriptCanvas
             void CloseScope(Writer& writer);
             void CloseNamespace(Writer& writer, AZStd::string_view ns);
             AZStd::string_view GetGraphName() const;
+            const AZStd::vector<ValidationConstPtr>& GetErrors() const;
             AZStd::string_view GetFullPath() const;
             AZStd::sys_time_t GetTranslationDuration() const;
             AZStd::string ResolveScope(const AZStd::vector<AZStd::string>& namespaces);
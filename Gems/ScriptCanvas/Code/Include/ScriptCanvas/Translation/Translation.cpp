@@ -26,8 +26,7 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
-    /*
-    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::pair<AZStd::string, AZStd::string>> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
         AZStd::string dotH, dotCPP;
         auto outcome = GraphToCPlusPlus::Translate(model, dotH, dotCPP);
@@ -59,7 +58,6 @@ namespace TranslationCPP
             return AZ::Failure(outcome.TakeError());
         }
     }
-    */
 
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
@@ -133,31 +131,31 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
+                // Translation to C++ calls the reflected methods directly, and fails on the features of the abstract code model
+                // it does not support yet, in which case the graph is expected to keep executing from its Lua translation.
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.rawSaveDebugOutput);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto hppAndCpp = outcomeCPP.TakeValue();
+
+                        TargetResult hppResult;
+                        hppResult.m_text = AZStd::move(hppAndCpp.first);
+                        hppResult.m_duration = 0;
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(hppResult));
+                        TargetResult cppResult;
+                        cppResult.m_text = AZStd::move(hppAndCpp.second);
+                        cppResult.m_duration = 0;
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(cppResult));
+                    }
+                    else
+                    {
+                        auto cppErrors = outcomeCPP.TakeError();
+                        errors.emplace(TargetFlags::Hpp, cppErrors);
+                        errors.emplace(TargetFlags::Cpp, AZStd::move(cppErrors));
+                    }
+                }
 
             }
 
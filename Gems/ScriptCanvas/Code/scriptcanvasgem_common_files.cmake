@@ -189,6 +189,10 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.h
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.cpp
+    Include/ScriptCanvas/Execution/Native/NativeNodeable.h
+    Include/ScriptCanvas/Execution/Native/NativeNodeable.cpp
     Include/ScriptCanvas/Execution/NodeableOut/NodeableOutNative.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.cpp
@@ -77,6 +77,55 @@ namespace ScriptCanvasTests
         return graphPath;
     }
 
+    void ReportPerformance(const ScriptCanvasEditor::Reporter& reporter)
+    {
+        const Execution::PerformanceTrackingReport& performance = reporter.GetPerformanceReport();
+
+        if (reporter.GetExecutionMode() == ExecutionMode::Interpreted)
+        {
+            std::cerr << "[INTERPRETED] ";
+        }
+        else
+        {
+            std::cerr << "[     NATIVE] ";
+        }
+
+        std::cerr << AZStd::string::format
+            (" Parse: %4.2f ms, Translate: %4.2f ms\n"
+            , reporter.GetParseDuration() / 1000.0
+            , reporter.GetTranslateDuration() / 1000.0).c_str();
+
+        double ready = aznumeric_caster(performance.timing.initializationTime);
+        double instant = aznumeric_caster(performance.timing.executionTime);
+        double latent = aznumeric_caster(performance.timing.latentTime);
+        double total = aznumeric_caster(performance.timing.totalTime);
+
+        std::cerr << "[ INITIALIZE] " << AZStd::string::format("%7.3f ms \n", ready / 1000.0).c_str();
+
+        std::cerr << "[  EXECUTION] " << AZStd::string::format("%7.3f ms \n", instant / 1000.0).c_str();
+
+        std::cerr << "[     LATENT] " << AZStd::string::format("%7.3f ms \n", latent / 1000.0).c_str();
+
+        std::cerr << "[      TOTAL] " << AZStd::string::format("%7.3f ms ", total / 1000.0).c_str();
+
+        switch (reporter.GetExecutionConfiguration())
+        {
+        case ScriptCanvasEditor::ExecutionConfiguration::Debug:
+            std::cerr << "[  DEBUG] ";
+            break;
+        case ScriptCanvasEditor::ExecutionConfiguration::Performance:
+            std::cerr << "[PERFORM] ";
+            break;
+        case ScriptCanvasEditor::ExecutionConfiguration::Release:
+            std::cerr << "[RELEASE] ";
+            break;
+        case ScriptCanvasEditor::ExecutionConfiguration::Traced:
+            std::cerr << "[ TRACED] ";
+            break;
+        }
+        std::cerr << "\n";
+    }
+
     void VerifyReporter(const ScriptCanvasEditor::Reporter& reporter)
     {
         if (!reporter.IsGraphLoaded())
@@ -177,51 +226,7 @@ namespace ScriptCanvasTests
             }
             else
             {
-                const Execution::PerformanceTrackingReport& performance = reporter.GetPerformanceReport();
-
-                if (reporter.GetExecutionMode() == ExecutionMode::Interpreted)
-                {
-                    std::cerr << "[INTERPRETED] ";
-                }
-                else
-                {
-                    std::cerr << "[     NATIVE] ";
-                }
-
-                std::cerr << AZStd::string::format
-                    (" Parse: %4.2f ms, Translate: %4.2f ms\n"
-                    , reporter.GetParseDuration() / 1000.0
-                    , reporter.GetTranslateDuration() / 1000.0).c_str();
-
-                double ready = aznumeric_caster(performance.timing.initializationTime);
-                double instant = aznumeric_caster(performance.timing.executionTime);
-                double latent = aznumeric_caster(performance.timing.latentTime);
-                double total = aznumeric_caster(performance.timing.totalTime);
-
-                std::cerr << "[ INITIALIZE] " << AZStd::string::format("%7.3f ms \n", ready / 1000.0).c_str();
-
-                std::cerr << "[  EXECUTION] " << AZStd::string::format("%7.3f ms \n", instant / 1000.0).c_str();
-
-                std::cerr << "[     LATENT] " << AZStd::string::format("%7.3f ms \n", latent / 1000.0).c_str();
-
-                std::cerr << "[      TOTAL] " << AZStd::string::format("%7.3f ms ", total / 1000.0).c_str();
-
-                switch (reporter.GetExecutionConfiguration())
-                {
-                case ScriptCanvasEditor::ExecutionConfiguration::Debug:
-                    std::cerr << "[  DEBUG] ";
-                    break;
-                case ScriptCanvasEditor::ExecutionConfiguration::Performance:
-                    std::cerr << "[PERFORM] ";
-                    break;
-                case ScriptCanvasEditor::ExecutionConfiguration::Release:
-                    std::cerr << "[RELEASE] ";
-                    break;
-                case ScriptCanvasEditor::ExecutionConfiguration::Traced:
-                    std::cerr << "[ TRACED] ";
-                    break;
-                }
-                std::cerr << "\n";
+                ReportPerformance(reporter);
             }
         }
         else
@@ -28,6 +28,8 @@ namespace ScriptCanvasTests
 
     AZStd::string_view GetGraphNameFromPath(AZStd::string_view graphPath);
 
+    void ReportPerformance(const ScriptCanvasEditor::Reporter& reporter);
+
     void RunUnitTestGraph(AZStd::string_view graphPath);
 
     void RunUnitTestGraph(AZStd::string_view graphPath, ScriptCanvas::ExecutionMode execution);
@@ -0,0 +1,77 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeTranslationEBusGolden
+FULL PATH: NativeTranslationEBusGolden.scriptcanvas
+Last written: 00:00:00 01-01-2000
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include "NativeTranslationEBusGolden.h"
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/limits.h>
+#include <ScriptCanvas/Core/MethodConfiguration.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+
+namespace ScriptCanvas
+{
+	namespace AutoNative
+{
+		void NativeTranslationEBusGolden::UnitTestEventsBusHandler_SideEffect([[maybe_unused]] Data::StringType String_output)
+		{
+			CallNativeMethod(m_reflectedMethod0, String_output);
+		}
+
+		void NativeTranslationEBusGolden::OnInitializeExecutionState()
+		{
+			m_reflectedMethod0 = FindNativeMethod(MethodType::Event, "UnitTestEventsBus", "Succeeded");
+
+			UnitTestEventsBusHandler.reset(EBusHandler::Create(GetExecutionState(), "UnitTestEventsBus"));
+			UnitTestEventsBusHandler->HandleEvent(2);
+			UnitTestEventsBusHandler->SetExecutionOut(2, [this](AZ::BehaviorValueParameter*, AZ::BehaviorValueParameter* arguments, int)
+			{
+				UnitTestEventsBusHandler_SideEffect(ReadNativeArgument<Data::StringType>(arguments[0]));
+			});
+			UnitTestEventsBusHandler->Connect();
+		}
+
+		void NativeTranslationEBusGolden::OnDeactivate()
+		{
+			UnitTestEventsBusHandler.reset();
+		}
+
+		size_t NativeTranslationEBusGolden::GetRequiredOutCount() const
+		{
+			return 0;
+		}
+
+		void NativeTranslationEBusGolden::Register()
+		{
+			RegisterNativeNodeable(AZ::Uuid("{7D2E3F40-5B6C-4D7E-9F80-AB1C2D3E4F50}"), []() -> NativeNodeable* { return aznew NativeTranslationEBusGolden(); });
+		}
+
+		void NativeTranslationEBusGolden::Unregister()
+		{
+			UnregisterNativeNodeable(AZ::Uuid("{7D2E3F40-5B6C-4D7E-9F80-AB1C2D3E4F50}"));
+		}
+	} // namespace AutoNative
+} // namespace ScriptCanvas
@@ -0,0 +1,67 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+#pragma once
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeTranslationEBusGolden
+FULL PATH: NativeTranslationEBusGolden.scriptcanvas
+Last written: 00:00:00 01-01-2000
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/tuple.h>
+#include <ScriptCanvas/Core/EBusHandler.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Execution/Native/NativeNodeable.h>
+
+namespace ScriptCanvas
+{
+	namespace AutoNative
+{
+		class NativeTranslationEBusGolden
+		    : public NativeNodeable
+		{
+		public:
+			AZ_RTTI(NativeTranslationEBusGolden, "{CD5B7C0B-ECC4-5E55-8CFF-F0C0E233BBC4}", NativeNodeable);
+			AZ_CLASS_ALLOCATOR(NativeTranslationEBusGolden, AZ::SystemAllocator, 0);
+
+			static void Register();
+			static void Unregister();
+
+			NativeTranslationEBusGolden() = default;
+			~NativeTranslationEBusGolden() override = default;
+
+			void UnitTestEventsBusHandler_SideEffect(Data::StringType String_output);
+
+		protected:
+			void OnInitializeExecutionState() override;
+
+			void OnDeactivate() override;
+
+			size_t GetRequiredOutCount() const override;
+
+		private:
+			const AZ::BehaviorMethod* m_reflectedMethod0 = nullptr;
+			AZStd::unique_ptr<EBusHandler> UnitTestEventsBusHandler;
+		};
+	} // namespace AutoNative
+} // namespace ScriptCanvas
@@ -0,0 +1,64 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeTranslationGolden
+FULL PATH: NativeTranslationGolden.scriptcanvas
+Last written: 00:00:00 01-01-2000
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include "NativeTranslationGolden.h"
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/limits.h>
+#include <ScriptCanvas/Core/MethodConfiguration.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+
+namespace ScriptCanvas
+{
+	namespace AutoNative
+{
+		void NativeTranslationGolden::OnGraphStart()
+		{
+			CallNativeMethod(m_reflectedMethod0, Data::StringType("native"));
+		}
+
+		void NativeTranslationGolden::OnInitializeExecutionState()
+		{
+			m_reflectedMethod0 = FindNativeMethod(MethodType::Event, "UnitTestEventsBus", "SideEffect");
+		}
+
+		size_t NativeTranslationGolden::GetRequiredOutCount() const
+		{
+			return 0;
+		}
+
+		void NativeTranslationGolden::Register()
+		{
+			RegisterNativeNodeable(AZ::Uuid("{6C1D2E3F-4A5B-4C6D-8E7F-9A0B1C2D3E4F}"), []() -> NativeNodeable* { return aznew NativeTranslationGolden(); });
+		}
+
+		void NativeTranslationGolden::Unregister()
+		{
+			UnregisterNativeNodeable(AZ::Uuid("{6C1D2E3F-4A5B-4C6D-8E7F-9A0B1C2D3E4F}"));
+		}
+	} // namespace AutoNative
+} // namespace ScriptCanvas
@@ -0,0 +1,62 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+#pragma once
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeTranslationGolden
+FULL PATH: NativeTranslationGolden.scriptcanvas
+Last written: 00:00:00 01-01-2000
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include <AzCore/std/tuple.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Execution/Native/NativeNodeable.h>
+
+namespace ScriptCanvas
+{
+	namespace AutoNative
+{
+		class NativeTranslationGolden
+		    : public NativeNodeable
+		{
+		public:
+			AZ_RTTI(NativeTranslationGolden, "{E0C266F8-DB84-5BC2-AD36-46C6125F0F21}", NativeNodeable);
+			AZ_CLASS_ALLOCATOR(NativeTranslationGolden, AZ::SystemAllocator, 0);
+
+			static void Register();
+			static void Unregister();
+
+			NativeTranslationGolden() = default;
+			~NativeTranslationGolden() override = default;
+
+			void OnGraphStart() override;
+
+		protected:
+			void OnInitializeExecutionState() override;
+
+			size_t GetRequiredOutCount() const override;
+
+		private:
+			const AZ::BehaviorMethod* m_reflectedMethod0 = nullptr;
+		};
+	} // namespace AutoNative
+} // namespace ScriptCanvas
@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Script/ScriptAsset.h>
+#include <AzCore/Script/ScriptSystemBus.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzFramework/Script/ScriptComponent.h>
+#include <Editor/Framework/ScriptCanvasReporter.h>
+#include <ScriptCanvas/Asset/RuntimeAsset.h>
+#include <ScriptCanvas/Core/ModifiableDatumView.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/RuntimeComponent.h>
+#include <ScriptCanvas/Libraries/Core/EBusEventHandler.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
+#include <ScriptCanvas/Libraries/Core/Start.h>
+#include <ScriptCanvas/PerformanceTracker.h>
+#include <ScriptCanvas/SystemComponent.h>
+#include <ScriptCanvas/Translation/Translation.h>
+
+#include <Tests/NativeTranslation/NativeTranslationEBusGolden.h>
+#include <Tests/NativeTranslation/NativeTranslationGolden.h>
+
+using namespace ScriptCanvasTests;
+
+namespace NativeTranslationTestsCPP
+{
+    using namespace ScriptCanvas;
+
+    // the graph asset ids the golden nodeables are registered for, which the translation writes into their Register functions
+    const AZ::Uuid k_goldenGraphId("{6C1D2E3F-4A5B-4C6D-8E7F-9A0B1C2D3E4F}");
+    const AZ::Uuid k_ebusGoldenGraphId("{7D2E3F40-5B6C-4D7E-9F80-AB1C2D3E4F50}");
+
+    const char* k_goldenDirectory = "@engroot@/Gems/ScriptCanvasTesting/Code/Tests/NativeTranslation";
+
+    AZ_CVAR(bool, sc_writeNativeTranslationGoldens, false, {}, AZ::ConsoleFunctorFlags::Null,
+        "Writes the C++ translations of the golden graphs over the goldens instead of comparing them, to regenerate the goldens after the translation changes.");
+
+    AZStd::string ReadGolden(const char* fileName)
+    {
+        const AZStd::string path = AZStd::string::format("%s/%s", k_goldenDirectory, fileName);
+        AZ::IO::FileIOStream stream(path.c_str(), AZ::IO::OpenMode::ModeRead);
+        if (!stream.IsOpen())
+        {
+            ADD_FAILURE() << "failed to open the golden file: " << path.c_str();
+            return {};
+        }
+
+        AZStd::string text;
+        text.resize(stream.GetLength());
+        stream.Read(text.size(), text.data());
+        return text;
+    }
+
+    void WriteGolden(const char* fileName, const AZStd::string& text)
+    {
+        const AZStd::string path = AZStd::string::format("%s/%s", k_goldenDirectory, fileName);
+        AZ::IO::FileIOStream stream(path.c_str(), AZ::IO::OpenMode::ModeWrite);
+        if (!stream.IsOpen())
+        {
+            ADD_FAILURE() << "failed to write the golden file: " << path.c_str();
+            return;
+        }
+
+        stream.Write(text.size(), text.data());
+    }
+
+    // the lines after the do not modify comment, which is the only part of the output that depends on when and where it was written,
+    // without the indentation or blank lines, so the goldens only have to match the code
+    AZStd::vector<AZStd::string> GetCodeLines(AZStd::string_view text)
+    {
+        AZStd::vector<AZStd::string> lines;
+
+        const size_t graphName = text.find("GRAPH NAME:");
+        const size_t commentClose = graphName == AZStd::string_view::npos ? graphName : text.find("*/", graphName);
+        if (commentClose == AZStd::string_view::npos)
+        {
+            ADD_FAILURE() << "the translation is missing its do not modify comment";
+            return lines;
+        }
+
+        AZStd::string_view remaining = text.substr(commentClose + 2);
+        while (!remaining.empty())
+        {
+            const size_t lineEnd = remaining.find('\n');
+            AZStd::string line(remaining.substr(0, lineEnd));
+            remaining = lineEnd == AZStd::string_view::npos ? AZStd::string_view() : remaining.substr(lineEnd + 1);
+
+            AZ::StringFunc::TrimWhiteSpace(line, true, true);
+            if (!line.empty())
+            {
+                lines.push_back(AZStd::move(line));
+            }
+        }
+
+        return lines;
+    }
+
+    void ExpectGolden(const Translation::Result& result, Translation::TargetFlags target, const char* goldenFileName)
+    {
+        auto translation = result.m_translations.find(target);
+        ASSERT_NE(translation, result.m_translations.end()) << result.ErrorsToString().c_str();
+
+        if (sc_writeNativeTranslationGoldens)
+        {
+            WriteGolden(goldenFileName, translation->second.m_text);
+            return;
+        }
+
+        const AZStd::vector<AZStd::string> translated = GetCodeLines(translation->second.m_text);
+        const AZStd::vector<AZStd::string> golden = GetCodeLines(ReadGolden(goldenFileName));
+
+        for (size_t index = 0; index < AZStd::min(translated.size(), golden.size()); ++index)
+        {
+            EXPECT_EQ(golden[index], translated[index]) << goldenFileName << ", code line " << index;
+        }
+
+        EXPECT_EQ(golden.size(), translated.size()) << goldenFileName;
+    }
+
+    using TranslateFunction = Translation::Result(*)(const Grammar::Request&);
+
+    Translation::Result Translate(const Graph& graph, const char* name, const AZ::Uuid& graphId, TranslateFunction translate)
+    {
+        const AZStd::string path = AZStd::string::format("%s.scriptcanvas", name);
+
+        Grammar::Request request;
+        request.scriptAssetId = AZ::Data::AssetId(graphId);
+        request.graph = &graph;
+        request.name = name;
+        request.path = path;
+        request.namespacePath = path;
+        request.addDebugInformation = false;
+        return translate(request);
+    }
+
+    // Start -> UnitTestEventsBus::SideEffect("native")
+    Graph* CreateGoldenGraph()
+    {
+        Graph* graph = nullptr;
+        SystemRequestBus::BroadcastResult(graph, &SystemRequests::MakeGraph);
+        EXPECT_TRUE(graph != nullptr);
+        graph->GetEntity()->Init();
+        const ScriptCanvasId& scriptCanvasId = graph->GetScriptCanvasId();
+
+        AZ::EntityId startId;
+        CreateTestNode<Nodes::Core::Start>(scriptCanvasId, startId);
+
+        AZ::EntityId methodId;
+        Nodes::Core::Method* method = CreateTestNode<Nodes::Core::Method>(scriptCanvasId, methodId);
+        method->InitializeEvent({}, "UnitTestEventsBus", "SideEffect");
+
+        const AZStd::vector<const Slot*> inputs = method->GetSlotsByType(CombinedSlotType::DataIn);
+        EXPECT_EQ(size_t{ 1 }, inputs.size());
+        if (!inputs.empty())
+        {
+            ModifiableDatumView datumView;
+            method->FindModifiableDatumView(inputs.front()->GetId(), datumView);
+            datumView.SetAs(Data::StringType("native"));
+        }
+
+        EXPECT_TRUE(Connect(*graph, startId, "Out", methodId, "In"));
+        return graph;
+    }
+
+    // UnitTestEventsBus::SideEffect handler -> UnitTestEventsBus::Succeeded(the description of the side effect)
+    Graph* CreateEBusGoldenGraph()
+    {
+        Graph* graph = nullptr;
+        SystemRequestBus::BroadcastResult(graph, &SystemRequests::MakeGraph);
+        EXPECT_TRUE(graph != nullptr);
+        graph->GetEntity()->Init();
+        const ScriptCanvasId& scriptCanvasId = graph->GetScriptCanvasId();
+
+        AZ::EntityId handlerId;
+        Nodes::Core::EBusEventHandler* handler = CreateTestNode<Nodes::Core::EBusEventHandler>(scriptCanvasId, handlerId);
+        handler->InitializeBus("UnitTestEventsBus");
+        const AZStd::optional<size_t> eventIndex = handler->GetEventIndex("SideEffect");
+        EXPECT_TRUE(eventIndex.has_value());
+        handler->InitializeEvent(static_cast<int>(eventIndex.value_or(0)));
+
+        AZ::EntityId methodId;
+        Nodes::Core::Method* method = CreateTestNode<Nodes::Core::Method>(scriptCanvasId, methodId);
+        method->InitializeEvent({}, "UnitTestEventsBus", "Succeeded");
+
+        const Nodes::Core::EBusEventEntry* event = handler->FindEvent("SideEffect");
+        const AZStd::vector<const Slot*> inputs = method->GetSlotsByType(CombinedSlotType::DataIn);
+        EXPECT_TRUE(event != nullptr);
+        EXPECT_EQ(size_t{ 1 }, inputs.size());
+        if (event && !event->m_parameterSlotIds.empty() && !inputs.empty())
+        {
+            EXPECT_TRUE(graph->Connect(handlerId, event->m_eventSlotId, methodId, method->GetSlotId("In")));
+            EXPECT_TRUE(graph->Connect(handlerId, event->m_parameterSlotIds.front(), methodId, inputs.front()->GetId()));
+        }
+
+        return graph;
+    }
+
+    AZ::Data::Asset<RuntimeAsset> CreateNativeRuntimeAsset(const AZ::Uuid& graphId, Grammar::ExecutionStateSelection selection)
+    {
+        AZ::Data::Asset<RuntimeAsset> asset(aznew RuntimeAsset(AZ::Data::AssetId(graphId), AZ::Data::AssetData::AssetStatus::Ready), AZ::Data::AssetLoadBehavior::PreLoad);
+        asset.Get()->GetData().m_input.m_executionSelection = selection;
+        return asset;
+    }
+
+    // the path the game takes: the runtime component creates the execution state for the asset, which finds the registered nodeable
+    AZ::Entity* ActivateNativeGraph(const AZ::Uuid& graphId, Grammar::ExecutionStateSelection selection)
+    {
+        RuntimeDataOverrides overrides;
+        overrides.m_runtimeAsset = CreateNativeRuntimeAsset(graphId, selection);
+
+        AZ::Entity* entity = aznew AZ::Entity("NativeTranslationGraph");
+        RuntimeComponent* runtimeComponent = entity->CreateComponent<RuntimeComponent>();
+        runtimeComponent->SetRuntimeDataOverrides(overrides);
+        entity->Init();
+        entity->Activate();
+        return entity;
+    }
+
+    // the Lua of the graph, compiled the way the builder compiles it for the interpreted execution
+    AZ::Data::Asset<AZ::ScriptAsset> CompileLua(const AZ::Uuid& graphId, const AZStd::string& lua)
+    {
+        AZ::Data::Asset<AZ::ScriptAsset> asset;
+        asset.Create(AZ::Data::AssetId(graphId, AZ::ScriptAsset::CompiledAssetSubId));
+        auto writeStream = asset.Get()->CreateWriteStream();
+
+        AZ::IO::MemoryStream inputStream(lua.data(), lua.size());
+        AzFramework::ScriptCompileRequest compileRequest;
+        compileRequest.m_errorWindow = "NativeTranslation";
+        compileRequest.m_input = &inputStream;
+        compileRequest.m_output = &writeStream;
+        AzFramework::ConstructScriptAssetPaths(compileRequest);
+
+        const auto compileOutcome = AzFramework::CompileScript(compileRequest);
+        EXPECT_TRUE(compileOutcome.IsSuccess()) << (compileOutcome.IsSuccess() ? "" : compileOutcome.GetError().c_str());
+        return asset;
+    }
+
+    // activates the graph the given number of times, the runtime component times the initialization and execution of each
+    // activation with the performance tracker the unit test graphs report, which the reporter collects afterwards
+    void RunPerformance(AZ::Data::Asset<RuntimeAsset> asset, int activations, ScriptCanvasEditor::Reporter& reporter)
+    {
+        Execution::PerformanceTracker* performanceTracker = SystemComponent::ModPerformanceTracker();
+        performanceTracker->CalculateReports();
+        performanceTracker->ClearSnapshotReport();
+
+        RuntimeDataOverrides overrides;
+        overrides.m_runtimeAsset = asset;
+
+        for (int activation = 0; activation < activations; ++activation)
+        {
+            AZ::Entity entity("NativeTranslationPerformance");
+            entity.CreateComponent<RuntimeComponent>()->SetRuntimeDataOverrides(overrides);
+            entity.Init();
+            entity.Activate();
+            entity.Deactivate();
+        }
+
+        reporter.CollectPerformanceTiming();
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslation_MethodCall_MatchesGolden)
+{
+    using namespace NativeTranslationTestsCPP;
+
+    ScriptCanvas::Graph* graph = CreateGoldenGraph();
+    const ScriptCanvas::Translation::Result result = Translate(*graph, "NativeTranslationGolden", k_goldenGraphId, &ScriptCanvas::Translation::ToCPlusPlus);
+    EXPECT_TRUE(result.TranslationSucceed(ScriptCanvas::Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+    ExpectGolden(result, ScriptCanvas::Translation::TargetFlags::Hpp, "NativeTranslationGolden.h");
+    ExpectGolden(result, ScriptCanvas::Translation::TargetFlags::Cpp, "NativeTranslationGolden.cpp");
+    delete graph->GetEntity();
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslation_EBusHandler_MatchesGolden)
+{
+    using namespace NativeTranslationTestsCPP;
+
+    ScriptCanvas::Graph* graph = CreateEBusGoldenGraph();
+    const ScriptCanvas::Translation::Result result = Translate(*graph, "NativeTranslationEBusGolden", k_ebusGoldenGraphId, &ScriptCanvas::Translation::ToCPlusPlus);
+    EXPECT_TRUE(result.TranslationSucceed(ScriptCanvas::Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+    ExpectGolden(result, ScriptCanvas::Translation::TargetFlags::Hpp, "NativeTranslationEBusGolden.h");
+    ExpectGolden(result, ScriptCanvas::Translation::TargetFlags::Cpp, "NativeTranslationEBusGolden.cpp");
+    delete graph->GetEntity();
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslation_RegisteredNodeable_ExecutesOnGraphStart)
+{
+    using namespace NativeTranslationTestsCPP;
+
+    UnitTestEventsHandler unitTestHandler;
+    unitTestHandler.BusConnect();
+
+    ScriptCanvas::AutoNative::NativeTranslationGolden::Register();
+    AZ::Entity* entity = ActivateNativeGraph(k_goldenGraphId, ScriptCanvas::Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart);
+    EXPECT_EQ(1, unitTestHandler.SideEffectCount("native"));
+
+    entity->Deactivate();
+    delete entity;
+    ScriptCanvas::AutoNative::NativeTranslationGolden::Unregister();
+
+    EXPECT_EQ(nullptr, ScriptCanvas::CreateNativeNodeable(k_goldenGraphId));
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslation_RegisteredNodeable_HandlesEBusEventsUntilDeactivated)
+{
+    using namespace NativeTranslationTestsCPP;
+
+    UnitTestEventsHandler unitTestHandler;
+    unitTestHandler.BusConnect();
+
+    ScriptCanvas::AutoNative::NativeTranslationEBusGolden::Register();
+    AZ::Entity* entity = ActivateNativeGraph(k_ebusGoldenGraphId, ScriptCanvas::Grammar::ExecutionStateSelection::InterpretedObject);
+
+    UnitTestEventsBus::Broadcast(&UnitTestEvents::SideEffect, "handled");
+    EXPECT_EQ(1, unitTestHandler.SuccessCount("handled"));
+
+    entity->Deactivate();
+    UnitTestEventsBus::Broadcast(&UnitTestEvents::SideEffect, "not handled");
+    EXPECT_EQ(0, unitTestHandler.SuccessCount("not handled"));
+
+    delete entity;
+    ScriptCanvas::AutoNative::NativeTranslationEBusGolden::Unregister();
+}
+
+// Compares the translated graph against the Lua of the same graph, which is how it executes without the translation, with the
+// same performance report as the unit test graphs.
+TEST_F(ScriptCanvasTestFixture, NativeTranslation_Performance)
+{
+    using namespace NativeTranslationTestsCPP;
+
+    constexpr int Activations = 1000;
+
+    UnitTestEventsHandler unitTestHandler;
+    unitTestHandler.BusConnect();
+
+    ScriptCanvas::Graph* graph = CreateGoldenGraph();
+    const ScriptCanvas::Translation::Result result = Translate(*graph, "NativeTranslationGolden", k_goldenGraphId, &ScriptCanvas::Translation::ToCPlusPlusAndLua);
+
+    auto lua = result.m_translations.find(ScriptCanvas::Translation::TargetFlags::Lua);
+    ASSERT_NE(lua, result.m_translations.end()) << result.ErrorsToString().c_str();
+    auto cpp = result.m_translations.find(ScriptCanvas::Translation::TargetFlags::Cpp);
+    ASSERT_NE(cpp, result.m_translations.end()) << result.ErrorsToString().c_str();
+
+    AZ::Data::Asset<ScriptCanvas::RuntimeAsset> asset(aznew ScriptCanvas::RuntimeAsset(AZ::Data::AssetId(k_goldenGraphId), AZ::Data::AssetData::AssetStatus::Ready), AZ::Data::AssetLoadBehavior::PreLoad);
+    ScriptCanvas::RuntimeData& runtimeData = asset.Get()->GetData();
+    runtimeData.m_input = lua->second.m_runtimeInputs;
+    runtimeData.m_debugMap = lua->second.m_debugMap;
+    runtimeData.m_script = CompileLua(k_goldenGraphId, lua->second.m_text);
+    ScriptCanvas::Execution::Context::InitializeActivationData(runtimeData);
+    ScriptCanvas::Execution::InitializeInterpretedStatics(runtimeData);
+    ScriptCanvas::SystemRequestBus::Broadcast(&ScriptCanvas::SystemRequests::SetInterpretedBuildConfiguration, ScriptCanvas::BuildConfiguration::Release);
+
+    ScriptCanvasEditor::Reporter interpretedReporter;
+    interpretedReporter.SetExecutionMode(ScriptCanvas::ExecutionMode::Interpreted);
+    interpretedReporter.SetDurations(result.m_parseDuration, lua->second.m_duration);
+    RunPerformance(asset, Activations, interpretedReporter);
+
+    // the same asset executes natively once the nodeable of its translation is registered
+    ScriptCanvasEditor::Reporter nativeReporter;
+    nativeReporter.SetExecutionMode(ScriptCanvas::ExecutionMode::Native);
+    nativeReporter.SetDurations(result.m_parseDuration, cpp->second.m_duration);
+    ScriptCanvas::AutoNative::NativeTranslationGolden::Register();
+    RunPerformance(asset, Activations, nativeReporter);
+    ScriptCanvas::AutoNative::NativeTranslationGolden::Unregister();
+
+    AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::ClearAssetReferences, runtimeData.m_script.GetId());
+    AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::GarbageCollect);
+
+    EXPECT_EQ(2 * Activations, unitTestHandler.SideEffectCount("native"));
+    ReportPerformance(interpretedReporter);
+    ReportPerformance(nativeReporter);
+    delete graph->GetEntity();
+}
@@ -14,6 +14,10 @@ set(FILES
     Source/Framework/ScriptCanvasTestUtilities.cpp
     Source/Framework/ScriptCanvasTestApplication.h
     Source/Framework/EntityRefTests.h
+    Tests/NativeTranslation/NativeTranslationEBusGolden.h
+    Tests/NativeTranslation/NativeTranslationEBusGolden.cpp
+    Tests/NativeTranslation/NativeTranslationGolden.h
+    Tests/NativeTranslation/NativeTranslationGolden.cpp
     Tests/ScriptCanvasTestingTest.cpp
     Tests/ScriptCanvas_BehaviorContext.cpp
     Tests/ScriptCanvas_ContainerSupport.cpp
@@ -21,6 +25,7 @@ set(FILES
     Tests/ScriptCanvas_EventHandlers.cpp
     Tests/ScriptCanvas_Math.cpp
     Tests/ScriptCanvas_MethodOverload.cpp
+    Tests/ScriptCanvas_NativeTranslation.cpp
     Tests/ScriptCanvas_NodeGenerics.cpp
     Tests/ScriptCanvas_Regressions.cpp
     Tests/ScriptCanvas_RuntimeInterpreted.cpp